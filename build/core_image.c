@@ -0,0 +1,13570 @@
+#ifndef JANET_AMALG
+#include <janet.h>
+#endif
+static const unsigned char janet_core_image_bytes[] = {
+    0xD3, 0x81, 0xC0, 0xCF, 0x08, 0x6F, 0x73, 0x2F, 0x63, 0x6C,
+    0x6F, 0x63, 0x6B, 0xD3, 0x02, 0xD0, 0x05, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0xD8, 0x08, 0x6F, 0x73, 0x2F, 0x63, 0x6C, 0x6F,
+    0x63, 0x6B, 0xD0, 0x03, 0x64, 0x6F, 0x63, 0xCE, 0x80, 0x83,
+    0x28, 0x6F, 0x73, 0x2F, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20,
+    0x6F, 0x66, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73,
+    0x20, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x20, 0x73, 0x6F, 0x6D,
+    0x65, 0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 0x20, 0x70, 0x6F,
+    0x69, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x69, 0x6D,
+    0x65, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x6C, 0x6F,
+    0x63, 0x6B, 0x20, 0x69, 0x73, 0x20, 0x67, 0x75, 0x61, 0x72,
+    0x61, 0x6E, 0x74, 0x65, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20,
+    0x62, 0x65, 0x20, 0x6E, 0x6F, 0x6E, 0x20, 0x64, 0x65, 0x63,
+    0x72, 0x65, 0x61, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E,
+    0x20, 0x72, 0x65, 0x61, 0x6C, 0x20, 0x74, 0x69, 0x6D, 0x65,
+    0x2E, 0xCF, 0x06, 0x64, 0x69, 0x73, 0x61, 0x73, 0x6D, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x06, 0x64, 0x69, 0x73, 0x61, 0x73,
+    0x6D, 0xDA, 0x05, 0xCE, 0x80, 0xAB, 0x28, 0x64, 0x69, 0x73,
+    0x61, 0x73, 0x6D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62,
+    0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x62, 0x65, 0x20,
+    0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x66, 0x75,
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x0A, 0x66, 0x75,
+    0x6E, 0x63, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65,
+    0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x2C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x63,
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E,
+    0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x72, 0x6F,
+    0x77, 0x20, 0x6F, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+    0x20, 0x6F, 0x6E, 0x20, 0x61, 0x20, 0x62, 0x61, 0x64, 0x6C,
+    0x79, 0x0A, 0x74, 0x79, 0x70, 0x65, 0x64, 0x20, 0x61, 0x72,
+    0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xCF, 0x0B, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x74, 0x72, 0x69, 0x6D,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x2F, 0x74, 0x72, 0x69, 0x6D, 0xDA, 0x05, 0xCE,
+    0x80, 0xA9, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F,
+    0x74, 0x72, 0x69, 0x6D, 0x20, 0x73, 0x74, 0x72, 0x20, 0x26,
+    0x6F, 0x70, 0x74, 0x20, 0x73, 0x65, 0x74, 0x29, 0x0A, 0x0A,
+    0x54, 0x72, 0x69, 0x6D, 0x20, 0x6C, 0x65, 0x61, 0x64, 0x69,
+    0x6E, 0x67, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x72, 0x61,
+    0x69, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x77, 0x68, 0x69, 0x74,
+    0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x66, 0x72, 0x6F,
+    0x6D, 0x20, 0x61, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x73,
+    0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x2E, 0x20, 0x49,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75,
+    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x73, 0x65, 0x74, 0x20, 0x69,
+    0x73, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x64,
+    0x2C, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72,
+    0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x63, 0x68, 0x61, 0x72,
+    0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x69, 0x6E, 0x20,
+    0x73, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20,
+    0x77, 0x68, 0x69, 0x74, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65,
+    0x2E, 0xCF, 0x06, 0x62, 0x79, 0x74, 0x65, 0x73, 0x3F, 0xD3,
+    0x03, 0xD0, 0x0A, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2D,
+    0x6D, 0x61, 0x70, 0xD2, 0x03, 0x00, 0xCE, 0x0A, 0x62, 0x6F,
+    0x6F, 0x74, 0x2E, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x61, 0x01,
+    0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x09, 0x01,
+    0x01, 0x01, 0x05, 0x17, 0xCE, 0x06, 0x62, 0x79, 0x74, 0x65,
+    0x73, 0x3F, 0xDA, 0x12, 0xD8, 0x04, 0x74, 0x79, 0x70, 0x65,
+    0xD0, 0x06, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0xD0, 0x06,
+    0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0xD0, 0x07, 0x6B, 0x65,
+    0x79, 0x77, 0x6F, 0x72, 0x64, 0xD0, 0x06, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x28, 0x01, 0x00, 0x00, 0x2B, 0x00, 0x00,
+    0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x17,
+    0x03, 0x02, 0x00, 0x26, 0x05, 0x01, 0x00, 0x1F, 0x04, 0x03,
+    0x05, 0x1A, 0x04, 0x03, 0x00, 0x23, 0x05, 0x00, 0x00, 0x03,
+    0x05, 0x00, 0x00, 0x26, 0x06, 0x02, 0x00, 0x1F, 0x05, 0x03,
+    0x06, 0x1A, 0x05, 0x03, 0x00, 0x23, 0x06, 0x00, 0x00, 0x03,
+    0x06, 0x00, 0x00, 0x26, 0x07, 0x03, 0x00, 0x1F, 0x06, 0x03,
+    0x07, 0x1A, 0x06, 0x03, 0x00, 0x23, 0x07, 0x00, 0x00, 0x03,
+    0x07, 0x00, 0x00, 0x26, 0x08, 0x04, 0x00, 0x1F, 0x07, 0x03,
+    0x08, 0x03, 0x07, 0x00, 0x00, 0x1F, 0x01, 0xC2, 0x01, 0x02,
+    0x03, 0x02, 0x12, 0x01, 0x00, 0x0D, 0x02, 0x02, 0x08, 0x03,
+    0x00, 0x07, 0x02, 0x00, 0x36, 0x03, 0x00, 0x07, 0x02, 0x00,
+    0x36, 0x03, 0x00, 0x07, 0x03, 0x00, 0x30, 0xDA, 0x05, 0xCE,
+    0x36, 0x28, 0x62, 0x79, 0x74, 0x65, 0x73, 0x3F, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69,
+    0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x73, 0x79, 0x6D,
+    0x62, 0x6F, 0x6C, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF, 0x02, 0x2B, 0x3D, 0xD3,
+    0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x80, 0x80,
+    0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x06,
+    0x02, 0x02, 0x02, 0x02, 0x08, 0xCE, 0x02, 0x2B, 0x3D, 0xDA,
+    0x12, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x09, 0x06, 0x00, 0x00,
+    0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x13, 0xCE, 0x01, 0x2B,
+    0x39, 0x01, 0x00, 0x00, 0x20, 0x02, 0x01, 0x00, 0x1A, 0x02,
+    0x03, 0x00, 0x25, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+    0x20, 0x02, 0x01, 0x01, 0x1A, 0x02, 0x05, 0x00, 0x25, 0x03,
+    0x00, 0x00, 0x37, 0x04, 0x00, 0x00, 0x06, 0x03, 0x03, 0x04,
+    0x03, 0x03, 0x00, 0x00, 0x37, 0x03, 0x00, 0x00, 0x25, 0x05,
+    0x01, 0x00, 0x34, 0x04, 0x00, 0x05, 0x06, 0x03, 0x03, 0x04,
+    0x05, 0x05, 0x05, 0x01, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02,
+    0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xCF, 0x03, 0x73, 0x65,
+    0x74, 0x28, 0x02, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2D,
+    0x04, 0x00, 0x01, 0x3F, 0x03, 0x00, 0x00, 0x26, 0x05, 0x01,
+    0x00, 0x2D, 0x05, 0x00, 0x03, 0x3F, 0x04, 0x00, 0x00, 0x03,
+    0x04, 0x00, 0x00, 0x07, 0x01, 0x80, 0x02, 0x02, 0x07, 0x00,
+    0x60, 0xD0, 0x05, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0xCB, 0xDA,
+    0x05, 0xCE, 0x24, 0x28, 0x2B, 0x3D, 0x20, 0x78, 0x20, 0x6E,
+    0x29, 0x0A, 0x0A, 0x49, 0x6E, 0x63, 0x72, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61,
+    0x72, 0x20, 0x78, 0x20, 0x62, 0x79, 0x20, 0x6E, 0x2E, 0xCF,
+    0x0A, 0x67, 0x63, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61,
+    0x6C, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x67, 0x63, 0x69,
+    0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0xDA, 0x05, 0xCE,
+    0x70, 0x28, 0x67, 0x63, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x76,
+    0x61, 0x6C, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x74,
+    0x65, 0x67, 0x65, 0x72, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+    0x72, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+    0x20, 0x74, 0x6F, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61,
+    0x74, 0x65, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20,
+    0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6E,
+    0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x6F, 0x66, 0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67,
+    0x65, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x2E, 0xCF, 0x0B, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x72, 0x2F, 0x62, 0x79, 0x74, 0x65, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x0B, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x62,
+    0x79, 0x74, 0x65, 0xDA, 0x05, 0xCE, 0x5C, 0x28, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x72, 0x2F, 0x62, 0x79, 0x74, 0x65, 0x20,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x62, 0x29, 0x0A,
+    0x0A, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x61, 0x20, 0x73,
+    0x69, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65,
+    0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2E, 0xCF,
+    0x04, 0x6F, 0x64, 0x64, 0x3F, 0xD3, 0x03, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x4E, 0x01, 0xDA, 0x03, 0xD7, 0xCD,
+    0x02, 0x98, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01, 0x01, 0x0C,
+    0xCE, 0x04, 0x6F, 0x64, 0x64, 0x3F, 0xDA, 0x12, 0xD8, 0x01,
+    0x25, 0x28, 0x01, 0x00, 0x00, 0x25, 0x02, 0x02, 0x00, 0x2C,
+    0x00, 0x02, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03,
+    0x00, 0x25, 0x04, 0x00, 0x00, 0x1F, 0x03, 0x04, 0x02, 0x19,
+    0x03, 0x03, 0x00, 0x23, 0x03, 0x00, 0x00, 0x18, 0x02, 0x00,
+    0x00, 0x24, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x0A,
+    0x01, 0x9C, 0x01, 0x02, 0x04, 0x00, 0x58, 0x07, 0x00, 0x0F,
+    0xDA, 0x05, 0xCE, 0x1C, 0x28, 0x6F, 0x64, 0x64, 0x3F, 0x20,
+    0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20,
+    0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x64,
+    0x64, 0x2E, 0xCF, 0x06, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65,
+    0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x82,
+    0x8B, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00,
+    0x0A, 0x03, 0x03, 0x03, 0x00, 0x0F, 0xCE, 0x06, 0x72, 0x65,
+    0x64, 0x75, 0x63, 0x65, 0xDA, 0x12, 0x28, 0x03, 0x00, 0x00,
+    0x17, 0x04, 0x01, 0x00, 0x25, 0x05, 0x00, 0x00, 0x39, 0x06,
+    0x02, 0x00, 0x17, 0x07, 0x06, 0x00, 0x41, 0x06, 0x05, 0x07,
+    0x1A, 0x06, 0x08, 0x00, 0x34, 0x08, 0x02, 0x05, 0x17, 0x09,
+    0x08, 0x00, 0x2C, 0x04, 0x09, 0x00, 0x2F, 0x04, 0x00, 0x00,
+    0x25, 0x08, 0x01, 0x00, 0x06, 0x05, 0x05, 0x08, 0x18, 0xF8,
+    0xFF, 0xFF, 0x03, 0x04, 0x00, 0x00, 0x13, 0x01, 0x96, 0x0A,
+    0x02, 0x01, 0x08, 0x04, 0x07, 0x02, 0x00, 0x02, 0x00, 0x2A,
+    0x03, 0x00, 0x29, 0x01, 0x09, 0x03, 0xDA, 0x05, 0xCE, 0x80,
+    0x95, 0x28, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x20, 0x66,
+    0x20, 0x69, 0x6E, 0x69, 0x74, 0x20, 0x69, 0x6E, 0x64, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x64, 0x75, 0x63, 0x65, 0x2C, 0x20,
+    0x61, 0x6C, 0x73, 0x6F, 0x20, 0x6B, 0x6E, 0x6F, 0x77, 0x20,
+    0x61, 0x73, 0x20, 0x66, 0x6F, 0x6C, 0x64, 0x2D, 0x6C, 0x65,
+    0x66, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x6D, 0x61, 0x6E, 0x79,
+    0x20, 0x6C, 0x61, 0x6E, 0x67, 0x75, 0x61, 0x67, 0x65, 0x73,
+    0x2C, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x6F, 0x72,
+    0x6D, 0x73, 0x20, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64,
+    0x65, 0x78, 0x65, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20,
+    0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2C, 0x20, 0x74, 0x75,
+    0x70, 0x6C, 0x65, 0x29, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x74, 0x6F, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63,
+    0x65, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E,
+    0xCF, 0x03, 0x69, 0x6E, 0x63, 0xD3, 0x03, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x7C, 0x01, 0xDA, 0x03, 0xD7, 0xCD,
+    0x02, 0x98, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x00, 0x04,
+    0xCE, 0x03, 0x69, 0x6E, 0x63, 0xDA, 0x12, 0x28, 0x01, 0x00,
+    0x00, 0x25, 0x03, 0x01, 0x00, 0x06, 0x02, 0x00, 0x03, 0x03,
+    0x02, 0x00, 0x00, 0x07, 0x01, 0xF8, 0x01, 0x02, 0x03, 0x00,
+    0x3E, 0xDA, 0x05, 0xCE, 0x17, 0x28, 0x69, 0x6E, 0x63, 0x20,
+    0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x78, 0x20, 0x2B, 0x20, 0x31, 0x2E, 0xCF, 0x06,
+    0x69, 0x66, 0x2D, 0x6C, 0x65, 0x74, 0xD3, 0x04, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x82, 0x01, 0x01, 0xDA, 0x03,
+    0xD7, 0xCD, 0x02, 0xBA, 0x00, 0x00, 0x09, 0x03, 0x02, 0x03,
+    0x04, 0x16, 0x01, 0xCE, 0x06, 0x69, 0x66, 0x2D, 0x6C, 0x65,
+    0x74, 0xDA, 0x12, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x04,
+    0x01, 0x01, 0x01, 0x00, 0x04, 0xCE, 0x05, 0x7A, 0x65, 0x72,
+    0x6F, 0x3F, 0xDA, 0x12, 0x28, 0x01, 0x00, 0x00, 0x25, 0x03,
+    0x00, 0x00, 0x45, 0x02, 0x00, 0x03, 0x03, 0x02, 0x00, 0x00,
+    0x07, 0x01, 0x9E, 0x01, 0x02, 0x03, 0x00, 0x4C, 0xCE, 0x1B,
+    0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x61,
+    0x74, 0x20, 0x6C, 0x65, 0x61, 0x73, 0x74, 0x20, 0x31, 0x20,
+    0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0xDA, 0x33, 0xCE,
+    0x23, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20,
+    0x61, 0x6E, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x6E, 0x75,
+    0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x69,
+    0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x03, 0x00, 0x00,
+    0x39, 0x04, 0x00, 0x00, 0x17, 0x05, 0x04, 0x00, 0x2B, 0x05,
+    0x00, 0x00, 0x26, 0x07, 0x00, 0x00, 0x2F, 0x06, 0x07, 0x00,
+    0x1A, 0x06, 0x04, 0x00, 0x26, 0x07, 0x01, 0x00, 0x01, 0x07,
+    0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x2B, 0x05, 0x00, 0x00,
+    0x26, 0x07, 0x02, 0x00, 0x2F, 0x06, 0x07, 0x00, 0x1A, 0x06,
+    0x04, 0x00, 0x26, 0x07, 0x03, 0x00, 0x01, 0x07, 0x00, 0x00,
+    0x18, 0x01, 0x00, 0x00, 0x2A, 0x06, 0x00, 0x00, 0x17, 0x07,
+    0x06, 0x00, 0x25, 0x08, 0x00, 0x00, 0x2B, 0x08, 0x00, 0x00,
+    0x30, 0x07, 0x00, 0x00, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x0C,
+    0x01, 0x01, 0x01, 0x06, 0x46, 0x01, 0xCE, 0x03, 0x61, 0x75,
+    0x78, 0xDA, 0x12, 0xD7, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x05,
+    0x01, 0x01, 0x01, 0x02, 0x09, 0x01, 0xCE, 0x0B, 0x69, 0x64,
+    0x65, 0x6D, 0x70, 0x6F, 0x74, 0x65, 0x6E, 0x74, 0x3F, 0xDA,
+    0x12, 0xDA, 0x15, 0xD8, 0x03, 0x6E, 0x6F, 0x74, 0x28, 0x01,
+    0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00,
+    0x2F, 0x02, 0x03, 0x00, 0x27, 0x04, 0x00, 0x01, 0x34, 0x03,
+    0x04, 0x02, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x02, 0x01, 0x00,
+    0x30, 0x02, 0x00, 0x00, 0xBF, 0xFF, 0x0D, 0x01, 0xF2, 0x01,
+    0x0A, 0x03, 0x00, 0x5C, 0x02, 0x00, 0x29, 0x03, 0x00, 0x09,
+    0x00, 0x04, 0xDA, 0x4C, 0xD5, 0x05, 0xDA, 0x19, 0xCB, 0xD0,
+    0x05, 0x61, 0x72, 0x72, 0x61, 0x79, 0xCB, 0xD0, 0x06, 0x73,
+    0x74, 0x72, 0x75, 0x63, 0x74, 0xCB, 0xD0, 0x05, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0xCB, 0xD0, 0x05, 0x74, 0x75, 0x70, 0x6C,
+    0x65, 0xCB, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x70, 0x01, 0xDA, 0x03, 0xDA, 0x4C, 0xDA, 0x05, 0xCE,
+    0x4E, 0x28, 0x69, 0x64, 0x65, 0x6D, 0x70, 0x6F, 0x74, 0x65,
+    0x6E, 0x74, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68,
+    0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69,
+    0x73, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75,
+    0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x74,
+    0x73, 0x65, 0x6C, 0x66, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20,
+    0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x64, 0x2E, 0xDA,
+    0x03, 0xD8, 0x06, 0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0xCF,
+    0x03, 0x64, 0x65, 0x66, 0xD8, 0x05, 0x74, 0x75, 0x70, 0x6C,
+    0x65, 0xCF, 0x02, 0x69, 0x66, 0xCF, 0x02, 0x64, 0x6F, 0x28,
+    0x01, 0x00, 0x00, 0x27, 0x03, 0x00, 0x05, 0x44, 0x02, 0x00,
+    0x03, 0x1A, 0x02, 0x03, 0x00, 0x27, 0x03, 0x00, 0x01, 0x03,
+    0x03, 0x00, 0x00, 0x27, 0x04, 0x00, 0x00, 0x34, 0x03, 0x04,
+    0x00, 0x17, 0x04, 0x03, 0x00, 0x25, 0x05, 0x01, 0x00, 0x06,
+    0x03, 0x05, 0x00, 0x27, 0x06, 0x00, 0x00, 0x34, 0x05, 0x06,
+    0x03, 0x17, 0x03, 0x05, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x26,
+    0x06, 0x00, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x17, 0x06, 0x05,
+    0x00, 0x1A, 0x06, 0x03, 0x00, 0x17, 0x05, 0x04, 0x00, 0x18,
+    0x04, 0x00, 0x00, 0x26, 0x08, 0x01, 0x00, 0x2F, 0x07, 0x08,
+    0x00, 0x17, 0x05, 0x07, 0x00, 0x17, 0x07, 0x05, 0x00, 0x1A,
+    0x06, 0x13, 0x00, 0x26, 0x05, 0x02, 0x00, 0x2D, 0x05, 0x07,
+    0x03, 0x26, 0x08, 0x03, 0x00, 0x2F, 0x05, 0x08, 0x00, 0x25,
+    0x09, 0x02, 0x00, 0x06, 0x08, 0x09, 0x00, 0x2B, 0x08, 0x00,
+    0x00, 0x2F, 0x09, 0x01, 0x00, 0x26, 0x08, 0x04, 0x00, 0x2D,
+    0x08, 0x07, 0x09, 0x27, 0x08, 0x00, 0x02, 0x2B, 0x08, 0x00,
+    0x00, 0x26, 0x0A, 0x03, 0x00, 0x2F, 0x08, 0x0A, 0x00, 0x26,
+    0x09, 0x05, 0x00, 0x2D, 0x09, 0x05, 0x08, 0x26, 0x09, 0x03,
+    0x00, 0x30, 0x09, 0x00, 0x00, 0x26, 0x05, 0x02, 0x00, 0x2D,
+    0x05, 0x07, 0x03, 0x26, 0x08, 0x03, 0x00, 0x2F, 0x05, 0x08,
+    0x00, 0x26, 0x08, 0x02, 0x00, 0x2D, 0x08, 0x04, 0x07, 0x26,
+    0x09, 0x03, 0x00, 0x2F, 0x08, 0x09, 0x00, 0x25, 0x0A, 0x02,
+    0x00, 0x06, 0x09, 0x0A, 0x00, 0x2B, 0x09, 0x00, 0x00, 0x2F,
+    0x0A, 0x01, 0x00, 0x26, 0x09, 0x05, 0x00, 0x2D, 0x09, 0x08,
+    0x0A, 0x26, 0x0B, 0x03, 0x00, 0x2F, 0x09, 0x0B, 0x00, 0x26,
+    0x08, 0x04, 0x00, 0x2D, 0x08, 0x07, 0x09, 0x27, 0x08, 0x00,
+    0x02, 0x2B, 0x08, 0x00, 0x00, 0x26, 0x0A, 0x03, 0x00, 0x2F,
+    0x08, 0x0A, 0x00, 0x26, 0x09, 0x05, 0x00, 0x2D, 0x09, 0x05,
+    0x08, 0x26, 0x09, 0x03, 0x00, 0x30, 0x09, 0x00, 0x00, 0xBF,
+    0xFF, 0x52, 0x01, 0x92, 0x08, 0x06, 0x02, 0x02, 0x0C, 0x03,
+    0x00, 0x07, 0x02, 0x06, 0x18, 0x01, 0x00, 0x0F, 0x02, 0x02,
+    0x2A, 0x02, 0x00, 0x19, 0x01, 0x00, 0x0F, 0x03, 0x02, 0x12,
+    0x01, 0x00, 0x11, 0x03, 0x02, 0x12, 0x02, 0x00, 0x16, 0x01,
+    0x00, 0x15, 0x01, 0x00, 0x11, 0x01, 0x02, 0x00, 0x04, 0x06,
+    0x12, 0x02, 0x02, 0x28, 0x02, 0x00, 0x09, 0x06, 0x00, 0x1D,
+    0x04, 0x03, 0x0D, 0x04, 0x0A, 0x0E, 0x04, 0x06, 0x1C, 0x02,
+    0x02, 0x0A, 0x02, 0x00, 0x09, 0x04, 0x03, 0x0D, 0x06, 0x01,
+    0x0D, 0x04, 0x03, 0x0D, 0x28, 0x01, 0x82, 0x08, 0x02, 0x01,
+    0x0A, 0x16, 0x01, 0x00, 0x11, 0x03, 0x02, 0x08, 0x01, 0x00,
+    0x07, 0x02, 0x00, 0x20, 0x01, 0x00, 0x1F, 0x03, 0x02, 0x08,
+    0x01, 0x00, 0x07, 0x02, 0x00, 0x1E, 0x01, 0x00, 0x1D, 0x02,
+    0x02, 0x00, 0x03, 0x2A, 0x00, 0xDA, 0x24, 0xCB, 0xDA, 0x05,
+    0xCE, 0x80, 0xC7, 0x28, 0x69, 0x66, 0x2D, 0x6C, 0x65, 0x74,
+    0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20,
+    0x74, 0x72, 0x75, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x66,
+    0x61, 0x6C, 0x29, 0x0A, 0x0A, 0x4D, 0x61, 0x6B, 0x65, 0x20,
+    0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x62,
+    0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x2C, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20,
+    0x61, 0x72, 0x65, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68, 0x79,
+    0x2C, 0x20, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74,
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x72, 0x75, 0x20,
+    0x66, 0x6F, 0x72, 0x6D, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x61,
+    0x6E, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66, 0x61, 0x6C,
+    0x73, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x6E, 0x69, 0x6C, 0x2C,
+    0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x20,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x61, 0x6C, 0x20, 0x66,
+    0x6F, 0x72, 0x6D, 0x2E, 0x20, 0x42, 0x69, 0x6E, 0x64, 0x69,
+    0x6E, 0x67, 0x73, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x73, 0x79,
+    0x6E, 0x74, 0x61, 0x78, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6C, 0x65, 0x74, 0x20, 0x6D, 0x61, 0x63, 0x72,
+    0x6F, 0x2E, 0xCF, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x2D,
+    0x69, 0x6E, 0x66, 0xD3, 0x02, 0xDA, 0x03, 0xC8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xDA, 0x05, 0xCE, 0x29,
+    0x54, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74,
+    0x69, 0x6E, 0x67, 0x20, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69,
+    0x76, 0x65, 0x20, 0x69, 0x6E, 0x66, 0x69, 0x6E, 0x69, 0x74,
+    0x79, 0xCF, 0x07, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x07, 0x63, 0x6F, 0x6D, 0x70,
+    0x69, 0x6C, 0x65, 0xDA, 0x05, 0xCE, 0x81, 0x05, 0x28, 0x63,
+    0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x73, 0x74,
+    0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x20,
+    0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x29, 0x0A, 0x0A, 0x43,
+    0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x6E,
+    0x20, 0x41, 0x62, 0x73, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20,
+    0x53, 0x79, 0x6E, 0x74, 0x61, 0x78, 0x20, 0x54, 0x72, 0x65,
+    0x65, 0x20, 0x28, 0x61, 0x73, 0x74, 0x29, 0x20, 0x69, 0x6E,
+    0x74, 0x6F, 0x20, 0x61, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E,
+    0x20, 0x50, 0x61, 0x69, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x66, 0x75,
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x70, 0x61, 0x72, 0x73, 0x69, 0x6E, 0x67, 0x20,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C,
+    0x69, 0x74, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x6D, 0x70,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x65, 0x76, 0x61,
+    0x6C, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x61, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x66,
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74,
+    0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x79, 0x20, 0x61, 0x73,
+    0x74, 0x2E, 0x20, 0x54, 0x68, 0x72, 0x6F, 0x77, 0x73, 0x20,
+    0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x69,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x73, 0x74, 0x20,
+    0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20,
+    0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x64, 0x2E, 0xCF,
+    0x02, 0x69, 0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0x08, 0x00, 0x06, 0x04, 0x03, 0x02, 0x03, 0x00, 0x06, 0xCE,
+    0x02, 0x69, 0x6E, 0x34, 0x00, 0x00, 0x01, 0x22, 0x03, 0x00,
+    0x00, 0x1F, 0x03, 0x00, 0x03, 0x19, 0x03, 0x02, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0xDA, 0x05, 0xCE,
+    0x81, 0x8A, 0x28, 0x69, 0x6E, 0x20, 0x64, 0x73, 0x20, 0x6B,
+    0x65, 0x79, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x64, 0x66,
+    0x6C, 0x74, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x64, 0x73,
+    0x20, 0x61, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x2C, 0x20, 0x77,
+    0x6F, 0x72, 0x6B, 0x73, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x73,
+    0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+    0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+    0x74, 0x75, 0x72, 0x65, 0x73, 0x2E, 0x20, 0x41, 0x72, 0x72,
+    0x61, 0x79, 0x73, 0x2C, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65,
+    0x73, 0x2C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x2C,
+    0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x73, 0x2C, 0x20,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 0x2C, 0x20, 0x73,
+    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x2C, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x20,
+    0x61, 0x72, 0x65, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x61, 0x73,
+    0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65,
+    0x20, 0x75, 0x73, 0x65, 0x64, 0x2E, 0x20, 0x41, 0x72, 0x72,
+    0x61, 0x79, 0x73, 0x2C, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65,
+    0x73, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x73,
+    0x2C, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x2C,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F,
+    0x6C, 0x73, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x75, 0x73,
+    0x65, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20,
+    0x6B, 0x65, 0x79, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x61, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x62, 0x6F, 0x75,
+    0x6E, 0x64, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x61, 0x6E, 0x20,
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x73, 0x20, 0x72,
+    0x61, 0x69, 0x73, 0x65, 0x64, 0x2E, 0x20, 0x53, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20,
+    0x74, 0x61, 0x6B, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20,
+    0x6B, 0x65, 0x79, 0x20, 0x65, 0x78, 0x63, 0x65, 0x70, 0x74,
+    0x20, 0x6E, 0x69, 0x6C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x77,
+    0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x20, 0x6E, 0x69, 0x6C, 0x20, 0x6F, 0x72, 0x20, 0x64, 0x66,
+    0x6C, 0x74, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+    0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0xCF, 0x02, 0x2D, 0x2D,
+    0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x7F,
+    0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x05,
+    0x01, 0x01, 0x01, 0x02, 0x09, 0xCE, 0x02, 0x2D, 0x2D, 0xDA,
+    0x12, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x0A, 0x06, 0x00, 0x00,
+    0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x13, 0xCE, 0x01, 0x2D,
+    0x39, 0x01, 0x00, 0x00, 0x20, 0x02, 0x01, 0x00, 0x1A, 0x02,
+    0x03, 0x00, 0x25, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+    0x20, 0x02, 0x01, 0x01, 0x1A, 0x02, 0x05, 0x00, 0x25, 0x03,
+    0x00, 0x00, 0x37, 0x04, 0x00, 0x00, 0x07, 0x03, 0x03, 0x04,
+    0x03, 0x03, 0x00, 0x00, 0x37, 0x03, 0x00, 0x00, 0x25, 0x05,
+    0x01, 0x00, 0x34, 0x04, 0x00, 0x05, 0x07, 0x03, 0x03, 0x04,
+    0x05, 0x05, 0x05, 0x01, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02,
+    0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x22, 0x28, 0x01,
+    0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x25, 0x04, 0x01, 0x00,
+    0x2D, 0x03, 0x00, 0x04, 0x3F, 0x02, 0x00, 0x00, 0x26, 0x04,
+    0x01, 0x00, 0x2D, 0x04, 0x00, 0x02, 0x3F, 0x03, 0x00, 0x00,
+    0x03, 0x03, 0x00, 0x00, 0x07, 0x01, 0xFE, 0x01, 0x02, 0x08,
+    0x00, 0x5C, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x22, 0x28,
+    0x2D, 0x2D, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x44, 0x65, 0x63,
+    0x72, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x76, 0x61, 0x72, 0x20, 0x78, 0x20, 0x62, 0x79,
+    0x20, 0x31, 0x2E, 0xCF, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+    0x6C, 0x6F, 0x67, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x08, 0x6D,
+    0x61, 0x74, 0x68, 0x2F, 0x6C, 0x6F, 0x67, 0xDA, 0x05, 0xCE,
+    0x33, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x6C, 0x6F, 0x67,
+    0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x6C, 0x6F, 0x67, 0x20, 0x62, 0x61, 0x73,
+    0x65, 0x20, 0x6E, 0x61, 0x74, 0x75, 0x72, 0x61, 0x6C, 0x20,
+    0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20,
+    0x78, 0x2E, 0xCF, 0x0A, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F,
+    0x74, 0x79, 0x70, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A,
+    0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x74, 0x79, 0x70, 0x65,
+    0xDA, 0x05, 0xCE, 0x81, 0x1D, 0x28, 0x74, 0x75, 0x70, 0x6C,
+    0x65, 0x2F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x74, 0x75, 0x70,
+    0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x20,
+    0x68, 0x6F, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x75,
+    0x70, 0x6C, 0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x63, 0x6F,
+    0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x65, 0x64, 0x2E,
+    0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79,
+    0x77, 0x6F, 0x72, 0x64, 0x20, 0x3A, 0x62, 0x72, 0x61, 0x63,
+    0x6B, 0x65, 0x74, 0x73, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x77, 0x61,
+    0x73, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x64, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x62, 0x72, 0x61, 0x63, 0x6B, 0x65,
+    0x74, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x3A, 0x70,
+    0x61, 0x72, 0x65, 0x6E, 0x73, 0x20, 0x6F, 0x74, 0x68, 0x65,
+    0x72, 0x77, 0x69, 0x73, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x65,
+    0x20, 0x74, 0x77, 0x6F, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x73,
+    0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x68, 0x61,
+    0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D,
+    0x65, 0x20, 0x6D, 0x6F, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x2C, 0x20,
+    0x62, 0x75, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x70,
+    0x72, 0x69, 0x6E, 0x74, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65,
+    0x72, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x62, 0x65, 0x20, 0x74, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x64, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6E,
+    0x74, 0x6C, 0x79, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x72, 0x2E,
+    0xCF, 0x04, 0x6E, 0x61, 0x6E, 0x3F, 0xD3, 0x03, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x4C, 0x01, 0xDA, 0x03, 0xD7,
+    0xCD, 0x02, 0x98, 0x00, 0x00, 0x03, 0x01, 0x01, 0x01, 0x00,
+    0x07, 0xCE, 0x04, 0x6E, 0x61, 0x6E, 0x3F, 0xDA, 0x12, 0x28,
+    0x01, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x00, 0x19, 0x02, 0x03,
+    0x00, 0x23, 0x02, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24,
+    0x02, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x07, 0x01, 0x98,
+    0x01, 0x02, 0x06, 0x00, 0x46, 0xDA, 0x05, 0xCE, 0x1B, 0x28,
+    0x6E, 0x61, 0x6E, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43,
+    0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20,
+    0x69, 0x73, 0x20, 0x4E, 0x61, 0x4E, 0xCF, 0x09, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x2F, 0x6E, 0x65, 0x77, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x09, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x6E,
+    0x65, 0x77, 0xDA, 0x05, 0xCE, 0x80, 0xF5, 0x28, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x63, 0x61,
+    0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x0A, 0x0A, 0x43,
+    0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6E,
+    0x65, 0x77, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x70, 0x72, 0x65, 0x2D, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61,
+    0x74, 0x65, 0x64, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79,
+    0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63,
+    0x69, 0x74, 0x79, 0x20, 0x65, 0x6E, 0x74, 0x72, 0x69, 0x65,
+    0x73, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6D, 0x65,
+    0x61, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69,
+    0x66, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6B, 0x6E, 0x6F, 0x77,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+    0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x6E, 0x74, 0x72,
+    0x69, 0x65, 0x73, 0x20, 0x67, 0x6F, 0x69, 0x6E, 0x67, 0x20,
+    0x74, 0x6F, 0x20, 0x67, 0x6F, 0x20, 0x69, 0x6E, 0x20, 0x61,
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x6E, 0x20,
+    0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20,
+    0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x6D, 0x65, 0x6D, 0x6F,
+    0x72, 0x79, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65,
+    0x20, 0x61, 0x76, 0x6F, 0x69, 0x64, 0x65, 0x64, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x2E, 0xCF, 0x07, 0x70, 0x72, 0x6F, 0x74, 0x65, 0x63,
+    0x74, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x80, 0xE7, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x99, 0x00,
+    0x00, 0x05, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x02,
+    0x0A, 0xCE, 0x07, 0x70, 0x72, 0x6F, 0x74, 0x65, 0x63, 0x74,
+    0xDA, 0x12, 0xCF, 0x02, 0x66, 0x6E, 0xD7, 0xCD, 0x00, 0x08,
+    0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x00, 0x08, 0xCE, 0x05,
+    0x70, 0x63, 0x61, 0x6C, 0x6C, 0x46, 0x01, 0x00, 0x00, 0x18,
+    0x03, 0x00, 0x00, 0x24, 0x02, 0x00, 0x00, 0x18, 0x02, 0x00,
+    0x00, 0x23, 0x02, 0x00, 0x00, 0x2C, 0x02, 0x01, 0x00, 0x40,
+    0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x28, 0x01, 0x00,
+    0x00, 0x40, 0x02, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2C,
+    0x04, 0x02, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x3F, 0x03, 0x00,
+    0x00, 0x26, 0x04, 0x01, 0x00, 0x2C, 0x04, 0x03, 0x00, 0x3F,
+    0x02, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x07, 0x01, 0xCE,
+    0x03, 0x02, 0x09, 0x0A, 0x04, 0xDA, 0x24, 0xCB, 0xDA, 0x05,
+    0xCE, 0x80, 0xD4, 0x28, 0x70, 0x72, 0x6F, 0x74, 0x65, 0x63,
+    0x74, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A,
+    0x0A, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x20,
+    0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E,
+    0x73, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x63,
+    0x61, 0x70, 0x74, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x61,
+    0x6E, 0x79, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E,
+    0x20, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73,
+    0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x74, 0x75, 0x70, 0x6C,
+    0x65, 0x20, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x77, 0x6F, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x20,
+    0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73,
+    0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x66, 0x20, 0x73,
+    0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x66, 0x75, 0x6C, 0x2C,
+    0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20,
+    0x61, 0x6E, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2C,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+    0x65, 0x63, 0x6F, 0x6E, 0x64, 0x20, 0x69, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x65,
+    0x72, 0x72, 0x6F, 0x72, 0x2E, 0xCF, 0x02, 0x2D, 0x3D, 0xD3,
+    0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x80, 0x81,
+    0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x06,
+    0x02, 0x02, 0x02, 0x02, 0x08, 0xCE, 0x02, 0x2D, 0x3D, 0xDA,
+    0x12, 0xDA, 0x6E, 0xDA, 0x22, 0x28, 0x02, 0x00, 0x00, 0x26,
+    0x04, 0x00, 0x00, 0x2D, 0x04, 0x00, 0x01, 0x3F, 0x03, 0x00,
+    0x00, 0x26, 0x05, 0x01, 0x00, 0x2D, 0x05, 0x00, 0x03, 0x3F,
+    0x04, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x07, 0x01, 0x82,
+    0x02, 0x02, 0x07, 0x00, 0x60, 0xDA, 0x24, 0xCB, 0xDA, 0x05,
+    0xCE, 0x24, 0x28, 0x2D, 0x3D, 0x20, 0x78, 0x20, 0x6E, 0x29,
+    0x0A, 0x0A, 0x44, 0x65, 0x63, 0x72, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x72,
+    0x20, 0x78, 0x20, 0x62, 0x79, 0x20, 0x6E, 0x2E, 0xCF, 0x03,
+    0x64, 0x79, 0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x03, 0x64,
+    0x79, 0x6E, 0xDA, 0x05, 0xCE, 0x66, 0x28, 0x64, 0x79, 0x6E,
+    0x20, 0x6B, 0x65, 0x79, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20,
+    0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x29, 0x0A, 0x0A,
+    0x47, 0x65, 0x74, 0x20, 0x61, 0x20, 0x64, 0x79, 0x6E, 0x61,
+    0x6D, 0x69, 0x63, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75,
+    0x6C, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x28,
+    0x6F, 0x72, 0x20, 0x6E, 0x69, 0x6C, 0x29, 0x20, 0x69, 0x66,
+    0x20, 0x6E, 0x6F, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0xCF, 0x09,
+    0x75, 0x6E, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x09, 0x75, 0x6E, 0x6D, 0x61, 0x72,
+    0x73, 0x68, 0x61, 0x6C, 0xDA, 0x05, 0xCE, 0x80, 0xFC, 0x28,
+    0x75, 0x6E, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x26, 0x6F, 0x70,
+    0x74, 0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x73,
+    0x74, 0x61, 0x72, 0x74, 0x29, 0x0A, 0x0A, 0x55, 0x6E, 0x6D,
+    0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x20, 0x61, 0x20, 0x6A,
+    0x61, 0x6E, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x41, 0x6E, 0x20, 0x6F,
+    0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x6C, 0x6F,
+    0x6F, 0x6B, 0x75, 0x70, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x70, 0x72,
+    0x6F, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20,
+    0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x20, 0x66, 0x6F, 0x72, 0x20,
+    0x61, 0x6C, 0x69, 0x61, 0x73, 0x65, 0x73, 0x20, 0x74, 0x6F,
+    0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76,
+    0x65, 0x64, 0x2E, 0x20, 0x52, 0x65, 0x61, 0x64, 0x69, 0x6E,
+    0x67, 0x20, 0x62, 0x65, 0x67, 0x69, 0x6E, 0x73, 0x20, 0x61,
+    0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x69, 0x6E, 0x64,
+    0x65, 0x78, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2C, 0x20,
+    0x30, 0x20, 0x62, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75,
+    0x6C, 0x74, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x20, 0x75, 0x6E, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61,
+    0x6C, 0x6C, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x2E, 0xCF, 0x02, 0x2D, 0x3E, 0xD3, 0x04, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x83, 0x42, 0x01, 0xDA, 0x03, 0xD7,
+    0xCD, 0x02, 0xB9, 0x00, 0x00, 0x06, 0x01, 0x01, 0xCD, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x01, 0x06, 0x01, 0xCE, 0x02, 0x2D, 0x3E,
+    0xDA, 0x12, 0xDA, 0x39, 0x28, 0x02, 0x00, 0x00, 0x2A, 0x03,
+    0x00, 0x00, 0x17, 0x04, 0x03, 0x00, 0x2D, 0x04, 0x00, 0x01,
+    0x26, 0x05, 0x00, 0x00, 0x30, 0x05, 0x00, 0x00, 0xCD, 0x02,
+    0x98, 0x00, 0x00, 0x09, 0x02, 0x02, 0x02, 0x06, 0x25, 0xCE,
+    0x03, 0x66, 0x6F, 0x70, 0xDA, 0x12, 0xDA, 0x15, 0xDA, 0x50,
+    0xD8, 0x0B, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x73, 0x6C,
+    0x69, 0x63, 0x65, 0xDA, 0x57, 0xD8, 0x0C, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2F, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0xD8,
+    0x0B, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69,
+    0x63, 0x65, 0x28, 0x02, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00,
+    0x26, 0x05, 0x00, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x26, 0x06,
+    0x01, 0x00, 0x1F, 0x05, 0x06, 0x04, 0x1A, 0x05, 0x0C, 0x00,
+    0x25, 0x06, 0x00, 0x00, 0x34, 0x04, 0x01, 0x06, 0x25, 0x06,
+    0x01, 0x00, 0x2C, 0x01, 0x06, 0x00, 0x26, 0x07, 0x02, 0x00,
+    0x2F, 0x06, 0x07, 0x00, 0x2C, 0x04, 0x06, 0x00, 0x26, 0x08,
+    0x03, 0x00, 0x2F, 0x07, 0x08, 0x00, 0x17, 0x03, 0x07, 0x00,
+    0x18, 0x06, 0x00, 0x00, 0x3A, 0x04, 0x00, 0x00, 0x2C, 0x01,
+    0x04, 0x00, 0x26, 0x07, 0x03, 0x00, 0x2F, 0x06, 0x07, 0x00,
+    0x17, 0x03, 0x06, 0x00, 0x37, 0x04, 0x03, 0x00, 0x17, 0x05,
+    0x04, 0x00, 0x37, 0x04, 0x03, 0x01, 0x17, 0x06, 0x04, 0x00,
+    0x2C, 0x05, 0x00, 0x00, 0x3A, 0x04, 0x00, 0x00, 0x2C, 0x04,
+    0x06, 0x00, 0x26, 0x08, 0x04, 0x00, 0x2F, 0x07, 0x08, 0x00,
+    0x17, 0x04, 0x07, 0x00, 0x25, 0x08, 0x00, 0x00, 0x2C, 0x04,
+    0x08, 0x00, 0x26, 0x08, 0x05, 0x00, 0x30, 0x08, 0x00, 0x00,
+    0x2B, 0x01, 0x8E, 0x0D, 0x06, 0x03, 0x02, 0x36, 0x02, 0x00,
+    0x13, 0x01, 0x00, 0x07, 0x02, 0x02, 0x12, 0x04, 0x00, 0x12,
+    0x03, 0x00, 0x1F, 0x02, 0x01, 0x03, 0x04, 0x04, 0x04, 0x01,
+    0x03, 0x03, 0x04, 0x00, 0x15, 0x05, 0x06, 0x16, 0x01, 0x00,
+    0x15, 0x04, 0x02, 0x00, 0x0A, 0x01, 0x84, 0x0D, 0x02, 0x02,
+    0x0A, 0x04, 0x03, 0x0C, 0x00, 0xDA, 0x24, 0xCB, 0xDA, 0x05,
+    0xCE, 0x80, 0xDD, 0x28, 0x2D, 0x3E, 0x20, 0x78, 0x20, 0x26,
+    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29, 0x0A, 0x0A, 0x54,
+    0x68, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x6D,
+    0x61, 0x63, 0x72, 0x6F, 0x2E, 0x20, 0x49, 0x6E, 0x73, 0x65,
+    0x72, 0x74, 0x73, 0x20, 0x78, 0x20, 0x61, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66,
+    0x6F, 0x72, 0x6D, 0x20, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6F,
+    0x72, 0x6D, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69,
+    0x6E, 0x73, 0x65, 0x72, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20,
+    0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D,
+    0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72,
+    0x6D, 0x20, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x73, 0x61, 0x6D, 0x65, 0x20, 0x6D, 0x61, 0x6E, 0x6E, 0x65,
+    0x72, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x6F, 0x20,
+    0x6F, 0x6E, 0x2E, 0x20, 0x55, 0x73, 0x65, 0x66, 0x75, 0x6C,
+    0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65,
+    0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x69, 0x70, 0x65,
+    0x6C, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x64,
+    0x61, 0x74, 0x61, 0x2E, 0xCF, 0x09, 0x64, 0x65, 0x65, 0x70,
+    0x2D, 0x68, 0x61, 0x73, 0x68, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x09, 0x64, 0x65, 0x65, 0x70, 0x2D, 0x68, 0x61, 0x73, 0x68,
+    0xDA, 0x05, 0xCE, 0x80, 0xE6, 0x28, 0x64, 0x65, 0x65, 0x70,
+    0x2D, 0x68, 0x61, 0x73, 0x68, 0x20, 0x78, 0x29, 0x0A, 0x0A,
+    0x47, 0x65, 0x74, 0x73, 0x20, 0x61, 0x20, 0x68, 0x61, 0x73,
+    0x68, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x78, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 0x65, 0x20,
+    0x64, 0x65, 0x65, 0x70, 0x3D, 0x20, 0x68, 0x61, 0x76, 0x65,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20,
+    0x68, 0x61, 0x73, 0x68, 0x2E, 0x20, 0x55, 0x6E, 0x6C, 0x69,
+    0x6B, 0x65, 0x20, 0x68, 0x61, 0x73, 0x68, 0x2C, 0x20, 0x6D,
+    0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x64, 0x61, 0x74,
+    0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72,
+    0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x68, 0x61, 0x73,
+    0x68, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65,
+    0x69, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74,
+    0x73, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x68, 0x61, 0x73, 0x68, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67,
+    0x65, 0x73, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x79,
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x6D, 0x75, 0x74, 0x61, 0x74,
+    0x65, 0x64, 0x2E, 0x20, 0x52, 0x61, 0x69, 0x73, 0x65, 0x73,
+    0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20,
+    0x6F, 0x6E, 0x20, 0x63, 0x79, 0x63, 0x6C, 0x69, 0x63, 0x20,
+    0x64, 0x61, 0x74, 0x61, 0x2E, 0xCF, 0x0C, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x2F, 0x73, 0x70, 0x6C, 0x69, 0x74, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x2F, 0x73, 0x70, 0x6C, 0x69, 0x74, 0xDA, 0x05, 0xCE,
+    0x81, 0x69, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F,
+    0x73, 0x70, 0x6C, 0x69, 0x74, 0x20, 0x64, 0x65, 0x6C, 0x69,
+    0x6D, 0x20, 0x73, 0x74, 0x72, 0x20, 0x26, 0x6F, 0x70, 0x74,
+    0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x6C, 0x69, 0x6D,
+    0x69, 0x74, 0x29, 0x0A, 0x0A, 0x53, 0x70, 0x6C, 0x69, 0x74,
+    0x73, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x20, 0x73, 0x74, 0x72, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x64, 0x65, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x65, 0x72, 0x20,
+    0x64, 0x65, 0x6C, 0x69, 0x6D, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x6E,
+    0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20,
+    0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x73,
+    0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x75, 0x62, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x77, 0x69, 0x6C,
+    0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74,
+    0x61, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65,
+    0x6C, 0x69, 0x6D, 0x69, 0x74, 0x65, 0x72, 0x20, 0x64, 0x65,
+    0x6C, 0x69, 0x6D, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x64, 0x65,
+    0x6C, 0x69, 0x6D, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74,
+    0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x65, 0x64,
+    0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x77, 0x69, 0x6C,
+    0x6C, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x6F, 0x6E, 0x65,
+    0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20,
+    0x57, 0x69, 0x6C, 0x6C, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74,
+    0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x69, 0x6E, 0x67,
+    0x20, 0x66, 0x6F, 0x72, 0x20, 0x64, 0x65, 0x6C, 0x69, 0x6D,
+    0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20,
+    0x28, 0x69, 0x66, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64,
+    0x65, 0x64, 0x29, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x75, 0x70, 0x20, 0x74,
+    0x6F, 0x20, 0x61, 0x20, 0x6D, 0x61, 0x78, 0x69, 0x6D, 0x75,
+    0x6D, 0x20, 0x6F, 0x66, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74,
+    0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73, 0x20, 0x28,
+    0x69, 0x66, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65,
+    0x64, 0x29, 0x2E, 0xCF, 0x09, 0x61, 0x62, 0x73, 0x74, 0x72,
+    0x61, 0x63, 0x74, 0x3F, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09,
+    0x61, 0x62, 0x73, 0x74, 0x72, 0x61, 0x63, 0x74, 0x3F, 0xDA,
+    0x05, 0xCE, 0x2E, 0x28, 0x61, 0x62, 0x73, 0x74, 0x72, 0x61,
+    0x63, 0x74, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68,
+    0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69,
+    0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x62, 0x73, 0x74, 0x72,
+    0x61, 0x63, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x2E, 0xCF,
+    0x04, 0x63, 0x6F, 0x72, 0x6F, 0xD3, 0x04, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x81, 0xE9, 0x01, 0xDA, 0x03, 0xD7,
+    0xCD, 0x02, 0x99, 0x00, 0x00, 0x05, 0x00, 0x00, 0xCD, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x05, 0x0C, 0xCE, 0x04, 0x63, 0x6F, 0x72,
+    0x6F, 0xDA, 0x12, 0xDA, 0x80, 0x87, 0xD2, 0x00, 0x01, 0xDA,
+    0x57, 0xD8, 0x09, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6E,
+    0x65, 0x77, 0xD0, 0x02, 0x79, 0x69, 0x28, 0x01, 0x00, 0x00,
+    0x26, 0x02, 0x00, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2C, 0x02,
+    0x03, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x26, 0x03, 0x02, 0x00,
+    0x2F, 0x02, 0x03, 0x00, 0x26, 0x03, 0x03, 0x00, 0x26, 0x04,
+    0x04, 0x00, 0x2D, 0x03, 0x02, 0x04, 0x26, 0x03, 0x02, 0x00,
+    0x30, 0x03, 0x00, 0x00, 0x0A, 0x01, 0xD2, 0x07, 0x02, 0x06,
+    0x06, 0x26, 0x05, 0x00, 0x21, 0xDA, 0x24, 0xCB, 0xDA, 0x05,
+    0xCE, 0x52, 0x28, 0x63, 0x6F, 0x72, 0x6F, 0x20, 0x26, 0x20,
+    0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A, 0x41, 0x20, 0x77,
+    0x72, 0x61, 0x70, 0x70, 0x65, 0x72, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x6D, 0x61, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x73, 0x2E, 0x20, 0x53, 0x61, 0x6D, 0x65,
+    0x20, 0x61, 0x73, 0x20, 0x28, 0x66, 0x69, 0x62, 0x65, 0x72,
+    0x2F, 0x6E, 0x65, 0x77, 0x20, 0x28, 0x66, 0x6E, 0x20, 0x5B,
+    0x5D, 0x20, 0x3B, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x20, 0x3A,
+    0x79, 0x69, 0x29, 0x2E, 0xCF, 0x04, 0x6C, 0x61, 0x73, 0x74,
+    0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x82,
+    0x5D, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00,
+    0x05, 0x01, 0x01, 0x01, 0x00, 0x06, 0xCE, 0x04, 0x6C, 0x61,
+    0x73, 0x74, 0xDA, 0x12, 0x28, 0x01, 0x00, 0x00, 0x39, 0x02,
+    0x00, 0x00, 0x25, 0x04, 0x01, 0x00, 0x07, 0x03, 0x02, 0x04,
+    0x34, 0x02, 0x00, 0x03, 0x03, 0x02, 0x00, 0x00, 0x0D, 0x01,
+    0xBA, 0x09, 0x02, 0x01, 0x06, 0x18, 0x02, 0x00, 0x05, 0x02,
+    0x00, 0x0D, 0xDA, 0x05, 0xCE, 0x3F, 0x28, 0x6C, 0x61, 0x73,
+    0x74, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65,
+    0x78, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73,
+    0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0xCF,
+    0x04, 0x6E, 0x65, 0x67, 0x3F, 0xD3, 0x03, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x51, 0x01, 0xDA, 0x03, 0xD7, 0xCD,
+    0x02, 0x98, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x00, 0x04,
+    0xCE, 0x04, 0x6E, 0x65, 0x67, 0x3F, 0xDA, 0x12, 0x28, 0x01,
+    0x00, 0x00, 0x25, 0x03, 0x00, 0x00, 0x41, 0x02, 0x00, 0x03,
+    0x03, 0x02, 0x00, 0x00, 0x07, 0x01, 0xA2, 0x01, 0x02, 0x03,
+    0x00, 0x58, 0xDA, 0x05, 0xCE, 0x24, 0x28, 0x6E, 0x65, 0x67,
+    0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63,
+    0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20,
+    0x6C, 0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20,
+    0x30, 0x2E, 0xCF, 0x0D, 0x67, 0x63, 0x73, 0x65, 0x74, 0x69,
+    0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x0D, 0x67, 0x63, 0x73, 0x65, 0x74, 0x69, 0x6E,
+    0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0xDA, 0x05, 0xCE, 0x80,
+    0xD3, 0x28, 0x67, 0x63, 0x73, 0x65, 0x74, 0x69, 0x6E, 0x74,
+    0x65, 0x72, 0x76, 0x61, 0x6C, 0x20, 0x69, 0x6E, 0x74, 0x65,
+    0x72, 0x76, 0x61, 0x6C, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74,
+    0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65,
+    0x72, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F,
+    0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F,
+    0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x20,
+    0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x72, 0x75, 0x6E,
+    0x6E, 0x69, 0x6E, 0x67, 0x20, 0x67, 0x61, 0x72, 0x62, 0x61,
+    0x67, 0x65, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x4C, 0x6F, 0x77, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20,
+    0x69, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0x20, 0x77,
+    0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x73, 0x6C, 0x6F,
+    0x77, 0x65, 0x72, 0x20, 0x62, 0x75, 0x74, 0x20, 0x75, 0x73,
+    0x65, 0x20, 0x6C, 0x65, 0x73, 0x73, 0x20, 0x6D, 0x65, 0x6D,
+    0x6F, 0x72, 0x79, 0x2E, 0x20, 0x48, 0x69, 0x67, 0x68, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6C,
+    0x6C, 0x20, 0x62, 0x65, 0x20, 0x66, 0x61, 0x73, 0x74, 0x65,
+    0x72, 0x20, 0x62, 0x75, 0x74, 0x20, 0x75, 0x73, 0x65, 0x20,
+    0x6D, 0x6F, 0x72, 0x65, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72,
+    0x79, 0x2E, 0xCF, 0x04, 0x64, 0x65, 0x66, 0x2D, 0xD3, 0x04,
+    0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x38, 0x01, 0xDA,
+    0x03, 0xD7, 0xCD, 0x02, 0x99, 0x00, 0x00, 0x06, 0x01, 0x01,
+    0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0x07, 0xCE, 0x04, 0x64,
+    0x65, 0x66, 0x2D, 0xDA, 0x12, 0xDA, 0x56, 0xD0, 0x07, 0x70,
+    0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x28, 0x02, 0x00, 0x00,
+    0x26, 0x04, 0x00, 0x00, 0x26, 0x05, 0x01, 0x00, 0x2D, 0x04,
+    0x00, 0x05, 0x2E, 0x01, 0x00, 0x00, 0x3F, 0x03, 0x00, 0x00,
+    0x03, 0x03, 0x00, 0x00, 0x06, 0x01, 0x70, 0x02, 0x06, 0x06,
+    0x04, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x45, 0x28, 0x64,
+    0x65, 0x66, 0x2D, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x26,
+    0x20, 0x6D, 0x6F, 0x72, 0x65, 0x29, 0x0A, 0x0A, 0x44, 0x65,
+    0x66, 0x69, 0x6E, 0x65, 0x20, 0x61, 0x20, 0x70, 0x72, 0x69,
+    0x76, 0x61, 0x74, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x65, 0x78,
+    0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x2E, 0xCF, 0x05, 0x65,
+    0x70, 0x72, 0x69, 0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x05,
+    0x65, 0x70, 0x72, 0x69, 0x6E, 0xDA, 0x05, 0xCE, 0x54, 0x28,
+    0x65, 0x70, 0x72, 0x69, 0x6E, 0x20, 0x26, 0x20, 0x78, 0x73,
+    0x29, 0x0A, 0x0A, 0x53, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x73,
+    0x20, 0x70, 0x72, 0x69, 0x6E, 0x2C, 0x20, 0x62, 0x75, 0x74,
+    0x20, 0x75, 0x73, 0x65, 0x73, 0x20, 0x28, 0x64, 0x79, 0x6E,
+    0x20, 0x3A, 0x65, 0x72, 0x72, 0x20, 0x73, 0x74, 0x64, 0x65,
+    0x72, 0x72, 0x29, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61,
+    0x64, 0x20, 0x6F, 0x66, 0x20, 0x28, 0x64, 0x79, 0x6E, 0x20,
+    0x3A, 0x6F, 0x75, 0x74, 0x20, 0x73, 0x74, 0x64, 0x6F, 0x75,
+    0x74, 0x29, 0x2E, 0xCF, 0x0C, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2F, 0x65, 0x6E, 0x73, 0x75, 0x72, 0x65, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x0C, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x65,
+    0x6E, 0x73, 0x75, 0x72, 0x65, 0xDA, 0x05, 0xCE, 0x81, 0x50,
+    0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x65, 0x6E, 0x73,
+    0x75, 0x72, 0x65, 0x20, 0x61, 0x72, 0x72, 0x20, 0x63, 0x61,
+    0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x67, 0x72, 0x6F,
+    0x77, 0x74, 0x68, 0x29, 0x0A, 0x0A, 0x45, 0x6E, 0x73, 0x75,
+    0x72, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20,
+    0x62, 0x61, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x69, 0x73,
+    0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20, 0x65, 0x6E, 0x6F,
+    0x75, 0x67, 0x68, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x61,
+    0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x69, 0x74, 0x65,
+    0x6D, 0x73, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x72, 0x61, 0x74, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x67, 0x72, 0x6F, 0x77, 0x74, 0x68,
+    0x2E, 0x20, 0x43, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x67, 0x72, 0x6F, 0x77, 0x74,
+    0x68, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20,
+    0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x73, 0x2E, 0x20,
+    0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63,
+    0x6B, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63,
+    0x69, 0x74, 0x79, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6C, 0x72,
+    0x65, 0x61, 0x64, 0x79, 0x20, 0x65, 0x6E, 0x6F, 0x75, 0x67,
+    0x68, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68,
+    0x69, 0x73, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74,
+    0x68, 0x69, 0x6E, 0x67, 0x2E, 0x20, 0x4F, 0x74, 0x68, 0x65,
+    0x72, 0x77, 0x69, 0x73, 0x65, 0x2C, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x62, 0x61, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x6D,
+    0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+    0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x61, 0x6C, 0x6C, 0x6F,
+    0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x73, 0x6F, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20,
+    0x69, 0x73, 0x20, 0x65, 0x6E, 0x6F, 0x75, 0x67, 0x68, 0x20,
+    0x73, 0x70, 0x61, 0x63, 0x65, 0x2E, 0xCF, 0x0C, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x2F, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x66, 0x69, 0x62, 0x65,
+    0x72, 0x2F, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76, 0xDA, 0x05,
+    0xCE, 0x60, 0x28, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x67,
+    0x65, 0x74, 0x65, 0x6E, 0x76, 0x20, 0x66, 0x69, 0x62, 0x65,
+    0x72, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E,
+    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61,
+    0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x20,
+    0x69, 0x66, 0x20, 0x6E, 0x6F, 0x20, 0x73, 0x75, 0x63, 0x68,
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20,
+    0x73, 0x65, 0x74, 0x20, 0x79, 0x65, 0x74, 0x2E, 0xCF, 0x08,
+    0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x3F, 0xD3, 0x03,
+    0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x57, 0x01, 0xDA,
+    0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x05, 0x01, 0x01,
+    0x01, 0x02, 0x07, 0xCE, 0x08, 0x6B, 0x65, 0x79, 0x77, 0x6F,
+    0x72, 0x64, 0x3F, 0xDA, 0x12, 0xDA, 0x15, 0xDA, 0x18, 0x28,
+    0x01, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00,
+    0x00, 0x2F, 0x02, 0x03, 0x00, 0x26, 0x04, 0x01, 0x00, 0x1F,
+    0x03, 0x02, 0x04, 0x03, 0x03, 0x00, 0x00, 0x0A, 0x01, 0xAE,
+    0x01, 0x02, 0x03, 0x00, 0x62, 0x03, 0x00, 0x05, 0xDA, 0x05,
+    0xCE, 0x26, 0x28, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64,
+    0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63,
+    0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20,
+    0x61, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x2E,
+    0xCF, 0x06, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3F, 0xD3, 0x03,
+    0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x5C, 0x01, 0xDA,
+    0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x05, 0x01, 0x01,
+    0x01, 0x02, 0x07, 0xCE, 0x06, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x3F, 0xDA, 0x12, 0xDA, 0x15, 0xDA, 0x4F, 0x28, 0x01, 0x00,
+    0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F,
+    0x02, 0x03, 0x00, 0x26, 0x04, 0x01, 0x00, 0x1F, 0x03, 0x02,
+    0x04, 0x03, 0x03, 0x00, 0x00, 0x0A, 0x01, 0xB8, 0x01, 0x02,
+    0x03, 0x00, 0x54, 0x03, 0x00, 0x05, 0xDA, 0x05, 0xCE, 0x1F,
+    0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3F, 0x20, 0x78, 0x29,
+    0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+    0x20, 0x78, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x2E, 0xCF, 0x05, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0xD3, 0x03,
+    0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x82, 0xBD, 0x01,
+    0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x0A, 0x02,
+    0x02, 0x02, 0x00, 0x13, 0xCE, 0x05, 0x63, 0x6F, 0x75, 0x6E,
+    0x74, 0xDA, 0x12, 0x28, 0x02, 0x00, 0x00, 0x25, 0x03, 0x00,
+    0x00, 0x25, 0x04, 0x00, 0x00, 0x39, 0x05, 0x01, 0x00, 0x17,
+    0x06, 0x05, 0x00, 0x41, 0x05, 0x04, 0x06, 0x1A, 0x05, 0x0C,
+    0x00, 0x34, 0x07, 0x01, 0x04, 0x17, 0x08, 0x07, 0x00, 0x2B,
+    0x08, 0x00, 0x00, 0x2F, 0x07, 0x00, 0x00, 0x1A, 0x07, 0x04,
+    0x00, 0x25, 0x09, 0x01, 0x00, 0x06, 0x03, 0x03, 0x09, 0x18,
+    0x01, 0x00, 0x00, 0x25, 0x07, 0x01, 0x00, 0x06, 0x04, 0x04,
+    0x07, 0x18, 0xF4, 0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00, 0x1C,
+    0x01, 0xFA, 0x0A, 0x02, 0x01, 0x08, 0x04, 0x07, 0x02, 0x00,
+    0x02, 0x02, 0x0C, 0x01, 0x00, 0x07, 0x02, 0x02, 0x04, 0x01,
+    0x01, 0x03, 0x03, 0x01, 0x03, 0x01, 0x09, 0x03, 0xDA, 0x05,
+    0xCE, 0x52, 0x28, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x70,
+    0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A,
+    0x43, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20,
+    0x69, 0x74, 0x65, 0x6D, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x69,
+    0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x77, 0x68, 0x69,
+    0x63, 0x68, 0x20, 0x28, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69,
+    0x74, 0x65, 0x6D, 0x29, 0x20, 0x20, 0x69, 0x73, 0x20, 0x74,
+    0x72, 0x75, 0x65, 0x2E, 0xCF, 0x10, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x62, 0x79,
+    0x74, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x10, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D,
+    0x62, 0x79, 0x74, 0x65, 0xDA, 0x05, 0xCE, 0x80, 0xA6, 0x28,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x75, 0x73,
+    0x68, 0x2D, 0x62, 0x79, 0x74, 0x65, 0x20, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x41, 0x70,
+    0x70, 0x65, 0x6E, 0x64, 0x20, 0x61, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20,
+    0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x61, 0x73,
+    0x20, 0x6E, 0x65, 0x63, 0x65, 0x73, 0x73, 0x61, 0x72, 0x79,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69,
+    0x65, 0x64, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E,
+    0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x72, 0x6F,
+    0x77, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+    0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x66,
+    0x6C, 0x6F, 0x77, 0x73, 0x2E, 0xCF, 0x0A, 0x64, 0x6F, 0x63,
+    0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0xD3, 0x03, 0xDA,
+    0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x85, 0x15, 0x01, 0xDA,
+    0x03, 0xD7, 0xCD, 0x02, 0xBA, 0x00, 0x00, 0x13, 0x01, 0x01,
+    0x01, 0x08, 0x4C, 0x01, 0xCE, 0x0A, 0x64, 0x6F, 0x63, 0x2D,
+    0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0xDA, 0x12, 0xD0, 0x09,
+    0x64, 0x6F, 0x63, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0xDA,
+    0x80, 0x94, 0xCE, 0x04, 0x20, 0x20, 0x20, 0x20, 0xCE, 0x00,
+    0xCE, 0x02, 0x20, 0x20, 0xD8, 0x12, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0xDA, 0x80, 0xF0, 0xCE, 0x05, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x28, 0x01, 0x00, 0x00, 0x26, 0x02,
+    0x00, 0x00, 0x25, 0x03, 0x50, 0x00, 0x2C, 0x02, 0x03, 0x00,
+    0x26, 0x03, 0x01, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x25, 0x04,
+    0x08, 0x00, 0x07, 0x03, 0x02, 0x04, 0x17, 0x02, 0x03, 0x00,
+    0x26, 0x04, 0x02, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x3B, 0x04,
+    0x00, 0x00, 0x17, 0x05, 0x04, 0x00, 0x26, 0x06, 0x03, 0x00,
+    0x2B, 0x06, 0x00, 0x00, 0x3B, 0x06, 0x00, 0x00, 0x17, 0x07,
+    0x06, 0x00, 0x25, 0x08, 0x00, 0x00, 0x2A, 0x09, 0x00, 0x00,
+    0x17, 0x0A, 0x09, 0x00, 0x25, 0x0B, 0x00, 0x00, 0x39, 0x0C,
+    0x00, 0x00, 0x17, 0x0D, 0x0C, 0x00, 0x41, 0x0C, 0x0B, 0x0D,
+    0x1A, 0x0C, 0x32, 0x00, 0x34, 0x0E, 0x00, 0x0B, 0x17, 0x0F,
+    0x0E, 0x00, 0x25, 0x11, 0x0A, 0x00, 0x1F, 0x10, 0x0F, 0x11,
+    0x19, 0x10, 0x03, 0x00, 0x23, 0x10, 0x00, 0x00, 0x18, 0x02,
+    0x00, 0x00, 0x24, 0x10, 0x00, 0x00, 0x1A, 0x10, 0x09, 0x00,
+    0x25, 0x12, 0x20, 0x00, 0x1F, 0x11, 0x0F, 0x12, 0x19, 0x11,
+    0x03, 0x00, 0x23, 0x11, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+    0x24, 0x11, 0x00, 0x00, 0x17, 0x0E, 0x11, 0x00, 0x18, 0x02,
+    0x00, 0x00, 0x22, 0x0E, 0x00, 0x00, 0x1A, 0x0E, 0x0D, 0x00,
+    0x25, 0x11, 0x09, 0x00, 0x1F, 0x10, 0x0F, 0x11, 0x1A, 0x10,
+    0x06, 0x00, 0x26, 0x11, 0x04, 0x00, 0x2C, 0x07, 0x11, 0x00,
+    0x26, 0x12, 0x05, 0x00, 0x2F, 0x11, 0x12, 0x00, 0x18, 0x04,
+    0x00, 0x00, 0x2C, 0x07, 0x0F, 0x00, 0x26, 0x12, 0x06, 0x00,
+    0x2F, 0x11, 0x12, 0x00, 0x18, 0x10, 0x00, 0x00, 0x39, 0x10,
+    0x07, 0x00, 0x25, 0x12, 0x00, 0x00, 0x43, 0x11, 0x10, 0x12,
+    0x1A, 0x11, 0x03, 0x00, 0x2F, 0x10, 0x0A, 0x00, 0x18, 0x01,
+    0x00, 0x00, 0x25, 0x11, 0x0A, 0x00, 0x1F, 0x10, 0x0F, 0x11,
+    0x1A, 0x10, 0x07, 0x00, 0x26, 0x11, 0x07, 0x00, 0x2C, 0x05,
+    0x11, 0x00, 0x26, 0x12, 0x05, 0x00, 0x2F, 0x11, 0x12, 0x00,
+    0x25, 0x08, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x25, 0x0E,
+    0x01, 0x00, 0x06, 0x0B, 0x0B, 0x0E, 0x18, 0xCE, 0xFF, 0xFF,
+    0x2F, 0x0B, 0x0A, 0x00, 0x03, 0x05, 0x00, 0x00, 0xCD, 0x02,
+    0xD8, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x2B, 0x01,
+    0xCE, 0x08, 0x70, 0x75, 0x73, 0x68, 0x77, 0x6F, 0x72, 0x64,
+    0xDA, 0x12, 0xDA, 0x80, 0xFB, 0xCE, 0x01, 0x20, 0xDA, 0x80,
+    0xFA, 0xD8, 0x0C, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F,
+    0x63, 0x6C, 0x65, 0x61, 0x72, 0x28, 0x00, 0x00, 0x00, 0x27,
+    0x01, 0x00, 0x08, 0x27, 0x04, 0x00, 0x07, 0x39, 0x03, 0x04,
+    0x00, 0x27, 0x05, 0x00, 0x08, 0x06, 0x04, 0x05, 0x03, 0x25,
+    0x05, 0x01, 0x00, 0x06, 0x04, 0x04, 0x05, 0x27, 0x05, 0x00,
+    0x02, 0x42, 0x03, 0x05, 0x04, 0x1A, 0x03, 0x05, 0x00, 0x25,
+    0x04, 0x00, 0x00, 0x29, 0x04, 0x00, 0x08, 0x26, 0x02, 0x00,
+    0x00, 0x18, 0x06, 0x00, 0x00, 0x27, 0x05, 0x00, 0x08, 0x25,
+    0x06, 0x01, 0x00, 0x06, 0x04, 0x05, 0x06, 0x29, 0x04, 0x00,
+    0x08, 0x26, 0x02, 0x01, 0x00, 0x17, 0x03, 0x02, 0x00, 0x27,
+    0x05, 0x00, 0x07, 0x39, 0x04, 0x05, 0x00, 0x27, 0x06, 0x00,
+    0x08, 0x06, 0x05, 0x06, 0x04, 0x29, 0x05, 0x00, 0x08, 0x25,
+    0x06, 0x00, 0x00, 0x43, 0x04, 0x01, 0x06, 0x1A, 0x04, 0x06,
+    0x00, 0x27, 0x06, 0x00, 0x05, 0x2C, 0x06, 0x03, 0x00, 0x26,
+    0x07, 0x02, 0x00, 0x2F, 0x06, 0x07, 0x00, 0x18, 0x01, 0x00,
+    0x00, 0x27, 0x04, 0x00, 0x05, 0x27, 0x06, 0x00, 0x07, 0x2C,
+    0x04, 0x06, 0x00, 0x26, 0x06, 0x02, 0x00, 0x2F, 0x04, 0x06,
+    0x00, 0x27, 0x06, 0x00, 0x07, 0x2B, 0x06, 0x00, 0x00, 0x26,
+    0x06, 0x03, 0x00, 0x30, 0x06, 0x00, 0x00, 0xBF, 0xFF, 0x3A,
+    0x01, 0xBC, 0x14, 0x06, 0x01, 0x04, 0x04, 0x02, 0x04, 0x38,
+    0x04, 0x00, 0x15, 0x02, 0x00, 0x15, 0x01, 0x00, 0x07, 0x02,
+    0x02, 0x0C, 0x02, 0x01, 0x0B, 0x04, 0x04, 0x0C, 0x01, 0x03,
+    0x0B, 0x01, 0x01, 0x03, 0x02, 0x08, 0x18, 0x03, 0x00, 0x17,
+    0x02, 0x02, 0x08, 0x01, 0x00, 0x07, 0x04, 0x02, 0x04, 0x01,
+    0x01, 0x03, 0x05, 0x04, 0x00, 0x04, 0x02, 0x00, 0x64, 0x01,
+    0xAA, 0x14, 0x02, 0x05, 0x08, 0x22, 0x02, 0x00, 0x05, 0x01,
+    0x00, 0x17, 0x04, 0x02, 0x00, 0x04, 0x02, 0x00, 0x01, 0x02,
+    0x00, 0x02, 0x04, 0x00, 0x07, 0x1A, 0x00, 0x06, 0x02, 0x16,
+    0x01, 0x00, 0x09, 0x06, 0x00, 0x22, 0x03, 0x00, 0x21, 0x01,
+    0x00, 0x07, 0x02, 0x02, 0x0C, 0x01, 0x00, 0x07, 0x04, 0x02,
+    0x04, 0x01, 0x01, 0x03, 0x03, 0x04, 0x04, 0x01, 0x05, 0x07,
+    0x01, 0x0A, 0x16, 0x02, 0x00, 0x05, 0x01, 0x00, 0x07, 0x01,
+    0x00, 0x30, 0x01, 0x00, 0x2F, 0x02, 0x02, 0x0C, 0x01, 0x00,
+    0x0B, 0x04, 0x02, 0x04, 0x01, 0x02, 0x00, 0x01, 0x03, 0x03,
+    0x03, 0x0D, 0x0B, 0x01, 0x18, 0x00, 0x01, 0x43, 0x03, 0xDA,
+    0x05, 0xCE, 0x39, 0x28, 0x64, 0x6F, 0x63, 0x2D, 0x66, 0x6F,
+    0x72, 0x6D, 0x61, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
+    0x20, 0x74, 0x65, 0x78, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x77,
+    0x72, 0x61, 0x70, 0x20, 0x61, 0x74, 0x20, 0x61, 0x20, 0x67,
+    0x69, 0x76, 0x65, 0x6E, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x2E,
+    0xCF, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x6C, 0x6F, 0x67,
+    0x32, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6D, 0x61, 0x74,
+    0x68, 0x2F, 0x6C, 0x6F, 0x67, 0x32, 0xDA, 0x05, 0xCE, 0x27,
+    0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x6C, 0x6F, 0x67, 0x32,
+    0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x6C, 0x6F, 0x67, 0x20, 0x62, 0x61, 0x73,
+    0x65, 0x20, 0x32, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF,
+    0x04, 0x77, 0x68, 0x65, 0x6E, 0xD3, 0x04, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x80, 0x95, 0x01, 0xDA, 0x03, 0xD7,
+    0xCD, 0x02, 0x99, 0x00, 0x00, 0x06, 0x01, 0x01, 0xCD, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x02, 0x09, 0xCE, 0x04, 0x77, 0x68, 0x65,
+    0x6E, 0xDA, 0x12, 0xDA, 0x59, 0xDA, 0x58, 0x28, 0x02, 0x00,
+    0x00, 0x26, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2E,
+    0x01, 0x00, 0x00, 0x3F, 0x03, 0x00, 0x00, 0x26, 0x05, 0x01,
+    0x00, 0x2D, 0x05, 0x00, 0x03, 0x3F, 0x04, 0x00, 0x00, 0x03,
+    0x04, 0x00, 0x00, 0x07, 0x01, 0xAA, 0x02, 0x02, 0x08, 0x06,
+    0x04, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x5E, 0x28, 0x77,
+    0x68, 0x65, 0x6E, 0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79,
+    0x29, 0x0A, 0x0A, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74,
+    0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6F, 0x64,
+    0x79, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2E, 0x20,
+    0x4F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69,
+    0x6C, 0x2E, 0xCF, 0x0F, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F,
+    0x61, 0x72, 0x67, 0x2D, 0x73, 0x74, 0x61, 0x63, 0x6B, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x0F, 0x64, 0x65, 0x62, 0x75, 0x67,
+    0x2F, 0x61, 0x72, 0x67, 0x2D, 0x73, 0x74, 0x61, 0x63, 0x6B,
+    0xDA, 0x05, 0xCE, 0x80, 0xCF, 0x28, 0x64, 0x65, 0x62, 0x75,
+    0x67, 0x2F, 0x61, 0x72, 0x67, 0x2D, 0x73, 0x74, 0x61, 0x63,
+    0x6B, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x29, 0x0A, 0x0A,
+    0x47, 0x65, 0x74, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x63, 0x75, 0x72, 0x72,
+    0x65, 0x6E, 0x74, 0x6C, 0x79, 0x20, 0x6F, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x27, 0x73,
+    0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+    0x73, 0x74, 0x61, 0x63, 0x6B, 0x2E, 0x20, 0x4E, 0x6F, 0x72,
+    0x6D, 0x61, 0x6C, 0x6C, 0x79, 0x2C, 0x20, 0x74, 0x68, 0x69,
+    0x73, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62,
+    0x65, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x75, 0x6E,
+    0x6C, 0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61,
+    0x6C, 0x73, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x70,
+    0x75, 0x73, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x72, 0x67,
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x6F, 0x20,
+    0x6D, 0x61, 0x6B, 0x65, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6C, 0x6C,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x2E, 0xCF, 0x07, 0x70, 0x72, 0x65, 0x77, 0x61, 0x6C,
+    0x6B, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x83, 0x9E, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0xBA, 0x00,
+    0x00, 0x06, 0x02, 0x02, 0x02, 0x01, 0x07, 0x01, 0xCE, 0x07,
+    0x70, 0x72, 0x65, 0x77, 0x61, 0x6C, 0x6B, 0xDA, 0x12, 0xD7,
+    0xCD, 0x02, 0x98, 0x00, 0x00, 0x06, 0x02, 0x02, 0x02, 0x06,
+    0x1D, 0xCE, 0x04, 0x77, 0x61, 0x6C, 0x6B, 0xDA, 0x12, 0xDA,
+    0x15, 0xD5, 0x04, 0xDA, 0x4D, 0x02, 0xDA, 0x4E, 0x01, 0xDA,
+    0x4F, 0x00, 0xDA, 0x50, 0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00,
+    0x00, 0x0A, 0x02, 0x02, 0x02, 0x01, 0x15, 0xCE, 0x09, 0x77,
+    0x61, 0x6C, 0x6B, 0x2D, 0x64, 0x69, 0x63, 0x74, 0xDA, 0x12,
+    0xD8, 0x04, 0x6E, 0x65, 0x78, 0x74, 0x28, 0x02, 0x00, 0x00,
+    0x3E, 0x03, 0x00, 0x00, 0x17, 0x04, 0x03, 0x00, 0x22, 0x05,
+    0x00, 0x00, 0x2C, 0x01, 0x05, 0x00, 0x26, 0x06, 0x00, 0x00,
+    0x2F, 0x05, 0x06, 0x00, 0x17, 0x06, 0x05, 0x00, 0x1A, 0x06,
+    0x0C, 0x00, 0x17, 0x05, 0x06, 0x00, 0x2B, 0x05, 0x00, 0x00,
+    0x2F, 0x07, 0x00, 0x00, 0x34, 0x08, 0x01, 0x05, 0x2B, 0x08,
+    0x00, 0x00, 0x2F, 0x09, 0x00, 0x00, 0x36, 0x04, 0x07, 0x09,
+    0x2C, 0x01, 0x06, 0x00, 0x26, 0x07, 0x00, 0x00, 0x2F, 0x06,
+    0x07, 0x00, 0x18, 0xF5, 0xFF, 0xFF, 0x03, 0x04, 0x00, 0x00,
+    0x1C, 0x01, 0x84, 0x0E, 0x02, 0x02, 0x02, 0x04, 0x07, 0x02,
+    0x00, 0x02, 0x02, 0x16, 0x01, 0x00, 0x12, 0x02, 0x00, 0x05,
+    0x01, 0x00, 0x1D, 0x04, 0x01, 0x03, 0x01, 0x03, 0x03, 0xD8,
+    0x0F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x74, 0x6F, 0x2D,
+    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0xD7, 0xCD, 0x02, 0x98,
+    0x00, 0x00, 0x0E, 0x02, 0x02, 0x02, 0x02, 0x17, 0xCE, 0x08,
+    0x77, 0x61, 0x6C, 0x6B, 0x2D, 0x69, 0x6E, 0x64, 0xDA, 0x12,
+    0xD8, 0x09, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x6E, 0x65,
+    0x77, 0xD8, 0x0A, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70,
+    0x75, 0x73, 0x68, 0x28, 0x02, 0x00, 0x00, 0x39, 0x03, 0x01,
+    0x00, 0x17, 0x04, 0x03, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x26,
+    0x06, 0x00, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x17, 0x06, 0x05,
+    0x00, 0x25, 0x07, 0x00, 0x00, 0x39, 0x08, 0x01, 0x00, 0x17,
+    0x09, 0x08, 0x00, 0x41, 0x08, 0x07, 0x09, 0x1A, 0x08, 0x0B,
+    0x00, 0x34, 0x0A, 0x01, 0x07, 0x17, 0x0B, 0x0A, 0x00, 0x2B,
+    0x0B, 0x00, 0x00, 0x2F, 0x0A, 0x00, 0x00, 0x2C, 0x06, 0x0A,
+    0x00, 0x26, 0x0D, 0x01, 0x00, 0x2F, 0x0C, 0x0D, 0x00, 0x25,
+    0x0A, 0x01, 0x00, 0x06, 0x07, 0x07, 0x0A, 0x18, 0xF5, 0xFF,
+    0xFF, 0x03, 0x06, 0x00, 0x00, 0x1F, 0x01, 0xF8, 0x0D, 0x02,
+    0x01, 0x02, 0x16, 0x01, 0x00, 0x11, 0x03, 0x02, 0x12, 0x01,
+    0x00, 0x11, 0x07, 0x02, 0x00, 0x02, 0x00, 0x3A, 0x03, 0x00,
+    0x1F, 0x03, 0x00, 0x19, 0x01, 0x05, 0x03, 0xDA, 0x80, 0xA1,
+    0x28, 0x02, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x04,
+    0x00, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x17, 0x04, 0x03, 0x00,
+    0x47, 0x04, 0x01, 0x00, 0x18, 0x05, 0x00, 0x00, 0x18, 0x07,
+    0x00, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00,
+    0x03, 0x01, 0x00, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x03,
+    0x02, 0x00, 0x30, 0x03, 0x00, 0x00, 0x2C, 0x00, 0x01, 0x00,
+    0x26, 0x05, 0x02, 0x00, 0x2F, 0x03, 0x05, 0x00, 0x2B, 0x03,
+    0x00, 0x00, 0x26, 0x05, 0x03, 0x00, 0x30, 0x05, 0x00, 0x00,
+    0x2C, 0x00, 0x01, 0x00, 0x26, 0x03, 0x04, 0x00, 0x30, 0x03,
+    0x00, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x05, 0x04, 0x00,
+    0x2F, 0x03, 0x05, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x05,
+    0x05, 0x00, 0x30, 0x05, 0x00, 0x00, 0x1C, 0x01, 0x90, 0x0E,
+    0x02, 0x03, 0x0C, 0x10, 0x07, 0x00, 0x0B, 0x03, 0x02, 0x12,
+    0x03, 0x02, 0x24, 0x03, 0x00, 0x21, 0x03, 0x02, 0x01, 0x03,
+    0x02, 0x1A, 0x03, 0x00, 0x19, 0x28, 0x02, 0x00, 0x00, 0x2A,
+    0x03, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x2F, 0x04, 0x00,
+    0x00, 0x2C, 0x03, 0x04, 0x00, 0x26, 0x05, 0x00, 0x00, 0x30,
+    0x05, 0x00, 0x00, 0xCD, 0x02, 0xD0, 0x00, 0x00, 0x02, 0x01,
+    0x01, 0x01, 0x00, 0x04, 0x01, 0xDA, 0x12, 0x27, 0x01, 0x00,
+    0x00, 0x2C, 0x01, 0x00, 0x00, 0x27, 0x01, 0x00, 0x02, 0x30,
+    0x01, 0x00, 0x00, 0xBF, 0xFF, 0x04, 0x04, 0xC2, 0x0E, 0x22,
+    0x0D, 0x01, 0xBC, 0x0E, 0x02, 0x01, 0x06, 0x10, 0x02, 0x00,
+    0x2E, 0x03, 0x00, 0x39, 0xDA, 0x05, 0xCE, 0x42, 0x28, 0x70,
+    0x72, 0x65, 0x77, 0x61, 0x6C, 0x6B, 0x20, 0x66, 0x20, 0x66,
+    0x6F, 0x72, 0x6D, 0x29, 0x0A, 0x0A, 0x53, 0x69, 0x6D, 0x69,
+    0x6C, 0x61, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x6F, 0x73,
+    0x74, 0x77, 0x61, 0x6C, 0x6B, 0x2C, 0x20, 0x62, 0x75, 0x74,
+    0x20, 0x64, 0x6F, 0x20, 0x70, 0x72, 0x65, 0x2D, 0x6F, 0x72,
+    0x64, 0x65, 0x72, 0x20, 0x74, 0x72, 0x61, 0x76, 0x65, 0x72,
+    0x73, 0x61, 0x6C, 0x2E, 0xCF, 0x07, 0x65, 0x70, 0x72, 0x69,
+    0x6E, 0x74, 0x66, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x07, 0x65,
+    0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0xDA, 0x05, 0xCE, 0x7C,
+    0x28, 0x65, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20, 0x66,
+    0x6D, 0x74, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A,
+    0x50, 0x72, 0x69, 0x6E, 0x74, 0x73, 0x20, 0x6F, 0x75, 0x74,
+    0x70, 0x75, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
+    0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x69, 0x66, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x28, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x2F, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20,
+    0x66, 0x6D, 0x74, 0x20, 0x3B, 0x78, 0x73, 0x29, 0x20, 0x74,
+    0x6F, 0x20, 0x28, 0x64, 0x79, 0x6E, 0x20, 0x3A, 0x65, 0x72,
+    0x72, 0x20, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72, 0x29, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x74, 0x72, 0x61,
+    0x69, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x6E, 0x65, 0x77, 0x6C,
+    0x69, 0x6E, 0x65, 0x2E, 0xCF, 0x08, 0x6D, 0x61, 0x74, 0x68,
+    0x2F, 0x74, 0x61, 0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x08,
+    0x6D, 0x61, 0x74, 0x68, 0x2F, 0x74, 0x61, 0x6E, 0xDA, 0x05,
+    0xCE, 0x27, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x74, 0x61,
+    0x6E, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61,
+    0x6E, 0x67, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x78,
+    0x2E, 0xCF, 0x03, 0x6D, 0x69, 0x6E, 0xD3, 0x03, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x82, 0x4A, 0x01, 0xDA, 0x03,
+    0xD7, 0xCD, 0x02, 0x99, 0x00, 0x00, 0x03, 0x00, 0x00, 0xCD,
+    0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0x05, 0xCE, 0x03, 0x6D, 0x69,
+    0x6E, 0xDA, 0x12, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x1B, 0x06,
+    0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 0xCE,
+    0x01, 0x3C, 0x39, 0x01, 0x00, 0x00, 0x1E, 0x02, 0x01, 0x02,
+    0x19, 0x02, 0x0A, 0x00, 0x37, 0x03, 0x00, 0x00, 0x25, 0x05,
+    0x01, 0x00, 0x34, 0x04, 0x00, 0x05, 0x41, 0x02, 0x03, 0x04,
+    0x1A, 0x02, 0x07, 0x00, 0x05, 0x05, 0x05, 0x01, 0x17, 0x03,
+    0x04, 0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF,
+    0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x24, 0x03,
+    0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xD7, 0xCD, 0x02, 0x98,
+    0x00, 0x00, 0x09, 0x02, 0x02, 0x02, 0x00, 0x13, 0xCE, 0x07,
+    0x65, 0x78, 0x74, 0x72, 0x65, 0x6D, 0x65, 0xDA, 0x12, 0x28,
+    0x02, 0x00, 0x00, 0x37, 0x03, 0x01, 0x00, 0x17, 0x04, 0x03,
+    0x00, 0x25, 0x03, 0x00, 0x00, 0x39, 0x05, 0x01, 0x00, 0x17,
+    0x06, 0x05, 0x00, 0x41, 0x05, 0x03, 0x06, 0x1A, 0x05, 0x0B,
+    0x00, 0x34, 0x07, 0x01, 0x03, 0x17, 0x08, 0x07, 0x00, 0x2C,
+    0x08, 0x04, 0x00, 0x2F, 0x07, 0x00, 0x00, 0x1A, 0x07, 0x03,
+    0x00, 0x17, 0x04, 0x08, 0x00, 0x18, 0x01, 0x00, 0x00, 0x25,
+    0x07, 0x01, 0x00, 0x06, 0x03, 0x03, 0x07, 0x18, 0xF5, 0xFF,
+    0xFF, 0x03, 0x04, 0x00, 0x00, 0x1C, 0x01, 0xFA, 0x08, 0x02,
+    0x02, 0x0A, 0x04, 0x07, 0x02, 0x00, 0x02, 0x00, 0x22, 0x01,
+    0x00, 0x07, 0x01, 0x00, 0x24, 0x01, 0x00, 0x23, 0x03, 0x00,
+    0x19, 0x01, 0x0B, 0x03, 0x28, 0x01, 0x00, 0x00, 0x26, 0x02,
+    0x00, 0x00, 0x2C, 0x02, 0x00, 0x00, 0x26, 0x02, 0x01, 0x00,
+    0x30, 0x02, 0x00, 0x00, 0x07, 0x01, 0x94, 0x09, 0x02, 0x04,
+    0x04, 0x16, 0xDA, 0x05, 0xCE, 0x3B, 0x28, 0x6D, 0x69, 0x6E,
+    0x20, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6E, 0x75, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x20,
+    0x6D, 0x69, 0x6E, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x2E, 0xCF, 0x07, 0x64, 0x65, 0x66,
+    0x61, 0x75, 0x6C, 0x74, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03,
+    0x00, 0xDA, 0x12, 0x80, 0x86, 0x01, 0xDA, 0x03, 0xD7, 0xCD,
+    0x02, 0x98, 0x00, 0x00, 0x06, 0x02, 0x02, 0x02, 0x03, 0x0D,
+    0xCE, 0x07, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0xDA,
+    0x12, 0xCF, 0x01, 0x3D, 0xDA, 0x58, 0xDA, 0x56, 0x28, 0x02,
+    0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x22, 0x05, 0x00, 0x00,
+    0x2D, 0x04, 0x05, 0x00, 0x3F, 0x03, 0x00, 0x00, 0x26, 0x05,
+    0x01, 0x00, 0x2D, 0x05, 0x03, 0x01, 0x2B, 0x00, 0x00, 0x00,
+    0x3F, 0x04, 0x00, 0x00, 0x26, 0x05, 0x02, 0x00, 0x2D, 0x05,
+    0x00, 0x04, 0x3F, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+    0x07, 0x01, 0x8C, 0x02, 0x02, 0x0C, 0x08, 0x04, 0xDA, 0x24,
+    0xCB, 0xDA, 0x05, 0xCE, 0x72, 0x28, 0x64, 0x65, 0x66, 0x61,
+    0x75, 0x6C, 0x74, 0x20, 0x73, 0x79, 0x6D, 0x20, 0x76, 0x61,
+    0x6C, 0x29, 0x0A, 0x0A, 0x44, 0x65, 0x66, 0x69, 0x6E, 0x65,
+    0x20, 0x61, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x61, 0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
+    0x61, 0x6C, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E,
+    0x74, 0x2E, 0x20, 0x20, 0x45, 0x78, 0x70, 0x61, 0x6E, 0x64,
+    0x73, 0x20, 0x74, 0x6F, 0x20, 0x28, 0x64, 0x65, 0x66, 0x20,
+    0x73, 0x79, 0x6D, 0x20, 0x28, 0x69, 0x66, 0x20, 0x28, 0x3D,
+    0x20, 0x6E, 0x69, 0x6C, 0x20, 0x73, 0x79, 0x6D, 0x29, 0x20,
+    0x76, 0x61, 0x6C, 0x20, 0x73, 0x79, 0x6D, 0x29, 0x29, 0xCF,
+    0x02, 0x2F, 0x3D, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00,
+    0xDA, 0x12, 0x80, 0x83, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02,
+    0x98, 0x00, 0x00, 0x06, 0x02, 0x02, 0x02, 0x02, 0x08, 0xCE,
+    0x02, 0x2F, 0x3D, 0xDA, 0x12, 0xD7, 0xCD, 0x00, 0x09, 0x00,
+    0x0C, 0x06, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
+    0x13, 0xCE, 0x01, 0x2F, 0x39, 0x01, 0x00, 0x00, 0x20, 0x02,
+    0x01, 0x00, 0x1A, 0x02, 0x03, 0x00, 0x25, 0x03, 0x01, 0x00,
+    0x03, 0x03, 0x00, 0x00, 0x20, 0x02, 0x01, 0x01, 0x1A, 0x02,
+    0x05, 0x00, 0x25, 0x03, 0x01, 0x00, 0x37, 0x04, 0x00, 0x00,
+    0x0B, 0x03, 0x03, 0x04, 0x03, 0x03, 0x00, 0x00, 0x37, 0x03,
+    0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x34, 0x04, 0x00, 0x05,
+    0x0B, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x01, 0x1F, 0x02,
+    0x05, 0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00,
+    0xDA, 0x22, 0x28, 0x02, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00,
+    0x2D, 0x04, 0x00, 0x01, 0x3F, 0x03, 0x00, 0x00, 0x26, 0x05,
+    0x01, 0x00, 0x2D, 0x05, 0x00, 0x03, 0x3F, 0x04, 0x00, 0x00,
+    0x03, 0x04, 0x00, 0x00, 0x07, 0x01, 0x86, 0x02, 0x02, 0x07,
+    0x00, 0x68, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x28, 0x28,
+    0x2F, 0x3D, 0x20, 0x78, 0x20, 0x6E, 0x29, 0x0A, 0x0A, 0x53,
+    0x68, 0x6F, 0x72, 0x74, 0x68, 0x61, 0x6E, 0x64, 0x20, 0x66,
+    0x6F, 0x72, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x78, 0x20,
+    0x28, 0x2F, 0x20, 0x78, 0x20, 0x6E, 0x29, 0x29, 0x2E, 0xD0,
+    0x07, 0x73, 0x79, 0x73, 0x70, 0x61, 0x74, 0x68, 0xCE, 0x14,
+    0x2F, 0x75, 0x73, 0x72, 0x2F, 0x6C, 0x6F, 0x63, 0x61, 0x6C,
+    0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+    0xCF, 0x04, 0x6E, 0x6F, 0x74, 0x3D, 0xD3, 0x02, 0xDA, 0x03,
+    0xD7, 0xCD, 0x00, 0x09, 0x00, 0x19, 0x06, 0x00, 0x00, 0xCD,
+    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 0xCE, 0x04, 0x6E, 0x6F,
+    0x74, 0x3D, 0x39, 0x01, 0x00, 0x00, 0x1E, 0x02, 0x01, 0x02,
+    0x19, 0x02, 0x0A, 0x00, 0x37, 0x03, 0x00, 0x00, 0x25, 0x05,
+    0x01, 0x00, 0x34, 0x04, 0x00, 0x05, 0x1F, 0x02, 0x03, 0x04,
+    0x1A, 0x02, 0x07, 0x00, 0x05, 0x05, 0x05, 0x01, 0x17, 0x03,
+    0x04, 0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF,
+    0x24, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x23, 0x03,
+    0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x05, 0xCE, 0x4C,
+    0x28, 0x6E, 0x6F, 0x74, 0x3D, 0x20, 0x26, 0x20, 0x78, 0x73,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20,
+    0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6E,
+    0x79, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69,
+    0x6E, 0x20, 0x78, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E,
+    0x6F, 0x74, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x2C, 0x20,
+    0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20,
+    0x66, 0x61, 0x6C, 0x73, 0x65, 0x2E, 0xCF, 0x07, 0x62, 0x72,
+    0x73, 0x68, 0x69, 0x66, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD7,
+    0xCD, 0x00, 0x09, 0x00, 0x11, 0x06, 0x00, 0x00, 0xCD, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x00, 0x13, 0xCE, 0x07, 0x62, 0x72, 0x73,
+    0x68, 0x69, 0x66, 0x74, 0x39, 0x01, 0x00, 0x00, 0x20, 0x02,
+    0x01, 0x00, 0x1A, 0x02, 0x03, 0x00, 0x25, 0x03, 0x01, 0x00,
+    0x03, 0x03, 0x00, 0x00, 0x20, 0x02, 0x01, 0x01, 0x1A, 0x02,
+    0x05, 0x00, 0x25, 0x03, 0x01, 0x00, 0x37, 0x04, 0x00, 0x00,
+    0x12, 0x03, 0x03, 0x04, 0x03, 0x03, 0x00, 0x00, 0x37, 0x03,
+    0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x34, 0x04, 0x00, 0x05,
+    0x12, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x01, 0x1F, 0x02,
+    0x05, 0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00,
+    0xDA, 0x05, 0xCE, 0x80, 0x92, 0x28, 0x62, 0x72, 0x73, 0x68,
+    0x69, 0x66, 0x74, 0x20, 0x78, 0x20, 0x26, 0x20, 0x73, 0x68,
+    0x69, 0x66, 0x74, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x20,
+    0x62, 0x69, 0x74, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x65,
+    0x64, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x62, 0x79,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x6D, 0x20, 0x6F,
+    0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x68, 0x69, 0x66,
+    0x74, 0x73, 0x2E, 0x20, 0x78, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x65, 0x61, 0x63, 0x68, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x68, 0x69, 0x66,
+    0x74, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20,
+    0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72,
+    0x2E, 0xCF, 0x09, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x73, 0x65,
+    0x65, 0x6B, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x66, 0x69,
+    0x6C, 0x65, 0x2F, 0x73, 0x65, 0x65, 0x6B, 0xDA, 0x05, 0xCE,
+    0x81, 0xC0, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x73, 0x65,
+    0x65, 0x6B, 0x20, 0x66, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20,
+    0x77, 0x68, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6E, 0x29, 0x0A,
+    0x0A, 0x4A, 0x75, 0x6D, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x61,
+    0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+    0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69,
+    0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65,
+    0x2E, 0x20, 0x27, 0x77, 0x68, 0x65, 0x6E, 0x63, 0x65, 0x27,
+    0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x6F,
+    0x6E, 0x65, 0x20, 0x6F, 0x66, 0x0A, 0x0A, 0x09, 0x3A, 0x63,
+    0x75, 0x72, 0x20, 0x2D, 0x20, 0x6A, 0x75, 0x6D, 0x70, 0x20,
+    0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x74,
+    0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72,
+    0x65, 0x6E, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6C,
+    0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x09, 0x3A,
+    0x73, 0x65, 0x74, 0x20, 0x2D, 0x20, 0x6A, 0x75, 0x6D, 0x70,
+    0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x65, 0x67,
+    0x69, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x0A, 0x09,
+    0x3A, 0x65, 0x6E, 0x64, 0x20, 0x2D, 0x20, 0x6A, 0x75, 0x6D,
+    0x70, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65,
+    0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E,
+    0x64, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x6C, 0x65, 0x0A, 0x0A, 0x42, 0x79, 0x20, 0x64, 0x65,
+    0x66, 0x61, 0x75, 0x6C, 0x74, 0x2C, 0x20, 0x27, 0x77, 0x68,
+    0x65, 0x6E, 0x63, 0x65, 0x27, 0x20, 0x69, 0x73, 0x20, 0x3A,
+    0x63, 0x75, 0x72, 0x2E, 0x20, 0x4F, 0x70, 0x74, 0x69, 0x6F,
+    0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x61, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x20, 0x6E, 0x20, 0x6D, 0x61, 0x79, 0x20,
+    0x62, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20,
+    0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+    0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x6E, 0x75, 0x6D,
+    0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x65, 0x65, 0x6B,
+    0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x2E, 0x20, 0x6E, 0x20, 0x6D, 0x61, 0x79, 0x20,
+    0x62, 0x65, 0x20, 0x61, 0x20, 0x72, 0x65, 0x61, 0x6C, 0x20,
+    0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x74, 0x6F, 0x20,
+    0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x6C, 0x61, 0x72,
+    0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x6F,
+    0x66, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x34, 0x47, 0x42, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x2E,
+    0xCF, 0x04, 0x64, 0x65, 0x66, 0x6E, 0xD3, 0x04, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x0A, 0x01, 0xDA, 0x03, 0xD7,
+    0xCD, 0x02, 0xBB, 0x00, 0x00, 0x17, 0x01, 0x01, 0xCD, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x0D, 0x38, 0x01, 0xCE, 0x04, 0x64, 0x65,
+    0x66, 0x6E, 0xDA, 0x12, 0xDA, 0x80, 0xF8, 0xCE, 0x01, 0x28,
+    0xD8, 0x06, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0xDA, 0x80,
+    0xFD, 0xDA, 0x80, 0xFA, 0xCE, 0x02, 0x25, 0x70, 0xD8, 0x0D,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x66, 0x6F, 0x72,
+    0x6D, 0x61, 0x74, 0xCE, 0x03, 0x29, 0x0A, 0x0A, 0xD8, 0x06,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0xDA, 0x81, 0x1B, 0xDA,
+    0x80, 0xA1, 0xDA, 0x80, 0x87, 0xDA, 0x56, 0x28, 0x02, 0x00,
+    0x00, 0x39, 0x03, 0x01, 0x00, 0x17, 0x04, 0x03, 0x00, 0x3A,
+    0x05, 0x00, 0x00, 0x17, 0x06, 0x05, 0x00, 0x26, 0x07, 0x00,
+    0x00, 0x2A, 0x08, 0x00, 0x00, 0x17, 0x09, 0x08, 0x00, 0x25,
+    0x0A, 0x00, 0x00, 0x2B, 0x0A, 0x00, 0x00, 0x2F, 0x0A, 0x09,
+    0x00, 0x17, 0x0B, 0x0A, 0x00, 0x34, 0x0C, 0x01, 0x0B, 0x17,
+    0x0D, 0x0C, 0x00, 0x25, 0x0E, 0x00, 0x00, 0x39, 0x0F, 0x0D,
+    0x00, 0x17, 0x10, 0x0F, 0x00, 0x26, 0x11, 0x01, 0x00, 0x2C,
+    0x11, 0x00, 0x00, 0x26, 0x12, 0x02, 0x00, 0x2F, 0x11, 0x12,
+    0x00, 0x17, 0x12, 0x11, 0x00, 0x41, 0x13, 0x0E, 0x10, 0x1A,
+    0x13, 0x0D, 0x00, 0x26, 0x14, 0x03, 0x00, 0x2C, 0x12, 0x14,
+    0x00, 0x26, 0x15, 0x04, 0x00, 0x2F, 0x14, 0x15, 0x00, 0x34,
+    0x14, 0x0D, 0x0E, 0x26, 0x15, 0x05, 0x00, 0x2D, 0x12, 0x15,
+    0x14, 0x26, 0x16, 0x06, 0x00, 0x2F, 0x15, 0x16, 0x00, 0x25,
+    0x14, 0x01, 0x00, 0x06, 0x0E, 0x0E, 0x14, 0x18, 0xF3, 0xFF,
+    0xFF, 0x26, 0x13, 0x07, 0x00, 0x2D, 0x12, 0x13, 0x07, 0x26,
+    0x14, 0x08, 0x00, 0x2F, 0x13, 0x14, 0x00, 0x2C, 0x06, 0x13,
+    0x00, 0x26, 0x15, 0x09, 0x00, 0x2F, 0x14, 0x15, 0x00, 0x2C,
+    0x01, 0x0B, 0x00, 0x26, 0x15, 0x0A, 0x00, 0x2F, 0x13, 0x15,
+    0x00, 0x26, 0x16, 0x0B, 0x00, 0x2C, 0x16, 0x00, 0x00, 0x2E,
+    0x13, 0x00, 0x00, 0x3F, 0x15, 0x00, 0x00, 0x26, 0x16, 0x0C,
+    0x00, 0x2C, 0x16, 0x00, 0x00, 0x2E, 0x06, 0x00, 0x00, 0x2B,
+    0x15, 0x00, 0x00, 0x3F, 0x13, 0x00, 0x00, 0x03, 0x13, 0x00,
+    0x00, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x09, 0x01, 0x01, 0x01,
+    0x04, 0x1D, 0x01, 0xCE, 0x05, 0x72, 0x65, 0x63, 0x75, 0x72,
+    0xDA, 0x12, 0xDA, 0x15, 0xDA, 0x50, 0xDA, 0x16, 0xDA, 0x81,
+    0x1B, 0x28, 0x01, 0x00, 0x00, 0x27, 0x03, 0x00, 0x01, 0x34,
+    0x02, 0x03, 0x00, 0x17, 0x03, 0x02, 0x00, 0x2B, 0x03, 0x00,
+    0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x02, 0x04, 0x00, 0x17,
+    0x04, 0x02, 0x00, 0x26, 0x06, 0x01, 0x00, 0x1F, 0x05, 0x04,
+    0x06, 0x1A, 0x05, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x26,
+    0x07, 0x02, 0x00, 0x1F, 0x06, 0x04, 0x07, 0x1A, 0x06, 0x03,
+    0x00, 0x29, 0x03, 0x00, 0x07, 0x18, 0x05, 0x00, 0x00, 0x27,
+    0x07, 0x00, 0x06, 0x2C, 0x07, 0x03, 0x00, 0x26, 0x08, 0x03,
+    0x00, 0x2F, 0x07, 0x08, 0x00, 0x27, 0x07, 0x00, 0x04, 0x41,
+    0x06, 0x00, 0x07, 0x1A, 0x06, 0x05, 0x00, 0x25, 0x08, 0x01,
+    0x00, 0x06, 0x07, 0x00, 0x08, 0x2B, 0x07, 0x00, 0x00, 0x30,
+    0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x30,
+    0x01, 0x22, 0x0E, 0x03, 0x02, 0x04, 0x03, 0x02, 0x0E, 0x01,
+    0x00, 0x0D, 0x02, 0x02, 0x08, 0x02, 0x00, 0x07, 0x02, 0x06,
+    0x10, 0x01, 0x00, 0x07, 0x01, 0x02, 0x04, 0x01, 0x01, 0x03,
+    0x04, 0x04, 0x04, 0x02, 0x02, 0x04, 0x01, 0x00, 0x07, 0x02,
+    0x00, 0x2A, 0x02, 0x00, 0x0D, 0x01, 0x00, 0x1B, 0x51, 0x01,
+    0x18, 0x06, 0x01, 0x02, 0x16, 0x01, 0x00, 0x11, 0x02, 0x02,
+    0x00, 0x01, 0x02, 0x00, 0x01, 0x04, 0x04, 0x01, 0x01, 0x03,
+    0x03, 0x16, 0x16, 0x01, 0x00, 0x15, 0x01, 0x02, 0x14, 0x01,
+    0x00, 0x13, 0x01, 0x04, 0x00, 0x01, 0x02, 0x18, 0x01, 0x00,
+    0x17, 0x04, 0x02, 0x12, 0x01, 0x00, 0x11, 0x01, 0x02, 0x0E,
+    0x01, 0x00, 0x0D, 0x04, 0x02, 0x04, 0x01, 0x02, 0x30, 0x04,
+    0x00, 0x2F, 0x02, 0x02, 0x16, 0x01, 0x05, 0x19, 0x04, 0x08,
+    0x2C, 0x03, 0x00, 0x2B, 0x03, 0x04, 0x46, 0x0A, 0x00, 0x45,
+    0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x55, 0x28, 0x64, 0x65,
+    0x66, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x26, 0x20,
+    0x6D, 0x6F, 0x72, 0x65, 0x29, 0x0A, 0x0A, 0x44, 0x65, 0x66,
+    0x69, 0x6E, 0x65, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x45, 0x71, 0x75, 0x69,
+    0x76, 0x61, 0x6C, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20,
+    0x28, 0x64, 0x65, 0x66, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20,
+    0x28, 0x66, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x5B,
+    0x61, 0x72, 0x67, 0x73, 0x5D, 0x20, 0x2E, 0x2E, 0x2E, 0x29,
+    0x29, 0x2E, 0xCF, 0x0E, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x2F, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x0E, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x2F, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0xDA, 0x05,
+    0xCE, 0x4B, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F,
+    0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x73, 0x74,
+    0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65,
+    0x64, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20,
+    0x6F, 0x66, 0x20, 0x73, 0x74, 0x72, 0x2E, 0xCF, 0x06, 0x75,
+    0x70, 0x64, 0x61, 0x74, 0x65, 0xD3, 0x03, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x84, 0x28, 0x01, 0xDA, 0x03, 0xD7,
+    0xCD, 0x02, 0x99, 0x00, 0x00, 0x09, 0x03, 0x03, 0xCD, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x00, 0x09, 0xCE, 0x06, 0x75, 0x70, 0x64,
+    0x61, 0x74, 0x65, 0xDA, 0x12, 0x28, 0x04, 0x00, 0x00, 0x35,
+    0x05, 0x00, 0x01, 0x17, 0x06, 0x05, 0x00, 0x2B, 0x06, 0x00,
+    0x00, 0x2E, 0x03, 0x00, 0x00, 0x2F, 0x07, 0x02, 0x00, 0x17,
+    0x08, 0x00, 0x00, 0x36, 0x08, 0x01, 0x07, 0x03, 0x08, 0x00,
+    0x00, 0x10, 0x01, 0xD0, 0x10, 0x02, 0x01, 0x0A, 0x16, 0x01,
+    0x00, 0x11, 0x03, 0x02, 0x18, 0x03, 0x00, 0x17, 0xDA, 0x05,
+    0xCE, 0x80, 0xC8, 0x28, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65,
+    0x20, 0x64, 0x73, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x66, 0x75,
+    0x6E, 0x63, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29,
+    0x0A, 0x0A, 0x41, 0x63, 0x63, 0x65, 0x70, 0x74, 0x73, 0x20,
+    0x61, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x61, 0x72, 0x67, 0x75,
+    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70,
+    0x61, 0x73, 0x73, 0x65, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20,
+    0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x65, 0x64,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x74, 0x6F, 0x20,
+    0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x2E, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79,
+    0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+    0x2D, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x65,
+    0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x27, 0x73, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x70, 0x64, 0x61,
+    0x74, 0x65, 0x64, 0x20, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
+    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20,
+    0x64, 0x73, 0x2E, 0xCF, 0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+    0x65, 0x78, 0x70, 0x6D, 0x31, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x65, 0x78, 0x70, 0x6D,
+    0x31, 0xDA, 0x05, 0xCE, 0x34, 0x28, 0x6D, 0x61, 0x74, 0x68,
+    0x2F, 0x65, 0x78, 0x70, 0x6D, 0x31, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x65,
+    0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6F,
+    0x77, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x20, 0x6D,
+    0x69, 0x6E, 0x75, 0x73, 0x20, 0x31, 0x2E, 0xCF, 0x12, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x61, 0x73, 0x63, 0x69,
+    0x69, 0x2D, 0x75, 0x70, 0x70, 0x65, 0x72, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x12, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F,
+    0x61, 0x73, 0x63, 0x69, 0x69, 0x2D, 0x75, 0x70, 0x70, 0x65,
+    0x72, 0xDA, 0x05, 0xCE, 0x80, 0xBE, 0x28, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x2F, 0x61, 0x73, 0x63, 0x69, 0x69, 0x2D,
+    0x75, 0x70, 0x70, 0x65, 0x72, 0x20, 0x73, 0x74, 0x72, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x61,
+    0x6C, 0x6C, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x61,
+    0x72, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65,
+    0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x75, 0x70, 0x70, 0x65, 0x72, 0x63, 0x61, 0x73, 0x65,
+    0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x73, 0x65, 0x6C, 0x76,
+    0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x41, 0x53, 0x43, 0x49,
+    0x49, 0x2E, 0x20, 0x44, 0x6F, 0x65, 0x73, 0x20, 0x6F, 0x6E,
+    0x6C, 0x79, 0x20, 0x61, 0x20, 0x76, 0x65, 0x72, 0x79, 0x20,
+    0x73, 0x69, 0x6D, 0x70, 0x6C, 0x65, 0x20, 0x63, 0x61, 0x73,
+    0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x2C, 0x20, 0x6D,
+    0x65, 0x61, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x6E, 0x6F, 0x20,
+    0x75, 0x6E, 0x69, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x73, 0x75,
+    0x70, 0x70, 0x6F, 0x72, 0x74, 0x2E, 0xCF, 0x04, 0x65, 0x76,
+    0x61, 0x6C, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x87, 0x00, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x98,
+    0x00, 0x00, 0x07, 0x01, 0x01, 0x01, 0x07, 0x17, 0xCE, 0x04,
+    0x65, 0x76, 0x61, 0x6C, 0xDA, 0x12, 0xD8, 0x0D, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x2F, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+    0x74, 0xDA, 0x80, 0xDA, 0xDA, 0x81, 0x73, 0xDA, 0x62, 0xDA,
+    0x15, 0xD0, 0x08, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0xD0, 0x05, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x01,
+    0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03, 0x00,
+    0x2B, 0x02, 0x00, 0x00, 0x26, 0x04, 0x01, 0x00, 0x2F, 0x03,
+    0x04, 0x00, 0x26, 0x02, 0x02, 0x00, 0x2D, 0x00, 0x03, 0x02,
+    0x26, 0x04, 0x03, 0x00, 0x2F, 0x02, 0x04, 0x00, 0x17, 0x03,
+    0x02, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x05, 0x04, 0x00,
+    0x2F, 0x04, 0x05, 0x00, 0x26, 0x06, 0x05, 0x00, 0x1F, 0x05,
+    0x04, 0x06, 0x1A, 0x05, 0x02, 0x00, 0x30, 0x03, 0x00, 0x00,
+    0x26, 0x04, 0x06, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2F, 0x04,
+    0x03, 0x00, 0x01, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x22, 0x01, 0x80, 0x1C, 0x02, 0x02, 0x08, 0x4E, 0x03, 0x00,
+    0x1B, 0x04, 0x00, 0x1B, 0x01, 0x00, 0x11, 0x03, 0x02, 0x0E,
+    0x02, 0x00, 0x05, 0x01, 0x00, 0x07, 0x01, 0x02, 0x04, 0x03,
+    0x02, 0x0E, 0x02, 0x00, 0x0D, 0xDA, 0x05, 0xCE, 0x7B, 0x28,
+    0x65, 0x76, 0x61, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x29,
+    0x0A, 0x0A, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65,
+    0x73, 0x20, 0x61, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69,
+    0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72,
+    0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F,
+    0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20, 0x49, 0x66, 0x20,
+    0x6D, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72,
+    0x6F, 0x6C, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E,
+    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x65,
+    0x65, 0x64, 0x65, 0x64, 0x2C, 0x20, 0x75, 0x73, 0x65, 0x20,
+    0x72, 0x75, 0x6E, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78,
+    0x74, 0x2E, 0xCF, 0x0F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F,
+    0x74, 0x6F, 0x2D, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x81, 0x18, 0xDA, 0x05, 0xCE, 0x80,
+    0x84, 0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x74, 0x6F,
+    0x2D, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x74, 0x61,
+    0x62, 0x29, 0x0A, 0x0A, 0x43, 0x6F, 0x6E, 0x76, 0x65, 0x72,
+    0x74, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+    0x74, 0x6F, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+    0x74, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64,
+    0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74, 0x61,
+    0x6B, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x63,
+    0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x74,
+    0x6F, 0x74, 0x79, 0x70, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x73, 0x2E, 0xCF, 0x0C, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x2F, 0x62, 0x79, 0x74, 0x65, 0x73, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x0C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F,
+    0x62, 0x79, 0x74, 0x65, 0x73, 0xDA, 0x05, 0xCE, 0x58, 0x28,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x62, 0x79, 0x74,
+    0x65, 0x73, 0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x69,
+    0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x73, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0xCF, 0x05, 0x6F,
+    0x73, 0x2F, 0x63, 0x64, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x05,
+    0x6F, 0x73, 0x2F, 0x63, 0x64, 0xDA, 0x05, 0xCE, 0x5A, 0x28,
+    0x6F, 0x73, 0x2F, 0x63, 0x64, 0x20, 0x70, 0x61, 0x74, 0x68,
+    0x29, 0x0A, 0x0A, 0x43, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20,
+    0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x64, 0x69,
+    0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x74, 0x6F,
+    0x20, 0x70, 0x61, 0x74, 0x68, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20,
+    0x6F, 0x6E, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73,
+    0x2C, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x6F, 0x6E,
+    0x20, 0x66, 0x61, 0x69, 0x6C, 0x75, 0x72, 0x65, 0x2E, 0xCF,
+    0x0C, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x72, 0x65, 0x6D,
+    0x6F, 0x76, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2F, 0x72, 0x65, 0x6D, 0x6F, 0x76,
+    0x65, 0xDA, 0x05, 0xCE, 0x80, 0xE3, 0x28, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2F, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x20,
+    0x61, 0x72, 0x72, 0x20, 0x61, 0x74, 0x20, 0x26, 0x6F, 0x70,
+    0x74, 0x20, 0x6E, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x6D, 0x6F,
+    0x76, 0x65, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x6E,
+    0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20,
+    0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x61,
+    0x74, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x61, 0x74,
+    0x20, 0x69, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+    0x61, 0x72, 0x72, 0x2E, 0x20, 0x61, 0x74, 0x20, 0x63, 0x61,
+    0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61,
+    0x20, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x6E, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65,
+    0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x6E, 0x65, 0x67,
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x65,
+    0x67, 0x65, 0x72, 0x2E, 0x20, 0x42, 0x79, 0x20, 0x64, 0x65,
+    0x66, 0x61, 0x75, 0x6C, 0x74, 0x2C, 0x20, 0x6E, 0x20, 0x69,
+    0x73, 0x20, 0x31, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2E, 0xCF, 0x07, 0x72, 0x65, 0x76, 0x65, 0x72,
+    0x73, 0x65, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x83, 0xE9, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x98,
+    0x00, 0x00, 0x0C, 0x01, 0x01, 0x01, 0x02, 0x15, 0xCE, 0x07,
+    0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0xDA, 0x12, 0xDA,
+    0x81, 0x1A, 0xDA, 0x81, 0x1B, 0x28, 0x01, 0x00, 0x00, 0x39,
+    0x02, 0x00, 0x00, 0x17, 0x03, 0x02, 0x00, 0x25, 0x05, 0x01,
+    0x00, 0x07, 0x04, 0x03, 0x05, 0x17, 0x05, 0x04, 0x00, 0x2B,
+    0x03, 0x00, 0x00, 0x26, 0x07, 0x00, 0x00, 0x2F, 0x06, 0x07,
+    0x00, 0x17, 0x07, 0x06, 0x00, 0x25, 0x09, 0x00, 0x00, 0x44,
+    0x08, 0x05, 0x09, 0x1A, 0x08, 0x08, 0x00, 0x34, 0x09, 0x00,
+    0x05, 0x2C, 0x07, 0x09, 0x00, 0x26, 0x0B, 0x01, 0x00, 0x2F,
+    0x0A, 0x0B, 0x00, 0x25, 0x09, 0x01, 0x00, 0x07, 0x05, 0x05,
+    0x09, 0x18, 0xF7, 0xFF, 0xFF, 0x03, 0x07, 0x00, 0x00, 0x2B,
+    0x01, 0xD2, 0x0F, 0x02, 0x01, 0x06, 0x16, 0x01, 0x00, 0x11,
+    0x02, 0x02, 0x0E, 0x01, 0x00, 0x0D, 0x03, 0x02, 0x1C, 0x01,
+    0x00, 0x1B, 0x02, 0x02, 0x0E, 0x01, 0x00, 0x0D, 0x01, 0x02,
+    0x2E, 0x03, 0x00, 0x29, 0x02, 0x02, 0x00, 0x01, 0x03, 0x03,
+    0x01, 0x0B, 0x03, 0xDA, 0x05, 0xCE, 0x62, 0x28, 0x72, 0x65,
+    0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x74, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20,
+    0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2E, 0xCF, 0x11, 0x66, 0x69, 0x62,
+    0x65, 0x72, 0x2F, 0x73, 0x65, 0x74, 0x6D, 0x61, 0x78, 0x73,
+    0x74, 0x61, 0x63, 0x6B, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x11,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x73, 0x65, 0x74, 0x6D,
+    0x61, 0x78, 0x73, 0x74, 0x61, 0x63, 0x6B, 0xDA, 0x05, 0xCE,
+    0x80, 0x8E, 0x28, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x73,
+    0x65, 0x74, 0x6D, 0x61, 0x78, 0x73, 0x74, 0x61, 0x63, 0x6B,
+    0x20, 0x66, 0x69, 0x62, 0x20, 0x6D, 0x61, 0x78, 0x73, 0x74,
+    0x61, 0x63, 0x6B, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61, 0x78, 0x69, 0x6D,
+    0x75, 0x6D, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x73,
+    0x69, 0x7A, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x6A, 0x61, 0x6E,
+    0x65, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+    0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62, 0x65,
+    0x72, 0x2E, 0x20, 0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61,
+    0x75, 0x6C, 0x74, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D,
+    0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x73, 0x74, 0x61,
+    0x63, 0x6B, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x69, 0x73,
+    0x20, 0x75, 0x73, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x38,
+    0x31, 0x39, 0x32, 0x2E, 0xCF, 0x05, 0x74, 0x72, 0x75, 0x65,
+    0x3F, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x6B, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00,
+    0x04, 0x01, 0x01, 0x01, 0x00, 0x04, 0xCE, 0x05, 0x74, 0x72,
+    0x75, 0x65, 0x3F, 0xDA, 0x12, 0x28, 0x01, 0x00, 0x00, 0x23,
+    0x03, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x03, 0x03, 0x02, 0x00,
+    0x00, 0x07, 0x01, 0xD6, 0x01, 0x02, 0x03, 0x00, 0x4C, 0xDA,
+    0x05, 0xCE, 0x1E, 0x28, 0x74, 0x72, 0x75, 0x65, 0x3F, 0x20,
+    0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20,
+    0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72,
+    0x75, 0x65, 0x2E, 0xCF, 0x08, 0x64, 0x69, 0x73, 0x74, 0x69,
+    0x6E, 0x63, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x08, 0x64,
+    0x69, 0x73, 0x74, 0x69, 0x6E, 0x63, 0x74, 0xDA, 0x05, 0xCE,
+    0x41, 0x28, 0x64, 0x69, 0x73, 0x74, 0x69, 0x6E, 0x63, 0x74,
+    0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x64, 0x65, 0x64, 0x75, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74,
+    0x65, 0x64, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+    0x69, 0x6E, 0x20, 0x78, 0x73, 0x2E, 0xCF, 0x04, 0x2D, 0x3F,
+    0x3E, 0x3E, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x83, 0x6C, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0xB9,
+    0x00, 0x00, 0x06, 0x01, 0x01, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF,
+    0x01, 0x06, 0x01, 0xCE, 0x04, 0x2D, 0x3F, 0x3E, 0x3E, 0xDA,
+    0x12, 0xDA, 0x39, 0x28, 0x02, 0x00, 0x00, 0x2A, 0x03, 0x00,
+    0x00, 0x17, 0x04, 0x03, 0x00, 0x2D, 0x04, 0x00, 0x01, 0x26,
+    0x05, 0x00, 0x00, 0x30, 0x05, 0x00, 0x00, 0xCD, 0x02, 0x98,
+    0x00, 0x00, 0x0E, 0x02, 0x02, 0x02, 0x09, 0x33, 0xDA, 0x80,
+    0x9E, 0xDA, 0x12, 0xDA, 0x15, 0xDA, 0x50, 0xDA, 0x80, 0x9F,
+    0xDA, 0x57, 0xDA, 0x55, 0xDA, 0x80, 0xA0, 0xDA, 0x80, 0xA1,
+    0xDA, 0x58, 0xCF, 0x03, 0x6C, 0x65, 0x74, 0x28, 0x02, 0x00,
+    0x00, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x05, 0x00, 0x00, 0x2F,
+    0x04, 0x05, 0x00, 0x26, 0x06, 0x01, 0x00, 0x1F, 0x05, 0x06,
+    0x04, 0x1A, 0x05, 0x0C, 0x00, 0x25, 0x06, 0x00, 0x00, 0x34,
+    0x04, 0x01, 0x06, 0x25, 0x06, 0x01, 0x00, 0x2C, 0x01, 0x06,
+    0x00, 0x26, 0x07, 0x02, 0x00, 0x2F, 0x06, 0x07, 0x00, 0x2C,
+    0x04, 0x06, 0x00, 0x26, 0x08, 0x03, 0x00, 0x2F, 0x07, 0x08,
+    0x00, 0x17, 0x03, 0x07, 0x00, 0x18, 0x06, 0x00, 0x00, 0x3A,
+    0x04, 0x00, 0x00, 0x2C, 0x01, 0x04, 0x00, 0x26, 0x07, 0x03,
+    0x00, 0x2F, 0x06, 0x07, 0x00, 0x17, 0x03, 0x06, 0x00, 0x37,
+    0x04, 0x03, 0x00, 0x17, 0x05, 0x04, 0x00, 0x37, 0x04, 0x03,
+    0x01, 0x17, 0x06, 0x04, 0x00, 0x26, 0x07, 0x04, 0x00, 0x2F,
+    0x04, 0x07, 0x00, 0x17, 0x07, 0x04, 0x00, 0x2B, 0x05, 0x00,
+    0x00, 0x3A, 0x08, 0x00, 0x00, 0x2B, 0x07, 0x00, 0x00, 0x3A,
+    0x09, 0x00, 0x00, 0x2D, 0x08, 0x06, 0x09, 0x26, 0x0B, 0x05,
+    0x00, 0x2F, 0x0A, 0x0B, 0x00, 0x17, 0x08, 0x0A, 0x00, 0x2C,
+    0x07, 0x00, 0x00, 0x40, 0x09, 0x00, 0x00, 0x25, 0x0B, 0x00,
+    0x00, 0x2C, 0x08, 0x0B, 0x00, 0x26, 0x0C, 0x06, 0x00, 0x2F,
+    0x0B, 0x0C, 0x00, 0x26, 0x0D, 0x07, 0x00, 0x2D, 0x0D, 0x07,
+    0x0B, 0x3F, 0x0C, 0x00, 0x00, 0x26, 0x0D, 0x08, 0x00, 0x2D,
+    0x0D, 0x09, 0x0C, 0x3F, 0x0B, 0x00, 0x00, 0x03, 0x0B, 0x00,
+    0x00, 0x31, 0x01, 0xE6, 0x0D, 0x06, 0x03, 0x02, 0x36, 0x02,
+    0x00, 0x13, 0x01, 0x00, 0x07, 0x02, 0x02, 0x12, 0x04, 0x00,
+    0x12, 0x03, 0x00, 0x1F, 0x02, 0x01, 0x03, 0x04, 0x04, 0x04,
+    0x01, 0x03, 0x03, 0x04, 0x00, 0x15, 0x02, 0x06, 0x12, 0x01,
+    0x00, 0x11, 0x07, 0x02, 0x16, 0x01, 0x00, 0x15, 0x0D, 0x02,
+    0x00, 0x0A, 0x01, 0xD8, 0x0D, 0x02, 0x02, 0x0E, 0x04, 0x03,
+    0x0E, 0x00, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x81, 0x1D,
+    0x28, 0x2D, 0x3F, 0x3E, 0x3E, 0x20, 0x78, 0x20, 0x26, 0x20,
+    0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29, 0x0A, 0x0A, 0x54, 0x68,
+    0x72, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x61,
+    0x63, 0x72, 0x6F, 0x2E, 0x20, 0x49, 0x6E, 0x73, 0x65, 0x72,
+    0x74, 0x73, 0x20, 0x78, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D,
+    0x20, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73,
+    0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x6E, 0x73, 0x65,
+    0x72, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F,
+    0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x66, 0x69, 0x72,
+    0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69, 0x6E,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63,
+    0x6F, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x20,
+    0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D,
+    0x65, 0x20, 0x6D, 0x61, 0x6E, 0x6E, 0x65, 0x72, 0x2C, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x73, 0x6F, 0x20, 0x6F, 0x6E, 0x2E,
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x70, 0x69, 0x70, 0x65, 0x6C,
+    0x69, 0x6E, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x20,
+    0x20, 0x69, 0x66, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74,
+    0x65, 0x72, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E,
+    0x69, 0x6C, 0x2E, 0x20, 0x20, 0x55, 0x73, 0x65, 0x66, 0x75,
+    0x6C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x70, 0x72,
+    0x65, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x69, 0x70,
+    0x65, 0x6C, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20,
+    0x64, 0x61, 0x74, 0x61, 0x2E, 0xCF, 0x07, 0x62, 0x6C, 0x73,
+    0x68, 0x69, 0x66, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0x09, 0x00, 0x10, 0x06, 0x00, 0x00, 0xCD, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x00, 0x13, 0xCE, 0x07, 0x62, 0x6C, 0x73, 0x68,
+    0x69, 0x66, 0x74, 0x39, 0x01, 0x00, 0x00, 0x20, 0x02, 0x01,
+    0x00, 0x1A, 0x02, 0x03, 0x00, 0x25, 0x03, 0x01, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x20, 0x02, 0x01, 0x01, 0x1A, 0x02, 0x05,
+    0x00, 0x25, 0x03, 0x01, 0x00, 0x37, 0x04, 0x00, 0x00, 0x10,
+    0x03, 0x03, 0x04, 0x03, 0x03, 0x00, 0x00, 0x37, 0x03, 0x00,
+    0x00, 0x25, 0x05, 0x01, 0x00, 0x34, 0x04, 0x00, 0x05, 0x10,
+    0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x01, 0x1F, 0x02, 0x05,
+    0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xDA,
+    0x05, 0xCE, 0x80, 0x91, 0x28, 0x62, 0x6C, 0x73, 0x68, 0x69,
+    0x66, 0x74, 0x20, 0x78, 0x20, 0x26, 0x20, 0x73, 0x68, 0x69,
+    0x66, 0x74, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x20, 0x62,
+    0x69, 0x74, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x65, 0x64,
+    0x20, 0x6C, 0x65, 0x66, 0x74, 0x20, 0x62, 0x79, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20,
+    0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+    0x20, 0x69, 0x6E, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x73,
+    0x2E, 0x20, 0x78, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x61,
+    0x63, 0x68, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x20, 0x69, 0x6E, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20,
+    0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E,
+    0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2E, 0xCF,
+    0x0A, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x70, 0x6F, 0x70, 0x65,
+    0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x66, 0x69, 0x6C,
+    0x65, 0x2F, 0x70, 0x6F, 0x70, 0x65, 0x6E, 0xDA, 0x05, 0xCE,
+    0x81, 0x91, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x70, 0x6F,
+    0x70, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x26,
+    0x6F, 0x70, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x26,
+    0x6F, 0x70, 0x74, 0x20, 0x62, 0x75, 0x66, 0x73, 0x69, 0x7A,
+    0x29, 0x0A, 0x0A, 0x4F, 0x70, 0x65, 0x6E, 0x20, 0x61, 0x20,
+    0x66, 0x69, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x69, 0x73, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x65, 0x64, 0x20,
+    0x62, 0x79, 0x20, 0x61, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65,
+    0x73, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65,
+    0x20, 0x6F, 0x70, 0x65, 0x6E, 0x65, 0x64, 0x20, 0x69, 0x6E,
+    0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x3A, 0x72, 0x20, 0x28, 0x72, 0x65, 0x61, 0x64,
+    0x29, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x3A,
+    0x77, 0x20, 0x28, 0x77, 0x72, 0x69, 0x74, 0x65, 0x29, 0x20,
+    0x6D, 0x6F, 0x64, 0x65, 0x2E, 0x20, 0x49, 0x6E, 0x20, 0x3A,
+    0x72, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x2C, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x63,
+    0x65, 0x73, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65,
+    0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+    0x20, 0x49, 0x6E, 0x20, 0x3A, 0x77, 0x20, 0x6D, 0x6F, 0x64,
+    0x65, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x64,
+    0x69, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x63, 0x61,
+    0x6E, 0x20, 0x62, 0x65, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74,
+    0x65, 0x6E, 0x20, 0x74, 0x6F, 0x2E, 0x62, 0x75, 0x66, 0x73,
+    0x69, 0x7A, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x73, 0x69, 0x7A,
+    0x65, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73,
+    0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6F, 0x75, 0x74,
+    0x70, 0x75, 0x74, 0x20, 0x63, 0x61, 0x63, 0x68, 0x69, 0x6E,
+    0x67, 0x2E, 0x69, 0x66, 0x20, 0x62, 0x75, 0x66, 0x73, 0x69,
+    0x7A, 0x20, 0x69, 0x73, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C,
+    0x20, 0x74, 0x6F, 0x20, 0x7A, 0x65, 0x72, 0x6F, 0x2C, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x69, 0x6E, 0x67, 0x20,
+    0x69, 0x73, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65,
+    0x64, 0x2E, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x2E, 0xCF, 0x0E, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x72, 0x2F, 0x63, 0x6F, 0x6E, 0x73, 0x75, 0x6D, 0x65, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x0E, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x72, 0x2F, 0x63, 0x6F, 0x6E, 0x73, 0x75, 0x6D, 0x65, 0xDA,
+    0x05, 0xCE, 0x80, 0xD1, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x72, 0x2F, 0x63, 0x6F, 0x6E, 0x73, 0x75, 0x6D, 0x65, 0x20,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x73, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x29, 0x0A, 0x0A, 0x49, 0x6E, 0x70, 0x75,
+    0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x69, 0x6E,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x72, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x2E, 0x20,
+    0x57, 0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x74,
+    0x68, 0x72, 0x6F, 0x77, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+    0x73, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65,
+    0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x70, 0x61, 0x72, 0x73,
+    0x65, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E, 0x20, 0x53,
+    0x74, 0x61, 0x72, 0x74, 0x73, 0x20, 0x61, 0x74, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20,
+    0x62, 0x79, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F,
+    0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x72, 0x65,
+    0x61, 0x64, 0x2E, 0xCF, 0x05, 0x79, 0x69, 0x65, 0x6C, 0x64,
+    0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x08, 0x00, 0x04,
+    0x02, 0x01, 0x00, 0x01, 0x00, 0x02, 0xCE, 0x05, 0x79, 0x69,
+    0x65, 0x6C, 0x64, 0x32, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+    0x00, 0xDA, 0x05, 0xCE, 0x80, 0xE3, 0x28, 0x79, 0x69, 0x65,
+    0x6C, 0x64, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x78, 0x29,
+    0x0A, 0x0A, 0x59, 0x69, 0x65, 0x6C, 0x64, 0x20, 0x61, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x61,
+    0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20,
+    0x61, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x79, 0x69,
+    0x65, 0x6C, 0x64, 0x73, 0x2C, 0x20, 0x69, 0x74, 0x73, 0x20,
+    0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x69, 0x73, 0x20, 0x70, 0x61, 0x75, 0x73, 0x65, 0x64, 0x20,
+    0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x61, 0x6E, 0x6F, 0x74,
+    0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64,
+    0x20, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x73, 0x20, 0x69,
+    0x74, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62,
+    0x65, 0x72, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x68,
+    0x65, 0x6E, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x2C,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C,
+    0x61, 0x73, 0x74, 0x20, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x20,
+    0x63, 0x61, 0x6C, 0x6C, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x70, 0x61, 0x73, 0x73,
+    0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x73, 0x75,
+    0x6D, 0x65, 0x2E, 0xCF, 0x04, 0x70, 0x72, 0x69, 0x6E, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x04, 0x70, 0x72, 0x69, 0x6E, 0xDA,
+    0x05, 0xCE, 0x3E, 0x28, 0x70, 0x72, 0x69, 0x6E, 0x20, 0x26,
+    0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x53, 0x61, 0x6D, 0x65,
+    0x20, 0x61, 0x73, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x2C,
+    0x20, 0x62, 0x75, 0x74, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20,
+    0x6E, 0x6F, 0x74, 0x20, 0x61, 0x64, 0x64, 0x20, 0x74, 0x72,
+    0x61, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x6E, 0x65, 0x77,
+    0x6C, 0x69, 0x6E, 0x65, 0x2E, 0xCF, 0x0A, 0x6D, 0x61, 0x74,
+    0x68, 0x2F, 0x66, 0x6C, 0x6F, 0x6F, 0x72, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x66, 0x6C,
+    0x6F, 0x6F, 0x72, 0xDA, 0x05, 0xCE, 0x54, 0x28, 0x6D, 0x61,
+    0x74, 0x68, 0x2F, 0x66, 0x6C, 0x6F, 0x6F, 0x72, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65,
+    0x73, 0x74, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6E, 0x75, 0x6D,
+    0x62, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69,
+    0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x67, 0x72, 0x65, 0x61,
+    0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x78,
+    0x2E, 0xCF, 0x04, 0x63, 0x61, 0x73, 0x65, 0xD3, 0x04, 0xDA,
+    0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x80, 0xAE, 0x01, 0xDA,
+    0x03, 0xD7, 0xCD, 0x02, 0xBB, 0x00, 0x00, 0x0C, 0x01, 0x01,
+    0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x05, 0x1D, 0x01, 0xCE, 0x04,
+    0x63, 0x61, 0x73, 0x65, 0xDA, 0x12, 0xDA, 0x4C, 0xDA, 0x55,
+    0xDA, 0x56, 0xDA, 0x57, 0xDA, 0x59, 0x28, 0x02, 0x00, 0x00,
+    0x2B, 0x00, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x03,
+    0x04, 0x00, 0x17, 0x04, 0x03, 0x00, 0x1A, 0x04, 0x03, 0x00,
+    0x17, 0x05, 0x00, 0x00, 0x18, 0x04, 0x00, 0x00, 0x26, 0x07,
+    0x01, 0x00, 0x2F, 0x06, 0x07, 0x00, 0x17, 0x05, 0x06, 0x00,
+    0x17, 0x06, 0x05, 0x00, 0x2A, 0x07, 0x00, 0x00, 0x17, 0x08,
+    0x07, 0x00, 0x1A, 0x04, 0x04, 0x00, 0x25, 0x09, 0x00, 0x00,
+    0x2B, 0x09, 0x00, 0x00, 0x30, 0x08, 0x00, 0x00, 0x26, 0x09,
+    0x02, 0x00, 0x2D, 0x09, 0x06, 0x00, 0x26, 0x0A, 0x03, 0x00,
+    0x2F, 0x09, 0x0A, 0x00, 0x25, 0x0A, 0x00, 0x00, 0x2B, 0x0A,
+    0x00, 0x00, 0x2F, 0x0A, 0x08, 0x00, 0x26, 0x0B, 0x04, 0x00,
+    0x2D, 0x0B, 0x09, 0x0A, 0x26, 0x0B, 0x03, 0x00, 0x30, 0x0B,
+    0x00, 0x00, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x0A, 0x01, 0x01,
+    0x01, 0x03, 0x23, 0x01, 0xDA, 0x49, 0xDA, 0x12, 0xD7, 0xCD,
+    0x00, 0x09, 0x00, 0x18, 0x06, 0x00, 0x00, 0xCD, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x00, 0x10, 0xCE, 0x01, 0x3D, 0x39, 0x01, 0x00,
+    0x00, 0x1E, 0x02, 0x01, 0x02, 0x19, 0x02, 0x0A, 0x00, 0x37,
+    0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x34, 0x04, 0x00,
+    0x05, 0x1F, 0x02, 0x03, 0x04, 0x1A, 0x02, 0x07, 0x00, 0x05,
+    0x05, 0x05, 0x01, 0x17, 0x03, 0x04, 0x00, 0x1F, 0x02, 0x05,
+    0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x23, 0x03, 0x00, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00,
+    0x00, 0xDA, 0x57, 0xDA, 0x58, 0x28, 0x01, 0x00, 0x00, 0x27,
+    0x03, 0x00, 0x01, 0x39, 0x02, 0x03, 0x00, 0x07, 0x03, 0x02,
+    0x00, 0x17, 0x02, 0x03, 0x00, 0x25, 0x05, 0x00, 0x00, 0x1F,
+    0x04, 0x02, 0x05, 0x1A, 0x04, 0x02, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x25, 0x06, 0x01, 0x00, 0x1F, 0x05, 0x02, 0x06, 0x1A,
+    0x05, 0x04, 0x00, 0x27, 0x07, 0x00, 0x01, 0x34, 0x06, 0x07,
+    0x00, 0x03, 0x06, 0x00, 0x00, 0x27, 0x07, 0x00, 0x01, 0x34,
+    0x06, 0x07, 0x00, 0x26, 0x07, 0x00, 0x00, 0x27, 0x08, 0x00,
+    0x06, 0x2D, 0x07, 0x08, 0x06, 0x26, 0x08, 0x01, 0x00, 0x2F,
+    0x07, 0x08, 0x00, 0x25, 0x08, 0x01, 0x00, 0x06, 0x06, 0x00,
+    0x08, 0x27, 0x09, 0x00, 0x01, 0x34, 0x08, 0x09, 0x06, 0x25,
+    0x09, 0x02, 0x00, 0x06, 0x06, 0x00, 0x09, 0x2B, 0x06, 0x00,
+    0x00, 0x2F, 0x09, 0x01, 0x00, 0x26, 0x06, 0x02, 0x00, 0x2D,
+    0x06, 0x07, 0x08, 0x2B, 0x09, 0x00, 0x00, 0x26, 0x06, 0x01,
+    0x00, 0x30, 0x06, 0x00, 0x00, 0xBF, 0xFF, 0x31, 0x01, 0xEA,
+    0x02, 0x06, 0x02, 0x02, 0x24, 0x01, 0x00, 0x05, 0x01, 0x00,
+    0x19, 0x02, 0x02, 0x08, 0x02, 0x00, 0x07, 0x02, 0x02, 0x0C,
+    0x01, 0x00, 0x07, 0x03, 0x00, 0x24, 0x02, 0x02, 0x10, 0x05,
+    0x00, 0x19, 0x02, 0x02, 0x0C, 0x02, 0x00, 0x13, 0x02, 0x02,
+    0x0A, 0x02, 0x00, 0x09, 0x05, 0x03, 0x0D, 0x28, 0x01, 0xDC,
+    0x02, 0x02, 0x03, 0x0A, 0x16, 0x01, 0x00, 0x11, 0x03, 0x02,
+    0x12, 0x02, 0x00, 0x22, 0x01, 0x00, 0x21, 0x01, 0x00, 0x11,
+    0x02, 0x02, 0x00, 0x01, 0x0E, 0x00, 0x03, 0x02, 0x04, 0x04,
+    0x04, 0x0E, 0x03, 0x02, 0x00, 0x04, 0x03, 0x0D, 0xDA, 0x24,
+    0xCB, 0xDA, 0x05, 0xCE, 0x80, 0xBC, 0x28, 0x63, 0x61, 0x73,
+    0x65, 0x20, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68,
+    0x20, 0x26, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x29, 0x0A,
+    0x0A, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63,
+    0x68, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x20, 0x57,
+    0x68, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20,
+    0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x64,
+    0x64, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F,
+    0x66, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x73, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73,
+    0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64,
+    0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x65, 0x78, 0x70,
+    0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x20,
+    0x49, 0x66, 0x20, 0x6E, 0x6F, 0x20, 0x6D, 0x61, 0x74, 0x63,
+    0x68, 0x20, 0x69, 0x73, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64,
+    0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x6E, 0x69, 0x6C, 0x2E, 0xCF, 0x07, 0x6D, 0x61, 0x72, 0x73,
+    0x68, 0x61, 0x6C, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x07, 0x6D,
+    0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0xDA, 0x05, 0xCE, 0x81,
+    0x7A, 0x28, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x20,
+    0x78, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x72, 0x65, 0x76,
+    0x65, 0x72, 0x73, 0x65, 0x2D, 0x6C, 0x6F, 0x6F, 0x6B, 0x75,
+    0x70, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x29, 0x0A,
+    0x0A, 0x4D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x20, 0x61,
+    0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20,
+    0x54, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x20, 0x63, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C,
+    0x61, 0x74, 0x65, 0x72, 0x20, 0x62, 0x65, 0x20, 0x75, 0x6E,
+    0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x6C, 0x65, 0x64,
+    0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x6E, 0x73,
+    0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x69, 0x6E, 0x69, 0x74, 0x69, 0x61, 0x6C, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x2E, 0x20, 0x4F, 0x70, 0x74, 0x69, 0x6F,
+    0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x2C, 0x20, 0x6F, 0x6E, 0x65,
+    0x20, 0x63, 0x61, 0x6E, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20,
+    0x69, 0x6E, 0x20, 0x61, 0x20, 0x72, 0x65, 0x76, 0x65, 0x72,
+    0x73, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x6E,
+    0x6F, 0x74, 0x20, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C,
+    0x20, 0x61, 0x6C, 0x69, 0x61, 0x73, 0x65, 0x64, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64,
+    0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x6E, 0x20,
+    0x61, 0x20, 0x66, 0x6F, 0x72, 0x77, 0x61, 0x72, 0x64, 0x6C,
+    0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x75,
+    0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x63,
+    0x6F, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F,
+    0x72, 0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C, 0x20, 0x6A, 0x61,
+    0x6E, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x77, 0x68, 0x65, 0x6E, 0x20, 0x75, 0x6E, 0x6D, 0x61, 0x72,
+    0x73, 0x68, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x2E, 0xCF,
+    0x0A, 0x64, 0x72, 0x6F, 0x70, 0x2D, 0x75, 0x6E, 0x74, 0x69,
+    0x6C, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x83, 0x1F, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00,
+    0x00, 0x0E, 0x02, 0x02, 0x02, 0x05, 0x1A, 0xCE, 0x0A, 0x64,
+    0x72, 0x6F, 0x70, 0x2D, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0xDA,
+    0x12, 0xDA, 0x1A, 0xD8, 0x0C, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0xDA, 0x80, 0xA1,
+    0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x0B, 0x02, 0x02, 0x02,
+    0x00, 0x18, 0xCE, 0x0A, 0x66, 0x69, 0x6E, 0x64, 0x2D, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0xDA, 0x12, 0x28, 0x02, 0x00, 0x00,
+    0x39, 0x03, 0x01, 0x00, 0x17, 0x04, 0x03, 0x00, 0x25, 0x05,
+    0x00, 0x00, 0x23, 0x06, 0x00, 0x00, 0x41, 0x08, 0x05, 0x04,
+    0x1A, 0x08, 0x03, 0x00, 0x17, 0x07, 0x06, 0x00, 0x18, 0x02,
+    0x00, 0x00, 0x22, 0x07, 0x00, 0x00, 0x1A, 0x07, 0x0B, 0x00,
+    0x34, 0x08, 0x01, 0x05, 0x17, 0x09, 0x08, 0x00, 0x2B, 0x09,
+    0x00, 0x00, 0x2F, 0x08, 0x00, 0x00, 0x1A, 0x08, 0x03, 0x00,
+    0x24, 0x06, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0x25, 0x0A,
+    0x01, 0x00, 0x06, 0x05, 0x05, 0x0A, 0x18, 0xF1, 0xFF, 0xFF,
+    0x1A, 0x06, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x05,
+    0x00, 0x00, 0x34, 0x01, 0xD4, 0x0B, 0x02, 0x01, 0x06, 0x16,
+    0x01, 0x00, 0x11, 0x01, 0x02, 0x00, 0x01, 0x02, 0x00, 0x01,
+    0x02, 0x16, 0x04, 0x00, 0x07, 0x01, 0x00, 0x0D, 0x01, 0x02,
+    0x18, 0x01, 0x00, 0x13, 0x02, 0x02, 0x08, 0x01, 0x00, 0x07,
+    0x01, 0x00, 0x20, 0x01, 0x00, 0x1F, 0x02, 0x00, 0x44, 0x01,
+    0x03, 0x47, 0x03, 0x06, 0x00, 0xD7, 0xCD, 0x02, 0x98, 0x00,
+    0x00, 0x04, 0x01, 0x01, 0x01, 0x00, 0x04, 0xCE, 0x04, 0x6E,
+    0x69, 0x6C, 0x3F, 0xDA, 0x12, 0x28, 0x01, 0x00, 0x00, 0x22,
+    0x03, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x03, 0x03, 0x02, 0x00,
+    0x00, 0x07, 0x01, 0xDA, 0x01, 0x02, 0x03, 0x00, 0x48, 0x28,
+    0x02, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x04, 0x00,
+    0x00, 0x2F, 0x03, 0x04, 0x00, 0x17, 0x04, 0x03, 0x00, 0x1A,
+    0x04, 0x03, 0x00, 0x26, 0x05, 0x01, 0x00, 0x18, 0x02, 0x00,
+    0x00, 0x26, 0x05, 0x02, 0x00, 0x17, 0x06, 0x05, 0x00, 0x2C,
+    0x00, 0x01, 0x00, 0x26, 0x08, 0x03, 0x00, 0x2F, 0x07, 0x08,
+    0x00, 0x17, 0x08, 0x07, 0x00, 0x39, 0x09, 0x01, 0x00, 0x17,
+    0x0A, 0x09, 0x00, 0x2B, 0x08, 0x00, 0x00, 0x26, 0x0D, 0x04,
+    0x00, 0x2F, 0x0C, 0x0D, 0x00, 0x1A, 0x0C, 0x03, 0x00, 0x17,
+    0x0B, 0x0A, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x0B, 0x08,
+    0x00, 0x17, 0x0C, 0x0B, 0x00, 0x2C, 0x01, 0x0C, 0x00, 0x30,
+    0x06, 0x00, 0x00, 0x28, 0x01, 0xBE, 0x0C, 0x02, 0x03, 0x06,
+    0x1E, 0x01, 0x00, 0x19, 0x04, 0x02, 0x0E, 0x01, 0x00, 0x0D,
+    0x03, 0x02, 0x0E, 0x01, 0x00, 0x0D, 0x01, 0x02, 0x12, 0x01,
+    0x00, 0x11, 0x03, 0x02, 0x1E, 0x04, 0x00, 0x07, 0x01, 0x00,
+    0x15, 0x02, 0x02, 0x00, 0xDA, 0x05, 0xCE, 0x42, 0x28, 0x64,
+    0x72, 0x6F, 0x70, 0x2D, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20,
+    0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A,
+    0x0A, 0x53, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x73, 0x20, 0x28,
+    0x64, 0x72, 0x6F, 0x70, 0x2D, 0x77, 0x68, 0x69, 0x6C, 0x65,
+    0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x70, 0x72, 0x65, 0x64, 0x29, 0x20, 0x69,
+    0x6E, 0x64, 0x29, 0x2E, 0xCF, 0x0B, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x2F, 0x62, 0x6C, 0x69, 0x74, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x0B, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F,
+    0x62, 0x6C, 0x69, 0x74, 0xDA, 0x05, 0xCE, 0x81, 0x09, 0x28,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62, 0x6C, 0x69,
+    0x74, 0x20, 0x64, 0x65, 0x73, 0x74, 0x20, 0x73, 0x72, 0x63,
+    0x20, 0x26, 0x20, 0x6F, 0x70, 0x74, 0x20, 0x64, 0x65, 0x73,
+    0x74, 0x2D, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x73, 0x72,
+    0x63, 0x2D, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x73, 0x72,
+    0x63, 0x2D, 0x65, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x49, 0x6E,
+    0x73, 0x65, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+    0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x6F, 0x66,
+    0x20, 0x73, 0x72, 0x63, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20,
+    0x64, 0x65, 0x73, 0x74, 0x2E, 0x20, 0x43, 0x61, 0x6E, 0x20,
+    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79,
+    0x20, 0x74, 0x61, 0x6B, 0x65, 0x20, 0x69, 0x6E, 0x64, 0x69,
+    0x63, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69,
+    0x6E, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x77, 0x68,
+    0x69, 0x63, 0x68, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6F,
+    0x66, 0x20, 0x73, 0x72, 0x63, 0x20, 0x74, 0x6F, 0x20, 0x63,
+    0x6F, 0x70, 0x79, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x77,
+    0x68, 0x69, 0x63, 0x68, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20,
+    0x6F, 0x66, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E, 0x20, 0x49,
+    0x6E, 0x64, 0x69, 0x63, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6E,
+    0x20, 0x62, 0x65, 0x20, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69,
+    0x76, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x6E, 0x64, 0x65,
+    0x78, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x72,
+    0x63, 0x20, 0x6F, 0x72, 0x20, 0x64, 0x65, 0x73, 0x74, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x64,
+    0x65, 0x73, 0x74, 0x2E, 0xCF, 0x0A, 0x67, 0x63, 0x73, 0x65,
+    0x74, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x0A, 0x67, 0x63, 0x73, 0x65, 0x74, 0x6C, 0x69, 0x6D,
+    0x69, 0x74, 0xDA, 0x05, 0xCE, 0x81, 0x61, 0x28, 0x67, 0x63,
+    0x73, 0x65, 0x74, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x20, 0x62,
+    0x79, 0x74, 0x65, 0x73, 0x29, 0x0A, 0x0A, 0x4C, 0x69, 0x6D,
+    0x69, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61,
+    0x70, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x62, 0x6F, 0x75, 0x74,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E,
+    0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66,
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x2C, 0x20, 0x6F, 0x72,
+    0x20, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x20, 0x69, 0x66,
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x69, 0x73, 0x20,
+    0x6E, 0x69, 0x6C, 0x20, 0x6F, 0x72, 0x20, 0x30, 0x2E, 0x20,
+    0x54, 0x68, 0x65, 0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67,
+    0x65, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x6F,
+    0x72, 0x20, 0x72, 0x75, 0x6E, 0x73, 0x20, 0x6D, 0x6F, 0x72,
+    0x65, 0x20, 0x6F, 0x66, 0x74, 0x65, 0x6E, 0x20, 0x61, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x70, 0x20,
+    0x6E, 0x65, 0x61, 0x72, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6C, 0x69, 0x6D, 0x69, 0x74, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x61, 0x6E, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x77, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x67, 0x6F, 0x20, 0x6F,
+    0x76, 0x65, 0x72, 0x20, 0x69, 0x74, 0x20, 0x72, 0x61, 0x69,
+    0x73, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72,
+    0x6F, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61,
+    0x64, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61,
+    0x70, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x69, 0x73, 0x20,
+    0x65, 0x73, 0x74, 0x69, 0x6D, 0x61, 0x74, 0x65, 0x64, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C,
+    0x61, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x6C, 0x75, 0x73, 0x20,
+    0x77, 0x68, 0x61, 0x74, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62,
+    0x65, 0x65, 0x6E, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61,
+    0x74, 0x65, 0x64, 0x20, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x2E,
+    0xCF, 0x0C, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x73, 0x74,
+    0x61, 0x74, 0x75, 0x73, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x73, 0x74, 0x61, 0x74,
+    0x75, 0x73, 0xDA, 0x05, 0xCE, 0x81, 0x91, 0x28, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0x20, 0x66, 0x69, 0x62, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75,
+    0x73, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62,
+    0x65, 0x72, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x74,
+    0x61, 0x74, 0x75, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+    0x62, 0x65, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x3A,
+    0x0A, 0x0A, 0x09, 0x3A, 0x64, 0x65, 0x61, 0x64, 0x20, 0x2D,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+    0x20, 0x68, 0x61, 0x73, 0x20, 0x66, 0x69, 0x6E, 0x69, 0x73,
+    0x68, 0x65, 0x64, 0x0A, 0x09, 0x3A, 0x65, 0x72, 0x72, 0x6F,
+    0x72, 0x20, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x20, 0x68, 0x61, 0x73, 0x20, 0x65, 0x72,
+    0x72, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x6F, 0x75, 0x74, 0x0A,
+    0x09, 0x3A, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x2D, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20,
+    0x69, 0x73, 0x20, 0x73, 0x75, 0x73, 0x70, 0x65, 0x6E, 0x64,
+    0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x64, 0x65, 0x62, 0x75,
+    0x67, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x0A, 0x09, 0x3A, 0x70,
+    0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x2D, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x68,
+    0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x79, 0x69,
+    0x65, 0x6C, 0x64, 0x65, 0x64, 0x0A, 0x09, 0x3A, 0x75, 0x73,
+    0x65, 0x72, 0x28, 0x30, 0x2D, 0x39, 0x29, 0x20, 0x2D, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20,
+    0x69, 0x73, 0x20, 0x73, 0x75, 0x73, 0x70, 0x65, 0x6E, 0x64,
+    0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x75, 0x73,
+    0x65, 0x72, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x0A,
+    0x09, 0x3A, 0x61, 0x6C, 0x69, 0x76, 0x65, 0x20, 0x2D, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20,
+    0x69, 0x73, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74,
+    0x6C, 0x79, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F,
+    0x74, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D,
+    0x65, 0x64, 0x0A, 0x09, 0x3A, 0x6E, 0x65, 0x77, 0x20, 0x2D,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+    0x20, 0x68, 0x61, 0x73, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x20,
+    0x62, 0x65, 0x65, 0x6E, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74,
+    0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x6F, 0x74,
+    0x20, 0x79, 0x65, 0x74, 0x20, 0x72, 0x75, 0x6E, 0xCF, 0x09,
+    0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x74, 0x61, 0x6E, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+    0x61, 0x74, 0x61, 0x6E, 0xDA, 0x05, 0xCE, 0x2B, 0x28, 0x6D,
+    0x61, 0x74, 0x68, 0x2F, 0x61, 0x74, 0x61, 0x6E, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x63, 0x74, 0x61,
+    0x6E, 0x67, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x78,
+    0x2E, 0xCF, 0x05, 0x70, 0x72, 0x69, 0x6E, 0x66, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x05, 0x70, 0x72, 0x69, 0x6E, 0x66, 0xDA,
+    0x05, 0xCE, 0x3B, 0x28, 0x70, 0x72, 0x69, 0x6E, 0x66, 0x20,
+    0x66, 0x6D, 0x74, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A,
+    0x0A, 0x4C, 0x69, 0x6B, 0x65, 0x20, 0x70, 0x72, 0x69, 0x6E,
+    0x74, 0x66, 0x20, 0x62, 0x75, 0x74, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x6E, 0x6F, 0x20, 0x74, 0x72, 0x61, 0x69, 0x6C,
+    0x69, 0x6E, 0x67, 0x20, 0x6E, 0x65, 0x77, 0x6C, 0x69, 0x6E,
+    0x65, 0x2E, 0xCF, 0x06, 0x6D, 0x61, 0x63, 0x65, 0x78, 0x31,
+    0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x85,
+    0x76, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0xBA, 0x00, 0x00,
+    0x1C, 0x02, 0x01, 0x02, 0x12, 0x5B, 0x08, 0xCE, 0x06, 0x6D,
+    0x61, 0x63, 0x65, 0x78, 0x31, 0xDA, 0x12, 0xD7, 0xCD, 0x02,
+    0x98, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01, 0x02, 0x07, 0xCE,
+    0x07, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x3F, 0xDA, 0x12,
+    0xDA, 0x15, 0xDA, 0x17, 0x28, 0x01, 0x00, 0x00, 0x2B, 0x00,
+    0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03, 0x00,
+    0x26, 0x04, 0x01, 0x00, 0x1F, 0x03, 0x02, 0x04, 0x03, 0x03,
+    0x00, 0x00, 0x0A, 0x01, 0xAC, 0x01, 0x02, 0x03, 0x00, 0x5E,
+    0x03, 0x00, 0x05, 0xCF, 0x03, 0x76, 0x61, 0x72, 0xDA, 0x22,
+    0xCF, 0x05, 0x71, 0x75, 0x6F, 0x74, 0x65, 0xD7, 0xCD, 0x02,
+    0x98, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x00, 0x02, 0xCE,
+    0x08, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0xDA,
+    0x12, 0x28, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04,
+    0x02, 0xE6, 0x08, 0x02, 0xDA, 0x56, 0xDA, 0x58, 0xCF, 0x0A,
+    0x71, 0x75, 0x61, 0x73, 0x69, 0x71, 0x75, 0x6F, 0x74, 0x65,
+    0xDA, 0x59, 0xDA, 0x80, 0x87, 0xCF, 0x05, 0x77, 0x68, 0x69,
+    0x6C, 0x65, 0xDA, 0x15, 0xD5, 0x04, 0xDA, 0x4D, 0x01, 0xDA,
+    0x4E, 0x02, 0xDA, 0x4F, 0x03, 0xDA, 0x50, 0x00, 0xDA, 0x77,
+    0xD0, 0x08, 0x62, 0x72, 0x61, 0x63, 0x6B, 0x65, 0x74, 0x73,
+    0xD7, 0xCD, 0x02, 0x99, 0x00, 0x00, 0x18, 0x01, 0x01, 0xCD,
+    0x7F, 0xFF, 0xFF, 0xFF, 0x03, 0x80, 0x83, 0xCE, 0x03, 0x6D,
+    0x61, 0x70, 0xDA, 0x12, 0xCE, 0x26, 0x65, 0x78, 0x70, 0x65,
+    0x63, 0x74, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x6C, 0x65,
+    0x61, 0x73, 0x74, 0x20, 0x31, 0x20, 0x69, 0x6E, 0x64, 0x65,
+    0x78, 0x65, 0x64, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0xDA, 0x81, 0x1A, 0xD5, 0x04, 0x04,
+    0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x00, 0x28, 0x02, 0x00,
+    0x00, 0x39, 0x03, 0x01, 0x00, 0x17, 0x04, 0x03, 0x00, 0x25,
+    0x06, 0x00, 0x00, 0x1F, 0x05, 0x06, 0x04, 0x1A, 0x05, 0x04,
+    0x00, 0x26, 0x06, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x18,
+    0x01, 0x00, 0x00, 0x25, 0x06, 0x00, 0x00, 0x34, 0x05, 0x01,
+    0x06, 0x39, 0x06, 0x05, 0x00, 0x17, 0x05, 0x06, 0x00, 0x25,
+    0x07, 0x00, 0x00, 0x17, 0x08, 0x04, 0x00, 0x41, 0x09, 0x07,
+    0x08, 0x1A, 0x09, 0x0C, 0x00, 0x17, 0x0A, 0x07, 0x00, 0x34,
+    0x0B, 0x01, 0x0A, 0x39, 0x0C, 0x0B, 0x00, 0x17, 0x0B, 0x0C,
+    0x00, 0x41, 0x0C, 0x0B, 0x05, 0x1A, 0x0C, 0x03, 0x00, 0x17,
+    0x05, 0x0B, 0x00, 0x18, 0x01, 0x00, 0x00, 0x25, 0x0C, 0x01,
+    0x00, 0x06, 0x07, 0x07, 0x0C, 0x18, 0xF4, 0xFF, 0xFF, 0x37,
+    0x07, 0x01, 0x00, 0x17, 0x08, 0x07, 0x00, 0x37, 0x07, 0x01,
+    0x01, 0x17, 0x09, 0x07, 0x00, 0x37, 0x07, 0x01, 0x02, 0x17,
+    0x0A, 0x07, 0x00, 0x37, 0x07, 0x01, 0x03, 0x17, 0x0B, 0x07,
+    0x00, 0x2B, 0x05, 0x00, 0x00, 0x26, 0x0C, 0x01, 0x00, 0x2F,
+    0x07, 0x0C, 0x00, 0x17, 0x0C, 0x07, 0x00, 0x47, 0x04, 0x02,
+    0x00, 0x18, 0x1F, 0x00, 0x00, 0x18, 0x2B, 0x00, 0x00, 0x18,
+    0x38, 0x00, 0x00, 0x18, 0x46, 0x00, 0x00, 0x25, 0x0D, 0x00,
+    0x00, 0x17, 0x0E, 0x05, 0x00, 0x41, 0x0F, 0x0D, 0x0E, 0x1A,
+    0x0F, 0x17, 0x00, 0x17, 0x10, 0x0D, 0x00, 0x2B, 0x04, 0x00,
+    0x00, 0x26, 0x12, 0x01, 0x00, 0x2F, 0x11, 0x12, 0x00, 0x17,
+    0x12, 0x11, 0x00, 0x25, 0x11, 0x00, 0x00, 0x17, 0x13, 0x04,
+    0x00, 0x41, 0x14, 0x11, 0x13, 0x1A, 0x14, 0x08, 0x00, 0x17,
+    0x15, 0x11, 0x00, 0x34, 0x16, 0x01, 0x15, 0x34, 0x17, 0x16,
+    0x10, 0x36, 0x12, 0x15, 0x17, 0x25, 0x16, 0x01, 0x00, 0x06,
+    0x11, 0x11, 0x16, 0x18, 0xF8, 0xFF, 0xFF, 0x2E, 0x12, 0x00,
+    0x00, 0x2F, 0x11, 0x00, 0x00, 0x36, 0x0C, 0x10, 0x11, 0x25,
+    0x11, 0x01, 0x00, 0x06, 0x0D, 0x0D, 0x11, 0x18, 0xE9, 0xFF,
+    0xFF, 0x18, 0x3B, 0x00, 0x00, 0x25, 0x0D, 0x00, 0x00, 0x17,
+    0x0E, 0x05, 0x00, 0x41, 0x0F, 0x0D, 0x0E, 0x1A, 0x0F, 0x09,
+    0x00, 0x17, 0x10, 0x0D, 0x00, 0x34, 0x11, 0x08, 0x10, 0x2B,
+    0x11, 0x00, 0x00, 0x2F, 0x12, 0x00, 0x00, 0x36, 0x0C, 0x10,
+    0x12, 0x25, 0x11, 0x01, 0x00, 0x06, 0x0D, 0x0D, 0x11, 0x18,
+    0xF7, 0xFF, 0xFF, 0x18, 0x2E, 0x00, 0x00, 0x25, 0x0D, 0x00,
+    0x00, 0x17, 0x0E, 0x05, 0x00, 0x41, 0x0F, 0x0D, 0x0E, 0x1A,
+    0x0F, 0x0A, 0x00, 0x17, 0x10, 0x0D, 0x00, 0x34, 0x11, 0x08,
+    0x10, 0x34, 0x12, 0x09, 0x10, 0x2C, 0x11, 0x12, 0x00, 0x2F,
+    0x13, 0x00, 0x00, 0x36, 0x0C, 0x10, 0x13, 0x25, 0x11, 0x01,
+    0x00, 0x06, 0x0D, 0x0D, 0x11, 0x18, 0xF6, 0xFF, 0xFF, 0x18,
+    0x20, 0x00, 0x00, 0x25, 0x0D, 0x00, 0x00, 0x17, 0x0E, 0x05,
+    0x00, 0x41, 0x0F, 0x0D, 0x0E, 0x1A, 0x0F, 0x0B, 0x00, 0x17,
+    0x10, 0x0D, 0x00, 0x34, 0x11, 0x08, 0x10, 0x34, 0x12, 0x09,
+    0x10, 0x34, 0x13, 0x0A, 0x10, 0x2D, 0x11, 0x12, 0x13, 0x2F,
+    0x14, 0x00, 0x00, 0x36, 0x0C, 0x10, 0x14, 0x25, 0x11, 0x01,
+    0x00, 0x06, 0x0D, 0x0D, 0x11, 0x18, 0xF5, 0xFF, 0xFF, 0x18,
+    0x11, 0x00, 0x00, 0x25, 0x0D, 0x00, 0x00, 0x17, 0x0E, 0x05,
+    0x00, 0x41, 0x0F, 0x0D, 0x0E, 0x1A, 0x0F, 0x0D, 0x00, 0x17,
+    0x10, 0x0D, 0x00, 0x34, 0x11, 0x08, 0x10, 0x34, 0x12, 0x09,
+    0x10, 0x34, 0x13, 0x0A, 0x10, 0x34, 0x14, 0x0B, 0x10, 0x2D,
+    0x11, 0x12, 0x13, 0x2B, 0x14, 0x00, 0x00, 0x2F, 0x15, 0x00,
+    0x00, 0x36, 0x0C, 0x10, 0x15, 0x25, 0x11, 0x01, 0x00, 0x06,
+    0x0D, 0x0D, 0x11, 0x18, 0xF3, 0xFF, 0xFF, 0x03, 0x0C, 0x00,
+    0x00, 0x80, 0xC4, 0x01, 0xA6, 0x0A, 0x02, 0x01, 0x08, 0x1A,
+    0x01, 0x00, 0x15, 0x02, 0x02, 0x08, 0x01, 0x00, 0x07, 0x02,
+    0x00, 0x20, 0x01, 0x00, 0x1F, 0x02, 0x02, 0x26, 0x01, 0x00,
+    0x0F, 0x01, 0x00, 0x15, 0x05, 0x02, 0x00, 0x01, 0x02, 0x22,
+    0x01, 0x00, 0x0F, 0x01, 0x00, 0x0D, 0x01, 0x02, 0x08, 0x01,
+    0x00, 0x07, 0x01, 0x00, 0x20, 0x01, 0x00, 0x1F, 0x03, 0x03,
+    0x03, 0x08, 0x06, 0x00, 0x03, 0x02, 0x12, 0x01, 0x00, 0x11,
+    0x05, 0x02, 0x00, 0x05, 0x0A, 0x04, 0x03, 0x02, 0x18, 0x01,
+    0x00, 0x13, 0x05, 0x02, 0x00, 0x01, 0x00, 0x42, 0x01, 0x00,
+    0x07, 0x01, 0x00, 0x1B, 0x03, 0x00, 0x1D, 0x02, 0x02, 0x1A,
+    0x01, 0x00, 0x19, 0x03, 0x05, 0x03, 0x01, 0x09, 0x03, 0x05,
+    0x02, 0x08, 0x01, 0x00, 0x3E, 0x02, 0x00, 0x05, 0x01, 0x00,
+    0x19, 0x03, 0x00, 0x1D, 0x01, 0x01, 0x07, 0x05, 0x04, 0x08,
+    0x01, 0x00, 0x3E, 0x01, 0x00, 0x14, 0x02, 0x00, 0x19, 0x01,
+    0x00, 0x19, 0x03, 0x00, 0x1D, 0x01, 0x03, 0x07, 0x05, 0x06,
+    0x08, 0x01, 0x00, 0x3E, 0x01, 0x00, 0x14, 0x01, 0x00, 0x14,
+    0x02, 0x00, 0x2D, 0x01, 0x00, 0x19, 0x03, 0x00, 0x1D, 0x01,
+    0x05, 0x07, 0x05, 0x08, 0x08, 0x01, 0x00, 0x3E, 0x01, 0x00,
+    0x14, 0x01, 0x00, 0x14, 0x01, 0x00, 0x14, 0x03, 0x00, 0x41,
+    0x01, 0x00, 0x19, 0x03, 0x00, 0x1D, 0x01, 0x1F, 0x0B, 0xD8,
+    0x0E, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x62, 0x72, 0x61,
+    0x63, 0x6B, 0x65, 0x74, 0x73, 0xDA, 0x81, 0x18, 0x28, 0x02,
+    0x00, 0x00, 0x1A, 0x01, 0x09, 0x00, 0x2B, 0x00, 0x00, 0x00,
+    0x26, 0x04, 0x00, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x1A, 0x03,
+    0x04, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00,
+    0x18, 0x01, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x2A, 0x03,
+    0x00, 0x00, 0x17, 0x04, 0x03, 0x00, 0x2A, 0x05, 0x01, 0x00,
+    0x17, 0x06, 0x05, 0x00, 0x2A, 0x07, 0x02, 0x00, 0x17, 0x08,
+    0x07, 0x00, 0x2A, 0x09, 0x03, 0x00, 0x17, 0x0A, 0x09, 0x00,
+    0x2A, 0x0B, 0x04, 0x00, 0x17, 0x0C, 0x0B, 0x00, 0x2A, 0x0D,
+    0x05, 0x00, 0x17, 0x0E, 0x0D, 0x00, 0x2A, 0x0F, 0x06, 0x00,
+    0x17, 0x10, 0x0F, 0x00, 0x26, 0x11, 0x01, 0x00, 0x26, 0x12,
+    0x02, 0x00, 0x2D, 0x11, 0x0A, 0x12, 0x26, 0x11, 0x03, 0x00,
+    0x26, 0x12, 0x04, 0x00, 0x2D, 0x0A, 0x11, 0x12, 0x26, 0x11,
+    0x05, 0x00, 0x26, 0x12, 0x06, 0x00, 0x2D, 0x11, 0x0A, 0x12,
+    0x26, 0x11, 0x07, 0x00, 0x2D, 0x0C, 0x11, 0x10, 0x26, 0x11,
+    0x08, 0x00, 0x26, 0x12, 0x09, 0x00, 0x2D, 0x11, 0x0C, 0x12,
+    0x26, 0x11, 0x0A, 0x00, 0x2D, 0x0E, 0x11, 0x0C, 0x3D, 0x11,
+    0x00, 0x00, 0x17, 0x12, 0x11, 0x00, 0x2A, 0x13, 0x07, 0x00,
+    0x17, 0x14, 0x13, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x16,
+    0x0B, 0x00, 0x2F, 0x15, 0x16, 0x00, 0x17, 0x16, 0x15, 0x00,
+    0x47, 0x16, 0x0C, 0x00, 0x18, 0x06, 0x00, 0x00, 0x18, 0x18,
+    0x00, 0x00, 0x18, 0x1C, 0x00, 0x00, 0x18, 0x22, 0x00, 0x00,
+    0x17, 0x15, 0x00, 0x00, 0x18, 0x23, 0x00, 0x00, 0x2B, 0x00,
+    0x00, 0x00, 0x26, 0x19, 0x0D, 0x00, 0x2F, 0x18, 0x19, 0x00,
+    0x26, 0x1A, 0x0E, 0x00, 0x1F, 0x19, 0x18, 0x1A, 0x1A, 0x19,
+    0x09, 0x00, 0x2C, 0x04, 0x00, 0x00, 0x26, 0x1A, 0x0F, 0x00,
+    0x2F, 0x18, 0x1A, 0x00, 0x2E, 0x18, 0x00, 0x00, 0x26, 0x1B,
+    0x10, 0x00, 0x2F, 0x1A, 0x1B, 0x00, 0x17, 0x17, 0x1A, 0x00,
+    0x18, 0x04, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x2F, 0x18,
+    0x14, 0x00, 0x17, 0x17, 0x18, 0x00, 0x17, 0x15, 0x17, 0x00,
+    0x18, 0x10, 0x00, 0x00, 0x2C, 0x04, 0x00, 0x00, 0x26, 0x18,
+    0x0F, 0x00, 0x2F, 0x17, 0x18, 0x00, 0x17, 0x15, 0x17, 0x00,
+    0x18, 0x0B, 0x00, 0x00, 0x2C, 0x00, 0x04, 0x00, 0x2F, 0x17,
+    0x06, 0x00, 0x2B, 0x17, 0x00, 0x00, 0x26, 0x19, 0x11, 0x00,
+    0x2F, 0x18, 0x19, 0x00, 0x17, 0x15, 0x18, 0x00, 0x18, 0x04,
+    0x00, 0x00, 0x2C, 0x00, 0x04, 0x00, 0x2F, 0x17, 0x06, 0x00,
+    0x17, 0x15, 0x17, 0x00, 0x17, 0x16, 0x15, 0x00, 0x03, 0x16,
+    0x00, 0x00, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x03, 0x01, 0x01,
+    0x01, 0x00, 0x05, 0x01, 0xDA, 0x81, 0x5B, 0xDA, 0x12, 0x28,
+    0x01, 0x00, 0x00, 0x27, 0x02, 0x00, 0x01, 0x2C, 0x00, 0x02,
+    0x00, 0x27, 0x02, 0x00, 0x02, 0x30, 0x02, 0x00, 0x00, 0xBF,
+    0xFF, 0x07, 0x01, 0xFE, 0x15, 0x06, 0x04, 0x00, 0x20, 0xCD,
+    0x02, 0xD8, 0x00, 0x00, 0x0B, 0x02, 0x02, 0x02, 0x01, 0x1B,
+    0x01, 0xCE, 0x07, 0x64, 0x6F, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0xDA, 0x12, 0xDA, 0x81, 0x16, 0x28, 0x02, 0x00, 0x00, 0x3E,
+    0x03, 0x00, 0x00, 0x17, 0x04, 0x03, 0x00, 0x22, 0x05, 0x00,
+    0x00, 0x2C, 0x00, 0x05, 0x00, 0x26, 0x06, 0x00, 0x00, 0x2F,
+    0x05, 0x06, 0x00, 0x17, 0x06, 0x05, 0x00, 0x22, 0x08, 0x00,
+    0x00, 0x1F, 0x07, 0x08, 0x06, 0x19, 0x07, 0x03, 0x00, 0x23,
+    0x07, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x07, 0x00,
+    0x00, 0x1A, 0x07, 0x0C, 0x00, 0x2B, 0x06, 0x00, 0x00, 0x27,
+    0x09, 0x00, 0x04, 0x2F, 0x08, 0x09, 0x00, 0x34, 0x09, 0x00,
+    0x06, 0x2B, 0x09, 0x00, 0x00, 0x2F, 0x0A, 0x01, 0x00, 0x36,
+    0x04, 0x08, 0x0A, 0x2C, 0x00, 0x06, 0x00, 0x26, 0x08, 0x00,
+    0x00, 0x2F, 0x06, 0x08, 0x00, 0x18, 0xEF, 0xFF, 0xFF, 0x03,
+    0x04, 0x00, 0x00, 0xBF, 0xFF, 0x28, 0x01, 0x82, 0x16, 0x06,
+    0x02, 0x02, 0x04, 0x04, 0x02, 0x12, 0x01, 0x00, 0x11, 0x06,
+    0x02, 0x0E, 0x01, 0x00, 0x0D, 0x03, 0x02, 0x18, 0x01, 0x00,
+    0x2C, 0x02, 0x00, 0x13, 0x01, 0x00, 0x2B, 0x03, 0x02, 0x12,
+    0x01, 0x03, 0x15, 0x01, 0x05, 0x03, 0xCD, 0x02, 0xD8, 0x00,
+    0x00, 0x05, 0x01, 0x01, 0x01, 0x05, 0x1F, 0x01, 0xCE, 0x0F,
+    0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x2D, 0x62, 0x69, 0x6E,
+    0x64, 0x69, 0x6E, 0x67, 0x73, 0xDA, 0x12, 0xDA, 0x15, 0xD5,
+    0x04, 0xDA, 0x4D, 0x00, 0xDA, 0x4E, 0x03, 0xDA, 0x4F, 0x02,
+    0xDA, 0x50, 0x01, 0xDA, 0x81, 0xF9, 0xDA, 0x80, 0xA1, 0xDA,
+    0x81, 0x18, 0x28, 0x01, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00,
+    0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x17, 0x03,
+    0x02, 0x00, 0x47, 0x03, 0x01, 0x00, 0x18, 0x07, 0x00, 0x00,
+    0x18, 0x09, 0x00, 0x00, 0x18, 0x0E, 0x00, 0x00, 0x18, 0x10,
+    0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x27, 0x02, 0x00, 0x04,
+    0x30, 0x02, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x26, 0x02,
+    0x02, 0x00, 0x30, 0x02, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00,
+    0x26, 0x04, 0x02, 0x00, 0x2F, 0x02, 0x04, 0x00, 0x2B, 0x02,
+    0x00, 0x00, 0x26, 0x04, 0x03, 0x00, 0x30, 0x04, 0x00, 0x00,
+    0x2C, 0x00, 0x01, 0x00, 0x27, 0x02, 0x00, 0x06, 0x30, 0x02,
+    0x00, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x27, 0x04, 0x00, 0x06,
+    0x2F, 0x02, 0x04, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x26, 0x04,
+    0x04, 0x00, 0x30, 0x04, 0x00, 0x00, 0xBF, 0xFF, 0x1F, 0x01,
+    0x92, 0x16, 0x06, 0x03, 0x02, 0x10, 0x06, 0x00, 0x0B, 0x03,
+    0x0A, 0x04, 0x03, 0x07, 0x0E, 0x03, 0x02, 0x1A, 0x03, 0x00,
+    0x19, 0x03, 0x02, 0x00, 0x03, 0x02, 0x24, 0x03, 0x00, 0x21,
+    0xCD, 0x02, 0xD8, 0x00, 0x00, 0x0B, 0x01, 0x01, 0x01, 0x02,
+    0x20, 0x01, 0xCE, 0x09, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64,
+    0x64, 0x65, 0x66, 0xDA, 0x12, 0xDA, 0x80, 0xA1, 0xDA, 0x80,
+    0xA0, 0x28, 0x01, 0x00, 0x00, 0x39, 0x02, 0x00, 0x00, 0x25,
+    0x04, 0x01, 0x00, 0x07, 0x03, 0x02, 0x04, 0x34, 0x02, 0x00,
+    0x03, 0x17, 0x03, 0x02, 0x00, 0x25, 0x05, 0x01, 0x00, 0x34,
+    0x04, 0x00, 0x05, 0x17, 0x05, 0x04, 0x00, 0x25, 0x07, 0x00,
+    0x00, 0x34, 0x06, 0x00, 0x07, 0x2B, 0x05, 0x00, 0x00, 0x27,
+    0x08, 0x00, 0x08, 0x2F, 0x07, 0x08, 0x00, 0x2C, 0x06, 0x07,
+    0x00, 0x3A, 0x06, 0x00, 0x00, 0x25, 0x07, 0x02, 0x00, 0x25,
+    0x08, 0xFE, 0xFF, 0x2D, 0x00, 0x07, 0x08, 0x26, 0x08, 0x00,
+    0x00, 0x2F, 0x07, 0x08, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x27,
+    0x09, 0x00, 0x04, 0x2F, 0x08, 0x09, 0x00, 0x2B, 0x08, 0x00,
+    0x00, 0x3A, 0x08, 0x00, 0x00, 0x2D, 0x06, 0x07, 0x08, 0x26,
+    0x0A, 0x01, 0x00, 0x2F, 0x09, 0x0A, 0x00, 0x2B, 0x09, 0x00,
+    0x00, 0x26, 0x06, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0xBF,
+    0xFF, 0x2B, 0x01, 0xA2, 0x16, 0x06, 0x01, 0x02, 0x2A, 0x02,
+    0x00, 0x05, 0x01, 0x00, 0x0B, 0x01, 0x00, 0x13, 0x02, 0x02,
+    0x16, 0x01, 0x00, 0x15, 0x02, 0x06, 0x0C, 0x03, 0x00, 0x12,
+    0x02, 0x01, 0x19, 0x05, 0x04, 0x04, 0x03, 0x02, 0x04, 0x05,
+    0x05, 0x07, 0x03, 0x01, 0x03, 0xCD, 0x02, 0xD8, 0x00, 0x00,
+    0x06, 0x01, 0x01, 0x01, 0x03, 0x10, 0x01, 0xCE, 0x09, 0x65,
+    0x78, 0x70, 0x61, 0x6E, 0x64, 0x61, 0x6C, 0x6C, 0xDA, 0x12,
+    0xDA, 0x80, 0xA1, 0xDA, 0x81, 0xF9, 0xDA, 0x57, 0x28, 0x01,
+    0x00, 0x00, 0x25, 0x02, 0x01, 0x00, 0x2C, 0x00, 0x02, 0x00,
+    0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x27, 0x03,
+    0x00, 0x04, 0x2C, 0x03, 0x02, 0x00, 0x26, 0x04, 0x01, 0x00,
+    0x2F, 0x03, 0x04, 0x00, 0x17, 0x02, 0x03, 0x00, 0x25, 0x05,
+    0x00, 0x00, 0x34, 0x04, 0x00, 0x05, 0x2B, 0x04, 0x00, 0x00,
+    0x2E, 0x02, 0x00, 0x00, 0x26, 0x05, 0x02, 0x00, 0x30, 0x05,
+    0x00, 0x00, 0xBF, 0xFF, 0x13, 0x01, 0xB4, 0x16, 0x06, 0x04,
+    0x02, 0x2E, 0x04, 0x00, 0x15, 0x01, 0x00, 0x13, 0x02, 0x02,
+    0x0E, 0x04, 0x00, 0x0D, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x08,
+    0x01, 0x01, 0x01, 0x05, 0x26, 0x01, 0xCE, 0x08, 0x65, 0x78,
+    0x70, 0x61, 0x6E, 0x64, 0x66, 0x6E, 0xDA, 0x12, 0xDA, 0x81,
+    0xED, 0xDA, 0x80, 0xA1, 0xDA, 0x81, 0xF9, 0xDA, 0x80, 0x87,
+    0xDA, 0x57, 0x28, 0x01, 0x00, 0x00, 0x25, 0x03, 0x01, 0x00,
+    0x34, 0x02, 0x00, 0x03, 0x17, 0x03, 0x02, 0x00, 0x2B, 0x03,
+    0x00, 0x00, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x04, 0x05, 0x00,
+    0x1A, 0x04, 0x11, 0x00, 0x25, 0x05, 0x03, 0x00, 0x2C, 0x00,
+    0x05, 0x00, 0x26, 0x06, 0x01, 0x00, 0x2F, 0x05, 0x06, 0x00,
+    0x27, 0x06, 0x00, 0x04, 0x2C, 0x06, 0x05, 0x00, 0x26, 0x07,
+    0x02, 0x00, 0x2F, 0x06, 0x07, 0x00, 0x17, 0x05, 0x06, 0x00,
+    0x25, 0x07, 0x02, 0x00, 0x34, 0x06, 0x00, 0x07, 0x26, 0x07,
+    0x03, 0x00, 0x2D, 0x07, 0x03, 0x06, 0x2E, 0x05, 0x00, 0x00,
+    0x26, 0x07, 0x04, 0x00, 0x30, 0x07, 0x00, 0x00, 0x25, 0x05,
+    0x02, 0x00, 0x2C, 0x00, 0x05, 0x00, 0x26, 0x06, 0x01, 0x00,
+    0x2F, 0x05, 0x06, 0x00, 0x27, 0x06, 0x00, 0x04, 0x2C, 0x06,
+    0x05, 0x00, 0x26, 0x07, 0x02, 0x00, 0x2F, 0x06, 0x07, 0x00,
+    0x17, 0x05, 0x06, 0x00, 0x26, 0x06, 0x03, 0x00, 0x2C, 0x06,
+    0x03, 0x00, 0x2E, 0x05, 0x00, 0x00, 0x26, 0x06, 0x04, 0x00,
+    0x30, 0x06, 0x00, 0x00, 0xBF, 0xFF, 0x2B, 0x01, 0xBC, 0x16,
+    0x06, 0x02, 0x02, 0x14, 0x01, 0x00, 0x0F, 0x03, 0x02, 0x08,
+    0x01, 0x00, 0x07, 0x04, 0x04, 0x32, 0x04, 0x00, 0x15, 0x01,
+    0x00, 0x13, 0x02, 0x02, 0x1C, 0x05, 0x00, 0x1B, 0x04, 0x04,
+    0x2A, 0x04, 0x00, 0x15, 0x01, 0x00, 0x13, 0x05, 0x02, 0x00,
+    0xCD, 0x02, 0xF8, 0x00, 0x00, 0x07, 0x01, 0x01, 0x01, 0x01,
+    0x0C, 0x01, 0x01, 0xCE, 0x08, 0x65, 0x78, 0x70, 0x61, 0x6E,
+    0x64, 0x71, 0x71, 0xDA, 0x12, 0xDA, 0x57, 0x28, 0x01, 0x00,
+    0x00, 0x2A, 0x02, 0x00, 0x00, 0x17, 0x03, 0x02, 0x00, 0x25,
+    0x05, 0x00, 0x00, 0x34, 0x04, 0x00, 0x05, 0x25, 0x06, 0x01,
+    0x00, 0x34, 0x05, 0x00, 0x06, 0x2B, 0x05, 0x00, 0x00, 0x2F,
+    0x06, 0x03, 0x00, 0x2C, 0x04, 0x06, 0x00, 0x26, 0x05, 0x00,
+    0x00, 0x30, 0x05, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x02, 0xD8,
+    0x00, 0x00, 0x08, 0x01, 0x01, 0x01, 0x0A, 0x40, 0x01, 0xCE,
+    0x02, 0x71, 0x71, 0xDA, 0x12, 0xDA, 0x15, 0xD5, 0x04, 0xDA,
+    0x4D, 0x01, 0xDA, 0x4E, 0x03, 0xDA, 0x4F, 0x02, 0xDA, 0x50,
+    0x00, 0xCF, 0x07, 0x75, 0x6E, 0x71, 0x75, 0x6F, 0x74, 0x65,
+    0xCF, 0x10, 0x75, 0x6E, 0x71, 0x75, 0x6F, 0x74, 0x65, 0x2D,
+    0x73, 0x70, 0x6C, 0x69, 0x63, 0x69, 0x6E, 0x67, 0xDA, 0x57,
+    0xDA, 0x81, 0xF9, 0xDA, 0x80, 0xA1, 0xD7, 0xCD, 0x02, 0x98,
+    0x00, 0x00, 0x09, 0x01, 0x01, 0x01, 0x03, 0x18, 0xCE, 0x03,
+    0x6B, 0x76, 0x73, 0xDA, 0x12, 0xDA, 0x81, 0x1A, 0xDA, 0x81,
+    0x16, 0xDA, 0x81, 0x1B, 0x28, 0x01, 0x00, 0x00, 0x39, 0x02,
+    0x00, 0x00, 0x25, 0x04, 0x02, 0x00, 0x09, 0x03, 0x04, 0x02,
+    0x2B, 0x03, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x02,
+    0x04, 0x00, 0x17, 0x03, 0x02, 0x00, 0x22, 0x04, 0x00, 0x00,
+    0x2C, 0x00, 0x04, 0x00, 0x26, 0x05, 0x01, 0x00, 0x2F, 0x04,
+    0x05, 0x00, 0x17, 0x05, 0x04, 0x00, 0x1A, 0x05, 0x0A, 0x00,
+    0x17, 0x04, 0x05, 0x00, 0x34, 0x06, 0x00, 0x04, 0x2D, 0x03,
+    0x04, 0x06, 0x26, 0x08, 0x02, 0x00, 0x2F, 0x07, 0x08, 0x00,
+    0x2C, 0x00, 0x05, 0x00, 0x26, 0x06, 0x01, 0x00, 0x2F, 0x05,
+    0x06, 0x00, 0x18, 0xF7, 0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00,
+    0x1F, 0x01, 0x9A, 0x11, 0x02, 0x01, 0x08, 0x36, 0x02, 0x00,
+    0x09, 0x03, 0x00, 0x15, 0x01, 0x00, 0x11, 0x07, 0x02, 0x00,
+    0x01, 0x00, 0x4E, 0x03, 0x00, 0x23, 0x04, 0x00, 0x29, 0x01,
+    0x09, 0x03, 0xD8, 0x05, 0x74, 0x61, 0x62, 0x6C, 0x65, 0xD8,
+    0x06, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x28, 0x01, 0x00,
+    0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F,
+    0x02, 0x03, 0x00, 0x17, 0x03, 0x02, 0x00, 0x47, 0x03, 0x01,
+    0x00, 0x18, 0x05, 0x00, 0x00, 0x18, 0x24, 0x00, 0x00, 0x18,
+    0x26, 0x00, 0x00, 0x18, 0x2E, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x25, 0x04, 0x00, 0x00, 0x34, 0x02, 0x00, 0x04, 0x17,
+    0x04, 0x02, 0x00, 0x26, 0x05, 0x02, 0x00, 0x1F, 0x02, 0x05,
+    0x04, 0x17, 0x05, 0x02, 0x00, 0x1A, 0x05, 0x03, 0x00, 0x17,
+    0x02, 0x05, 0x00, 0x18, 0x09, 0x00, 0x00, 0x26, 0x07, 0x03,
+    0x00, 0x1F, 0x06, 0x07, 0x04, 0x17, 0x07, 0x06, 0x00, 0x1A,
+    0x07, 0x03, 0x00, 0x17, 0x06, 0x07, 0x00, 0x18, 0x02, 0x00,
+    0x00, 0x22, 0x06, 0x00, 0x00, 0x17, 0x02, 0x06, 0x00, 0x1A,
+    0x02, 0x09, 0x00, 0x25, 0x06, 0x01, 0x00, 0x34, 0x05, 0x00,
+    0x06, 0x2B, 0x05, 0x00, 0x00, 0x27, 0x07, 0x00, 0x04, 0x2F,
+    0x06, 0x07, 0x00, 0x2C, 0x04, 0x06, 0x00, 0x26, 0x05, 0x04,
+    0x00, 0x30, 0x05, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x26,
+    0x06, 0x05, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x2B, 0x05, 0x00,
+    0x00, 0x26, 0x06, 0x06, 0x00, 0x30, 0x06, 0x00, 0x00, 0x2C,
+    0x01, 0x00, 0x00, 0x26, 0x02, 0x05, 0x00, 0x30, 0x02, 0x00,
+    0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x04, 0x07, 0x00, 0x2F,
+    0x02, 0x04, 0x00, 0x2C, 0x01, 0x02, 0x00, 0x26, 0x05, 0x05,
+    0x00, 0x2F, 0x04, 0x05, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x26,
+    0x02, 0x08, 0x00, 0x30, 0x02, 0x00, 0x00, 0x2B, 0x00, 0x00,
+    0x00, 0x26, 0x04, 0x07, 0x00, 0x2F, 0x02, 0x04, 0x00, 0x2C,
+    0x01, 0x02, 0x00, 0x26, 0x05, 0x05, 0x00, 0x2F, 0x04, 0x05,
+    0x00, 0x2B, 0x04, 0x00, 0x00, 0x26, 0x02, 0x09, 0x00, 0x30,
+    0x02, 0x00, 0x00, 0x00, 0x43, 0x01, 0xD2, 0x16, 0x0A, 0x03,
+    0x02, 0x10, 0x07, 0x00, 0x0B, 0x02, 0x04, 0x26, 0x01, 0x00,
+    0x0F, 0x02, 0x02, 0x10, 0x04, 0x00, 0x07, 0x02, 0x00, 0x28,
+    0x06, 0x00, 0x27, 0x01, 0x00, 0x07, 0x02, 0x02, 0x26, 0x03,
+    0x00, 0x0D, 0x03, 0x00, 0x13, 0x03, 0x02, 0x1A, 0x03, 0x00,
+    0x19, 0x03, 0x02, 0x07, 0x03, 0x02, 0x1E, 0x03, 0x00, 0x0F,
+    0x03, 0x00, 0x0D, 0x03, 0x02, 0x22, 0x03, 0x00, 0x0F, 0x03,
+    0x00, 0x0F, 0x13, 0x01, 0xD0, 0x16, 0x06, 0x02, 0x02, 0x04,
+    0x02, 0x16, 0x0E, 0x02, 0x00, 0x1A, 0x02, 0x00, 0x07, 0x03,
+    0x00, 0x1F, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x0E, 0x01, 0x01,
+    0x01, 0x05, 0x2F, 0x01, 0xCE, 0x05, 0x64, 0x6F, 0x74, 0x75,
+    0x70, 0xDA, 0x12, 0xDA, 0x80, 0x94, 0xDA, 0x03, 0xDA, 0x24,
+    0xDA, 0x80, 0xA1, 0xDA, 0x81, 0xF9, 0x28, 0x01, 0x00, 0x00,
+    0x25, 0x03, 0x00, 0x00, 0x34, 0x02, 0x00, 0x03, 0x17, 0x03,
+    0x02, 0x00, 0x27, 0x05, 0x00, 0x12, 0x34, 0x04, 0x05, 0x03,
+    0x17, 0x05, 0x04, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x07,
+    0x00, 0x00, 0x2F, 0x06, 0x07, 0x00, 0x17, 0x07, 0x06, 0x00,
+    0x1A, 0x07, 0x03, 0x00, 0x17, 0x06, 0x07, 0x00, 0x18, 0x08,
+    0x00, 0x00, 0x3D, 0x08, 0x00, 0x00, 0x17, 0x09, 0x08, 0x00,
+    0x1A, 0x09, 0x03, 0x00, 0x17, 0x08, 0x09, 0x00, 0x18, 0x02,
+    0x00, 0x00, 0x22, 0x08, 0x00, 0x00, 0x17, 0x06, 0x08, 0x00,
+    0x17, 0x07, 0x06, 0x00, 0x26, 0x08, 0x01, 0x00, 0x2B, 0x08,
+    0x00, 0x00, 0x2F, 0x08, 0x07, 0x00, 0x17, 0x09, 0x08, 0x00,
+    0x26, 0x0A, 0x02, 0x00, 0x2B, 0x0A, 0x00, 0x00, 0x2F, 0x0A,
+    0x07, 0x00, 0x17, 0x0B, 0x0A, 0x00, 0x1A, 0x05, 0x03, 0x00,
+    0x2B, 0x00, 0x00, 0x00, 0x30, 0x05, 0x00, 0x00, 0x1A, 0x0B,
+    0x07, 0x00, 0x25, 0x0C, 0x01, 0x00, 0x2C, 0x00, 0x0C, 0x00,
+    0x26, 0x0D, 0x03, 0x00, 0x2F, 0x0C, 0x0D, 0x00, 0x2E, 0x0C,
+    0x00, 0x00, 0x30, 0x09, 0x00, 0x00, 0x27, 0x0C, 0x00, 0x04,
+    0x2C, 0x0C, 0x00, 0x00, 0x26, 0x0D, 0x04, 0x00, 0x2F, 0x0C,
+    0x0D, 0x00, 0x2B, 0x0C, 0x00, 0x00, 0x26, 0x0D, 0x03, 0x00,
+    0x30, 0x0D, 0x00, 0x00, 0xBF, 0xFF, 0x3A, 0x01, 0x82, 0x17,
+    0x06, 0x02, 0x02, 0x12, 0x01, 0x00, 0x0D, 0x02, 0x02, 0x0E,
+    0x01, 0x00, 0x0D, 0x03, 0x02, 0x1E, 0x0B, 0x00, 0x07, 0x01,
+    0x00, 0x15, 0x03, 0x02, 0x0E, 0x01, 0x00, 0x0D, 0x03, 0x02,
+    0x10, 0x01, 0x00, 0x0F, 0x01, 0x02, 0x00, 0x02, 0x02, 0x08,
+    0x01, 0x01, 0x07, 0x04, 0x04, 0x10, 0x02, 0x00, 0x05, 0x04,
+    0x02, 0x14, 0x03, 0x00, 0x19, 0x6E, 0x01, 0xEC, 0x15, 0x02,
+    0x01, 0x0A, 0x04, 0x03, 0x02, 0x10, 0x01, 0x00, 0x0B, 0x02,
+    0x02, 0x12, 0x01, 0x01, 0x11, 0x01, 0x01, 0x03, 0x02, 0x08,
+    0x00, 0x02, 0x04, 0x00, 0x02, 0x10, 0x00, 0x02, 0x10, 0x00,
+    0x02, 0x12, 0x00, 0x02, 0x08, 0x00, 0x02, 0x14, 0x00, 0x12,
+    0x1C, 0x00, 0x02, 0x16, 0x00, 0x03, 0x18, 0x10, 0x08, 0x00,
+    0x0B, 0x03, 0x02, 0x20, 0x02, 0x00, 0x05, 0x01, 0x00, 0x07,
+    0x03, 0x02, 0x24, 0x03, 0x00, 0x1F, 0x02, 0x01, 0x03, 0x02,
+    0x04, 0x04, 0x01, 0x03, 0x03, 0x02, 0x01, 0x11, 0x03, 0x08,
+    0x12, 0x02, 0x07, 0x11, 0x02, 0x0A, 0x36, 0x03, 0x00, 0x21,
+    0x02, 0x09, 0x13, 0x02, 0x0C, 0x12, 0x01, 0x0B, 0x11, 0x01,
+    0x01, 0x03, 0x01, 0xAB, 0x01, 0x03, 0xDA, 0x05, 0xCE, 0x80,
+    0x82, 0x28, 0x6D, 0x61, 0x63, 0x65, 0x78, 0x31, 0x20, 0x78,
+    0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x6F, 0x6E, 0x2D, 0x62,
+    0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x29, 0x0A, 0x0A, 0x45,
+    0x78, 0x70, 0x61, 0x6E, 0x64, 0x20, 0x6D, 0x61, 0x63, 0x72,
+    0x6F, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x66, 0x6F,
+    0x72, 0x6D, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x64, 0x6F,
+    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x72, 0x65, 0x63, 0x75, 0x72,
+    0x73, 0x69, 0x76, 0x65, 0x6C, 0x79, 0x20, 0x65, 0x78, 0x70,
+    0x61, 0x6E, 0x64, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x73,
+    0x2E, 0x20, 0x20, 0x53, 0x65, 0x65, 0x20, 0x6D, 0x61, 0x63,
+    0x65, 0x78, 0x20, 0x64, 0x6F, 0x63, 0x73, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x6F, 0x6E, 0x20,
+    0x6F, 0x6E, 0x2D, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+    0x2E, 0xCF, 0x02, 0x6F, 0x72, 0xD3, 0x04, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x80, 0xFC, 0x01, 0xDA, 0x03, 0xD7,
+    0xCD, 0x02, 0x99, 0x00, 0x00, 0x0D, 0x00, 0x00, 0xCD, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x06, 0x28, 0xCE, 0x02, 0x6F, 0x72, 0xDA,
+    0x12, 0xDA, 0x4C, 0xDA, 0x58, 0xDA, 0x57, 0xDA, 0x55, 0xDA,
+    0x56, 0xDA, 0x59, 0x28, 0x01, 0x00, 0x00, 0x22, 0x02, 0x00,
+    0x00, 0x39, 0x03, 0x00, 0x00, 0x17, 0x04, 0x03, 0x00, 0x17,
+    0x05, 0x04, 0x00, 0x25, 0x07, 0x00, 0x00, 0x43, 0x06, 0x05,
+    0x07, 0x1A, 0x06, 0x20, 0x00, 0x25, 0x07, 0x01, 0x00, 0x07,
+    0x05, 0x05, 0x07, 0x34, 0x07, 0x00, 0x05, 0x17, 0x08, 0x07,
+    0x00, 0x2B, 0x08, 0x00, 0x00, 0x26, 0x09, 0x00, 0x00, 0x2F,
+    0x07, 0x09, 0x00, 0x1A, 0x07, 0x07, 0x00, 0x26, 0x09, 0x01,
+    0x00, 0x2D, 0x09, 0x08, 0x08, 0x2B, 0x02, 0x00, 0x00, 0x26,
+    0x09, 0x02, 0x00, 0x2F, 0x02, 0x09, 0x00, 0x18, 0x11, 0x00,
+    0x00, 0x26, 0x0A, 0x03, 0x00, 0x2F, 0x09, 0x0A, 0x00, 0x17,
+    0x0A, 0x09, 0x00, 0x26, 0x09, 0x04, 0x00, 0x2D, 0x09, 0x0A,
+    0x08, 0x26, 0x0B, 0x02, 0x00, 0x2F, 0x09, 0x0B, 0x00, 0x26,
+    0x0B, 0x01, 0x00, 0x2D, 0x0B, 0x0A, 0x0A, 0x2B, 0x02, 0x00,
+    0x00, 0x26, 0x0C, 0x02, 0x00, 0x2F, 0x0B, 0x0C, 0x00, 0x26,
+    0x0C, 0x05, 0x00, 0x2D, 0x0C, 0x09, 0x0B, 0x26, 0x0C, 0x02,
+    0x00, 0x2F, 0x02, 0x0C, 0x00, 0x18, 0xDF, 0xFF, 0xFF, 0x03,
+    0x02, 0x00, 0x00, 0x40, 0x01, 0xF8, 0x03, 0x02, 0x01, 0x08,
+    0x04, 0x01, 0x02, 0x12, 0x01, 0x00, 0x11, 0x01, 0x02, 0x00,
+    0x02, 0x02, 0x0E, 0x01, 0x00, 0x0D, 0x02, 0x02, 0x04, 0x01,
+    0x02, 0x10, 0x01, 0x00, 0x0F, 0x03, 0x02, 0x1A, 0x01, 0x00,
+    0x07, 0x05, 0x02, 0x04, 0x01, 0x01, 0x03, 0x02, 0x06, 0x1A,
+    0x01, 0x00, 0x11, 0x04, 0x02, 0x16, 0x05, 0x02, 0x07, 0x04,
+    0x01, 0x0D, 0x01, 0x0D, 0x1D, 0x01, 0x0D, 0x03, 0xDA, 0x24,
+    0xCB, 0xDA, 0x05, 0xCE, 0x6F, 0x28, 0x6F, 0x72, 0x20, 0x26,
+    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29, 0x0A, 0x0A, 0x45,
+    0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74,
+    0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74,
+    0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+    0x69, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x70, 0x72, 0x65,
+    0x63, 0x65, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x65, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+    0x66, 0x61, 0x6C, 0x73, 0x65, 0x2C, 0x20, 0x6F, 0x74, 0x68,
+    0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x20, 0x65, 0x76,
+    0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F,
+    0x20, 0x74, 0x72, 0x75, 0x65, 0x2E, 0xCF, 0x04, 0x74, 0x79,
+    0x70, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x15, 0xDA, 0x05,
+    0xCE, 0x80, 0xE7, 0x28, 0x74, 0x79, 0x70, 0x65, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20,
+    0x6F, 0x66, 0x20, 0x78, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20,
+    0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x20, 0x73, 0x79,
+    0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0x20, 0x78, 0x20, 0x69, 0x73,
+    0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x0A, 0x09, 0x3A,
+    0x6E, 0x69, 0x6C, 0x0A, 0x09, 0x3A, 0x62, 0x6F, 0x6F, 0x6C,
+    0x65, 0x61, 0x6E, 0x0A, 0x09, 0x3A, 0x69, 0x6E, 0x74, 0x65,
+    0x67, 0x65, 0x72, 0x0A, 0x09, 0x3A, 0x72, 0x65, 0x61, 0x6C,
+    0x0A, 0x09, 0x3A, 0x61, 0x72, 0x72, 0x61, 0x79, 0x0A, 0x09,
+    0x3A, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x0A, 0x09, 0x3A, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x0A, 0x09, 0x3A, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x0A, 0x09, 0x3A, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x0A, 0x09, 0x3A, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x0A, 0x09, 0x3A, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C,
+    0x0A, 0x09, 0x3A, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64,
+    0x0A, 0x09, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x0A, 0x09, 0x3A, 0x63, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x0A, 0x0A, 0x6F, 0x72, 0x20, 0x61, 0x6E,
+    0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x73, 0x79, 0x6D, 0x62,
+    0x6F, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6E, 0x20,
+    0x61, 0x62, 0x73, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20, 0x74,
+    0x79, 0x70, 0x65, 0x2E, 0xCF, 0x04, 0x6E, 0x61, 0x74, 0x3F,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x04, 0x6E, 0x61, 0x74, 0x3F,
+    0xDA, 0x05, 0xCE, 0x69, 0x28, 0x6E, 0x61, 0x74, 0x3F, 0x20,
+    0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20,
+    0x69, 0x66, 0x20, 0x78, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62,
+    0x65, 0x20, 0x65, 0x78, 0x61, 0x63, 0x74, 0x6C, 0x79, 0x20,
+    0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x65,
+    0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E,
+    0x2D, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+    0x33, 0x32, 0x20, 0x62, 0x69, 0x74, 0x20, 0x73, 0x69, 0x67,
+    0x6E, 0x65, 0x64, 0x20, 0x74, 0x77, 0x6F, 0x27, 0x73, 0x20,
+    0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2E, 0xCF,
+    0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x74, 0x61, 0x6E, 0x68,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68,
+    0x2F, 0x74, 0x61, 0x6E, 0x68, 0xDA, 0x05, 0xCE, 0x32, 0x28,
+    0x6D, 0x61, 0x74, 0x68, 0x2F, 0x74, 0x61, 0x6E, 0x68, 0x20,
+    0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x79, 0x70, 0x65, 0x72,
+    0x62, 0x6F, 0x6C, 0x69, 0x63, 0x20, 0x74, 0x61, 0x6E, 0x67,
+    0x65, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF,
+    0x06, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x06, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0xDA,
+    0x05, 0xCE, 0x81, 0x28, 0x28, 0x6E, 0x61, 0x74, 0x69, 0x76,
+    0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x26, 0x6F, 0x70,
+    0x74, 0x20, 0x65, 0x6E, 0x76, 0x29, 0x0A, 0x0A, 0x4C, 0x6F,
+    0x61, 0x64, 0x20, 0x61, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x76,
+    0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x66,
+    0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69,
+    0x76, 0x65, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2E, 0x20,
+    0x54, 0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6D,
+    0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E, 0x20,
+    0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x20, 0x6F,
+    0x72, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65,
+    0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6F, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x73, 0x79,
+    0x73, 0x74, 0x65, 0x6D, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x69, 0x73, 0x20, 0x75, 0x73, 0x75, 0x61, 0x6C, 0x6C, 0x79,
+    0x20, 0x61, 0x20, 0x2E, 0x73, 0x6F, 0x20, 0x66, 0x69, 0x6C,
+    0x65, 0x20, 0x6F, 0x6E, 0x20, 0x55, 0x6E, 0x69, 0x78, 0x20,
+    0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x73, 0x2C, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x61, 0x20, 0x2E, 0x64, 0x6C, 0x6C, 0x20,
+    0x66, 0x69, 0x6C, 0x65, 0x20, 0x6F, 0x6E, 0x20, 0x57, 0x69,
+    0x6E, 0x64, 0x6F, 0x77, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x6E,
+    0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x20,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6F,
+    0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x61, 0x74, 0x69,
+    0x76, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2E,
+    0xCF, 0x0B, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66,
+    0x69, 0x6E, 0x64, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x69, 0x6E, 0x64,
+    0xDA, 0x05, 0xCE, 0x80, 0xA8, 0x28, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x2F, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x70, 0x61,
+    0x74, 0x74, 0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x53,
+    0x65, 0x61, 0x72, 0x63, 0x68, 0x65, 0x73, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72,
+    0x6E, 0x20, 0x70, 0x61, 0x74, 0x74, 0x20, 0x69, 0x6E, 0x20,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x72,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20,
+    0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72,
+    0x73, 0x74, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74,
+    0x65, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x74,
+    0x20, 0x69, 0x66, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2C,
+    0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E,
+    0x69, 0x6C, 0x2E, 0xCF, 0x09, 0x75, 0x70, 0x64, 0x61, 0x74,
+    0x65, 0x2D, 0x69, 0x6E, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03,
+    0x00, 0xDA, 0x12, 0x83, 0xFC, 0x01, 0xDA, 0x03, 0xD7, 0xCD,
+    0x02, 0x99, 0x00, 0x00, 0x11, 0x03, 0x03, 0xCD, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x02, 0x2B, 0xCE, 0x09, 0x75, 0x70, 0x64, 0x61,
+    0x74, 0x65, 0x2D, 0x69, 0x6E, 0xDA, 0x12, 0xCE, 0x1D, 0x65,
+    0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x61, 0x74,
+    0x20, 0x6C, 0x65, 0x61, 0x73, 0x74, 0x20, 0x31, 0x20, 0x6B,
+    0x65, 0x79, 0x20, 0x69, 0x6E, 0x20, 0x6B, 0x73, 0xDA, 0x82,
+    0x08, 0x28, 0x04, 0x00, 0x00, 0x17, 0x05, 0x00, 0x00, 0x39,
+    0x06, 0x01, 0x00, 0x25, 0x08, 0x01, 0x00, 0x07, 0x07, 0x06,
+    0x08, 0x17, 0x06, 0x07, 0x00, 0x25, 0x09, 0x00, 0x00, 0x41,
+    0x08, 0x06, 0x09, 0x1A, 0x08, 0x04, 0x00, 0x26, 0x09, 0x00,
+    0x00, 0x01, 0x09, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x25,
+    0x08, 0x00, 0x00, 0x17, 0x09, 0x06, 0x00, 0x41, 0x0A, 0x08,
+    0x09, 0x1A, 0x0A, 0x13, 0x00, 0x17, 0x0B, 0x08, 0x00, 0x35,
+    0x0C, 0x01, 0x0B, 0x17, 0x0D, 0x0C, 0x00, 0x35, 0x0C, 0x05,
+    0x0D, 0x17, 0x0E, 0x0C, 0x00, 0x22, 0x0F, 0x00, 0x00, 0x1F,
+    0x0C, 0x0F, 0x0E, 0x1A, 0x0C, 0x07, 0x00, 0x26, 0x10, 0x01,
+    0x00, 0x2F, 0x0F, 0x10, 0x00, 0x17, 0x10, 0x0F, 0x00, 0x36,
+    0x05, 0x0D, 0x10, 0x17, 0x05, 0x10, 0x00, 0x18, 0x02, 0x00,
+    0x00, 0x17, 0x05, 0x0E, 0x00, 0x25, 0x0C, 0x01, 0x00, 0x06,
+    0x08, 0x08, 0x0C, 0x18, 0xED, 0xFF, 0xFF, 0x35, 0x08, 0x01,
+    0x06, 0x17, 0x09, 0x08, 0x00, 0x35, 0x0A, 0x05, 0x09, 0x17,
+    0x0B, 0x0A, 0x00, 0x2B, 0x0B, 0x00, 0x00, 0x2E, 0x03, 0x00,
+    0x00, 0x2F, 0x0C, 0x02, 0x00, 0x36, 0x05, 0x09, 0x0C, 0x03,
+    0x00, 0x00, 0x00, 0x5B, 0x01, 0xF8, 0x0F, 0x02, 0x01, 0x0C,
+    0x04, 0x01, 0x02, 0x1C, 0x02, 0x00, 0x05, 0x01, 0x00, 0x15,
+    0x02, 0x02, 0x08, 0x01, 0x00, 0x07, 0x02, 0x00, 0x20, 0x01,
+    0x00, 0x1F, 0x05, 0x02, 0x00, 0x01, 0x02, 0x12, 0x01, 0x00,
+    0x0D, 0x01, 0x02, 0x0E, 0x01, 0x00, 0x0D, 0x02, 0x02, 0x08,
+    0x01, 0x00, 0x07, 0x02, 0x02, 0x1A, 0x01, 0x00, 0x15, 0x01,
+    0x02, 0x04, 0x01, 0x02, 0x00, 0x01, 0x05, 0x07, 0x01, 0x08,
+    0x04, 0x03, 0x0D, 0x07, 0x01, 0x10, 0x1C, 0x01, 0x00, 0x1B,
+    0x01, 0x02, 0x1C, 0x01, 0x00, 0x1B, 0x03, 0x02, 0x20, 0x01,
+    0x00, 0x1F, 0x01, 0x25, 0x03, 0xDA, 0x05, 0xCE, 0x81, 0x07,
+    0x28, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x2D, 0x69, 0x6E,
+    0x20, 0x64, 0x73, 0x20, 0x6B, 0x73, 0x20, 0x66, 0x20, 0x26,
+    0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A, 0x55, 0x70,
+    0x64, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x6E, 0x65,
+    0x73, 0x74, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
+    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20,
+    0x62, 0x79, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x69, 0x6E,
+    0x67, 0x20, 0x66, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x2E, 0x20, 0x20, 0x4C, 0x6F, 0x6F,
+    0x6B, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x76, 0x69, 0x61,
+    0x20, 0x20, 0x61, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E,
+    0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x6B, 0x65, 0x79, 0x73,
+    0x2E, 0x20, 0x4D, 0x69, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20,
+    0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+    0x74, 0x75, 0x72, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+    0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63,
+    0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D,
+    0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x2C, 0x20, 0x6F,
+    0x72, 0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C, 0x20, 0x64, 0x61,
+    0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75,
+    0x72, 0x65, 0x2E, 0xCF, 0x05, 0x64, 0x65, 0x66, 0x6E, 0x2D,
+    0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x33,
+    0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x99, 0x00, 0x00, 0x04,
+    0x01, 0x01, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0x06, 0xCE,
+    0x05, 0x64, 0x65, 0x66, 0x6E, 0x2D, 0xDA, 0x12, 0xDA, 0x80,
+    0xCD, 0xDA, 0x81, 0x5C, 0x28, 0x02, 0x00, 0x00, 0x26, 0x03,
+    0x00, 0x00, 0x2C, 0x00, 0x03, 0x00, 0x2E, 0x01, 0x00, 0x00,
+    0x26, 0x03, 0x01, 0x00, 0x30, 0x03, 0x00, 0x00, 0x06, 0x01,
+    0x66, 0x02, 0x05, 0x06, 0x04, 0xDA, 0x24, 0xCB, 0xDA, 0x05,
+    0xCE, 0x49, 0x28, 0x64, 0x65, 0x66, 0x6E, 0x2D, 0x20, 0x6E,
+    0x61, 0x6D, 0x65, 0x20, 0x26, 0x20, 0x6D, 0x6F, 0x72, 0x65,
+    0x29, 0x0A, 0x0A, 0x44, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20,
+    0x61, 0x20, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65, 0x20,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E,
+    0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x65, 0x78, 0x70, 0x6F,
+    0x72, 0x74, 0x65, 0x64, 0x2E, 0xCF, 0x05, 0x70, 0x63, 0x61,
+    0x6C, 0x6C, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x80, 0x89, 0xDA,
+    0x05, 0xCE, 0x81, 0x25, 0x28, 0x70, 0x63, 0x61, 0x6C, 0x6C,
+    0x20, 0x66, 0x29, 0x0A, 0x0A, 0x43, 0x61, 0x6C, 0x6C, 0x20,
+    0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x6F, 0x66, 0x20, 0x6E, 0x6F, 0x20, 0x61, 0x72, 0x67,
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x61, 0x6E, 0x79,
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x74, 0x20,
+    0x72, 0x61, 0x69, 0x73, 0x65, 0x73, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x5B, 0x74, 0x72, 0x75,
+    0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x5D, 0x20,
+    0x69, 0x66, 0x20, 0x66, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x5B, 0x66, 0x61,
+    0x6C, 0x73, 0x65, 0x20, 0x65, 0x72, 0x72, 0x5D, 0x20, 0x69,
+    0x66, 0x20, 0x66, 0x20, 0x72, 0x61, 0x69, 0x73, 0x65, 0x73,
+    0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E,
+    0x20, 0x55, 0x6E, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x72, 0x65,
+    0x73, 0x75, 0x6D, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x6E,
+    0x65, 0x77, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2C, 0x20,
+    0x66, 0x20, 0x72, 0x75, 0x6E, 0x73, 0x20, 0x6F, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+    0x74, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2C, 0x20, 0x73,
+    0x6F, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x73, 0x69,
+    0x67, 0x6E, 0x61, 0x6C, 0x73, 0x20, 0x73, 0x75, 0x63, 0x68,
+    0x20, 0x61, 0x73, 0x20, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x73,
+    0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x74, 0x68, 0x72, 0x6F,
+    0x75, 0x67, 0x68, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x73,
+    0x20, 0x69, 0x66, 0x20, 0x66, 0x20, 0x77, 0x65, 0x72, 0x65,
+    0x20, 0x63, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x64, 0x69,
+    0x72, 0x65, 0x63, 0x74, 0x6C, 0x79, 0x2E, 0xCF, 0x05, 0x70,
+    0x72, 0x69, 0x6E, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x05,
+    0x70, 0x72, 0x69, 0x6E, 0x74, 0xDA, 0x05, 0xCE, 0x81, 0x45,
+    0x28, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x20, 0x26, 0x20, 0x78,
+    0x73, 0x29, 0x0A, 0x0A, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C,
+    0x65, 0x20, 0x28, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x61, 0x72,
+    0x64, 0x20, 0x6F, 0x75, 0x74, 0x29, 0x2E, 0x20, 0x56, 0x61,
+    0x6C, 0x75, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F,
+    0x6E, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6F,
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x69,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65,
+    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6C, 0x72, 0x65, 0x61,
+    0x64, 0x79, 0x2E, 0x20, 0x41, 0x66, 0x74, 0x65, 0x72, 0x20,
+    0x70, 0x72, 0x69, 0x6E, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x61,
+    0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2C,
+    0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x6C, 0x69, 0x6E, 0x65,
+    0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72,
+    0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x65,
+    0x64, 0x2E, 0x20, 0x55, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F, 0x66, 0x20,
+    0x28, 0x64, 0x79, 0x6E, 0x20, 0x3A, 0x6F, 0x75, 0x74, 0x20,
+    0x73, 0x74, 0x64, 0x6F, 0x75, 0x74, 0x29, 0x20, 0x74, 0x6F,
+    0x20, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6D, 0x69, 0x6E, 0x65,
+    0x20, 0x77, 0x68, 0x61, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x70,
+    0x75, 0x73, 0x68, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63,
+    0x74, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6F, 0x2E, 0x20, 0x45,
+    0x78, 0x70, 0x65, 0x63, 0x74, 0x73, 0x20, 0x28, 0x64, 0x79,
+    0x6E, 0x20, 0x3A, 0x6F, 0x75, 0x74, 0x20, 0x73, 0x74, 0x64,
+    0x6F, 0x75, 0x74, 0x29, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65,
+    0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x61, 0x20,
+    0x63, 0x6F, 0x72, 0x65, 0x2F, 0x66, 0x69, 0x6C, 0x65, 0x20,
+    0x6F, 0x72, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x6E, 0x69, 0x6C, 0x2E, 0xCF, 0x11, 0x74, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x2F, 0x73, 0x77, 0x61, 0x70, 0x2D, 0x62,
+    0x79, 0x74, 0x65, 0x73, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x11,
+    0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x73, 0x77, 0x61,
+    0x70, 0x2D, 0x62, 0x79, 0x74, 0x65, 0x73, 0xDA, 0x05, 0xCE,
+    0x80, 0xAE, 0x28, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+    0x73, 0x77, 0x61, 0x70, 0x2D, 0x62, 0x79, 0x74, 0x65, 0x73,
+    0x20, 0x73, 0x72, 0x63, 0x20, 0x73, 0x69, 0x6E, 0x64, 0x65,
+    0x78, 0x20, 0x64, 0x73, 0x74, 0x20, 0x64, 0x69, 0x6E, 0x64,
+    0x65, 0x78, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x63, 0x6F,
+    0x75, 0x6E, 0x74, 0x29, 0x0A, 0x0A, 0x53, 0x77, 0x61, 0x70,
+    0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x65, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x28, 0x64, 0x65, 0x66,
+    0x61, 0x75, 0x6C, 0x74, 0x20, 0x31, 0x29, 0x20, 0x62, 0x65,
+    0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x73, 0x72, 0x63, 0x20,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+    0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x73, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x64, 0x73,
+    0x74, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x61, 0x74,
+    0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x64, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x6D, 0x65, 0x6D,
+    0x6F, 0x72, 0x79, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x6F, 0x76,
+    0x65, 0x72, 0x6C, 0x61, 0x70, 0x2E, 0xCF, 0x04, 0x64, 0x72,
+    0x6F, 0x70, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x83, 0x16, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x98,
+    0x00, 0x00, 0x0A, 0x02, 0x02, 0x02, 0x05, 0x16, 0xCE, 0x04,
+    0x64, 0x72, 0x6F, 0x70, 0xDA, 0x12, 0xDA, 0x1A, 0xDA, 0x81,
+    0xCD, 0xDA, 0x80, 0xA1, 0xDA, 0x81, 0x30, 0xD7, 0xCD, 0x02,
+    0x99, 0x00, 0x00, 0x03, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x02, 0x05, 0xCE, 0x03, 0x6D, 0x61, 0x78, 0xDA, 0x12,
+    0xD7, 0xCD, 0x00, 0x09, 0x00, 0x1A, 0x06, 0x00, 0x00, 0xCD,
+    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 0xCE, 0x01, 0x3E, 0x39,
+    0x01, 0x00, 0x00, 0x1E, 0x02, 0x01, 0x02, 0x19, 0x02, 0x0A,
+    0x00, 0x37, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x34,
+    0x04, 0x00, 0x05, 0x43, 0x02, 0x03, 0x04, 0x1A, 0x02, 0x07,
+    0x00, 0x05, 0x05, 0x05, 0x01, 0x17, 0x03, 0x04, 0x00, 0x1F,
+    0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x23, 0x03, 0x00,
+    0x00, 0x03, 0x03, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0xDA, 0x81, 0x2F, 0x28, 0x01, 0x00, 0x00,
+    0x26, 0x02, 0x00, 0x00, 0x2C, 0x02, 0x00, 0x00, 0x26, 0x02,
+    0x01, 0x00, 0x30, 0x02, 0x00, 0x00, 0x07, 0x01, 0x8C, 0x09,
+    0x02, 0x04, 0x04, 0x16, 0x28, 0x02, 0x00, 0x00, 0x2B, 0x01,
+    0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x03, 0x04, 0x00,
+    0x17, 0x04, 0x03, 0x00, 0x1A, 0x04, 0x03, 0x00, 0x26, 0x05,
+    0x01, 0x00, 0x18, 0x02, 0x00, 0x00, 0x26, 0x05, 0x02, 0x00,
+    0x17, 0x06, 0x05, 0x00, 0x39, 0x07, 0x01, 0x00, 0x2C, 0x00,
+    0x07, 0x00, 0x26, 0x09, 0x03, 0x00, 0x2F, 0x08, 0x09, 0x00,
+    0x25, 0x07, 0x00, 0x00, 0x2C, 0x07, 0x08, 0x00, 0x26, 0x09,
+    0x04, 0x00, 0x2F, 0x07, 0x09, 0x00, 0x17, 0x08, 0x07, 0x00,
+    0x25, 0x09, 0xFF, 0xFF, 0x2D, 0x01, 0x08, 0x09, 0x30, 0x06,
+    0x00, 0x00, 0x1F, 0x01, 0xAC, 0x0C, 0x02, 0x03, 0x06, 0x1E,
+    0x01, 0x00, 0x19, 0x04, 0x02, 0x0E, 0x01, 0x00, 0x0D, 0x01,
+    0x04, 0x32, 0x03, 0x00, 0x0D, 0x04, 0x00, 0x0D, 0x01, 0x00,
+    0x15, 0x03, 0x02, 0x00, 0xDA, 0x05, 0xCE, 0x55, 0x28, 0x64,
+    0x72, 0x6F, 0x70, 0x20, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x29,
+    0x0A, 0x0A, 0x44, 0x72, 0x6F, 0x70, 0x20, 0x66, 0x69, 0x72,
+    0x73, 0x74, 0x20, 0x6E, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E, 0x20,
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x74, 0x79,
+    0x70, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x69, 0x6E, 0x64, 0x65,
+    0x78, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E,
+    0x63, 0x65, 0x2E, 0xCF, 0x0A, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x72, 0x2F, 0x65, 0x6F, 0x66, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x0A, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x65, 0x6F,
+    0x66, 0xDA, 0x05, 0xCE, 0x76, 0x28, 0x70, 0x61, 0x72, 0x73,
+    0x65, 0x72, 0x2F, 0x65, 0x6F, 0x66, 0x20, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x49, 0x6E, 0x64, 0x69,
+    0x63, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66,
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x77, 0x61, 0x73, 0x20,
+    0x72, 0x65, 0x61, 0x63, 0x68, 0x65, 0x64, 0x20, 0x74, 0x6F,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x72, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x70, 0x75,
+    0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x3A, 0x64, 0x65, 0x61, 0x64, 0x20, 0x73, 0x74, 0x61,
+    0x74, 0x65, 0x2E, 0xCF, 0x0C, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x72, 0x2F, 0x77, 0x68, 0x65, 0x72, 0x65, 0xD3, 0x02, 0xDA,
+    0x03, 0xD8, 0x0C, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F,
+    0x77, 0x68, 0x65, 0x72, 0x65, 0xDA, 0x05, 0xCE, 0x61, 0x28,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x77, 0x68, 0x65,
+    0x72, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+    0x74, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x6E, 0x75, 0x6D,
+    0x62, 0x65, 0x72, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x6F,
+    0x6C, 0x75, 0x6D, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x27, 0x73,
+    0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61, 0x6C, 0x20,
+    0x73, 0x74, 0x61, 0x74, 0x65, 0x2E, 0xCF, 0x0D, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x2F, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+    0x74, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x74, 0xDA, 0x05,
+    0xCE, 0x35, 0x28, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x63,
+    0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x6C, 0x79,
+    0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x2E, 0xCF, 0x05, 0x64, 0x65, 0x65,
+    0x70, 0x3D, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x05, 0x64, 0x65,
+    0x65, 0x70, 0x3D, 0xDA, 0x05, 0xCE, 0x80, 0xBE, 0x28, 0x64,
+    0x65, 0x65, 0x70, 0x3D, 0x20, 0x78, 0x20, 0x79, 0x29, 0x0A,
+    0x0A, 0x4C, 0x69, 0x6B, 0x65, 0x20, 0x3D, 0x2C, 0x20, 0x62,
+    0x75, 0x74, 0x20, 0x6D, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x28, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x73, 0x2C, 0x20, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x73, 0x2C, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x73, 0x29, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E,
+    0x73, 0x69, 0x64, 0x65, 0x72, 0x65, 0x64, 0x20, 0x65, 0x71,
+    0x75, 0x61, 0x6C, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x79, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x69, 0x64, 0x65,
+    0x6E, 0x74, 0x69, 0x63, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x20, 0x44, 0x69,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x72, 0x79, 0x20, 0x6B,
+    0x65, 0x79, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F,
+    0x6D, 0x70, 0x61, 0x72, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x3D, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F,
+    0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+    0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x2E, 0xCF, 0x09,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x6F, 0x70, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x09, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2F, 0x70, 0x6F, 0x70, 0xDA, 0x05, 0xCE, 0x80, 0x86, 0x28,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x6F, 0x70, 0x20,
+    0x61, 0x72, 0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x6D, 0x6F,
+    0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73,
+    0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+    0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x20, 0x69, 0x74, 0x2E, 0x20, 0x49, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x20, 0x69, 0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2C,
+    0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0x20, 0x4D, 0x6F,
+    0x64, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2E, 0xCF, 0x02, 0x70, 0x70, 0xD3, 0x03, 0xDA,
+    0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x84, 0x8C, 0x01, 0xDA,
+    0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x04, 0x01, 0x01,
+    0x01, 0x04, 0x09, 0xCE, 0x02, 0x70, 0x70, 0xDA, 0x12, 0xD0,
+    0x0D, 0x70, 0x72, 0x65, 0x74, 0x74, 0x79, 0x2D, 0x66, 0x6F,
+    0x72, 0x6D, 0x61, 0x74, 0xCE, 0x02, 0x25, 0x71, 0xDA, 0x80,
+    0x94, 0xD8, 0x06, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x28,
+    0x01, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x26, 0x03, 0x01,
+    0x00, 0x2C, 0x02, 0x03, 0x00, 0x26, 0x03, 0x02, 0x00, 0x2F,
+    0x02, 0x03, 0x00, 0x2C, 0x02, 0x00, 0x00, 0x26, 0x03, 0x03,
+    0x00, 0x30, 0x03, 0x00, 0x00, 0x0A, 0x01, 0x98, 0x12, 0x02,
+    0x05, 0x06, 0x14, 0x03, 0x00, 0x0F, 0xDA, 0x05, 0xCE, 0x2D,
+    0x28, 0x70, 0x70, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x50, 0x72,
+    0x65, 0x74, 0x74, 0x79, 0x20, 0x70, 0x72, 0x69, 0x6E, 0x74,
+    0x20, 0x74, 0x6F, 0x20, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74,
+    0x20, 0x6F, 0x72, 0x20, 0x28, 0x64, 0x79, 0x6E, 0x20, 0x3A,
+    0x6F, 0x75, 0x74, 0x29, 0x2E, 0xCF, 0x06, 0x73, 0x74, 0x64,
+    0x6F, 0x75, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x06, 0x73,
+    0x74, 0x64, 0x6F, 0x75, 0x74, 0xDA, 0x05, 0xCE, 0x19, 0x54,
+    0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x61, 0x72,
+    0x64, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x66,
+    0x69, 0x6C, 0x65, 0x2E, 0xCF, 0x06, 0x65, 0x70, 0x72, 0x69,
+    0x6E, 0x66, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x06, 0x65, 0x70,
+    0x72, 0x69, 0x6E, 0x66, 0xDA, 0x05, 0xCE, 0x3D, 0x28, 0x65,
+    0x70, 0x72, 0x69, 0x6E, 0x66, 0x20, 0x66, 0x6D, 0x74, 0x20,
+    0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x4C, 0x69, 0x6B,
+    0x65, 0x20, 0x65, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0x20,
+    0x62, 0x75, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6E,
+    0x6F, 0x20, 0x74, 0x72, 0x61, 0x69, 0x6C, 0x69, 0x6E, 0x67,
+    0x20, 0x6E, 0x65, 0x77, 0x6C, 0x69, 0x6E, 0x65, 0x2E, 0xCF,
+    0x05, 0x64, 0x65, 0x62, 0x75, 0x67, 0xD3, 0x02, 0xDA, 0x03,
+    0xD7, 0xCD, 0x00, 0x08, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01,
+    0x00, 0x02, 0xCE, 0x05, 0x64, 0x65, 0x62, 0x75, 0x67, 0x32,
+    0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0xDA, 0x05, 0xCE,
+    0x80, 0xAD, 0x28, 0x64, 0x65, 0x62, 0x75, 0x67, 0x20, 0x26,
+    0x6F, 0x70, 0x74, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x54, 0x68,
+    0x72, 0x6F, 0x77, 0x73, 0x20, 0x61, 0x20, 0x64, 0x65, 0x62,
+    0x75, 0x67, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62,
+    0x65, 0x20, 0x63, 0x61, 0x75, 0x67, 0x68, 0x74, 0x20, 0x62,
+    0x79, 0x20, 0x61, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74,
+    0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x69,
+    0x6E, 0x73, 0x70, 0x65, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x73,
+    0x74, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65,
+    0x64, 0x20, 0x69, 0x6E, 0x20, 0x62, 0x79, 0x20, 0x72, 0x65,
+    0x73, 0x75, 0x6D, 0x65, 0x2E, 0xCF, 0x09, 0x77, 0x69, 0x74,
+    0x68, 0x2D, 0x64, 0x79, 0x6E, 0x73, 0xD3, 0x04, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x83, 0xBC, 0x01, 0xDA, 0x03,
+    0xD7, 0xCD, 0x02, 0x99, 0x00, 0x00, 0x0C, 0x01, 0x01, 0xCD,
+    0x7F, 0xFF, 0xFF, 0xFF, 0x06, 0x27, 0xCE, 0x09, 0x77, 0x69,
+    0x74, 0x68, 0x2D, 0x64, 0x79, 0x6E, 0x73, 0xDA, 0x12, 0xCF,
+    0x06, 0x73, 0x65, 0x74, 0x64, 0x79, 0x6E, 0xDA, 0x81, 0x1B,
+    0xDA, 0x80, 0x87, 0xDA, 0x80, 0xB5, 0xD0, 0x01, 0x70, 0xD7,
+    0xCD, 0x00, 0x08, 0x00, 0x05, 0x02, 0x02, 0x01, 0x02, 0x00,
+    0x02, 0xCE, 0x06, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x31,
+    0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x28, 0x02, 0x00,
+    0x00, 0x3A, 0x03, 0x00, 0x00, 0x17, 0x04, 0x03, 0x00, 0x25,
+    0x03, 0x00, 0x00, 0x39, 0x05, 0x00, 0x00, 0x17, 0x06, 0x05,
+    0x00, 0x41, 0x05, 0x03, 0x06, 0x1A, 0x05, 0x11, 0x00, 0x17,
+    0x07, 0x03, 0x00, 0x2B, 0x07, 0x00, 0x00, 0x2F, 0x08, 0x00,
+    0x00, 0x25, 0x0A, 0x01, 0x00, 0x06, 0x09, 0x07, 0x0A, 0x2B,
+    0x09, 0x00, 0x00, 0x2F, 0x0A, 0x00, 0x00, 0x26, 0x0B, 0x00,
+    0x00, 0x2D, 0x0B, 0x08, 0x0A, 0x3F, 0x09, 0x00, 0x00, 0x2C,
+    0x04, 0x09, 0x00, 0x26, 0x0A, 0x01, 0x00, 0x2F, 0x08, 0x0A,
+    0x00, 0x25, 0x08, 0x02, 0x00, 0x06, 0x03, 0x03, 0x08, 0x18,
+    0xEF, 0xFF, 0xFF, 0x17, 0x03, 0x04, 0x00, 0x40, 0x05, 0x00,
+    0x00, 0x26, 0x07, 0x02, 0x00, 0x2C, 0x07, 0x05, 0x00, 0x2E,
+    0x03, 0x00, 0x00, 0x2E, 0x01, 0x00, 0x00, 0x3F, 0x06, 0x00,
+    0x00, 0x26, 0x07, 0x03, 0x00, 0x26, 0x08, 0x04, 0x00, 0x2D,
+    0x07, 0x06, 0x08, 0x3F, 0x05, 0x00, 0x00, 0x26, 0x07, 0x05,
+    0x00, 0x2C, 0x07, 0x05, 0x00, 0x3F, 0x06, 0x00, 0x00, 0x03,
+    0x06, 0x00, 0x00, 0x1F, 0x01, 0xF8, 0x0E, 0x02, 0x03, 0x0E,
+    0x08, 0x01, 0x00, 0x24, 0x04, 0x00, 0x23, 0x02, 0x02, 0x0A,
+    0x02, 0x00, 0x44, 0x05, 0x00, 0x43, 0x06, 0x01, 0x09, 0x01,
+    0x01, 0x03, 0x0E, 0x06, 0x00, 0xDA, 0x24, 0xCB, 0xDA, 0x05,
+    0xCE, 0x80, 0xE7, 0x28, 0x77, 0x69, 0x74, 0x68, 0x2D, 0x64,
+    0x79, 0x6E, 0x73, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x73, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29,
+    0x0A, 0x0A, 0x52, 0x75, 0x6E, 0x20, 0x61, 0x20, 0x62, 0x6C,
+    0x6F, 0x63, 0x6B, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x6F, 0x64,
+    0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77,
+    0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x68, 0x61, 0x73, 0x20, 0x73, 0x6F, 0x6D, 0x65,
+    0x20, 0x20, 0x64, 0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x20,
+    0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x73,
+    0x65, 0x74, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E,
+    0x6F, 0x74, 0x20, 0x6D, 0x61, 0x73, 0x6B, 0x20, 0x65, 0x72,
+    0x72, 0x6F, 0x72, 0x73, 0x20, 0x20, 0x6F, 0x72, 0x20, 0x73,
+    0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73, 0x2C, 0x20, 0x62, 0x75,
+    0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x79, 0x6E, 0x61,
+    0x6D, 0x69, 0x63, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65,
+    0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x6C, 0x79, 0x20,
+    0x20, 0x75, 0x6E, 0x73, 0x65, 0x74, 0x2C, 0x20, 0x61, 0x73,
+    0x20, 0x64, 0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x20, 0x62,
+    0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x61, 0x72,
+    0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x6C, 0x6F,
+    0x63, 0x61, 0x6C, 0x2E, 0xCF, 0x07, 0x67, 0x63, 0x6C, 0x69,
+    0x6D, 0x69, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x07, 0x67,
+    0x63, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0xDA, 0x05, 0xCE, 0x58,
+    0x28, 0x67, 0x63, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x70, 0x20, 0x6C, 0x69,
+    0x6D, 0x69, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x67, 0x63, 0x73, 0x65, 0x74, 0x6C, 0x69, 0x6D,
+    0x69, 0x74, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x6E, 0x69, 0x6C,
+    0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20,
+    0x69, 0x73, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x2E, 0xCF, 0x0B,
+    0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x6C, 0x69, 0x63,
+    0x65, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x80, 0xA1, 0xDA, 0x05,
+    0xCE, 0x81, 0xC0, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F,
+    0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x61, 0x72, 0x72, 0x74,
+    0x75, 0x70, 0x20, 0x5B, 0x2C, 0x73, 0x74, 0x61, 0x72, 0x74,
+    0x3D, 0x30, 0x20, 0x5B, 0x2C, 0x65, 0x6E, 0x64, 0x3D, 0x28,
+    0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x61, 0x72, 0x72,
+    0x74, 0x75, 0x70, 0x29, 0x5D, 0x5D, 0x29, 0x0A, 0x0A, 0x54,
+    0x61, 0x6B, 0x65, 0x20, 0x61, 0x20, 0x73, 0x75, 0x62, 0x20,
+    0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x20, 0x6F, 0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78,
+    0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x69, 0x6E, 0x63,
+    0x6C, 0x75, 0x73, 0x69, 0x76, 0x65, 0x20, 0x74, 0x6F, 0x20,
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x65, 0x6E, 0x64, 0x20,
+    0x65, 0x78, 0x63, 0x6C, 0x75, 0x73, 0x69, 0x76, 0x65, 0x2E,
+    0x20, 0x49, 0x66, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20,
+    0x6F, 0x72, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x61, 0x72, 0x65,
+    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69,
+    0x64, 0x65, 0x64, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20,
+    0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x74, 0x6F,
+    0x20, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x6F, 0x66,
+    0x20, 0x61, 0x72, 0x72, 0x74, 0x75, 0x70, 0x20, 0x72, 0x65,
+    0x73, 0x70, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x6C, 0x79,
+    0x2E, 0x20, 0x27, 0x73, 0x74, 0x61, 0x72, 0x74, 0x27, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x27, 0x65, 0x6E, 0x64, 0x27, 0x20,
+    0x63, 0x61, 0x6E, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x62,
+    0x65, 0x20, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65,
+    0x20, 0x74, 0x6F, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x61,
+    0x74, 0x65, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x69, 0x6E,
+    0x67, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2E, 0x20, 0x4E,
+    0x6F, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0x20, 0x2D, 0x31, 0x20, 0x69, 0x73,
+    0x20, 0x73, 0x79, 0x6E, 0x6F, 0x6E, 0x79, 0x6D, 0x6F, 0x75,
+    0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x6E, 0x64,
+    0x65, 0x78, 0x20, 0x27, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74,
+    0x68, 0x20, 0x61, 0x72, 0x72, 0x74, 0x75, 0x70, 0x29, 0x27,
+    0x20, 0x74, 0x6F, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x20,
+    0x61, 0x20, 0x66, 0x75, 0x6C, 0x6C, 0x20, 0x6E, 0x65, 0x67,
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x73, 0x6C, 0x69, 0x63,
+    0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65,
+    0x2E, 0xCF, 0x08, 0x6F, 0x73, 0x2F, 0x73, 0x68, 0x65, 0x6C,
+    0x6C, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x08, 0x6F, 0x73, 0x2F,
+    0x73, 0x68, 0x65, 0x6C, 0x6C, 0xDA, 0x05, 0xCE, 0x47, 0x28,
+    0x6F, 0x73, 0x2F, 0x73, 0x68, 0x65, 0x6C, 0x6C, 0x20, 0x73,
+    0x74, 0x72, 0x29, 0x0A, 0x0A, 0x50, 0x61, 0x73, 0x73, 0x20,
+    0x61, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x72,
+    0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6C, 0x79, 0x20,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x73,
+    0x74, 0x65, 0x6D, 0x20, 0x73, 0x68, 0x65, 0x6C, 0x6C, 0x2E,
+    0xCF, 0x0B, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x66, 0x69, 0x6C,
+    0x65, 0x6E, 0x6F, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x66,
+    0x69, 0x6C, 0x65, 0x2F, 0x66, 0x69, 0x6C, 0x65, 0x6E, 0x6F,
+    0xDA, 0x05, 0xCE, 0x80, 0x80, 0x28, 0x66, 0x69, 0x6C, 0x65,
+    0x2F, 0x66, 0x69, 0x6C, 0x65, 0x6E, 0x6F, 0x20, 0x66, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x75, 0x6E, 0x64, 0x65, 0x72, 0x6C, 0x79,
+    0x69, 0x6E, 0x67, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x64,
+    0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x20,
+    0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x75,
+    0x6D, 0x62, 0x65, 0x72, 0x2E, 0x54, 0x68, 0x65, 0x20, 0x6D,
+    0x65, 0x61, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x69, 0x73, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+    0x72, 0x20, 0x69, 0x73, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x66,
+    0x6F, 0x72, 0x6D, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66,
+    0x69, 0x63, 0x2E, 0xCF, 0x06, 0x66, 0x61, 0x6C, 0x73, 0x65,
+    0x3F, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x6C, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00,
+    0x04, 0x01, 0x01, 0x01, 0x00, 0x04, 0xCE, 0x06, 0x66, 0x61,
+    0x6C, 0x73, 0x65, 0x3F, 0xDA, 0x12, 0x28, 0x01, 0x00, 0x00,
+    0x24, 0x03, 0x00, 0x00, 0x1F, 0x02, 0x00, 0x03, 0x03, 0x02,
+    0x00, 0x00, 0x07, 0x01, 0xD8, 0x01, 0x02, 0x03, 0x00, 0x50,
+    0xDA, 0x05, 0xCE, 0x20, 0x28, 0x66, 0x61, 0x6C, 0x73, 0x65,
+    0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63,
+    0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20,
+    0x66, 0x61, 0x6C, 0x73, 0x65, 0x2E, 0xCF, 0x11, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x72, 0x6F, 0x6D, 0x2D,
+    0x62, 0x79, 0x74, 0x65, 0x73, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x11, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x72,
+    0x6F, 0x6D, 0x2D, 0x62, 0x79, 0x74, 0x65, 0x73, 0xDA, 0x05,
+    0xCE, 0x80, 0x92, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x2F, 0x66, 0x72, 0x6F, 0x6D, 0x2D, 0x62, 0x79, 0x74, 0x65,
+    0x73, 0x20, 0x26, 0x20, 0x62, 0x79, 0x74, 0x65, 0x2D, 0x76,
+    0x61, 0x6C, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61,
+    0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x69, 0x6E,
+    0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x70, 0x61, 0x72, 0x61,
+    0x6D, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x62, 0x79,
+    0x74, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E,
+    0x20, 0x41, 0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67,
+    0x65, 0x72, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62,
+    0x65, 0x20, 0x63, 0x6F, 0x65, 0x72, 0x63, 0x65, 0x64, 0x20,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x61, 0x6E,
+    0x67, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x31, 0x20, 0x62, 0x79,
+    0x74, 0x65, 0x20, 0x30, 0x2D, 0x32, 0x35, 0x35, 0x2E, 0xCF,
+    0x0B, 0x65, 0x76, 0x61, 0x6C, 0x2D, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x86, 0xE7, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0xBA,
+    0x00, 0x00, 0x0D, 0x01, 0x01, 0x01, 0x0A, 0x1C, 0x04, 0xCE,
+    0x0B, 0x65, 0x76, 0x61, 0x6C, 0x2D, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0xDA, 0x12, 0xDA, 0x81, 0x5A, 0xD0, 0x0E, 0x6F,
+    0x6E, 0x2D, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2D, 0x65, 0x72,
+    0x72, 0x6F, 0x72, 0xD0, 0x06, 0x63, 0x68, 0x75, 0x6E, 0x6B,
+    0x73, 0xD0, 0x09, 0x6F, 0x6E, 0x2D, 0x73, 0x74, 0x61, 0x74,
+    0x75, 0x73, 0xD0, 0x06, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65,
+    0xDA, 0x82, 0x97, 0xD0, 0x0B, 0x66, 0x69, 0x62, 0x65, 0x72,
+    0x2D, 0x66, 0x6C, 0x61, 0x67, 0x73, 0xD0, 0x01, 0x69, 0xD0,
+    0x10, 0x6F, 0x6E, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C,
+    0x65, 0x2D, 0x65, 0x72, 0x72, 0x6F, 0x72, 0xD7, 0xCD, 0x02,
+    0xBA, 0x00, 0x00, 0x27, 0x01, 0x01, 0x01, 0x1B, 0x80, 0xA8,
+    0x03, 0xCE, 0x0B, 0x72, 0x75, 0x6E, 0x2D, 0x63, 0x6F, 0x6E,
+    0x74, 0x65, 0x78, 0x74, 0xDA, 0x12, 0xDA, 0x82, 0x98, 0xDA,
+    0x82, 0x9C, 0xD0, 0x03, 0x65, 0x6E, 0x76, 0xDA, 0x82, 0x9E,
+    0xDA, 0x82, 0x99, 0xDA, 0x82, 0x9A, 0xDA, 0x82, 0x9B, 0xD0,
+    0x09, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x6F, 0x72,
+    0xD0, 0x08, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x65, 0x72,
+    0xDA, 0x81, 0x74, 0xDA, 0x80, 0xDA, 0xD8, 0x10, 0x64, 0x65,
+    0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x74,
+    0x72, 0x61, 0x63, 0x65, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00,
+    0x0A, 0x03, 0x03, 0x03, 0x09, 0x19, 0xCE, 0x0B, 0x62, 0x61,
+    0x64, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0xDA,
+    0x12, 0xD0, 0x09, 0x65, 0x72, 0x72, 0x2D, 0x63, 0x6F, 0x6C,
+    0x6F, 0x72, 0xDA, 0x80, 0x94, 0xCE, 0x05, 0x1B, 0x5B, 0x33,
+    0x31, 0x6D, 0xDA, 0x80, 0xF8, 0xCE, 0x04, 0x1B, 0x5B, 0x30,
+    0x6D, 0xCE, 0x0F, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65,
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x3A, 0x20, 0xCE, 0x11,
+    0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x6F, 0x6D,
+    0x70, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0xD8, 0x06, 0x65,
+    0x70, 0x72, 0x69, 0x6E, 0x74, 0xDA, 0x82, 0xA3, 0x28, 0x03,
+    0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00,
+    0x26, 0x05, 0x01, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x17, 0x05,
+    0x04, 0x00, 0x1A, 0x05, 0x03, 0x00, 0x26, 0x06, 0x02, 0x00,
+    0x18, 0x02, 0x00, 0x00, 0x26, 0x06, 0x03, 0x00, 0x1A, 0x05,
+    0x03, 0x00, 0x26, 0x07, 0x04, 0x00, 0x18, 0x02, 0x00, 0x00,
+    0x26, 0x07, 0x03, 0x00, 0x26, 0x08, 0x05, 0x00, 0x2D, 0x06,
+    0x08, 0x00, 0x26, 0x08, 0x06, 0x00, 0x2D, 0x08, 0x02, 0x07,
+    0x26, 0x09, 0x07, 0x00, 0x2F, 0x08, 0x09, 0x00, 0x1A, 0x01,
+    0x04, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x06, 0x08, 0x00,
+    0x30, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1C, 0x01,
+    0xEE, 0x19, 0x02, 0x04, 0x06, 0x14, 0x01, 0x00, 0x0F, 0x04,
+    0x04, 0x04, 0x04, 0x0A, 0x00, 0x06, 0x0B, 0x03, 0x01, 0x0E,
+    0x00, 0x03, 0x00, 0x1A, 0x01, 0x00, 0x19, 0xD7, 0xCD, 0x02,
+    0x98, 0x00, 0x00, 0x0F, 0x02, 0x02, 0x02, 0x0D, 0x28, 0xCE,
+    0x09, 0x62, 0x61, 0x64, 0x2D, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0xDA, 0x12, 0xDA, 0x82, 0xA5, 0xDA, 0x80, 0x94, 0xDA, 0x82,
+    0x4E, 0xDA, 0x82, 0xA6, 0xDA, 0x80, 0xF8, 0xDA, 0x81, 0x5A,
+    0xD8, 0x0C, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x65,
+    0x72, 0x72, 0x6F, 0x72, 0xDA, 0x82, 0xA7, 0xCE, 0x0F, 0x70,
+    0x61, 0x72, 0x73, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+    0x20, 0x69, 0x6E, 0x20, 0xCE, 0x0D, 0x20, 0x61, 0x72, 0x6F,
+    0x75, 0x6E, 0x64, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0xCE,
+    0x09, 0x2C, 0x20, 0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x20,
+    0xCE, 0x02, 0x3A, 0x20, 0xDA, 0x82, 0xAA, 0x28, 0x02, 0x00,
+    0x00, 0x26, 0x03, 0x00, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x26,
+    0x04, 0x01, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x17, 0x04, 0x03,
+    0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x06, 0x02, 0x00, 0x2F,
+    0x05, 0x06, 0x00, 0x37, 0x06, 0x05, 0x00, 0x17, 0x07, 0x06,
+    0x00, 0x37, 0x06, 0x05, 0x01, 0x17, 0x08, 0x06, 0x00, 0x1A,
+    0x04, 0x03, 0x00, 0x26, 0x06, 0x03, 0x00, 0x18, 0x02, 0x00,
+    0x00, 0x26, 0x06, 0x04, 0x00, 0x2B, 0x07, 0x00, 0x00, 0x26,
+    0x0A, 0x05, 0x00, 0x2F, 0x09, 0x0A, 0x00, 0x2B, 0x08, 0x00,
+    0x00, 0x26, 0x0B, 0x05, 0x00, 0x2F, 0x0A, 0x0B, 0x00, 0x2B,
+    0x00, 0x00, 0x00, 0x26, 0x0C, 0x06, 0x00, 0x2F, 0x0B, 0x0C,
+    0x00, 0x1A, 0x04, 0x03, 0x00, 0x26, 0x0C, 0x07, 0x00, 0x18,
+    0x02, 0x00, 0x00, 0x26, 0x0C, 0x04, 0x00, 0x26, 0x0D, 0x08,
+    0x00, 0x2D, 0x06, 0x0D, 0x01, 0x26, 0x0D, 0x09, 0x00, 0x26,
+    0x0E, 0x0A, 0x00, 0x2D, 0x0D, 0x09, 0x0E, 0x26, 0x0D, 0x0B,
+    0x00, 0x2D, 0x0A, 0x0D, 0x0B, 0x2B, 0x0C, 0x00, 0x00, 0x26,
+    0x0D, 0x0C, 0x00, 0x30, 0x0D, 0x00, 0x00, 0x22, 0x01, 0xCC,
+    0x19, 0x02, 0x04, 0x06, 0x14, 0x01, 0x00, 0x0F, 0x03, 0x02,
+    0x20, 0x04, 0x00, 0x1F, 0x04, 0x04, 0x04, 0x03, 0x08, 0x00,
+    0x03, 0x04, 0x00, 0x03, 0x04, 0x00, 0x04, 0x02, 0x00, 0x0A,
+    0x13, 0x03, 0xCE, 0x0B, 0x3C, 0x61, 0x6E, 0x6F, 0x6E, 0x79,
+    0x6D, 0x6F, 0x75, 0x73, 0x3E, 0xD8, 0x0A, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0xDA, 0x80, 0xF8,
+    0xD0, 0x04, 0x65, 0x78, 0x69, 0x74, 0xDA, 0x80, 0xFE, 0xDA,
+    0x82, 0x4A, 0xDA, 0x81, 0xAE, 0xD8, 0x0F, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x72, 0x2F, 0x68, 0x61, 0x73, 0x2D, 0x6D, 0x6F,
+    0x72, 0x65, 0xD8, 0x0E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x2F, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x65, 0xD8, 0x0D,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x73, 0x74, 0x61,
+    0x74, 0x75, 0x73, 0xDA, 0x81, 0x76, 0xD0, 0x0A, 0x65, 0x78,
+    0x69, 0x74, 0x2D, 0x76, 0x61, 0x6C, 0x75, 0x65, 0xDA, 0x67,
+    0x28, 0x01, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x34, 0x02,
+    0x00, 0x03, 0x17, 0x03, 0x02, 0x00, 0x26, 0x04, 0x01, 0x00,
+    0x34, 0x02, 0x00, 0x04, 0x17, 0x04, 0x02, 0x00, 0x26, 0x05,
+    0x02, 0x00, 0x34, 0x02, 0x00, 0x05, 0x17, 0x05, 0x02, 0x00,
+    0x26, 0x06, 0x03, 0x00, 0x34, 0x02, 0x00, 0x06, 0x17, 0x06,
+    0x02, 0x00, 0x26, 0x07, 0x04, 0x00, 0x34, 0x02, 0x00, 0x07,
+    0x17, 0x07, 0x02, 0x00, 0x26, 0x08, 0x05, 0x00, 0x34, 0x02,
+    0x00, 0x08, 0x17, 0x08, 0x02, 0x00, 0x26, 0x09, 0x06, 0x00,
+    0x34, 0x02, 0x00, 0x09, 0x17, 0x09, 0x02, 0x00, 0x26, 0x0A,
+    0x07, 0x00, 0x34, 0x02, 0x00, 0x0A, 0x17, 0x0A, 0x02, 0x00,
+    0x26, 0x0B, 0x08, 0x00, 0x34, 0x02, 0x00, 0x0B, 0x17, 0x0B,
+    0x02, 0x00, 0x22, 0x0D, 0x00, 0x00, 0x1F, 0x0C, 0x0D, 0x05,
+    0x1A, 0x0C, 0x08, 0x00, 0x26, 0x0E, 0x09, 0x00, 0x2F, 0x0D,
+    0x0E, 0x00, 0x2B, 0x0D, 0x00, 0x00, 0x26, 0x0F, 0x0A, 0x00,
+    0x2F, 0x0E, 0x0F, 0x00, 0x17, 0x02, 0x0E, 0x00, 0x18, 0x02,
+    0x00, 0x00, 0x17, 0x02, 0x05, 0x00, 0x17, 0x0C, 0x02, 0x00,
+    0x22, 0x0F, 0x00, 0x00, 0x1F, 0x0E, 0x0F, 0x07, 0x1A, 0x0E,
+    0x04, 0x00, 0x2A, 0x0F, 0x00, 0x00, 0x17, 0x0D, 0x0F, 0x00,
+    0x18, 0x02, 0x00, 0x00, 0x17, 0x0D, 0x07, 0x00, 0x17, 0x0E,
+    0x0D, 0x00, 0x22, 0x11, 0x00, 0x00, 0x1F, 0x10, 0x11, 0x08,
+    0x1A, 0x10, 0x03, 0x00, 0x26, 0x0F, 0x0B, 0x00, 0x18, 0x02,
+    0x00, 0x00, 0x17, 0x0F, 0x08, 0x00, 0x17, 0x10, 0x0F, 0x00,
+    0x22, 0x13, 0x00, 0x00, 0x1F, 0x12, 0x13, 0x06, 0x1A, 0x12,
+    0x03, 0x00, 0x26, 0x11, 0x0C, 0x00, 0x18, 0x02, 0x00, 0x00,
+    0x17, 0x11, 0x06, 0x00, 0x17, 0x12, 0x11, 0x00, 0x22, 0x15,
+    0x00, 0x00, 0x1F, 0x14, 0x15, 0x03, 0x1A, 0x14, 0x03, 0x00,
+    0x26, 0x13, 0x0D, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x13,
+    0x03, 0x00, 0x17, 0x14, 0x13, 0x00, 0x22, 0x17, 0x00, 0x00,
+    0x1F, 0x16, 0x17, 0x0A, 0x1A, 0x16, 0x04, 0x00, 0x2A, 0x17,
+    0x01, 0x00, 0x17, 0x15, 0x17, 0x00, 0x18, 0x02, 0x00, 0x00,
+    0x17, 0x15, 0x0A, 0x00, 0x17, 0x16, 0x15, 0x00, 0x22, 0x19,
+    0x00, 0x00, 0x1F, 0x18, 0x19, 0x09, 0x1A, 0x18, 0x03, 0x00,
+    0x26, 0x17, 0x0E, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x17,
+    0x09, 0x00, 0x17, 0x18, 0x17, 0x00, 0x23, 0x19, 0x00, 0x00,
+    0x26, 0x1B, 0x0F, 0x00, 0x2F, 0x1A, 0x1B, 0x00, 0x17, 0x1B,
+    0x1A, 0x00, 0x2A, 0x1C, 0x02, 0x00, 0x17, 0x1D, 0x1C, 0x00,
+    0x26, 0x1E, 0x10, 0x00, 0x2B, 0x1E, 0x00, 0x00, 0x3B, 0x1E,
+    0x00, 0x00, 0x17, 0x1F, 0x1E, 0x00, 0x1A, 0x19, 0x33, 0x00,
+    0x26, 0x20, 0x11, 0x00, 0x2B, 0x20, 0x00, 0x00, 0x2F, 0x20,
+    0x0C, 0x00, 0x1A, 0x20, 0x03, 0x00, 0x18, 0x2E, 0x00, 0x00,
+    0x18, 0x01, 0x00, 0x00, 0x2B, 0x1F, 0x00, 0x00, 0x26, 0x21,
+    0x12, 0x00, 0x2F, 0x20, 0x21, 0x00, 0x2C, 0x1F, 0x1B, 0x00,
+    0x2F, 0x20, 0x0E, 0x00, 0x25, 0x20, 0x00, 0x00, 0x22, 0x21,
+    0x00, 0x00, 0x39, 0x22, 0x1F, 0x00, 0x17, 0x23, 0x22, 0x00,
+    0x25, 0x24, 0x00, 0x00, 0x1F, 0x22, 0x23, 0x24, 0x1A, 0x22,
+    0x06, 0x00, 0x2B, 0x1B, 0x00, 0x00, 0x26, 0x25, 0x13, 0x00,
+    0x2F, 0x24, 0x25, 0x00, 0x24, 0x19, 0x00, 0x00, 0x18, 0x01,
+    0x00, 0x00, 0x43, 0x22, 0x23, 0x20, 0x1A, 0x22, 0x19, 0x00,
+    0x2D, 0x1B, 0x1F, 0x20, 0x26, 0x25, 0x14, 0x00, 0x2F, 0x24,
+    0x25, 0x00, 0x06, 0x20, 0x20, 0x24, 0x2B, 0x1B, 0x00, 0x00,
+    0x26, 0x25, 0x15, 0x00, 0x2F, 0x24, 0x25, 0x00, 0x1A, 0x24,
+    0x07, 0x00, 0x2B, 0x1B, 0x00, 0x00, 0x26, 0x26, 0x16, 0x00,
+    0x2F, 0x25, 0x26, 0x00, 0x2B, 0x25, 0x00, 0x00, 0x2F, 0x26,
+    0x1D, 0x00, 0x18, 0xF7, 0xFF, 0xFF, 0x2B, 0x1B, 0x00, 0x00,
+    0x26, 0x25, 0x17, 0x00, 0x2F, 0x24, 0x25, 0x00, 0x26, 0x26,
+    0x18, 0x00, 0x1F, 0x25, 0x24, 0x26, 0x1A, 0x25, 0x04, 0x00,
+    0x2C, 0x1B, 0x18, 0x00, 0x2F, 0x24, 0x14, 0x00, 0x18, 0x01,
+    0x00, 0x00, 0x18, 0xE7, 0xFF, 0xFF, 0x18, 0xCE, 0xFF, 0xFF,
+    0x2B, 0x1B, 0x00, 0x00, 0x26, 0x21, 0x15, 0x00, 0x2F, 0x20,
+    0x21, 0x00, 0x1A, 0x20, 0x07, 0x00, 0x2B, 0x1B, 0x00, 0x00,
+    0x26, 0x22, 0x16, 0x00, 0x2F, 0x21, 0x22, 0x00, 0x2B, 0x21,
+    0x00, 0x00, 0x2F, 0x22, 0x1D, 0x00, 0x18, 0xF7, 0xFF, 0xFF,
+    0x2B, 0x1B, 0x00, 0x00, 0x26, 0x21, 0x17, 0x00, 0x2F, 0x20,
+    0x21, 0x00, 0x26, 0x22, 0x18, 0x00, 0x1F, 0x21, 0x20, 0x22,
+    0x1A, 0x21, 0x04, 0x00, 0x2C, 0x1B, 0x18, 0x00, 0x2F, 0x20,
+    0x14, 0x00, 0x18, 0x01, 0x00, 0x00, 0x26, 0x20, 0x19, 0x00,
+    0x2D, 0x0C, 0x20, 0x0C, 0x26, 0x20, 0x1A, 0x00, 0x30, 0x20,
+    0x00, 0x00, 0xCD, 0x02, 0x90, 0x00, 0x00, 0x03, 0x02, 0x02,
+    0x02, 0x02, 0x04, 0xDA, 0x12, 0xDA, 0x80, 0xF8, 0xD8, 0x07,
+    0x67, 0x65, 0x74, 0x6C, 0x69, 0x6E, 0x65, 0x26, 0x02, 0x00,
+    0x00, 0x2C, 0x02, 0x00, 0x00, 0x26, 0x02, 0x01, 0x00, 0x30,
+    0x02, 0x00, 0x00, 0x04, 0x04, 0xBA, 0x1A, 0x3E, 0xCD, 0x02,
+    0x98, 0x00, 0x00, 0x02, 0x01, 0x01, 0xCD, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x02, 0xCE, 0x08, 0x65, 0x76, 0x61, 0x6C, 0x75,
+    0x61, 0x74, 0x65, 0xDA, 0x12, 0x28, 0x01, 0x00, 0x00, 0x30,
+    0x00, 0x00, 0x00, 0x07, 0x01, 0xC2, 0x1A, 0x2C, 0x01, 0x00,
+    0x26, 0xCD, 0x02, 0xFA, 0x00, 0x00, 0x0E, 0x01, 0x01, 0x01,
+    0x06, 0x3C, 0x01, 0x01, 0xCE, 0x05, 0x65, 0x76, 0x61, 0x6C,
+    0x31, 0xDA, 0x12, 0xD0, 0x01, 0x61, 0xDA, 0x80, 0xB5, 0xD8,
+    0x0C, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x73, 0x65, 0x74,
+    0x65, 0x6E, 0x76, 0xDA, 0x81, 0xDE, 0xD0, 0x04, 0x64, 0x65,
+    0x61, 0x64, 0xDA, 0x81, 0x76, 0x28, 0x01, 0x00, 0x00, 0x27,
+    0x03, 0x00, 0x0B, 0x1A, 0x03, 0x06, 0x00, 0x2B, 0x00, 0x00,
+    0x00, 0x27, 0x04, 0x00, 0x0B, 0x2F, 0x03, 0x04, 0x00, 0x17,
+    0x02, 0x03, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x02, 0x00,
+    0x00, 0x17, 0x03, 0x02, 0x00, 0x23, 0x04, 0x00, 0x00, 0x22,
+    0x05, 0x00, 0x00, 0x2A, 0x06, 0x00, 0x00, 0x27, 0x08, 0x00,
+    0x04, 0x1A, 0x08, 0x03, 0x00, 0x27, 0x07, 0x00, 0x04, 0x18,
+    0x03, 0x00, 0x00, 0x26, 0x08, 0x00, 0x00, 0x17, 0x07, 0x08,
+    0x00, 0x2C, 0x06, 0x07, 0x00, 0x26, 0x09, 0x01, 0x00, 0x2F,
+    0x08, 0x09, 0x00, 0x17, 0x06, 0x08, 0x00, 0x27, 0x07, 0x00,
+    0x0C, 0x2C, 0x06, 0x07, 0x00, 0x26, 0x09, 0x02, 0x00, 0x2F,
+    0x07, 0x09, 0x00, 0x2B, 0x06, 0x00, 0x00, 0x26, 0x0A, 0x03,
+    0x00, 0x2F, 0x09, 0x0A, 0x00, 0x17, 0x0A, 0x09, 0x00, 0x26,
+    0x0C, 0x04, 0x00, 0x1F, 0x0B, 0x0C, 0x0A, 0x19, 0x0B, 0x03,
+    0x00, 0x23, 0x0B, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24,
+    0x0B, 0x00, 0x00, 0x1A, 0x0B, 0x09, 0x00, 0x26, 0x0D, 0x05,
+    0x00, 0x1F, 0x0C, 0x0D, 0x0A, 0x19, 0x0C, 0x03, 0x00, 0x23,
+    0x0C, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x0C, 0x00,
+    0x00, 0x17, 0x09, 0x0C, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22,
+    0x09, 0x00, 0x00, 0x1A, 0x09, 0x0C, 0x00, 0x31, 0x0A, 0x06,
+    0x05, 0x17, 0x0B, 0x0A, 0x00, 0x1A, 0x04, 0x08, 0x00, 0x27,
+    0x0A, 0x00, 0x19, 0x1A, 0x0A, 0x05, 0x00, 0x2C, 0x06, 0x0B,
+    0x00, 0x27, 0x0A, 0x00, 0x10, 0x2F, 0x05, 0x0A, 0x00, 0x18,
+    0x01, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x18, 0xE1, 0xFF,
+    0xFF, 0x04, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x02, 0xD0,
+    0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x0A, 0x33, 0x02, 0xDA,
+    0x12, 0xDA, 0x62, 0xDA, 0x15, 0xDA, 0x81, 0x75, 0xD0, 0x06,
+    0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0xD0, 0x04, 0x6C, 0x69,
+    0x6E, 0x65, 0xD0, 0x05, 0x66, 0x69, 0x62, 0x65, 0x72, 0xDA,
+    0x81, 0x76, 0xCE, 0x09, 0x20, 0x6F, 0x6E, 0x20, 0x6C, 0x69,
+    0x6E, 0x65, 0x20, 0xDA, 0x82, 0xB0, 0xDA, 0x81, 0x5A, 0x27,
+    0x00, 0x00, 0x03, 0x27, 0x01, 0x01, 0x0C, 0x27, 0x02, 0x01,
+    0x18, 0x2D, 0x00, 0x01, 0x02, 0x26, 0x01, 0x00, 0x00, 0x2F,
+    0x00, 0x01, 0x00, 0x17, 0x01, 0x00, 0x00, 0x2B, 0x01, 0x00,
+    0x00, 0x26, 0x03, 0x01, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x26,
+    0x04, 0x02, 0x00, 0x1F, 0x03, 0x02, 0x04, 0x1A, 0x03, 0x08,
+    0x00, 0x27, 0x02, 0x00, 0x03, 0x27, 0x04, 0x01, 0x0C, 0x2D,
+    0x01, 0x02, 0x04, 0x27, 0x02, 0x01, 0x18, 0x2B, 0x02, 0x00,
+    0x00, 0x27, 0x02, 0x01, 0x16, 0x30, 0x02, 0x00, 0x00, 0x24,
+    0x02, 0x00, 0x00, 0x29, 0x02, 0x00, 0x04, 0x26, 0x04, 0x03,
+    0x00, 0x34, 0x02, 0x01, 0x04, 0x17, 0x04, 0x02, 0x00, 0x26,
+    0x05, 0x04, 0x00, 0x34, 0x02, 0x01, 0x05, 0x17, 0x05, 0x02,
+    0x00, 0x26, 0x06, 0x05, 0x00, 0x34, 0x02, 0x01, 0x06, 0x17,
+    0x06, 0x02, 0x00, 0x26, 0x07, 0x06, 0x00, 0x34, 0x02, 0x01,
+    0x07, 0x17, 0x07, 0x02, 0x00, 0x25, 0x09, 0x00, 0x00, 0x42,
+    0x08, 0x09, 0x05, 0x1A, 0x08, 0x09, 0x00, 0x26, 0x09, 0x07,
+    0x00, 0x2D, 0x07, 0x09, 0x05, 0x26, 0x09, 0x08, 0x00, 0x2C,
+    0x09, 0x04, 0x00, 0x26, 0x0A, 0x09, 0x00, 0x2F, 0x09, 0x0A,
+    0x00, 0x17, 0x02, 0x09, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17,
+    0x02, 0x07, 0x00, 0x17, 0x08, 0x02, 0x00, 0x27, 0x02, 0x01,
+    0x18, 0x2D, 0x08, 0x06, 0x02, 0x27, 0x02, 0x01, 0x12, 0x30,
+    0x02, 0x00, 0x00, 0xBF, 0xFF, 0x00, 0x2B, 0x06, 0xE4, 0x1A,
+    0x28, 0x01, 0x00, 0x11, 0x03, 0x02, 0x0E, 0x02, 0x00, 0x05,
+    0x01, 0x00, 0x07, 0x07, 0x02, 0x04, 0x02, 0x04, 0x04, 0x0C,
+    0x02, 0x00, 0x02, 0x04, 0x0C, 0x01, 0x00, 0x07, 0x06, 0x02,
+    0x04, 0x03, 0x01, 0x03, 0x01, 0x01, 0x03, 0x04, 0x08, 0x00,
+    0x52, 0x01, 0xD6, 0x1A, 0x06, 0x02, 0x02, 0x1C, 0x03, 0x00,
+    0x16, 0x03, 0x00, 0x15, 0x01, 0x00, 0x17, 0x01, 0x02, 0x00,
+    0x01, 0x02, 0x00, 0x01, 0x06, 0x08, 0x06, 0x18, 0x00, 0x03,
+    0x19, 0x03, 0x01, 0x01, 0x03, 0x04, 0x1E, 0x00, 0x03, 0x02,
+    0x20, 0x01, 0x00, 0x11, 0x06, 0x02, 0x0E, 0x01, 0x00, 0x09,
+    0x06, 0x00, 0x2A, 0x03, 0x00, 0x29, 0x01, 0x01, 0x11, 0x01,
+    0x04, 0x16, 0x01, 0x00, 0x11, 0x01, 0x02, 0x00, 0x02, 0x00,
+    0x16, 0x03, 0x00, 0x36, 0x01, 0x00, 0x35, 0x01, 0x00, 0x15,
+    0x02, 0x05, 0x03, 0x80, 0xC1, 0x01, 0x88, 0x1A, 0x02, 0x1B,
+    0x1E, 0x04, 0x03, 0x12, 0x00, 0x02, 0x00, 0x36, 0x03, 0x00,
+    0x1B, 0x04, 0x00, 0x19, 0x03, 0x02, 0x00, 0x01, 0x00, 0x20,
+    0x04, 0x00, 0x1F, 0x07, 0x02, 0x00, 0x07, 0x02, 0x00, 0x07,
+    0x02, 0x00, 0x03, 0x02, 0x00, 0x01, 0x00, 0x26, 0x04, 0x00,
+    0x25, 0x07, 0x02, 0x00, 0x01, 0x06, 0x00, 0x02, 0x06, 0x0E,
+    0x01, 0x00, 0x0D, 0x02, 0x06, 0x00, 0x04, 0x34, 0x00, 0x01,
+    0x02, 0x00, 0x03, 0x02, 0x0C, 0x01, 0x00, 0x07, 0x01, 0x00,
+    0x20, 0x01, 0x00, 0x1F, 0x03, 0x02, 0x00, 0x02, 0x02, 0x00,
+    0x01, 0x02, 0x00, 0x01, 0x02, 0x00, 0x01, 0x02, 0x12, 0x01,
+    0x00, 0x11, 0x02, 0x02, 0x0C, 0x01, 0x00, 0x0B, 0x03, 0x02,
+    0x04, 0x01, 0x02, 0x00, 0x01, 0x03, 0x03, 0x01, 0x06, 0x0E,
+    0x01, 0x00, 0x0D, 0x03, 0x02, 0x1A, 0x01, 0x00, 0x15, 0x03,
+    0x02, 0x0E, 0x01, 0x00, 0x0D, 0x03, 0x02, 0x12, 0x02, 0x00,
+    0x0D, 0x01, 0x01, 0x03, 0x03, 0x04, 0x12, 0x02, 0x00, 0x05,
+    0x01, 0x00, 0x0B, 0x02, 0x02, 0x04, 0x01, 0x01, 0x03, 0x01,
+    0x07, 0x03, 0x01, 0x13, 0x03, 0x03, 0x22, 0x0E, 0x01, 0x00,
+    0x0D, 0x03, 0x02, 0x12, 0x02, 0x00, 0x0D, 0x01, 0x01, 0x03,
+    0x03, 0x04, 0x12, 0x02, 0x00, 0x05, 0x01, 0x00, 0x0B, 0x02,
+    0x02, 0x04, 0x01, 0x01, 0x03, 0x04, 0x06, 0x00, 0x28, 0x01,
+    0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00,
+    0x2F, 0x02, 0x03, 0x00, 0x17, 0x03, 0x02, 0x00, 0x2A, 0x04,
+    0x00, 0x00, 0x17, 0x05, 0x04, 0x00, 0x22, 0x06, 0x00, 0x00,
+    0x2A, 0x07, 0x01, 0x00, 0x2A, 0x08, 0x02, 0x00, 0x2A, 0x09,
+    0x03, 0x00, 0x26, 0x0A, 0x01, 0x00, 0x26, 0x0B, 0x02, 0x00,
+    0x2D, 0x0A, 0x07, 0x0B, 0x26, 0x0A, 0x03, 0x00, 0x2D, 0x05,
+    0x0A, 0x08, 0x26, 0x0A, 0x04, 0x00, 0x26, 0x0B, 0x05, 0x00,
+    0x26, 0x0C, 0x06, 0x00, 0x2D, 0x0A, 0x0B, 0x0C, 0x26, 0x0A,
+    0x07, 0x00, 0x26, 0x0B, 0x08, 0x00, 0x2D, 0x0A, 0x0B, 0x09,
+    0x3D, 0x07, 0x00, 0x00, 0x2B, 0x07, 0x00, 0x00, 0x26, 0x09,
+    0x09, 0x00, 0x2F, 0x08, 0x09, 0x00, 0x03, 0x06, 0x00, 0x00,
+    0xCD, 0x02, 0xD8, 0x00, 0x00, 0x06, 0x02, 0x02, 0x02, 0x02,
+    0x0E, 0x01, 0xCE, 0x06, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x73,
+    0xDA, 0x12, 0xDA, 0x80, 0xFA, 0xCE, 0x01, 0x0A, 0x28, 0x02,
+    0x00, 0x00, 0x27, 0x03, 0x00, 0x03, 0x22, 0x04, 0x00, 0x00,
+    0x29, 0x04, 0x00, 0x03, 0x1A, 0x03, 0x09, 0x00, 0x27, 0x04,
+    0x00, 0x00, 0x2C, 0x00, 0x04, 0x00, 0x26, 0x05, 0x00, 0x00,
+    0x2F, 0x04, 0x05, 0x00, 0x26, 0x04, 0x01, 0x00, 0x2C, 0x00,
+    0x04, 0x00, 0x26, 0x04, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x16, 0x01, 0xD8, 0x1B,
+    0x06, 0x01, 0x02, 0x04, 0x02, 0x02, 0x00, 0x01, 0x02, 0x00,
+    0x04, 0x02, 0x04, 0x04, 0x02, 0x00, 0x01, 0x03, 0x03, 0xCD,
+    0x02, 0x90, 0x00, 0x00, 0x05, 0x02, 0x02, 0x02, 0x03, 0x09,
+    0xDA, 0x12, 0xDA, 0x82, 0xAD, 0xCE, 0x0D, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x3A, 0x20,
+    0xDA, 0x81, 0x5A, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00,
+    0x00, 0x2F, 0x02, 0x03, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2C,
+    0x03, 0x02, 0x00, 0x26, 0x04, 0x02, 0x00, 0x2F, 0x03, 0x04,
+    0x00, 0x01, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0B,
+    0x03, 0xEE, 0x1B, 0x84, 0x01, 0x04, 0x00, 0x2F, 0x02, 0x00,
+    0x0D, 0xCD, 0x02, 0xD0, 0x00, 0x00, 0x05, 0x02, 0x02, 0x02,
+    0x02, 0x0B, 0x01, 0xDA, 0x12, 0xDA, 0x81, 0xDE, 0xDA, 0x82,
+    0xBF, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F,
+    0x02, 0x03, 0x00, 0x26, 0x04, 0x01, 0x00, 0x1F, 0x03, 0x02,
+    0x04, 0x1A, 0x03, 0x02, 0x00, 0x18, 0x02, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x29, 0x01, 0x00, 0x06, 0x27, 0x02, 0x00,
+    0x06, 0x03, 0x02, 0x00, 0x00, 0xBF, 0xFF, 0x10, 0x03, 0xF4,
+    0x1B, 0x52, 0x02, 0x00, 0x05, 0x02, 0x00, 0x0F, 0x01, 0x02,
+    0x04, 0x03, 0x02, 0x03, 0xCD, 0x02, 0x90, 0x00, 0x00, 0x04,
+    0x02, 0x02, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0x06, 0xDA,
+    0x12, 0xDA, 0x82, 0xA8, 0xDA, 0x81, 0x5A, 0x26, 0x02, 0x00,
+    0x00, 0x2C, 0x02, 0x00, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2F,
+    0x02, 0x03, 0x00, 0x01, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x07, 0x04, 0xEA, 0x1B, 0x58, 0x02, 0x00, 0x0D, 0x1F,
+    0x01, 0xCE, 0x1B, 0x02, 0x03, 0x08, 0x1A, 0x01, 0x00, 0x15,
+    0x02, 0x02, 0x00, 0x01, 0x0C, 0x00, 0x01, 0x08, 0x3C, 0x01,
+    0x06, 0x09, 0x01, 0x09, 0x0E, 0x10, 0x01, 0x3F, 0x01, 0x17,
+    0x03, 0xDA, 0x05, 0xCE, 0x80, 0x83, 0x28, 0x65, 0x76, 0x61,
+    0x6C, 0x2D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x73,
+    0x74, 0x72, 0x29, 0x0A, 0x0A, 0x45, 0x76, 0x61, 0x6C, 0x75,
+    0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x65,
+    0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74,
+    0x2E, 0x20, 0x49, 0x66, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20,
+    0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x6F, 0x76,
+    0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x20, 0x65, 0x6E,
+    0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+    0x69, 0x73, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x2C,
+    0x20, 0x75, 0x73, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x2D, 0x63,
+    0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x2E, 0xCF, 0x0B, 0x6A,
+    0x61, 0x6E, 0x65, 0x74, 0x2F, 0x62, 0x75, 0x69, 0x6C, 0x64,
+    0xD3, 0x02, 0xDA, 0x03, 0xCE, 0x07, 0x61, 0x30, 0x32, 0x64,
+    0x32, 0x34, 0x37, 0xDA, 0x05, 0xCE, 0x32, 0x54, 0x68, 0x65,
+    0x20, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x20, 0x69, 0x64, 0x65,
+    0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69,
+    0x6E, 0x67, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x70,
+    0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x2E, 0xCF, 0x06, 0x65,
+    0x70, 0x72, 0x69, 0x6E, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x82, 0xAA, 0xDA, 0x05, 0xCE, 0x56, 0x28, 0x65, 0x70, 0x72,
+    0x69, 0x6E, 0x74, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A,
+    0x0A, 0x53, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x73, 0x20, 0x70,
+    0x72, 0x69, 0x6E, 0x74, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20,
+    0x75, 0x73, 0x65, 0x73, 0x20, 0x28, 0x64, 0x79, 0x6E, 0x20,
+    0x3A, 0x65, 0x72, 0x72, 0x20, 0x73, 0x74, 0x64, 0x65, 0x72,
+    0x72, 0x29, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61, 0x64,
+    0x20, 0x6F, 0x66, 0x20, 0x28, 0x64, 0x79, 0x6E, 0x20, 0x3A,
+    0x6F, 0x75, 0x74, 0x20, 0x73, 0x74, 0x64, 0x6F, 0x75, 0x74,
+    0x29, 0x2E, 0xCF, 0x07, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x70,
+    0x69, 0xD3, 0x02, 0xDA, 0x03, 0xC8, 0x18, 0x2D, 0x44, 0x54,
+    0xFB, 0x21, 0x09, 0x40, 0xDA, 0x05, 0xCE, 0x0D, 0x54, 0x68,
+    0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x70, 0x69,
+    0x2E, 0xCF, 0x04, 0x70, 0x6F, 0x73, 0x3F, 0xD3, 0x03, 0xDA,
+    0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x50, 0x01, 0xDA, 0x03,
+    0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x04, 0x01, 0x01, 0x01,
+    0x00, 0x04, 0xCE, 0x04, 0x70, 0x6F, 0x73, 0x3F, 0xDA, 0x12,
+    0x28, 0x01, 0x00, 0x00, 0x25, 0x03, 0x00, 0x00, 0x43, 0x02,
+    0x00, 0x03, 0x03, 0x02, 0x00, 0x00, 0x07, 0x01, 0xA0, 0x01,
+    0x02, 0x03, 0x00, 0x5E, 0xDA, 0x05, 0xCE, 0x27, 0x28, 0x70,
+    0x6F, 0x73, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68,
+    0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69,
+    0x73, 0x20, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x20,
+    0x74, 0x68, 0x61, 0x6E, 0x20, 0x30, 0x2E, 0xCF, 0x0C, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x73, 0x6C, 0x69, 0x63,
+    0x65, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0xCD, 0xDA, 0x05,
+    0xCE, 0x81, 0x64, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x73, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x73, 0x74,
+    0x61, 0x72, 0x74, 0x20, 0x65, 0x6E, 0x64, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x73, 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65,
+    0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x75, 0x62, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x66,
+    0x72, 0x6F, 0x6D, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20,
+    0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x69, 0x6E, 0x63, 0x6C,
+    0x75, 0x73, 0x69, 0x76, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x65,
+    0x78, 0x63, 0x6C, 0x75, 0x73, 0x69, 0x76, 0x65, 0x2E, 0x20,
+    0x41, 0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x69,
+    0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+    0x20, 0x30, 0x2E, 0x20, 0x27, 0x73, 0x74, 0x61, 0x72, 0x74,
+    0x27, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x27, 0x65, 0x6E, 0x64,
+    0x27, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x61, 0x6C, 0x73, 0x6F,
+    0x20, 0x62, 0x65, 0x20, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69,
+    0x76, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x6E, 0x64, 0x69,
+    0x63, 0x61, 0x74, 0x65, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78,
+    0x69, 0x6E, 0x67, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x2E, 0x20, 0x4E, 0x6F, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x2D, 0x31,
+    0x20, 0x69, 0x73, 0x20, 0x73, 0x79, 0x6E, 0x6F, 0x6E, 0x79,
+    0x6D, 0x6F, 0x75, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x28, 0x6C, 0x65, 0x6E,
+    0x67, 0x74, 0x68, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x29,
+    0x20, 0x74, 0x6F, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x20,
+    0x61, 0x20, 0x66, 0x75, 0x6C, 0x6C, 0x20, 0x6E, 0x65, 0x67,
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x73, 0x6C, 0x69, 0x63,
+    0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x2E, 0x20, 0xCF,
+    0x11, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62, 0x69,
+    0x74, 0x2D, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x11, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x2F, 0x62, 0x69, 0x74, 0x2D, 0x74, 0x6F, 0x67, 0x67, 0x6C,
+    0x65, 0xDA, 0x05, 0xCE, 0x67, 0x28, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x2F, 0x62, 0x69, 0x74, 0x2D, 0x74, 0x6F, 0x67,
+    0x67, 0x6C, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x0A, 0x0A, 0x54,
+    0x6F, 0x67, 0x67, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x62, 0x69, 0x74, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x62, 0x69,
+    0x74, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x69, 0x6E,
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF, 0x09,
+    0x6D, 0x61, 0x74, 0x68, 0x2F, 0x65, 0x78, 0x70, 0x32, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+    0x65, 0x78, 0x70, 0x32, 0xDA, 0x05, 0xCE, 0x2B, 0x28, 0x6D,
+    0x61, 0x74, 0x68, 0x2F, 0x65, 0x78, 0x70, 0x32, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x32, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x70, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x78,
+    0x2E, 0xCF, 0x0A, 0x64, 0x72, 0x6F, 0x70, 0x2D, 0x77, 0x68,
+    0x69, 0x6C, 0x65, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00,
+    0xDA, 0x12, 0x83, 0x29, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02,
+    0x98, 0x00, 0x00, 0x05, 0x02, 0x02, 0x02, 0x02, 0x07, 0xCE,
+    0x0A, 0x64, 0x72, 0x6F, 0x70, 0x2D, 0x77, 0x68, 0x69, 0x6C,
+    0x65, 0xDA, 0x12, 0xD7, 0xCD, 0x02, 0xBA, 0x00, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x00, 0x03, 0x01, 0xCE, 0x0A, 0x63, 0x6F,
+    0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0xDA, 0x12,
+    0x28, 0x01, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x00, 0x03, 0x02,
+    0x00, 0x00, 0xCD, 0x02, 0xD0, 0x00, 0x00, 0x03, 0x01, 0x01,
+    0x01, 0x01, 0x06, 0x01, 0xDA, 0x12, 0xDA, 0x4B, 0x2B, 0x00,
+    0x00, 0x00, 0x27, 0x02, 0x00, 0x00, 0x2F, 0x01, 0x02, 0x00,
+    0x2B, 0x01, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x30, 0x02,
+    0x00, 0x00, 0xBF, 0xFF, 0x07, 0x03, 0xF6, 0x08, 0x20, 0x03,
+    0x00, 0x09, 0x07, 0x01, 0xF0, 0x08, 0x02, 0x02, 0x06, 0x04,
+    0xDA, 0x81, 0xD2, 0x28, 0x02, 0x00, 0x00, 0x2B, 0x00, 0x00,
+    0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x2C,
+    0x03, 0x01, 0x00, 0x26, 0x04, 0x01, 0x00, 0x30, 0x04, 0x00,
+    0x00, 0x0A, 0x01, 0xD2, 0x0C, 0x02, 0x03, 0x08, 0x1C, 0x03,
+    0x00, 0x17, 0xDA, 0x05, 0xCE, 0x80, 0x9C, 0x28, 0x64, 0x72,
+    0x6F, 0x70, 0x2D, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x70,
+    0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A,
+    0x47, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x70, 0x72,
+    0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x72,
+    0x65, 0x6D, 0x6F, 0x76, 0x65, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+    0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64,
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x73, 0x61, 0x74, 0x69, 0x73, 0x66, 0x79, 0x20, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63,
+    0x61, 0x74, 0x65, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61,
+    0x62, 0x6F, 0x72, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x66, 0x69,
+    0x72, 0x73, 0x74, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x75, 0x72,
+    0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2E, 0xCF, 0x09, 0x70, 0x72, 0x6F, 0x70, 0x61,
+    0x67, 0x61, 0x74, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD,
+    0x00, 0x08, 0x00, 0x20, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02,
+    0xCE, 0x09, 0x70, 0x72, 0x6F, 0x70, 0x61, 0x67, 0x61, 0x74,
+    0x65, 0x33, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0xDA,
+    0x05, 0xCE, 0x80, 0xFB, 0x28, 0x70, 0x72, 0x6F, 0x70, 0x61,
+    0x67, 0x61, 0x74, 0x65, 0x20, 0x78, 0x20, 0x66, 0x69, 0x62,
+    0x65, 0x72, 0x29, 0x0A, 0x0A, 0x50, 0x72, 0x6F, 0x70, 0x61,
+    0x67, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x73, 0x69, 0x67,
+    0x6E, 0x61, 0x6C, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61,
+    0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x74, 0x6F, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+    0x74, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x54,
+    0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x69,
+    0x6E, 0x67, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x74,
+    0x72, 0x61, 0x63, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+    0x74, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x77, 0x69,
+    0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x65,
+    0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0x20,
+    0x49, 0x66, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x69,
+    0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x73, 0x74, 0x61,
+    0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x61,
+    0x6E, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D,
+    0x65, 0x64, 0x2C, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x69,
+    0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72,
+    0x72, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+    0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x2E, 0xCF, 0x08, 0x6D, 0x61, 0x74,
+    0x68, 0x2F, 0x73, 0x69, 0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x73, 0x69, 0x6E, 0xDA,
+    0x05, 0xCE, 0x24, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x73,
+    0x69, 0x6E, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+    0x69, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF,
+    0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x73, 0x71, 0x72, 0x74,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68,
+    0x2F, 0x73, 0x71, 0x72, 0x74, 0xDA, 0x05, 0xCE, 0x2C, 0x28,
+    0x6D, 0x61, 0x74, 0x68, 0x2F, 0x73, 0x71, 0x72, 0x74, 0x20,
+    0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x71, 0x75, 0x61,
+    0x72, 0x65, 0x20, 0x72, 0x6F, 0x6F, 0x74, 0x20, 0x6F, 0x66,
+    0x20, 0x78, 0x2E, 0xCF, 0x08, 0x62, 0x72, 0x75, 0x73, 0x68,
+    0x69, 0x66, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00,
+    0x09, 0x00, 0x12, 0x06, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x13, 0xCE, 0x08, 0x62, 0x72, 0x75, 0x73, 0x68,
+    0x69, 0x66, 0x74, 0x39, 0x01, 0x00, 0x00, 0x20, 0x02, 0x01,
+    0x00, 0x1A, 0x02, 0x03, 0x00, 0x25, 0x03, 0x01, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x20, 0x02, 0x01, 0x01, 0x1A, 0x02, 0x05,
+    0x00, 0x25, 0x03, 0x01, 0x00, 0x37, 0x04, 0x00, 0x00, 0x14,
+    0x03, 0x03, 0x04, 0x03, 0x03, 0x00, 0x00, 0x37, 0x03, 0x00,
+    0x00, 0x25, 0x05, 0x01, 0x00, 0x34, 0x04, 0x00, 0x05, 0x14,
+    0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x01, 0x1F, 0x02, 0x05,
+    0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xDA,
+    0x05, 0xCE, 0x80, 0xF4, 0x28, 0x62, 0x72, 0x75, 0x73, 0x68,
+    0x69, 0x66, 0x74, 0x20, 0x78, 0x20, 0x26, 0x20, 0x73, 0x68,
+    0x69, 0x66, 0x74, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x20,
+    0x62, 0x69, 0x74, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x65,
+    0x64, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x62, 0x79,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x6D, 0x20, 0x6F,
+    0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x68, 0x69, 0x66,
+    0x74, 0x73, 0x2E, 0x20, 0x78, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x65, 0x61, 0x63, 0x68, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x68, 0x69, 0x66,
+    0x74, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20,
+    0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72,
+    0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x69, 0x67, 0x6E,
+    0x20, 0x6F, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x6E,
+    0x6F, 0x74, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76,
+    0x65, 0x64, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 0x20,
+    0x73, 0x68, 0x69, 0x66, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x61,
+    0x6C, 0x77, 0x61, 0x79, 0x73, 0x20, 0x62, 0x65, 0x20, 0x70,
+    0x6F, 0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 0x2E, 0xCF, 0x04,
+    0x6A, 0x75, 0x78, 0x74, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03,
+    0x00, 0xDA, 0x12, 0x83, 0x39, 0x01, 0xDA, 0x03, 0xD7, 0xCD,
+    0x02, 0x99, 0x00, 0x00, 0x0D, 0x00, 0x00, 0xCD, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x08, 0x25, 0xCE, 0x04, 0x6A, 0x75, 0x78, 0x74,
+    0xDA, 0x12, 0xCF, 0x05, 0x74, 0x75, 0x70, 0x6C, 0x65, 0xDA,
+    0x55, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x03, 0x06, 0x01, 0x01,
+    0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x0C, 0xCE, 0x05, 0x61,
+    0x70, 0x70, 0x6C, 0x79, 0x39, 0x02, 0x01, 0x00, 0x20, 0x03,
+    0x02, 0x00, 0x19, 0x03, 0x09, 0x00, 0x25, 0x04, 0x00, 0x00,
+    0x34, 0x05, 0x01, 0x04, 0x05, 0x04, 0x04, 0x01, 0x1F, 0x03,
+    0x04, 0x02, 0x19, 0x03, 0x03, 0x00, 0x2B, 0x05, 0x00, 0x00,
+    0x18, 0xFB, 0xFF, 0xFF, 0x2E, 0x05, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0xDA, 0x57, 0xDA, 0x81, 0x1B, 0xCF, 0x01, 0x26,
+    0xDA, 0x80, 0xA1, 0xDA, 0x80, 0x87, 0x28, 0x01, 0x00, 0x00,
+    0x26, 0x02, 0x00, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x3A, 0x02,
+    0x00, 0x00, 0x17, 0x03, 0x02, 0x00, 0x26, 0x05, 0x01, 0x00,
+    0x2F, 0x04, 0x05, 0x00, 0x17, 0x05, 0x04, 0x00, 0x25, 0x06,
+    0x00, 0x00, 0x39, 0x07, 0x00, 0x00, 0x17, 0x08, 0x07, 0x00,
+    0x41, 0x07, 0x06, 0x08, 0x1A, 0x07, 0x0D, 0x00, 0x34, 0x09,
+    0x00, 0x06, 0x17, 0x0A, 0x09, 0x00, 0x26, 0x09, 0x02, 0x00,
+    0x2D, 0x09, 0x0A, 0x05, 0x26, 0x0B, 0x03, 0x00, 0x2F, 0x09,
+    0x0B, 0x00, 0x2C, 0x03, 0x09, 0x00, 0x26, 0x0C, 0x04, 0x00,
+    0x2F, 0x0B, 0x0C, 0x00, 0x25, 0x09, 0x01, 0x00, 0x06, 0x06,
+    0x06, 0x09, 0x18, 0xF3, 0xFF, 0xFF, 0x26, 0x06, 0x05, 0x00,
+    0x2C, 0x06, 0x05, 0x00, 0x26, 0x07, 0x03, 0x00, 0x2F, 0x06,
+    0x07, 0x00, 0x25, 0x07, 0x00, 0x00, 0x2C, 0x03, 0x07, 0x00,
+    0x26, 0x08, 0x06, 0x00, 0x2F, 0x07, 0x08, 0x00, 0x26, 0x08,
+    0x07, 0x00, 0x2D, 0x08, 0x06, 0x07, 0x26, 0x08, 0x03, 0x00,
+    0x30, 0x08, 0x00, 0x00, 0x22, 0x01, 0xF2, 0x0C, 0x02, 0x04,
+    0x06, 0x04, 0x02, 0x02, 0x16, 0x01, 0x00, 0x15, 0x07, 0x02,
+    0x00, 0x04, 0x02, 0x28, 0x03, 0x00, 0x23, 0x03, 0x01, 0x03,
+    0x04, 0x04, 0x16, 0x04, 0x00, 0x22, 0x04, 0x00, 0x37, 0xDA,
+    0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x45, 0x28, 0x6A, 0x75, 0x78,
+    0x74, 0x20, 0x26, 0x20, 0x66, 0x75, 0x6E, 0x73, 0x29, 0x0A,
+    0x0A, 0x4D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x66, 0x6F, 0x72,
+    0x6D, 0x20, 0x6F, 0x66, 0x20, 0x6A, 0x75, 0x78, 0x74, 0x2A,
+    0x2E, 0x20, 0x53, 0x61, 0x6D, 0x65, 0x20, 0x62, 0x65, 0x68,
+    0x61, 0x76, 0x69, 0x6F, 0x72, 0x20, 0x62, 0x75, 0x74, 0x20,
+    0x6D, 0x6F, 0x72, 0x65, 0x20, 0x65, 0x66, 0x66, 0x69, 0x63,
+    0x69, 0x65, 0x6E, 0x74, 0x2E, 0xCF, 0x0C, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x2F, 0x74, 0x72, 0x69, 0x6D, 0x6C, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x2F, 0x74, 0x72, 0x69, 0x6D, 0x6C, 0xDA, 0x05, 0xCE,
+    0x80, 0x9D, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F,
+    0x74, 0x72, 0x69, 0x6D, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x20,
+    0x26, 0x6F, 0x70, 0x74, 0x20, 0x73, 0x65, 0x74, 0x29, 0x0A,
+    0x0A, 0x54, 0x72, 0x69, 0x6D, 0x20, 0x6C, 0x65, 0x61, 0x64,
+    0x69, 0x6E, 0x67, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x73,
+    0x70, 0x61, 0x63, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+    0x61, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x73, 0x65, 0x71,
+    0x75, 0x65, 0x6E, 0x63, 0x65, 0x2E, 0x20, 0x49, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x73, 0x65, 0x74, 0x20, 0x69, 0x73, 0x20,
+    0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x64, 0x2C, 0x20,
+    0x63, 0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x20, 0x6F,
+    0x6E, 0x6C, 0x79, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63,
+    0x74, 0x65, 0x72, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x65,
+    0x74, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x77, 0x68,
+    0x69, 0x74, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2E, 0xCF,
+    0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x70, 0x6F, 0x77, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+    0x70, 0x6F, 0x77, 0xDA, 0x05, 0xCE, 0x2B, 0x28, 0x6D, 0x61,
+    0x74, 0x68, 0x2F, 0x70, 0x6F, 0x77, 0x20, 0x61, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20,
+    0x61, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+    0x6F, 0x77, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E,
+    0xCF, 0x0C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x74,
+    0x72, 0x69, 0x6D, 0x72, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x74, 0x72, 0x69,
+    0x6D, 0x72, 0xDA, 0x05, 0xCE, 0x80, 0x9E, 0x28, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x2F, 0x74, 0x72, 0x69, 0x6D, 0x72,
+    0x20, 0x73, 0x74, 0x72, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20,
+    0x73, 0x65, 0x74, 0x29, 0x0A, 0x0A, 0x54, 0x72, 0x69, 0x6D,
+    0x20, 0x74, 0x72, 0x61, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x20,
+    0x77, 0x68, 0x69, 0x74, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x62, 0x79,
+    0x74, 0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63,
+    0x65, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x73,
+    0x65, 0x74, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x76,
+    0x69, 0x64, 0x65, 0x64, 0x2C, 0x20, 0x63, 0x6F, 0x6E, 0x73,
+    0x69, 0x64, 0x65, 0x72, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20,
+    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73,
+    0x20, 0x69, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6F,
+    0x20, 0x62, 0x65, 0x20, 0x77, 0x68, 0x69, 0x74, 0x65, 0x73,
+    0x70, 0x61, 0x63, 0x65, 0x2E, 0xCF, 0x0E, 0x72, 0x61, 0x6E,
+    0x67, 0x65, 0x2D, 0x74, 0x65, 0x6D, 0x70, 0x6C, 0x61, 0x74,
+    0x65, 0xD3, 0x04, 0xDA, 0x80, 0xCD, 0xCB, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x81, 0x35, 0x01, 0xDA, 0x03, 0xD7,
+    0xCD, 0x02, 0x98, 0x00, 0x00, 0x1B, 0x03, 0x03, 0x03, 0x15,
+    0x80, 0xC3, 0xCE, 0x0E, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x2D,
+    0x74, 0x65, 0x6D, 0x70, 0x6C, 0x61, 0x74, 0x65, 0xDA, 0x12,
+    0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01,
+    0x02, 0x07, 0xCE, 0x06, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x3F,
+    0xDA, 0x12, 0xDA, 0x15, 0xDA, 0x50, 0x28, 0x01, 0x00, 0x00,
+    0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02,
+    0x03, 0x00, 0x26, 0x04, 0x01, 0x00, 0x1F, 0x03, 0x02, 0x04,
+    0x03, 0x03, 0x00, 0x00, 0x0A, 0x01, 0xBE, 0x01, 0x02, 0x03,
+    0x00, 0x5A, 0x03, 0x00, 0x05, 0xCF, 0x05, 0x72, 0x61, 0x6E,
+    0x67, 0x65, 0xDA, 0x80, 0x94, 0xDA, 0x03, 0xD1, 0x01, 0xD7,
+    0xCD, 0x02, 0x99, 0x00, 0x00, 0x11, 0x00, 0x00, 0xCD, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x04, 0x59, 0xCE, 0x05, 0x72, 0x61, 0x6E,
+    0x67, 0x65, 0xDA, 0x12, 0xDA, 0x81, 0x1A, 0xDA, 0x80, 0xC3,
+    0xDA, 0x81, 0x1B, 0xCE, 0x22, 0x65, 0x78, 0x70, 0x65, 0x63,
+    0x74, 0x65, 0x64, 0x20, 0x31, 0x20, 0x74, 0x6F, 0x20, 0x33,
+    0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73,
+    0x20, 0x74, 0x6F, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x28,
+    0x01, 0x00, 0x00, 0x39, 0x02, 0x00, 0x00, 0x17, 0x03, 0x02,
+    0x00, 0x25, 0x04, 0x01, 0x00, 0x1F, 0x02, 0x03, 0x04, 0x1A,
+    0x02, 0x11, 0x00, 0x37, 0x04, 0x00, 0x00, 0x17, 0x05, 0x04,
+    0x00, 0x2B, 0x05, 0x00, 0x00, 0x26, 0x06, 0x00, 0x00, 0x2F,
+    0x04, 0x06, 0x00, 0x17, 0x06, 0x04, 0x00, 0x25, 0x04, 0x00,
+    0x00, 0x17, 0x07, 0x05, 0x00, 0x41, 0x08, 0x04, 0x07, 0x1A,
+    0x08, 0x06, 0x00, 0x17, 0x09, 0x04, 0x00, 0x36, 0x06, 0x09,
+    0x09, 0x25, 0x0A, 0x01, 0x00, 0x06, 0x04, 0x04, 0x0A, 0x18,
+    0xFA, 0xFF, 0xFF, 0x03, 0x06, 0x00, 0x00, 0x25, 0x05, 0x02,
+    0x00, 0x1F, 0x04, 0x03, 0x05, 0x1A, 0x04, 0x15, 0x00, 0x37,
+    0x05, 0x00, 0x00, 0x17, 0x06, 0x05, 0x00, 0x37, 0x05, 0x00,
+    0x01, 0x17, 0x07, 0x05, 0x00, 0x07, 0x05, 0x07, 0x06, 0x2B,
+    0x05, 0x00, 0x00, 0x26, 0x09, 0x00, 0x00, 0x2F, 0x08, 0x09,
+    0x00, 0x17, 0x05, 0x08, 0x00, 0x17, 0x08, 0x06, 0x00, 0x17,
+    0x09, 0x07, 0x00, 0x41, 0x0A, 0x08, 0x09, 0x1A, 0x0A, 0x07,
+    0x00, 0x17, 0x0B, 0x08, 0x00, 0x07, 0x0C, 0x0B, 0x06, 0x36,
+    0x05, 0x0C, 0x0B, 0x25, 0x0C, 0x01, 0x00, 0x06, 0x08, 0x08,
+    0x0C, 0x18, 0xF9, 0xFF, 0xFF, 0x03, 0x05, 0x00, 0x00, 0x25,
+    0x06, 0x03, 0x00, 0x1F, 0x05, 0x03, 0x06, 0x1A, 0x05, 0x27,
+    0x00, 0x37, 0x06, 0x00, 0x00, 0x17, 0x07, 0x06, 0x00, 0x37,
+    0x06, 0x00, 0x01, 0x17, 0x08, 0x06, 0x00, 0x37, 0x06, 0x00,
+    0x02, 0x17, 0x09, 0x06, 0x00, 0x2B, 0x09, 0x00, 0x00, 0x26,
+    0x0A, 0x01, 0x00, 0x2F, 0x06, 0x0A, 0x00, 0x1A, 0x06, 0x10,
+    0x00, 0x3A, 0x0A, 0x00, 0x00, 0x17, 0x0B, 0x0A, 0x00, 0x17,
+    0x0A, 0x07, 0x00, 0x17, 0x0C, 0x08, 0x00, 0x43, 0x0D, 0x0A,
+    0x0C, 0x1A, 0x0D, 0x09, 0x00, 0x17, 0x0E, 0x0A, 0x00, 0x2C,
+    0x0B, 0x0E, 0x00, 0x26, 0x10, 0x02, 0x00, 0x2F, 0x0F, 0x10,
+    0x00, 0x25, 0x10, 0x00, 0x00, 0x07, 0x0F, 0x10, 0x09, 0x07,
+    0x0A, 0x0A, 0x0F, 0x18, 0xF7, 0xFF, 0xFF, 0x03, 0x0B, 0x00,
+    0x00, 0x3A, 0x0A, 0x00, 0x00, 0x17, 0x0B, 0x0A, 0x00, 0x17,
+    0x0A, 0x07, 0x00, 0x17, 0x0C, 0x08, 0x00, 0x41, 0x0D, 0x0A,
+    0x0C, 0x1A, 0x0D, 0x07, 0x00, 0x17, 0x0E, 0x0A, 0x00, 0x2C,
+    0x0B, 0x0E, 0x00, 0x26, 0x10, 0x02, 0x00, 0x2F, 0x0F, 0x10,
+    0x00, 0x06, 0x0A, 0x0A, 0x09, 0x18, 0xF9, 0xFF, 0xFF, 0x03,
+    0x0B, 0x00, 0x00, 0x26, 0x06, 0x03, 0x00, 0x01, 0x06, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x58, 0x01, 0xA2, 0x0B, 0x02,
+    0x01, 0x0A, 0x10, 0x04, 0x00, 0x0B, 0x02, 0x04, 0x0C, 0x03,
+    0x02, 0x12, 0x01, 0x00, 0x11, 0x05, 0x02, 0x00, 0x01, 0x00,
+    0x16, 0x03, 0x00, 0x15, 0x01, 0x05, 0x03, 0x03, 0x01, 0x07,
+    0x04, 0x0E, 0x0C, 0x01, 0x02, 0x28, 0x03, 0x00, 0x15, 0x01,
+    0x00, 0x11, 0x05, 0x02, 0x00, 0x01, 0x00, 0x28, 0x01, 0x00,
+    0x11, 0x03, 0x00, 0x15, 0x01, 0x05, 0x03, 0x03, 0x0B, 0x07,
+    0x06, 0x18, 0x0C, 0x03, 0x02, 0x08, 0x01, 0x00, 0x07, 0x0A,
+    0x02, 0x04, 0x02, 0x00, 0x26, 0x03, 0x00, 0x25, 0x0D, 0x02,
+    0x00, 0x03, 0x02, 0x0B, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00,
+    0x05, 0x01, 0x01, 0x01, 0x02, 0x07, 0xCE, 0x07, 0x6E, 0x75,
+    0x6D, 0x62, 0x65, 0x72, 0x3F, 0xDA, 0x12, 0xDA, 0x15, 0xD0,
+    0x06, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x28, 0x01, 0x00,
+    0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F,
+    0x02, 0x03, 0x00, 0x26, 0x04, 0x01, 0x00, 0x1F, 0x03, 0x02,
+    0x04, 0x03, 0x03, 0x00, 0x00, 0x0A, 0x01, 0xA6, 0x01, 0x02,
+    0x03, 0x00, 0x5E, 0x03, 0x00, 0x05, 0xDA, 0x80, 0xC3, 0xDA,
+    0x55, 0xDA, 0x81, 0xC2, 0xDA, 0x58, 0xDA, 0x56, 0xDA, 0x81,
+    0xEE, 0xD7, 0xCD, 0x00, 0x08, 0x00, 0x08, 0x01, 0x01, 0x01,
+    0x01, 0x00, 0x02, 0xCE, 0x06, 0x6C, 0x65, 0x6E, 0x67, 0x74,
+    0x68, 0x39, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xDA,
+    0x6E, 0xDA, 0x82, 0x44, 0xDA, 0x81, 0x2D, 0xDA, 0x64, 0xDA,
+    0x21, 0xDA, 0x22, 0xDA, 0x81, 0xF3, 0xDA, 0x59, 0x28, 0x03,
+    0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x06, 0x00, 0x00,
+    0x2F, 0x05, 0x06, 0x00, 0x1A, 0x05, 0x15, 0x00, 0x25, 0x07,
+    0x00, 0x00, 0x2B, 0x07, 0x00, 0x00, 0x2F, 0x07, 0x01, 0x00,
+    0x26, 0x09, 0x01, 0x00, 0x1F, 0x08, 0x09, 0x07, 0x1A, 0x08,
+    0x0C, 0x00, 0x26, 0x07, 0x01, 0x00, 0x2B, 0x07, 0x00, 0x00,
+    0x26, 0x09, 0x02, 0x00, 0x2F, 0x07, 0x09, 0x00, 0x26, 0x0A,
+    0x03, 0x00, 0x35, 0x09, 0x07, 0x0A, 0x26, 0x0A, 0x04, 0x00,
+    0x37, 0x0A, 0x0A, 0x00, 0x1F, 0x07, 0x0A, 0x09, 0x17, 0x06,
+    0x07, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00,
+    0x17, 0x04, 0x06, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x04,
+    0x00, 0x00, 0x1A, 0x04, 0xA8, 0x00, 0x37, 0x05, 0x01, 0x00,
+    0x17, 0x06, 0x05, 0x00, 0x37, 0x05, 0x01, 0x01, 0x17, 0x07,
+    0x05, 0x00, 0x37, 0x05, 0x01, 0x02, 0x17, 0x08, 0x05, 0x00,
+    0x37, 0x05, 0x01, 0x03, 0x17, 0x09, 0x05, 0x00, 0x39, 0x05,
+    0x01, 0x00, 0x17, 0x0A, 0x05, 0x00, 0x25, 0x0C, 0x02, 0x00,
+    0x1F, 0x0B, 0x0A, 0x0C, 0x1A, 0x0B, 0x07, 0x00, 0x25, 0x0C,
+    0x00, 0x00, 0x25, 0x0D, 0x01, 0x00, 0x2D, 0x0C, 0x07, 0x0D,
+    0x3F, 0x0C, 0x00, 0x00, 0x17, 0x05, 0x0C, 0x00, 0x18, 0x1A,
+    0x00, 0x00, 0x25, 0x0E, 0x03, 0x00, 0x1F, 0x0D, 0x0A, 0x0E,
+    0x1A, 0x0D, 0x06, 0x00, 0x25, 0x0E, 0x01, 0x00, 0x2D, 0x07,
+    0x08, 0x0E, 0x3F, 0x0E, 0x00, 0x00, 0x17, 0x0C, 0x0E, 0x00,
+    0x18, 0x11, 0x00, 0x00, 0x25, 0x10, 0x04, 0x00, 0x1F, 0x0F,
+    0x0A, 0x10, 0x1A, 0x0F, 0x0C, 0x00, 0x2B, 0x09, 0x00, 0x00,
+    0x26, 0x12, 0x05, 0x00, 0x2F, 0x11, 0x12, 0x00, 0x1A, 0x11,
+    0x05, 0x00, 0x2D, 0x07, 0x08, 0x09, 0x3F, 0x12, 0x00, 0x00,
+    0x17, 0x10, 0x12, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x10,
+    0x00, 0x00, 0x17, 0x0E, 0x10, 0x00, 0x18, 0x02, 0x00, 0x00,
+    0x22, 0x0E, 0x00, 0x00, 0x17, 0x0C, 0x0E, 0x00, 0x17, 0x05,
+    0x0C, 0x00, 0x17, 0x0A, 0x05, 0x00, 0x1A, 0x0A, 0x79, 0x00,
+    0x37, 0x05, 0x0A, 0x00, 0x17, 0x0B, 0x05, 0x00, 0x37, 0x05,
+    0x0A, 0x01, 0x17, 0x0C, 0x05, 0x00, 0x37, 0x05, 0x0A, 0x02,
+    0x17, 0x0D, 0x05, 0x00, 0x2B, 0x0D, 0x00, 0x00, 0x26, 0x0E,
+    0x06, 0x00, 0x2F, 0x05, 0x0E, 0x00, 0x17, 0x0E, 0x05, 0x00,
+    0x26, 0x0F, 0x07, 0x00, 0x2F, 0x05, 0x0F, 0x00, 0x17, 0x0F,
+    0x05, 0x00, 0x26, 0x10, 0x07, 0x00, 0x2F, 0x05, 0x10, 0x00,
+    0x17, 0x10, 0x05, 0x00, 0x26, 0x11, 0x07, 0x00, 0x2F, 0x05,
+    0x11, 0x00, 0x17, 0x11, 0x05, 0x00, 0x26, 0x12, 0x07, 0x00,
+    0x2F, 0x05, 0x12, 0x00, 0x17, 0x12, 0x05, 0x00, 0x26, 0x13,
+    0x08, 0x00, 0x26, 0x14, 0x01, 0x00, 0x26, 0x15, 0x04, 0x00,
+    0x37, 0x15, 0x15, 0x00, 0x2D, 0x13, 0x14, 0x15, 0x3F, 0x05,
+    0x00, 0x00, 0x26, 0x14, 0x09, 0x00, 0x22, 0x15, 0x00, 0x00,
+    0x2D, 0x14, 0x05, 0x15, 0x2B, 0x01, 0x00, 0x00, 0x3F, 0x13,
+    0x00, 0x00, 0x26, 0x14, 0x0A, 0x00, 0x2D, 0x14, 0x0F, 0x13,
+    0x3F, 0x05, 0x00, 0x00, 0x26, 0x14, 0x09, 0x00, 0x25, 0x15,
+    0x00, 0x00, 0x2D, 0x14, 0x0F, 0x15, 0x2B, 0x0B, 0x00, 0x00,
+    0x3F, 0x13, 0x00, 0x00, 0x26, 0x15, 0x0B, 0x00, 0x2D, 0x15,
+    0x10, 0x13, 0x3F, 0x14, 0x00, 0x00, 0x1A, 0x0E, 0x09, 0x00,
+    0x26, 0x16, 0x0C, 0x00, 0x2C, 0x16, 0x0F, 0x00, 0x3F, 0x15,
+    0x00, 0x00, 0x26, 0x17, 0x0D, 0x00, 0x2C, 0x17, 0x15, 0x00,
+    0x3F, 0x16, 0x00, 0x00, 0x17, 0x13, 0x16, 0x00, 0x18, 0x05,
+    0x00, 0x00, 0x26, 0x16, 0x0C, 0x00, 0x2C, 0x16, 0x0F, 0x00,
+    0x3F, 0x15, 0x00, 0x00, 0x17, 0x13, 0x15, 0x00, 0x26, 0x16,
+    0x09, 0x00, 0x2D, 0x16, 0x0F, 0x13, 0x2B, 0x0C, 0x00, 0x00,
+    0x3F, 0x15, 0x00, 0x00, 0x26, 0x16, 0x0A, 0x00, 0x2D, 0x16,
+    0x11, 0x15, 0x3F, 0x13, 0x00, 0x00, 0x1A, 0x0E, 0x05, 0x00,
+    0x25, 0x17, 0x00, 0x00, 0x07, 0x16, 0x17, 0x0D, 0x17, 0x15,
+    0x16, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x15, 0x0D, 0x00,
+    0x26, 0x17, 0x09, 0x00, 0x25, 0x18, 0x01, 0x00, 0x2D, 0x17,
+    0x0F, 0x18, 0x2B, 0x15, 0x00, 0x00, 0x3F, 0x16, 0x00, 0x00,
+    0x26, 0x17, 0x0A, 0x00, 0x2D, 0x17, 0x12, 0x16, 0x3F, 0x15,
+    0x00, 0x00, 0x1A, 0x0E, 0x03, 0x00, 0x26, 0x16, 0x0E, 0x00,
+    0x18, 0x02, 0x00, 0x00, 0x26, 0x16, 0x0F, 0x00, 0x2D, 0x16,
+    0x10, 0x11, 0x3F, 0x17, 0x00, 0x00, 0x1A, 0x0E, 0x06, 0x00,
+    0x26, 0x19, 0x0D, 0x00, 0x2C, 0x19, 0x10, 0x00, 0x3F, 0x18,
+    0x00, 0x00, 0x17, 0x16, 0x18, 0x00, 0x18, 0x02, 0x00, 0x00,
+    0x17, 0x16, 0x10, 0x00, 0x26, 0x19, 0x10, 0x00, 0x2D, 0x19,
+    0x0F, 0x16, 0x3F, 0x18, 0x00, 0x00, 0x26, 0x19, 0x09, 0x00,
+    0x2D, 0x19, 0x0F, 0x18, 0x2B, 0x10, 0x00, 0x00, 0x3F, 0x16,
+    0x00, 0x00, 0x26, 0x19, 0x0A, 0x00, 0x2D, 0x19, 0x00, 0x16,
+    0x3F, 0x18, 0x00, 0x00, 0x1A, 0x0E, 0x03, 0x00, 0x26, 0x16,
+    0x0D, 0x00, 0x18, 0x02, 0x00, 0x00, 0x26, 0x16, 0x11, 0x00,
+    0x2D, 0x16, 0x10, 0x12, 0x3F, 0x19, 0x00, 0x00, 0x26, 0x1A,
+    0x12, 0x00, 0x2D, 0x1A, 0x10, 0x19, 0x3F, 0x16, 0x00, 0x00,
+    0x26, 0x1A, 0x13, 0x00, 0x2D, 0x1A, 0x17, 0x18, 0x2E, 0x02,
+    0x00, 0x00, 0x2B, 0x16, 0x00, 0x00, 0x3F, 0x19, 0x00, 0x00,
+    0x26, 0x17, 0x14, 0x00, 0x2D, 0x17, 0x05, 0x14, 0x2D, 0x13,
+    0x15, 0x19, 0x3F, 0x16, 0x00, 0x00, 0x03, 0x16, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x79, 0x01,
+    0xEA, 0x04, 0x02, 0x03, 0x0E, 0x1A, 0x01, 0x00, 0x09, 0x03,
+    0x02, 0x1E, 0x02, 0x00, 0x13, 0x01, 0x01, 0x09, 0x04, 0x04,
+    0x30, 0x02, 0x00, 0x09, 0x03, 0x00, 0x1B, 0x06, 0x03, 0x09,
+    0x01, 0x00, 0x0B, 0x08, 0x06, 0x04, 0x01, 0x02, 0x20, 0x04,
+    0x00, 0x0B, 0x04, 0x02, 0x08, 0x05, 0x01, 0x07, 0x03, 0x04,
+    0x08, 0x05, 0x03, 0x07, 0x03, 0x06, 0x10, 0x01, 0x00, 0x07,
+    0x02, 0x00, 0x20, 0x03, 0x00, 0x1F, 0x05, 0x05, 0x07, 0x01,
+    0x00, 0x13, 0x01, 0x08, 0x00, 0x06, 0x02, 0x04, 0x03, 0x02,
+    0x14, 0x01, 0x00, 0x13, 0x0C, 0x02, 0x00, 0x17, 0x02, 0x04,
+    0x06, 0x06, 0x3A, 0x02, 0x05, 0x39, 0x03, 0x06, 0x62, 0x09,
+    0x05, 0x61, 0x02, 0x08, 0x40, 0x12, 0x07, 0x3F, 0x03, 0x0C,
+    0x5A, 0x20, 0x0B, 0x59, 0x01, 0x07, 0x07, 0x01, 0x0F, 0x03,
+    0xDA, 0x05, 0xCE, 0x81, 0x5F, 0x28, 0x72, 0x61, 0x6E, 0x67,
+    0x65, 0x2D, 0x74, 0x65, 0x6D, 0x70, 0x6C, 0x61, 0x74, 0x65,
+    0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x69,
+    0x6E, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A, 0x4C,
+    0x6F, 0x6F, 0x70, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+    0x6F, 0x66, 0x20, 0x61, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x72,
+    0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x66, 0x75,
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x6F, 0x75, 0x74, 0x20, 0x20, 0x62, 0x75, 0x69, 0x6C,
+    0x64, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x41, 0x20, 0x6C, 0x6F,
+    0x63, 0x61, 0x6C, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x64, 0x20, 0x72, 0x61,
+    0x6E, 0x67, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74,
+    0x20, 0x62, 0x65, 0x20, 0x73, 0x65, 0x65, 0x6E, 0x20, 0x61,
+    0x74, 0x20, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x73, 0x69,
+    0x6F, 0x6E, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x2C, 0x20, 0x73,
+    0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70,
+    0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x20, 0x61, 0x74,
+    0x20, 0x72, 0x75, 0x6E, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20,
+    0x69, 0x73, 0x20, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x20, 0x63, 0x6F, 0x72, 0x65, 0x20, 0x66,
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69,
+    0x73, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x73, 0x20, 0x6F,
+    0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x72,
+    0x61, 0x6E, 0x67, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x2E, 0x20, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66, 0x20,
+    0x69, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+    0x61, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x6F, 0x20,
+    0x72, 0x61, 0x6E, 0x67, 0x65, 0x2E, 0xDA, 0x82, 0x75, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x06, 0x73, 0x65, 0x74, 0x64, 0x79,
+    0x6E, 0xDA, 0x05, 0xCE, 0x39, 0x28, 0x73, 0x65, 0x74, 0x64,
+    0x79, 0x6E, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74, 0x20, 0x61,
+    0x20, 0x64, 0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x20, 0x62,
+    0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x2E, 0xCF, 0x09, 0x70, 0x65, 0x67, 0x2F, 0x6D, 0x61,
+    0x74, 0x63, 0x68, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x70,
+    0x65, 0x67, 0x2F, 0x6D, 0x61, 0x74, 0x63, 0x68, 0xDA, 0x05,
+    0xCE, 0x81, 0x20, 0x28, 0x70, 0x65, 0x67, 0x2F, 0x6D, 0x61,
+    0x74, 0x63, 0x68, 0x20, 0x70, 0x65, 0x67, 0x20, 0x74, 0x65,
+    0x78, 0x74, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x73, 0x74,
+    0x61, 0x72, 0x74, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73,
+    0x29, 0x0A, 0x0A, 0x4D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x61,
+    0x20, 0x50, 0x61, 0x72, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x45,
+    0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20,
+    0x47, 0x72, 0x61, 0x6D, 0x6D, 0x61, 0x72, 0x20, 0x74, 0x6F,
+    0x20, 0x61, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x61,
+    0x70, 0x74, 0x75, 0x72, 0x65, 0x64, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66, 0x20,
+    0x74, 0x65, 0x78, 0x74, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20,
+    0x6E, 0x6F, 0x74, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x6E, 0x67, 0x75, 0x61,
+    0x67, 0x65, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64,
+    0x20, 0x62, 0x79, 0x20, 0x70, 0x65, 0x67, 0x2E, 0x20, 0x54,
+    0x68, 0x65, 0x20, 0x73, 0x79, 0x6E, 0x74, 0x61, 0x78, 0x20,
+    0x6F, 0x66, 0x20, 0x50, 0x45, 0x47, 0x73, 0x20, 0x61, 0x72,
+    0x65, 0x20, 0x76, 0x65, 0x72, 0x79, 0x20, 0x73, 0x69, 0x6D,
+    0x69, 0x6C, 0x61, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68,
+    0x6F, 0x73, 0x65, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65,
+    0x64, 0x20, 0x62, 0x79, 0x20, 0x4C, 0x50, 0x65, 0x67, 0x2C,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20,
+    0x73, 0x69, 0x6D, 0x69, 0x6C, 0x61, 0x72, 0x20, 0x63, 0x61,
+    0x70, 0x61, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x69, 0x65, 0x73,
+    0x2E, 0xCF, 0x06, 0x72, 0x65, 0x6C, 0x6F, 0x61, 0x64, 0xD3,
+    0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x87, 0xEC,
+    0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0xBA, 0x00, 0x00, 0x1C,
+    0x02, 0x01, 0x02, 0x0F, 0x6B, 0x03, 0xCE, 0x06, 0x72, 0x65,
+    0x6C, 0x6F, 0x61, 0x64, 0xDA, 0x12, 0xD7, 0xCD, 0x02, 0xBA,
+    0x00, 0x00, 0x0E, 0x01, 0x01, 0x01, 0x0D, 0x50, 0x01, 0xCE,
+    0x0B, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x66, 0x69,
+    0x6E, 0x64, 0xDA, 0x12, 0xD1, 0x0C, 0xD2, 0x03, 0x00, 0xCE,
+    0x12, 0x3A, 0x63, 0x75, 0x72, 0x3A, 0x2F, 0x3A, 0x61, 0x6C,
+    0x6C, 0x3A, 0x2E, 0x6A, 0x69, 0x6D, 0x61, 0x67, 0x65, 0xD0,
+    0x05, 0x69, 0x6D, 0x61, 0x67, 0x65, 0xD7, 0xCD, 0x02, 0x98,
+    0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x02, 0x08, 0xCE, 0x07,
+    0x63, 0x68, 0x65, 0x63, 0x6B, 0x2D, 0x2E, 0xDA, 0x12, 0xCE,
+    0x01, 0x2E, 0xD8, 0x12, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x2F, 0x68, 0x61, 0x73, 0x2D, 0x70, 0x72, 0x65, 0x66, 0x69,
+    0x78, 0x3F, 0x28, 0x01, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00,
+    0x2C, 0x02, 0x00, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2F, 0x02,
+    0x03, 0x00, 0x1A, 0x02, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x0A, 0x01, 0xF2, 0x1C, 0x02, 0x04,
+    0x00, 0x2E, 0x03, 0x00, 0x07, 0xD2, 0x03, 0x00, 0xCE, 0x11,
+    0x3A, 0x63, 0x75, 0x72, 0x3A, 0x2F, 0x3A, 0x61, 0x6C, 0x6C,
+    0x3A, 0x2E, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0xDA, 0x82, 0x9B,
+    0xDA, 0x83, 0x3A, 0xD2, 0x03, 0x00, 0xCE, 0x16, 0x3A, 0x63,
+    0x75, 0x72, 0x3A, 0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2F,
+    0x69, 0x6E, 0x69, 0x74, 0x2E, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+    0xDA, 0x82, 0x9B, 0xDA, 0x83, 0x3A, 0xD2, 0x03, 0x00, 0xCE,
+    0x13, 0x3A, 0x63, 0x75, 0x72, 0x3A, 0x2F, 0x3A, 0x61, 0x6C,
+    0x6C, 0x3A, 0x3A, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x3A,
+    0xD0, 0x06, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0xDA, 0x83,
+    0x3A, 0xD2, 0x03, 0x00, 0xCE, 0x0C, 0x3A, 0x61, 0x6C, 0x6C,
+    0x3A, 0x2E, 0x6A, 0x69, 0x6D, 0x61, 0x67, 0x65, 0xDA, 0x83,
+    0x36, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x04, 0x01, 0x01,
+    0x01, 0x02, 0x08, 0xCE, 0x0B, 0x6E, 0x6F, 0x74, 0x2D, 0x63,
+    0x68, 0x65, 0x63, 0x6B, 0x2D, 0x2E, 0xDA, 0x12, 0xDA, 0x83,
+    0x38, 0xDA, 0x83, 0x39, 0x28, 0x01, 0x00, 0x00, 0x26, 0x02,
+    0x00, 0x00, 0x2C, 0x02, 0x00, 0x00, 0x26, 0x03, 0x01, 0x00,
+    0x2F, 0x02, 0x03, 0x00, 0x1A, 0x02, 0x02, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0A, 0x01, 0xF4, 0x1C,
+    0x02, 0x04, 0x00, 0x3E, 0x03, 0x00, 0x0F, 0xD2, 0x03, 0x00,
+    0xCE, 0x0B, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2E, 0x6A, 0x61,
+    0x6E, 0x65, 0x74, 0xDA, 0x82, 0x9B, 0xDA, 0x83, 0x45, 0xD2,
+    0x03, 0x00, 0xCE, 0x10, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2F,
+    0x69, 0x6E, 0x69, 0x74, 0x2E, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+    0xDA, 0x82, 0x9B, 0xDA, 0x83, 0x45, 0xD2, 0x03, 0x00, 0xCE,
+    0x0D, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x3A, 0x6E, 0x61, 0x74,
+    0x69, 0x76, 0x65, 0x3A, 0xDA, 0x83, 0x41, 0xDA, 0x83, 0x45,
+    0xD2, 0x03, 0x00, 0xCE, 0x12, 0x3A, 0x73, 0x79, 0x73, 0x3A,
+    0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2E, 0x6A, 0x69, 0x6D,
+    0x61, 0x67, 0x65, 0xDA, 0x83, 0x36, 0xDA, 0x83, 0x45, 0xD2,
+    0x03, 0x00, 0xCE, 0x11, 0x3A, 0x73, 0x79, 0x73, 0x3A, 0x2F,
+    0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x2E, 0x6A, 0x61, 0x6E, 0x65,
+    0x74, 0xDA, 0x82, 0x9B, 0xDA, 0x83, 0x45, 0xD2, 0x03, 0x00,
+    0xCE, 0x16, 0x3A, 0x73, 0x79, 0x73, 0x3A, 0x2F, 0x3A, 0x61,
+    0x6C, 0x6C, 0x3A, 0x2F, 0x69, 0x6E, 0x69, 0x74, 0x2E, 0x6A,
+    0x61, 0x6E, 0x65, 0x74, 0xDA, 0x82, 0x9B, 0xDA, 0x83, 0x45,
+    0xD2, 0x03, 0x00, 0xCE, 0x13, 0x3A, 0x73, 0x79, 0x73, 0x3A,
+    0x2F, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x3A, 0x6E, 0x61, 0x74,
+    0x69, 0x76, 0x65, 0x3A, 0xDA, 0x83, 0x41, 0xDA, 0x83, 0x45,
+    0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x07, 0x02, 0x02, 0x02,
+    0x04, 0x11, 0xCE, 0x0A, 0x6D, 0x6F, 0x64, 0x2D, 0x66, 0x69,
+    0x6C, 0x74, 0x65, 0x72, 0xDA, 0x12, 0xDA, 0x15, 0xD0, 0x03,
+    0x6E, 0x69, 0x6C, 0xDA, 0x16, 0xD8, 0x12, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x2F, 0x68, 0x61, 0x73, 0x2D, 0x73, 0x75,
+    0x66, 0x66, 0x69, 0x78, 0x3F, 0x28, 0x02, 0x00, 0x00, 0x2B,
+    0x00, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x03, 0x04,
+    0x00, 0x17, 0x04, 0x03, 0x00, 0x26, 0x05, 0x01, 0x00, 0x1F,
+    0x03, 0x04, 0x05, 0x1A, 0x03, 0x02, 0x00, 0x03, 0x01, 0x00,
+    0x00, 0x26, 0x06, 0x02, 0x00, 0x1F, 0x05, 0x04, 0x06, 0x1A,
+    0x05, 0x04, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x06, 0x03,
+    0x00, 0x30, 0x06, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x30,
+    0x00, 0x00, 0x00, 0x10, 0x01, 0xD0, 0x1D, 0x02, 0x03, 0x04,
+    0x10, 0x08, 0x00, 0x0B, 0x03, 0x04, 0x14, 0x02, 0x02, 0x0F,
+    0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01,
+    0x02, 0x07, 0xCE, 0x09, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x3F, 0xDA, 0x12, 0xDA, 0x15, 0xDA, 0x81, 0x75,
+    0x28, 0x01, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03,
+    0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x26, 0x04, 0x01, 0x00,
+    0x1F, 0x03, 0x02, 0x04, 0x03, 0x03, 0x00, 0x00, 0x0A, 0x01,
+    0xB2, 0x01, 0x02, 0x03, 0x02, 0x0A, 0x03, 0x00, 0x05, 0xD8,
+    0x12, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x65, 0x78,
+    0x70, 0x61, 0x6E, 0x64, 0x2D, 0x70, 0x61, 0x74, 0x68, 0xDA,
+    0x81, 0x5A, 0xD7, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x05, 0x01,
+    0x01, 0x01, 0x02, 0x08, 0x01, 0xCE, 0x07, 0x66, 0x65, 0x78,
+    0x69, 0x73, 0x74, 0x73, 0xDA, 0x12, 0xD0, 0x04, 0x6D, 0x6F,
+    0x64, 0x65, 0xD0, 0x04, 0x66, 0x69, 0x6C, 0x65, 0x28, 0x01,
+    0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x2C, 0x00, 0x02, 0x00,
+    0x27, 0x03, 0x00, 0x02, 0x2F, 0x02, 0x03, 0x00, 0x26, 0x04,
+    0x01, 0x00, 0x1F, 0x03, 0x04, 0x02, 0x03, 0x03, 0x00, 0x00,
+    0xBF, 0xFF, 0x0A, 0x01, 0xBA, 0x1D, 0x34, 0x04, 0x00, 0x38,
+    0x03, 0x00, 0x11, 0x00, 0x04, 0xDA, 0x83, 0x5F, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x07, 0x6F, 0x73, 0x2F, 0x73, 0x74, 0x61,
+    0x74, 0xDA, 0x05, 0xCE, 0x83, 0x5D, 0x28, 0x6F, 0x73, 0x2F,
+    0x73, 0x74, 0x61, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20,
+    0x26, 0x6F, 0x70, 0x74, 0x20, 0x74, 0x61, 0x62, 0x7C, 0x6B,
+    0x65, 0x79, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x73, 0x20,
+    0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x20, 0x61, 0x20,
+    0x66, 0x69, 0x6C, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x64, 0x69,
+    0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x74, 0x68, 0x69, 0x72, 0x64, 0x20, 0x61, 0x72,
+    0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20,
+    0x61, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x2C,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x20,
+    0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73, 0x74, 0x61,
+    0x74, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x66, 0x69, 0x6C, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x64, 0x69,
+    0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x64, 0x6F,
+    0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x65, 0x78, 0x69,
+    0x73, 0x74, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0x20, 0x54, 0x68, 0x65,
+    0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x61, 0x72, 0x65, 0x0A,
+    0x0A, 0x09, 0x3A, 0x64, 0x65, 0x76, 0x20, 0x2D, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x6E, 0x0A,
+    0x09, 0x3A, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x2D, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6F, 0x66,
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x2C, 0x20, 0x6F, 0x6E, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x3A, 0x66, 0x69, 0x6C, 0x65, 0x2C,
+    0x20, 0x3A, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72,
+    0x79, 0x2C, 0x20, 0x3A, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x2C,
+    0x20, 0x3A, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65,
+    0x72, 0x2C, 0x20, 0x3A, 0x66, 0x69, 0x66, 0x6F, 0x2C, 0x20,
+    0x3A, 0x73, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x2C, 0x20, 0x3A,
+    0x6C, 0x69, 0x6E, 0x6B, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x3A,
+    0x6F, 0x74, 0x68, 0x65, 0x72, 0x0A, 0x09, 0x3A, 0x70, 0x65,
+    0x72, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x20,
+    0x2D, 0x20, 0x41, 0x20, 0x75, 0x6E, 0x69, 0x78, 0x20, 0x70,
+    0x65, 0x72, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x6C, 0x69, 0x6B,
+    0x65, 0x20, 0x22, 0x72, 0x77, 0x78, 0x2D, 0x2D, 0x78, 0x2D,
+    0x2D, 0x78, 0x22, 0x0A, 0x09, 0x3A, 0x75, 0x69, 0x64, 0x20,
+    0x2D, 0x20, 0x46, 0x69, 0x6C, 0x65, 0x20, 0x75, 0x69, 0x64,
+    0x0A, 0x09, 0x3A, 0x67, 0x69, 0x64, 0x20, 0x2D, 0x20, 0x46,
+    0x69, 0x6C, 0x65, 0x20, 0x67, 0x69, 0x64, 0x0A, 0x09, 0x3A,
+    0x6E, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x2D, 0x20, 0x6E, 0x75,
+    0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x6C, 0x69,
+    0x6E, 0x6B, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x66, 0x69, 0x6C,
+    0x65, 0x0A, 0x09, 0x3A, 0x72, 0x64, 0x65, 0x76, 0x20, 0x2D,
+    0x20, 0x52, 0x65, 0x61, 0x6C, 0x20, 0x64, 0x65, 0x76, 0x69,
+    0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x69, 0x6C, 0x65,
+    0x2E, 0x20, 0x30, 0x20, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6E,
+    0x64, 0x6F, 0x77, 0x73, 0x2E, 0x0A, 0x09, 0x3A, 0x73, 0x69,
+    0x7A, 0x65, 0x20, 0x2D, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20,
+    0x6F, 0x66, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E,
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x0A, 0x09, 0x3A, 0x62,
+    0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x2D, 0x20, 0x6E, 0x75,
+    0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x6C,
+    0x6F, 0x63, 0x6B, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x2E, 0x20, 0x30, 0x20, 0x6F, 0x6E, 0x20, 0x77,
+    0x69, 0x6E, 0x64, 0x6F, 0x77, 0x73, 0x0A, 0x09, 0x3A, 0x62,
+    0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x2D,
+    0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x62,
+    0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x66,
+    0x69, 0x6C, 0x65, 0x2E, 0x20, 0x30, 0x20, 0x6F, 0x6E, 0x20,
+    0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x73, 0x0A, 0x09, 0x3A,
+    0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x2D,
+    0x20, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x74, 0x61, 0x6D, 0x70,
+    0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65,
+    0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x61, 0x63, 0x63, 0x65,
+    0x73, 0x73, 0x65, 0x64, 0x0A, 0x09, 0x3A, 0x63, 0x68, 0x61,
+    0x6E, 0x67, 0x65, 0x64, 0x20, 0x2D, 0x20, 0x74, 0x69, 0x6D,
+    0x65, 0x73, 0x74, 0x61, 0x6D, 0x70, 0x20, 0x77, 0x68, 0x65,
+    0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6C, 0x61, 0x73,
+    0x74, 0x20, 0x63, 0x68, 0x6E, 0x61, 0x67, 0x65, 0x64, 0x20,
+    0x28, 0x70, 0x65, 0x72, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6F,
+    0x6E, 0x73, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64,
+    0x29, 0x0A, 0x09, 0x3A, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69,
+    0x65, 0x64, 0x20, 0x2D, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x73,
+    0x74, 0x61, 0x6D, 0x70, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20,
+    0x66, 0x69, 0x6C, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20,
+    0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x28,
+    0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x63, 0x68,
+    0x61, 0x6E, 0x67, 0x65, 0x64, 0x29, 0x0A, 0xDA, 0x83, 0x61,
+    0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x08, 0x02, 0x02, 0x02,
+    0x03, 0x0C, 0xCE, 0x09, 0x64, 0x65, 0x66, 0x67, 0x6C, 0x6F,
+    0x62, 0x61, 0x6C, 0xDA, 0x12, 0xD8, 0x06, 0x73, 0x79, 0x6D,
+    0x62, 0x6F, 0x6C, 0xDA, 0x03, 0xDA, 0x83, 0x29, 0x28, 0x02,
+    0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00,
+    0x2F, 0x03, 0x04, 0x00, 0x17, 0x04, 0x03, 0x00, 0x26, 0x05,
+    0x01, 0x00, 0x2C, 0x05, 0x01, 0x00, 0x3E, 0x05, 0x00, 0x00,
+    0x2C, 0x04, 0x05, 0x00, 0x26, 0x07, 0x02, 0x00, 0x2F, 0x06,
+    0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0F, 0x01, 0x7A, 0x02,
+    0x03, 0x06, 0x1A, 0x01, 0x00, 0x15, 0x06, 0x02, 0x00, 0x01,
+    0x07, 0x03, 0xDA, 0x81, 0xF9, 0xDA, 0x81, 0xF1, 0xD7, 0xCD,
+    0x02, 0x98, 0x00, 0x00, 0x0C, 0x02, 0x02, 0x02, 0x01, 0x15,
+    0xCE, 0x06, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0xDA, 0x12,
+    0xDA, 0x81, 0x1B, 0x28, 0x02, 0x00, 0x00, 0x3A, 0x03, 0x00,
+    0x00, 0x17, 0x04, 0x03, 0x00, 0x25, 0x05, 0x00, 0x00, 0x39,
+    0x06, 0x01, 0x00, 0x17, 0x07, 0x06, 0x00, 0x41, 0x06, 0x05,
+    0x07, 0x1A, 0x06, 0x0D, 0x00, 0x34, 0x08, 0x01, 0x05, 0x17,
+    0x09, 0x08, 0x00, 0x2B, 0x09, 0x00, 0x00, 0x2F, 0x08, 0x00,
+    0x00, 0x1A, 0x08, 0x05, 0x00, 0x2C, 0x04, 0x09, 0x00, 0x26,
+    0x0B, 0x00, 0x00, 0x2F, 0x0A, 0x0B, 0x00, 0x18, 0x01, 0x00,
+    0x00, 0x25, 0x08, 0x01, 0x00, 0x06, 0x05, 0x05, 0x08, 0x18,
+    0xF3, 0xFF, 0xFF, 0x03, 0x04, 0x00, 0x00, 0x1C, 0x01, 0xE6,
+    0x0A, 0x02, 0x02, 0x08, 0x04, 0x07, 0x02, 0x00, 0x02, 0x02,
+    0x0C, 0x01, 0x00, 0x07, 0x03, 0x02, 0x04, 0x01, 0x01, 0x03,
+    0x03, 0x01, 0x03, 0x01, 0x09, 0x03, 0xDA, 0x80, 0xFB, 0xD7,
+    0xCD, 0x02, 0x98, 0x00, 0x00, 0x0C, 0x02, 0x02, 0x02, 0x02,
+    0x1E, 0xCE, 0x09, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x6F,
+    0x73, 0x65, 0xDA, 0x12, 0xDA, 0x81, 0x1A, 0xDA, 0x81, 0x1B,
+    0x28, 0x02, 0x00, 0x00, 0x39, 0x03, 0x01, 0x00, 0x17, 0x04,
+    0x03, 0x00, 0x25, 0x06, 0x02, 0x00, 0x09, 0x05, 0x06, 0x04,
+    0x25, 0x07, 0x01, 0x00, 0x07, 0x06, 0x05, 0x07, 0x2B, 0x06,
+    0x00, 0x00, 0x26, 0x07, 0x00, 0x00, 0x2F, 0x05, 0x07, 0x00,
+    0x17, 0x06, 0x05, 0x00, 0x25, 0x08, 0x00, 0x00, 0x43, 0x07,
+    0x04, 0x08, 0x1A, 0x07, 0x06, 0x00, 0x25, 0x09, 0x00, 0x00,
+    0x34, 0x08, 0x01, 0x09, 0x25, 0x09, 0x00, 0x00, 0x36, 0x06,
+    0x09, 0x08, 0x18, 0x01, 0x00, 0x00, 0x25, 0x07, 0x01, 0x00,
+    0x41, 0x08, 0x07, 0x04, 0x1A, 0x08, 0x08, 0x00, 0x34, 0x09,
+    0x01, 0x07, 0x2D, 0x06, 0x00, 0x09, 0x26, 0x0B, 0x01, 0x00,
+    0x2F, 0x0A, 0x0B, 0x00, 0x25, 0x09, 0x01, 0x00, 0x06, 0x07,
+    0x07, 0x09, 0x18, 0xF8, 0xFF, 0xFF, 0x03, 0x06, 0x00, 0x00,
+    0x3D, 0x01, 0xAA, 0x11, 0x02, 0x01, 0x08, 0x16, 0x01, 0x00,
+    0x11, 0x02, 0x02, 0x2E, 0x02, 0x00, 0x05, 0x03, 0x00, 0x15,
+    0x01, 0x00, 0x11, 0x02, 0x02, 0x08, 0x01, 0x00, 0x07, 0x02,
+    0x00, 0x32, 0x02, 0x00, 0x15, 0x01, 0x00, 0x1B, 0x01, 0x02,
+    0x00, 0x01, 0x02, 0x0E, 0x01, 0x00, 0x0D, 0x01, 0x02, 0x2C,
+    0x03, 0x00, 0x27, 0x02, 0x02, 0x00, 0x01, 0x03, 0x03, 0x01,
+    0x0F, 0x03, 0xCE, 0x16, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x20,
+    0x6E, 0x6F, 0x74, 0x20, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x6D,
+    0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0xCE, 0x06, 0x3A, 0x0A,
+    0x20, 0x20, 0x20, 0x20, 0x28, 0x01, 0x00, 0x00, 0x22, 0x02,
+    0x00, 0x00, 0x25, 0x03, 0x00, 0x00, 0x26, 0x05, 0x00, 0x00,
+    0x39, 0x04, 0x05, 0x00, 0x17, 0x05, 0x04, 0x00, 0x41, 0x04,
+    0x03, 0x05, 0x1A, 0x04, 0x2D, 0x00, 0x26, 0x07, 0x00, 0x00,
+    0x34, 0x06, 0x07, 0x03, 0x37, 0x07, 0x06, 0x00, 0x17, 0x08,
+    0x07, 0x00, 0x37, 0x07, 0x06, 0x01, 0x17, 0x09, 0x07, 0x00,
+    0x37, 0x07, 0x06, 0x02, 0x17, 0x0A, 0x07, 0x00, 0x2C, 0x0A,
+    0x00, 0x00, 0x26, 0x07, 0x01, 0x00, 0x2F, 0x06, 0x07, 0x00,
+    0x1A, 0x06, 0x1E, 0x00, 0x2B, 0x08, 0x00, 0x00, 0x26, 0x0B,
+    0x02, 0x00, 0x2F, 0x07, 0x0B, 0x00, 0x1A, 0x07, 0x0A, 0x00,
+    0x2B, 0x00, 0x00, 0x00, 0x2F, 0x0B, 0x08, 0x00, 0x17, 0x0C,
+    0x0B, 0x00, 0x1A, 0x0C, 0x05, 0x00, 0x2C, 0x0C, 0x09, 0x00,
+    0x3F, 0x02, 0x00, 0x00, 0x18, 0x16, 0x00, 0x00, 0x18, 0x01,
+    0x00, 0x00, 0x18, 0x10, 0x00, 0x00, 0x2C, 0x00, 0x08, 0x00,
+    0x26, 0x0C, 0x03, 0x00, 0x2F, 0x0B, 0x0C, 0x00, 0x2B, 0x0B,
+    0x00, 0x00, 0x26, 0x0D, 0x04, 0x00, 0x2F, 0x0C, 0x0D, 0x00,
+    0x17, 0x0B, 0x0C, 0x00, 0x2B, 0x0B, 0x00, 0x00, 0x26, 0x0D,
+    0x05, 0x00, 0x2F, 0x0C, 0x0D, 0x00, 0x1A, 0x0C, 0x05, 0x00,
+    0x2C, 0x0B, 0x09, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x18, 0x06,
+    0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+    0x25, 0x06, 0x01, 0x00, 0x06, 0x03, 0x03, 0x06, 0x18, 0xD3,
+    0xFF, 0xFF, 0x1A, 0x02, 0x02, 0x00, 0x03, 0x02, 0x00, 0x00,
+    0x2A, 0x03, 0x00, 0x00, 0x17, 0x04, 0x03, 0x00, 0x26, 0x03,
+    0x00, 0x00, 0x2C, 0x04, 0x03, 0x00, 0x26, 0x05, 0x06, 0x00,
+    0x2F, 0x03, 0x05, 0x00, 0x26, 0x05, 0x07, 0x00, 0x2C, 0x05,
+    0x03, 0x00, 0x26, 0x06, 0x08, 0x00, 0x2F, 0x05, 0x06, 0x00,
+    0x17, 0x03, 0x05, 0x00, 0x26, 0x05, 0x09, 0x00, 0x2C, 0x05,
+    0x03, 0x00, 0x26, 0x06, 0x0A, 0x00, 0x2F, 0x05, 0x06, 0x00,
+    0x17, 0x06, 0x05, 0x00, 0x26, 0x05, 0x0B, 0x00, 0x26, 0x07,
+    0x0C, 0x00, 0x2D, 0x05, 0x00, 0x07, 0x2E, 0x06, 0x00, 0x00,
+    0x26, 0x07, 0x04, 0x00, 0x2F, 0x05, 0x07, 0x00, 0x22, 0x07,
+    0x00, 0x00, 0x2C, 0x07, 0x05, 0x00, 0x3F, 0x05, 0x00, 0x00,
+    0x03, 0x05, 0x00, 0x00, 0xCD, 0x02, 0xD0, 0x00, 0x00, 0x06,
+    0x01, 0x01, 0x01, 0x03, 0x15, 0x01, 0xDA, 0x12, 0xD7, 0xCD,
+    0x02, 0x98, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01, 0x02, 0x07,
+    0xCE, 0x07, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3F, 0xDA,
+    0x12, 0xDA, 0x15, 0xDA, 0x16, 0x28, 0x01, 0x00, 0x00, 0x2B,
+    0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03,
+    0x00, 0x26, 0x04, 0x01, 0x00, 0x1F, 0x03, 0x02, 0x04, 0x03,
+    0x03, 0x00, 0x00, 0x0A, 0x01, 0xAA, 0x01, 0x02, 0x03, 0x00,
+    0x5E, 0x03, 0x00, 0x05, 0xDA, 0x83, 0x58, 0xDA, 0x83, 0x5B,
+    0x37, 0x01, 0x00, 0x00, 0x17, 0x02, 0x01, 0x00, 0x37, 0x01,
+    0x00, 0x01, 0x17, 0x03, 0x01, 0x00, 0x37, 0x01, 0x00, 0x02,
+    0x17, 0x04, 0x01, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x26, 0x01,
+    0x00, 0x00, 0x2F, 0x00, 0x01, 0x00, 0x1A, 0x00, 0x0B, 0x00,
+    0x27, 0x01, 0x00, 0x00, 0x2C, 0x04, 0x01, 0x00, 0x26, 0x05,
+    0x01, 0x00, 0x2F, 0x01, 0x05, 0x00, 0x1A, 0x01, 0x05, 0x00,
+    0x27, 0x05, 0x00, 0x00, 0x2C, 0x05, 0x02, 0x00, 0x26, 0x05,
+    0x02, 0x00, 0x30, 0x05, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x19, 0x06, 0x84, 0x1E,
+    0x28, 0x03, 0x02, 0x10, 0x01, 0x00, 0x0B, 0x04, 0x02, 0x10,
+    0x01, 0x00, 0x0B, 0x04, 0x02, 0x04, 0x01, 0x01, 0x03, 0x01,
+    0x01, 0x03, 0x64, 0x01, 0xDE, 0x1D, 0x02, 0x01, 0x0C, 0x04,
+    0x0E, 0x02, 0x00, 0x03, 0x02, 0x10, 0x01, 0x00, 0x0B, 0x03,
+    0x02, 0x0C, 0x01, 0x00, 0x07, 0x02, 0x02, 0x22, 0x02, 0x00,
+    0x1D, 0x02, 0x02, 0x26, 0x01, 0x02, 0x11, 0x01, 0x03, 0x13,
+    0x01, 0x01, 0x03, 0x03, 0x0A, 0x34, 0x03, 0x00, 0x0F, 0x01,
+    0x00, 0x1B, 0x03, 0x02, 0x0C, 0x01, 0x00, 0x0B, 0x02, 0x02,
+    0x16, 0x01, 0x02, 0x11, 0x01, 0x03, 0x03, 0x01, 0x0D, 0x0B,
+    0x03, 0x01, 0x03, 0x02, 0x16, 0x00, 0x01, 0x02, 0x22, 0x01,
+    0x00, 0x1D, 0x04, 0x08, 0x3A, 0x04, 0x00, 0x21, 0x01, 0x07,
+    0x17, 0x04, 0x0A, 0x20, 0x01, 0x09, 0x1F, 0x06, 0x0C, 0x0E,
+    0x04, 0x00, 0x09, 0xDA, 0x82, 0x9B, 0xCE, 0x1A, 0x63, 0x61,
+    0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x72, 0x65, 0x6C, 0x6F, 0x61,
+    0x64, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x74,
+    0x79, 0x70, 0x65, 0x20, 0xDA, 0x81, 0x5A, 0xD3, 0x00, 0xD7,
+    0xCD, 0x02, 0x98, 0x00, 0x00, 0x07, 0x01, 0x00, 0x01, 0x02,
+    0x0C, 0xCE, 0x08, 0x6D, 0x61, 0x6B, 0x65, 0x2D, 0x65, 0x6E,
+    0x76, 0xDA, 0x12, 0xDA, 0x00, 0xD8, 0x0E, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0x2F, 0x73, 0x65, 0x74, 0x70, 0x72, 0x6F, 0x74,
+    0x6F, 0x28, 0x01, 0x00, 0x00, 0x1A, 0x00, 0x03, 0x00, 0x17,
+    0x02, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x26, 0x02, 0x00,
+    0x00, 0x17, 0x03, 0x02, 0x00, 0x3E, 0x04, 0x00, 0x00, 0x2C,
+    0x04, 0x03, 0x00, 0x26, 0x06, 0x01, 0x00, 0x2F, 0x05, 0x06,
+    0x00, 0x17, 0x04, 0x05, 0x00, 0x03, 0x04, 0x00, 0x00, 0x13,
+    0x01, 0xBA, 0x19, 0x02, 0x04, 0x0A, 0x1C, 0x01, 0x00, 0x17,
+    0x04, 0x02, 0x18, 0x01, 0x00, 0x17, 0x01, 0x0B, 0x03, 0xD8,
+    0x0B, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x63, 0x6C, 0x6F,
+    0x6E, 0x65, 0xD0, 0x0C, 0x72, 0x65, 0x6C, 0x6F, 0x61, 0x64,
+    0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0xDA, 0x82, 0xA0, 0xDA,
+    0x82, 0xA2, 0xDA, 0x82, 0xA1, 0xD7, 0xCD, 0x02, 0xBB, 0x00,
+    0x00, 0x1B, 0x01, 0x01, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x15,
+    0x67, 0x04, 0xCE, 0x06, 0x64, 0x6F, 0x66, 0x69, 0x6C, 0x65,
+    0xDA, 0x12, 0xDA, 0x82, 0x08, 0xDA, 0x82, 0x9B, 0xDA, 0x82,
+    0xA1, 0xDA, 0x82, 0xA2, 0xDA, 0x82, 0xA0, 0xDA, 0x82, 0xB5,
+    0xDA, 0x15, 0xD0, 0x09, 0x63, 0x6F, 0x72, 0x65, 0x2F, 0x66,
+    0x69, 0x6C, 0x65, 0xD0, 0x02, 0x72, 0x62, 0xD8, 0x09, 0x66,
+    0x69, 0x6C, 0x65, 0x2F, 0x6F, 0x70, 0x65, 0x6E, 0xDA, 0x83,
+    0x73, 0xDA, 0x81, 0x5A, 0xD0, 0x0C, 0x63, 0x75, 0x72, 0x72,
+    0x65, 0x6E, 0x74, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0xCE, 0x14,
+    0x63, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+    0x66, 0x69, 0x6E, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+    0xDA, 0x82, 0xB3, 0xDA, 0x82, 0x98, 0xDA, 0x82, 0x9E, 0xDA,
+    0x82, 0x99, 0xDA, 0x82, 0x9A, 0xDA, 0x82, 0xC4, 0xD8, 0x0A,
+    0x66, 0x69, 0x6C, 0x65, 0x2F, 0x63, 0x6C, 0x6F, 0x73, 0x65,
+    0x28, 0x02, 0x00, 0x00, 0x2E, 0x01, 0x00, 0x00, 0x26, 0x04,
+    0x00, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x26, 0x05, 0x01, 0x00,
+    0x34, 0x04, 0x03, 0x05, 0x17, 0x05, 0x04, 0x00, 0x26, 0x06,
+    0x02, 0x00, 0x34, 0x04, 0x03, 0x06, 0x17, 0x06, 0x04, 0x00,
+    0x26, 0x07, 0x03, 0x00, 0x34, 0x04, 0x03, 0x07, 0x17, 0x07,
+    0x04, 0x00, 0x26, 0x08, 0x04, 0x00, 0x34, 0x04, 0x03, 0x08,
+    0x17, 0x08, 0x04, 0x00, 0x26, 0x09, 0x05, 0x00, 0x34, 0x04,
+    0x03, 0x09, 0x17, 0x09, 0x04, 0x00, 0x2B, 0x00, 0x00, 0x00,
+    0x26, 0x0B, 0x06, 0x00, 0x2F, 0x0A, 0x0B, 0x00, 0x26, 0x0C,
+    0x07, 0x00, 0x1F, 0x0B, 0x0A, 0x0C, 0x1A, 0x0B, 0x03, 0x00,
+    0x17, 0x04, 0x00, 0x00, 0x18, 0x06, 0x00, 0x00, 0x26, 0x0A,
+    0x08, 0x00, 0x2C, 0x00, 0x0A, 0x00, 0x26, 0x0C, 0x09, 0x00,
+    0x2F, 0x0A, 0x0C, 0x00, 0x17, 0x04, 0x0A, 0x00, 0x17, 0x0A,
+    0x04, 0x00, 0x1F, 0x0B, 0x0A, 0x00, 0x17, 0x0C, 0x0B, 0x00,
+    0x22, 0x0F, 0x00, 0x00, 0x1F, 0x0E, 0x0F, 0x08, 0x1A, 0x0E,
+    0x05, 0x00, 0x26, 0x10, 0x0A, 0x00, 0x2F, 0x0F, 0x10, 0x00,
+    0x17, 0x0D, 0x0F, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x0D,
+    0x08, 0x00, 0x17, 0x0E, 0x0D, 0x00, 0x2B, 0x00, 0x00, 0x00,
+    0x26, 0x10, 0x0B, 0x00, 0x2F, 0x0F, 0x10, 0x00, 0x17, 0x10,
+    0x0F, 0x00, 0x1A, 0x0C, 0x03, 0x00, 0x22, 0x11, 0x00, 0x00,
+    0x18, 0x02, 0x00, 0x00, 0x17, 0x11, 0x10, 0x00, 0x26, 0x12,
+    0x0C, 0x00, 0x36, 0x0E, 0x12, 0x11, 0x1A, 0x0C, 0x03, 0x00,
+    0x17, 0x11, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x11,
+    0x10, 0x00, 0x26, 0x12, 0x01, 0x00, 0x36, 0x0E, 0x12, 0x11,
+    0x2A, 0x11, 0x00, 0x00, 0x17, 0x12, 0x11, 0x00, 0x2A, 0x13,
+    0x01, 0x00, 0x17, 0x14, 0x13, 0x00, 0x2A, 0x15, 0x02, 0x00,
+    0x17, 0x16, 0x15, 0x00, 0x1A, 0x0A, 0x02, 0x00, 0x18, 0x06,
+    0x00, 0x00, 0x26, 0x17, 0x0D, 0x00, 0x2C, 0x17, 0x00, 0x00,
+    0x26, 0x18, 0x0B, 0x00, 0x2F, 0x17, 0x18, 0x00, 0x01, 0x17,
+    0x00, 0x00, 0x2A, 0x17, 0x03, 0x00, 0x1A, 0x0C, 0x03, 0x00,
+    0x26, 0x18, 0x0E, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x18,
+    0x10, 0x00, 0x26, 0x19, 0x0F, 0x00, 0x26, 0x1A, 0x04, 0x00,
+    0x2D, 0x19, 0x14, 0x1A, 0x26, 0x19, 0x10, 0x00, 0x2D, 0x0E,
+    0x19, 0x16, 0x26, 0x19, 0x11, 0x00, 0x26, 0x1A, 0x12, 0x00,
+    0x2D, 0x19, 0x12, 0x1A, 0x26, 0x19, 0x01, 0x00, 0x2D, 0x17,
+    0x19, 0x18, 0x26, 0x19, 0x02, 0x00, 0x26, 0x1A, 0x03, 0x00,
+    0x2D, 0x19, 0x06, 0x1A, 0x2B, 0x07, 0x00, 0x00, 0x3D, 0x17,
+    0x00, 0x00, 0x2B, 0x17, 0x00, 0x00, 0x26, 0x19, 0x13, 0x00,
+    0x2F, 0x18, 0x19, 0x00, 0x17, 0x17, 0x18, 0x00, 0x1A, 0x0C,
+    0x02, 0x00, 0x18, 0x04, 0x00, 0x00, 0x2B, 0x0A, 0x00, 0x00,
+    0x26, 0x1A, 0x14, 0x00, 0x2F, 0x19, 0x1A, 0x00, 0x03, 0x17,
+    0x00, 0x00, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x05, 0x02, 0x02,
+    0x02, 0x01, 0x06, 0x01, 0xDA, 0x82, 0xC5, 0xDA, 0x12, 0xD8,
+    0x09, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x72, 0x65, 0x61, 0x64,
+    0x28, 0x02, 0x00, 0x00, 0x27, 0x03, 0x00, 0x0A, 0x25, 0x04,
+    0x00, 0x08, 0x2D, 0x03, 0x04, 0x00, 0x26, 0x03, 0x00, 0x00,
+    0x30, 0x03, 0x00, 0x00, 0xBF, 0xFF, 0x07, 0x01, 0xD0, 0x1E,
+    0x06, 0x05, 0x00, 0x2A, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x07,
+    0x02, 0x00, 0x02, 0x02, 0x0D, 0x01, 0xCE, 0x02, 0x62, 0x70,
+    0xDA, 0x12, 0xDA, 0x82, 0xB2, 0xD8, 0x07, 0x6F, 0x73, 0x2F,
+    0x65, 0x78, 0x69, 0x74, 0x28, 0x02, 0x00, 0x00, 0x2C, 0x00,
+    0x01, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x03, 0x04, 0x00,
+    0x17, 0x04, 0x03, 0x00, 0x27, 0x05, 0x00, 0x09, 0x1A, 0x05,
+    0x06, 0x00, 0x25, 0x05, 0x01, 0x00, 0x2B, 0x05, 0x00, 0x00,
+    0x26, 0x06, 0x01, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x18, 0x01,
+    0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0xBF, 0xFF, 0x16, 0x01,
+    0xD2, 0x1E, 0x06, 0x03, 0x02, 0x16, 0x01, 0x00, 0x11, 0x02,
+    0x02, 0x00, 0x04, 0x00, 0x24, 0x01, 0x00, 0x23, 0x01, 0x03,
+    0x03, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x08, 0x03, 0x00, 0x03,
+    0x02, 0x0D, 0x01, 0xCE, 0x02, 0x62, 0x63, 0xDA, 0x12, 0xDA,
+    0x82, 0xAB, 0xDA, 0x83, 0x7F, 0x28, 0x03, 0x00, 0x00, 0x2D,
+    0x00, 0x01, 0x02, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x04, 0x05,
+    0x00, 0x17, 0x05, 0x04, 0x00, 0x27, 0x06, 0x00, 0x09, 0x1A,
+    0x06, 0x06, 0x00, 0x25, 0x06, 0x01, 0x00, 0x2B, 0x06, 0x00,
+    0x00, 0x26, 0x07, 0x01, 0x00, 0x2F, 0x06, 0x07, 0x00, 0x18,
+    0x01, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0xBF, 0xFF, 0x16,
+    0x01, 0xDA, 0x1E, 0x06, 0x03, 0x02, 0x16, 0x01, 0x00, 0x11,
+    0x02, 0x02, 0x00, 0x04, 0x00, 0x24, 0x01, 0x00, 0x23, 0x01,
+    0x03, 0x03, 0xCD, 0x02, 0xD0, 0x00, 0x00, 0x05, 0x02, 0x02,
+    0x02, 0x04, 0x15, 0x01, 0xDA, 0x12, 0xDA, 0x81, 0xDE, 0xDA,
+    0x82, 0xBF, 0xDA, 0x82, 0xA3, 0xDA, 0x83, 0x7F, 0x2B, 0x00,
+    0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03, 0x00,
+    0x26, 0x04, 0x01, 0x00, 0x1F, 0x03, 0x02, 0x04, 0x19, 0x03,
+    0x03, 0x00, 0x23, 0x03, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+    0x24, 0x03, 0x00, 0x00, 0x1A, 0x03, 0x0B, 0x00, 0x2C, 0x00,
+    0x01, 0x00, 0x26, 0x04, 0x02, 0x00, 0x2F, 0x02, 0x04, 0x00,
+    0x27, 0x02, 0x00, 0x09, 0x1A, 0x02, 0x05, 0x00, 0x25, 0x02,
+    0x01, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x26, 0x02, 0x03, 0x00,
+    0x30, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0x19, 0x03, 0xF2, 0x1E, 0x58, 0x06,
+    0x00, 0x0B, 0x01, 0x00, 0x0B, 0x03, 0x02, 0x04, 0x02, 0x02,
+    0x00, 0x04, 0x00, 0x24, 0x01, 0x00, 0x23, 0x01, 0x03, 0x03,
+    0x64, 0x01, 0xB0, 0x1E, 0x02, 0x03, 0x0E, 0x3C, 0x0F, 0x07,
+    0x37, 0x03, 0x0A, 0x1C, 0x02, 0x00, 0x05, 0x03, 0x00, 0x07,
+    0x04, 0x04, 0x04, 0x01, 0x03, 0x03, 0x01, 0x00, 0x0D, 0x01,
+    0x06, 0x24, 0x01, 0x00, 0x23, 0x03, 0x02, 0x00, 0x02, 0x00,
+    0x1A, 0x04, 0x00, 0x19, 0x03, 0x02, 0x16, 0x01, 0x00, 0x15,
+    0x04, 0x02, 0x2E, 0x02, 0x00, 0x2D, 0x04, 0x02, 0x22, 0x02,
+    0x00, 0x21, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x02, 0x08,
+    0x00, 0x02, 0x08, 0x00, 0x04, 0x02, 0x12, 0x01, 0x00, 0x0D,
+    0x01, 0x0C, 0x32, 0x04, 0x0C, 0x05, 0x12, 0x13, 0x2B, 0x01,
+    0x01, 0x03, 0x02, 0x18, 0x00, 0x03, 0x00, 0x2A, 0x01, 0x4D,
+    0x2D, 0xDA, 0x81, 0x16, 0xDA, 0x57, 0xDA, 0x81, 0xED, 0x28,
+    0x02, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x04, 0x00,
+    0x00, 0x2F, 0x03, 0x04, 0x00, 0x37, 0x04, 0x03, 0x00, 0x17,
+    0x05, 0x04, 0x00, 0x37, 0x04, 0x03, 0x01, 0x17, 0x06, 0x04,
+    0x00, 0x1A, 0x05, 0x02, 0x00, 0x18, 0x02, 0x00, 0x00, 0x01,
+    0x06, 0x00, 0x00, 0x26, 0x07, 0x01, 0x00, 0x1F, 0x04, 0x06,
+    0x07, 0x1A, 0x04, 0x02, 0x00, 0x18, 0x06, 0x00, 0x00, 0x26,
+    0x07, 0x02, 0x00, 0x2C, 0x07, 0x06, 0x00, 0x26, 0x08, 0x03,
+    0x00, 0x2F, 0x07, 0x08, 0x00, 0x01, 0x07, 0x00, 0x00, 0x22,
+    0x08, 0x00, 0x00, 0x1F, 0x07, 0x08, 0x01, 0x1A, 0x07, 0x11,
+    0x00, 0x26, 0x09, 0x04, 0x00, 0x34, 0x08, 0x09, 0x05, 0x17,
+    0x09, 0x08, 0x00, 0x1A, 0x09, 0x03, 0x00, 0x17, 0x08, 0x09,
+    0x00, 0x18, 0x09, 0x00, 0x00, 0x26, 0x0B, 0x05, 0x00, 0x2F,
+    0x0A, 0x0B, 0x00, 0x17, 0x0B, 0x0A, 0x00, 0x1A, 0x0B, 0x03,
+    0x00, 0x17, 0x0A, 0x0B, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22,
+    0x0A, 0x00, 0x00, 0x17, 0x08, 0x0A, 0x00, 0x17, 0x04, 0x08,
+    0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x04, 0x01, 0x00, 0x17,
+    0x07, 0x04, 0x00, 0x2B, 0x07, 0x00, 0x00, 0x26, 0x09, 0x06,
+    0x00, 0x2F, 0x08, 0x09, 0x00, 0x17, 0x09, 0x08, 0x00, 0x26,
+    0x0B, 0x07, 0x00, 0x34, 0x0A, 0x07, 0x0B, 0x17, 0x0B, 0x0A,
+    0x00, 0x1A, 0x0B, 0x03, 0x00, 0x17, 0x0A, 0x0B, 0x00, 0x18,
+    0x08, 0x00, 0x00, 0x3A, 0x0C, 0x00, 0x00, 0x17, 0x0D, 0x0C,
+    0x00, 0x1A, 0x0D, 0x03, 0x00, 0x17, 0x0C, 0x0D, 0x00, 0x18,
+    0x02, 0x00, 0x00, 0x22, 0x0C, 0x00, 0x00, 0x17, 0x0A, 0x0C,
+    0x00, 0x17, 0x0B, 0x0A, 0x00, 0x3A, 0x0C, 0x00, 0x00, 0x17,
+    0x0D, 0x0C, 0x00, 0x25, 0x0E, 0xFF, 0xFF, 0x24, 0x0F, 0x00,
+    0x00, 0x2A, 0x10, 0x00, 0x00, 0x17, 0x11, 0x10, 0x00, 0x2A,
+    0x12, 0x01, 0x00, 0x17, 0x13, 0x12, 0x00, 0x2A, 0x14, 0x02,
+    0x00, 0x17, 0x15, 0x14, 0x00, 0x26, 0x16, 0x08, 0x00, 0x2D,
+    0x05, 0x16, 0x07, 0x26, 0x16, 0x09, 0x00, 0x26, 0x17, 0x0A,
+    0x00, 0x2D, 0x16, 0x13, 0x17, 0x2B, 0x15, 0x00, 0x00, 0x26,
+    0x17, 0x0B, 0x00, 0x2F, 0x16, 0x17, 0x00, 0x22, 0x17, 0x00,
+    0x00, 0x2C, 0x07, 0x17, 0x00, 0x26, 0x18, 0x0C, 0x00, 0x2F,
+    0x17, 0x18, 0x00, 0x17, 0x18, 0x17, 0x00, 0x1A, 0x18, 0x14,
+    0x00, 0x34, 0x17, 0x07, 0x18, 0x2C, 0x18, 0x17, 0x00, 0x26,
+    0x1A, 0x0D, 0x00, 0x2F, 0x19, 0x1A, 0x00, 0x37, 0x17, 0x19,
+    0x00, 0x17, 0x1A, 0x17, 0x00, 0x37, 0x17, 0x19, 0x01, 0x17,
+    0x1B, 0x17, 0x00, 0x2B, 0x1A, 0x00, 0x00, 0x26, 0x19, 0x0E,
+    0x00, 0x2F, 0x17, 0x19, 0x00, 0x1A, 0x17, 0x04, 0x00, 0x2B,
+    0x1A, 0x00, 0x00, 0x2F, 0x19, 0x11, 0x00, 0x18, 0x01, 0x00,
+    0x00, 0x2C, 0x07, 0x18, 0x00, 0x26, 0x17, 0x0C, 0x00, 0x2F,
+    0x18, 0x17, 0x00, 0x18, 0xED, 0xFF, 0xFF, 0x26, 0x17, 0x07,
+    0x00, 0x36, 0x07, 0x17, 0x0D, 0x26, 0x17, 0x04, 0x00, 0x36,
+    0x17, 0x05, 0x07, 0x03, 0x07, 0x00, 0x00, 0xCD, 0x02, 0xD8,
+    0x00, 0x00, 0x0D, 0x01, 0x01, 0x01, 0x04, 0x42, 0x01, 0xCE,
+    0x05, 0x70, 0x61, 0x74, 0x63, 0x68, 0xDA, 0x12, 0xDA, 0x80,
+    0xE6, 0xD0, 0x03, 0x72, 0x65, 0x66, 0xD8, 0x04, 0x6B, 0x65,
+    0x79, 0x73, 0xD8, 0x0A, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x2D,
+    0x69, 0x6E, 0x74, 0x6F, 0x28, 0x01, 0x00, 0x00, 0x27, 0x03,
+    0x00, 0x09, 0x34, 0x02, 0x03, 0x00, 0x17, 0x03, 0x02, 0x00,
+    0x27, 0x05, 0x00, 0x07, 0x34, 0x04, 0x05, 0x00, 0x17, 0x05,
+    0x04, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x08, 0x00, 0x00,
+    0x2F, 0x07, 0x08, 0x00, 0x1A, 0x07, 0x0F, 0x00, 0x2B, 0x05,
+    0x00, 0x00, 0x26, 0x0A, 0x00, 0x00, 0x2F, 0x09, 0x0A, 0x00,
+    0x1A, 0x09, 0x08, 0x00, 0x1F, 0x0A, 0x03, 0x05, 0x19, 0x0A,
+    0x03, 0x00, 0x23, 0x0A, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00,
+    0x24, 0x0A, 0x00, 0x00, 0x17, 0x08, 0x0A, 0x00, 0x18, 0x02,
+    0x00, 0x00, 0x22, 0x08, 0x00, 0x00, 0x17, 0x06, 0x08, 0x00,
+    0x18, 0x02, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00, 0x1A, 0x06,
+    0x27, 0x00, 0x26, 0x08, 0x01, 0x00, 0x34, 0x07, 0x03, 0x08,
+    0x17, 0x08, 0x07, 0x00, 0x1A, 0x08, 0x0D, 0x00, 0x26, 0x09,
+    0x01, 0x00, 0x34, 0x07, 0x05, 0x09, 0x17, 0x09, 0x07, 0x00,
+    0x1A, 0x09, 0x08, 0x00, 0x25, 0x0A, 0x00, 0x00, 0x34, 0x07,
+    0x09, 0x0A, 0x25, 0x0A, 0x00, 0x00, 0x36, 0x08, 0x0A, 0x07,
+    0x26, 0x07, 0x01, 0x00, 0x36, 0x05, 0x07, 0x08, 0x18, 0x01,
+    0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x25, 0x07, 0x00, 0x00,
+    0x2B, 0x03, 0x00, 0x00, 0x26, 0x09, 0x02, 0x00, 0x2F, 0x08,
+    0x09, 0x00, 0x17, 0x09, 0x08, 0x00, 0x39, 0x08, 0x09, 0x00,
+    0x17, 0x0A, 0x08, 0x00, 0x41, 0x08, 0x07, 0x0A, 0x1A, 0x08,
+    0x08, 0x00, 0x34, 0x0B, 0x09, 0x07, 0x17, 0x0C, 0x0B, 0x00,
+    0x22, 0x0B, 0x00, 0x00, 0x36, 0x03, 0x0C, 0x0B, 0x25, 0x0B,
+    0x01, 0x00, 0x06, 0x07, 0x07, 0x0B, 0x18, 0xF8, 0xFF, 0xFF,
+    0x2C, 0x03, 0x05, 0x00, 0x26, 0x08, 0x03, 0x00, 0x2F, 0x07,
+    0x08, 0x00, 0x27, 0x07, 0x00, 0x07, 0x36, 0x07, 0x00, 0x03,
+    0x03, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0x55, 0x01, 0x80, 0x20, 0x06, 0x02, 0x02, 0x12, 0x01, 0x00,
+    0x0D, 0x02, 0x02, 0x0E, 0x01, 0x00, 0x0D, 0x03, 0x02, 0x16,
+    0x01, 0x00, 0x09, 0x03, 0x00, 0x20, 0x01, 0x00, 0x1F, 0x05,
+    0x00, 0x36, 0x06, 0x00, 0x35, 0x01, 0x00, 0x0B, 0x02, 0x02,
+    0x1E, 0x02, 0x00, 0x19, 0x02, 0x00, 0x38, 0x02, 0x00, 0x37,
+    0x02, 0x02, 0x16, 0x02, 0x00, 0x11, 0x02, 0x02, 0x00, 0x02,
+    0x03, 0x03, 0x01, 0x06, 0x00, 0x03, 0x00, 0x10, 0x07, 0x00,
+    0x0F, 0x02, 0x00, 0x22, 0x03, 0x00, 0x21, 0x03, 0x02, 0x00,
+    0x03, 0x02, 0x00, 0x01, 0x0B, 0x03, 0xCD, 0x02, 0xD8, 0x00,
+    0x00, 0x08, 0x01, 0x01, 0x01, 0x02, 0x1B, 0x01, 0xCE, 0x06,
+    0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0xDA, 0x12, 0xDA, 0x4B,
+    0xDA, 0x82, 0x55, 0x28, 0x01, 0x00, 0x00, 0x27, 0x03, 0x00,
+    0x0E, 0x25, 0x04, 0x01, 0x00, 0x06, 0x02, 0x03, 0x04, 0x29,
+    0x02, 0x00, 0x0E, 0x27, 0x04, 0x00, 0x0F, 0x2B, 0x04, 0x00,
+    0x00, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x1A,
+    0x04, 0x09, 0x00, 0x27, 0x06, 0x00, 0x0B, 0x27, 0x07, 0x00,
+    0x0E, 0x35, 0x05, 0x06, 0x07, 0x2C, 0x00, 0x05, 0x00, 0x26,
+    0x07, 0x01, 0x00, 0x2F, 0x06, 0x07, 0x00, 0x17, 0x03, 0x06,
+    0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x03, 0x00, 0x00, 0x1A,
+    0x03, 0x05, 0x00, 0x27, 0x04, 0x00, 0x0D, 0x27, 0x05, 0x00,
+    0x0E, 0x36, 0x04, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x23,
+    0x04, 0x00, 0x00, 0x29, 0x04, 0x00, 0x0F, 0x03, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0x25, 0x01, 0x94, 0x20, 0x06, 0x04, 0x02,
+    0x04, 0x04, 0x02, 0x12, 0x01, 0x00, 0x09, 0x03, 0x00, 0x3E,
+    0x03, 0x00, 0x17, 0x03, 0x00, 0x25, 0x01, 0x00, 0x07, 0x03,
+    0x02, 0x0C, 0x01, 0x00, 0x07, 0x02, 0x02, 0x08, 0x01, 0x00,
+    0x07, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x0A, 0x02, 0x02, 0xCD,
+    0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0x1A, 0x01, 0xDA, 0x82, 0xBB,
+    0xDA, 0x12, 0xDA, 0x83, 0x1B, 0xDA, 0x81, 0xED, 0x28, 0x02,
+    0x00, 0x00, 0x2F, 0x03, 0x00, 0x00, 0x17, 0x04, 0x03, 0x00,
+    0x27, 0x05, 0x00, 0x0F, 0x1A, 0x05, 0x05, 0x00, 0x27, 0x05,
+    0x00, 0x0D, 0x27, 0x06, 0x00, 0x0E, 0x36, 0x05, 0x06, 0x01,
+    0x18, 0x01, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x06,
+    0x00, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x1A, 0x05, 0x0D, 0x00,
+    0x25, 0x07, 0x01, 0x00, 0x35, 0x06, 0x01, 0x07, 0x17, 0x07,
+    0x06, 0x00, 0x2B, 0x07, 0x00, 0x00, 0x26, 0x08, 0x01, 0x00,
+    0x2F, 0x06, 0x08, 0x00, 0x1A, 0x06, 0x05, 0x00, 0x2B, 0x07,
+    0x00, 0x00, 0x27, 0x09, 0x00, 0x11, 0x2F, 0x08, 0x09, 0x00,
+    0x18, 0x01, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x03, 0x04,
+    0x00, 0x00, 0xBF, 0xFF, 0x31, 0x01, 0x9E, 0x20, 0x06, 0x01,
+    0x02, 0x16, 0x01, 0x00, 0x11, 0x02, 0x02, 0x00, 0x03, 0x00,
+    0x1C, 0x01, 0x00, 0x1B, 0x03, 0x02, 0x0C, 0x01, 0x00, 0x0B,
+    0x02, 0x02, 0x16, 0x01, 0x00, 0x11, 0x03, 0x02, 0x08, 0x01,
+    0x00, 0x07, 0x03, 0x00, 0x24, 0x01, 0x00, 0x23, 0x01, 0x03,
+    0x03, 0x01, 0x05, 0x03, 0x6A, 0x01, 0xD8, 0x1F, 0x02, 0x03,
+    0x14, 0x36, 0x04, 0x00, 0x31, 0x02, 0x02, 0x00, 0x01, 0x00,
+    0x22, 0x02, 0x02, 0x11, 0x02, 0x00, 0x0F, 0x04, 0x02, 0x12,
+    0x01, 0x00, 0x0D, 0x03, 0x02, 0x03, 0x02, 0x00, 0x22, 0x04,
+    0x00, 0x07, 0x02, 0x00, 0x3E, 0x06, 0x00, 0x3D, 0x04, 0x00,
+    0x19, 0x03, 0x02, 0x12, 0x01, 0x00, 0x11, 0x02, 0x02, 0x1C,
+    0x0B, 0x00, 0x07, 0x01, 0x00, 0x13, 0x02, 0x02, 0x00, 0x01,
+    0x02, 0x00, 0x01, 0x02, 0x00, 0x02, 0x02, 0x00, 0x02, 0x14,
+    0x00, 0x02, 0x0A, 0x00, 0x08, 0x0E, 0x00, 0x0E, 0x02, 0x00,
+    0x03, 0x00, 0x3C, 0x01, 0x00, 0x3B, 0x02, 0x00, 0x56, 0x05,
+    0x00, 0x55, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x01, 0x59,
+    0x03, 0xDA, 0x05, 0xCE, 0x82, 0x28, 0x28, 0x72, 0x65, 0x6C,
+    0x6F, 0x61, 0x64, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x26,
+    0x6F, 0x70, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x29, 0x0A, 0x0A,
+    0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x20, 0x61,
+    0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x6D, 0x6F,
+    0x64, 0x75, 0x6C, 0x65, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E,
+    0x20, 0x69, 0x6E, 0x20, 0x69, 0x74, 0x73, 0x20, 0x65, 0x78,
+    0x69, 0x73, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x65, 0x6E, 0x76,
+    0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20,
+    0x54, 0x6F, 0x70, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20,
+    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x62, 0x65, 0x66,
+    0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x72, 0x73, 0x74, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64,
+    0x20, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x72, 0x65, 0x6C, 0x6F,
+    0x61, 0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x20, 0x6E, 0x65,
+    0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x63, 0x6F, 0x6D, 0x70,
+    0x69, 0x6C, 0x65, 0x64, 0x20, 0x6E, 0x6F, 0x72, 0x20, 0x72,
+    0x75, 0x6E, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x2E, 0x20,
+    0x54, 0x68, 0x61, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x66, 0x6F,
+    0x72, 0x6D, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20,
+    0x69, 0x74, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x20, 0x61, 0x67,
+    0x61, 0x69, 0x6E, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x69, 0x6C,
+    0x65, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2C, 0x20, 0x73,
+    0x6F, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x69, 0x74, 0x69,
+    0x6F, 0x6E, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x75, 0x74,
+    0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x63, 0x68,
+    0x61, 0x6E, 0x67, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x65, 0x73,
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x20, 0x75, 0x70, 0x64, 0x61,
+    0x74, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x6F, 0x2E, 0x20, 0x52,
+    0x65, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x62,
+    0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x61, 0x72,
+    0x65, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x64, 0x20,
+    0x69, 0x6E, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x2C, 0x20,
+    0x73, 0x6F, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73,
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x20, 0x69, 0x6D, 0x70,
+    0x6F, 0x72, 0x74, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6D,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x6C, 0x6F, 0x73, 0x75,
+    0x72, 0x65, 0x73, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x72,
+    0x65, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x76,
+    0x61, 0x72, 0x73, 0x20, 0x73, 0x65, 0x65, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x64, 0x65, 0x66, 0x69,
+    0x6E, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x20, 0x20,
+    0x55, 0x73, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
+    0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x6D, 0x6F, 0x64, 0x75,
+    0x6C, 0x65, 0x2F, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2C, 0x20,
+    0x6F, 0x72, 0x20, 0x65, 0x6E, 0x76, 0x20, 0x69, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+    0x20, 0x77, 0x61, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x20,
+    0x79, 0x65, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72,
+    0x65, 0x64, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x69,
+    0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xCF, 0x0C,
+    0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x2F, 0x63, 0x6C, 0x6F,
+    0x73, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0C, 0x74, 0x68,
+    0x72, 0x65, 0x61, 0x64, 0x2F, 0x63, 0x6C, 0x6F, 0x73, 0x65,
+    0xDA, 0x05, 0xCE, 0x80, 0xB8, 0x28, 0x74, 0x68, 0x72, 0x65,
+    0x61, 0x64, 0x2F, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x20, 0x74,
+    0x68, 0x72, 0x65, 0x61, 0x64, 0x29, 0x0A, 0x0A, 0x43, 0x6C,
+    0x6F, 0x73, 0x65, 0x20, 0x61, 0x20, 0x74, 0x68, 0x72, 0x65,
+    0x61, 0x64, 0x2C, 0x20, 0x75, 0x6E, 0x62, 0x6C, 0x6F, 0x63,
+    0x6B, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x74, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x63,
+    0x6F, 0x6D, 0x6D, 0x75, 0x6E, 0x69, 0x63, 0x61, 0x74, 0x69,
+    0x6F, 0x6E, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x74,
+    0x2E, 0x20, 0x4E, 0x6F, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x63, 0x6C, 0x6F, 0x73, 0x69, 0x6E, 0x67, 0x20,
+    0x61, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x69,
+    0x73, 0x20, 0x69, 0x64, 0x65, 0x6D, 0x70, 0x6F, 0x74, 0x65,
+    0x6E, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x64, 0x6F, 0x65,
+    0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x63,
+    0x65, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x68, 0x72,
+    0x65, 0x61, 0x64, 0x27, 0x73, 0x20, 0x6F, 0x70, 0x65, 0x72,
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0xCF,
+    0x0B, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x73, 0x6C, 0x69,
+    0x63, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x80, 0x9F, 0xDA,
+    0x05, 0xCE, 0x81, 0x87, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x61, 0x72, 0x72,
+    0x74, 0x75, 0x70, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x73,
+    0x74, 0x61, 0x72, 0x74, 0x20, 0x65, 0x6E, 0x64, 0x29, 0x0A,
+    0x0A, 0x54, 0x61, 0x6B, 0x65, 0x73, 0x20, 0x61, 0x20, 0x73,
+    0x6C, 0x69, 0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x75, 0x70,
+    0x6C, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73, 0x74,
+    0x61, 0x72, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x65, 0x6E, 0x64,
+    0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x67,
+    0x65, 0x20, 0x69, 0x73, 0x20, 0x68, 0x61, 0x6C, 0x66, 0x20,
+    0x6F, 0x70, 0x65, 0x6E, 0x2C, 0x20, 0x5B, 0x73, 0x74, 0x61,
+    0x72, 0x74, 0x2C, 0x20, 0x65, 0x6E, 0x64, 0x29, 0x2E, 0x20,
+    0x49, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x73, 0x20, 0x63, 0x61,
+    0x6E, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x62, 0x65, 0x20,
+    0x6E, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2C, 0x20,
+    0x69, 0x6E, 0x64, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6E, 0x67,
+    0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x69, 0x6E, 0x67, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65,
+    0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x42, 0x79,
+    0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2C, 0x20,
+    0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x69, 0x73, 0x20, 0x30,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x69,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x65, 0x6E, 0x67,
+    0x74, 0x68, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x4E, 0x6F, 0x74,
+    0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x6E, 0x64,
+    0x65, 0x78, 0x20, 0x2D, 0x31, 0x20, 0x69, 0x73, 0x20, 0x73,
+    0x79, 0x6E, 0x6F, 0x6E, 0x79, 0x6D, 0x6F, 0x75, 0x73, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78,
+    0x20, 0x28, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x61,
+    0x72, 0x72, 0x74, 0x75, 0x70, 0x29, 0x20, 0x74, 0x6F, 0x20,
+    0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x20, 0x61, 0x20, 0x66, 0x75,
+    0x6C, 0x6C, 0x20, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76,
+    0x65, 0x20, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20, 0x72, 0x61,
+    0x6E, 0x67, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2E, 0xCF, 0x08, 0x62, 0x6F, 0x6F,
+    0x6C, 0x65, 0x61, 0x6E, 0x3F, 0xD3, 0x03, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x60, 0x01, 0xDA, 0x03, 0xD7, 0xCD,
+    0x02, 0x98, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01, 0x02, 0x07,
+    0xCE, 0x08, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x3F,
+    0xDA, 0x12, 0xDA, 0x15, 0xD0, 0x07, 0x62, 0x6F, 0x6F, 0x6C,
+    0x65, 0x61, 0x6E, 0x28, 0x01, 0x00, 0x00, 0x2B, 0x00, 0x00,
+    0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x26,
+    0x04, 0x01, 0x00, 0x1F, 0x03, 0x02, 0x04, 0x03, 0x03, 0x00,
+    0x00, 0x0A, 0x01, 0xC0, 0x01, 0x02, 0x03, 0x00, 0x62, 0x03,
+    0x00, 0x05, 0xDA, 0x05, 0xCE, 0x26, 0x28, 0x62, 0x6F, 0x6F,
+    0x6C, 0x65, 0x61, 0x6E, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A,
+    0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78,
+    0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x62, 0x6F, 0x6F, 0x6C,
+    0x65, 0x61, 0x6E, 0x2E, 0xCF, 0x0A, 0x6D, 0x61, 0x74, 0x68,
+    0x2F, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x72, 0x6F, 0x75,
+    0x6E, 0x64, 0xDA, 0x05, 0xCE, 0x31, 0x28, 0x6D, 0x61, 0x74,
+    0x68, 0x2F, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x78, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65,
+    0x72, 0x20, 0x6E, 0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x20,
+    0x74, 0x6F, 0x20, 0x78, 0x2E, 0xCF, 0x05, 0x73, 0x74, 0x64,
+    0x69, 0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x05, 0x73, 0x74,
+    0x64, 0x69, 0x6E, 0xDA, 0x05, 0xCE, 0x18, 0x54, 0x68, 0x65,
+    0x20, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x61, 0x72, 0x64, 0x20,
+    0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65,
+    0x2E, 0xCF, 0x0F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x77,
+    0x65, 0x61, 0x6B, 0x2D, 0x6B, 0x65, 0x79, 0x73, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x0F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F,
+    0x77, 0x65, 0x61, 0x6B, 0x2D, 0x6B, 0x65, 0x79, 0x73, 0xDA,
+    0x05, 0xCE, 0x80, 0xB9, 0x28, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x2F, 0x77, 0x65, 0x61, 0x6B, 0x2D, 0x6B, 0x65, 0x79, 0x73,
+    0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x29,
+    0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x65, 0x6D, 0x70, 0x74,
+    0x79, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x77, 0x65, 0x61, 0x6B, 0x20, 0x72, 0x65,
+    0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x73, 0x20, 0x74,
+    0x6F, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x2E, 0x20, 0x41, 0x6E,
+    0x20, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x20, 0x6B, 0x65, 0x65,
+    0x70, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x20, 0x61, 0x6C, 0x69, 0x76, 0x65, 0x20, 0x6F,
+    0x6E, 0x6C, 0x79, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x69, 0x73,
+    0x20, 0x72, 0x65, 0x61, 0x63, 0x68, 0x61, 0x62, 0x6C, 0x65,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x65, 0x6C, 0x73, 0x65,
+    0x77, 0x68, 0x65, 0x72, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E,
+    0x65, 0x77, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0xCF,
+    0x12, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65,
+    0x70, 0x6C, 0x61, 0x63, 0x65, 0x2D, 0x61, 0x6C, 0x6C, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x12, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x2F, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x2D,
+    0x61, 0x6C, 0x6C, 0xDA, 0x05, 0xCE, 0x80, 0xA4, 0x28, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65, 0x70, 0x6C,
+    0x61, 0x63, 0x65, 0x2D, 0x61, 0x6C, 0x6C, 0x20, 0x70, 0x61,
+    0x74, 0x74, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x20, 0x73,
+    0x74, 0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x70, 0x6C, 0x61,
+    0x63, 0x65, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x73,
+    0x74, 0x61, 0x6E, 0x63, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20,
+    0x70, 0x61, 0x74, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x73, 0x75, 0x62, 0x73, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+    0x73, 0x74, 0x72, 0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x20, 0x69, 0x66, 0x20, 0x70, 0x61, 0x74, 0x74, 0x20,
+    0x69, 0x73, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20,
+    0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x73, 0x74,
+    0x72, 0x2E, 0xCF, 0x0B, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x66,
+    0x64, 0x6F, 0x70, 0x65, 0x6E, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x0B, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x66, 0x64, 0x6F, 0x70,
+    0x65, 0x6E, 0xDA, 0x05, 0xCE, 0x82, 0x75, 0x28, 0x66, 0x69,
+    0x6C, 0x65, 0x2F, 0x66, 0x64, 0x6F, 0x70, 0x65, 0x6E, 0x20,
+    0x66, 0x64, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x6D, 0x6F,
+    0x64, 0x65, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x62, 0x75,
+    0x66, 0x73, 0x69, 0x7A, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x6E, 0x20, 0x66,
+    0x64, 0x2E, 0x20, 0x66, 0x64, 0x20, 0x69, 0x73, 0x20, 0x61,
+    0x20, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x20,
+    0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 0x66,
+    0x69, 0x6C, 0x65, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x70, 0x74, 0x6F, 0x72, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x6D, 0x6F, 0x64, 0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20,
+    0x73, 0x65, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x6C, 0x61,
+    0x67, 0x73, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x61, 0x74,
+    0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F,
+    0x64, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x6F, 0x70, 0x65, 0x6E,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+    0x69, 0x6E, 0x2E, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x69,
+    0x73, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72,
+    0x64, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x65, 0x61,
+    0x63, 0x68, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74,
+    0x65, 0x72, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65,
+    0x6E, 0x74, 0x73, 0x20, 0x61, 0x20, 0x66, 0x6C, 0x61, 0x67,
+    0x2E, 0x62, 0x75, 0x66, 0x73, 0x69, 0x7A, 0x20, 0x69, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x74, 0x6F, 0x20,
+    0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x63,
+    0x61, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x2E, 0x69, 0x66, 0x20,
+    0x62, 0x75, 0x66, 0x73, 0x69, 0x7A, 0x20, 0x69, 0x73, 0x20,
+    0x65, 0x71, 0x75, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x7A,
+    0x65, 0x72, 0x6F, 0x2C, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x64, 0x69,
+    0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2E, 0x49, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x63,
+    0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x6F,
+    0x70, 0x65, 0x6E, 0x65, 0x64, 0x2C, 0x20, 0x72, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2C, 0x20,
+    0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x66, 0x69, 0x6C, 0x65,
+    0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x2E, 0x20, 0x4D, 0x6F,
+    0x64, 0x65, 0x20, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3A, 0x0A,
+    0x0A, 0x09, 0x72, 0x20, 0x2D, 0x20, 0x61, 0x6C, 0x6C, 0x6F,
+    0x77, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x6C, 0x65, 0x0A, 0x09, 0x77, 0x20, 0x2D, 0x20, 0x61,
+    0x6C, 0x6C, 0x6F, 0x77, 0x20, 0x77, 0x72, 0x69, 0x74, 0x69,
+    0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x66, 0x69, 0x6C, 0x65, 0x0A, 0x09, 0x61, 0x20, 0x2D, 0x20,
+    0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x20, 0x74, 0x6F, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x0A, 0x09,
+    0x62, 0x20, 0x2D, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E,
+    0x20, 0x62, 0x69, 0x6E, 0x61, 0x72, 0x79, 0x20, 0x6D, 0x6F,
+    0x64, 0x65, 0x20, 0x28, 0x72, 0x61, 0x74, 0x68, 0x65, 0x72,
+    0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x65, 0x78, 0x74,
+    0x20, 0x6D, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x09, 0x2B, 0x20,
+    0x2D, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x20, 0x74,
+    0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65,
+    0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6F,
+    0x66, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x77, 0x72, 0x69, 0x74,
+    0x69, 0x6E, 0x67, 0x20, 0x69, 0x74, 0xCF, 0x0A, 0x6D, 0x61,
+    0x74, 0x68, 0x2F, 0x61, 0x74, 0x61, 0x6E, 0x32, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61,
+    0x74, 0x61, 0x6E, 0x32, 0xDA, 0x05, 0xCE, 0x47, 0x28, 0x6D,
+    0x61, 0x74, 0x68, 0x2F, 0x61, 0x74, 0x61, 0x6E, 0x32, 0x20,
+    0x79, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x63,
+    0x74, 0x61, 0x6E, 0x67, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x66,
+    0x20, 0x79, 0x2F, 0x78, 0x2E, 0x20, 0x57, 0x6F, 0x72, 0x6B,
+    0x73, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x77, 0x68, 0x65,
+    0x6E, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x30, 0x2E, 0xCF,
+    0x0B, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x2F, 0x73, 0x65,
+    0x6E, 0x64, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0B, 0x74, 0x68,
+    0x72, 0x65, 0x61, 0x64, 0x2F, 0x73, 0x65, 0x6E, 0x64, 0xDA,
+    0x05, 0xCE, 0x80, 0xAC, 0x28, 0x74, 0x68, 0x72, 0x65, 0x61,
+    0x64, 0x2F, 0x73, 0x65, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x72,
+    0x65, 0x61, 0x64, 0x20, 0x6D, 0x73, 0x67, 0x29, 0x0A, 0x0A,
+    0x53, 0x65, 0x6E, 0x64, 0x20, 0x61, 0x20, 0x6D, 0x65, 0x73,
+    0x73, 0x61, 0x67, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x2E, 0x20,
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+    0x6E, 0x65, 0x76, 0x65, 0x72, 0x20, 0x62, 0x6C, 0x6F, 0x63,
+    0x6B, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64,
+    0x20, 0x69, 0x6D, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65,
+    0x6C, 0x79, 0x2E, 0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x74,
+    0x68, 0x72, 0x6F, 0x77, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72,
+    0x72, 0x6F, 0x72, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x70, 0x72,
+    0x6F, 0x62, 0x6C, 0x65, 0x6D, 0x20, 0x73, 0x65, 0x6E, 0x64,
+    0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x65,
+    0x73, 0x73, 0x61, 0x67, 0x65, 0x2E, 0xCF, 0x10, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x2F, 0x6E, 0x65, 0x77, 0x2D, 0x66, 0x69,
+    0x6C, 0x6C, 0x65, 0x64, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x10,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x6E, 0x65, 0x77, 0x2D,
+    0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0xDA, 0x05, 0xCE, 0x80,
+    0x8B, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x6E, 0x65,
+    0x77, 0x2D, 0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x63,
+    0x6F, 0x75, 0x6E, 0x74, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x0A, 0x0A, 0x43, 0x72,
+    0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66,
+    0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x65, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2C, 0x20, 0x61, 0x6C, 0x6C,
+    0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68,
+    0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x73, 0x20,
+    0x74, 0x6F, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E,
+    0xCF, 0x0C, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x70,
+    0x61, 0x74, 0x68, 0x73, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03,
+    0x00, 0xDA, 0x12, 0x87, 0x3C, 0x01, 0xDA, 0x03, 0xDA, 0x83,
+    0x34, 0xDA, 0x05, 0xCE, 0x82, 0x0A, 0x54, 0x68, 0x65, 0x20,
+    0x6C, 0x69, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x70, 0x61,
+    0x74, 0x68, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6C, 0x6F, 0x6F,
+    0x6B, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x64, 0x75,
+    0x6C, 0x65, 0x73, 0x2C, 0x20, 0x74, 0x65, 0x6D, 0x70, 0x6C,
+    0x61, 0x74, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D,
+    0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x65, 0x78, 0x70, 0x61,
+    0x6E, 0x64, 0x2D, 0x70, 0x61, 0x74, 0x68, 0x2E, 0x20, 0x20,
+    0x45, 0x61, 0x63, 0x68, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x74, 0x77,
+    0x6F, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+    0x74, 0x75, 0x70, 0x6C, 0x65, 0x2C, 0x20, 0x63, 0x6F, 0x6E,
+    0x74, 0x61, 0x69, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x20, 0x74, 0x65,
+    0x6D, 0x70, 0x6C, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64,
+    0x20, 0x3A, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2C, 0x20,
+    0x3A, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2C, 0x20, 0x6F,
+    0x72, 0x20, 0x3A, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x69,
+    0x6E, 0x64, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20,
+    0x68, 0x6F, 0x77, 0x20, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69,
+    0x72, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20,
+    0x6C, 0x6F, 0x61, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73,
+    0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x61, 0x74, 0x20,
+    0x74, 0x68, 0x65, 0x73, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68,
+    0x73, 0x2E, 0x0A, 0x0A, 0x41, 0x20, 0x74, 0x75, 0x70, 0x6C,
+    0x65, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x61, 0x6C, 0x73, 0x6F,
+    0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x20,
+    0x61, 0x20, 0x74, 0x68, 0x69, 0x72, 0x64, 0x20, 0x65, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x73, 0x70, 0x65,
+    0x63, 0x69, 0x66, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20,
+    0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x73,
+    0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x66, 0x69,
+    0x6E, 0x64, 0x20, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73,
+    0x65, 0x61, 0x72, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x74,
+    0x65, 0x6D, 0x70, 0x6C, 0x61, 0x74, 0x65, 0x20, 0x69, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x74, 0x65,
+    0x72, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x6E, 0x27, 0x74, 0x20,
+    0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x20, 0x70, 0x61, 0x74,
+    0x68, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C,
+    0x74, 0x65, 0x72, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65,
+    0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+    0x6F, 0x72, 0x20, 0x61, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69,
+    0x63, 0x61, 0x74, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x20,
+    0x69, 0x73, 0x20, 0x6F, 0x66, 0x74, 0x65, 0x6E, 0x20, 0x61,
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x65, 0x78, 0x74, 0x65,
+    0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x69, 0x6E, 0x63,
+    0x6C, 0x75, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x70, 0x65, 0x72, 0x69, 0x6F, 0x64, 0x2E, 0xCF, 0x0F,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x68, 0x61, 0x73,
+    0x2D, 0x6D, 0x6F, 0x72, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x82, 0xB6, 0xDA, 0x05, 0xCE, 0x51, 0x28, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x72, 0x2F, 0x68, 0x61, 0x73, 0x2D, 0x6D, 0x6F,
+    0x72, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x29,
+    0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x72, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6D, 0x6F, 0x72, 0x65,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x2E, 0xCF, 0x0C, 0x69,
+    0x6D, 0x61, 0x67, 0x65, 0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x61,
+    0x74, 0xD3, 0x03, 0xDA, 0x80, 0xCD, 0xCB, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x87, 0x19, 0x01, 0xDA, 0x03, 0x01,
+    0xCF, 0x10, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74,
+    0x61, 0x63, 0x6B, 0x74, 0x72, 0x61, 0x63, 0x65, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x82, 0xA3, 0xDA, 0x05, 0xCE, 0x80, 0xD4,
+    0x28, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61,
+    0x63, 0x6B, 0x74, 0x72, 0x61, 0x63, 0x65, 0x20, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x20, 0x65, 0x72, 0x72, 0x29, 0x0A, 0x0A,
+    0x50, 0x72, 0x69, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x20, 0x6E,
+    0x69, 0x63, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x69, 0x6E,
+    0x67, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x74, 0x72, 0x61,
+    0x63, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20,
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x6D, 0x65, 0x73, 0x73,
+    0x61, 0x67, 0x65, 0x20, 0x65, 0x72, 0x72, 0x20, 0x6D, 0x75,
+    0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73,
+    0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61,
+    0x73, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x27, 0x73, 0x20,
+    0x64, 0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6B, 0x65, 0x65,
+    0x70, 0x20, 0x74, 0x72, 0x61, 0x63, 0x6B, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20,
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x79,
+    0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6F,
+    0x77, 0x6E, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65,
+    0x72, 0x2E, 0xCF, 0x09, 0x70, 0x61, 0x72, 0x74, 0x69, 0x74,
+    0x69, 0x6F, 0x6E, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00,
+    0xDA, 0x12, 0x84, 0x62, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02,
+    0x98, 0x00, 0x00, 0x0F, 0x02, 0x02, 0x02, 0x06, 0x2C, 0xCE,
+    0x09, 0x70, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6F, 0x6E,
+    0xDA, 0x12, 0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x63,
+    0x65, 0x69, 0x6C, 0xDA, 0x81, 0x1A, 0xDA, 0x1A, 0xDA, 0x81,
+    0xCD, 0xDA, 0x80, 0xA1, 0xDA, 0x81, 0x1B, 0x28, 0x02, 0x00,
+    0x00, 0x25, 0x03, 0x00, 0x00, 0x17, 0x04, 0x00, 0x00, 0x39,
+    0x05, 0x01, 0x00, 0x17, 0x06, 0x05, 0x00, 0x0B, 0x07, 0x06,
+    0x00, 0x2B, 0x07, 0x00, 0x00, 0x26, 0x09, 0x00, 0x00, 0x2F,
+    0x08, 0x09, 0x00, 0x2B, 0x08, 0x00, 0x00, 0x26, 0x09, 0x01,
+    0x00, 0x2F, 0x07, 0x09, 0x00, 0x17, 0x08, 0x07, 0x00, 0x2B,
+    0x01, 0x00, 0x00, 0x26, 0x0B, 0x02, 0x00, 0x2F, 0x0A, 0x0B,
+    0x00, 0x1A, 0x0A, 0x03, 0x00, 0x26, 0x09, 0x03, 0x00, 0x18,
+    0x02, 0x00, 0x00, 0x26, 0x09, 0x04, 0x00, 0x17, 0x0A, 0x09,
+    0x00, 0x42, 0x0B, 0x04, 0x06, 0x1A, 0x0B, 0x09, 0x00, 0x2D,
+    0x01, 0x03, 0x04, 0x2F, 0x0C, 0x0A, 0x00, 0x2C, 0x08, 0x0C,
+    0x00, 0x26, 0x0E, 0x05, 0x00, 0x2F, 0x0D, 0x0E, 0x00, 0x17,
+    0x03, 0x04, 0x00, 0x06, 0x04, 0x04, 0x00, 0x18, 0xF7, 0xFF,
+    0xFF, 0x1F, 0x0B, 0x03, 0x06, 0x19, 0x0B, 0x03, 0x00, 0x23,
+    0x0B, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x24, 0x0B, 0x00,
+    0x00, 0x1A, 0x0B, 0x07, 0x00, 0x2C, 0x01, 0x03, 0x00, 0x2F,
+    0x0C, 0x0A, 0x00, 0x2C, 0x08, 0x0C, 0x00, 0x26, 0x0E, 0x05,
+    0x00, 0x2F, 0x0D, 0x0E, 0x00, 0x18, 0x01, 0x00, 0x00, 0x03,
+    0x08, 0x00, 0x00, 0x4C, 0x01, 0xC4, 0x11, 0x02, 0x01, 0x08,
+    0x04, 0x01, 0x00, 0x14, 0x01, 0x02, 0x01, 0x01, 0x00, 0x11,
+    0x01, 0x02, 0x3E, 0x03, 0x00, 0x15, 0x03, 0x00, 0x15, 0x01,
+    0x00, 0x11, 0x03, 0x02, 0x20, 0x04, 0x00, 0x07, 0x01, 0x00,
+    0x17, 0x01, 0x02, 0x0E, 0x01, 0x00, 0x0D, 0x02, 0x02, 0x24,
+    0x03, 0x00, 0x1F, 0x01, 0x02, 0x00, 0x01, 0x02, 0x00, 0x01,
+    0x05, 0x03, 0x05, 0x08, 0x08, 0x01, 0x00, 0x07, 0x02, 0x00,
+    0x42, 0x03, 0x00, 0x1F, 0x01, 0x00, 0x21, 0x01, 0x17, 0x03,
+    0xDA, 0x05, 0xCE, 0x63, 0x28, 0x70, 0x61, 0x72, 0x74, 0x69,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 0x20, 0x69, 0x6E, 0x64,
+    0x29, 0x0A, 0x0A, 0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69,
+    0x6F, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65,
+    0x78, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73,
+    0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x69,
+    0x6E, 0x74, 0x6F, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x73,
+    0x20, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20,
+    0x6E, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2E, 0xCF, 0x04, 0x73, 0x70, 0x69, 0x74, 0xD3,
+    0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x84, 0x81,
+    0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x0B,
+    0x03, 0x02, 0x03, 0x07, 0x1C, 0xCE, 0x04, 0x73, 0x70, 0x69,
+    0x74, 0xDA, 0x12, 0xD0, 0x02, 0x77, 0x62, 0xDA, 0x83, 0x79,
+    0xCE, 0x14, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E, 0x6F,
+    0x74, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x66, 0x69, 0x6C,
+    0x65, 0x20, 0xCE, 0x0B, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x6D, 0x6F, 0x64, 0x65, 0x20, 0xDA, 0x81, 0x5A, 0xD8, 0x0A,
+    0x66, 0x69, 0x6C, 0x65, 0x2F, 0x77, 0x72, 0x69, 0x74, 0x65,
+    0xDA, 0x83, 0x7C, 0x28, 0x03, 0x00, 0x00, 0x22, 0x06, 0x00,
+    0x00, 0x1F, 0x05, 0x06, 0x02, 0x1A, 0x05, 0x03, 0x00, 0x26,
+    0x04, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x04, 0x02,
+    0x00, 0x17, 0x05, 0x04, 0x00, 0x2C, 0x00, 0x05, 0x00, 0x26,
+    0x07, 0x01, 0x00, 0x2F, 0x06, 0x07, 0x00, 0x17, 0x07, 0x06,
+    0x00, 0x1A, 0x07, 0x02, 0x00, 0x18, 0x08, 0x00, 0x00, 0x26,
+    0x08, 0x02, 0x00, 0x26, 0x09, 0x03, 0x00, 0x2D, 0x08, 0x00,
+    0x09, 0x2B, 0x05, 0x00, 0x00, 0x26, 0x09, 0x04, 0x00, 0x2F,
+    0x08, 0x09, 0x00, 0x01, 0x08, 0x00, 0x00, 0x2C, 0x07, 0x01,
+    0x00, 0x26, 0x09, 0x05, 0x00, 0x2F, 0x08, 0x09, 0x00, 0x2B,
+    0x07, 0x00, 0x00, 0x26, 0x0A, 0x06, 0x00, 0x2F, 0x09, 0x0A,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x1F, 0x01, 0x82, 0x12, 0x02,
+    0x07, 0x08, 0x04, 0x03, 0x02, 0x0E, 0x01, 0x00, 0x0D, 0x02,
+    0x02, 0x00, 0x06, 0x00, 0x22, 0x01, 0x00, 0x0D, 0x03, 0x02,
+    0x13, 0x03, 0x02, 0x00, 0x01, 0x0F, 0x03, 0xDA, 0x05, 0xCE,
+    0x65, 0x28, 0x73, 0x70, 0x69, 0x74, 0x20, 0x70, 0x61, 0x74,
+    0x68, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x73,
+    0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x65,
+    0x29, 0x0A, 0x0A, 0x57, 0x72, 0x69, 0x74, 0x65, 0x20, 0x63,
+    0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x6F,
+    0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x74,
+    0x20, 0x70, 0x61, 0x74, 0x68, 0x2E, 0x20, 0x20, 0x43, 0x61,
+    0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C,
+    0x6C, 0x79, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x20,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C,
+    0x65, 0x2E, 0xCF, 0x12, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x2F, 0x61, 0x73, 0x63, 0x69, 0x69, 0x2D, 0x6C, 0x6F, 0x77,
+    0x65, 0x72, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x12, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x2F, 0x61, 0x73, 0x63, 0x69, 0x69,
+    0x2D, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0xDA, 0x05, 0xCE, 0x80,
+    0xBE, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x61,
+    0x73, 0x63, 0x69, 0x69, 0x2D, 0x6C, 0x6F, 0x77, 0x65, 0x72,
+    0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77,
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x77, 0x68,
+    0x65, 0x72, 0x65, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x62, 0x79,
+    0x74, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65,
+    0x70, 0x6C, 0x61, 0x63, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x77, 0x65,
+    0x72, 0x63, 0x61, 0x73, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73,
+    0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x6D, 0x73, 0x65, 0x6C, 0x76, 0x65, 0x73, 0x20, 0x69, 0x6E,
+    0x20, 0x41, 0x53, 0x43, 0x49, 0x49, 0x2E, 0x20, 0x44, 0x6F,
+    0x65, 0x73, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61, 0x20,
+    0x76, 0x65, 0x72, 0x79, 0x20, 0x73, 0x69, 0x6D, 0x70, 0x6C,
+    0x65, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x63, 0x68, 0x65,
+    0x63, 0x6B, 0x2C, 0x20, 0x6D, 0x65, 0x61, 0x6E, 0x69, 0x6E,
+    0x67, 0x20, 0x6E, 0x6F, 0x20, 0x75, 0x6E, 0x69, 0x63, 0x6F,
+    0x64, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74,
+    0x2E, 0xCF, 0x03, 0x73, 0x65, 0x71, 0xD3, 0x04, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x81, 0xDC, 0x01, 0xDA, 0x03,
+    0xD7, 0xCD, 0x02, 0x99, 0x00, 0x00, 0x09, 0x01, 0x01, 0xCD,
+    0x7F, 0xFF, 0xFF, 0xFF, 0x05, 0x17, 0xCE, 0x03, 0x73, 0x65,
+    0x71, 0xDA, 0x12, 0xDA, 0x55, 0xDA, 0x56, 0xDA, 0x59, 0xCF,
+    0x0A, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x75, 0x73,
+    0x68, 0xCF, 0x04, 0x6C, 0x6F, 0x6F, 0x70, 0x28, 0x02, 0x00,
+    0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x17,
+    0x04, 0x03, 0x00, 0x3A, 0x05, 0x00, 0x00, 0x26, 0x07, 0x01,
+    0x00, 0x2D, 0x07, 0x04, 0x05, 0x3F, 0x06, 0x00, 0x00, 0x26,
+    0x07, 0x02, 0x00, 0x2B, 0x07, 0x00, 0x00, 0x2E, 0x01, 0x00,
+    0x00, 0x3F, 0x05, 0x00, 0x00, 0x26, 0x08, 0x03, 0x00, 0x2D,
+    0x08, 0x04, 0x05, 0x3F, 0x07, 0x00, 0x00, 0x26, 0x08, 0x04,
+    0x00, 0x2D, 0x08, 0x00, 0x07, 0x3F, 0x05, 0x00, 0x00, 0x26,
+    0x08, 0x02, 0x00, 0x2D, 0x08, 0x06, 0x05, 0x2B, 0x04, 0x00,
+    0x00, 0x3F, 0x07, 0x00, 0x00, 0x03, 0x07, 0x00, 0x00, 0x0D,
+    0x01, 0xB8, 0x07, 0x02, 0x02, 0x08, 0x1C, 0x01, 0x00, 0x17,
+    0x13, 0x02, 0x00, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x78,
+    0x28, 0x73, 0x65, 0x71, 0x20, 0x68, 0x65, 0x61, 0x64, 0x20,
+    0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A, 0x53,
+    0x69, 0x6D, 0x69, 0x6C, 0x61, 0x72, 0x20, 0x74, 0x6F, 0x20,
+    0x6C, 0x6F, 0x6F, 0x70, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20,
+    0x61, 0x63, 0x63, 0x75, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x65,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70,
+    0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x69, 0x6E, 0x74, 0x6F,
+    0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x2E, 0x20, 0x20, 0x53,
+    0x65, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6C, 0x73, 0x2E,
+    0xCF, 0x09, 0x6D, 0x69, 0x6E, 0x2D, 0x6F, 0x72, 0x64, 0x65,
+    0x72, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x82, 0x53, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x99, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x02,
+    0x05, 0xCE, 0x09, 0x6D, 0x69, 0x6E, 0x2D, 0x6F, 0x72, 0x64,
+    0x65, 0x72, 0xDA, 0x12, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x15,
+    0x06, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x10,
+    0xCE, 0x06, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3C, 0x39, 0x01,
+    0x00, 0x00, 0x1E, 0x02, 0x01, 0x02, 0x19, 0x02, 0x0A, 0x00,
+    0x37, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x34, 0x04,
+    0x00, 0x05, 0x1D, 0x02, 0x03, 0x04, 0x1A, 0x02, 0x07, 0x00,
+    0x05, 0x05, 0x05, 0x01, 0x17, 0x03, 0x04, 0x00, 0x1F, 0x02,
+    0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x23, 0x03, 0x00, 0x00,
+    0x03, 0x03, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x03, 0x03,
+    0x00, 0x00, 0xDA, 0x81, 0x2F, 0x28, 0x01, 0x00, 0x00, 0x26,
+    0x02, 0x00, 0x00, 0x2C, 0x02, 0x00, 0x00, 0x26, 0x02, 0x01,
+    0x00, 0x30, 0x02, 0x00, 0x00, 0x07, 0x01, 0xA6, 0x09, 0x02,
+    0x04, 0x06, 0x16, 0xDA, 0x05, 0xCE, 0x65, 0x28, 0x6D, 0x69,
+    0x6E, 0x2D, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x26, 0x20,
+    0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D,
+    0x69, 0x6E, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65,
+    0x6E, 0x74, 0x73, 0x20, 0x61, 0x63, 0x63, 0x6F, 0x72, 0x64,
+    0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x74,
+    0x6F, 0x74, 0x61, 0x6C, 0x20, 0x20, 0x6F, 0x72, 0x64, 0x65,
+    0x72, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x61, 0x6C, 0x6C,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0xCF, 0x0C,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x63, 0x6C, 0x65,
+    0x61, 0x72, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x80, 0xFE, 0xDA,
+    0x05, 0xCE, 0x80, 0xA3, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2F, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x7A, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x30, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x69, 0x65, 0x73, 0x20,
+    0x69, 0x74, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x20, 0x72, 0x65, 0x74, 0x61, 0x69,
+    0x6E, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6D, 0x65, 0x6D,
+    0x6F, 0x72, 0x79, 0x20, 0x73, 0x6F, 0x20, 0x69, 0x74, 0x20,
+    0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x65, 0x66, 0x66,
+    0x69, 0x63, 0x69, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x20, 0x72,
+    0x65, 0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF, 0x03, 0x6E,
+    0x6F, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x4B, 0xDA, 0x05,
+    0xCE, 0x2A, 0x28, 0x6E, 0x6F, 0x74, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E,
+    0x20, 0x69, 0x6E, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x78, 0x2E, 0xCF, 0x10, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x77, 0x6F,
+    0x72, 0x64, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x10, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D,
+    0x77, 0x6F, 0x72, 0x64, 0xDA, 0x05, 0xCE, 0x80, 0xE1, 0x28,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x75, 0x73,
+    0x68, 0x2D, 0x77, 0x6F, 0x72, 0x64, 0x20, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x41, 0x70,
+    0x70, 0x65, 0x6E, 0x64, 0x20, 0x61, 0x20, 0x6D, 0x61, 0x63,
+    0x68, 0x69, 0x6E, 0x65, 0x20, 0x77, 0x6F, 0x72, 0x64, 0x20,
+    0x74, 0x6F, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x34, 0x20, 0x62,
+    0x79, 0x74, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20,
+    0x61, 0x72, 0x65, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64,
+    0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x77, 0x6F, 0x73,
+    0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x2C, 0x20, 0x62, 0x69, 0x67, 0x20, 0x65, 0x6E, 0x64,
+    0x69, 0x61, 0x6E, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2C,
+    0x20, 0x75, 0x6E, 0x73, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65,
+    0x64, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20,
+    0x57, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77,
+    0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20,
+    0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C,
+    0x6F, 0x77, 0x73, 0x2E, 0xCF, 0x0A, 0x6F, 0x73, 0x2F, 0x65,
+    0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x0A, 0x6F, 0x73, 0x2F, 0x65, 0x6E, 0x76, 0x69, 0x72,
+    0x6F, 0x6E, 0xDA, 0x05, 0xCE, 0x35, 0x28, 0x6F, 0x73, 0x2F,
+    0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x29, 0x0A, 0x0A,
+    0x47, 0x65, 0x74, 0x20, 0x61, 0x20, 0x63, 0x6F, 0x70, 0x79,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x73,
+    0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0xCF,
+    0x0A, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x2F, 0x6E, 0x65,
+    0x77, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x74, 0x68, 0x72,
+    0x65, 0x61, 0x64, 0x2F, 0x6E, 0x65, 0x77, 0xDA, 0x05, 0xCE,
+    0x81, 0x2E, 0x28, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x2F,
+    0x6E, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x20, 0x26,
+    0x6F, 0x70, 0x74, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69,
+    0x74, 0x79, 0x29, 0x0A, 0x0A, 0x53, 0x74, 0x61, 0x72, 0x74,
+    0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x68, 0x72,
+    0x65, 0x61, 0x64, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x77,
+    0x69, 0x6C, 0x6C, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20,
+    0x69, 0x6D, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x6C,
+    0x79, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x63, 0x61, 0x70, 0x61,
+    0x63, 0x69, 0x74, 0x79, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72,
+    0x6F, 0x76, 0x69, 0x64, 0x65, 0x64, 0x2C, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x68, 0x6F, 0x77, 0x20,
+    0x6D, 0x61, 0x6E, 0x79, 0x20, 0x6D, 0x65, 0x73, 0x73, 0x61,
+    0x67, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65,
+    0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61,
+    0x64, 0x27, 0x73, 0x20, 0x6D, 0x61, 0x69, 0x6C, 0x62, 0x6F,
+    0x78, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x62,
+    0x6C, 0x6F, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x65,
+    0x6E, 0x64, 0x65, 0x72, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x65,
+    0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20,
+    0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x62, 0x65,
+    0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x31, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x36, 0x35, 0x35, 0x33, 0x35, 0x20, 0x69, 0x6E,
+    0x63, 0x6C, 0x75, 0x73, 0x69, 0x76, 0x65, 0x2C, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74,
+    0x73, 0x20, 0x74, 0x6F, 0x20, 0x31, 0x30, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x68,
+    0x61, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x68, 0x72,
+    0x65, 0x61, 0x64, 0x2E, 0xCF, 0x0B, 0x6D, 0x6F, 0x64, 0x75,
+    0x6C, 0x65, 0x2F, 0x66, 0x69, 0x6E, 0x64, 0xD3, 0x03, 0xDA,
+    0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x87, 0x6F, 0x01, 0xDA,
+    0x03, 0xDA, 0x83, 0x6E, 0xDA, 0x05, 0xCE, 0x81, 0x01, 0x28,
+    0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x66, 0x69, 0x6E,
+    0x64, 0x20, 0x70, 0x61, 0x74, 0x68, 0x29, 0x0A, 0x0A, 0x54,
+    0x72, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x6D, 0x61, 0x74, 0x63,
+    0x68, 0x20, 0x61, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+    0x20, 0x6F, 0x72, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6E,
+    0x61, 0x6D, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E,
+    0x73, 0x20, 0x69, 0x6E, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C,
+    0x65, 0x2F, 0x70, 0x61, 0x74, 0x68, 0x73, 0x2E, 0x20, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x28, 0x66, 0x75, 0x6C,
+    0x6C, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6B, 0x69, 0x6E, 0x64,
+    0x29, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6B, 0x69, 0x6E, 0x64, 0x20, 0x69, 0x73, 0x20,
+    0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x3A, 0x73, 0x6F,
+    0x75, 0x72, 0x63, 0x65, 0x2C, 0x20, 0x3A, 0x6E, 0x61, 0x74,
+    0x69, 0x76, 0x65, 0x2C, 0x20, 0x20, 0x6F, 0x72, 0x20, 0x69,
+    0x6D, 0x61, 0x67, 0x65, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x69,
+    0x73, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x6F,
+    0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x61,
+    0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x66, 0x6F, 0x6C, 0x6C,
+    0x6F, 0x77, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x20, 0x61,
+    0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x6D, 0x65,
+    0x73, 0x73, 0x61, 0x67, 0x65, 0x2E, 0xCF, 0x0A, 0x66, 0x69,
+    0x6C, 0x65, 0x2F, 0x77, 0x72, 0x69, 0x74, 0x65, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x83, 0xD2, 0xDA, 0x05, 0xCE, 0x64, 0x28,
+    0x66, 0x69, 0x6C, 0x65, 0x2F, 0x77, 0x72, 0x69, 0x74, 0x65,
+    0x20, 0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x29, 0x0A,
+    0x0A, 0x57, 0x72, 0x69, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F,
+    0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x20, 0x27,
+    0x62, 0x79, 0x74, 0x65, 0x73, 0x27, 0x20, 0x6D, 0x75, 0x73,
+    0x74, 0x20, 0x62, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x2C, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2C,
+    0x20, 0x6F, 0x72, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0xCF,
+    0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x72, 0x6E, 0x67, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+    0x72, 0x6E, 0x67, 0xDA, 0x05, 0xCE, 0x80, 0xC9, 0x28, 0x6D,
+    0x61, 0x74, 0x68, 0x2F, 0x72, 0x6E, 0x67, 0x20, 0x26, 0x6F,
+    0x70, 0x74, 0x20, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x0A,
+    0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20,
+    0x50, 0x73, 0x75, 0x65, 0x64, 0x6F, 0x2D, 0x52, 0x61, 0x6E,
+    0x64, 0x6F, 0x6D, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72,
+    0x2C, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x6E, 0x20,
+    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x73,
+    0x65, 0x65, 0x64, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73,
+    0x65, 0x65, 0x64, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64,
+    0x20, 0x62, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x75, 0x6E, 0x73,
+    0x69, 0x67, 0x6E, 0x65, 0x64, 0x20, 0x33, 0x32, 0x20, 0x62,
+    0x69, 0x74, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72,
+    0x2E, 0x20, 0x44, 0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x75,
+    0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x63, 0x72, 0x79, 0x70, 0x74, 0x6F, 0x67, 0x72,
+    0x61, 0x70, 0x68, 0x79, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x63, 0x6F, 0x72, 0x65,
+    0x2F, 0x72, 0x6E, 0x67, 0x20, 0x61, 0x62, 0x73, 0x74, 0x72,
+    0x61, 0x63, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x2E, 0xCF,
+    0x0D, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x73, 0x74,
+    0x61, 0x74, 0x75, 0x73, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x82,
+    0xB8, 0xDA, 0x05, 0xCE, 0x80, 0xFD, 0x28, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x72, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x29, 0x0A, 0x0A,
+    0x47, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+    0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x73, 0x74, 0x61,
+    0x74, 0x75, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x73, 0x74,
+    0x61, 0x74, 0x65, 0x20, 0x6D, 0x61, 0x63, 0x68, 0x69, 0x6E,
+    0x65, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61,
+    0x74, 0x75, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62,
+    0x65, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x3A, 0x0A,
+    0x0A, 0x09, 0x3A, 0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+    0x20, 0x2D, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x20, 0x69, 0x73, 0x20, 0x62, 0x65, 0x69, 0x6E, 0x67, 0x20,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x64, 0x2E, 0x0A, 0x09, 0x3A,
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x2D, 0x20, 0x61, 0x20,
+    0x70, 0x61, 0x72, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x65, 0x72,
+    0x72, 0x6F, 0x72, 0x20, 0x77, 0x61, 0x73, 0x20, 0x65, 0x6E,
+    0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x2E,
+    0x0A, 0x09, 0x3A, 0x72, 0x6F, 0x6F, 0x74, 0x20, 0x2D, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x20, 0x63, 0x61, 0x6E, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65,
+    0x72, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x6D, 0x6F, 0x72,
+    0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x6F,
+    0x72, 0x20, 0x73, 0x61, 0x66, 0x65, 0x6C, 0x79, 0x20, 0x74,
+    0x65, 0x72, 0x6D, 0x69, 0x6E, 0x61, 0x74, 0x65, 0x2E, 0xCF,
+    0x06, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x82, 0x09, 0xDA, 0x05, 0xCE, 0x80, 0xCC, 0x28,
+    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x26, 0x20, 0x6B,
+    0x76, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74,
+    0x65, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73, 0x74,
+    0x72, 0x75, 0x63, 0x74, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+    0x61, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x2E,
+    0x20, 0x6B, 0x76, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20,
+    0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6B,
+    0x31, 0x2C, 0x20, 0x76, 0x31, 0x2C, 0x20, 0x6B, 0x32, 0x2C,
+    0x20, 0x76, 0x32, 0x2C, 0x20, 0x6B, 0x33, 0x2C, 0x20, 0x76,
+    0x33, 0x2C, 0x20, 0x2E, 0x2E, 0x2E, 0x20, 0x49, 0x66, 0x20,
+    0x6B, 0x76, 0x73, 0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x6E,
+    0x20, 0x6F, 0x64, 0x64, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+    0x72, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72,
+    0x72, 0x6F, 0x72, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62,
+    0x65, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x6E, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73, 0x74, 0x72, 0x75,
+    0x63, 0x74, 0x2E, 0xCF, 0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+    0x61, 0x74, 0x61, 0x6E, 0x68, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x74, 0x61, 0x6E,
+    0x68, 0xDA, 0x05, 0xCE, 0x36, 0x28, 0x6D, 0x61, 0x74, 0x68,
+    0x2F, 0x61, 0x74, 0x61, 0x6E, 0x68, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x68, 0x79, 0x70, 0x65, 0x72, 0x62, 0x6F, 0x6C,
+    0x69, 0x63, 0x20, 0x61, 0x72, 0x63, 0x74, 0x61, 0x6E, 0x67,
+    0x65, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF,
+    0x06, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0xD3, 0x03, 0xDA,
+    0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x82, 0xB3, 0x01, 0xDA,
+    0x03, 0xDA, 0x83, 0x67, 0xDA, 0x05, 0xCE, 0x80, 0x89, 0x28,
+    0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x20, 0x70, 0x72, 0x65,
+    0x64, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x47, 0x69,
+    0x76, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x70, 0x72, 0x65, 0x64,
+    0x69, 0x63, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x74, 0x61, 0x6B,
+    0x65, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x65, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+    0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+    0x6F, 0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x66,
+    0x6F, 0x72, 0x20, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20,
+    0x28, 0x70, 0x72, 0x65, 0x64, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x29, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72,
+    0x75, 0x74, 0x68, 0x79, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0xCF, 0x0A, 0x66, 0x69,
+    0x6E, 0x64, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0xD3, 0x03,
+    0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x82, 0xEA, 0x01,
+    0xDA, 0x03, 0xDA, 0x81, 0xCF, 0xDA, 0x05, 0xCE, 0x67, 0x28,
+    0x66, 0x69, 0x6E, 0x64, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78,
+    0x20, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x29,
+    0x0A, 0x0A, 0x46, 0x69, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x6F, 0x66, 0x20,
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x74, 0x79,
+    0x70, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x77, 0x68, 0x69,
+    0x63, 0x68, 0x20, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x73,
+    0x20, 0x74, 0x72, 0x75, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69,
+    0x66, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E,
+    0x64, 0x2E, 0xDA, 0x83, 0x04, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x57, 0xDA, 0x05, 0xCE, 0x50, 0x28, 0x74, 0x75, 0x70, 0x6C,
+    0x65, 0x20, 0x26, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x73, 0x29,
+    0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x75, 0x70, 0x6C,
+    0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6F, 0x6E,
+    0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x69, 0x74, 0x65, 0x6D,
+    0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74,
+    0x75, 0x70, 0x6C, 0x65, 0x2E, 0xCF, 0x03, 0x64, 0x65, 0x63,
+    0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x7D,
+    0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x04,
+    0x01, 0x01, 0x01, 0x00, 0x04, 0xCE, 0x03, 0x64, 0x65, 0x63,
+    0xDA, 0x12, 0x28, 0x01, 0x00, 0x00, 0x25, 0x03, 0x01, 0x00,
+    0x07, 0x02, 0x00, 0x03, 0x03, 0x02, 0x00, 0x00, 0x07, 0x01,
+    0xFA, 0x01, 0x02, 0x03, 0x00, 0x3E, 0xDA, 0x05, 0xCE, 0x17,
+    0x28, 0x64, 0x65, 0x63, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x78, 0x20, 0x2D,
+    0x20, 0x31, 0x2E, 0xCF, 0x07, 0x74, 0x72, 0x75, 0x74, 0x68,
+    0x79, 0x3F, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x6A, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00,
+    0x00, 0x03, 0x01, 0x01, 0x01, 0x00, 0x06, 0xCE, 0x07, 0x74,
+    0x72, 0x75, 0x74, 0x68, 0x79, 0x3F, 0xDA, 0x12, 0x28, 0x01,
+    0x00, 0x00, 0x1A, 0x00, 0x03, 0x00, 0x23, 0x02, 0x00, 0x00,
+    0x03, 0x02, 0x00, 0x00, 0x24, 0x02, 0x00, 0x00, 0x03, 0x02,
+    0x00, 0x00, 0x07, 0x01, 0xD4, 0x01, 0x02, 0x05, 0x00, 0x54,
+    0xDA, 0x05, 0xCE, 0x22, 0x28, 0x74, 0x72, 0x75, 0x74, 0x68,
+    0x79, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65,
+    0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73,
+    0x20, 0x74, 0x72, 0x75, 0x74, 0x68, 0x79, 0x2E, 0xCF, 0x06,
+    0x6F, 0x73, 0x2F, 0x64, 0x69, 0x72, 0xD3, 0x02, 0xDA, 0x03,
+    0xD8, 0x06, 0x6F, 0x73, 0x2F, 0x64, 0x69, 0x72, 0xDA, 0x05,
+    0xCE, 0x80, 0xA7, 0x28, 0x6F, 0x73, 0x2F, 0x64, 0x69, 0x72,
+    0x20, 0x64, 0x69, 0x72, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x29, 0x0A, 0x0A, 0x49, 0x74,
+    0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x76, 0x65, 0x72,
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x73, 0x75, 0x62, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
+    0x6F, 0x72, 0x69, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61,
+    0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F,
+    0x66, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x70, 0x61,
+    0x72, 0x74, 0x73, 0x2C, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x6C, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6F, 0x72,
+    0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79,
+    0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x6E, 0x6F, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x2E,
+    0xCF, 0x0A, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x66, 0x6C, 0x75,
+    0x73, 0x68, 0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x66, 0x69,
+    0x6C, 0x65, 0x2F, 0x66, 0x6C, 0x75, 0x73, 0x68, 0xDA, 0x05,
+    0xCE, 0x80, 0x90, 0x28, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x66,
+    0x6C, 0x75, 0x73, 0x68, 0x20, 0x66, 0x29, 0x0A, 0x0A, 0x46,
+    0x6C, 0x75, 0x73, 0x68, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79,
+    0x74, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74,
+    0x65, 0x6D, 0x2E, 0x20, 0x49, 0x6E, 0x20, 0x6D, 0x6F, 0x73,
+    0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x77,
+    0x72, 0x69, 0x74, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x65, 0x64, 0x20, 0x66,
+    0x6F, 0x72, 0x20, 0x65, 0x66, 0x66, 0x69, 0x63, 0x69, 0x65,
+    0x6E, 0x63, 0x79, 0x20, 0x72, 0x65, 0x61, 0x73, 0x6F, 0x6E,
+    0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+    0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x2E, 0xCF, 0x08, 0x73,
+    0x68, 0x6F, 0x72, 0x74, 0x2D, 0x66, 0x6E, 0xD3, 0x04, 0xDA,
+    0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x86, 0x14, 0x01, 0xDA,
+    0x03, 0xD7, 0xCD, 0x02, 0xBA, 0x00, 0x00, 0x12, 0x01, 0x01,
+    0x01, 0x08, 0x2E, 0x02, 0xCE, 0x08, 0x73, 0x68, 0x6F, 0x72,
+    0x74, 0x2D, 0x66, 0x6E, 0xDA, 0x12, 0xD7, 0xCD, 0x02, 0x98,
+    0x00, 0x00, 0x0A, 0x02, 0x01, 0x02, 0x03, 0x19, 0xCE, 0x05,
+    0x6D, 0x61, 0x63, 0x65, 0x78, 0xDA, 0x12, 0xDA, 0x82, 0x0B,
+    0xD8, 0x09, 0x64, 0x65, 0x65, 0x70, 0x2D, 0x6E, 0x6F, 0x74,
+    0x3D, 0xCE, 0x1A, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x65,
+    0x78, 0x70, 0x61, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x74,
+    0x6F, 0x6F, 0x20, 0x6E, 0x65, 0x73, 0x74, 0x65, 0x64, 0x28,
+    0x02, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00, 0x2C, 0x00, 0x01,
+    0x00, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x17,
+    0x05, 0x04, 0x00, 0x25, 0x06, 0x00, 0x00, 0x2C, 0x05, 0x03,
+    0x00, 0x26, 0x08, 0x01, 0x00, 0x2F, 0x07, 0x08, 0x00, 0x1A,
+    0x07, 0x0E, 0x00, 0x25, 0x08, 0x01, 0x00, 0x06, 0x06, 0x06,
+    0x08, 0x25, 0x09, 0xC8, 0x00, 0x43, 0x08, 0x06, 0x09, 0x1A,
+    0x08, 0x04, 0x00, 0x26, 0x09, 0x02, 0x00, 0x01, 0x09, 0x00,
+    0x00, 0x18, 0x01, 0x00, 0x00, 0x17, 0x03, 0x05, 0x00, 0x2C,
+    0x05, 0x01, 0x00, 0x26, 0x08, 0x00, 0x00, 0x2F, 0x05, 0x08,
+    0x00, 0x18, 0xF0, 0xFF, 0xFF, 0x03, 0x05, 0x00, 0x00, 0x31,
+    0x01, 0xCA, 0x17, 0x02, 0x01, 0x0E, 0x04, 0x03, 0x02, 0x1A,
+    0x01, 0x00, 0x19, 0x01, 0x02, 0x00, 0x03, 0x02, 0x0E, 0x01,
+    0x00, 0x0D, 0x02, 0x02, 0x12, 0x02, 0x00, 0x05, 0x01, 0x00,
+    0x07, 0x02, 0x02, 0x04, 0x01, 0x01, 0x03, 0x01, 0x04, 0x00,
+    0x03, 0x02, 0x1A, 0x01, 0x07, 0x1D, 0x01, 0x13, 0x03, 0xCF,
+    0x01, 0x24, 0xDA, 0x83, 0x64, 0xDA, 0x81, 0x1B, 0xDA, 0x83,
+    0x07, 0xCF, 0x02, 0x24, 0x26, 0xDA, 0x80, 0xB4, 0xDA, 0x80,
+    0x87, 0x28, 0x01, 0x00, 0x00, 0x25, 0x02, 0xFF, 0xFF, 0x24,
+    0x03, 0x00, 0x00, 0x2A, 0x04, 0x00, 0x00, 0x17, 0x05, 0x04,
+    0x00, 0x2A, 0x06, 0x01, 0x00, 0x17, 0x07, 0x06, 0x00, 0x2C,
+    0x00, 0x07, 0x00, 0x26, 0x09, 0x00, 0x00, 0x2F, 0x08, 0x09,
+    0x00, 0x17, 0x09, 0x08, 0x00, 0x3A, 0x0A, 0x00, 0x00, 0x17,
+    0x0B, 0x0A, 0x00, 0x25, 0x0A, 0x00, 0x00, 0x25, 0x0D, 0x01,
+    0x00, 0x06, 0x0C, 0x0D, 0x02, 0x17, 0x0D, 0x0C, 0x00, 0x41,
+    0x0C, 0x0A, 0x0D, 0x1A, 0x0C, 0x0C, 0x00, 0x17, 0x0E, 0x0A,
+    0x00, 0x26, 0x0F, 0x01, 0x00, 0x2C, 0x0F, 0x0E, 0x00, 0x26,
+    0x10, 0x02, 0x00, 0x2F, 0x0F, 0x10, 0x00, 0x2C, 0x0B, 0x0F,
+    0x00, 0x26, 0x11, 0x03, 0x00, 0x2F, 0x10, 0x11, 0x00, 0x25,
+    0x0F, 0x01, 0x00, 0x06, 0x0A, 0x0A, 0x0F, 0x18, 0xF4, 0xFF,
+    0xFF, 0x17, 0x0A, 0x0B, 0x00, 0x1A, 0x03, 0x07, 0x00, 0x26,
+    0x0D, 0x04, 0x00, 0x26, 0x0E, 0x05, 0x00, 0x2C, 0x0D, 0x0E,
+    0x00, 0x3F, 0x0D, 0x00, 0x00, 0x17, 0x0C, 0x0D, 0x00, 0x18,
+    0x02, 0x00, 0x00, 0x26, 0x0C, 0x06, 0x00, 0x2E, 0x0A, 0x00,
+    0x00, 0x2E, 0x0C, 0x00, 0x00, 0x40, 0x0D, 0x00, 0x00, 0x26,
+    0x0E, 0x07, 0x00, 0x2D, 0x0E, 0x0D, 0x09, 0x3F, 0x0C, 0x00,
+    0x00, 0x03, 0x0C, 0x00, 0x00, 0xCD, 0x02, 0xD8, 0x00, 0x00,
+    0x04, 0x01, 0x01, 0x01, 0x01, 0x08, 0x01, 0xCE, 0x0F, 0x73,
+    0x61, 0x77, 0x2D, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C,
+    0x2D, 0x61, 0x72, 0x67, 0xDA, 0x12, 0xDA, 0x82, 0x45, 0x28,
+    0x01, 0x00, 0x00, 0x27, 0x02, 0x00, 0x02, 0x2C, 0x02, 0x00,
+    0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x29,
+    0x02, 0x00, 0x02, 0x27, 0x03, 0x00, 0x02, 0x03, 0x03, 0x00,
+    0x00, 0xBF, 0xFF, 0x0A, 0x01, 0xBC, 0x18, 0x06, 0x05, 0x04,
+    0x2C, 0x02, 0x00, 0x27, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x09,
+    0x01, 0x01, 0x01, 0x07, 0x28, 0x01, 0xCE, 0x0A, 0x6F, 0x6E,
+    0x2D, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0xDA, 0x12,
+    0xDA, 0x84, 0x36, 0xDA, 0x83, 0x39, 0xCF, 0x02, 0x24, 0x30,
+    0xDA, 0x84, 0x37, 0xDA, 0x81, 0xCD, 0xD8, 0x0B, 0x73, 0x63,
+    0x61, 0x6E, 0x2D, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0xDA,
+    0x82, 0x18, 0x28, 0x01, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00,
+    0x2C, 0x02, 0x00, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2F, 0x02,
+    0x03, 0x00, 0x1A, 0x02, 0x22, 0x00, 0x26, 0x04, 0x00, 0x00,
+    0x1F, 0x03, 0x04, 0x00, 0x1A, 0x03, 0x07, 0x00, 0x25, 0x04,
+    0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x27, 0x05, 0x00, 0x05,
+    0x2F, 0x04, 0x05, 0x00, 0x26, 0x04, 0x02, 0x00, 0x03, 0x04,
+    0x00, 0x00, 0x26, 0x05, 0x03, 0x00, 0x1F, 0x04, 0x05, 0x00,
+    0x1A, 0x04, 0x04, 0x00, 0x23, 0x05, 0x00, 0x00, 0x29, 0x05,
+    0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00,
+    0x2C, 0x00, 0x05, 0x00, 0x26, 0x06, 0x04, 0x00, 0x2F, 0x05,
+    0x06, 0x00, 0x2B, 0x05, 0x00, 0x00, 0x26, 0x07, 0x05, 0x00,
+    0x2F, 0x06, 0x07, 0x00, 0x17, 0x05, 0x06, 0x00, 0x2B, 0x05,
+    0x00, 0x00, 0x26, 0x07, 0x06, 0x00, 0x2F, 0x06, 0x07, 0x00,
+    0x1A, 0x06, 0x05, 0x00, 0x2B, 0x05, 0x00, 0x00, 0x27, 0x08,
+    0x00, 0x05, 0x2F, 0x07, 0x08, 0x00, 0x18, 0x01, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0x40, 0x01, 0xC2, 0x18, 0x06, 0x04,
+    0x04, 0x0C, 0x01, 0x00, 0x07, 0x02, 0x04, 0x08, 0x01, 0x01,
+    0x03, 0x04, 0x06, 0x08, 0x02, 0x02, 0x00, 0x02, 0x02, 0x03,
+    0x01, 0x09, 0x03, 0x02, 0x0E, 0x08, 0x01, 0x01, 0x03, 0x04,
+    0x0A, 0x30, 0x03, 0x00, 0x19, 0x01, 0x00, 0x11, 0x03, 0x02,
+    0x08, 0x01, 0x00, 0x07, 0x03, 0x02, 0x04, 0x01, 0x01, 0x03,
+    0x01, 0x03, 0x03, 0x01, 0x13, 0x03, 0x01, 0x01, 0x03, 0x34,
+    0x01, 0xA8, 0x18, 0x02, 0x01, 0x10, 0x04, 0x01, 0x02, 0x00,
+    0x02, 0x02, 0x00, 0x02, 0x06, 0x00, 0x03, 0x26, 0x1C, 0x01,
+    0x00, 0x1B, 0x03, 0x02, 0x1A, 0x02, 0x00, 0x24, 0x04, 0x00,
+    0x23, 0x04, 0x00, 0x52, 0x06, 0x00, 0x51, 0x01, 0x00, 0x19,
+    0x01, 0x02, 0x22, 0x04, 0x00, 0x18, 0x03, 0x00, 0x17, 0x07,
+    0x00, 0x21, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x80, 0xFF,
+    0x28, 0x73, 0x68, 0x6F, 0x72, 0x74, 0x2D, 0x66, 0x6E, 0x20,
+    0x61, 0x72, 0x67, 0x29, 0x0A, 0x0A, 0x66, 0x6E, 0x20, 0x73,
+    0x68, 0x6F, 0x72, 0x74, 0x68, 0x61, 0x6E, 0x64, 0x2E, 0x0A,
+    0x0A, 0x20, 0x20, 0x75, 0x73, 0x61, 0x67, 0x65, 0x3A, 0x0A,
+    0x0A, 0x20, 0x20, 0x09, 0x28, 0x73, 0x68, 0x6F, 0x72, 0x74,
+    0x2D, 0x66, 0x6E, 0x20, 0x28, 0x2B, 0x20, 0x24, 0x20, 0x24,
+    0x29, 0x29, 0x20, 0x2D, 0x20, 0x41, 0x20, 0x66, 0x75, 0x6E,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x64, 0x6F, 0x75, 0x62, 0x6C, 0x65, 0x27, 0x73, 0x20,
+    0x69, 0x74, 0x73, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65,
+    0x6E, 0x74, 0x73, 0x2E, 0x0A, 0x20, 0x20, 0x09, 0x28, 0x73,
+    0x68, 0x6F, 0x72, 0x74, 0x2D, 0x66, 0x6E, 0x20, 0x28, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x24, 0x30, 0x20, 0x24,
+    0x31, 0x29, 0x29, 0x20, 0x2D, 0x20, 0x61, 0x63, 0x63, 0x65,
+    0x70, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x75, 0x6C, 0x74,
+    0x69, 0x70, 0x6C, 0x65, 0x20, 0x61, 0x72, 0x67, 0x73, 0x0A,
+    0x20, 0x20, 0x09, 0x7C, 0x28, 0x2B, 0x20, 0x24, 0x20, 0x24,
+    0x29, 0x20, 0x2D, 0x20, 0x75, 0x73, 0x65, 0x20, 0x70, 0x69,
+    0x70, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20,
+    0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x66, 0x6F, 0x72, 0x20,
+    0x74, 0x65, 0x72, 0x73, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x69, 0x74, 0x65, 0x72,
+    0x61, 0x6C, 0x73, 0x0A, 0x20, 0x20, 0x09, 0x7C, 0x28, 0x2B,
+    0x20, 0x24, 0x26, 0x29, 0x20, 0x2D, 0x20, 0x76, 0x61, 0x72,
+    0x69, 0x61, 0x64, 0x69, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x73, 0xCF, 0x03, 0x6B, 0x76, 0x73,
+    0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x84,
+    0x4D, 0x01, 0xDA, 0x03, 0xDA, 0x82, 0x07, 0xDA, 0x05, 0xCE,
+    0x77, 0x28, 0x6B, 0x76, 0x73, 0x20, 0x64, 0x69, 0x63, 0x74,
+    0x29, 0x0A, 0x0A, 0x54, 0x61, 0x6B, 0x65, 0x73, 0x20, 0x61,
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x72, 0x20,
+    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F,
+    0x66, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20, 0x20, 0x6C,
+    0x69, 0x6B, 0x65, 0x20, 0x40, 0x5B, 0x6B, 0x20, 0x76, 0x20,
+    0x6B, 0x20, 0x76, 0x20, 0x2E, 0x2E, 0x2E, 0x5D, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E,
+    0xCF, 0x04, 0x73, 0x6F, 0x6D, 0x65, 0xD3, 0x03, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x85, 0xDE, 0x01, 0xDA, 0x03,
+    0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x0A, 0x02, 0x02, 0x02,
+    0x01, 0x19, 0xCE, 0x04, 0x73, 0x6F, 0x6D, 0x65, 0xDA, 0x12,
+    0xDA, 0x4B, 0x28, 0x02, 0x00, 0x00, 0x22, 0x03, 0x00, 0x00,
+    0x25, 0x04, 0x00, 0x00, 0x39, 0x05, 0x01, 0x00, 0x17, 0x06,
+    0x05, 0x00, 0x41, 0x05, 0x04, 0x06, 0x1A, 0x05, 0x12, 0x00,
+    0x34, 0x07, 0x01, 0x04, 0x17, 0x08, 0x07, 0x00, 0x2B, 0x03,
+    0x00, 0x00, 0x26, 0x09, 0x00, 0x00, 0x2F, 0x07, 0x09, 0x00,
+    0x1A, 0x07, 0x02, 0x00, 0x18, 0x02, 0x00, 0x00, 0x18, 0x0A,
+    0x00, 0x00, 0x2B, 0x08, 0x00, 0x00, 0x2F, 0x07, 0x00, 0x00,
+    0x17, 0x09, 0x07, 0x00, 0x1A, 0x09, 0x03, 0x00, 0x17, 0x03,
+    0x09, 0x00, 0x18, 0x01, 0x00, 0x00, 0x25, 0x07, 0x01, 0x00,
+    0x06, 0x04, 0x04, 0x07, 0x18, 0xEE, 0xFF, 0xFF, 0x03, 0x03,
+    0x00, 0x00, 0x22, 0x01, 0xBC, 0x17, 0x02, 0x01, 0x06, 0x04,
+    0x07, 0x02, 0x00, 0x03, 0x00, 0x2E, 0x03, 0x00, 0x2D, 0x02,
+    0x00, 0x5A, 0x02, 0x00, 0x15, 0x01, 0x00, 0x2A, 0x01, 0x00,
+    0x29, 0x03, 0x00, 0x43, 0x01, 0x07, 0x03, 0xDA, 0x05, 0xCE,
+    0x61, 0x28, 0x73, 0x6F, 0x6D, 0x65, 0x20, 0x70, 0x72, 0x65,
+    0x64, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65,
+    0x20, 0x69, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x78, 0x73,
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65,
+    0x20, 0x6F, 0x72, 0x20, 0x6E, 0x69, 0x6C, 0x2C, 0x20, 0x6F,
+    0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x72, 0x75,
+    0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0xCF, 0x0E,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x73, 0x65, 0x74, 0x70,
+    0x72, 0x6F, 0x74, 0x6F, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x83,
+    0x72, 0xDA, 0x05, 0xCE, 0x59, 0x28, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x2F, 0x73, 0x65, 0x74, 0x70, 0x72, 0x6F, 0x74, 0x6F,
+    0x20, 0x74, 0x61, 0x62, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F,
+    0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x72, 0x69, 0x67, 0x69,
+    0x6E, 0x61, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+    0x74, 0x61, 0x62, 0x2E, 0xCF, 0x04, 0x6B, 0x65, 0x79, 0x73,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x83, 0x84, 0xDA, 0x05, 0xCE,
+    0x38, 0x28, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B,
+    0x65, 0x79, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E, 0x20,
+    0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x69, 0x76,
+    0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0xCF, 0x12, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x68, 0x61, 0x73, 0x2D,
+    0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3F, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x83, 0x39, 0xDA, 0x05, 0xCE, 0x40, 0x28, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x68, 0x61, 0x73, 0x2D,
+    0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x3F, 0x20, 0x70, 0x66,
+    0x78, 0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x54, 0x65,
+    0x73, 0x74, 0x73, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68, 0x65,
+    0x72, 0x20, 0x73, 0x74, 0x72, 0x20, 0x73, 0x74, 0x61, 0x72,
+    0x74, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x70, 0x66,
+    0x78, 0x2E, 0xCF, 0x0E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x2F, 0x62, 0x69, 0x74, 0x2D, 0x73, 0x65, 0x74, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x0E, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x2F, 0x62, 0x69, 0x74, 0x2D, 0x73, 0x65, 0x74, 0xDA, 0x05,
+    0xCE, 0x57, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F,
+    0x62, 0x69, 0x74, 0x2D, 0x73, 0x65, 0x74, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78,
+    0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x62, 0x69, 0x74, 0x20, 0x61, 0x74, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x62,
+    0x69, 0x74, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF,
+    0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x73, 0x69, 0x6E,
+    0xD3, 0x02, 0xDA, 0x03, 0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68,
+    0x2F, 0x61, 0x73, 0x69, 0x6E, 0xDA, 0x05, 0xCE, 0x28, 0x28,
+    0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x73, 0x69, 0x6E, 0x20,
+    0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x63, 0x73,
+    0x69, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xCF,
+    0x01, 0x25, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x32, 0xDA, 0x05,
+    0xCE, 0x42, 0x28, 0x25, 0x20, 0x64, 0x69, 0x76, 0x69, 0x64,
+    0x65, 0x6E, 0x64, 0x20, 0x64, 0x69, 0x76, 0x69, 0x73, 0x6F,
+    0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6D, 0x61,
+    0x69, 0x6E, 0x64, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x64,
+    0x69, 0x76, 0x69, 0x64, 0x65, 0x6E, 0x64, 0x20, 0x2F, 0x20,
+    0x64, 0x69, 0x76, 0x69, 0x73, 0x6F, 0x72, 0x2E, 0xCF, 0x06,
+    0x67, 0x65, 0x74, 0x2D, 0x69, 0x6E, 0xD3, 0x03, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x83, 0xF4, 0x01, 0xDA, 0x03,
+    0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x0A, 0x03, 0x02, 0x03,
+    0x00, 0x15, 0xCE, 0x06, 0x67, 0x65, 0x74, 0x2D, 0x69, 0x6E,
+    0xDA, 0x12, 0x28, 0x03, 0x00, 0x00, 0x17, 0x04, 0x00, 0x00,
+    0x25, 0x05, 0x00, 0x00, 0x39, 0x06, 0x01, 0x00, 0x17, 0x07,
+    0x06, 0x00, 0x41, 0x06, 0x05, 0x07, 0x1A, 0x06, 0x0A, 0x00,
+    0x34, 0x08, 0x01, 0x05, 0x17, 0x09, 0x08, 0x00, 0x1A, 0x04,
+    0x02, 0x00, 0x18, 0x02, 0x00, 0x00, 0x18, 0x05, 0x00, 0x00,
+    0x35, 0x04, 0x04, 0x09, 0x25, 0x08, 0x01, 0x00, 0x06, 0x05,
+    0x05, 0x08, 0x18, 0xF6, 0xFF, 0xFF, 0x22, 0x06, 0x00, 0x00,
+    0x1F, 0x05, 0x06, 0x04, 0x1A, 0x05, 0x02, 0x00, 0x03, 0x02,
+    0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x16, 0x01, 0xE8, 0x0F,
+    0x02, 0x01, 0x08, 0x04, 0x0A, 0x02, 0x00, 0x01, 0x00, 0x42,
+    0x03, 0x00, 0x41, 0x02, 0x02, 0x08, 0x03, 0x00, 0x07, 0xDA,
+    0x05, 0xCE, 0x7B, 0x28, 0x67, 0x65, 0x74, 0x2D, 0x69, 0x6E,
+    0x20, 0x64, 0x73, 0x20, 0x6B, 0x73, 0x20, 0x26, 0x6F, 0x70,
+    0x74, 0x20, 0x64, 0x66, 0x6C, 0x74, 0x29, 0x0A, 0x0A, 0x41,
+    0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x61, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x6E,
+    0x65, 0x73, 0x74, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61,
+    0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+    0x2E, 0x20, 0x4C, 0x6F, 0x6F, 0x6B, 0x73, 0x20, 0x69, 0x6E,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74,
+    0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72,
+    0x65, 0x20, 0x76, 0x69, 0x61, 0x20, 0x20, 0x61, 0x20, 0x73,
+    0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66,
+    0x20, 0x6B, 0x65, 0x79, 0x73, 0x2E, 0xCF, 0x01, 0x2A, 0xD3,
+    0x02, 0xDA, 0x03, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x0B, 0x06,
+    0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x13, 0xCE,
+    0x01, 0x2A, 0x39, 0x01, 0x00, 0x00, 0x20, 0x02, 0x01, 0x00,
+    0x1A, 0x02, 0x03, 0x00, 0x25, 0x03, 0x01, 0x00, 0x03, 0x03,
+    0x00, 0x00, 0x20, 0x02, 0x01, 0x01, 0x1A, 0x02, 0x05, 0x00,
+    0x25, 0x03, 0x01, 0x00, 0x37, 0x04, 0x00, 0x00, 0x09, 0x03,
+    0x03, 0x04, 0x03, 0x03, 0x00, 0x00, 0x37, 0x03, 0x00, 0x00,
+    0x25, 0x05, 0x01, 0x00, 0x34, 0x04, 0x00, 0x05, 0x09, 0x03,
+    0x03, 0x04, 0x05, 0x05, 0x05, 0x01, 0x1F, 0x02, 0x05, 0x01,
+    0x1A, 0x02, 0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xDA, 0x05,
+    0xCE, 0x4F, 0x28, 0x2A, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63,
+    0x74, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x65,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x69, 0x6E,
+    0x20, 0x78, 0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x78, 0x73,
+    0x20, 0x69, 0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2C,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x31,
+    0x2E, 0xCF, 0x01, 0x2B, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x21,
+    0xDA, 0x05, 0xCE, 0x68, 0x28, 0x2B, 0x20, 0x26, 0x20, 0x78,
+    0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x75, 0x6D, 0x20,
+    0x6F, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x78, 0x73, 0x2E,
+    0x20, 0x78, 0x73, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62,
+    0x65, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x73,
+    0x20, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x61, 0x6C, 0x20, 0x6E,
+    0x75, 0x6D, 0x62, 0x65, 0x72, 0x73, 0x20, 0x6F, 0x6E, 0x6C,
+    0x79, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69,
+    0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2C, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x30, 0x2E, 0xCF, 0x08,
+    0x6F, 0x73, 0x2F, 0x73, 0x6C, 0x65, 0x65, 0x70, 0xD3, 0x02,
+    0xDA, 0x03, 0xD8, 0x08, 0x6F, 0x73, 0x2F, 0x73, 0x6C, 0x65,
+    0x65, 0x70, 0xDA, 0x05, 0xCE, 0x60, 0x28, 0x6F, 0x73, 0x2F,
+    0x73, 0x6C, 0x65, 0x65, 0x70, 0x20, 0x6E, 0x73, 0x65, 0x63,
+    0x29, 0x0A, 0x0A, 0x53, 0x75, 0x73, 0x70, 0x65, 0x6E, 0x64,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72,
+    0x61, 0x6D, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6E, 0x73, 0x65,
+    0x63, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x2E,
+    0x20, 0x27, 0x6E, 0x73, 0x65, 0x63, 0x27, 0x20, 0x63, 0x61,
+    0x6E, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x72, 0x65, 0x61,
+    0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69,
+    0x6C, 0x2E, 0xCF, 0x01, 0x2D, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x6E, 0xDA, 0x05, 0xCE, 0x80, 0xDB, 0x28, 0x2D, 0x20, 0x26,
+    0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x69,
+    0x66, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x78, 0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x78,
+    0x73, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79,
+    0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x30, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x78, 0x73, 0x20, 0x68,
+    0x61, 0x73, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x65, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65,
+    0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20,
+    0x4F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2C,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x65,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20,
+    0x78, 0x73, 0x20, 0x6D, 0x69, 0x6E, 0x75, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x2E, 0xCF, 0x01, 0x2F, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x81, 0x3E, 0xDA, 0x05, 0xCE, 0x80, 0xFA,
+    0x28, 0x2F, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x71, 0x75, 0x6F, 0x74, 0x69, 0x65, 0x6E, 0x74,
+    0x20, 0x6F, 0x66, 0x20, 0x78, 0x73, 0x2E, 0x20, 0x49, 0x66,
+    0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6D, 0x70,
+    0x74, 0x79, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x31, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x78, 0x73,
+    0x20, 0x68, 0x61, 0x73, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x78, 0x2C, 0x20, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x72, 0x65, 0x63, 0x69, 0x70, 0x72, 0x6F, 0x63, 0x61, 0x6C,
+    0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0x20, 0x4F, 0x74, 0x68,
+    0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x72, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x72, 0x73, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x6F, 0x66, 0x20, 0x78, 0x73, 0x20, 0x72, 0x65, 0x70, 0x65,
+    0x61, 0x74, 0x65, 0x64, 0x6C, 0x79, 0x20, 0x64, 0x69, 0x76,
+    0x69, 0x64, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x72, 0x65, 0x6D, 0x61, 0x69, 0x6E, 0x69, 0x6E,
+    0x67, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0x20,
+    0x44, 0x69, 0x76, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x62,
+    0x79, 0x20, 0x74, 0x77, 0x6F, 0x20, 0x69, 0x6E, 0x74, 0x65,
+    0x67, 0x65, 0x72, 0x73, 0x20, 0x75, 0x73, 0x65, 0x73, 0x20,
+    0x74, 0x72, 0x75, 0x6E, 0x63, 0x61, 0x74, 0x69, 0x6E, 0x67,
+    0x20, 0x64, 0x69, 0x76, 0x69, 0x73, 0x69, 0x6F, 0x6E, 0x2E,
+    0xCF, 0x0D, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x66,
+    0x6F, 0x72, 0x6D, 0x61, 0x74, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x81, 0x58, 0xDA, 0x05, 0xCE, 0x80, 0x82, 0x28, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2F, 0x66, 0x6F, 0x72, 0x6D, 0x61,
+    0x74, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x66,
+    0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x26, 0x20, 0x61, 0x72,
+    0x67, 0x73, 0x29, 0x0A, 0x0A, 0x53, 0x6E, 0x70, 0x72, 0x69,
+    0x6E, 0x74, 0x66, 0x20, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x66,
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x69,
+    0x74, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x70, 0x72, 0x69,
+    0x6E, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xCF, 0x0A, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x65, 0x65, 0x6B, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x0A, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2F, 0x70, 0x65, 0x65, 0x6B, 0xDA, 0x05, 0xCE, 0x53, 0x28,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x65, 0x65, 0x6B,
+    0x20, 0x61, 0x72, 0x72, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C,
+    0x61, 0x73, 0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x44, 0x6F, 0x65, 0x73,
+    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66,
+    0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x2E, 0xCF, 0x0B, 0x70, 0x65, 0x67, 0x2F, 0x63, 0x6F,
+    0x6D, 0x70, 0x69, 0x6C, 0x65, 0xD3, 0x02, 0xDA, 0x03, 0xD8,
+    0x0B, 0x70, 0x65, 0x67, 0x2F, 0x63, 0x6F, 0x6D, 0x70, 0x69,
+    0x6C, 0x65, 0xDA, 0x05, 0xCE, 0x80, 0x93, 0x28, 0x70, 0x65,
+    0x67, 0x2F, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20,
+    0x70, 0x65, 0x67, 0x29, 0x0A, 0x0A, 0x43, 0x6F, 0x6D, 0x70,
+    0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x20, 0x70, 0x65, 0x67,
+    0x20, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x64, 0x61,
+    0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75,
+    0x72, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20,
+    0x3C, 0x63, 0x6F, 0x72, 0x65, 0x2F, 0x70, 0x65, 0x67, 0x3E,
+    0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x77, 0x69, 0x6C,
+    0x6C, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x20, 0x75, 0x70,
+    0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x20,
+    0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D,
+    0x65, 0x20, 0x70, 0x65, 0x67, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+    0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x6D,
+    0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x74, 0x69,
+    0x6D, 0x65, 0x73, 0x2E, 0xCF, 0x0D, 0x6F, 0x73, 0x2F, 0x63,
+    0x72, 0x79, 0x70, 0x74, 0x6F, 0x72, 0x61, 0x6E, 0x64, 0xD3,
+    0x02, 0xDA, 0x03, 0xD8, 0x0D, 0x6F, 0x73, 0x2F, 0x63, 0x72,
+    0x79, 0x70, 0x74, 0x6F, 0x72, 0x61, 0x6E, 0x64, 0xDA, 0x05,
+    0xCE, 0x7E, 0x28, 0x6F, 0x73, 0x2F, 0x63, 0x72, 0x79, 0x70,
+    0x74, 0x6F, 0x72, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x20, 0x26,
+    0x6F, 0x70, 0x74, 0x20, 0x62, 0x75, 0x66, 0x29, 0x0A, 0x0A,
+    0x47, 0x65, 0x74, 0x20, 0x6F, 0x72, 0x20, 0x61, 0x70, 0x70,
+    0x65, 0x6E, 0x64, 0x20, 0x6E, 0x20, 0x62, 0x79, 0x74, 0x65,
+    0x73, 0x20, 0x6F, 0x66, 0x20, 0x67, 0x6F, 0x6F, 0x64, 0x20,
+    0x71, 0x75, 0x61, 0x6C, 0x69, 0x74, 0x79, 0x20, 0x72, 0x61,
+    0x6E, 0x64, 0x6F, 0x6D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
+    0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x62,
+    0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x73, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x6E, 0x65, 0x77, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x20, 0x6F, 0x72, 0x20, 0x62, 0x75, 0x66, 0x2E, 0xCF, 0x03,
+    0x61, 0x6C, 0x6C, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00,
+    0xDA, 0x12, 0x85, 0xD7, 0x01, 0xDA, 0x03, 0xD7, 0xCD, 0x02,
+    0x98, 0x00, 0x00, 0x09, 0x02, 0x02, 0x02, 0x00, 0x12, 0xCE,
+    0x03, 0x61, 0x6C, 0x6C, 0xDA, 0x12, 0x28, 0x02, 0x00, 0x00,
+    0x23, 0x03, 0x00, 0x00, 0x25, 0x04, 0x00, 0x00, 0x39, 0x05,
+    0x01, 0x00, 0x17, 0x06, 0x05, 0x00, 0x41, 0x05, 0x04, 0x06,
+    0x1A, 0x05, 0x0B, 0x00, 0x34, 0x07, 0x01, 0x04, 0x17, 0x08,
+    0x07, 0x00, 0x1A, 0x03, 0x02, 0x00, 0x18, 0x02, 0x00, 0x00,
+    0x18, 0x06, 0x00, 0x00, 0x2B, 0x08, 0x00, 0x00, 0x2F, 0x03,
+    0x00, 0x00, 0x25, 0x07, 0x01, 0x00, 0x06, 0x04, 0x04, 0x07,
+    0x18, 0xF5, 0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00, 0x13, 0x01,
+    0xAE, 0x17, 0x02, 0x01, 0x06, 0x04, 0x0A, 0x02, 0x00, 0x02,
+    0x00, 0x4A, 0x03, 0x00, 0x49, 0x01, 0x07, 0x03, 0xDA, 0x05,
+    0xCE, 0x59, 0x28, 0x61, 0x6C, 0x6C, 0x20, 0x70, 0x72, 0x65,
+    0x64, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20,
+    0x69, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x78, 0x73, 0x20,
+    0x61, 0x72, 0x65, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68, 0x79,
+    0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73,
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x6F, 0x72,
+    0x20, 0x6E, 0x69, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x2E, 0xCF, 0x04, 0x62, 0x78, 0x6F, 0x72, 0xD3, 0x02, 0xDA,
+    0x03, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x0F, 0x06, 0x00, 0x00,
+    0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x13, 0xCE, 0x04, 0x62,
+    0x78, 0x6F, 0x72, 0x39, 0x01, 0x00, 0x00, 0x20, 0x02, 0x01,
+    0x00, 0x1A, 0x02, 0x03, 0x00, 0x25, 0x03, 0x00, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x20, 0x02, 0x01, 0x01, 0x1A, 0x02, 0x05,
+    0x00, 0x25, 0x03, 0x00, 0x00, 0x37, 0x04, 0x00, 0x00, 0x0E,
+    0x03, 0x03, 0x04, 0x03, 0x03, 0x00, 0x00, 0x37, 0x03, 0x00,
+    0x00, 0x25, 0x05, 0x01, 0x00, 0x34, 0x04, 0x00, 0x05, 0x0E,
+    0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x01, 0x1F, 0x02, 0x05,
+    0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03, 0x03, 0x00, 0x00, 0xDA,
+    0x05, 0xCE, 0x59, 0x28, 0x62, 0x78, 0x6F, 0x72, 0x20, 0x26,
+    0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69,
+    0x74, 0x2D, 0x77, 0x69, 0x73, 0x65, 0x20, 0x78, 0x6F, 0x72,
+    0x20, 0x6F, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x78, 0x73,
+    0x2E, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x69, 0x6E, 0x20,
+    0x78, 0x73, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65,
+    0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65,
+    0x72, 0x2E, 0xCF, 0x01, 0x3C, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x81, 0x2D, 0xDA, 0x05, 0xCE, 0x4B, 0x28, 0x3C, 0x20, 0x26,
+    0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63,
+    0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73,
+    0x20, 0x69, 0x6E, 0x20, 0x6E, 0x75, 0x6D, 0x65, 0x72, 0x69,
+    0x63, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x61, 0x73, 0x63, 0x65,
+    0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x72, 0x64, 0x65,
+    0x72, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x61, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E,
+    0x2E, 0xDA, 0x81, 0x36, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81,
+    0xC2, 0xDA, 0x05, 0xCE, 0x49, 0x28, 0x3D, 0x20, 0x26, 0x20,
+    0x78, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x66,
+    0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x73, 0x20, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x20, 0x61, 0x72,
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65,
+    0x2C, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x6F, 0x74,
+    0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2E, 0xCF, 0x01,
+    0x3E, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x82, 0x44, 0xDA, 0x05,
+    0xCE, 0x4C, 0x28, 0x3E, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29,
+    0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+    0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x20,
+    0x6E, 0x75, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6C, 0x6C,
+    0x79, 0x20, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6E, 0x64, 0x69,
+    0x6E, 0x67, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xCF, 0x07,
+    0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0xD3, 0x03, 0xDA,
+    0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x87, 0xCE, 0x01, 0xDA,
+    0x03, 0xD7, 0xCD, 0x02, 0x99, 0x00, 0x00, 0x0A, 0x01, 0x01,
+    0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x06, 0x22, 0xCE, 0x07, 0x72,
+    0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0xDA, 0x12, 0xDA, 0x83,
+    0x6E, 0xDA, 0x83, 0x70, 0xD3, 0x03, 0xDA, 0x83, 0x36, 0xD7,
+    0xCD, 0x02, 0x90, 0x00, 0x00, 0x03, 0x01, 0x01, 0xCD, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x02, 0x06, 0xDA, 0x12, 0xD7, 0xCD, 0x02,
+    0x98, 0x00, 0x00, 0x08, 0x01, 0x01, 0x01, 0x07, 0x16, 0xCE,
+    0x05, 0x73, 0x6C, 0x75, 0x72, 0x70, 0xDA, 0x12, 0xDA, 0x83,
+    0x78, 0xDA, 0x83, 0x79, 0xDA, 0x83, 0xD0, 0xDA, 0x81, 0x5A,
+    0xD0, 0x03, 0x61, 0x6C, 0x6C, 0xDA, 0x83, 0x7D, 0xDA, 0x83,
+    0x7C, 0x28, 0x01, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x2C,
+    0x00, 0x02, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2F, 0x02, 0x03,
+    0x00, 0x17, 0x03, 0x02, 0x00, 0x1A, 0x03, 0x02, 0x00, 0x18,
+    0x06, 0x00, 0x00, 0x26, 0x04, 0x02, 0x00, 0x2C, 0x04, 0x00,
+    0x00, 0x26, 0x05, 0x03, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x01,
+    0x04, 0x00, 0x00, 0x26, 0x04, 0x04, 0x00, 0x2C, 0x03, 0x04,
+    0x00, 0x26, 0x05, 0x05, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x17,
+    0x05, 0x04, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x07, 0x06,
+    0x00, 0x2F, 0x06, 0x07, 0x00, 0x03, 0x05, 0x00, 0x00, 0x1F,
+    0x01, 0xEE, 0x11, 0x02, 0x04, 0x08, 0x12, 0x01, 0x00, 0x0D,
+    0x02, 0x02, 0x00, 0x04, 0x00, 0x22, 0x01, 0x00, 0x0D, 0x04,
+    0x02, 0x08, 0x01, 0x00, 0x1B, 0x03, 0x02, 0x00, 0x01, 0x0D,
+    0x03, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x0A, 0x01, 0x01,
+    0x01, 0x0C, 0x3F, 0xCE, 0x0A, 0x6C, 0x6F, 0x61, 0x64, 0x2D,
+    0x69, 0x6D, 0x61, 0x67, 0x65, 0xDA, 0x12, 0xCE, 0x05, 0x7F,
+    0x4A, 0x49, 0x4D, 0x47, 0xDA, 0x83, 0x39, 0xCE, 0x1B, 0x75,
+    0x6E, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64,
+    0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x66, 0x6F, 0x72,
+    0x6D, 0x61, 0x74, 0x20, 0x25, 0x76, 0xD8, 0x0D, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x6F, 0x72, 0x6D, 0x61,
+    0x74, 0xDA, 0x82, 0xC6, 0xDA, 0x82, 0x24, 0xCE, 0x14, 0x69,
+    0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x69, 0x6D, 0x61,
+    0x67, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0xDA,
+    0x81, 0xCD, 0xCE, 0x05, 0x31, 0x2E, 0x36, 0x2E, 0x30, 0xCE,
+    0x2D, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x77, 0x61, 0x73,
+    0x20, 0x6D, 0x61, 0x64, 0x65, 0x20, 0x62, 0x79, 0x20, 0x6A,
+    0x61, 0x6E, 0x65, 0x74, 0x20, 0x25, 0x73, 0x2C, 0x20, 0x65,
+    0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x6A, 0x61,
+    0x6E, 0x65, 0x74, 0x20, 0x25, 0x73, 0xD3, 0x81, 0xC0, 0xDA,
+    0x01, 0xDA, 0x04, 0xDA, 0x07, 0xDA, 0x09, 0xDA, 0x0B, 0xDA,
+    0x0D, 0xDA, 0x0F, 0xDA, 0x1A, 0xDA, 0x1C, 0xDA, 0x23, 0xDA,
+    0x26, 0xDA, 0x28, 0xDA, 0x2A, 0xDA, 0x2C, 0xDA, 0x2E, 0xDA,
+    0x33, 0xDA, 0x35, 0xDA, 0x39, 0xDA, 0x3B, 0xDA, 0x3F, 0xDA,
+    0x41, 0xDA, 0x5A, 0xDA, 0x5C, 0xDA, 0x5E, 0xDA, 0x60, 0xDA,
+    0x62, 0xDA, 0x64, 0xDA, 0x67, 0xDA, 0x69, 0xDA, 0x6F, 0xDA,
+    0x71, 0xDA, 0x73, 0xDA, 0x75, 0xDA, 0x77, 0xDA, 0x79, 0xDA,
+    0x7D, 0xDA, 0x7F, 0xDA, 0x80, 0x81, 0xDA, 0x80, 0x83, 0xDA,
+    0x80, 0x8A, 0xDA, 0x80, 0x8C, 0xDA, 0x80, 0x90, 0xDA, 0x80,
+    0x92, 0xDA, 0x80, 0x94, 0xDA, 0x80, 0x96, 0xDA, 0x80, 0x98,
+    0xDA, 0x80, 0x9A, 0xDA, 0x80, 0xA2, 0xDA, 0x80, 0xA4, 0xDA,
+    0x80, 0xA6, 0xDA, 0x80, 0xA8, 0xDA, 0x80, 0xAA, 0xDA, 0x80,
+    0xAC, 0xDA, 0x80, 0xAE, 0xDA, 0x80, 0xB0, 0xDA, 0x80, 0xB7,
+    0xDA, 0x80, 0xB9, 0xDA, 0x80, 0xBD, 0xDA, 0x80, 0xBF, 0xDA,
+    0x80, 0xC3, 0xDA, 0x80, 0xC5, 0xDA, 0x80, 0xC7, 0xDA, 0x80,
+    0xC9, 0xDA, 0x80, 0xCE, 0xDA, 0x80, 0xD0, 0xDA, 0x80, 0xD2,
+    0xDA, 0x80, 0xD4, 0xDA, 0x80, 0xD6, 0xDA, 0x80, 0xD8, 0xDA,
+    0x80, 0xDA, 0xDA, 0x80, 0xDC, 0xDA, 0x80, 0xE0, 0xDA, 0x80,
+    0xE2, 0xDA, 0x80, 0xE6, 0xDA, 0x80, 0xE8, 0xDA, 0x80, 0xEC,
+    0xDA, 0x80, 0xEE, 0xDA, 0x80, 0xF0, 0xDA, 0x80, 0xF2, 0xDA,
+    0x80, 0xFF, 0xDA, 0x81, 0x01, 0xDA, 0x81, 0x03, 0xDA, 0x81,
+    0x05, 0xDA, 0x81, 0x09, 0xDA, 0x81, 0x0B, 0xDA, 0x81, 0x0D,
+    0xDA, 0x81, 0x0F, 0xDA, 0x81, 0x1E, 0xDA, 0x81, 0x20, 0xDA,
+    0x81, 0x22, 0xDA, 0x81, 0x24, 0xDA, 0x81, 0x26, 0xDA, 0x81,
+    0x28, 0xDA, 0x81, 0x30, 0xDA, 0x81, 0x32, 0xDA, 0x81, 0x37,
+    0xDA, 0x81, 0x39, 0xDA, 0x81, 0x3F, 0xDA, 0x81, 0x43, 0xDA,
+    0x81, 0x46, 0xDA, 0x81, 0x48, 0xDA, 0x81, 0x4B, 0xDA, 0x81,
+    0x4D, 0xDA, 0x81, 0x4F, 0xCF, 0x0B, 0x62, 0x6F, 0x6F, 0x74,
+    0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0xD3, 0x00, 0xDA,
+    0x81, 0x51, 0xDA, 0x81, 0x5C, 0xDA, 0x81, 0x5E, 0xDA, 0x81,
+    0x60, 0xDA, 0x81, 0x62, 0xDA, 0x81, 0x66, 0xDA, 0x81, 0x68,
+    0xDA, 0x81, 0x6A, 0xDA, 0x81, 0x6C, 0xDA, 0x81, 0x6E, 0xDA,
+    0x81, 0x70, 0xDA, 0x81, 0x77, 0xDA, 0x81, 0x79, 0xDA, 0x81,
+    0x18, 0xDA, 0x81, 0x7C, 0xDA, 0x81, 0x7E, 0xDA, 0x81, 0x80,
+    0xDA, 0x81, 0x82, 0xDA, 0x81, 0x84, 0xDA, 0x81, 0x86, 0xDA,
+    0x81, 0x88, 0xDA, 0x81, 0x8C, 0xDA, 0x81, 0x8E, 0xDA, 0x81,
+    0x90, 0xDA, 0x81, 0x92, 0xDA, 0x81, 0x96, 0xDA, 0x81, 0x98,
+    0xDA, 0x81, 0x9A, 0xDA, 0x81, 0x9C, 0xDA, 0x81, 0xA1, 0xDA,
+    0x81, 0xA3, 0xDA, 0x81, 0xA6, 0xDA, 0x81, 0xA8, 0xDA, 0x81,
+    0xAA, 0xDA, 0x81, 0xAC, 0xDA, 0x81, 0xAE, 0xDA, 0x81, 0xB0,
+    0xDA, 0x81, 0xB3, 0xDA, 0x81, 0xB5, 0xDA, 0x81, 0xB7, 0xDA,
+    0x81, 0xB9, 0xDA, 0x81, 0xBB, 0xDA, 0x81, 0xBD, 0xDA, 0x81,
+    0xC3, 0xDA, 0x81, 0xC5, 0xDA, 0x81, 0xC7, 0xDA, 0x81, 0xC9,
+    0xDA, 0x81, 0xD2, 0xDA, 0x81, 0xD4, 0xDA, 0x81, 0xD6, 0xDA,
+    0x81, 0xD8, 0xDA, 0x81, 0xDA, 0xDA, 0x81, 0xDC, 0xDA, 0x81,
+    0xDE, 0xDA, 0x81, 0xE0, 0xDA, 0x81, 0xE2, 0xDA, 0x81, 0xE4,
+    0xDA, 0x81, 0xE6, 0xDA, 0x81, 0xE8, 0xDA, 0x82, 0x0B, 0xDA,
+    0x82, 0x0D, 0xDA, 0x82, 0x11, 0xDA, 0x82, 0x13, 0xDA, 0x15,
+    0xDA, 0x82, 0x16, 0xDA, 0x82, 0x18, 0xDA, 0x82, 0x1A, 0xDA,
+    0x82, 0x1C, 0xDA, 0x82, 0x1E, 0xDA, 0x82, 0x20, 0xDA, 0x82,
+    0x22, 0xDA, 0x82, 0x24, 0xDA, 0x82, 0x26, 0xDA, 0x82, 0x2B,
+    0xDA, 0x82, 0x2D, 0xDA, 0x82, 0x31, 0xDA, 0x82, 0x33, 0xDA,
+    0x80, 0x89, 0xDA, 0x82, 0x36, 0xDA, 0x82, 0x38, 0xDA, 0x82,
+    0x3A, 0xDA, 0x82, 0x3C, 0xDA, 0x82, 0x3E, 0xDA, 0x82, 0x46,
+    0xDA, 0x82, 0x48, 0xDA, 0x82, 0x4A, 0xDA, 0x82, 0x4C, 0xDA,
+    0x82, 0x4E, 0xDA, 0x82, 0x50, 0xDA, 0x81, 0x74, 0xDA, 0x82,
+    0x53, 0xDA, 0x82, 0x55, 0xDA, 0x82, 0x57, 0xDA, 0x82, 0x59,
+    0xDA, 0x82, 0x5B, 0xDA, 0x82, 0x62, 0xDA, 0x82, 0x64, 0xDA,
+    0x82, 0x66, 0xDA, 0x82, 0x68, 0xDA, 0x82, 0x6A, 0xDA, 0x82,
+    0x6C, 0xDA, 0x82, 0x6F, 0xDA, 0x82, 0x71, 0xDA, 0x82, 0x79,
+    0xDA, 0x82, 0x7B, 0xDA, 0x82, 0x7D, 0xDA, 0x82, 0x7F, 0xDA,
+    0x80, 0xA1, 0xDA, 0x82, 0x82, 0xDA, 0x82, 0x84, 0xDA, 0x82,
+    0x86, 0xDA, 0x82, 0x88, 0xDA, 0x82, 0x8A, 0xDA, 0x82, 0x8E,
+    0xDA, 0x82, 0x90, 0xDA, 0x82, 0x92, 0xDA, 0x82, 0x94, 0xDA,
+    0x82, 0xC8, 0xDA, 0x82, 0xCA, 0xDA, 0x82, 0xCC, 0xDA, 0x82,
+    0xCE, 0xDA, 0x82, 0xAA, 0xDA, 0x82, 0xD1, 0xDA, 0x82, 0xD3,
+    0xDA, 0x82, 0xD5, 0xDA, 0x82, 0xD9, 0xDA, 0x82, 0xDB, 0xDA,
+    0x81, 0xCD, 0xDA, 0x82, 0xDE, 0xDA, 0x82, 0xE0, 0xDA, 0x82,
+    0xE2, 0xDA, 0x82, 0xE4, 0xDA, 0x82, 0xE6, 0xDA, 0x82, 0xEC,
+    0xDA, 0x82, 0xEE, 0xDA, 0x82, 0xF1, 0xDA, 0x82, 0xF3, 0xDA,
+    0x82, 0xF5, 0xDA, 0x82, 0xF7, 0xDA, 0x82, 0xF9, 0xDA, 0x82,
+    0xFB, 0xDA, 0x82, 0xFE, 0xDA, 0x83, 0x00, 0xDA, 0x83, 0x08,
+    0xDA, 0x83, 0x0A, 0xDA, 0x83, 0x0C, 0xDA, 0x83, 0x0E, 0xDA,
+    0x83, 0x10, 0xDA, 0x83, 0x12, 0xDA, 0x83, 0x14, 0xDA, 0x83,
+    0x16, 0xDA, 0x83, 0x26, 0xDA, 0x82, 0x75, 0xDA, 0x83, 0x29,
+    0xDA, 0x83, 0x2B, 0xDA, 0x83, 0x2D, 0xDA, 0x83, 0x2F, 0xDA,
+    0x83, 0x87, 0xDA, 0x83, 0x89, 0xDA, 0x83, 0x8B, 0xDA, 0x83,
+    0x8D, 0xDA, 0x80, 0x9F, 0xDA, 0x83, 0x90, 0xDA, 0x83, 0x95,
+    0xDA, 0x83, 0x97, 0xDA, 0x83, 0x99, 0xDA, 0x83, 0x9B, 0xDA,
+    0x83, 0x9D, 0xDA, 0x83, 0x9F, 0xDA, 0x83, 0xA1, 0xDA, 0x83,
+    0xA3, 0xDA, 0x83, 0xA5, 0xDA, 0x83, 0xA7, 0xDA, 0x83, 0xA9,
+    0xDA, 0x83, 0xAB, 0xDA, 0x83, 0xAD, 0xDA, 0x83, 0xAF, 0xDA,
+    0x83, 0xB1, 0xDA, 0x83, 0xB3, 0xDA, 0x83, 0xB5, 0xDA, 0x83,
+    0xB7, 0xDA, 0x83, 0x34, 0xDA, 0x83, 0xBB, 0xDA, 0x82, 0xB6,
+    0xDA, 0x83, 0xBE, 0x01, 0xDA, 0x83, 0xC4, 0xDA, 0x83, 0xC9,
+    0xDA, 0x83, 0xC1, 0xDA, 0x82, 0xA3, 0xDA, 0x83, 0xCB, 0xDA,
+    0x83, 0xD3, 0xDA, 0x83, 0xD5, 0xDA, 0x83, 0xD7, 0xDA, 0x83,
+    0xD9, 0xDA, 0x83, 0xDF, 0xDA, 0x83, 0xE1, 0xDA, 0x83, 0xE7,
+    0xDA, 0x83, 0xE9, 0xDA, 0x80, 0xFE, 0xDA, 0x83, 0xEC, 0xDA,
+    0x4B, 0xDA, 0x83, 0xEF, 0xDA, 0x83, 0xF1, 0xDA, 0x83, 0xF3,
+    0xDA, 0x83, 0xF5, 0xDA, 0x83, 0xF7, 0xDA, 0x83, 0xF9, 0xDA,
+    0x83, 0xFB, 0xDA, 0x83, 0x6E, 0xDA, 0x83, 0xFF, 0xDA, 0x83,
+    0xD2, 0xDA, 0x84, 0x02, 0xDA, 0x84, 0x04, 0xDA, 0x84, 0x06,
+    0xDA, 0x82, 0xB8, 0xDA, 0x84, 0x09, 0xDA, 0x82, 0x09, 0xDA,
+    0x84, 0x0C, 0xDA, 0x84, 0x0E, 0xDA, 0x84, 0x10, 0xDA, 0x83,
+    0x67, 0xDA, 0x84, 0x14, 0xDA, 0x81, 0xCF, 0xDA, 0x83, 0x04,
+    0xDA, 0x57, 0xDA, 0x84, 0x1A, 0xDA, 0x84, 0x1E, 0xDA, 0x84,
+    0x20, 0xDA, 0x84, 0x24, 0xDA, 0x84, 0x26, 0xDA, 0x84, 0x28,
+    0xDA, 0x84, 0x2A, 0xDA, 0x84, 0x2C, 0xDA, 0x84, 0x2E, 0xDA,
+    0x84, 0x3C, 0xDA, 0x84, 0x3E, 0xDA, 0x82, 0x07, 0xDA, 0x84,
+    0x42, 0xDA, 0x84, 0x46, 0xDA, 0x84, 0x48, 0xDA, 0x83, 0x72,
+    0xDA, 0x84, 0x4B, 0xDA, 0x83, 0x84, 0xDA, 0x84, 0x4E, 0xDA,
+    0x83, 0x39, 0xDA, 0x84, 0x51, 0xDA, 0x84, 0x53, 0xDA, 0x84,
+    0x55, 0xDA, 0x84, 0x57, 0xDA, 0x84, 0x59, 0xDA, 0x32, 0xDA,
+    0x84, 0x5C, 0xDA, 0x84, 0x60, 0xDA, 0x84, 0x62, 0xDA, 0x84,
+    0x65, 0xDA, 0x84, 0x67, 0xDA, 0x21, 0xDA, 0x84, 0x6A, 0xDA,
+    0x84, 0x6C, 0xDA, 0x84, 0x6E, 0xDA, 0x6E, 0xDA, 0x84, 0x71,
+    0xDA, 0x81, 0x3E, 0xDA, 0x84, 0x74, 0xDA, 0x81, 0x58, 0xDA,
+    0x84, 0x77, 0xDA, 0x84, 0x79, 0xDA, 0x84, 0x7B, 0xDA, 0x84,
+    0x7D, 0xDA, 0x84, 0x7F, 0xDA, 0x84, 0x81, 0xDA, 0x84, 0x83,
+    0xDA, 0x84, 0x87, 0xDA, 0x84, 0x89, 0xDA, 0x84, 0x8C, 0xDA,
+    0x84, 0x8E, 0xDA, 0x81, 0x2D, 0xDA, 0x81, 0x36, 0xDA, 0x81,
+    0xC2, 0xDA, 0x84, 0x93, 0xDA, 0x82, 0x44, 0xDA, 0x84, 0x96,
+    0xD7, 0xDC, 0x80, 0x92, 0xCF, 0x09, 0x66, 0x69, 0x6C, 0x65,
+    0x2F, 0x6F, 0x70, 0x65, 0x6E, 0xDA, 0x83, 0x79, 0xCF, 0x0E,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65, 0x70,
+    0x6C, 0x61, 0x63, 0x65, 0xD8, 0x0E, 0x73, 0x74, 0x72, 0x69,
+    0x6E, 0x67, 0x2F, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65,
+    0xCF, 0x08, 0x77, 0x68, 0x65, 0x6E, 0x2D, 0x6C, 0x65, 0x74,
+    0xD7, 0xCD, 0x02, 0x99, 0x00, 0x00, 0x06, 0x01, 0x01, 0xCD,
+    0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0x09, 0xCE, 0x08, 0x77, 0x68,
+    0x65, 0x6E, 0x2D, 0x6C, 0x65, 0x74, 0xDA, 0x12, 0xDA, 0x59,
+    0xDA, 0x41, 0x28, 0x02, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00,
+    0x2B, 0x04, 0x00, 0x00, 0x2E, 0x01, 0x00, 0x00, 0x3F, 0x03,
+    0x00, 0x00, 0x26, 0x05, 0x01, 0x00, 0x2D, 0x05, 0x00, 0x03,
+    0x3F, 0x04, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x07, 0x01,
+    0xC0, 0x08, 0x02, 0x08, 0x06, 0x04, 0xCF, 0x09, 0x66, 0x75,
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x3F, 0xDA, 0x83, 0x5A,
+    0xCF, 0x09, 0x6F, 0x73, 0x2F, 0x72, 0x65, 0x6E, 0x61, 0x6D,
+    0x65, 0xD8, 0x09, 0x6F, 0x73, 0x2F, 0x72, 0x65, 0x6E, 0x61,
+    0x6D, 0x65, 0xCF, 0x05, 0x65, 0x72, 0x72, 0x6F, 0x72, 0xD7,
+    0xCD, 0x00, 0x08, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00,
+    0x01, 0xCE, 0x05, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x01, 0x00,
+    0x00, 0x00, 0xCF, 0x0D, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F,
+    0x6C, 0x69, 0x6E, 0x65, 0x61, 0x67, 0x65, 0xD8, 0x0D, 0x64,
+    0x65, 0x62, 0x75, 0x67, 0x2F, 0x6C, 0x69, 0x6E, 0x65, 0x61,
+    0x67, 0x65, 0xCF, 0x06, 0x69, 0x66, 0x2D, 0x6E, 0x6F, 0x74,
+    0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x06, 0x03, 0x02, 0x03,
+    0x01, 0x06, 0xCE, 0x06, 0x69, 0x66, 0x2D, 0x6E, 0x6F, 0x74,
+    0xDA, 0x12, 0xDA, 0x58, 0x28, 0x03, 0x00, 0x00, 0x26, 0x05,
+    0x00, 0x00, 0x2D, 0x05, 0x00, 0x02, 0x2B, 0x01, 0x00, 0x00,
+    0x3F, 0x04, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x07, 0x01,
+    0xA0, 0x02, 0x02, 0x05, 0x06, 0x04, 0xCF, 0x07, 0x66, 0x6C,
+    0x61, 0x74, 0x74, 0x65, 0x6E, 0xD7, 0xCD, 0x02, 0x98, 0x00,
+    0x00, 0x04, 0x01, 0x01, 0x01, 0x01, 0x05, 0xCE, 0x07, 0x66,
+    0x6C, 0x61, 0x74, 0x74, 0x65, 0x6E, 0xDA, 0x12, 0xD7, 0xCD,
+    0x02, 0x98, 0x00, 0x00, 0x0A, 0x02, 0x02, 0x02, 0x02, 0x16,
+    0xCE, 0x0C, 0x66, 0x6C, 0x61, 0x74, 0x74, 0x65, 0x6E, 0x2D,
+    0x69, 0x6E, 0x74, 0x6F, 0xDA, 0x12, 0xD7, 0xCD, 0x02, 0x98,
+    0x00, 0x00, 0x07, 0x01, 0x01, 0x01, 0x03, 0x0D, 0xCE, 0x08,
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x3F, 0xDA, 0x12,
+    0xDA, 0x15, 0xDA, 0x4D, 0xDA, 0x50, 0x28, 0x01, 0x00, 0x00,
+    0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02,
+    0x03, 0x00, 0x17, 0x03, 0x02, 0x00, 0x26, 0x05, 0x01, 0x00,
+    0x1F, 0x04, 0x03, 0x05, 0x1A, 0x04, 0x03, 0x00, 0x23, 0x05,
+    0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0x26, 0x06, 0x02, 0x00,
+    0x1F, 0x05, 0x03, 0x06, 0x03, 0x05, 0x00, 0x00, 0x13, 0x01,
+    0xCE, 0x01, 0x02, 0x03, 0x02, 0x12, 0x01, 0x00, 0x0D, 0x02,
+    0x02, 0x08, 0x03, 0x00, 0x07, 0x03, 0x00, 0x2C, 0xDA, 0x81,
+    0x1B, 0x28, 0x02, 0x00, 0x00, 0x25, 0x03, 0x00, 0x00, 0x39,
+    0x04, 0x01, 0x00, 0x17, 0x05, 0x04, 0x00, 0x41, 0x04, 0x03,
+    0x05, 0x1A, 0x04, 0x10, 0x00, 0x34, 0x06, 0x01, 0x03, 0x17,
+    0x07, 0x06, 0x00, 0x2B, 0x07, 0x00, 0x00, 0x26, 0x08, 0x00,
+    0x00, 0x2F, 0x06, 0x08, 0x00, 0x1A, 0x06, 0x04, 0x00, 0x2C,
+    0x00, 0x07, 0x00, 0x2F, 0x08, 0x02, 0x00, 0x18, 0x04, 0x00,
+    0x00, 0x2C, 0x00, 0x07, 0x00, 0x26, 0x09, 0x01, 0x00, 0x2F,
+    0x08, 0x09, 0x00, 0x25, 0x06, 0x01, 0x00, 0x06, 0x03, 0x03,
+    0x06, 0x18, 0xF0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x1C,
+    0x01, 0xFA, 0x10, 0x02, 0x07, 0x08, 0x04, 0x03, 0x02, 0x0C,
+    0x01, 0x00, 0x07, 0x02, 0x02, 0x04, 0x01, 0x01, 0x03, 0x03,
+    0x04, 0x04, 0x03, 0x05, 0x07, 0x01, 0x07, 0x03, 0x28, 0x01,
+    0x00, 0x00, 0x3A, 0x02, 0x00, 0x00, 0x2C, 0x02, 0x00, 0x00,
+    0x26, 0x03, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x07, 0x01,
+    0x8E, 0x11, 0x02, 0x04, 0x08, 0x04, 0xCF, 0x08, 0x6F, 0x73,
+    0x2F, 0x72, 0x6D, 0x64, 0x69, 0x72, 0xD8, 0x08, 0x6F, 0x73,
+    0x2F, 0x72, 0x6D, 0x64, 0x69, 0x72, 0xCF, 0x0A, 0x65, 0x6E,
+    0x76, 0x2D, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0xD8, 0x0A,
+    0x65, 0x6E, 0x76, 0x2D, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70,
+    0xCF, 0x0C, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x73,
+    0x6C, 0x69, 0x63, 0x65, 0xD8, 0x0C, 0x74, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0xCF, 0x0B,
+    0x66, 0x72, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x69, 0x65,
+    0x73, 0xD8, 0x0B, 0x66, 0x72, 0x65, 0x71, 0x75, 0x65, 0x6E,
+    0x63, 0x69, 0x65, 0x73, 0xCF, 0x08, 0x6D, 0x61, 0x74, 0x68,
+    0x2F, 0x63, 0x6F, 0x73, 0xD8, 0x08, 0x6D, 0x61, 0x74, 0x68,
+    0x2F, 0x63, 0x6F, 0x73, 0xCF, 0x0A, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x2F, 0x77, 0x65, 0x61, 0x6B, 0xD8, 0x0A, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x2F, 0x77, 0x65, 0x61, 0x6B, 0xCF, 0x04,
+    0x6E, 0x69, 0x6C, 0x3F, 0xDA, 0x81, 0xD1, 0xCF, 0x0C, 0x74,
+    0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73, 0x65, 0x74, 0x6D, 0x61,
+    0x70, 0xD8, 0x0C, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73,
+    0x65, 0x74, 0x6D, 0x61, 0x70, 0xCF, 0x04, 0x71, 0x75, 0x69,
+    0x74, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x05, 0x01, 0x00,
+    0x01, 0x03, 0x0B, 0xCE, 0x04, 0x71, 0x75, 0x69, 0x74, 0xDA,
+    0x12, 0xDA, 0x82, 0xB5, 0xDA, 0x83, 0x29, 0xDA, 0x82, 0xB9,
+    0x28, 0x01, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x23, 0x03,
+    0x00, 0x00, 0x2C, 0x02, 0x03, 0x00, 0x26, 0x03, 0x01, 0x00,
+    0x2F, 0x02, 0x03, 0x00, 0x26, 0x03, 0x02, 0x00, 0x2C, 0x03,
+    0x00, 0x00, 0x26, 0x04, 0x01, 0x00, 0x2F, 0x03, 0x04, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x0D, 0x01, 0xBC, 0x1B, 0x02, 0x05,
+    0x0A, 0x04, 0x04, 0x02, 0x00, 0x01, 0x0B, 0x03, 0xCF, 0x09,
+    0x6F, 0x73, 0x2F, 0x73, 0x65, 0x74, 0x65, 0x6E, 0x76, 0xD8,
+    0x09, 0x6F, 0x73, 0x2F, 0x73, 0x65, 0x74, 0x65, 0x6E, 0x76,
+    0xCF, 0x0E, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x2F, 0x72,
+    0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0xD8, 0x0E, 0x74, 0x68,
+    0x72, 0x65, 0x61, 0x64, 0x2F, 0x72, 0x65, 0x63, 0x65, 0x69,
+    0x76, 0x65, 0xCF, 0x0E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x2F, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x65, 0xDA, 0x82,
+    0xB7, 0xCF, 0x09, 0x6D, 0x61, 0x78, 0x2D, 0x6F, 0x72, 0x64,
+    0x65, 0x72, 0xD7, 0xCD, 0x02, 0x99, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0x05, 0xCE, 0x09,
+    0x6D, 0x61, 0x78, 0x2D, 0x6F, 0x72, 0x64, 0x65, 0x72, 0xDA,
+    0x12, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x14, 0x06, 0x00, 0x00,
+    0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 0xCE, 0x06, 0x6F,
+    0x72, 0x64, 0x65, 0x72, 0x3E, 0x39, 0x01, 0x00, 0x00, 0x1E,
+    0x02, 0x01, 0x02, 0x19, 0x02, 0x0A, 0x00, 0x37, 0x03, 0x00,
+    0x00, 0x25, 0x05, 0x01, 0x00, 0x34, 0x04, 0x00, 0x05, 0x1B,
+    0x02, 0x03, 0x04, 0x1A, 0x02, 0x07, 0x00, 0x05, 0x05, 0x05,
+    0x01, 0x17, 0x03, 0x04, 0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A,
+    0x02, 0xFA, 0xFF, 0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00,
+    0x00, 0x24, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xDA,
+    0x81, 0x2F, 0x28, 0x01, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00,
+    0x2C, 0x02, 0x00, 0x00, 0x26, 0x02, 0x01, 0x00, 0x30, 0x02,
+    0x00, 0x00, 0x07, 0x01, 0x9C, 0x09, 0x02, 0x04, 0x06, 0x16,
+    0xCF, 0x0B, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x66,
+    0x69, 0x6C, 0x6C, 0xD8, 0x0B, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2F, 0x66, 0x69, 0x6C, 0x6C, 0xCF, 0x0A, 0x6C, 0x6F,
+    0x61, 0x64, 0x2D, 0x69, 0x6D, 0x61, 0x67, 0x65, 0xD7, 0xDC,
+    0x80, 0x95, 0xCF, 0x0A, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x2F, 0x6E, 0x65, 0x77, 0xD8, 0x0A, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0xCF, 0x03, 0x61, 0x6E,
+    0x64, 0xD7, 0xCD, 0x02, 0x99, 0x00, 0x00, 0x0A, 0x00, 0x00,
+    0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0x16, 0xCE, 0x03, 0x61,
+    0x6E, 0x64, 0xDA, 0x12, 0xDA, 0x58, 0xDA, 0x57, 0x28, 0x01,
+    0x00, 0x00, 0x23, 0x02, 0x00, 0x00, 0x39, 0x03, 0x00, 0x00,
+    0x17, 0x04, 0x03, 0x00, 0x17, 0x05, 0x04, 0x00, 0x25, 0x07,
+    0x00, 0x00, 0x43, 0x06, 0x05, 0x07, 0x1A, 0x06, 0x0E, 0x00,
+    0x25, 0x07, 0x01, 0x00, 0x07, 0x05, 0x05, 0x07, 0x23, 0x08,
+    0x00, 0x00, 0x1F, 0x07, 0x02, 0x08, 0x1A, 0x07, 0x03, 0x00,
+    0x34, 0x02, 0x00, 0x05, 0x18, 0x06, 0x00, 0x00, 0x34, 0x08,
+    0x00, 0x05, 0x26, 0x09, 0x00, 0x00, 0x2D, 0x09, 0x08, 0x02,
+    0x26, 0x09, 0x01, 0x00, 0x2F, 0x02, 0x09, 0x00, 0x18, 0xF1,
+    0xFF, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x31, 0x01, 0xDC, 0x03,
+    0x02, 0x01, 0x08, 0x04, 0x01, 0x02, 0x12, 0x01, 0x00, 0x11,
+    0x01, 0x02, 0x00, 0x02, 0x02, 0x0E, 0x01, 0x00, 0x0D, 0x02,
+    0x02, 0x04, 0x02, 0x02, 0x1A, 0x01, 0x00, 0x07, 0x01, 0x02,
+    0x04, 0x01, 0x01, 0x03, 0x01, 0x04, 0x1A, 0x04, 0x00, 0x15,
+    0x01, 0x07, 0x19, 0x01, 0x0D, 0x03, 0xCF, 0x09, 0x64, 0x65,
+    0x65, 0x70, 0x2D, 0x6E, 0x6F, 0x74, 0x3D, 0xDA, 0x84, 0x33,
+    0xCF, 0x0F, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x73, 0x65, 0x65,
+    0x64, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0xD8, 0x0F, 0x6D,
+    0x61, 0x74, 0x68, 0x2F, 0x73, 0x65, 0x65, 0x64, 0x72, 0x61,
+    0x6E, 0x64, 0x6F, 0x6D, 0xCF, 0x0A, 0x74, 0x61, 0x6B, 0x65,
+    0x2D, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0xD7, 0xCD, 0x02, 0x98,
+    0x00, 0x00, 0x0E, 0x02, 0x02, 0x02, 0x05, 0x1B, 0xCE, 0x0A,
+    0x74, 0x61, 0x6B, 0x65, 0x2D, 0x75, 0x6E, 0x74, 0x69, 0x6C,
+    0xDA, 0x12, 0xDA, 0x1A, 0xDA, 0x81, 0xCD, 0xDA, 0x80, 0xA1,
+    0xDA, 0x81, 0xCF, 0xDA, 0x81, 0xD1, 0x28, 0x02, 0x00, 0x00,
+    0x2B, 0x01, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x03,
+    0x04, 0x00, 0x17, 0x04, 0x03, 0x00, 0x1A, 0x04, 0x03, 0x00,
+    0x26, 0x05, 0x01, 0x00, 0x18, 0x02, 0x00, 0x00, 0x26, 0x05,
+    0x02, 0x00, 0x17, 0x06, 0x05, 0x00, 0x39, 0x07, 0x01, 0x00,
+    0x17, 0x08, 0x07, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x0A,
+    0x03, 0x00, 0x2F, 0x09, 0x0A, 0x00, 0x17, 0x0A, 0x09, 0x00,
+    0x2B, 0x0A, 0x00, 0x00, 0x26, 0x0D, 0x04, 0x00, 0x2F, 0x0C,
+    0x0D, 0x00, 0x1A, 0x0C, 0x03, 0x00, 0x17, 0x0B, 0x08, 0x00,
+    0x18, 0x02, 0x00, 0x00, 0x17, 0x0B, 0x0A, 0x00, 0x17, 0x0C,
+    0x0B, 0x00, 0x25, 0x0D, 0x00, 0x00, 0x2D, 0x01, 0x0D, 0x0C,
+    0x30, 0x06, 0x00, 0x00, 0x28, 0x01, 0x8C, 0x0C, 0x02, 0x03,
+    0x06, 0x1E, 0x01, 0x00, 0x19, 0x04, 0x02, 0x0E, 0x01, 0x00,
+    0x0D, 0x01, 0x02, 0x12, 0x01, 0x00, 0x11, 0x03, 0x02, 0x0E,
+    0x01, 0x00, 0x0D, 0x03, 0x02, 0x1A, 0x04, 0x00, 0x07, 0x01,
+    0x00, 0x11, 0x03, 0x02, 0x00, 0xCF, 0x05, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0xD8, 0x05, 0x61, 0x72, 0x72, 0x61, 0x79, 0xCF,
+    0x07, 0x6F, 0x73, 0x2F, 0x74, 0x69, 0x6D, 0x65, 0xD8, 0x07,
+    0x6F, 0x73, 0x2F, 0x74, 0x69, 0x6D, 0x65, 0xCF, 0x08, 0x64,
+    0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0xD7, 0xCD, 0x02,
+    0x99, 0x00, 0x00, 0x04, 0x01, 0x01, 0xCD, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x02, 0x06, 0xCE, 0x08, 0x64, 0x65, 0x66, 0x6D, 0x61,
+    0x63, 0x72, 0x6F, 0xDA, 0x12, 0xDA, 0x24, 0xDA, 0x81, 0x5C,
+    0x28, 0x02, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2C, 0x00,
+    0x03, 0x00, 0x2E, 0x01, 0x00, 0x00, 0x26, 0x03, 0x01, 0x00,
+    0x30, 0x03, 0x00, 0x00, 0x06, 0x01, 0x52, 0x02, 0x05, 0x06,
+    0x04, 0xCF, 0x0D, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+    0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0xD8, 0x0D, 0x74, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2F, 0x6C, 0x65, 0x6E, 0x67, 0x74,
+    0x68, 0xCF, 0x0A, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F,
+    0x6E, 0x65, 0x77, 0xDA, 0x82, 0xB4, 0xCF, 0x07, 0x75, 0x6E,
+    0x74, 0x72, 0x61, 0x63, 0x65, 0xD8, 0x07, 0x75, 0x6E, 0x74,
+    0x72, 0x61, 0x63, 0x65, 0xCF, 0x06, 0x73, 0x74, 0x64, 0x65,
+    0x72, 0x72, 0xD8, 0x06, 0x73, 0x74, 0x64, 0x65, 0x72, 0x72,
+    0xCF, 0x02, 0x3C, 0x3D, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x1D,
+    0x06, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x10,
+    0xCE, 0x02, 0x3C, 0x3D, 0x39, 0x01, 0x00, 0x00, 0x1E, 0x02,
+    0x01, 0x02, 0x19, 0x02, 0x0A, 0x00, 0x37, 0x03, 0x00, 0x00,
+    0x25, 0x05, 0x01, 0x00, 0x34, 0x04, 0x00, 0x05, 0x42, 0x02,
+    0x03, 0x04, 0x1A, 0x02, 0x07, 0x00, 0x05, 0x05, 0x05, 0x01,
+    0x17, 0x03, 0x04, 0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02,
+    0xFA, 0xFF, 0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+    0x24, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xCF, 0x0C,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x66, 0x6C, 0x75,
+    0x73, 0x68, 0xD8, 0x0C, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x2F, 0x66, 0x6C, 0x75, 0x73, 0x68, 0xCF, 0x0E, 0x6D, 0x6F,
+    0x64, 0x75, 0x6C, 0x65, 0x2F, 0x6C, 0x6F, 0x61, 0x64, 0x65,
+    0x72, 0x73, 0xDA, 0x84, 0x9A, 0xCF, 0x07, 0x70, 0x72, 0x6F,
+    0x64, 0x75, 0x63, 0x74, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00,
+    0x08, 0x01, 0x01, 0x01, 0x00, 0x0E, 0xCE, 0x07, 0x70, 0x72,
+    0x6F, 0x64, 0x75, 0x63, 0x74, 0xDA, 0x12, 0x28, 0x01, 0x00,
+    0x00, 0x25, 0x02, 0x01, 0x00, 0x25, 0x03, 0x00, 0x00, 0x39,
+    0x04, 0x00, 0x00, 0x17, 0x05, 0x04, 0x00, 0x41, 0x04, 0x03,
+    0x05, 0x1A, 0x04, 0x07, 0x00, 0x34, 0x06, 0x00, 0x03, 0x17,
+    0x07, 0x06, 0x00, 0x09, 0x02, 0x02, 0x07, 0x25, 0x06, 0x01,
+    0x00, 0x06, 0x03, 0x03, 0x06, 0x18, 0xF9, 0xFF, 0xFF, 0x03,
+    0x02, 0x00, 0x00, 0x13, 0x01, 0xF4, 0x07, 0x02, 0x01, 0x06,
+    0x04, 0x07, 0x02, 0x00, 0x01, 0x00, 0x16, 0x03, 0x00, 0x15,
+    0x01, 0x07, 0x03, 0xCF, 0x04, 0x74, 0x61, 0x6B, 0x65, 0xD7,
+    0xCD, 0x02, 0x98, 0x00, 0x00, 0x0A, 0x02, 0x02, 0x02, 0x05,
+    0x16, 0xCE, 0x04, 0x74, 0x61, 0x6B, 0x65, 0xDA, 0x12, 0xDA,
+    0x1A, 0xDA, 0x81, 0xCD, 0xDA, 0x80, 0xA1, 0xDA, 0x81, 0x30,
+    0xDA, 0x82, 0x45, 0x28, 0x02, 0x00, 0x00, 0x2B, 0x01, 0x00,
+    0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x17,
+    0x04, 0x03, 0x00, 0x1A, 0x04, 0x03, 0x00, 0x26, 0x05, 0x01,
+    0x00, 0x18, 0x02, 0x00, 0x00, 0x26, 0x05, 0x02, 0x00, 0x17,
+    0x06, 0x05, 0x00, 0x39, 0x07, 0x01, 0x00, 0x2C, 0x00, 0x07,
+    0x00, 0x26, 0x09, 0x03, 0x00, 0x2F, 0x08, 0x09, 0x00, 0x25,
+    0x07, 0x00, 0x00, 0x2C, 0x07, 0x08, 0x00, 0x26, 0x09, 0x04,
+    0x00, 0x2F, 0x07, 0x09, 0x00, 0x17, 0x08, 0x07, 0x00, 0x25,
+    0x09, 0x00, 0x00, 0x2D, 0x01, 0x09, 0x08, 0x30, 0x06, 0x00,
+    0x00, 0x1F, 0x01, 0xFA, 0x0B, 0x02, 0x03, 0x06, 0x1E, 0x01,
+    0x00, 0x19, 0x04, 0x02, 0x0E, 0x01, 0x00, 0x0D, 0x01, 0x04,
+    0x2E, 0x03, 0x00, 0x0D, 0x04, 0x00, 0x0D, 0x01, 0x00, 0x11,
+    0x03, 0x02, 0x00, 0xCF, 0x05, 0x61, 0x70, 0x70, 0x6C, 0x79,
+    0xDA, 0x83, 0x06, 0xCF, 0x0B, 0x72, 0x75, 0x6E, 0x2D, 0x63,
+    0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0xDA, 0x82, 0xC4, 0xCF,
+    0x0E, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x62, 0x72, 0x61,
+    0x63, 0x6B, 0x65, 0x74, 0x73, 0xDA, 0x81, 0xFA, 0xCF, 0x0A,
+    0x63, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x3F,
+    0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01,
+    0x02, 0x07, 0xCE, 0x0A, 0x63, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x3F, 0xDA, 0x12, 0xDA, 0x15, 0xD0, 0x09,
+    0x63, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28,
+    0x01, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00,
+    0x00, 0x2F, 0x02, 0x03, 0x00, 0x26, 0x04, 0x01, 0x00, 0x1F,
+    0x03, 0x02, 0x04, 0x03, 0x03, 0x00, 0x00, 0x0A, 0x01, 0xB6,
+    0x01, 0x02, 0x03, 0x00, 0x64, 0x03, 0x00, 0x05, 0xCF, 0x09,
+    0x62, 0x6F, 0x6F, 0x74, 0x2F, 0x61, 0x72, 0x67, 0x73, 0xD1,
+    0x06, 0xCE, 0x10, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x2F, 0x6A,
+    0x61, 0x6E, 0x65, 0x74, 0x5F, 0x62, 0x6F, 0x6F, 0x74, 0xCE,
+    0x12, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x2F, 0x63, 0x6F, 0x72,
+    0x65, 0x5F, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2E, 0x63, 0xCE,
+    0x0A, 0x4A, 0x41, 0x4E, 0x45, 0x54, 0x5F, 0x50, 0x41, 0x54,
+    0x48, 0xDA, 0x81, 0x42, 0xCE, 0x10, 0x4A, 0x41, 0x4E, 0x45,
+    0x54, 0x5F, 0x48, 0x45, 0x41, 0x44, 0x45, 0x52, 0x50, 0x41,
+    0x54, 0x48, 0xCE, 0x18, 0x2F, 0x75, 0x73, 0x72, 0x2F, 0x6C,
+    0x6F, 0x63, 0x61, 0x6C, 0x2F, 0x69, 0x6E, 0x63, 0x6C, 0x75,
+    0x64, 0x65, 0x2F, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0xCF, 0x07,
+    0x63, 0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 0xD7, 0xCD, 0x02,
+    0x98, 0x00, 0x00, 0x01, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x02, 0xCE, 0x07, 0x63, 0x6F, 0x6D, 0x6D, 0x65,
+    0x6E, 0x74, 0xDA, 0x12, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x04, 0x02, 0x98, 0x02, 0x02, 0xCF, 0x07, 0x6F,
+    0x72, 0x64, 0x65, 0x72, 0x3C, 0x3D, 0xD7, 0xCD, 0x00, 0x09,
+    0x00, 0x17, 0x06, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF,
+    0x00, 0x10, 0xCE, 0x07, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3C,
+    0x3D, 0x39, 0x01, 0x00, 0x00, 0x1E, 0x02, 0x01, 0x02, 0x19,
+    0x02, 0x0A, 0x00, 0x37, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01,
+    0x00, 0x34, 0x04, 0x00, 0x05, 0x1B, 0x02, 0x03, 0x04, 0x1A,
+    0x02, 0x07, 0x00, 0x05, 0x05, 0x05, 0x01, 0x17, 0x03, 0x04,
+    0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x24,
+    0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x23, 0x03, 0x00,
+    0x00, 0x03, 0x03, 0x00, 0x00, 0xCF, 0x11, 0x6A, 0x61, 0x6E,
+    0x65, 0x74, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2D,
+    0x62, 0x69, 0x74, 0x73, 0x01, 0xCF, 0x07, 0x69, 0x6E, 0x74,
+    0x2F, 0x73, 0x36, 0x34, 0xD8, 0x07, 0x69, 0x6E, 0x74, 0x2F,
+    0x73, 0x36, 0x34, 0xCF, 0x02, 0x3D, 0x3D, 0xD7, 0xCD, 0x00,
+    0x09, 0x00, 0x1E, 0x06, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x10, 0xCE, 0x02, 0x3D, 0x3D, 0x39, 0x01, 0x00,
+    0x00, 0x1E, 0x02, 0x01, 0x02, 0x19, 0x02, 0x0A, 0x00, 0x37,
+    0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x34, 0x04, 0x00,
+    0x05, 0x45, 0x02, 0x03, 0x04, 0x1A, 0x02, 0x07, 0x00, 0x05,
+    0x05, 0x05, 0x01, 0x17, 0x03, 0x04, 0x00, 0x1F, 0x02, 0x05,
+    0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x23, 0x03, 0x00, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x24, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00,
+    0x00, 0xCF, 0x0C, 0x67, 0x63, 0x73, 0x65, 0x74, 0x74, 0x68,
+    0x72, 0x65, 0x61, 0x64, 0x73, 0xD8, 0x0C, 0x67, 0x63, 0x73,
+    0x65, 0x74, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0xCF,
+    0x06, 0x66, 0x72, 0x65, 0x65, 0x7A, 0x65, 0xD8, 0x06, 0x66,
+    0x72, 0x65, 0x65, 0x7A, 0x65, 0xCF, 0x0C, 0x64, 0x65, 0x62,
+    0x75, 0x67, 0x2F, 0x66, 0x62, 0x72, 0x65, 0x61, 0x6B, 0xD8,
+    0x0C, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x66, 0x62, 0x72,
+    0x65, 0x61, 0x6B, 0xCF, 0x0A, 0x6F, 0x73, 0x2F, 0x65, 0x78,
+    0x65, 0x63, 0x75, 0x74, 0x65, 0xD8, 0x0A, 0x6F, 0x73, 0x2F,
+    0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0xCF, 0x12, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x68, 0x61, 0x73, 0x2D,
+    0x73, 0x75, 0x66, 0x66, 0x69, 0x78, 0x3F, 0xDA, 0x83, 0x57,
+    0xCF, 0x09, 0x77, 0x69, 0x74, 0x68, 0x2D, 0x76, 0x61, 0x72,
+    0x73, 0xD7, 0xCD, 0x02, 0x99, 0x00, 0x00, 0x16, 0x01, 0x01,
+    0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x10, 0x80, 0x90, 0xCE, 0x09,
+    0x77, 0x69, 0x74, 0x68, 0x2D, 0x76, 0x61, 0x72, 0x73, 0xDA,
+    0x12, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x05, 0x01, 0x01,
+    0x01, 0x01, 0x08, 0xCE, 0x05, 0x65, 0x76, 0x65, 0x6E, 0x3F,
+    0xDA, 0x12, 0xDA, 0x32, 0x28, 0x01, 0x00, 0x00, 0x25, 0x02,
+    0x02, 0x00, 0x2C, 0x00, 0x02, 0x00, 0x26, 0x03, 0x00, 0x00,
+    0x2F, 0x02, 0x03, 0x00, 0x25, 0x04, 0x00, 0x00, 0x45, 0x03,
+    0x04, 0x02, 0x03, 0x03, 0x00, 0x00, 0x0A, 0x01, 0x9A, 0x01,
+    0x02, 0x04, 0x00, 0x58, 0x03, 0x00, 0x0B, 0xCE, 0x28, 0x65,
+    0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x65, 0x76,
+    0x65, 0x6E, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20,
+    0x6F, 0x66, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E,
+    0x74, 0x20, 0x74, 0x6F, 0x20, 0x76, 0x61, 0x72, 0x73, 0xDA,
+    0x55, 0xDA, 0x81, 0x1B, 0xDA, 0x56, 0xDA, 0x22, 0xDA, 0x80,
+    0x87, 0xDA, 0x80, 0xB5, 0xD0, 0x02, 0x65, 0x69, 0xDA, 0x82,
+    0x78, 0xDA, 0x81, 0xDE, 0xDA, 0x81, 0x36, 0xDA, 0x81, 0x76,
+    0xDA, 0x82, 0xF1, 0xDA, 0x58, 0xDA, 0x59, 0x28, 0x02, 0x00,
+    0x00, 0x39, 0x03, 0x00, 0x00, 0x17, 0x04, 0x03, 0x00, 0x2B,
+    0x04, 0x00, 0x00, 0x26, 0x06, 0x00, 0x00, 0x2F, 0x05, 0x06,
+    0x00, 0x1A, 0x05, 0x02, 0x00, 0x18, 0x03, 0x00, 0x00, 0x26,
+    0x06, 0x01, 0x00, 0x01, 0x06, 0x00, 0x00, 0x3A, 0x05, 0x00,
+    0x00, 0x17, 0x06, 0x05, 0x00, 0x25, 0x05, 0x00, 0x00, 0x17,
+    0x07, 0x04, 0x00, 0x41, 0x08, 0x05, 0x07, 0x1A, 0x08, 0x0A,
+    0x00, 0x17, 0x09, 0x05, 0x00, 0x26, 0x0B, 0x02, 0x00, 0x2F,
+    0x0A, 0x0B, 0x00, 0x2C, 0x06, 0x0A, 0x00, 0x26, 0x0C, 0x03,
+    0x00, 0x2F, 0x0B, 0x0C, 0x00, 0x25, 0x0A, 0x02, 0x00, 0x06,
+    0x05, 0x05, 0x0A, 0x18, 0xF6, 0xFF, 0xFF, 0x17, 0x05, 0x06,
+    0x00, 0x3A, 0x07, 0x00, 0x00, 0x17, 0x08, 0x07, 0x00, 0x25,
+    0x07, 0x00, 0x00, 0x17, 0x09, 0x04, 0x00, 0x41, 0x0A, 0x07,
+    0x09, 0x1A, 0x0A, 0x11, 0x00, 0x17, 0x0B, 0x07, 0x00, 0x25,
+    0x0D, 0x02, 0x00, 0x0B, 0x0C, 0x0B, 0x0D, 0x2B, 0x0C, 0x00,
+    0x00, 0x2F, 0x0D, 0x05, 0x00, 0x2B, 0x0B, 0x00, 0x00, 0x2F,
+    0x0C, 0x00, 0x00, 0x26, 0x0E, 0x04, 0x00, 0x2D, 0x0E, 0x0D,
+    0x0C, 0x3F, 0x0C, 0x00, 0x00, 0x2C, 0x08, 0x0C, 0x00, 0x26,
+    0x0E, 0x03, 0x00, 0x2F, 0x0D, 0x0E, 0x00, 0x25, 0x0C, 0x02,
+    0x00, 0x06, 0x07, 0x07, 0x0C, 0x18, 0xEF, 0xFF, 0xFF, 0x17,
+    0x07, 0x08, 0x00, 0x3A, 0x09, 0x00, 0x00, 0x17, 0x0A, 0x09,
+    0x00, 0x25, 0x09, 0x00, 0x00, 0x17, 0x0B, 0x04, 0x00, 0x41,
+    0x0C, 0x09, 0x0B, 0x1A, 0x0C, 0x11, 0x00, 0x17, 0x0D, 0x09,
+    0x00, 0x2B, 0x0D, 0x00, 0x00, 0x2F, 0x0E, 0x00, 0x00, 0x25,
+    0x10, 0x01, 0x00, 0x06, 0x0F, 0x0D, 0x10, 0x2B, 0x0F, 0x00,
+    0x00, 0x2F, 0x10, 0x00, 0x00, 0x26, 0x0F, 0x05, 0x00, 0x2D,
+    0x0F, 0x0E, 0x10, 0x3F, 0x0E, 0x00, 0x00, 0x2C, 0x0A, 0x0E,
+    0x00, 0x26, 0x10, 0x03, 0x00, 0x2F, 0x0F, 0x10, 0x00, 0x25,
+    0x0E, 0x02, 0x00, 0x06, 0x09, 0x09, 0x0E, 0x18, 0xEF, 0xFF,
+    0xFF, 0x17, 0x09, 0x0A, 0x00, 0x3A, 0x0B, 0x00, 0x00, 0x17,
+    0x0C, 0x0B, 0x00, 0x25, 0x0B, 0x00, 0x00, 0x17, 0x0D, 0x04,
+    0x00, 0x41, 0x0E, 0x0B, 0x0D, 0x1A, 0x0E, 0x11, 0x00, 0x17,
+    0x0F, 0x0B, 0x00, 0x2B, 0x0F, 0x00, 0x00, 0x2F, 0x10, 0x00,
+    0x00, 0x25, 0x12, 0x02, 0x00, 0x0B, 0x11, 0x0F, 0x12, 0x2B,
+    0x11, 0x00, 0x00, 0x2F, 0x12, 0x05, 0x00, 0x26, 0x11, 0x05,
+    0x00, 0x2D, 0x11, 0x10, 0x12, 0x3F, 0x10, 0x00, 0x00, 0x2C,
+    0x0C, 0x10, 0x00, 0x26, 0x12, 0x03, 0x00, 0x2F, 0x11, 0x12,
+    0x00, 0x25, 0x10, 0x02, 0x00, 0x06, 0x0B, 0x0B, 0x10, 0x18,
+    0xEF, 0xFF, 0xFF, 0x17, 0x0B, 0x0C, 0x00, 0x26, 0x0E, 0x02,
+    0x00, 0x2F, 0x0D, 0x0E, 0x00, 0x17, 0x0E, 0x0D, 0x00, 0x26,
+    0x0F, 0x02, 0x00, 0x2F, 0x0D, 0x0F, 0x00, 0x17, 0x0F, 0x0D,
+    0x00, 0x26, 0x10, 0x02, 0x00, 0x2F, 0x0D, 0x10, 0x00, 0x17,
+    0x10, 0x0D, 0x00, 0x40, 0x0D, 0x00, 0x00, 0x26, 0x12, 0x06,
+    0x00, 0x2C, 0x12, 0x0D, 0x00, 0x2E, 0x09, 0x00, 0x00, 0x2E,
+    0x01, 0x00, 0x00, 0x3F, 0x11, 0x00, 0x00, 0x26, 0x12, 0x07,
+    0x00, 0x26, 0x13, 0x08, 0x00, 0x2D, 0x12, 0x11, 0x13, 0x3F,
+    0x0D, 0x00, 0x00, 0x26, 0x12, 0x04, 0x00, 0x2D, 0x12, 0x0F,
+    0x0D, 0x3F, 0x11, 0x00, 0x00, 0x26, 0x12, 0x09, 0x00, 0x2C,
+    0x12, 0x0F, 0x00, 0x3F, 0x0D, 0x00, 0x00, 0x26, 0x13, 0x04,
+    0x00, 0x2D, 0x13, 0x0E, 0x0D, 0x3F, 0x12, 0x00, 0x00, 0x26,
+    0x13, 0x0A, 0x00, 0x2C, 0x13, 0x0F, 0x00, 0x3F, 0x0D, 0x00,
+    0x00, 0x26, 0x14, 0x0B, 0x00, 0x26, 0x15, 0x0C, 0x00, 0x2D,
+    0x14, 0x0D, 0x15, 0x3F, 0x13, 0x00, 0x00, 0x26, 0x14, 0x0D,
+    0x00, 0x2D, 0x14, 0x0E, 0x0F, 0x3F, 0x0D, 0x00, 0x00, 0x26,
+    0x15, 0x0E, 0x00, 0x2D, 0x15, 0x13, 0x0D, 0x3F, 0x14, 0x00,
+    0x00, 0x26, 0x13, 0x0F, 0x00, 0x2B, 0x13, 0x00, 0x00, 0x2E,
+    0x07, 0x00, 0x00, 0x2C, 0x11, 0x12, 0x00, 0x2E, 0x0B, 0x00,
+    0x00, 0x2C, 0x14, 0x0E, 0x00, 0x3F, 0x0D, 0x00, 0x00, 0x03,
+    0x0D, 0x00, 0x00, 0x64, 0x01, 0x8E, 0x0F, 0x02, 0x01, 0x08,
+    0x16, 0x01, 0x00, 0x11, 0x03, 0x02, 0x10, 0x02, 0x00, 0x0F,
+    0x02, 0x00, 0x28, 0x07, 0x02, 0x13, 0x02, 0x00, 0x34, 0x06,
+    0x00, 0x33, 0x01, 0x00, 0x13, 0x07, 0x02, 0x1A, 0x02, 0x00,
+    0x4C, 0x02, 0x00, 0x0B, 0x02, 0x00, 0x1E, 0x03, 0x00, 0x29,
+    0x06, 0x00, 0x33, 0x01, 0x00, 0x19, 0x07, 0x02, 0x18, 0x02,
+    0x00, 0x40, 0x02, 0x00, 0x1E, 0x02, 0x00, 0x0B, 0x03, 0x00,
+    0x1D, 0x06, 0x00, 0x33, 0x01, 0x00, 0x17, 0x07, 0x02, 0x20,
+    0x02, 0x00, 0x40, 0x02, 0x00, 0x1E, 0x02, 0x00, 0x0B, 0x03,
+    0x00, 0x1D, 0x06, 0x00, 0x33, 0x01, 0x00, 0x1F, 0x09, 0x02,
+    0x00, 0x28, 0x02, 0x00, 0xCF, 0x04, 0x73, 0x6F, 0x72, 0x74,
+    0xD7, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x06, 0x02, 0x01, 0x02,
+    0x01, 0x0E, 0x01, 0xCE, 0x04, 0x73, 0x6F, 0x72, 0x74, 0xDA,
+    0x12, 0xDA, 0x83, 0xE6, 0x28, 0x02, 0x00, 0x00, 0x39, 0x03,
+    0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x07, 0x04, 0x03, 0x05,
+    0x1A, 0x01, 0x03, 0x00, 0x17, 0x03, 0x01, 0x00, 0x18, 0x03,
+    0x00, 0x00, 0x26, 0x05, 0x00, 0x00, 0x17, 0x03, 0x05, 0x00,
+    0x25, 0x05, 0x00, 0x00, 0x2D, 0x00, 0x05, 0x04, 0x2B, 0x03,
+    0x00, 0x00, 0x27, 0x05, 0x00, 0x02, 0x30, 0x05, 0x00, 0x00,
+    0xBF, 0xFF, 0x10, 0x01, 0x86, 0x0A, 0x0A, 0x01, 0x02, 0x28,
+    0x02, 0x00, 0x05, 0x05, 0x00, 0x22, 0x05, 0x00, 0x3F, 0x00,
+    0x05, 0xDA, 0x85, 0x32, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00,
+    0x10, 0x04, 0x04, 0x04, 0x00, 0x1C, 0xCE, 0x04, 0x70, 0x61,
+    0x72, 0x74, 0xDA, 0x12, 0x28, 0x04, 0x00, 0x00, 0x34, 0x05,
+    0x00, 0x02, 0x17, 0x06, 0x05, 0x00, 0x17, 0x07, 0x01, 0x00,
+    0x17, 0x08, 0x01, 0x00, 0x17, 0x09, 0x02, 0x00, 0x41, 0x0A,
+    0x08, 0x09, 0x1A, 0x0A, 0x11, 0x00, 0x17, 0x0B, 0x08, 0x00,
+    0x34, 0x0C, 0x00, 0x0B, 0x17, 0x0D, 0x0C, 0x00, 0x2C, 0x0D,
+    0x06, 0x00, 0x2F, 0x0C, 0x03, 0x00, 0x1A, 0x0C, 0x08, 0x00,
+    0x34, 0x0E, 0x00, 0x07, 0x17, 0x0F, 0x0E, 0x00, 0x36, 0x00,
+    0x07, 0x0D, 0x36, 0x00, 0x0B, 0x0F, 0x25, 0x0E, 0x01, 0x00,
+    0x06, 0x07, 0x07, 0x0E, 0x18, 0x01, 0x00, 0x00, 0x25, 0x0C,
+    0x01, 0x00, 0x06, 0x08, 0x08, 0x0C, 0x18, 0xEF, 0xFF, 0xFF,
+    0x34, 0x08, 0x00, 0x07, 0x36, 0x00, 0x02, 0x08, 0x36, 0x00,
+    0x07, 0x06, 0x03, 0x07, 0x00, 0x00, 0x3D, 0x01, 0xD8, 0x09,
+    0x0A, 0x01, 0x04, 0x1A, 0x01, 0x00, 0x15, 0x01, 0x02, 0x00,
+    0x05, 0x02, 0x00, 0x01, 0x02, 0x14, 0x01, 0x00, 0x0F, 0x02,
+    0x02, 0x0C, 0x01, 0x00, 0x0B, 0x01, 0x02, 0x14, 0x01, 0x00,
+    0x0F, 0x01, 0x02, 0x00, 0x01, 0x02, 0x00, 0x02, 0x02, 0x00,
+    0x01, 0x07, 0x03, 0x03, 0x03, 0x03, 0x01, 0x0E, 0x18, 0x01,
+    0x00, 0x17, 0x01, 0x02, 0x00, 0x01, 0x17, 0x03, 0xD7, 0xCD,
+    0x02, 0xD8, 0x00, 0x00, 0x09, 0x04, 0x04, 0x04, 0x00, 0x14,
+    0x01, 0xCE, 0x09, 0x73, 0x6F, 0x72, 0x74, 0x2D, 0x68, 0x65,
+    0x6C, 0x70, 0xDA, 0x12, 0x28, 0x04, 0x00, 0x00, 0x43, 0x05,
+    0x02, 0x01, 0x1A, 0x05, 0x11, 0x00, 0x2D, 0x00, 0x01, 0x02,
+    0x2B, 0x03, 0x00, 0x00, 0x27, 0x07, 0x00, 0x01, 0x2F, 0x06,
+    0x07, 0x00, 0x17, 0x07, 0x06, 0x00, 0x25, 0x08, 0x01, 0x00,
+    0x07, 0x06, 0x07, 0x08, 0x2D, 0x00, 0x01, 0x06, 0x2B, 0x03,
+    0x00, 0x00, 0x2F, 0x08, 0x04, 0x00, 0x25, 0x08, 0x01, 0x00,
+    0x06, 0x06, 0x07, 0x08, 0x2D, 0x00, 0x06, 0x02, 0x2B, 0x03,
+    0x00, 0x00, 0x2F, 0x08, 0x04, 0x00, 0x18, 0x01, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x22, 0x01, 0xF6, 0x09,
+    0x0A, 0x01, 0x04, 0x10, 0x01, 0x00, 0x0B, 0x04, 0x02, 0x16,
+    0x01, 0x00, 0x11, 0x02, 0x02, 0x20, 0x03, 0x00, 0x1F, 0x02,
+    0x02, 0x1A, 0x03, 0x00, 0x19, 0x01, 0x05, 0x03, 0x01, 0x03,
+    0x03, 0xDB, 0x02, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00,
+    0xDA, 0x12, 0x82, 0x68, 0x01, 0xDA, 0x03, 0xDA, 0x85, 0x32,
+    0xDA, 0x05, 0xCE, 0x53, 0x28, 0x73, 0x6F, 0x72, 0x74, 0x20,
+    0x78, 0x73, 0x20, 0x5B, 0x2C, 0x20, 0x62, 0x79, 0x5D, 0x29,
+    0x0A, 0x0A, 0x53, 0x6F, 0x72, 0x74, 0x20, 0x61, 0x6E, 0x20,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x69, 0x6E, 0x2D, 0x70,
+    0x6C, 0x61, 0x63, 0x65, 0x2E, 0x20, 0x55, 0x73, 0x65, 0x73,
+    0x20, 0x71, 0x75, 0x69, 0x63, 0x6B, 0x2D, 0x73, 0x6F, 0x72,
+    0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x73, 0x20, 0x6E,
+    0x6F, 0x74, 0x20, 0x61, 0x20, 0x73, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x20, 0x73, 0x6F, 0x72, 0x74, 0x2E, 0xDA, 0x03, 0xCF,
+    0x04, 0x69, 0x6E, 0x74, 0x3F, 0xD8, 0x04, 0x69, 0x6E, 0x74,
+    0x3F, 0xCF, 0x0A, 0x74, 0x61, 0x6B, 0x65, 0x2D, 0x77, 0x68,
+    0x69, 0x6C, 0x65, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x05,
+    0x02, 0x02, 0x02, 0x02, 0x07, 0xCE, 0x0A, 0x74, 0x61, 0x6B,
+    0x65, 0x2D, 0x77, 0x68, 0x69, 0x6C, 0x65, 0xDA, 0x12, 0xDA,
+    0x82, 0xEB, 0xDA, 0x84, 0xEB, 0x28, 0x02, 0x00, 0x00, 0x2B,
+    0x00, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x03, 0x04,
+    0x00, 0x2C, 0x03, 0x01, 0x00, 0x26, 0x04, 0x01, 0x00, 0x30,
+    0x04, 0x00, 0x00, 0x0A, 0x01, 0xA0, 0x0C, 0x02, 0x03, 0x08,
+    0x1C, 0x03, 0x00, 0x17, 0xCF, 0x10, 0x6D, 0x61, 0x74, 0x68,
+    0x2F, 0x72, 0x6E, 0x67, 0x2D, 0x75, 0x6E, 0x69, 0x66, 0x6F,
+    0x72, 0x6D, 0xD8, 0x10, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x72,
+    0x6E, 0x67, 0x2D, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D,
+    0xCF, 0x05, 0x6D, 0x61, 0x74, 0x63, 0x68, 0xD7, 0xCD, 0x02,
+    0xBB, 0x00, 0x00, 0x0A, 0x01, 0x01, 0xCD, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x06, 0x22, 0x01, 0xCE, 0x05, 0x6D, 0x61, 0x74, 0x63,
+    0x68, 0xDA, 0x12, 0xDA, 0x4C, 0xDA, 0x55, 0xDA, 0x84, 0x1E,
+    0xDA, 0x56, 0xDA, 0x57, 0xDA, 0x59, 0x28, 0x02, 0x00, 0x00,
+    0x17, 0x03, 0x00, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x06,
+    0x00, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x1A, 0x05, 0x03, 0x00,
+    0x17, 0x04, 0x03, 0x00, 0x18, 0x04, 0x00, 0x00, 0x26, 0x07,
+    0x01, 0x00, 0x2F, 0x06, 0x07, 0x00, 0x17, 0x04, 0x06, 0x00,
+    0x17, 0x05, 0x04, 0x00, 0x39, 0x04, 0x01, 0x00, 0x17, 0x06,
+    0x04, 0x00, 0x2B, 0x06, 0x00, 0x00, 0x26, 0x07, 0x02, 0x00,
+    0x2F, 0x04, 0x07, 0x00, 0x17, 0x07, 0x04, 0x00, 0x2A, 0x04,
+    0x00, 0x00, 0x25, 0x08, 0x00, 0x00, 0x2B, 0x08, 0x00, 0x00,
+    0x2F, 0x08, 0x04, 0x00, 0x17, 0x04, 0x08, 0x00, 0x1F, 0x06,
+    0x03, 0x05, 0x1A, 0x06, 0x02, 0x00, 0x03, 0x04, 0x00, 0x00,
+    0x26, 0x08, 0x03, 0x00, 0x2D, 0x08, 0x05, 0x03, 0x26, 0x09,
+    0x04, 0x00, 0x2F, 0x08, 0x09, 0x00, 0x26, 0x09, 0x05, 0x00,
+    0x2D, 0x09, 0x08, 0x04, 0x26, 0x09, 0x04, 0x00, 0x30, 0x09,
+    0x00, 0x00, 0xCD, 0x02, 0xFA, 0x00, 0x00, 0x0A, 0x01, 0x01,
+    0x01, 0x06, 0x27, 0x01, 0x01, 0xDA, 0x49, 0xDA, 0x12, 0xDA,
+    0x55, 0xD7, 0xCD, 0x02, 0xBA, 0x00, 0x00, 0x13, 0x04, 0x04,
+    0x04, 0x11, 0x80, 0xAA, 0x03, 0xCE, 0x07, 0x6D, 0x61, 0x74,
+    0x63, 0x68, 0x2D, 0x31, 0xDA, 0x12, 0xDA, 0x81, 0xED, 0xDA,
+    0x81, 0x36, 0xDA, 0x58, 0xD2, 0x02, 0x00, 0xDA, 0x81, 0xEF,
+    0xCF, 0x07, 0x5F, 0x30, 0x30, 0x30, 0x30, 0x31, 0x6B, 0xDA,
+    0x56, 0xDA, 0x83, 0x1B, 0xDA, 0x77, 0xD0, 0x06, 0x70, 0x61,
+    0x72, 0x65, 0x6E, 0x73, 0xCF, 0x01, 0x40, 0xDA, 0x84, 0xBE,
+    0xDA, 0x4C, 0xDA, 0x55, 0xCF, 0x08, 0x69, 0x6E, 0x64, 0x65,
+    0x78, 0x65, 0x64, 0x3F, 0xDA, 0x57, 0xDA, 0x59, 0xD7, 0xCD,
+    0x02, 0x98, 0x00, 0x00, 0x07, 0x01, 0x01, 0x01, 0x03, 0x0D,
+    0xCE, 0x0B, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61,
+    0x72, 0x79, 0x3F, 0xDA, 0x12, 0xDA, 0x15, 0xDA, 0x4F, 0xDA,
+    0x4E, 0x28, 0x01, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26,
+    0x03, 0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x17, 0x03, 0x02,
+    0x00, 0x26, 0x05, 0x01, 0x00, 0x1F, 0x04, 0x03, 0x05, 0x1A,
+    0x04, 0x03, 0x00, 0x23, 0x05, 0x00, 0x00, 0x03, 0x05, 0x00,
+    0x00, 0x26, 0x06, 0x02, 0x00, 0x1F, 0x05, 0x03, 0x06, 0x03,
+    0x05, 0x00, 0x00, 0x13, 0x01, 0xC8, 0x01, 0x02, 0x03, 0x02,
+    0x12, 0x01, 0x00, 0x0D, 0x02, 0x02, 0x08, 0x03, 0x00, 0x07,
+    0x03, 0x00, 0x2C, 0xCF, 0x0B, 0x64, 0x69, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x61, 0x72, 0x79, 0x3F, 0x28, 0x04, 0x00, 0x00,
+    0x2B, 0x00, 0x00, 0x00, 0x26, 0x06, 0x00, 0x00, 0x2F, 0x05,
+    0x06, 0x00, 0x1A, 0x05, 0x1D, 0x00, 0x34, 0x06, 0x03, 0x00,
+    0x1A, 0x06, 0x0B, 0x00, 0x26, 0x08, 0x01, 0x00, 0x2D, 0x08,
+    0x00, 0x01, 0x3F, 0x07, 0x00, 0x00, 0x2F, 0x08, 0x02, 0x00,
+    0x26, 0x0A, 0x02, 0x00, 0x2D, 0x0A, 0x07, 0x08, 0x26, 0x0A,
+    0x03, 0x00, 0x2B, 0x0A, 0x00, 0x00, 0x3F, 0x09, 0x00, 0x00,
+    0x03, 0x09, 0x00, 0x00, 0x23, 0x07, 0x00, 0x00, 0x36, 0x03,
+    0x00, 0x07, 0x26, 0x08, 0x04, 0x00, 0x2D, 0x08, 0x00, 0x01,
+    0x3F, 0x07, 0x00, 0x00, 0x26, 0x09, 0x01, 0x00, 0x22, 0x0A,
+    0x00, 0x00, 0x2D, 0x09, 0x0A, 0x07, 0x3F, 0x08, 0x00, 0x00,
+    0x2F, 0x07, 0x02, 0x00, 0x26, 0x0A, 0x02, 0x00, 0x26, 0x0B,
+    0x03, 0x00, 0x2D, 0x0A, 0x08, 0x0B, 0x2B, 0x07, 0x00, 0x00,
+    0x3F, 0x09, 0x00, 0x00, 0x03, 0x09, 0x00, 0x00, 0x2B, 0x00,
+    0x00, 0x00, 0x26, 0x08, 0x05, 0x00, 0x2F, 0x07, 0x08, 0x00,
+    0x1A, 0x07, 0x08, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x09,
+    0x06, 0x00, 0x2F, 0x08, 0x09, 0x00, 0x26, 0x0A, 0x07, 0x00,
+    0x1F, 0x09, 0x0A, 0x08, 0x17, 0x06, 0x09, 0x00, 0x18, 0x02,
+    0x00, 0x00, 0x22, 0x06, 0x00, 0x00, 0x1A, 0x06, 0x24, 0x00,
+    0x25, 0x08, 0x00, 0x00, 0x2B, 0x08, 0x00, 0x00, 0x2F, 0x08,
+    0x00, 0x00, 0x26, 0x0A, 0x08, 0x00, 0x1F, 0x09, 0x08, 0x0A,
+    0x1A, 0x09, 0x09, 0x00, 0x25, 0x08, 0x01, 0x00, 0x2B, 0x08,
+    0x00, 0x00, 0x2F, 0x08, 0x00, 0x00, 0x2B, 0x08, 0x00, 0x00,
+    0x26, 0x0B, 0x00, 0x00, 0x2F, 0x0A, 0x0B, 0x00, 0x17, 0x07,
+    0x0A, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x07, 0x00, 0x00,
+    0x1A, 0x07, 0x0E, 0x00, 0x25, 0x08, 0x01, 0x00, 0x2B, 0x08,
+    0x00, 0x00, 0x2F, 0x08, 0x00, 0x00, 0x26, 0x0A, 0x01, 0x00,
+    0x2D, 0x0A, 0x08, 0x01, 0x3F, 0x09, 0x00, 0x00, 0x2F, 0x08,
+    0x02, 0x00, 0x26, 0x0B, 0x02, 0x00, 0x2D, 0x0B, 0x09, 0x08,
+    0x26, 0x0B, 0x03, 0x00, 0x2B, 0x0B, 0x00, 0x00, 0x3F, 0x0A,
+    0x00, 0x00, 0x03, 0x0A, 0x00, 0x00, 0x25, 0x09, 0x00, 0x00,
+    0x34, 0x08, 0x00, 0x09, 0x2A, 0x09, 0x00, 0x00, 0x2D, 0x08,
+    0x01, 0x09, 0x2B, 0x03, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00,
+    0x2B, 0x00, 0x00, 0x00, 0x26, 0x08, 0x09, 0x00, 0x2F, 0x07,
+    0x08, 0x00, 0x1A, 0x07, 0x25, 0x00, 0x39, 0x08, 0x00, 0x00,
+    0x17, 0x09, 0x08, 0x00, 0x25, 0x08, 0xFF, 0xFF, 0x17, 0x0A,
+    0x01, 0x00, 0x2B, 0x0A, 0x00, 0x00, 0x26, 0x0D, 0x0A, 0x00,
+    0x2F, 0x0C, 0x0D, 0x00, 0x1A, 0x0C, 0x03, 0x00, 0x17, 0x0B,
+    0x0A, 0x00, 0x18, 0x04, 0x00, 0x00, 0x26, 0x0E, 0x0B, 0x00,
+    0x2F, 0x0D, 0x0E, 0x00, 0x17, 0x0B, 0x0D, 0x00, 0x17, 0x0C,
+    0x0B, 0x00, 0x26, 0x0D, 0x0C, 0x00, 0x2C, 0x0D, 0x0C, 0x00,
+    0x3F, 0x0B, 0x00, 0x00, 0x2A, 0x0D, 0x01, 0x00, 0x2F, 0x0E,
+    0x0D, 0x00, 0x26, 0x0F, 0x02, 0x00, 0x2D, 0x0F, 0x0B, 0x0E,
+    0x26, 0x0F, 0x03, 0x00, 0x2B, 0x0F, 0x00, 0x00, 0x3F, 0x0D,
+    0x00, 0x00, 0x17, 0x0B, 0x0D, 0x00, 0x1F, 0x0D, 0x0A, 0x0C,
+    0x1A, 0x0D, 0x02, 0x00, 0x03, 0x0B, 0x00, 0x00, 0x26, 0x0E,
+    0x04, 0x00, 0x2D, 0x0E, 0x0C, 0x0A, 0x26, 0x0F, 0x0D, 0x00,
+    0x2F, 0x0E, 0x0F, 0x00, 0x26, 0x0F, 0x0E, 0x00, 0x2D, 0x0F,
+    0x0E, 0x0B, 0x26, 0x0F, 0x0D, 0x00, 0x30, 0x0F, 0x00, 0x00,
+    0x2B, 0x00, 0x00, 0x00, 0x26, 0x0B, 0x0F, 0x00, 0x2F, 0x0A,
+    0x0B, 0x00, 0x1A, 0x0A, 0x23, 0x00, 0x22, 0x0B, 0x00, 0x00,
+    0x17, 0x0D, 0x01, 0x00, 0x2B, 0x0D, 0x00, 0x00, 0x26, 0x10,
+    0x0A, 0x00, 0x2F, 0x0F, 0x10, 0x00, 0x1A, 0x0F, 0x03, 0x00,
+    0x17, 0x0E, 0x0D, 0x00, 0x18, 0x04, 0x00, 0x00, 0x26, 0x11,
+    0x0B, 0x00, 0x2F, 0x10, 0x11, 0x00, 0x17, 0x0E, 0x10, 0x00,
+    0x17, 0x0F, 0x0E, 0x00, 0x26, 0x10, 0x10, 0x00, 0x2C, 0x10,
+    0x0F, 0x00, 0x3F, 0x0E, 0x00, 0x00, 0x2A, 0x10, 0x02, 0x00,
+    0x2F, 0x11, 0x10, 0x00, 0x26, 0x12, 0x02, 0x00, 0x2D, 0x12,
+    0x0E, 0x11, 0x26, 0x12, 0x03, 0x00, 0x2B, 0x12, 0x00, 0x00,
+    0x3F, 0x10, 0x00, 0x00, 0x17, 0x0E, 0x10, 0x00, 0x1F, 0x10,
+    0x0D, 0x0F, 0x1A, 0x10, 0x02, 0x00, 0x03, 0x0E, 0x00, 0x00,
+    0x26, 0x11, 0x04, 0x00, 0x2D, 0x11, 0x0F, 0x0D, 0x26, 0x12,
+    0x0D, 0x00, 0x2F, 0x11, 0x12, 0x00, 0x26, 0x12, 0x0E, 0x00,
+    0x2D, 0x12, 0x11, 0x0E, 0x26, 0x12, 0x0D, 0x00, 0x30, 0x12,
+    0x00, 0x00, 0x26, 0x0E, 0x01, 0x00, 0x2D, 0x0E, 0x00, 0x01,
+    0x3F, 0x0D, 0x00, 0x00, 0x2F, 0x0E, 0x02, 0x00, 0x26, 0x11,
+    0x02, 0x00, 0x2D, 0x11, 0x0D, 0x0E, 0x26, 0x11, 0x03, 0x00,
+    0x2B, 0x11, 0x00, 0x00, 0x3F, 0x10, 0x00, 0x00, 0x03, 0x10,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xCD, 0x02, 0xD0, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x11, 0x01, 0xDA, 0x12,
+    0xDA, 0x80, 0xA1, 0xDA, 0x84, 0xE3, 0xDA, 0x58, 0xDA, 0x85,
+    0x45, 0x27, 0x00, 0x00, 0x00, 0x25, 0x01, 0x01, 0x00, 0x2C,
+    0x00, 0x01, 0x00, 0x26, 0x01, 0x00, 0x00, 0x2F, 0x00, 0x01,
+    0x00, 0x26, 0x02, 0x01, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x2E,
+    0x00, 0x00, 0x00, 0x3F, 0x01, 0x00, 0x00, 0x27, 0x02, 0x00,
+    0x02, 0x2F, 0x00, 0x02, 0x00, 0x26, 0x03, 0x02, 0x00, 0x2D,
+    0x03, 0x01, 0x00, 0x26, 0x03, 0x03, 0x00, 0x2B, 0x03, 0x00,
+    0x00, 0x3F, 0x02, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0xBF,
+    0xFF, 0x07, 0x05, 0xFC, 0x12, 0x2C, 0x0C, 0x00, 0x15, 0xCD,
+    0x02, 0xD8, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x19,
+    0x01, 0xDA, 0x49, 0xDA, 0x12, 0xDA, 0x67, 0xDA, 0x57, 0x28,
+    0x00, 0x00, 0x00, 0x27, 0x02, 0x00, 0x08, 0x25, 0x03, 0x01,
+    0x00, 0x06, 0x01, 0x02, 0x03, 0x29, 0x01, 0x00, 0x08, 0x27,
+    0x03, 0x00, 0x08, 0x27, 0x04, 0x00, 0x09, 0x1F, 0x02, 0x03,
+    0x04, 0x1A, 0x02, 0x03, 0x00, 0x27, 0x03, 0x00, 0x02, 0x30,
+    0x03, 0x00, 0x00, 0x27, 0x04, 0x00, 0x00, 0x27, 0x05, 0x00,
+    0x08, 0x34, 0x03, 0x04, 0x05, 0x26, 0x04, 0x00, 0x00, 0x27,
+    0x05, 0x00, 0x0C, 0x27, 0x06, 0x00, 0x08, 0x2D, 0x04, 0x05,
+    0x06, 0x26, 0x05, 0x01, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x2D,
+    0x03, 0x04, 0x00, 0x27, 0x05, 0x00, 0x03, 0x2B, 0x05, 0x00,
+    0x00, 0x27, 0x05, 0x00, 0x04, 0x30, 0x05, 0x00, 0x00, 0xBF,
+    0xFF, 0x19, 0x01, 0x8E, 0x13, 0x1C, 0x04, 0x02, 0x04, 0x03,
+    0x02, 0x08, 0x01, 0x00, 0x07, 0x02, 0x02, 0x04, 0x03, 0x02,
+    0x12, 0x06, 0x00, 0x1E, 0x05, 0x00, 0x2F, 0xCD, 0x02, 0xD8,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x1B, 0x01, 0xDA,
+    0x49, 0xDA, 0x12, 0xDA, 0x81, 0x16, 0xDA, 0x67, 0xDA, 0x57,
+    0x28, 0x00, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x27, 0x02,
+    0x00, 0x0B, 0x2C, 0x01, 0x02, 0x00, 0x26, 0x02, 0x00, 0x00,
+    0x2F, 0x01, 0x02, 0x00, 0x29, 0x01, 0x00, 0x0B, 0x27, 0x03,
+    0x00, 0x0B, 0x22, 0x04, 0x00, 0x00, 0x1F, 0x02, 0x03, 0x04,
+    0x1A, 0x02, 0x03, 0x00, 0x27, 0x03, 0x00, 0x02, 0x30, 0x03,
+    0x00, 0x00, 0x27, 0x04, 0x00, 0x00, 0x27, 0x05, 0x00, 0x0B,
+    0x34, 0x03, 0x04, 0x05, 0x26, 0x04, 0x01, 0x00, 0x27, 0x05,
+    0x00, 0x0F, 0x27, 0x06, 0x00, 0x0B, 0x2D, 0x04, 0x05, 0x06,
+    0x26, 0x05, 0x02, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x2D, 0x03,
+    0x04, 0x00, 0x27, 0x05, 0x00, 0x03, 0x2B, 0x05, 0x00, 0x00,
+    0x27, 0x05, 0x00, 0x04, 0x30, 0x05, 0x00, 0x00, 0xBF, 0xFF,
+    0x19, 0x01, 0xA8, 0x13, 0x1C, 0x06, 0x02, 0x16, 0x03, 0x02,
+    0x09, 0x01, 0x00, 0x07, 0x02, 0x02, 0x04, 0x03, 0x02, 0x12,
+    0x06, 0x00, 0x22, 0x05, 0x00, 0x33, 0x80, 0x88, 0x01, 0xD8,
+    0x12, 0x02, 0x03, 0x08, 0x08, 0x01, 0x03, 0x03, 0x01, 0x06,
+    0x0C, 0x01, 0x00, 0x07, 0x0A, 0x02, 0x04, 0x02, 0x04, 0x04,
+    0x0E, 0x02, 0x00, 0x03, 0x04, 0x02, 0x01, 0x00, 0x09, 0x03,
+    0x00, 0x42, 0x02, 0x00, 0x15, 0x03, 0x00, 0x2B, 0x01, 0x11,
+    0x03, 0x03, 0x14, 0x1C, 0x02, 0x00, 0x05, 0x01, 0x00, 0x09,
+    0x03, 0x00, 0x42, 0x03, 0x00, 0x11, 0x03, 0x00, 0x2F, 0x01,
+    0x00, 0x07, 0x0D, 0x04, 0x04, 0x02, 0x04, 0x04, 0x01, 0x02,
+    0x00, 0x03, 0x03, 0x03, 0x03, 0x0A, 0x03, 0x01, 0x23, 0x03,
+    0x01, 0x28, 0x1A, 0x01, 0x00, 0x11, 0x01, 0x02, 0x00, 0x0B,
+    0x02, 0x00, 0x03, 0x04, 0x04, 0x01, 0x02, 0x0A, 0x06, 0x01,
+    0x09, 0x0C, 0x03, 0x03, 0x03, 0x14, 0x03, 0x01, 0x3F, 0x03,
+    0x01, 0x44, 0x08, 0x0B, 0x02, 0x00, 0x03, 0x04, 0x04, 0x01,
+    0x02, 0x0A, 0x06, 0x01, 0x09, 0x0C, 0x03, 0x03, 0x0A, 0x14,
+    0x08, 0x01, 0x59, 0x0F, 0xDA, 0x56, 0xDA, 0x81, 0x36, 0xDA,
+    0x85, 0x45, 0xDA, 0x58, 0x28, 0x01, 0x00, 0x00, 0x27, 0x03,
+    0x00, 0x07, 0x1F, 0x02, 0x00, 0x03, 0x1A, 0x02, 0x04, 0x00,
+    0x27, 0x04, 0x00, 0x01, 0x34, 0x03, 0x04, 0x00, 0x03, 0x03,
+    0x00, 0x00, 0x27, 0x04, 0x00, 0x07, 0x41, 0x03, 0x00, 0x04,
+    0x1A, 0x03, 0x1D, 0x00, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x04,
+    0x05, 0x00, 0x17, 0x05, 0x04, 0x00, 0x27, 0x06, 0x00, 0x01,
+    0x34, 0x04, 0x06, 0x00, 0x2A, 0x06, 0x00, 0x00, 0x3E, 0x07,
+    0x00, 0x00, 0x27, 0x08, 0x00, 0x05, 0x2D, 0x04, 0x08, 0x06,
+    0x2B, 0x07, 0x00, 0x00, 0x26, 0x09, 0x01, 0x00, 0x2F, 0x08,
+    0x09, 0x00, 0x26, 0x06, 0x02, 0x00, 0x2D, 0x06, 0x05, 0x08,
+    0x3F, 0x04, 0x00, 0x00, 0x26, 0x07, 0x03, 0x00, 0x26, 0x08,
+    0x04, 0x00, 0x2D, 0x07, 0x08, 0x04, 0x3F, 0x06, 0x00, 0x00,
+    0x25, 0x07, 0x02, 0x00, 0x06, 0x04, 0x07, 0x00, 0x2B, 0x04,
+    0x00, 0x00, 0x2F, 0x07, 0x01, 0x00, 0x26, 0x08, 0x05, 0x00,
+    0x2D, 0x08, 0x06, 0x07, 0x2B, 0x05, 0x00, 0x00, 0x3F, 0x04,
+    0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xCD, 0x02, 0xD0, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x01, 0x07, 0x02, 0xDA, 0x12, 0xDA, 0x3F, 0x27, 0x00,
+    0x01, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00,
+    0x2F, 0x00, 0x01, 0x00, 0x27, 0x02, 0x00, 0x01, 0x34, 0x01,
+    0x02, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x08,
+    0x04, 0xDE, 0x13, 0xC0, 0x01, 0x03, 0x00, 0x13, 0x28, 0x01,
+    0xD6, 0x13, 0x0C, 0x02, 0x04, 0x08, 0x01, 0x01, 0x03, 0x03,
+    0x02, 0x1C, 0x02, 0x02, 0x17, 0x01, 0x03, 0x03, 0x03, 0x04,
+    0x1C, 0x02, 0x02, 0x52, 0x01, 0x00, 0x20, 0x0D, 0x00, 0x6D,
+    0x02, 0x02, 0x12, 0x07, 0x01, 0x11, 0x01, 0x05, 0x1F, 0x1C,
+    0x01, 0xBA, 0x13, 0x02, 0x0B, 0x16, 0x04, 0x01, 0x02, 0x16,
+    0x01, 0x00, 0x11, 0x03, 0x02, 0x16, 0x01, 0x00, 0x15, 0x01,
+    0x02, 0x02, 0x03, 0x00, 0x01, 0x0C, 0x05, 0x03, 0xCF, 0x05,
+    0x6D, 0x61, 0x63, 0x65, 0x78, 0xDA, 0x84, 0x35, 0xCF, 0x08,
+    0x6D, 0x61, 0x6B, 0x65, 0x2D, 0x65, 0x6E, 0x76, 0xDA, 0x83,
+    0x73, 0xCF, 0x06, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3C, 0xDA,
+    0x83, 0xE6, 0xCF, 0x0C, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x72,
+    0x6E, 0x67, 0x2D, 0x69, 0x6E, 0x74, 0xD8, 0x0C, 0x6D, 0x61,
+    0x74, 0x68, 0x2F, 0x72, 0x6E, 0x67, 0x2D, 0x69, 0x6E, 0x74,
+    0xCF, 0x06, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3E, 0xDA, 0x84,
+    0xDB, 0xCF, 0x02, 0x3E, 0x3D, 0xD7, 0xCD, 0x00, 0x09, 0x00,
+    0x1C, 0x06, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
+    0x10, 0xCE, 0x02, 0x3E, 0x3D, 0x39, 0x01, 0x00, 0x00, 0x1E,
+    0x02, 0x01, 0x02, 0x19, 0x02, 0x0A, 0x00, 0x37, 0x03, 0x00,
+    0x00, 0x25, 0x05, 0x01, 0x00, 0x34, 0x04, 0x00, 0x05, 0x44,
+    0x02, 0x03, 0x04, 0x1A, 0x02, 0x07, 0x00, 0x05, 0x05, 0x05,
+    0x01, 0x17, 0x03, 0x04, 0x00, 0x1F, 0x02, 0x05, 0x01, 0x1A,
+    0x02, 0xFA, 0xFF, 0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00,
+    0x00, 0x24, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xCF,
+    0x09, 0x6F, 0x73, 0x2F, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76,
+    0xD8, 0x09, 0x6F, 0x73, 0x2F, 0x67, 0x65, 0x74, 0x65, 0x6E,
+    0x76, 0xCF, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x63,
+    0x6F, 0x73, 0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61,
+    0x63, 0x6F, 0x73, 0xCF, 0x03, 0x67, 0x65, 0x74, 0xD7, 0xCD,
+    0x00, 0x08, 0x00, 0x21, 0x04, 0x03, 0x02, 0x03, 0x00, 0x06,
+    0xCE, 0x03, 0x67, 0x65, 0x74, 0x35, 0x00, 0x00, 0x01, 0x22,
+    0x03, 0x00, 0x00, 0x1F, 0x03, 0x00, 0x03, 0x19, 0x03, 0x02,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0xCF,
+    0x04, 0x64, 0x6F, 0x63, 0x2A, 0xD7, 0xCD, 0x02, 0xBA, 0x00,
+    0x00, 0x10, 0x01, 0x00, 0x01, 0x1A, 0x7D, 0x01, 0xCE, 0x04,
+    0x64, 0x6F, 0x63, 0x2A, 0xDA, 0x12, 0xDA, 0x83, 0x6D, 0xD7,
+    0xCD, 0x02, 0x98, 0x00, 0x00, 0x0C, 0x01, 0x01, 0x01, 0x0C,
+    0x33, 0xCE, 0x0B, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x2D, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0xDA, 0x12, 0xD7, 0xCD, 0x02, 0x98,
+    0x00, 0x00, 0x03, 0x01, 0x00, 0x01, 0x02, 0x05, 0xCE, 0x0C,
+    0x61, 0x6C, 0x6C, 0x2D, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x73, 0xDA, 0x12, 0xDA, 0x81, 0xED, 0xD7, 0xCD, 0x02,
+    0x98, 0x00, 0x00, 0x11, 0x02, 0x01, 0x02, 0x07, 0x3B, 0xCE,
+    0x08, 0x65, 0x6E, 0x76, 0x2D, 0x77, 0x61, 0x6C, 0x6B, 0xDA,
+    0x12, 0xDA, 0x81, 0x74, 0xDA, 0x80, 0xDA, 0xDA, 0x81, 0x1B,
+    0xD8, 0x0E, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x67, 0x65,
+    0x74, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0xDA, 0x81, 0x16, 0xDA,
+    0x83, 0x84, 0xDA, 0x85, 0x32, 0x28, 0x02, 0x00, 0x00, 0x22,
+    0x05, 0x00, 0x00, 0x1F, 0x04, 0x05, 0x01, 0x1A, 0x04, 0x08,
+    0x00, 0x26, 0x06, 0x00, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x2B,
+    0x05, 0x00, 0x00, 0x26, 0x07, 0x01, 0x00, 0x2F, 0x06, 0x07,
+    0x00, 0x17, 0x03, 0x06, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17,
+    0x03, 0x01, 0x00, 0x17, 0x04, 0x03, 0x00, 0x3A, 0x05, 0x00,
+    0x00, 0x17, 0x06, 0x05, 0x00, 0x17, 0x07, 0x04, 0x00, 0x1A,
+    0x07, 0x08, 0x00, 0x2C, 0x06, 0x07, 0x00, 0x26, 0x09, 0x02,
+    0x00, 0x2F, 0x08, 0x09, 0x00, 0x2B, 0x07, 0x00, 0x00, 0x26,
+    0x08, 0x03, 0x00, 0x2F, 0x07, 0x08, 0x00, 0x18, 0xF9, 0xFF,
+    0xFF, 0x3E, 0x07, 0x00, 0x00, 0x17, 0x08, 0x07, 0x00, 0x25,
+    0x09, 0x00, 0x00, 0x39, 0x0A, 0x06, 0x00, 0x17, 0x0B, 0x0A,
+    0x00, 0x41, 0x0A, 0x09, 0x0B, 0x1A, 0x0A, 0x17, 0x00, 0x34,
+    0x0C, 0x06, 0x09, 0x17, 0x0D, 0x0C, 0x00, 0x22, 0x0C, 0x00,
+    0x00, 0x2C, 0x0D, 0x0C, 0x00, 0x26, 0x0E, 0x04, 0x00, 0x2F,
+    0x0C, 0x0E, 0x00, 0x17, 0x0E, 0x0C, 0x00, 0x1A, 0x0E, 0x0C,
+    0x00, 0x17, 0x0C, 0x0E, 0x00, 0x2B, 0x0C, 0x00, 0x00, 0x2F,
+    0x0F, 0x00, 0x00, 0x1A, 0x0F, 0x04, 0x00, 0x23, 0x10, 0x00,
+    0x00, 0x36, 0x08, 0x0C, 0x10, 0x18, 0x01, 0x00, 0x00, 0x2C,
+    0x0D, 0x0E, 0x00, 0x26, 0x0F, 0x04, 0x00, 0x2F, 0x0E, 0x0F,
+    0x00, 0x18, 0xF5, 0xFF, 0xFF, 0x25, 0x0C, 0x01, 0x00, 0x06,
+    0x09, 0x09, 0x0C, 0x18, 0xE9, 0xFF, 0xFF, 0x2B, 0x08, 0x00,
+    0x00, 0x26, 0x0A, 0x05, 0x00, 0x2F, 0x09, 0x0A, 0x00, 0x2B,
+    0x09, 0x00, 0x00, 0x26, 0x0A, 0x06, 0x00, 0x30, 0x0A, 0x00,
+    0x00, 0x3A, 0x01, 0xFA, 0x13, 0x02, 0x03, 0x04, 0x04, 0x02,
+    0x00, 0x36, 0x03, 0x00, 0x1B, 0x04, 0x00, 0x19, 0x02, 0x02,
+    0x00, 0x01, 0x02, 0x08, 0x01, 0x00, 0x18, 0x03, 0x00, 0x12,
+    0x03, 0x00, 0x36, 0x01, 0x00, 0x47, 0x02, 0x02, 0x1F, 0x0E,
+    0x02, 0x00, 0x02, 0x04, 0x1A, 0x01, 0x03, 0x19, 0x02, 0x06,
+    0x04, 0x08, 0x05, 0x03, 0x03, 0x08, 0x0C, 0x03, 0x00, 0x0B,
+    0x28, 0x01, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x2C, 0x02,
+    0x00, 0x00, 0x26, 0x02, 0x01, 0x00, 0x30, 0x02, 0x00, 0x00,
+    0x07, 0x01, 0x92, 0x14, 0x02, 0x04, 0x08, 0x04, 0xDA, 0x83,
+    0x67, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x03, 0x01, 0x00,
+    0x01, 0x02, 0x05, 0xCE, 0x0C, 0x61, 0x6C, 0x6C, 0x2D, 0x64,
+    0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x73, 0xDA, 0x12, 0xDA,
+    0x80, 0xE0, 0xDA, 0x85, 0x64, 0x28, 0x01, 0x00, 0x00, 0x26,
+    0x02, 0x00, 0x00, 0x2C, 0x02, 0x00, 0x00, 0x26, 0x02, 0x01,
+    0x00, 0x30, 0x02, 0x00, 0x00, 0x07, 0x01, 0x9E, 0x14, 0x02,
+    0x04, 0x08, 0x04, 0xD8, 0x08, 0x64, 0x65, 0x73, 0x63, 0x72,
+    0x69, 0x62, 0x65, 0xDA, 0x81, 0xF9, 0xDA, 0x82, 0x38, 0xDA,
+    0x80, 0xFD, 0xD8, 0x0B, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x2F, 0x6A, 0x6F, 0x69, 0x6E, 0xCE, 0x0B, 0x42, 0x69, 0x6E,
+    0x64, 0x69, 0x6E, 0x67, 0x73, 0x3A, 0x0A, 0x0A, 0xDA, 0x81,
+    0x5A, 0xDA, 0x80, 0xFF, 0xCE, 0x0B, 0x44, 0x79, 0x6E, 0x61,
+    0x6D, 0x69, 0x63, 0x73, 0x3A, 0x0A, 0x0A, 0x28, 0x01, 0x00,
+    0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x2C,
+    0x00, 0x02, 0x00, 0x26, 0x04, 0x01, 0x00, 0x2F, 0x03, 0x04,
+    0x00, 0x17, 0x02, 0x03, 0x00, 0x26, 0x05, 0x02, 0x00, 0x2F,
+    0x04, 0x05, 0x00, 0x2C, 0x00, 0x04, 0x00, 0x26, 0x06, 0x01,
+    0x00, 0x2F, 0x05, 0x06, 0x00, 0x26, 0x04, 0x03, 0x00, 0x2C,
+    0x04, 0x05, 0x00, 0x26, 0x06, 0x04, 0x00, 0x2F, 0x04, 0x06,
+    0x00, 0x17, 0x05, 0x04, 0x00, 0x26, 0x07, 0x05, 0x00, 0x2F,
+    0x06, 0x07, 0x00, 0x26, 0x07, 0x06, 0x00, 0x2C, 0x02, 0x07,
+    0x00, 0x26, 0x08, 0x07, 0x00, 0x2F, 0x07, 0x08, 0x00, 0x26,
+    0x08, 0x08, 0x00, 0x2C, 0x08, 0x07, 0x00, 0x26, 0x09, 0x09,
+    0x00, 0x2F, 0x08, 0x09, 0x00, 0x2B, 0x08, 0x00, 0x00, 0x26,
+    0x09, 0x0A, 0x00, 0x2F, 0x07, 0x09, 0x00, 0x2B, 0x07, 0x00,
+    0x00, 0x26, 0x09, 0x05, 0x00, 0x2F, 0x08, 0x09, 0x00, 0x26,
+    0x09, 0x05, 0x00, 0x2F, 0x07, 0x09, 0x00, 0x26, 0x09, 0x06,
+    0x00, 0x2C, 0x05, 0x09, 0x00, 0x26, 0x0A, 0x07, 0x00, 0x2F,
+    0x09, 0x0A, 0x00, 0x26, 0x0A, 0x0B, 0x00, 0x2C, 0x0A, 0x09,
+    0x00, 0x26, 0x0B, 0x09, 0x00, 0x2F, 0x0A, 0x0B, 0x00, 0x2B,
+    0x0A, 0x00, 0x00, 0x26, 0x0B, 0x0A, 0x00, 0x2F, 0x09, 0x0B,
+    0x00, 0x2B, 0x09, 0x00, 0x00, 0x26, 0x0B, 0x05, 0x00, 0x2F,
+    0x0A, 0x0B, 0x00, 0x26, 0x09, 0x05, 0x00, 0x30, 0x09, 0x00,
+    0x00, 0x3A, 0x01, 0xF6, 0x14, 0x02, 0x02, 0x06, 0x3A, 0x03,
+    0x00, 0x19, 0x01, 0x00, 0x1B, 0x02, 0x02, 0x52, 0x03, 0x00,
+    0x19, 0x04, 0x00, 0x1B, 0x01, 0x00, 0x1B, 0x02, 0x02, 0x00,
+    0x04, 0x02, 0x56, 0x04, 0x00, 0x2F, 0x03, 0x00, 0x17, 0x03,
+    0x00, 0x0D, 0x02, 0x02, 0x00, 0x04, 0x02, 0x56, 0x04, 0x00,
+    0x2F, 0x03, 0x00, 0x17, 0x03, 0x00, 0x0D, 0x02, 0x02, 0x00,
+    0xDA, 0x80, 0x94, 0xDA, 0x4B, 0xCE, 0x07, 0x73, 0x79, 0x6D,
+    0x62, 0x6F, 0x6C, 0x20, 0xCE, 0x0B, 0x20, 0x6E, 0x6F, 0x74,
+    0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0xDA, 0x82, 0x38,
+    0xDA, 0x83, 0x83, 0xDA, 0x15, 0xD0, 0x03, 0x76, 0x61, 0x72,
+    0xCE, 0x02, 0x20, 0x28, 0xCE, 0x01, 0x29, 0xDA, 0x81, 0x5A,
+    0xDA, 0x24, 0xDA, 0x03, 0xDA, 0x80, 0xF7, 0xDA, 0x82, 0xC6,
+    0xDA, 0x11, 0xDA, 0x05, 0xDA, 0x80, 0xF8, 0xDA, 0x82, 0xC3,
+    0xDA, 0x82, 0xB0, 0xDA, 0x80, 0xFF, 0xCE, 0x17, 0x6E, 0x6F,
+    0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64,
+    0x2E, 0xCE, 0x02, 0x0A, 0x0A, 0xDA, 0x81, 0xF1, 0x28, 0x01,
+    0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00,
+    0x2F, 0x02, 0x03, 0x00, 0x1A, 0x02, 0x05, 0x00, 0x2A, 0x03,
+    0x00, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x04, 0x01, 0x00,
+    0x30, 0x04, 0x00, 0x00, 0x1A, 0x00, 0x70, 0x00, 0x2B, 0x00,
+    0x00, 0x00, 0x26, 0x04, 0x02, 0x00, 0x2F, 0x03, 0x04, 0x00,
+    0x17, 0x04, 0x03, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x26, 0x05,
+    0x03, 0x00, 0x2F, 0x03, 0x05, 0x00, 0x1A, 0x03, 0x06, 0x00,
+    0x26, 0x05, 0x04, 0x00, 0x26, 0x06, 0x05, 0x00, 0x2D, 0x05,
+    0x00, 0x06, 0x26, 0x05, 0x06, 0x00, 0x30, 0x05, 0x00, 0x00,
+    0x26, 0x06, 0x07, 0x00, 0x2B, 0x06, 0x00, 0x00, 0x2F, 0x06,
+    0x04, 0x00, 0x1A, 0x06, 0x12, 0x00, 0x26, 0x07, 0x07, 0x00,
+    0x2B, 0x07, 0x00, 0x00, 0x2F, 0x07, 0x04, 0x00, 0x25, 0x09,
+    0x00, 0x00, 0x34, 0x08, 0x07, 0x09, 0x2B, 0x08, 0x00, 0x00,
+    0x26, 0x09, 0x08, 0x00, 0x2F, 0x07, 0x09, 0x00, 0x26, 0x08,
+    0x09, 0x00, 0x26, 0x09, 0x0A, 0x00, 0x2D, 0x08, 0x09, 0x07,
+    0x26, 0x08, 0x0B, 0x00, 0x2B, 0x08, 0x00, 0x00, 0x26, 0x09,
+    0x0C, 0x00, 0x2F, 0x08, 0x09, 0x00, 0x17, 0x05, 0x08, 0x00,
+    0x18, 0x0F, 0x00, 0x00, 0x26, 0x08, 0x0D, 0x00, 0x2B, 0x08,
+    0x00, 0x00, 0x2F, 0x08, 0x04, 0x00, 0x1A, 0x08, 0x03, 0x00,
+    0x26, 0x07, 0x0D, 0x00, 0x18, 0x08, 0x00, 0x00, 0x26, 0x09,
+    0x0E, 0x00, 0x2B, 0x09, 0x00, 0x00, 0x2F, 0x09, 0x04, 0x00,
+    0x2B, 0x09, 0x00, 0x00, 0x26, 0x0B, 0x08, 0x00, 0x2F, 0x0A,
+    0x0B, 0x00, 0x17, 0x07, 0x0A, 0x00, 0x17, 0x05, 0x07, 0x00,
+    0x26, 0x06, 0x0F, 0x00, 0x26, 0x07, 0x10, 0x00, 0x2D, 0x06,
+    0x05, 0x07, 0x26, 0x07, 0x0C, 0x00, 0x2F, 0x06, 0x07, 0x00,
+    0x17, 0x05, 0x06, 0x00, 0x26, 0x06, 0x11, 0x00, 0x2B, 0x06,
+    0x00, 0x00, 0x2F, 0x06, 0x04, 0x00, 0x17, 0x07, 0x06, 0x00,
+    0x26, 0x06, 0x12, 0x00, 0x2B, 0x06, 0x00, 0x00, 0x2F, 0x06,
+    0x04, 0x00, 0x17, 0x08, 0x06, 0x00, 0x1A, 0x08, 0x03, 0x00,
+    0x17, 0x06, 0x05, 0x00, 0x18, 0x02, 0x00, 0x00, 0x26, 0x06,
+    0x13, 0x00, 0x17, 0x09, 0x07, 0x00, 0x1A, 0x09, 0x12, 0x00,
+    0x37, 0x0B, 0x09, 0x00, 0x17, 0x0C, 0x0B, 0x00, 0x37, 0x0B,
+    0x09, 0x01, 0x17, 0x0D, 0x0B, 0x00, 0x37, 0x0B, 0x09, 0x02,
+    0x17, 0x0E, 0x0B, 0x00, 0x26, 0x0B, 0x0F, 0x00, 0x26, 0x0F,
+    0x14, 0x00, 0x2D, 0x0B, 0x0C, 0x0F, 0x26, 0x0B, 0x15, 0x00,
+    0x2D, 0x0D, 0x0B, 0x0E, 0x26, 0x0B, 0x10, 0x00, 0x2B, 0x0B,
+    0x00, 0x00, 0x26, 0x0F, 0x0C, 0x00, 0x2F, 0x0B, 0x0F, 0x00,
+    0x17, 0x0A, 0x0B, 0x00, 0x18, 0x02, 0x00, 0x00, 0x26, 0x0A,
+    0x13, 0x00, 0x1A, 0x08, 0x03, 0x00, 0x17, 0x0B, 0x08, 0x00,
+    0x18, 0x06, 0x00, 0x00, 0x1A, 0x07, 0x03, 0x00, 0x17, 0x0C,
+    0x07, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x0C, 0x00, 0x00,
+    0x17, 0x0B, 0x0C, 0x00, 0x1A, 0x0B, 0x03, 0x00, 0x26, 0x09,
+    0x10, 0x00, 0x18, 0x02, 0x00, 0x00, 0x26, 0x09, 0x13, 0x00,
+    0x1A, 0x08, 0x06, 0x00, 0x2B, 0x08, 0x00, 0x00, 0x26, 0x0D,
+    0x16, 0x00, 0x2F, 0x0C, 0x0D, 0x00, 0x17, 0x0B, 0x0C, 0x00,
+    0x18, 0x02, 0x00, 0x00, 0x26, 0x0B, 0x17, 0x00, 0x26, 0x0C,
+    0x18, 0x00, 0x2D, 0x0C, 0x06, 0x0A, 0x26, 0x0C, 0x18, 0x00,
+    0x2D, 0x09, 0x0B, 0x0C, 0x26, 0x0C, 0x06, 0x00, 0x30, 0x0C,
+    0x00, 0x00, 0x26, 0x03, 0x19, 0x00, 0x2B, 0x03, 0x00, 0x00,
+    0x26, 0x03, 0x01, 0x00, 0x30, 0x03, 0x00, 0x00, 0xCD, 0x02,
+    0xD0, 0x00, 0x00, 0x02, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01,
+    0xDA, 0x12, 0xDA, 0x82, 0x24, 0x27, 0x01, 0x00, 0x00, 0x2C,
+    0x01, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00, 0x30, 0x01, 0x00,
+    0x00, 0xBF, 0xFF, 0x04, 0x04, 0x98, 0x15, 0x34, 0x79, 0x01,
+    0x8C, 0x15, 0x02, 0x03, 0x0A, 0x08, 0x01, 0x01, 0x03, 0x01,
+    0x04, 0x1E, 0x03, 0x00, 0x19, 0x01, 0x03, 0x03, 0x03, 0x0C,
+    0x16, 0x01, 0x00, 0x0D, 0x03, 0x02, 0x08, 0x01, 0x00, 0x07,
+    0x05, 0x02, 0x04, 0x03, 0x0A, 0x1C, 0x01, 0x01, 0x03, 0x03,
+    0x02, 0x4E, 0x02, 0x00, 0x07, 0x03, 0x00, 0x0B, 0x07, 0x00,
+    0x23, 0x02, 0x01, 0x15, 0x03, 0x04, 0x04, 0x03, 0x03, 0x03,
+    0x03, 0x06, 0x10, 0x03, 0x00, 0x0B, 0x02, 0x05, 0x03, 0x05,
+    0x01, 0x0F, 0x01, 0x01, 0x03, 0x03, 0x0E, 0x10, 0x01, 0x00,
+    0x0F, 0x03, 0x02, 0x0E, 0x01, 0x00, 0x0D, 0x04, 0x04, 0x0E,
+    0x08, 0x02, 0x00, 0x09, 0x02, 0x04, 0x03, 0x01, 0x03, 0x08,
+    0x04, 0x08, 0x04, 0x00, 0x07, 0x01, 0x02, 0x00, 0x03, 0x00,
+    0x0C, 0x03, 0x00, 0x0B, 0x06, 0x09, 0x0D, 0x04, 0x12, 0x0B,
+    0xCF, 0x03, 0x62, 0x6F, 0x72, 0xD7, 0xCD, 0x00, 0x09, 0x00,
+    0x0E, 0x06, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
+    0x13, 0xCE, 0x03, 0x62, 0x6F, 0x72, 0x39, 0x01, 0x00, 0x00,
+    0x20, 0x02, 0x01, 0x00, 0x1A, 0x02, 0x03, 0x00, 0x25, 0x03,
+    0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x20, 0x02, 0x01, 0x01,
+    0x1A, 0x02, 0x05, 0x00, 0x25, 0x03, 0x00, 0x00, 0x37, 0x04,
+    0x00, 0x00, 0x0D, 0x03, 0x03, 0x04, 0x03, 0x03, 0x00, 0x00,
+    0x37, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x34, 0x04,
+    0x00, 0x05, 0x0D, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x01,
+    0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03, 0x03,
+    0x00, 0x00, 0xCF, 0x0F, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x72,
+    0x6E, 0x67, 0x2D, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0xD8,
+    0x0F, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x72, 0x6E, 0x67, 0x2D,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0xCF, 0x05, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0xDA, 0x82, 0x08, 0xCF, 0x07, 0x6E, 0x75,
+    0x6D, 0x62, 0x65, 0x72, 0x3F, 0xDA, 0x83, 0x23, 0xCF, 0x03,
+    0x2D, 0x3E, 0x3E, 0xD7, 0xCD, 0x02, 0xB9, 0x00, 0x00, 0x06,
+    0x01, 0x01, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x01, 0x06, 0x01,
+    0xCE, 0x03, 0x2D, 0x3E, 0x3E, 0xDA, 0x12, 0xDA, 0x39, 0x28,
+    0x02, 0x00, 0x00, 0x2A, 0x03, 0x00, 0x00, 0x17, 0x04, 0x03,
+    0x00, 0x2D, 0x04, 0x00, 0x01, 0x26, 0x05, 0x00, 0x00, 0x30,
+    0x05, 0x00, 0x00, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x0A, 0x02,
+    0x02, 0x02, 0x06, 0x27, 0xDA, 0x80, 0x9E, 0xDA, 0x12, 0xDA,
+    0x15, 0xDA, 0x50, 0xDA, 0x80, 0x9F, 0xDA, 0x57, 0xDA, 0x80,
+    0xA0, 0xDA, 0x80, 0xA1, 0x28, 0x02, 0x00, 0x00, 0x2B, 0x01,
+    0x00, 0x00, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x04, 0x05, 0x00,
+    0x26, 0x06, 0x01, 0x00, 0x1F, 0x05, 0x06, 0x04, 0x1A, 0x05,
+    0x0C, 0x00, 0x25, 0x06, 0x00, 0x00, 0x34, 0x04, 0x01, 0x06,
+    0x25, 0x06, 0x01, 0x00, 0x2C, 0x01, 0x06, 0x00, 0x26, 0x07,
+    0x02, 0x00, 0x2F, 0x06, 0x07, 0x00, 0x2C, 0x04, 0x06, 0x00,
+    0x26, 0x08, 0x03, 0x00, 0x2F, 0x07, 0x08, 0x00, 0x17, 0x03,
+    0x07, 0x00, 0x18, 0x06, 0x00, 0x00, 0x3A, 0x04, 0x00, 0x00,
+    0x2C, 0x01, 0x04, 0x00, 0x26, 0x07, 0x03, 0x00, 0x2F, 0x06,
+    0x07, 0x00, 0x17, 0x03, 0x06, 0x00, 0x37, 0x04, 0x03, 0x00,
+    0x17, 0x05, 0x04, 0x00, 0x37, 0x04, 0x03, 0x01, 0x17, 0x06,
+    0x04, 0x00, 0x2B, 0x05, 0x00, 0x00, 0x3A, 0x04, 0x00, 0x00,
+    0x2B, 0x00, 0x00, 0x00, 0x3A, 0x07, 0x00, 0x00, 0x2D, 0x04,
+    0x06, 0x07, 0x26, 0x09, 0x04, 0x00, 0x2F, 0x08, 0x09, 0x00,
+    0x17, 0x04, 0x08, 0x00, 0x25, 0x07, 0x00, 0x00, 0x2C, 0x04,
+    0x07, 0x00, 0x26, 0x07, 0x05, 0x00, 0x30, 0x07, 0x00, 0x00,
+    0x2B, 0x01, 0xA8, 0x0D, 0x06, 0x03, 0x02, 0x36, 0x02, 0x00,
+    0x13, 0x01, 0x00, 0x07, 0x02, 0x02, 0x12, 0x04, 0x00, 0x12,
+    0x03, 0x00, 0x1F, 0x02, 0x01, 0x03, 0x04, 0x04, 0x04, 0x01,
+    0x03, 0x03, 0x04, 0x00, 0x15, 0x07, 0x06, 0x16, 0x01, 0x00,
+    0x15, 0x04, 0x02, 0x00, 0x0A, 0x01, 0x9E, 0x0D, 0x02, 0x02,
+    0x0A, 0x04, 0x03, 0x0C, 0x00, 0xCF, 0x0C, 0x6D, 0x6F, 0x64,
+    0x75, 0x6C, 0x65, 0x2F, 0x63, 0x61, 0x63, 0x68, 0x65, 0xDA,
+    0x83, 0x70, 0xCF, 0x0C, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x2F, 0x63, 0x6C, 0x6F, 0x6E, 0x65, 0xD8, 0x0C, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x72, 0x2F, 0x63, 0x6C, 0x6F, 0x6E, 0x65,
+    0xCF, 0x07, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x3F, 0xDA,
+    0x81, 0xED, 0xCF, 0x07, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3E,
+    0x3D, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x16, 0x06, 0x00, 0x00,
+    0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 0xCE, 0x07, 0x6F,
+    0x72, 0x64, 0x65, 0x72, 0x3E, 0x3D, 0x39, 0x01, 0x00, 0x00,
+    0x1E, 0x02, 0x01, 0x02, 0x19, 0x02, 0x0A, 0x00, 0x37, 0x03,
+    0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x34, 0x04, 0x00, 0x05,
+    0x1D, 0x02, 0x03, 0x04, 0x1A, 0x02, 0x07, 0x00, 0x05, 0x05,
+    0x05, 0x01, 0x17, 0x03, 0x04, 0x00, 0x1F, 0x02, 0x05, 0x01,
+    0x1A, 0x02, 0xFA, 0xFF, 0x24, 0x03, 0x00, 0x00, 0x03, 0x03,
+    0x00, 0x00, 0x23, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+    0xCF, 0x11, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x77, 0x65,
+    0x61, 0x6B, 0x2D, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0xD8,
+    0x11, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x77, 0x65, 0x61,
+    0x6B, 0x2D, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0xCF, 0x04,
+    0x77, 0x69, 0x74, 0x68, 0xD7, 0xCD, 0x02, 0x99, 0x00, 0x00,
+    0x0D, 0x01, 0x01, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x0C, 0x36,
+    0xCE, 0x04, 0x77, 0x69, 0x74, 0x68, 0xDA, 0x12, 0xDA, 0x55,
+    0xDA, 0x80, 0x87, 0xDA, 0x80, 0xB5, 0xD0, 0x02, 0x69, 0x65,
+    0xDA, 0x82, 0x78, 0xD0, 0x05, 0x63, 0x6C, 0x6F, 0x73, 0x65,
+    0xDA, 0x81, 0xDE, 0xDA, 0x81, 0xC2, 0xDA, 0x81, 0x76, 0xDA,
+    0x82, 0xF1, 0xDA, 0x58, 0xDA, 0x81, 0xA0, 0x37, 0x02, 0x00,
+    0x00, 0x17, 0x03, 0x02, 0x00, 0x37, 0x02, 0x00, 0x01, 0x17,
+    0x04, 0x02, 0x00, 0x37, 0x02, 0x00, 0x02, 0x17, 0x05, 0x02,
+    0x00, 0x28, 0x00, 0x00, 0x00, 0x26, 0x06, 0x00, 0x00, 0x2F,
+    0x02, 0x06, 0x00, 0x17, 0x06, 0x02, 0x00, 0x26, 0x07, 0x00,
+    0x00, 0x2F, 0x02, 0x07, 0x00, 0x17, 0x07, 0x02, 0x00, 0x40,
+    0x02, 0x00, 0x00, 0x26, 0x09, 0x01, 0x00, 0x2C, 0x09, 0x02,
+    0x00, 0x2E, 0x01, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x26,
+    0x09, 0x02, 0x00, 0x26, 0x0A, 0x03, 0x00, 0x2D, 0x09, 0x08,
+    0x0A, 0x3F, 0x02, 0x00, 0x00, 0x26, 0x09, 0x04, 0x00, 0x2C,
+    0x09, 0x07, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x2D, 0x03, 0x04,
+    0x07, 0x2D, 0x02, 0x06, 0x08, 0x40, 0x09, 0x00, 0x00, 0x1A,
+    0x05, 0x03, 0x00, 0x17, 0x02, 0x05, 0x00, 0x18, 0x03, 0x00,
+    0x00, 0x26, 0x08, 0x05, 0x00, 0x17, 0x02, 0x08, 0x00, 0x2C,
+    0x02, 0x03, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x26, 0x0A, 0x06,
+    0x00, 0x2C, 0x0A, 0x07, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x26,
+    0x0B, 0x07, 0x00, 0x26, 0x0C, 0x08, 0x00, 0x2D, 0x0B, 0x02,
+    0x0C, 0x3F, 0x0A, 0x00, 0x00, 0x26, 0x0B, 0x09, 0x00, 0x2D,
+    0x0B, 0x06, 0x07, 0x3F, 0x02, 0x00, 0x00, 0x26, 0x0C, 0x0A,
+    0x00, 0x2D, 0x0C, 0x0A, 0x02, 0x2B, 0x06, 0x00, 0x00, 0x3F,
+    0x0B, 0x00, 0x00, 0x26, 0x0A, 0x0B, 0x00, 0x2D, 0x0A, 0x09,
+    0x08, 0x2B, 0x0B, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x03,
+    0x02, 0x00, 0x00, 0x0A, 0x07, 0xB2, 0x04, 0x02, 0x06, 0x0C,
+    0x04, 0x29, 0x02, 0x04, 0xCF, 0x05, 0x61, 0x73, 0x3F, 0x2D,
+    0x3E, 0xD7, 0xCD, 0x02, 0xBB, 0x00, 0x00, 0x08, 0x02, 0x02,
+    0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x03, 0x08, 0x02, 0xCE, 0x05,
+    0x61, 0x73, 0x3F, 0x2D, 0x3E, 0xDA, 0x12, 0xDA, 0x55, 0xD7,
+    0xCD, 0x02, 0xBA, 0x00, 0x00, 0x06, 0x02, 0x02, 0x02, 0x01,
+    0x07, 0x01, 0xCE, 0x08, 0x70, 0x6F, 0x73, 0x74, 0x77, 0x61,
+    0x6C, 0x6B, 0xDA, 0x12, 0xDA, 0x81, 0x1D, 0x28, 0x02, 0x00,
+    0x00, 0x2A, 0x03, 0x00, 0x00, 0x2C, 0x03, 0x01, 0x00, 0x26,
+    0x05, 0x00, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x2B, 0x04, 0x00,
+    0x00, 0x30, 0x00, 0x00, 0x00, 0xCD, 0x02, 0xD0, 0x00, 0x00,
+    0x02, 0x01, 0x01, 0x01, 0x00, 0x04, 0x01, 0xDA, 0x12, 0x27,
+    0x01, 0x00, 0x00, 0x2C, 0x01, 0x00, 0x00, 0x27, 0x01, 0x00,
+    0x02, 0x30, 0x01, 0x00, 0x00, 0xBF, 0xFF, 0x04, 0x04, 0xB8,
+    0x0E, 0x28, 0x0D, 0x01, 0xB0, 0x0E, 0x02, 0x01, 0x08, 0x16,
+    0x03, 0x00, 0x0B, 0x02, 0x00, 0x05, 0xDA, 0x41, 0x28, 0x03,
+    0x00, 0x00, 0x17, 0x04, 0x00, 0x00, 0x25, 0x05, 0x00, 0x00,
+    0x39, 0x06, 0x02, 0x00, 0x17, 0x07, 0x06, 0x00, 0x2A, 0x06,
+    0x01, 0x00, 0x2F, 0x06, 0x06, 0x00, 0x03, 0x04, 0x00, 0x00,
+    0xCD, 0x02, 0xD0, 0x00, 0x00, 0x03, 0x01, 0x01, 0x01, 0x00,
+    0x06, 0x01, 0xDA, 0x12, 0x27, 0x02, 0x00, 0x01, 0x1F, 0x01,
+    0x00, 0x02, 0x1A, 0x01, 0x03, 0x00, 0x27, 0x02, 0x00, 0x0A,
+    0x03, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0x07, 0x02, 0xF0, 0x0E, 0x54, 0x04, 0x00, 0x07, 0xCD, 0x02,
+    0xFA, 0x00, 0x00, 0x08, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x03, 0x1E, 0x01, 0x01, 0xCE, 0x06, 0x5F, 0x77, 0x68,
+    0x69, 0x6C, 0x65, 0xDA, 0x12, 0xDA, 0x55, 0xDA, 0x85, 0x90,
+    0xDA, 0x41, 0x27, 0x01, 0x00, 0x05, 0x27, 0x02, 0x00, 0x07,
+    0x41, 0x00, 0x01, 0x02, 0x19, 0x00, 0x02, 0x00, 0x04, 0x00,
+    0x00, 0x00, 0x27, 0x02, 0x00, 0x02, 0x27, 0x03, 0x00, 0x05,
+    0x34, 0x01, 0x02, 0x03, 0x17, 0x02, 0x01, 0x00, 0x26, 0x03,
+    0x00, 0x00, 0x2F, 0x01, 0x03, 0x00, 0x17, 0x03, 0x01, 0x00,
+    0x2A, 0x01, 0x00, 0x00, 0x2C, 0x01, 0x02, 0x00, 0x26, 0x05,
+    0x01, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x17, 0x01, 0x04, 0x00,
+    0x27, 0x05, 0x00, 0x04, 0x2C, 0x03, 0x05, 0x00, 0x40, 0x04,
+    0x00, 0x00, 0x26, 0x06, 0x02, 0x00, 0x2D, 0x06, 0x04, 0x01,
+    0x3F, 0x05, 0x00, 0x00, 0x29, 0x05, 0x00, 0x04, 0x27, 0x06,
+    0x00, 0x05, 0x25, 0x07, 0x01, 0x00, 0x06, 0x04, 0x06, 0x07,
+    0x29, 0x04, 0x00, 0x05, 0x28, 0x06, 0x00, 0x00, 0x30, 0x06,
+    0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x02, 0xD0, 0x00, 0x00, 0x03,
+    0x01, 0x01, 0x01, 0x00, 0x06, 0x02, 0xDA, 0x12, 0x27, 0x02,
+    0x00, 0x01, 0x1F, 0x01, 0x00, 0x02, 0x1A, 0x01, 0x03, 0x00,
+    0x27, 0x02, 0x01, 0x03, 0x03, 0x02, 0x00, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x07, 0x02, 0xF0, 0x0E, 0x54,
+    0x04, 0x00, 0x07, 0x19, 0x09, 0xEC, 0x0E, 0x06, 0x02, 0x02,
+    0x16, 0x01, 0x00, 0x11, 0x01, 0x02, 0x32, 0x03, 0x00, 0x13,
+    0x01, 0x00, 0x1D, 0x07, 0x02, 0x14, 0x06, 0x05, 0x17, 0x0D,
+    0x01, 0xDE, 0x0E, 0x02, 0x01, 0x0C, 0x04, 0x05, 0x02, 0x00,
+    0x01, 0x0D, 0x03, 0xCF, 0x0C, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x2F, 0x72, 0x61, 0x77, 0x67, 0x65, 0x74, 0xD8, 0x0C, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x2F, 0x72, 0x61, 0x77, 0x67, 0x65,
+    0x74, 0xCF, 0x0A, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x63, 0x6C,
+    0x6F, 0x73, 0x65, 0xDA, 0x83, 0x7C, 0xCF, 0x08, 0x6F, 0x73,
+    0x2F, 0x6D, 0x6B, 0x64, 0x69, 0x72, 0xD8, 0x08, 0x6F, 0x73,
+    0x2F, 0x6D, 0x6B, 0x64, 0x69, 0x72, 0xCF, 0x08, 0x69, 0x64,
+    0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0xDA, 0x81, 0xF1, 0xCF,
+    0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x73, 0x69, 0x6E, 0x68,
+    0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x73, 0x69, 0x6E,
+    0x68, 0xCF, 0x03, 0x2D, 0x3F, 0x3E, 0xD7, 0xCD, 0x02, 0xB9,
+    0x00, 0x00, 0x06, 0x01, 0x01, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF,
+    0x01, 0x06, 0x01, 0xCE, 0x03, 0x2D, 0x3F, 0x3E, 0xDA, 0x12,
+    0xDA, 0x39, 0x28, 0x02, 0x00, 0x00, 0x2A, 0x03, 0x00, 0x00,
+    0x17, 0x04, 0x03, 0x00, 0x2D, 0x04, 0x00, 0x01, 0x26, 0x05,
+    0x00, 0x00, 0x30, 0x05, 0x00, 0x00, 0xCD, 0x02, 0x98, 0x00,
+    0x00, 0x0E, 0x02, 0x02, 0x02, 0x09, 0x31, 0xDA, 0x80, 0x9E,
+    0xDA, 0x12, 0xDA, 0x15, 0xDA, 0x50, 0xDA, 0x80, 0x9F, 0xDA,
+    0x57, 0xDA, 0x55, 0xDA, 0x80, 0xA0, 0xDA, 0x80, 0xA1, 0xDA,
+    0x58, 0xDA, 0x81, 0xA0, 0x28, 0x02, 0x00, 0x00, 0x2B, 0x01,
+    0x00, 0x00, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x04, 0x05, 0x00,
+    0x26, 0x06, 0x01, 0x00, 0x1F, 0x05, 0x06, 0x04, 0x1A, 0x05,
+    0x0C, 0x00, 0x25, 0x06, 0x00, 0x00, 0x34, 0x04, 0x01, 0x06,
+    0x25, 0x06, 0x01, 0x00, 0x2C, 0x01, 0x06, 0x00, 0x26, 0x07,
+    0x02, 0x00, 0x2F, 0x06, 0x07, 0x00, 0x2C, 0x04, 0x06, 0x00,
+    0x26, 0x08, 0x03, 0x00, 0x2F, 0x07, 0x08, 0x00, 0x17, 0x03,
+    0x07, 0x00, 0x18, 0x06, 0x00, 0x00, 0x3A, 0x04, 0x00, 0x00,
+    0x2C, 0x01, 0x04, 0x00, 0x26, 0x07, 0x03, 0x00, 0x2F, 0x06,
+    0x07, 0x00, 0x17, 0x03, 0x06, 0x00, 0x37, 0x04, 0x03, 0x00,
+    0x17, 0x05, 0x04, 0x00, 0x37, 0x04, 0x03, 0x01, 0x17, 0x06,
+    0x04, 0x00, 0x26, 0x07, 0x04, 0x00, 0x2F, 0x04, 0x07, 0x00,
+    0x17, 0x07, 0x04, 0x00, 0x2C, 0x05, 0x07, 0x00, 0x3A, 0x08,
+    0x00, 0x00, 0x2C, 0x08, 0x06, 0x00, 0x26, 0x0A, 0x05, 0x00,
+    0x2F, 0x09, 0x0A, 0x00, 0x17, 0x08, 0x09, 0x00, 0x2C, 0x07,
+    0x00, 0x00, 0x40, 0x0A, 0x00, 0x00, 0x25, 0x0B, 0x00, 0x00,
+    0x2C, 0x08, 0x0B, 0x00, 0x26, 0x0C, 0x06, 0x00, 0x2F, 0x0B,
+    0x0C, 0x00, 0x26, 0x0D, 0x07, 0x00, 0x2D, 0x0D, 0x07, 0x0B,
+    0x3F, 0x0C, 0x00, 0x00, 0x26, 0x0D, 0x08, 0x00, 0x2D, 0x0D,
+    0x0A, 0x0C, 0x3F, 0x0B, 0x00, 0x00, 0x03, 0x0B, 0x00, 0x00,
+    0x31, 0x01, 0xC6, 0x0D, 0x06, 0x03, 0x02, 0x36, 0x02, 0x00,
+    0x13, 0x01, 0x00, 0x07, 0x02, 0x02, 0x12, 0x04, 0x00, 0x12,
+    0x03, 0x00, 0x1F, 0x02, 0x01, 0x03, 0x04, 0x04, 0x04, 0x01,
+    0x03, 0x03, 0x04, 0x00, 0x15, 0x02, 0x06, 0x12, 0x01, 0x00,
+    0x11, 0x05, 0x02, 0x16, 0x01, 0x00, 0x15, 0x0D, 0x02, 0x00,
+    0x0A, 0x01, 0xB8, 0x0D, 0x02, 0x02, 0x0E, 0x04, 0x03, 0x0E,
+    0x00, 0xCF, 0x0A, 0x6D, 0x61, 0x6B, 0x65, 0x2D, 0x69, 0x6D,
+    0x61, 0x67, 0x65, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x07,
+    0x01, 0x01, 0x01, 0x08, 0x13, 0xCE, 0x0A, 0x6D, 0x61, 0x6B,
+    0x65, 0x2D, 0x69, 0x6D, 0x61, 0x67, 0x65, 0xDA, 0x12, 0xDA,
+    0x84, 0x9F, 0xDA, 0x81, 0x56, 0xDA, 0x80, 0xF0, 0xDA, 0x84,
+    0xA3, 0xDA, 0x82, 0xC6, 0xDA, 0x80, 0xFA, 0xD3, 0x81, 0xBE,
+    0xDA, 0x5E, 0xDA, 0x5C, 0x01, 0xDA, 0x85, 0x1A, 0xC8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0xCF, 0x08, 0x6D,
+    0x61, 0x74, 0x68, 0x2F, 0x69, 0x6E, 0x66, 0xDA, 0x82, 0x09,
+    0xDA, 0x84, 0x09, 0xDA, 0x80, 0xD6, 0xDA, 0x80, 0xD4, 0xDA,
+    0x85, 0x90, 0xCF, 0x08, 0x70, 0x6F, 0x73, 0x74, 0x77, 0x61,
+    0x6C, 0x6B, 0xD8, 0x10, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x2F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x2D, 0x73, 0x65, 0x74,
+    0xCF, 0x10, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x63,
+    0x68, 0x65, 0x63, 0x6B, 0x2D, 0x73, 0x65, 0x74, 0xDA, 0x82,
+    0x84, 0xDA, 0x82, 0x82, 0xDA, 0x6F, 0xDA, 0x69, 0xD7, 0xCD,
+    0x02, 0x98, 0x00, 0x00, 0x0C, 0x02, 0x02, 0x02, 0x01, 0x16,
+    0xCE, 0x04, 0x6B, 0x65, 0x65, 0x70, 0xDA, 0x12, 0xDA, 0x81,
+    0x1B, 0x28, 0x02, 0x00, 0x00, 0x3A, 0x03, 0x00, 0x00, 0x17,
+    0x04, 0x03, 0x00, 0x25, 0x05, 0x00, 0x00, 0x39, 0x06, 0x01,
+    0x00, 0x17, 0x07, 0x06, 0x00, 0x41, 0x06, 0x05, 0x07, 0x1A,
+    0x06, 0x0E, 0x00, 0x34, 0x08, 0x01, 0x05, 0x17, 0x09, 0x08,
+    0x00, 0x2B, 0x09, 0x00, 0x00, 0x2F, 0x08, 0x00, 0x00, 0x17,
+    0x0A, 0x08, 0x00, 0x1A, 0x0A, 0x05, 0x00, 0x2C, 0x04, 0x0A,
+    0x00, 0x26, 0x0B, 0x00, 0x00, 0x2F, 0x08, 0x0B, 0x00, 0x18,
+    0x01, 0x00, 0x00, 0x25, 0x08, 0x01, 0x00, 0x06, 0x05, 0x05,
+    0x08, 0x18, 0xF2, 0xFF, 0xFF, 0x03, 0x04, 0x00, 0x00, 0x1C,
+    0x01, 0x8E, 0x0B, 0x02, 0x02, 0x08, 0x04, 0x07, 0x02, 0x00,
+    0x02, 0x02, 0x1A, 0x02, 0x00, 0x15, 0x03, 0x02, 0x04, 0x01,
+    0x01, 0x03, 0x03, 0x01, 0x03, 0x01, 0x09, 0x03, 0xCF, 0x04,
+    0x6B, 0x65, 0x65, 0x70, 0xDA, 0x85, 0x19, 0xDA, 0x85, 0x17,
+    0xDA, 0x46, 0xCF, 0x05, 0x7A, 0x65, 0x72, 0x6F, 0x3F, 0xD8,
+    0x07, 0x6F, 0x73, 0x2F, 0x6C, 0x69, 0x6E, 0x6B, 0xCF, 0x07,
+    0x6F, 0x73, 0x2F, 0x6C, 0x69, 0x6E, 0x6B, 0xDA, 0x82, 0xA3,
+    0xDA, 0x83, 0xC1, 0xDA, 0x82, 0x78, 0xCF, 0x06, 0x72, 0x65,
+    0x73, 0x75, 0x6D, 0x65, 0xDA, 0x4C, 0xCF, 0x0B, 0x69, 0x64,
+    0x65, 0x6D, 0x70, 0x6F, 0x74, 0x65, 0x6E, 0x74, 0x3F, 0xD8,
+    0x0C, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x69, 0x6E, 0x73,
+    0x65, 0x72, 0x74, 0xCF, 0x0C, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2F, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0xD7, 0xCD, 0x02,
+    0x98, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01, 0x02, 0x07, 0xCE,
+    0x07, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x3F, 0xDA, 0x12,
+    0xDA, 0x15, 0xDA, 0x19, 0x28, 0x01, 0x00, 0x00, 0x2B, 0x00,
+    0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03, 0x00,
+    0x26, 0x04, 0x01, 0x00, 0x1F, 0x03, 0x02, 0x04, 0x03, 0x03,
+    0x00, 0x00, 0x0A, 0x01, 0xB0, 0x01, 0x02, 0x03, 0x00, 0x5E,
+    0x03, 0x00, 0x05, 0xCF, 0x07, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x3F, 0xDA, 0x83, 0xDF, 0xDA, 0x83, 0xD9, 0xDA, 0x84,
+    0x65, 0xDA, 0x84, 0x62, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00,
+    0x05, 0x01, 0x01, 0x01, 0x00, 0x05, 0xCE, 0x06, 0x65, 0x6D,
+    0x70, 0x74, 0x79, 0x3F, 0xDA, 0x12, 0x28, 0x01, 0x00, 0x00,
+    0x39, 0x02, 0x00, 0x00, 0x25, 0x04, 0x00, 0x00, 0x1F, 0x03,
+    0x04, 0x02, 0x03, 0x03, 0x00, 0x00, 0x0A, 0x01, 0xDC, 0x01,
+    0x02, 0x01, 0x00, 0x5E, 0x03, 0x00, 0x09, 0xCF, 0x06, 0x65,
+    0x6D, 0x70, 0x74, 0x79, 0x3F, 0xDA, 0x04, 0xDA, 0x01, 0xDA,
+    0x85, 0x9D, 0xDA, 0x85, 0x9B, 0xDA, 0x81, 0xDE, 0xDA, 0x81,
+    0xDC, 0xDA, 0x84, 0xD4, 0xDA, 0x84, 0xD3, 0xDA, 0x83, 0x8B,
+    0xDA, 0x83, 0x89, 0xDA, 0x85, 0x4D, 0xDA, 0x85, 0x41, 0xDA,
+    0x85, 0x74, 0xDA, 0x85, 0x5E, 0xD7, 0xCD, 0x02, 0x98, 0x00,
+    0x00, 0x08, 0x01, 0x01, 0x01, 0x00, 0x13, 0xCE, 0x06, 0x65,
+    0x76, 0x65, 0x72, 0x79, 0x3F, 0xDA, 0x12, 0x28, 0x01, 0x00,
+    0x00, 0x23, 0x02, 0x00, 0x00, 0x25, 0x03, 0x00, 0x00, 0x39,
+    0x04, 0x00, 0x00, 0x17, 0x05, 0x04, 0x00, 0x41, 0x04, 0x03,
+    0x05, 0x1A, 0x04, 0x0C, 0x00, 0x34, 0x06, 0x00, 0x03, 0x17,
+    0x07, 0x06, 0x00, 0x1A, 0x02, 0x02, 0x00, 0x18, 0x02, 0x00,
+    0x00, 0x18, 0x07, 0x00, 0x00, 0x1A, 0x07, 0x02, 0x00, 0x18,
+    0x02, 0x00, 0x00, 0x17, 0x02, 0x07, 0x00, 0x25, 0x06, 0x01,
+    0x00, 0x06, 0x03, 0x03, 0x06, 0x18, 0xF4, 0xFF, 0xFF, 0x03,
+    0x02, 0x00, 0x00, 0x16, 0x01, 0xC0, 0x0F, 0x02, 0x01, 0x08,
+    0x04, 0x0A, 0x02, 0x00, 0x02, 0x02, 0x04, 0x01, 0x00, 0x14,
+    0x03, 0x01, 0x17, 0x01, 0x09, 0x03, 0xCF, 0x06, 0x65, 0x76,
+    0x65, 0x72, 0x79, 0x3F, 0xD8, 0x06, 0x6F, 0x73, 0x2F, 0x63,
+    0x77, 0x64, 0xCF, 0x06, 0x6F, 0x73, 0x2F, 0x63, 0x77, 0x64,
+    0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01,
+    0x01, 0x07, 0xCE, 0x04, 0x6D, 0x65, 0x61, 0x6E, 0xDA, 0x12,
+    0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x08, 0x01, 0x01, 0x01,
+    0x00, 0x0E, 0xCE, 0x03, 0x73, 0x75, 0x6D, 0xDA, 0x12, 0x28,
+    0x01, 0x00, 0x00, 0x25, 0x02, 0x00, 0x00, 0x25, 0x03, 0x00,
+    0x00, 0x39, 0x04, 0x00, 0x00, 0x17, 0x05, 0x04, 0x00, 0x41,
+    0x04, 0x03, 0x05, 0x1A, 0x04, 0x07, 0x00, 0x34, 0x06, 0x00,
+    0x03, 0x17, 0x07, 0x06, 0x00, 0x06, 0x02, 0x02, 0x07, 0x25,
+    0x06, 0x01, 0x00, 0x06, 0x03, 0x03, 0x06, 0x18, 0xF9, 0xFF,
+    0xFF, 0x03, 0x02, 0x00, 0x00, 0x13, 0x01, 0xDC, 0x07, 0x02,
+    0x01, 0x06, 0x04, 0x07, 0x02, 0x00, 0x01, 0x00, 0x16, 0x03,
+    0x00, 0x15, 0x01, 0x07, 0x03, 0x28, 0x01, 0x00, 0x00, 0x2B,
+    0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03,
+    0x00, 0x39, 0x03, 0x00, 0x00, 0x0B, 0x04, 0x02, 0x03, 0x03,
+    0x04, 0x00, 0x00, 0x0D, 0x01, 0xEA, 0x07, 0x02, 0x03, 0x06,
+    0x0A, 0x01, 0x00, 0x12, 0x02, 0x00, 0x17, 0xCF, 0x04, 0x6D,
+    0x65, 0x61, 0x6E, 0xDA, 0x83, 0x1D, 0xCF, 0x0A, 0x63, 0x6F,
+    0x72, 0x65, 0x2D, 0x72, 0x61, 0x6E, 0x67, 0x65, 0xDA, 0x81,
+    0x1A, 0xCF, 0x09, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x6E,
+    0x65, 0x77, 0xDA, 0x82, 0xD3, 0xDA, 0x82, 0xD1, 0xDA, 0x84,
+    0x6C, 0xDA, 0x84, 0x6A, 0xD8, 0x03, 0x61, 0x73, 0x6D, 0xCF,
+    0x03, 0x61, 0x73, 0x6D, 0xDA, 0x83, 0xB5, 0xDA, 0x83, 0xB3,
+    0xDA, 0x85, 0x23, 0xDA, 0x85, 0x22, 0xD7, 0xCD, 0x02, 0xBA,
+    0x00, 0x00, 0x23, 0x01, 0x01, 0x01, 0x38, 0x80, 0xFC, 0x14,
+    0xCE, 0x08, 0x63, 0x6C, 0x69, 0x2D, 0x6D, 0x61, 0x69, 0x6E,
+    0xDA, 0x12, 0xD0, 0x04, 0x61, 0x72, 0x67, 0x73, 0xDA, 0x83,
+    0x29, 0xDA, 0x85, 0x11, 0xDA, 0x85, 0x58, 0xDA, 0x81, 0x41,
+    0xDA, 0x85, 0x12, 0xD0, 0x0A, 0x68, 0x65, 0x61, 0x64, 0x65,
+    0x72, 0x70, 0x61, 0x74, 0x68, 0xCE, 0x01, 0x63, 0xCE, 0x01,
+    0x65, 0xCE, 0x01, 0x68, 0xCE, 0x01, 0x6B, 0xCE, 0x01, 0x6C,
+    0xCE, 0x01, 0x6D, 0xDA, 0x6D, 0xCE, 0x01, 0x6E, 0xCE, 0x01,
+    0x70, 0xCE, 0x01, 0x71, 0xCE, 0x01, 0x72, 0xCE, 0x01, 0x73,
+    0xCE, 0x01, 0x76, 0xDA, 0x82, 0x2D, 0xDA, 0x81, 0x51, 0xCF,
+    0x09, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2D,
+    0xDA, 0x84, 0xF0, 0xCF, 0x06, 0x64, 0x6F, 0x66, 0x69, 0x6C,
+    0x65, 0xCF, 0x07, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x2A,
+    0xCF, 0x06, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0xDA, 0x84,
+    0x96, 0xCF, 0x03, 0x75, 0x73, 0x65, 0xDA, 0x81, 0xCD, 0xDA,
+    0x83, 0x73, 0xDA, 0x80, 0x9F, 0xD0, 0x06, 0x70, 0x72, 0x65,
+    0x66, 0x69, 0x78, 0xDA, 0x80, 0xF8, 0xDA, 0x82, 0xB5, 0xDA,
+    0x82, 0xA1, 0xDA, 0x82, 0xA0, 0xDA, 0x83, 0x81, 0xCF, 0x04,
+    0x6D, 0x61, 0x69, 0x6E, 0xDA, 0x03, 0xDA, 0x80, 0xA1, 0xDA,
+    0x62, 0xDA, 0x83, 0x5A, 0xDA, 0x81, 0x76, 0xDA, 0x4B, 0xCE,
+    0x06, 0x4A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0xDA, 0x84, 0xA3,
+    0xDA, 0x82, 0xCC, 0xCE, 0x25, 0x20, 0x20, 0x43, 0x6F, 0x70,
+    0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x28, 0x43, 0x29,
+    0x20, 0x32, 0x30, 0x31, 0x37, 0x2D, 0x32, 0x30, 0x31, 0x39,
+    0x20, 0x43, 0x61, 0x6C, 0x76, 0x69, 0x6E, 0x20, 0x52, 0x6F,
+    0x73, 0x65, 0xDA, 0x82, 0x38, 0xDA, 0x82, 0xBA, 0xCE, 0x05,
+    0x25, 0x2E, 0x32, 0x30, 0x51, 0xCE, 0x05, 0x25, 0x2E, 0x32,
+    0x30, 0x71, 0xDA, 0x82, 0x5F, 0xDA, 0x82, 0xA5, 0xD7, 0xCD,
+    0x02, 0xBA, 0x00, 0x00, 0x0D, 0x03, 0x00, 0x03, 0x07, 0x2C,
+    0x02, 0xCE, 0x04, 0x72, 0x65, 0x70, 0x6C, 0xDA, 0x12, 0xDA,
+    0x83, 0x73, 0xDA, 0x82, 0x99, 0xDA, 0x82, 0x9A, 0xDA, 0x82,
+    0x9B, 0xDA, 0x85, 0xDE, 0xDA, 0x82, 0xA0, 0xDA, 0x82, 0xC4,
+    0x28, 0x03, 0x00, 0x00, 0x22, 0x06, 0x00, 0x00, 0x1F, 0x05,
+    0x06, 0x02, 0x1A, 0x05, 0x05, 0x00, 0x26, 0x07, 0x00, 0x00,
+    0x2F, 0x06, 0x07, 0x00, 0x17, 0x04, 0x06, 0x00, 0x18, 0x02,
+    0x00, 0x00, 0x17, 0x04, 0x02, 0x00, 0x17, 0x05, 0x04, 0x00,
+    0x22, 0x08, 0x00, 0x00, 0x1F, 0x07, 0x08, 0x00, 0x1A, 0x07,
+    0x04, 0x00, 0x2A, 0x08, 0x00, 0x00, 0x17, 0x06, 0x08, 0x00,
+    0x18, 0x02, 0x00, 0x00, 0x17, 0x06, 0x00, 0x00, 0x17, 0x07,
+    0x06, 0x00, 0x2A, 0x08, 0x01, 0x00, 0x17, 0x09, 0x08, 0x00,
+    0x1A, 0x01, 0x03, 0x00, 0x17, 0x0A, 0x01, 0x00, 0x18, 0x0A,
+    0x00, 0x00, 0x25, 0x0B, 0x01, 0x00, 0x2C, 0x05, 0x0B, 0x00,
+    0x2F, 0x0B, 0x09, 0x00, 0x17, 0x0C, 0x0B, 0x00, 0x1A, 0x0C,
+    0x03, 0x00, 0x17, 0x0B, 0x0C, 0x00, 0x18, 0x02, 0x00, 0x00,
+    0x22, 0x0B, 0x00, 0x00, 0x17, 0x0A, 0x0B, 0x00, 0x26, 0x0B,
+    0x01, 0x00, 0x26, 0x0C, 0x02, 0x00, 0x2D, 0x0B, 0x07, 0x0C,
+    0x26, 0x0B, 0x03, 0x00, 0x26, 0x0C, 0x04, 0x00, 0x2D, 0x0A,
+    0x0B, 0x0C, 0x26, 0x0B, 0x05, 0x00, 0x2C, 0x0B, 0x05, 0x00,
+    0x3D, 0x0A, 0x00, 0x00, 0x2B, 0x0A, 0x00, 0x00, 0x26, 0x0B,
+    0x06, 0x00, 0x30, 0x0B, 0x00, 0x00, 0xCD, 0x02, 0x90, 0x00,
+    0x00, 0x06, 0x02, 0x02, 0x02, 0x08, 0x14, 0xDA, 0x12, 0xDA,
+    0x82, 0x4E, 0xD0, 0x0A, 0x64, 0x65, 0x6C, 0x69, 0x6D, 0x69,
+    0x74, 0x65, 0x72, 0x73, 0xD8, 0x0C, 0x70, 0x61, 0x72, 0x73,
+    0x65, 0x72, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x65, 0xCE, 0x05,
+    0x72, 0x65, 0x70, 0x6C, 0x3A, 0xCE, 0x01, 0x3A, 0xCE, 0x02,
+    0x3E, 0x20, 0xDA, 0x81, 0x5A, 0xDA, 0x82, 0xBA, 0x2B, 0x01,
+    0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03, 0x00,
+    0x25, 0x03, 0x00, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x2F, 0x03,
+    0x02, 0x00, 0x26, 0x02, 0x01, 0x00, 0x2C, 0x01, 0x02, 0x00,
+    0x26, 0x04, 0x02, 0x00, 0x2F, 0x02, 0x04, 0x00, 0x26, 0x04,
+    0x03, 0x00, 0x26, 0x05, 0x04, 0x00, 0x2D, 0x04, 0x03, 0x05,
+    0x26, 0x04, 0x05, 0x00, 0x2C, 0x02, 0x04, 0x00, 0x26, 0x05,
+    0x06, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x2C, 0x04, 0x00, 0x00,
+    0x26, 0x02, 0x07, 0x00, 0x30, 0x02, 0x00, 0x00, 0x10, 0x03,
+    0x82, 0x21, 0x62, 0x03, 0x00, 0x01, 0x04, 0x04, 0x00, 0x07,
+    0x05, 0x0F, 0x03, 0x00, 0x11, 0xCD, 0x02, 0xFA, 0x00, 0x00,
+    0x06, 0x02, 0x02, 0x02, 0x00, 0x05, 0x01, 0x02, 0xCE, 0x0D,
+    0x6D, 0x61, 0x6B, 0x65, 0x2D, 0x6F, 0x6E, 0x73, 0x69, 0x67,
+    0x6E, 0x61, 0x6C, 0xDA, 0x12, 0x28, 0x02, 0x00, 0x00, 0x2A,
+    0x03, 0x00, 0x00, 0x17, 0x04, 0x03, 0x00, 0x2A, 0x05, 0x01,
+    0x00, 0x03, 0x05, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x02, 0xF8,
+    0x00, 0x00, 0x0D, 0x02, 0x02, 0x02, 0x0B, 0x2A, 0x02, 0x01,
+    0xCE, 0x0E, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x2D, 0x64, 0x65,
+    0x62, 0x75, 0x67, 0x67, 0x65, 0x72, 0xDA, 0x12, 0xDA, 0x83,
+    0x73, 0xDA, 0x82, 0xC2, 0xD0, 0x0B, 0x64, 0x65, 0x62, 0x75,
+    0x67, 0x2D, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0xD0, 0x06, 0x73,
+    0x69, 0x67, 0x6E, 0x61, 0x6C, 0xDA, 0x82, 0xA3, 0xCE, 0x0F,
+    0x65, 0x6E, 0x74, 0x65, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x64,
+    0x65, 0x62, 0x75, 0x67, 0x5B, 0xCE, 0x12, 0x5D, 0x20, 0x2D,
+    0x20, 0x28, 0x71, 0x75, 0x69, 0x74, 0x29, 0x20, 0x74, 0x6F,
+    0x20, 0x65, 0x78, 0x69, 0x74, 0xDA, 0x82, 0x38, 0xCE, 0x0E,
+    0x65, 0x78, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x64, 0x65,
+    0x62, 0x75, 0x67, 0x5B, 0xCE, 0x01, 0x5D, 0xD0, 0x0C, 0x72,
+    0x65, 0x73, 0x75, 0x6D, 0x65, 0x2D, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x28, 0x02, 0x00, 0x00, 0x27, 0x03, 0x00, 0x05, 0x2B,
+    0x03, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x03, 0x04,
+    0x00, 0x17, 0x04, 0x03, 0x00, 0x26, 0x05, 0x01, 0x00, 0x36,
+    0x04, 0x05, 0x00, 0x26, 0x05, 0x02, 0x00, 0x27, 0x06, 0x01,
+    0x01, 0x36, 0x04, 0x05, 0x06, 0x26, 0x05, 0x03, 0x00, 0x36,
+    0x04, 0x05, 0x01, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x06, 0x04,
+    0x00, 0x2F, 0x05, 0x06, 0x00, 0x2A, 0x06, 0x00, 0x00, 0x17,
+    0x07, 0x06, 0x00, 0x26, 0x08, 0x05, 0x00, 0x27, 0x09, 0x01,
+    0x01, 0x26, 0x0A, 0x06, 0x00, 0x2D, 0x08, 0x09, 0x0A, 0x26,
+    0x09, 0x07, 0x00, 0x2F, 0x08, 0x09, 0x00, 0x25, 0x0A, 0x01,
+    0x00, 0x27, 0x0B, 0x01, 0x01, 0x06, 0x09, 0x0A, 0x0B, 0x2C,
+    0x04, 0x09, 0x00, 0x27, 0x0B, 0x01, 0x02, 0x2F, 0x0A, 0x0B,
+    0x00, 0x2D, 0x07, 0x0A, 0x04, 0x27, 0x0B, 0x00, 0x03, 0x2F,
+    0x09, 0x0B, 0x00, 0x26, 0x0A, 0x08, 0x00, 0x27, 0x0B, 0x01,
+    0x01, 0x26, 0x0C, 0x09, 0x00, 0x2D, 0x0A, 0x0B, 0x0C, 0x26,
+    0x0B, 0x07, 0x00, 0x2F, 0x0A, 0x0B, 0x00, 0x26, 0x0B, 0x0A,
+    0x00, 0x2B, 0x0B, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00, 0x00,
+    0xBF, 0xFF, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x0A, 0x02, 0x02,
+    0x02, 0x09, 0x1B, 0x01, 0xCE, 0x0F, 0x64, 0x65, 0x62, 0x75,
+    0x67, 0x67, 0x65, 0x72, 0x2D, 0x63, 0x68, 0x75, 0x6E, 0x6B,
+    0x73, 0xDA, 0x12, 0xDA, 0x85, 0xDF, 0xDA, 0x85, 0xE0, 0xDA,
+    0x82, 0x4E, 0xCE, 0x06, 0x64, 0x65, 0x62, 0x75, 0x67, 0x5B,
+    0xCE, 0x02, 0x5D, 0x3A, 0xDA, 0x85, 0xE2, 0xDA, 0x85, 0xE3,
+    0xDA, 0x81, 0x5A, 0xDA, 0x82, 0xBA, 0x28, 0x02, 0x00, 0x00,
+    0x26, 0x03, 0x00, 0x00, 0x2C, 0x01, 0x03, 0x00, 0x26, 0x04,
+    0x01, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x17, 0x04, 0x03, 0x00,
+    0x2B, 0x01, 0x00, 0x00, 0x26, 0x06, 0x02, 0x00, 0x2F, 0x05,
+    0x06, 0x00, 0x25, 0x06, 0x00, 0x00, 0x2B, 0x06, 0x00, 0x00,
+    0x2F, 0x06, 0x05, 0x00, 0x17, 0x05, 0x06, 0x00, 0x26, 0x07,
+    0x03, 0x00, 0x27, 0x08, 0x00, 0x01, 0x26, 0x09, 0x04, 0x00,
+    0x2D, 0x07, 0x08, 0x09, 0x26, 0x07, 0x05, 0x00, 0x2D, 0x05,
+    0x07, 0x04, 0x26, 0x07, 0x06, 0x00, 0x2B, 0x07, 0x00, 0x00,
+    0x26, 0x08, 0x07, 0x00, 0x2F, 0x07, 0x08, 0x00, 0x17, 0x08,
+    0x07, 0x00, 0x2C, 0x08, 0x00, 0x00, 0x26, 0x09, 0x08, 0x00,
+    0x30, 0x09, 0x00, 0x00, 0x01, 0x1C, 0x01, 0x9E, 0x21, 0x0E,
+    0x04, 0x02, 0x1C, 0x01, 0x00, 0x17, 0x03, 0x02, 0x10, 0x03,
+    0x00, 0x01, 0x01, 0x00, 0x0D, 0x0A, 0x02, 0x18, 0x01, 0x00,
+    0x17, 0x03, 0x02, 0x00, 0x2B, 0x01, 0x90, 0x21, 0x0A, 0x04,
+    0x04, 0x1E, 0x01, 0x00, 0x19, 0x02, 0x02, 0x00, 0x03, 0x02,
+    0x00, 0x02, 0x02, 0x00, 0x03, 0x02, 0x00, 0x02, 0x02, 0x00,
+    0x06, 0x0A, 0x00, 0x03, 0x02, 0x5A, 0x03, 0x00, 0x2D, 0x03,
+    0x00, 0x2B, 0x06, 0x02, 0x00, 0x03, 0x02, 0x00, 0xCD, 0x02,
+    0xD0, 0x00, 0x00, 0x06, 0x02, 0x02, 0x02, 0x07, 0x1C, 0x01,
+    0xDA, 0x12, 0xDA, 0x81, 0xDE, 0xDA, 0x82, 0xBF, 0xDA, 0x82,
+    0x62, 0xDA, 0x03, 0xCF, 0x01, 0x5F, 0xD0, 0x05, 0x64, 0x65,
+    0x62, 0x75, 0x67, 0xDA, 0x82, 0xA3, 0x2B, 0x00, 0x00, 0x00,
+    0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x26, 0x04,
+    0x01, 0x00, 0x1F, 0x03, 0x04, 0x02, 0x1A, 0x03, 0x0B, 0x00,
+    0x2B, 0x01, 0x00, 0x00, 0x26, 0x04, 0x02, 0x00, 0x2F, 0x02,
+    0x04, 0x00, 0x26, 0x02, 0x03, 0x00, 0x2C, 0x02, 0x01, 0x00,
+    0x3E, 0x02, 0x00, 0x00, 0x27, 0x04, 0x00, 0x00, 0x26, 0x05,
+    0x04, 0x00, 0x36, 0x04, 0x05, 0x02, 0x03, 0x04, 0x00, 0x00,
+    0x26, 0x02, 0x05, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x27, 0x04,
+    0x00, 0x00, 0x2F, 0x02, 0x04, 0x00, 0x1A, 0x02, 0x04, 0x00,
+    0x2C, 0x00, 0x01, 0x00, 0x27, 0x04, 0x00, 0x04, 0x30, 0x04,
+    0x00, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x05, 0x06, 0x00,
+    0x2F, 0x04, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0x1F, 0x03, 0xB4, 0x21, 0x28, 0x02, 0x00, 0x11, 0x01, 0x00,
+    0x07, 0x03, 0x02, 0x0C, 0x07, 0x00, 0x0E, 0x04, 0x02, 0x0D,
+    0x01, 0x00, 0x07, 0x03, 0x02, 0x04, 0x03, 0x02, 0x08, 0x01,
+    0x00, 0x07, 0x0A, 0x01, 0x8A, 0x21, 0x06, 0x02, 0x06, 0x04,
+    0x02, 0x22, 0x00, 0x25, 0x01, 0xF0, 0x20, 0x02, 0x03, 0x0E,
+    0x04, 0x02, 0x00, 0x1A, 0x04, 0x00, 0x19, 0x03, 0x02, 0x00,
+    0x01, 0x00, 0x20, 0x04, 0x00, 0x1F, 0x02, 0x0A, 0x00, 0x03,
+    0x3A, 0x32, 0x03, 0x00, 0x1A, 0x06, 0x00, 0x19, 0x0C, 0x03,
+    0x31, 0x28, 0x01, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x2C,
+    0x02, 0x00, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2F, 0x02, 0x03,
+    0x00, 0x24, 0x03, 0x00, 0x00, 0x23, 0x04, 0x00, 0x00, 0x24,
+    0x05, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00, 0x23, 0x07, 0x00,
+    0x00, 0x23, 0x08, 0x00, 0x00, 0x23, 0x09, 0x00, 0x00, 0x24,
+    0x0A, 0x00, 0x00, 0x26, 0x0B, 0x02, 0x00, 0x2B, 0x0B, 0x00,
+    0x00, 0x26, 0x0C, 0x03, 0x00, 0x2F, 0x0B, 0x0C, 0x00, 0x17,
+    0x0C, 0x0B, 0x00, 0x1A, 0x0C, 0x06, 0x00, 0x26, 0x0B, 0x04,
+    0x00, 0x2C, 0x0B, 0x0C, 0x00, 0x26, 0x0D, 0x01, 0x00, 0x2F,
+    0x0B, 0x0D, 0x00, 0x18, 0x01, 0x00, 0x00, 0x26, 0x0B, 0x05,
+    0x00, 0x2B, 0x0B, 0x00, 0x00, 0x26, 0x0C, 0x03, 0x00, 0x2F,
+    0x0B, 0x0C, 0x00, 0x17, 0x0C, 0x0B, 0x00, 0x1A, 0x0C, 0x06,
+    0x00, 0x26, 0x0B, 0x06, 0x00, 0x2C, 0x0B, 0x0C, 0x00, 0x26,
+    0x0D, 0x01, 0x00, 0x2F, 0x0B, 0x0D, 0x00, 0x18, 0x01, 0x00,
+    0x00, 0x2A, 0x0B, 0x00, 0x00, 0x2A, 0x0C, 0x01, 0x00, 0x2A,
+    0x0D, 0x02, 0x00, 0x2A, 0x0E, 0x03, 0x00, 0x2A, 0x0F, 0x04,
+    0x00, 0x2A, 0x10, 0x05, 0x00, 0x2A, 0x11, 0x06, 0x00, 0x2A,
+    0x12, 0x07, 0x00, 0x2A, 0x13, 0x08, 0x00, 0x2A, 0x14, 0x09,
+    0x00, 0x2A, 0x15, 0x0A, 0x00, 0x2A, 0x16, 0x0B, 0x00, 0x2A,
+    0x17, 0x0C, 0x00, 0x26, 0x18, 0x07, 0x00, 0x26, 0x19, 0x08,
+    0x00, 0x2D, 0x18, 0x0B, 0x19, 0x26, 0x18, 0x09, 0x00, 0x2D,
+    0x0C, 0x18, 0x0D, 0x26, 0x18, 0x0A, 0x00, 0x26, 0x19, 0x0B,
+    0x00, 0x2D, 0x18, 0x0E, 0x19, 0x26, 0x18, 0x0C, 0x00, 0x2D,
+    0x0F, 0x18, 0x10, 0x26, 0x18, 0x0D, 0x00, 0x26, 0x19, 0x0E,
+    0x00, 0x2D, 0x18, 0x11, 0x19, 0x26, 0x18, 0x0F, 0x00, 0x2D,
+    0x12, 0x18, 0x13, 0x26, 0x18, 0x10, 0x00, 0x26, 0x19, 0x11,
+    0x00, 0x2D, 0x18, 0x14, 0x19, 0x26, 0x18, 0x12, 0x00, 0x2D,
+    0x15, 0x18, 0x16, 0x26, 0x18, 0x13, 0x00, 0x2C, 0x18, 0x17,
+    0x00, 0x3D, 0x0B, 0x00, 0x00, 0x17, 0x0C, 0x0B, 0x00, 0x2A,
+    0x0D, 0x0D, 0x00, 0x17, 0x0E, 0x0D, 0x00, 0x26, 0x0F, 0x14,
+    0x00, 0x23, 0x10, 0x00, 0x00, 0x26, 0x11, 0x15, 0x00, 0x2D,
+    0x0F, 0x10, 0x11, 0x23, 0x0F, 0x00, 0x00, 0x26, 0x10, 0x16,
+    0x00, 0x23, 0x11, 0x00, 0x00, 0x2D, 0x0F, 0x10, 0x11, 0x26,
+    0x0F, 0x17, 0x00, 0x23, 0x10, 0x00, 0x00, 0x2C, 0x0F, 0x10,
+    0x00, 0x3D, 0x0F, 0x00, 0x00, 0x17, 0x10, 0x0F, 0x00, 0x26,
+    0x11, 0x18, 0x00, 0x23, 0x12, 0x00, 0x00, 0x26, 0x13, 0x19,
+    0x00, 0x2D, 0x11, 0x12, 0x13, 0x23, 0x11, 0x00, 0x00, 0x26,
+    0x12, 0x1A, 0x00, 0x23, 0x13, 0x00, 0x00, 0x2D, 0x11, 0x12,
+    0x13, 0x26, 0x11, 0x1B, 0x00, 0x23, 0x12, 0x00, 0x00, 0x26,
+    0x13, 0x1C, 0x00, 0x2D, 0x11, 0x12, 0x13, 0x23, 0x11, 0x00,
+    0x00, 0x2B, 0x11, 0x00, 0x00, 0x3D, 0x11, 0x00, 0x00, 0x17,
+    0x12, 0x11, 0x00, 0x2A, 0x13, 0x0E, 0x00, 0x17, 0x14, 0x13,
+    0x00, 0x25, 0x15, 0x00, 0x00, 0x39, 0x16, 0x00, 0x00, 0x17,
+    0x17, 0x16, 0x00, 0x41, 0x18, 0x15, 0x17, 0x1A, 0x18, 0x48,
+    0x00, 0x34, 0x19, 0x00, 0x15, 0x17, 0x1A, 0x19, 0x00, 0x1A,
+    0x07, 0x0A, 0x00, 0x25, 0x1B, 0x00, 0x00, 0x25, 0x1C, 0x01,
+    0x00, 0x2D, 0x1A, 0x1B, 0x1C, 0x26, 0x1C, 0x1D, 0x00, 0x2F,
+    0x1B, 0x1C, 0x00, 0x26, 0x1D, 0x0D, 0x00, 0x1F, 0x1C, 0x1D,
+    0x1B, 0x17, 0x19, 0x1C, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22,
+    0x19, 0x00, 0x00, 0x1A, 0x19, 0x09, 0x00, 0x25, 0x1B, 0x01,
+    0x00, 0x2C, 0x1A, 0x1B, 0x00, 0x26, 0x1C, 0x1D, 0x00, 0x2F,
+    0x1B, 0x1C, 0x00, 0x2C, 0x1B, 0x15, 0x00, 0x2F, 0x1C, 0x0E,
+    0x00, 0x06, 0x15, 0x15, 0x1C, 0x18, 0x31, 0x00, 0x00, 0x24,
+    0x04, 0x00, 0x00, 0x26, 0x1C, 0x1E, 0x00, 0x2F, 0x1B, 0x1C,
+    0x00, 0x17, 0x1C, 0x1B, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x26,
+    0x1D, 0x1F, 0x00, 0x2F, 0x1B, 0x1D, 0x00, 0x17, 0x1D, 0x1B,
+    0x00, 0x26, 0x1B, 0x00, 0x00, 0x36, 0x1C, 0x1B, 0x1D, 0x26,
+    0x1B, 0x20, 0x00, 0x26, 0x1E, 0x21, 0x00, 0x2D, 0x1A, 0x1B,
+    0x1E, 0x26, 0x1B, 0x22, 0x00, 0x26, 0x1E, 0x23, 0x00, 0x2D,
+    0x1B, 0x08, 0x1E, 0x26, 0x1B, 0x24, 0x00, 0x2D, 0x14, 0x1B,
+    0x1C, 0x26, 0x1E, 0x25, 0x00, 0x2F, 0x1B, 0x1E, 0x00, 0x26,
+    0x1E, 0x26, 0x00, 0x34, 0x1B, 0x1C, 0x1E, 0x26, 0x1F, 0x27,
+    0x00, 0x35, 0x1E, 0x1B, 0x1F, 0x17, 0x1B, 0x1E, 0x00, 0x1A,
+    0x1B, 0x16, 0x00, 0x2C, 0x00, 0x15, 0x00, 0x26, 0x1F, 0x28,
+    0x00, 0x2F, 0x1E, 0x1F, 0x00, 0x2B, 0x1B, 0x00, 0x00, 0x2E,
+    0x1E, 0x00, 0x00, 0x3F, 0x1E, 0x00, 0x00, 0x2D, 0x1E, 0x1C,
+    0x1A, 0x26, 0x20, 0x29, 0x00, 0x2F, 0x1F, 0x20, 0x00, 0x17,
+    0x1E, 0x1F, 0x00, 0x2B, 0x1E, 0x00, 0x00, 0x26, 0x20, 0x2A,
+    0x00, 0x2F, 0x1F, 0x20, 0x00, 0x1A, 0x1F, 0x03, 0x00, 0x2F,
+    0x20, 0x1E, 0x00, 0x18, 0x05, 0x00, 0x00, 0x26, 0x20, 0x2B,
+    0x00, 0x2B, 0x20, 0x00, 0x00, 0x2F, 0x20, 0x1E, 0x00, 0x01,
+    0x20, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x17, 0x15, 0x17,
+    0x00, 0x18, 0xB8, 0xFF, 0xFF, 0x2B, 0x0A, 0x00, 0x00, 0x26,
+    0x1A, 0x2C, 0x00, 0x2F, 0x19, 0x1A, 0x00, 0x1A, 0x19, 0x0B,
+    0x00, 0x1A, 0x03, 0x03, 0x00, 0x17, 0x1A, 0x03, 0x00, 0x18,
+    0x06, 0x00, 0x00, 0x1A, 0x04, 0x03, 0x00, 0x17, 0x1B, 0x04,
+    0x00, 0x18, 0x02, 0x00, 0x00, 0x22, 0x1B, 0x00, 0x00, 0x17,
+    0x1A, 0x1B, 0x00, 0x17, 0x18, 0x1A, 0x00, 0x18, 0x02, 0x00,
+    0x00, 0x22, 0x18, 0x00, 0x00, 0x1A, 0x18, 0x37, 0x00, 0x1A,
+    0x05, 0x02, 0x00, 0x18, 0x0A, 0x00, 0x00, 0x26, 0x19, 0x2D,
+    0x00, 0x26, 0x1A, 0x2E, 0x00, 0x26, 0x1B, 0x0D, 0x00, 0x2D,
+    0x19, 0x1A, 0x1B, 0x26, 0x19, 0x2F, 0x00, 0x26, 0x1A, 0x30,
+    0x00, 0x2C, 0x19, 0x1A, 0x00, 0x26, 0x1A, 0x31, 0x00, 0x2F,
+    0x19, 0x1A, 0x00, 0x2A, 0x19, 0x0F, 0x00, 0x17, 0x1A, 0x19,
+    0x00, 0x2A, 0x19, 0x10, 0x00, 0x17, 0x1B, 0x19, 0x00, 0x1A,
+    0x05, 0x03, 0x00, 0x17, 0x19, 0x1A, 0x00, 0x18, 0x02, 0x00,
+    0x00, 0x17, 0x19, 0x1B, 0x00, 0x17, 0x1C, 0x19, 0x00, 0x2A,
+    0x19, 0x11, 0x00, 0x17, 0x1D, 0x19, 0x00, 0x1A, 0x06, 0x03,
+    0x00, 0x17, 0x19, 0x1D, 0x00, 0x18, 0x02, 0x00, 0x00, 0x26,
+    0x19, 0x32, 0x00, 0x17, 0x1E, 0x19, 0x00, 0x2A, 0x19, 0x12,
+    0x00, 0x17, 0x1F, 0x19, 0x00, 0x1A, 0x05, 0x04, 0x00, 0x2A,
+    0x20, 0x13, 0x00, 0x17, 0x19, 0x20, 0x00, 0x18, 0x02, 0x00,
+    0x00, 0x22, 0x19, 0x00, 0x00, 0x17, 0x20, 0x19, 0x00, 0x1A,
+    0x09, 0x03, 0x00, 0x26, 0x19, 0x33, 0x00, 0x18, 0x02, 0x00,
+    0x00, 0x26, 0x19, 0x34, 0x00, 0x26, 0x21, 0x35, 0x00, 0x2C,
+    0x21, 0x19, 0x00, 0x26, 0x22, 0x01, 0x00, 0x2F, 0x21, 0x22,
+    0x00, 0x1A, 0x09, 0x03, 0x00, 0x23, 0x19, 0x00, 0x00, 0x18,
+    0x02, 0x00, 0x00, 0x22, 0x19, 0x00, 0x00, 0x26, 0x21, 0x36,
+    0x00, 0x2C, 0x21, 0x19, 0x00, 0x26, 0x22, 0x01, 0x00, 0x2F,
+    0x21, 0x22, 0x00, 0x2C, 0x1F, 0x20, 0x00, 0x26, 0x19, 0x37,
+    0x00, 0x30, 0x19, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xCD,
+    0x02, 0xD0, 0x00, 0x00, 0x07, 0x01, 0x01, 0xCD, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x03, 0x16, 0x01, 0xDA, 0x12, 0xDA, 0x83, 0x81,
+    0xD7, 0xDC, 0x80, 0xCC, 0xDA, 0x83, 0xD3, 0x25, 0x02, 0x01,
+    0x00, 0x06, 0x01, 0x00, 0x02, 0x27, 0x03, 0x00, 0x00, 0x34,
+    0x02, 0x03, 0x01, 0x2B, 0x02, 0x00, 0x00, 0x26, 0x03, 0x00,
+    0x00, 0x2F, 0x01, 0x03, 0x00, 0x17, 0x02, 0x01, 0x00, 0x25,
+    0x04, 0x02, 0x00, 0x06, 0x03, 0x00, 0x04, 0x27, 0x05, 0x00,
+    0x00, 0x34, 0x04, 0x05, 0x03, 0x2B, 0x02, 0x00, 0x00, 0x26,
+    0x05, 0x01, 0x00, 0x2F, 0x03, 0x05, 0x00, 0x2C, 0x04, 0x03,
+    0x00, 0x26, 0x06, 0x02, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x24,
+    0x03, 0x00, 0x00, 0x29, 0x03, 0x00, 0x04, 0x25, 0x03, 0x03,
+    0x00, 0x03, 0x03, 0x00, 0x00, 0xBF, 0xFF, 0x1F, 0x02, 0xB8,
+    0x22, 0x48, 0x02, 0x00, 0x11, 0x03, 0x00, 0x0F, 0x01, 0x00,
+    0x0D, 0x02, 0x02, 0x1E, 0x02, 0x00, 0x11, 0x03, 0x00, 0x24,
+    0x03, 0x00, 0x2F, 0x02, 0x02, 0x00, 0x02, 0x05, 0x03, 0xCD,
+    0x02, 0xD0, 0x00, 0x00, 0x04, 0x01, 0x01, 0xCD, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x01, 0x0B, 0x01, 0xDA, 0x12, 0xDA, 0x82, 0xC8,
+    0x24, 0x01, 0x00, 0x00, 0x29, 0x01, 0x00, 0x04, 0x25, 0x02,
+    0x01, 0x00, 0x06, 0x01, 0x00, 0x02, 0x27, 0x03, 0x00, 0x00,
+    0x34, 0x02, 0x03, 0x01, 0x2B, 0x02, 0x00, 0x00, 0x26, 0x03,
+    0x00, 0x00, 0x2F, 0x01, 0x03, 0x00, 0x25, 0x02, 0x02, 0x00,
+    0x03, 0x02, 0x00, 0x00, 0xBF, 0xFF, 0x10, 0x02, 0xCC, 0x22,
+    0x18, 0x02, 0x02, 0x2C, 0x02, 0x00, 0x11, 0x03, 0x00, 0x19,
+    0x02, 0x03, 0x03, 0xCD, 0x02, 0x90, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x08, 0x14, 0xDA, 0x12,
+    0xD0, 0x0A, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0xCE, 0x05, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0xDA,
+    0x80, 0x94, 0xCE, 0x07, 0x75, 0x73, 0x61, 0x67, 0x65, 0x3A,
+    0x20, 0xCE, 0x19, 0x20, 0x5B, 0x6F, 0x70, 0x74, 0x69, 0x6F,
+    0x6E, 0x73, 0x5D, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+    0x20, 0x61, 0x72, 0x67, 0x73, 0x2E, 0x2E, 0x2E, 0xDA, 0x82,
+    0x38, 0xCE, 0x82, 0x81, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
+    0x73, 0x20, 0x61, 0x72, 0x65, 0x3A, 0x0A, 0x20, 0x20, 0x2D,
+    0x68, 0x20, 0x3A, 0x20, 0x53, 0x68, 0x6F, 0x77, 0x20, 0x74,
+    0x68, 0x69, 0x73, 0x20, 0x68, 0x65, 0x6C, 0x70, 0x0A, 0x20,
+    0x20, 0x2D, 0x76, 0x20, 0x3A, 0x20, 0x50, 0x72, 0x69, 0x6E,
+    0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x65, 0x72, 0x73,
+    0x69, 0x6F, 0x6E, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x0A, 0x20, 0x20, 0x2D, 0x73, 0x20, 0x3A, 0x20, 0x55, 0x73,
+    0x65, 0x20, 0x72, 0x61, 0x77, 0x20, 0x73, 0x74, 0x64, 0x69,
+    0x6E, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20,
+    0x6F, 0x66, 0x20, 0x67, 0x65, 0x74, 0x6C, 0x69, 0x6E, 0x65,
+    0x20, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x69, 0x74, 0x79, 0x0A,
+    0x20, 0x20, 0x2D, 0x65, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20,
+    0x3A, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x20,
+    0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x6F,
+    0x66, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x0A, 0x20, 0x20,
+    0x2D, 0x72, 0x20, 0x3A, 0x20, 0x45, 0x6E, 0x74, 0x65, 0x72,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x20,
+    0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x72, 0x75, 0x6E, 0x6E,
+    0x69, 0x6E, 0x67, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x73, 0x63,
+    0x72, 0x69, 0x70, 0x74, 0x73, 0x0A, 0x20, 0x20, 0x2D, 0x70,
+    0x20, 0x3A, 0x20, 0x4B, 0x65, 0x65, 0x70, 0x20, 0x6F, 0x6E,
+    0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x69, 0x6E, 0x67,
+    0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20,
+    0x69, 0x73, 0x20, 0x61, 0x20, 0x74, 0x6F, 0x70, 0x20, 0x6C,
+    0x65, 0x76, 0x65, 0x6C, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+    0x20, 0x28, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65,
+    0x6E, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x2D, 0x71, 0x20, 0x3A,
+    0x20, 0x48, 0x69, 0x64, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x6D,
+    0x70, 0x74, 0x2C, 0x20, 0x6C, 0x6F, 0x67, 0x6F, 0x2C, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x20, 0x6F,
+    0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x28, 0x71, 0x75, 0x69,
+    0x65, 0x74, 0x29, 0x0A, 0x20, 0x20, 0x2D, 0x6B, 0x20, 0x3A,
+    0x20, 0x43, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x20, 0x73,
+    0x63, 0x72, 0x69, 0x70, 0x74, 0x73, 0x20, 0x62, 0x75, 0x74,
+    0x20, 0x64, 0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x65, 0x78,
+    0x65, 0x63, 0x75, 0x74, 0x65, 0x20, 0x28, 0x66, 0x6C, 0x79,
+    0x63, 0x68, 0x65, 0x63, 0x6B, 0x29, 0x0A, 0x20, 0x20, 0x2D,
+    0x6D, 0x20, 0x73, 0x79, 0x73, 0x70, 0x61, 0x74, 0x68, 0x20,
+    0x3A, 0x20, 0x53, 0x65, 0x74, 0x20, 0x73, 0x79, 0x73, 0x74,
+    0x65, 0x6D, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20,
+    0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x20, 0x6D, 0x6F, 0x64,
+    0x75, 0x6C, 0x65, 0x73, 0x0A, 0x20, 0x20, 0x2D, 0x63, 0x20,
+    0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x6F, 0x75, 0x74,
+    0x70, 0x75, 0x74, 0x20, 0x3A, 0x20, 0x43, 0x6F, 0x6D, 0x70,
+    0x69, 0x6C, 0x65, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20,
+    0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x63, 0x6F, 0x64,
+    0x65, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x6E, 0x20,
+    0x69, 0x6D, 0x61, 0x67, 0x65, 0x0A, 0x20, 0x20, 0x2D, 0x6E,
+    0x20, 0x3A, 0x20, 0x44, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65,
+    0x20, 0x41, 0x4E, 0x53, 0x49, 0x20, 0x63, 0x6F, 0x6C, 0x6F,
+    0x72, 0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x69,
+    0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6C,
+    0x0A, 0x20, 0x20, 0x2D, 0x6C, 0x20, 0x70, 0x61, 0x74, 0x68,
+    0x20, 0x3A, 0x20, 0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65,
+    0x20, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61,
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x62, 0x65, 0x66, 0x6F,
+    0x72, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61, 0x69, 0x6E, 0x20,
+    0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x0A, 0x20, 0x20, 0x2D,
+    0x2D, 0x20, 0x3A, 0x20, 0x53, 0x74, 0x6F, 0x70, 0x20, 0x68,
+    0x61, 0x6E, 0x64, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x70,
+    0x74, 0x69, 0x6F, 0x6E, 0x73, 0xDA, 0x83, 0x7F, 0x26, 0x00,
+    0x00, 0x00, 0x26, 0x01, 0x01, 0x00, 0x2C, 0x00, 0x01, 0x00,
+    0x26, 0x01, 0x02, 0x00, 0x2F, 0x00, 0x01, 0x00, 0x26, 0x01,
+    0x03, 0x00, 0x26, 0x02, 0x04, 0x00, 0x2D, 0x01, 0x00, 0x02,
+    0x26, 0x02, 0x05, 0x00, 0x2F, 0x01, 0x02, 0x00, 0x26, 0x00,
+    0x06, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x02, 0x05, 0x00,
+    0x2F, 0x00, 0x02, 0x00, 0x25, 0x02, 0x00, 0x00, 0x2B, 0x02,
+    0x00, 0x00, 0x26, 0x03, 0x07, 0x00, 0x2F, 0x02, 0x03, 0x00,
+    0x25, 0x03, 0x01, 0x00, 0x03, 0x03, 0x00, 0x00, 0x10, 0x05,
+    0x82, 0x22, 0x3A, 0x05, 0x00, 0x21, 0x04, 0x02, 0x00, 0x04,
+    0x1E, 0x00, 0x02, 0x21, 0x03, 0xCD, 0x02, 0xD0, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x06,
+    0x01, 0xDA, 0x12, 0x23, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00,
+    0x0A, 0x24, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x08, 0x25,
+    0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x0A,
+    0x02, 0xB0, 0x22, 0x24, 0x02, 0x00, 0x34, 0x02, 0x00, 0x43,
+    0xCD, 0x02, 0xD0, 0x00, 0x00, 0x04, 0x01, 0x01, 0xCD, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x04, 0x0E, 0x01, 0xDA, 0x12, 0xDA, 0x85,
+    0xD8, 0xDA, 0x80, 0xF8, 0xDA, 0x82, 0xB5, 0xD7, 0xCD, 0x02,
+    0x99, 0x00, 0x00, 0x15, 0x01, 0x01, 0xCD, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x10, 0x61, 0xCE, 0x07, 0x69, 0x6D, 0x70, 0x6F, 0x72,
+    0x74, 0x2A, 0xDA, 0x12, 0xDA, 0x81, 0x74, 0xDA, 0x80, 0xDA,
+    0xDA, 0x82, 0x08, 0xD0, 0x02, 0x61, 0x73, 0xDA, 0x85, 0xD8,
+    0xD0, 0x06, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0xDA, 0x84,
+    0xA8, 0xDA, 0x81, 0x3D, 0xDA, 0x81, 0x5A, 0xDA, 0x81, 0x16,
+    0xDA, 0x57, 0xDA, 0x81, 0xED, 0xDA, 0x80, 0xCD, 0xDA, 0x4B,
+    0xDA, 0x83, 0x72, 0xDA, 0x83, 0x64, 0x28, 0x02, 0x00, 0x00,
+    0x26, 0x04, 0x00, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x2B, 0x03,
+    0x00, 0x00, 0x26, 0x05, 0x01, 0x00, 0x2F, 0x04, 0x05, 0x00,
+    0x17, 0x03, 0x04, 0x00, 0x2E, 0x01, 0x00, 0x00, 0x26, 0x06,
+    0x02, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x26, 0x07, 0x03, 0x00,
+    0x34, 0x06, 0x05, 0x07, 0x17, 0x07, 0x06, 0x00, 0x26, 0x08,
+    0x04, 0x00, 0x34, 0x06, 0x05, 0x08, 0x17, 0x08, 0x06, 0x00,
+    0x26, 0x09, 0x05, 0x00, 0x34, 0x06, 0x05, 0x09, 0x17, 0x09,
+    0x06, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x2E, 0x01, 0x00, 0x00,
+    0x26, 0x0A, 0x06, 0x00, 0x2F, 0x06, 0x0A, 0x00, 0x17, 0x0A,
+    0x06, 0x00, 0x1A, 0x07, 0x07, 0x00, 0x26, 0x0C, 0x07, 0x00,
+    0x2C, 0x07, 0x0C, 0x00, 0x26, 0x0D, 0x08, 0x00, 0x2F, 0x0C,
+    0x0D, 0x00, 0x17, 0x0B, 0x0C, 0x00, 0x18, 0x02, 0x00, 0x00,
+    0x22, 0x0B, 0x00, 0x00, 0x17, 0x0C, 0x0B, 0x00, 0x1A, 0x0C,
+    0x03, 0x00, 0x17, 0x0B, 0x0C, 0x00, 0x18, 0x0F, 0x00, 0x00,
+    0x1A, 0x08, 0x03, 0x00, 0x17, 0x0D, 0x08, 0x00, 0x18, 0x0B,
+    0x00, 0x00, 0x26, 0x0E, 0x07, 0x00, 0x2C, 0x00, 0x0E, 0x00,
+    0x26, 0x0F, 0x08, 0x00, 0x2F, 0x0E, 0x0F, 0x00, 0x17, 0x0F,
+    0x0E, 0x00, 0x1A, 0x0F, 0x03, 0x00, 0x17, 0x0E, 0x0F, 0x00,
+    0x18, 0x02, 0x00, 0x00, 0x22, 0x0E, 0x00, 0x00, 0x17, 0x0D,
+    0x0E, 0x00, 0x17, 0x0B, 0x0D, 0x00, 0x17, 0x0C, 0x0B, 0x00,
+    0x22, 0x0D, 0x00, 0x00, 0x2C, 0x0A, 0x0D, 0x00, 0x26, 0x0E,
+    0x09, 0x00, 0x2F, 0x0D, 0x0E, 0x00, 0x17, 0x0E, 0x0D, 0x00,
+    0x1A, 0x0E, 0x28, 0x00, 0x34, 0x0D, 0x0A, 0x0E, 0x2C, 0x0E,
+    0x0D, 0x00, 0x26, 0x10, 0x0A, 0x00, 0x2F, 0x0F, 0x10, 0x00,
+    0x37, 0x0D, 0x0F, 0x00, 0x17, 0x10, 0x0D, 0x00, 0x37, 0x0D,
+    0x0F, 0x01, 0x17, 0x11, 0x0D, 0x00, 0x2B, 0x10, 0x00, 0x00,
+    0x26, 0x0F, 0x0B, 0x00, 0x2F, 0x0D, 0x0F, 0x00, 0x1A, 0x0D,
+    0x18, 0x00, 0x26, 0x0F, 0x0C, 0x00, 0x2B, 0x0F, 0x00, 0x00,
+    0x2F, 0x0F, 0x11, 0x00, 0x2B, 0x0F, 0x00, 0x00, 0x26, 0x13,
+    0x0D, 0x00, 0x2F, 0x12, 0x13, 0x00, 0x1A, 0x12, 0x10, 0x00,
+    0x2B, 0x09, 0x00, 0x00, 0x26, 0x13, 0x0D, 0x00, 0x2F, 0x0F,
+    0x13, 0x00, 0x26, 0x13, 0x0C, 0x00, 0x2C, 0x13, 0x0F, 0x00,
+    0x3E, 0x0F, 0x00, 0x00, 0x2C, 0x0F, 0x11, 0x00, 0x26, 0x14,
+    0x0E, 0x00, 0x2F, 0x13, 0x14, 0x00, 0x17, 0x0F, 0x13, 0x00,
+    0x2C, 0x0C, 0x10, 0x00, 0x26, 0x14, 0x0F, 0x00, 0x2F, 0x13,
+    0x14, 0x00, 0x36, 0x03, 0x13, 0x0F, 0x18, 0x01, 0x00, 0x00,
+    0x18, 0x01, 0x00, 0x00, 0x2C, 0x0A, 0x0E, 0x00, 0x26, 0x0D,
+    0x09, 0x00, 0x2F, 0x0E, 0x0D, 0x00, 0x18, 0xD9, 0xFF, 0xFF,
+    0x04, 0x00, 0x00, 0x00, 0x52, 0x01, 0xBC, 0x1F, 0x02, 0x02,
+    0x08, 0x32, 0x03, 0x00, 0x1B, 0x01, 0x00, 0x11, 0x03, 0x06,
+    0x24, 0x09, 0x03, 0x23, 0x04, 0x06, 0x18, 0x01, 0x00, 0x17,
+    0x01, 0x02, 0x20, 0x04, 0x00, 0x10, 0x03, 0x00, 0x0F, 0x07,
+    0x00, 0x07, 0x04, 0x00, 0x48, 0x07, 0x00, 0x47, 0x01, 0x00,
+    0x17, 0x0E, 0x02, 0x00, 0x03, 0x00, 0x42, 0x01, 0x00, 0x41,
+    0x03, 0x00, 0x70, 0x03, 0x00, 0x09, 0x01, 0x00, 0x65, 0x03,
+    0x02, 0x4E, 0x06, 0x00, 0x35, 0x01, 0x00, 0x13, 0x03, 0x02,
+    0x12, 0x01, 0x00, 0x11, 0x07, 0x03, 0x03, 0x25, 0x02, 0x01,
+    0x00, 0x06, 0x01, 0x00, 0x02, 0x27, 0x03, 0x00, 0x00, 0x34,
+    0x02, 0x03, 0x01, 0x26, 0x01, 0x00, 0x00, 0x26, 0x03, 0x01,
+    0x00, 0x2D, 0x02, 0x01, 0x03, 0x26, 0x01, 0x02, 0x00, 0x27,
+    0x03, 0x00, 0x08, 0x2C, 0x01, 0x03, 0x00, 0x26, 0x03, 0x03,
+    0x00, 0x2F, 0x01, 0x03, 0x00, 0x25, 0x02, 0x02, 0x00, 0x03,
+    0x02, 0x00, 0x00, 0xBF, 0xFF, 0x0D, 0x02, 0xC4, 0x22, 0x3C,
+    0x02, 0x00, 0x11, 0x08, 0x00, 0x11, 0x02, 0x01, 0x03, 0xCD,
+    0x02, 0xD0, 0x00, 0x00, 0x04, 0x01, 0x01, 0xCD, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x02, 0x0A, 0x01, 0xDA, 0x12, 0xDA, 0x81, 0x41,
+    0xDA, 0x83, 0x29, 0x25, 0x02, 0x01, 0x00, 0x06, 0x01, 0x00,
+    0x02, 0x27, 0x03, 0x00, 0x00, 0x34, 0x02, 0x03, 0x01, 0x26,
+    0x01, 0x00, 0x00, 0x2C, 0x01, 0x02, 0x00, 0x26, 0x03, 0x01,
+    0x00, 0x2F, 0x01, 0x03, 0x00, 0x25, 0x02, 0x02, 0x00, 0x03,
+    0x02, 0x00, 0x00, 0xBF, 0xFF, 0x0D, 0x02, 0xB4, 0x22, 0x5C,
+    0x02, 0x00, 0x11, 0x04, 0x00, 0x21, 0x02, 0x00, 0x13, 0xCD,
+    0x02, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0xCD, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x00, 0x04, 0x01, 0xDA, 0x12, 0x24, 0x00, 0x00,
+    0x00, 0x29, 0x00, 0x00, 0x07, 0x25, 0x00, 0x01, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x07, 0x02, 0xC0, 0x22, 0x24,
+    0x02, 0x00, 0x0F, 0xCD, 0x02, 0xD0, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x01, 0xDA,
+    0x12, 0x24, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x09, 0x25,
+    0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x07,
+    0x02, 0xB2, 0x22, 0x24, 0x02, 0x00, 0x0F, 0xCD, 0x02, 0xD0,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF,
+    0x00, 0x04, 0x01, 0xDA, 0x12, 0x24, 0x00, 0x00, 0x00, 0x29,
+    0x00, 0x00, 0x08, 0x25, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0x07, 0x02, 0xAC, 0x22, 0x24, 0x02, 0x00,
+    0x0F, 0xCD, 0x02, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0xCD,
+    0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x04, 0x01, 0xDA, 0x12, 0x23,
+    0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x05, 0x25, 0x00, 0x01,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x07, 0x02, 0xAE,
+    0x22, 0x24, 0x02, 0x00, 0x0F, 0xCD, 0x02, 0xD0, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x04,
+    0x01, 0xDA, 0x12, 0x23, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00,
+    0x03, 0x25, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0xBF,
+    0xFF, 0x07, 0x02, 0xAA, 0x22, 0x24, 0x02, 0x00, 0x0F, 0xCD,
+    0x02, 0xD0, 0x00, 0x00, 0x01, 0x00, 0x00, 0xCD, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x00, 0x06, 0x01, 0xDA, 0x12, 0x23, 0x00, 0x00,
+    0x00, 0x29, 0x00, 0x00, 0x06, 0x23, 0x00, 0x00, 0x00, 0x29,
+    0x00, 0x00, 0x03, 0x25, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0xBF, 0xFF, 0x0A, 0x02, 0xA8, 0x22, 0x24, 0x02, 0x00,
+    0x2E, 0x02, 0x00, 0x3D, 0xCD, 0x02, 0x90, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x05, 0x0C, 0xDA,
+    0x12, 0xDA, 0x84, 0xA3, 0xDA, 0x6D, 0xDA, 0x82, 0xCC, 0xDA,
+    0x82, 0x38, 0xDA, 0x83, 0x7F, 0x26, 0x00, 0x00, 0x00, 0x26,
+    0x01, 0x01, 0x00, 0x26, 0x02, 0x02, 0x00, 0x2D, 0x00, 0x01,
+    0x02, 0x26, 0x01, 0x03, 0x00, 0x2F, 0x00, 0x01, 0x00, 0x25,
+    0x01, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x02, 0x04,
+    0x00, 0x2F, 0x01, 0x02, 0x00, 0x25, 0x02, 0x01, 0x00, 0x03,
+    0x02, 0x00, 0x00, 0x0A, 0x06, 0xA6, 0x22, 0x24, 0x04, 0x00,
+    0x4C, 0x02, 0x00, 0x5B, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x08,
+    0x02, 0x02, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x03, 0x0F, 0x01,
+    0xCE, 0x09, 0x64, 0x6F, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65,
+    0x72, 0xDA, 0x12, 0xCE, 0x0E, 0x75, 0x6E, 0x6B, 0x6E, 0x6F,
+    0x77, 0x6E, 0x20, 0x66, 0x6C, 0x61, 0x67, 0x20, 0x2D, 0xDA,
+    0x82, 0x38, 0xDA, 0x85, 0xC9, 0x28, 0x02, 0x00, 0x00, 0x27,
+    0x04, 0x00, 0x0C, 0x34, 0x03, 0x04, 0x00, 0x17, 0x04, 0x03,
+    0x00, 0x1A, 0x04, 0x03, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x30,
+    0x04, 0x00, 0x00, 0x26, 0x05, 0x00, 0x00, 0x2C, 0x05, 0x00,
+    0x00, 0x26, 0x06, 0x01, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x27,
+    0x06, 0x00, 0x0C, 0x26, 0x07, 0x02, 0x00, 0x34, 0x05, 0x06,
+    0x07, 0x30, 0x05, 0x00, 0x00, 0xBF, 0xFF, 0x19, 0x01, 0xD4,
+    0x22, 0x06, 0x02, 0x02, 0x12, 0x01, 0x00, 0x0D, 0x01, 0x02,
+    0x00, 0x02, 0x00, 0x0C, 0x04, 0x00, 0x14, 0x03, 0x00, 0x38,
+    0x01, 0x00, 0x01, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x0D, 0x04,
+    0x04, 0x04, 0x06, 0x2D, 0x01, 0xCE, 0x09, 0x65, 0x76, 0x61,
+    0x6C, 0x75, 0x61, 0x74, 0x6F, 0x72, 0xDA, 0x12, 0xDA, 0x83,
+    0x1B, 0xD8, 0x0F, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73,
+    0x6F, 0x75, 0x72, 0x63, 0x65, 0x6D, 0x61, 0x70, 0xDA, 0x82,
+    0xA1, 0xDA, 0x57, 0xDA, 0x84, 0xCF, 0xDA, 0x62, 0x28, 0x04,
+    0x00, 0x00, 0x27, 0x05, 0x00, 0x0A, 0x1A, 0x05, 0x2A, 0x00,
+    0x2B, 0x01, 0x00, 0x00, 0x26, 0x06, 0x00, 0x00, 0x2F, 0x05,
+    0x06, 0x00, 0x1A, 0x05, 0x25, 0x00, 0x25, 0x06, 0x00, 0x00,
+    0x2B, 0x06, 0x00, 0x00, 0x2F, 0x06, 0x01, 0x00, 0x2B, 0x06,
+    0x00, 0x00, 0x27, 0x08, 0x00, 0x10, 0x2F, 0x07, 0x08, 0x00,
+    0x1A, 0x07, 0x02, 0x00, 0x30, 0x00, 0x00, 0x00, 0x25, 0x06,
+    0x00, 0x00, 0x2B, 0x06, 0x00, 0x00, 0x2F, 0x06, 0x01, 0x00,
+    0x2B, 0x06, 0x00, 0x00, 0x27, 0x09, 0x00, 0x12, 0x2F, 0x08,
+    0x09, 0x00, 0x1A, 0x08, 0x15, 0x00, 0x2B, 0x01, 0x00, 0x00,
+    0x26, 0x09, 0x01, 0x00, 0x2F, 0x06, 0x09, 0x00, 0x37, 0x09,
+    0x06, 0x00, 0x17, 0x0A, 0x09, 0x00, 0x37, 0x09, 0x06, 0x01,
+    0x17, 0x0B, 0x09, 0x00, 0x2E, 0x01, 0x00, 0x00, 0x26, 0x06,
+    0x02, 0x00, 0x2C, 0x06, 0x04, 0x00, 0x26, 0x09, 0x03, 0x00,
+    0x2F, 0x06, 0x09, 0x00, 0x2D, 0x06, 0x0A, 0x0B, 0x26, 0x0C,
+    0x04, 0x00, 0x2F, 0x09, 0x0C, 0x00, 0x17, 0x06, 0x09, 0x00,
+    0x2D, 0x06, 0x02, 0x03, 0x26, 0x0C, 0x05, 0x00, 0x2F, 0x09,
+    0x0C, 0x00, 0x30, 0x09, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xBF, 0xFF,
+    0x40, 0x01, 0xE0, 0x22, 0x06, 0x02, 0x04, 0x04, 0x03, 0x02,
+    0x10, 0x01, 0x00, 0x0B, 0x03, 0x04, 0x20, 0x03, 0x00, 0x17,
+    0x01, 0x01, 0x03, 0x01, 0x02, 0x34, 0x03, 0x02, 0x19, 0x03,
+    0x00, 0x15, 0x01, 0x03, 0x03, 0x03, 0x08, 0x20, 0x04, 0x00,
+    0x17, 0x05, 0x02, 0x36, 0x03, 0x00, 0x1B, 0x01, 0x01, 0x19,
+    0x03, 0x04, 0x06, 0x01, 0x00, 0x01, 0x01, 0x0B, 0x0B, 0x01,
+    0x01, 0x03, 0x01, 0x10, 0x00, 0xCD, 0x02, 0x98, 0x00, 0x00,
+    0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0xCE, 0x08, 0x6E, 0x6F,
+    0x70, 0x72, 0x6F, 0x6D, 0x70, 0x74, 0xDA, 0x12, 0xDA, 0x80,
+    0xF8, 0x28, 0x01, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x03,
+    0x02, 0x00, 0x00, 0x04, 0x03, 0xA4, 0x23, 0x0A, 0xCD, 0x02,
+    0x98, 0x00, 0x00, 0x07, 0x01, 0x01, 0x01, 0x07, 0x11, 0xCE,
+    0x09, 0x67, 0x65, 0x74, 0x70, 0x72, 0x6F, 0x6D, 0x70, 0x74,
+    0xDA, 0x12, 0xDA, 0x82, 0x4E, 0xDA, 0x85, 0xDF, 0xDA, 0x85,
+    0xE0, 0xCE, 0x06, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x3A, 0xDA,
+    0x85, 0xE2, 0xDA, 0x85, 0xE3, 0xDA, 0x81, 0x5A, 0x28, 0x01,
+    0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00,
+    0x2F, 0x02, 0x03, 0x00, 0x37, 0x03, 0x02, 0x00, 0x17, 0x04,
+    0x03, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2C, 0x00, 0x03, 0x00,
+    0x26, 0x05, 0x02, 0x00, 0x2F, 0x03, 0x05, 0x00, 0x26, 0x05,
+    0x03, 0x00, 0x26, 0x06, 0x04, 0x00, 0x2D, 0x05, 0x04, 0x06,
+    0x26, 0x05, 0x05, 0x00, 0x2C, 0x03, 0x05, 0x00, 0x26, 0x05,
+    0x06, 0x00, 0x30, 0x05, 0x00, 0x00, 0x10, 0x01, 0xA6, 0x23,
+    0x0A, 0x03, 0x02, 0x1C, 0x02, 0x00, 0x17, 0x04, 0x02, 0x34,
+    0x07, 0x00, 0x33, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x07, 0x02,
+    0x02, 0x02, 0x06, 0x0E, 0xCE, 0x08, 0x67, 0x65, 0x74, 0x73,
+    0x74, 0x64, 0x69, 0x6E, 0xDA, 0x12, 0xDA, 0x82, 0x66, 0xDA,
+    0x83, 0xD2, 0xDA, 0x84, 0x2C, 0xDA, 0x83, 0x9D, 0xDA, 0x82,
+    0xC1, 0xDA, 0x83, 0x7D, 0x28, 0x02, 0x00, 0x00, 0x26, 0x03,
+    0x00, 0x00, 0x2C, 0x03, 0x00, 0x00, 0x26, 0x04, 0x01, 0x00,
+    0x2F, 0x03, 0x04, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2B, 0x04,
+    0x00, 0x00, 0x26, 0x05, 0x02, 0x00, 0x2F, 0x04, 0x05, 0x00,
+    0x26, 0x05, 0x03, 0x00, 0x26, 0x06, 0x04, 0x00, 0x2D, 0x05,
+    0x06, 0x01, 0x26, 0x05, 0x05, 0x00, 0x30, 0x05, 0x00, 0x00,
+    0x0D, 0x01, 0xAE, 0x23, 0x0A, 0x04, 0x02, 0x04, 0x04, 0x02,
+    0x00, 0x05, 0x02, 0x00, 0xCD, 0x02, 0xD8, 0x00, 0x00, 0x05,
+    0x02, 0x02, 0x02, 0x00, 0x07, 0x01, 0xCE, 0x08, 0x67, 0x65,
+    0x74, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0xDA, 0x12, 0x28, 0x02,
+    0x00, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x27, 0x04, 0x00, 0x1C,
+    0x2F, 0x03, 0x04, 0x00, 0x2C, 0x03, 0x00, 0x00, 0x27, 0x04,
+    0x00, 0x1E, 0x30, 0x04, 0x00, 0x00, 0xBF, 0xFF, 0x0A, 0x01,
+    0xB8, 0x23, 0x0A, 0x03, 0x02, 0x14, 0x03, 0x00, 0x0F, 0xCD,
+    0x02, 0x90, 0x00, 0x00, 0x01, 0x01, 0x01, 0xCD, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x00, 0x01, 0xDA, 0x12, 0x03, 0x00, 0x00, 0x00,
+    0x04, 0x01, 0xBC, 0x23, 0x38, 0x81, 0x2D, 0x01, 0xD6, 0x21,
+    0x02, 0x04, 0x0A, 0x04, 0x01, 0x04, 0x00, 0x01, 0x02, 0x00,
+    0x01, 0x02, 0x00, 0x01, 0x02, 0x00, 0x01, 0x02, 0x00, 0x01,
+    0x02, 0x00, 0x01, 0x02, 0x00, 0x01, 0x02, 0x00, 0x04, 0x04,
+    0x18, 0x02, 0x00, 0x17, 0x04, 0x00, 0x4C, 0x01, 0x00, 0x4B,
+    0x04, 0x02, 0x18, 0x02, 0x00, 0x17, 0x04, 0x00, 0x58, 0x01,
+    0x00, 0x57, 0x01, 0x3E, 0x0E, 0x01, 0x14, 0x00, 0x01, 0x49,
+    0x00, 0x01, 0x30, 0x00, 0x01, 0x12, 0x00, 0x01, 0x0D, 0x00,
+    0x01, 0x0C, 0x00, 0x01, 0x0D, 0x00, 0x01, 0x05, 0x00, 0x01,
+    0x02, 0x00, 0x01, 0x03, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01,
+    0x00, 0x18, 0x27, 0x0D, 0x02, 0x56, 0x00, 0x0D, 0x08, 0x00,
+    0x10, 0x02, 0x00, 0x02, 0x02, 0x00, 0x01, 0x1C, 0x00, 0x01,
+    0x02, 0x1A, 0x01, 0x00, 0x19, 0x01, 0x02, 0x0E, 0x01, 0x00,
+    0x0D, 0x01, 0x02, 0x16, 0x01, 0x00, 0x11, 0x01, 0x02, 0x08,
+    0x05, 0x00, 0x32, 0x02, 0x00, 0x0D, 0x03, 0x00, 0x23, 0x01,
+    0x00, 0x07, 0x04, 0x02, 0x26, 0x02, 0x00, 0x15, 0x01, 0x00,
+    0x0B, 0x01, 0x01, 0x03, 0x01, 0x06, 0x08, 0x02, 0x02, 0x12,
+    0x01, 0x00, 0x11, 0x03, 0x02, 0x1A, 0x01, 0x00, 0x19, 0x02,
+    0x02, 0x00, 0x0A, 0x02, 0x00, 0x02, 0x02, 0x26, 0x02, 0x00,
+    0x09, 0x02, 0x00, 0x1B, 0x03, 0x02, 0x3A, 0x03, 0x00, 0x0B,
+    0x03, 0x00, 0x11, 0x01, 0x00, 0x17, 0x03, 0x02, 0x0C, 0x01,
+    0x00, 0x07, 0x01, 0x00, 0x2C, 0x01, 0x00, 0x2B, 0x03, 0x00,
+    0x4A, 0x01, 0x00, 0x0D, 0x01, 0x03, 0x43, 0x01, 0x06, 0x00,
+    0x01, 0x19, 0x0B, 0x03, 0x1E, 0x16, 0x01, 0x00, 0x09, 0x08,
+    0x00, 0x34, 0x03, 0x00, 0x33, 0x01, 0x00, 0x0B, 0x02, 0x02,
+    0x04, 0x09, 0x02, 0x04, 0x02, 0x02, 0x03, 0x02, 0x02, 0x00,
+    0x04, 0x06, 0x1C, 0x01, 0x00, 0x1B, 0x02, 0x02, 0x00, 0x04,
+    0x08, 0x18, 0x01, 0x00, 0x17, 0x02, 0x02, 0x00, 0x01, 0x04,
+    0x16, 0x01, 0x00, 0x18, 0x03, 0x00, 0x17, 0x01, 0x00, 0x15,
+    0x04, 0x02, 0x2E, 0x04, 0x00, 0x2D, 0x04, 0x02, 0x26, 0x04,
+    0x00, 0x25, 0x03, 0x02, 0x00, 0x01, 0x23, 0x03, 0xCF, 0x08,
+    0x63, 0x6C, 0x69, 0x2D, 0x6D, 0x61, 0x69, 0x6E, 0xDA, 0x84,
+    0x3C, 0xDA, 0x84, 0x2E, 0xDA, 0x84, 0xEB, 0xDA, 0x84, 0xE9,
+    0xDA, 0x80, 0xB7, 0xDA, 0x80, 0xB0, 0xDA, 0x85, 0x85, 0xDA,
+    0x85, 0x83, 0xDA, 0x6E, 0xDA, 0x84, 0x6E, 0xD8, 0x11, 0x74,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x72, 0x6F, 0x70,
+    0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0xCF, 0x11, 0x74, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x72, 0x6F, 0x70, 0x65,
+    0x72, 0x74, 0x69, 0x65, 0x73, 0xDA, 0x80, 0x9F, 0xDA, 0x83,
+    0x8D, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x04, 0x01, 0x01,
+    0x01, 0x00, 0x04, 0xCE, 0x05, 0x66, 0x69, 0x72, 0x73, 0x74,
+    0xDA, 0x12, 0x28, 0x01, 0x00, 0x00, 0x25, 0x03, 0x00, 0x00,
+    0x34, 0x02, 0x00, 0x03, 0x03, 0x02, 0x00, 0x00, 0x07, 0x01,
+    0xB0, 0x09, 0x02, 0x03, 0x06, 0x04, 0xCF, 0x05, 0x66, 0x69,
+    0x72, 0x73, 0x74, 0xDA, 0x80, 0xA6, 0xDA, 0x80, 0xA4, 0xDA,
+    0x83, 0x69, 0xCF, 0x09, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70,
+    0x6F, 0x73, 0x65, 0xD7, 0xCD, 0x02, 0x99, 0x00, 0x00, 0x05,
+    0x01, 0x01, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x03, 0x07, 0xCE,
+    0x09, 0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2D,
+    0xDA, 0x12, 0xDA, 0x24, 0xDA, 0x80, 0xCD, 0xDA, 0x81, 0x5C,
+    0x28, 0x02, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x26, 0x04,
+    0x01, 0x00, 0x2D, 0x00, 0x03, 0x04, 0x2E, 0x01, 0x00, 0x00,
+    0x26, 0x03, 0x02, 0x00, 0x30, 0x03, 0x00, 0x00, 0x06, 0x01,
+    0x5C, 0x02, 0x06, 0x06, 0x04, 0xDA, 0x85, 0xD3, 0xDA, 0x82,
+    0x62, 0xDA, 0x82, 0x5B, 0xDA, 0x84, 0x81, 0xDA, 0x84, 0x7F,
+    0xD8, 0x06, 0x69, 0x6E, 0x76, 0x65, 0x72, 0x74, 0xCF, 0x06,
+    0x69, 0x6E, 0x76, 0x65, 0x72, 0x74, 0xDA, 0x82, 0x07, 0xDA,
+    0x84, 0x3E, 0xD3, 0x10, 0xD0, 0x02, 0x73, 0x2A, 0xD2, 0x02,
+    0x00, 0xCF, 0x03, 0x61, 0x6E, 0x79, 0xD0, 0x01, 0x73, 0xD0,
+    0x02, 0x73, 0x2B, 0xD2, 0x02, 0x00, 0xDA, 0x84, 0x42, 0xDA,
+    0x86, 0x15, 0xD0, 0x02, 0x77, 0x2A, 0xD2, 0x02, 0x00, 0xDA,
+    0x86, 0x14, 0xD0, 0x01, 0x77, 0xD0, 0x02, 0x77, 0x2B, 0xD2,
+    0x02, 0x00, 0xDA, 0x84, 0x42, 0xDA, 0x86, 0x1A, 0xD0, 0x01,
+    0x41, 0xD2, 0x03, 0x00, 0xDA, 0x84, 0xB7, 0xDA, 0x82, 0xBD,
+    0x01, 0xD0, 0x01, 0x44, 0xD2, 0x03, 0x00, 0xDA, 0x84, 0xB7,
+    0xD0, 0x01, 0x64, 0x01, 0xDA, 0x82, 0xBD, 0xD2, 0x03, 0x00,
+    0xDA, 0x83, 0x1C, 0xCE, 0x02, 0x61, 0x7A, 0xCE, 0x02, 0x41,
+    0x5A, 0xDA, 0x86, 0x21, 0xD2, 0x02, 0x00, 0xDA, 0x83, 0x1C,
+    0xCE, 0x02, 0x30, 0x39, 0xD0, 0x02, 0x61, 0x2A, 0xD2, 0x02,
+    0x00, 0xDA, 0x86, 0x14, 0xDA, 0x82, 0xBD, 0xD0, 0x02, 0x61,
+    0x2B, 0xD2, 0x02, 0x00, 0xDA, 0x84, 0x42, 0xDA, 0x82, 0xBD,
+    0xD0, 0x02, 0x64, 0x2A, 0xD2, 0x02, 0x00, 0xDA, 0x86, 0x14,
+    0xDA, 0x86, 0x21, 0xD0, 0x02, 0x64, 0x2B, 0xD2, 0x02, 0x00,
+    0xDA, 0x84, 0x42, 0xDA, 0x86, 0x21, 0xD0, 0x01, 0x53, 0xD2,
+    0x03, 0x00, 0xDA, 0x84, 0xB7, 0xDA, 0x86, 0x15, 0x01, 0xDA,
+    0x86, 0x15, 0xD2, 0x02, 0x00, 0xDA, 0x22, 0xCE, 0x06, 0x20,
+    0x09, 0x0D, 0x0A, 0x00, 0x0C, 0xD0, 0x01, 0x57, 0xD2, 0x03,
+    0x00, 0xDA, 0x84, 0xB7, 0xDA, 0x86, 0x1A, 0x01, 0xDA, 0x86,
+    0x1A, 0xD2, 0x04, 0x00, 0xDA, 0x83, 0x1C, 0xDA, 0x86, 0x23,
+    0xDA, 0x86, 0x24, 0xDA, 0x86, 0x26, 0xCF, 0x13, 0x64, 0x65,
+    0x66, 0x61, 0x75, 0x6C, 0x74, 0x2D, 0x70, 0x65, 0x67, 0x2D,
+    0x67, 0x72, 0x61, 0x6D, 0x6D, 0x61, 0x72, 0xD8, 0x0E, 0x74,
+    0x68, 0x72, 0x65, 0x61, 0x64, 0x2F, 0x63, 0x75, 0x72, 0x72,
+    0x65, 0x6E, 0x74, 0xCF, 0x0E, 0x74, 0x68, 0x72, 0x65, 0x61,
+    0x64, 0x2F, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0xD8,
+    0x05, 0x6D, 0x65, 0x72, 0x67, 0x65, 0xCF, 0x05, 0x6D, 0x65,
+    0x72, 0x67, 0x65, 0xDA, 0x23, 0xDA, 0x1C, 0xDA, 0x81, 0x37,
+    0xDA, 0x81, 0x32, 0xDA, 0x85, 0x3B, 0xDA, 0x85, 0x3A, 0xDA,
+    0x81, 0xB3, 0xDA, 0x81, 0xB0, 0xDA, 0x85, 0x0C, 0xDA, 0x85,
+    0x09, 0xD8, 0x0A, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x66,
+    0x69, 0x6C, 0x6C, 0xCF, 0x0A, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2F, 0x66, 0x69, 0x6C, 0x6C, 0xD7, 0xCD, 0x00, 0x09, 0x00,
+    0x1F, 0x06, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
+    0x10, 0xCE, 0x05, 0x6E, 0x6F, 0x74, 0x3D, 0x3D, 0x39, 0x01,
+    0x00, 0x00, 0x1E, 0x02, 0x01, 0x02, 0x19, 0x02, 0x0A, 0x00,
+    0x37, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x34, 0x04,
+    0x00, 0x05, 0x45, 0x02, 0x03, 0x04, 0x1A, 0x02, 0x07, 0x00,
+    0x05, 0x05, 0x05, 0x01, 0x17, 0x03, 0x04, 0x00, 0x1F, 0x02,
+    0x05, 0x01, 0x1A, 0x02, 0xFA, 0xFF, 0x24, 0x03, 0x00, 0x00,
+    0x03, 0x03, 0x00, 0x00, 0x23, 0x03, 0x00, 0x00, 0x03, 0x03,
+    0x00, 0x00, 0xCF, 0x05, 0x6E, 0x6F, 0x74, 0x3D, 0x3D, 0xDA,
+    0x15, 0xDA, 0x82, 0x13, 0xDA, 0x85, 0x05, 0xDA, 0x85, 0x03,
+    0xDA, 0x83, 0xE6, 0xDA, 0x85, 0x50, 0xDA, 0x83, 0x87, 0xDA,
+    0x83, 0x2F, 0xDA, 0x83, 0x23, 0xDA, 0x85, 0x7B, 0xDA, 0x81,
+    0x86, 0xDA, 0x81, 0x84, 0xD8, 0x0A, 0x74, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2F, 0x6E, 0x65, 0x77, 0xCF, 0x0A, 0x74, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2F, 0x6E, 0x65, 0x77, 0xDA, 0x21,
+    0xDA, 0x84, 0x67, 0xD8, 0x0D, 0x64, 0x65, 0x62, 0x75, 0x67,
+    0x2F, 0x75, 0x6E, 0x62, 0x72, 0x65, 0x61, 0x6B, 0xCF, 0x0D,
+    0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x75, 0x6E, 0x62, 0x72,
+    0x65, 0x61, 0x6B, 0xD7, 0xCD, 0x02, 0xBB, 0x00, 0x00, 0x06,
+    0x01, 0x01, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x01, 0x09, 0x01,
+    0xCE, 0x07, 0x70, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6C, 0xDA,
+    0x12, 0xDA, 0x46, 0x28, 0x02, 0x00, 0x00, 0x39, 0x03, 0x01,
+    0x00, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x05, 0x00, 0x00, 0x2F,
+    0x04, 0x05, 0x00, 0x1A, 0x04, 0x02, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x2A, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xCD,
+    0x02, 0xD1, 0x00, 0x00, 0x02, 0x00, 0x00, 0xCD, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x00, 0x05, 0x01, 0xDA, 0x12, 0x27, 0x01, 0x00,
+    0x01, 0x2E, 0x01, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x27,
+    0x01, 0x00, 0x00, 0x30, 0x01, 0x00, 0x00, 0xBF, 0xFF, 0x04,
+    0x05, 0xBC, 0x0F, 0x1E, 0x10, 0x01, 0xB4, 0x0F, 0x02, 0x01,
+    0x06, 0x1A, 0x03, 0x00, 0x0D, 0x02, 0x00, 0x07, 0x02, 0x02,
+    0x04, 0xCF, 0x07, 0x70, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6C,
+    0xDA, 0x80, 0xC3, 0xDA, 0x80, 0xBF, 0xDA, 0x82, 0x08, 0xDA,
+    0x85, 0x7A, 0xDA, 0x83, 0x1B, 0xCF, 0x06, 0x74, 0x75, 0x70,
+    0x6C, 0x65, 0x3F, 0xD8, 0x0B, 0x64, 0x65, 0x62, 0x75, 0x67,
+    0x2F, 0x62, 0x72, 0x65, 0x61, 0x6B, 0xCF, 0x0B, 0x64, 0x65,
+    0x62, 0x75, 0x67, 0x2F, 0x62, 0x72, 0x65, 0x61, 0x6B, 0xDA,
+    0x83, 0x74, 0xCF, 0x0B, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F,
+    0x63, 0x6C, 0x6F, 0x6E, 0x65, 0xDA, 0x81, 0x3F, 0xDA, 0x81,
+    0x39, 0xD8, 0x07, 0x6F, 0x73, 0x2F, 0x64, 0x61, 0x74, 0x65,
+    0xCF, 0x07, 0x6F, 0x73, 0x2F, 0x64, 0x61, 0x74, 0x65, 0xDA,
+    0x82, 0x0B, 0xDA, 0x81, 0xE8, 0xDA, 0x85, 0x8C, 0xDA, 0x85,
+    0x88, 0xDA, 0x83, 0xC9, 0xDA, 0x83, 0xC4, 0xDA, 0x84, 0xB4,
+    0xDA, 0x84, 0xB2, 0xDA, 0x84, 0x9D, 0xCF, 0x05, 0x73, 0x6C,
+    0x75, 0x72, 0x70, 0xDA, 0x82, 0xBA, 0xCF, 0x07, 0x67, 0x65,
+    0x74, 0x6C, 0x69, 0x6E, 0x65, 0xDA, 0x84, 0x9F, 0xCF, 0x0B,
+    0x69, 0x6D, 0x61, 0x67, 0x65, 0x2D, 0x6D, 0x61, 0x67, 0x69,
+    0x63, 0xDA, 0x85, 0x3E, 0xDA, 0x85, 0x3C, 0xDA, 0x82, 0xAB,
+    0xCF, 0x0B, 0x62, 0x61, 0x64, 0x2D, 0x63, 0x6F, 0x6D, 0x70,
+    0x69, 0x6C, 0x65, 0xDA, 0x82, 0x11, 0xDA, 0x82, 0x0D, 0xD7,
+    0xCD, 0x02, 0x99, 0x00, 0x00, 0x0D, 0x01, 0x01, 0xCD, 0x7F,
+    0xFF, 0xFF, 0xFF, 0x03, 0x19, 0xCE, 0x09, 0x77, 0x69, 0x74,
+    0x68, 0x2D, 0x73, 0x79, 0x6D, 0x73, 0xDA, 0x12, 0xDA, 0x55,
+    0xDA, 0x81, 0x1B, 0xDA, 0x81, 0xA0, 0x28, 0x02, 0x00, 0x00,
+    0x25, 0x03, 0x00, 0x00, 0x39, 0x04, 0x00, 0x00, 0x17, 0x05,
+    0x04, 0x00, 0x3A, 0x06, 0x00, 0x00, 0x17, 0x07, 0x06, 0x00,
+    0x41, 0x08, 0x03, 0x05, 0x1A, 0x08, 0x0B, 0x00, 0x34, 0x09,
+    0x00, 0x03, 0x26, 0x0A, 0x00, 0x00, 0x2B, 0x0A, 0x00, 0x00,
+    0x3F, 0x0A, 0x00, 0x00, 0x2D, 0x07, 0x09, 0x0A, 0x26, 0x0C,
+    0x01, 0x00, 0x2F, 0x0B, 0x0C, 0x00, 0x25, 0x09, 0x01, 0x00,
+    0x06, 0x03, 0x03, 0x09, 0x18, 0xF5, 0xFF, 0xFF, 0x2E, 0x07,
+    0x00, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x26, 0x0A, 0x02, 0x00,
+    0x2C, 0x0A, 0x08, 0x00, 0x2E, 0x01, 0x00, 0x00, 0x3F, 0x09,
+    0x00, 0x00, 0x03, 0x09, 0x00, 0x00, 0x28, 0x01, 0x9C, 0x04,
+    0x02, 0x01, 0x06, 0x04, 0x01, 0x02, 0x12, 0x01, 0x00, 0x11,
+    0x02, 0x02, 0x00, 0x01, 0x02, 0x0E, 0x01, 0x00, 0x0D, 0x01,
+    0x02, 0x28, 0x03, 0x00, 0x18, 0x03, 0x00, 0x3B, 0x02, 0x02,
+    0x00, 0x01, 0x03, 0x03, 0x07, 0x06, 0x00, 0xCF, 0x09, 0x77,
+    0x69, 0x74, 0x68, 0x2D, 0x73, 0x79, 0x6D, 0x73, 0xD8, 0x07,
+    0x6F, 0x73, 0x2F, 0x61, 0x72, 0x63, 0x68, 0xCF, 0x07, 0x6F,
+    0x73, 0x2F, 0x61, 0x72, 0x63, 0x68, 0xDA, 0x80, 0x94, 0xDA,
+    0x80, 0x92, 0xDA, 0x7D, 0xDA, 0x79, 0xD8, 0x08, 0x6F, 0x73,
+    0x2F, 0x77, 0x68, 0x69, 0x63, 0x68, 0xCF, 0x08, 0x6F, 0x73,
+    0x2F, 0x77, 0x68, 0x69, 0x63, 0x68, 0xDA, 0x80, 0xB5, 0xCF,
+    0x09, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77,
+    0xD8, 0x0D, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0xCF, 0x0D, 0x74, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x2F, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0xD7, 0xCD, 0x02, 0x99, 0x00, 0x00, 0x16, 0x01, 0x01, 0xCD,
+    0x7F, 0xFF, 0xFF, 0xFF, 0x12, 0x69, 0xCE, 0x05, 0x76, 0x61,
+    0x72, 0x66, 0x6E, 0xDA, 0x12, 0xDA, 0x81, 0x5C, 0xDA, 0x80,
+    0xBD, 0xDA, 0x80, 0xA1, 0xDA, 0x80, 0xE0, 0xDA, 0x83, 0x6D,
+    0xDA, 0x05, 0xCE, 0x11, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69,
+    0x64, 0x20, 0x6D, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61,
+    0x20, 0xDA, 0x81, 0x5A, 0xDA, 0x55, 0xDA, 0x81, 0xEF, 0xDA,
+    0x80, 0x94, 0xDA, 0x83, 0x83, 0xDA, 0x82, 0x0D, 0xDA, 0x56,
+    0xDA, 0x83, 0x29, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x10,
+    0x03, 0x03, 0x03, 0x02, 0x28, 0xCE, 0x06, 0x70, 0x75, 0x74,
+    0x2D, 0x69, 0x6E, 0xDA, 0x12, 0xDA, 0x82, 0x2A, 0xDA, 0x82,
+    0x08, 0x28, 0x03, 0x00, 0x00, 0x17, 0x04, 0x00, 0x00, 0x39,
+    0x05, 0x01, 0x00, 0x25, 0x07, 0x01, 0x00, 0x07, 0x06, 0x05,
+    0x07, 0x17, 0x05, 0x06, 0x00, 0x25, 0x08, 0x00, 0x00, 0x41,
+    0x07, 0x05, 0x08, 0x1A, 0x07, 0x04, 0x00, 0x26, 0x08, 0x00,
+    0x00, 0x01, 0x08, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x25,
+    0x07, 0x00, 0x00, 0x17, 0x08, 0x05, 0x00, 0x41, 0x09, 0x07,
+    0x08, 0x1A, 0x09, 0x13, 0x00, 0x17, 0x0A, 0x07, 0x00, 0x35,
+    0x0B, 0x01, 0x0A, 0x17, 0x0C, 0x0B, 0x00, 0x35, 0x0B, 0x04,
+    0x0C, 0x17, 0x0D, 0x0B, 0x00, 0x22, 0x0E, 0x00, 0x00, 0x1F,
+    0x0B, 0x0E, 0x0D, 0x1A, 0x0B, 0x07, 0x00, 0x26, 0x0F, 0x01,
+    0x00, 0x2F, 0x0E, 0x0F, 0x00, 0x17, 0x0F, 0x0E, 0x00, 0x36,
+    0x04, 0x0C, 0x0F, 0x17, 0x04, 0x0F, 0x00, 0x18, 0x02, 0x00,
+    0x00, 0x17, 0x04, 0x0D, 0x00, 0x25, 0x0B, 0x01, 0x00, 0x06,
+    0x07, 0x07, 0x0B, 0x18, 0xED, 0xFF, 0xFF, 0x35, 0x07, 0x01,
+    0x05, 0x17, 0x08, 0x07, 0x00, 0x35, 0x09, 0x04, 0x08, 0x17,
+    0x0A, 0x09, 0x00, 0x36, 0x04, 0x08, 0x02, 0x03, 0x00, 0x00,
+    0x00, 0x58, 0x01, 0xA4, 0x10, 0x02, 0x01, 0x0C, 0x04, 0x01,
+    0x02, 0x1C, 0x02, 0x00, 0x05, 0x01, 0x00, 0x15, 0x02, 0x02,
+    0x08, 0x01, 0x00, 0x07, 0x02, 0x00, 0x20, 0x01, 0x00, 0x1F,
+    0x05, 0x02, 0x00, 0x01, 0x02, 0x12, 0x01, 0x00, 0x0D, 0x01,
+    0x02, 0x0E, 0x01, 0x00, 0x0D, 0x02, 0x02, 0x08, 0x01, 0x00,
+    0x07, 0x02, 0x02, 0x1A, 0x01, 0x00, 0x15, 0x01, 0x02, 0x04,
+    0x01, 0x02, 0x00, 0x01, 0x05, 0x07, 0x01, 0x08, 0x04, 0x03,
+    0x0D, 0x07, 0x01, 0x10, 0x1C, 0x01, 0x00, 0x1B, 0x01, 0x02,
+    0x1C, 0x01, 0x00, 0x1B, 0x01, 0x02, 0x00, 0x01, 0x25, 0x03,
+    0xDA, 0x83, 0x85, 0xDA, 0x81, 0xA0, 0x28, 0x02, 0x00, 0x00,
+    0x2B, 0x00, 0x00, 0x00, 0x2E, 0x01, 0x00, 0x00, 0x26, 0x04,
+    0x00, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x17, 0x04, 0x03, 0x00,
+    0x2B, 0x04, 0x00, 0x00, 0x26, 0x06, 0x01, 0x00, 0x2F, 0x05,
+    0x06, 0x00, 0x17, 0x06, 0x05, 0x00, 0x25, 0x07, 0x02, 0x00,
+    0x25, 0x08, 0xFE, 0xFF, 0x2D, 0x04, 0x07, 0x08, 0x26, 0x08,
+    0x02, 0x00, 0x2F, 0x07, 0x08, 0x00, 0x17, 0x08, 0x07, 0x00,
+    0x3E, 0x09, 0x00, 0x00, 0x17, 0x0A, 0x09, 0x00, 0x25, 0x0B,
+    0x00, 0x00, 0x39, 0x0C, 0x08, 0x00, 0x17, 0x0D, 0x0C, 0x00,
+    0x41, 0x0C, 0x0B, 0x0D, 0x1A, 0x0C, 0x19, 0x00, 0x34, 0x0E,
+    0x08, 0x0B, 0x17, 0x0F, 0x0E, 0x00, 0x2B, 0x0F, 0x00, 0x00,
+    0x26, 0x10, 0x03, 0x00, 0x2F, 0x0E, 0x10, 0x00, 0x1A, 0x0E,
+    0x04, 0x00, 0x23, 0x10, 0x00, 0x00, 0x36, 0x0A, 0x0F, 0x10,
+    0x18, 0x0D, 0x00, 0x00, 0x2B, 0x0F, 0x00, 0x00, 0x26, 0x11,
+    0x04, 0x00, 0x2F, 0x10, 0x11, 0x00, 0x1A, 0x10, 0x04, 0x00,
+    0x26, 0x11, 0x05, 0x00, 0x36, 0x0A, 0x11, 0x0F, 0x18, 0x06,
+    0x00, 0x00, 0x26, 0x11, 0x06, 0x00, 0x2C, 0x11, 0x0F, 0x00,
+    0x26, 0x12, 0x07, 0x00, 0x2F, 0x11, 0x12, 0x00, 0x01, 0x11,
+    0x00, 0x00, 0x25, 0x0E, 0x01, 0x00, 0x06, 0x0B, 0x0B, 0x0E,
+    0x18, 0xE7, 0xFF, 0xFF, 0x26, 0x0C, 0x08, 0x00, 0x2F, 0x0B,
+    0x0C, 0x00, 0x17, 0x0C, 0x0B, 0x00, 0x26, 0x0D, 0x08, 0x00,
+    0x2F, 0x0B, 0x0D, 0x00, 0x17, 0x0D, 0x0B, 0x00, 0x26, 0x0E,
+    0x08, 0x00, 0x2F, 0x0B, 0x0E, 0x00, 0x17, 0x0E, 0x0B, 0x00,
+    0x26, 0x0F, 0x09, 0x00, 0x2C, 0x0F, 0x00, 0x00, 0x3F, 0x0B,
+    0x00, 0x00, 0x26, 0x10, 0x0A, 0x00, 0x2C, 0x10, 0x0B, 0x00,
+    0x3F, 0x0F, 0x00, 0x00, 0x2C, 0x0D, 0x0F, 0x00, 0x40, 0x0B,
+    0x00, 0x00, 0x22, 0x10, 0x00, 0x00, 0x2B, 0x10, 0x00, 0x00,
+    0x3A, 0x0F, 0x00, 0x00, 0x26, 0x11, 0x0B, 0x00, 0x2C, 0x11,
+    0x0F, 0x00, 0x3E, 0x10, 0x00, 0x00, 0x26, 0x11, 0x0C, 0x00,
+    0x2D, 0x11, 0x0D, 0x10, 0x3F, 0x0F, 0x00, 0x00, 0x26, 0x11,
+    0x0D, 0x00, 0x2D, 0x11, 0x0C, 0x0F, 0x3F, 0x10, 0x00, 0x00,
+    0x26, 0x11, 0x09, 0x00, 0x2C, 0x11, 0x00, 0x00, 0x3F, 0x0F,
+    0x00, 0x00, 0x26, 0x12, 0x0E, 0x00, 0x2D, 0x12, 0x0F, 0x0C,
+    0x3F, 0x11, 0x00, 0x00, 0x26, 0x12, 0x0D, 0x00, 0x2D, 0x12,
+    0x0E, 0x06, 0x3F, 0x0F, 0x00, 0x00, 0x26, 0x13, 0x0B, 0x00,
+    0x25, 0x14, 0x00, 0x00, 0x2C, 0x13, 0x14, 0x00, 0x40, 0x12,
+    0x00, 0x00, 0x26, 0x14, 0x0F, 0x00, 0x2D, 0x14, 0x0C, 0x12,
+    0x2B, 0x0E, 0x00, 0x00, 0x3F, 0x13, 0x00, 0x00, 0x26, 0x14,
+    0x09, 0x00, 0x2C, 0x14, 0x0A, 0x00, 0x3F, 0x12, 0x00, 0x00,
+    0x26, 0x15, 0x10, 0x00, 0x2D, 0x15, 0x0C, 0x12, 0x3F, 0x14,
+    0x00, 0x00, 0x26, 0x15, 0x11, 0x00, 0x2D, 0x15, 0x0B, 0x10,
+    0x2D, 0x11, 0x0F, 0x13, 0x2C, 0x14, 0x0E, 0x00, 0x3F, 0x12,
+    0x00, 0x00, 0x03, 0x12, 0x00, 0x00, 0x43, 0x01, 0xEC, 0x17,
+    0x02, 0x04, 0x0C, 0x22, 0x01, 0x00, 0x1D, 0x03, 0x02, 0x16,
+    0x01, 0x00, 0x15, 0x05, 0x02, 0x1E, 0x01, 0x00, 0x1D, 0x02,
+    0x02, 0x00, 0x07, 0x02, 0x00, 0x03, 0x04, 0x08, 0x01, 0x01,
+    0x03, 0x02, 0x02, 0x1E, 0x01, 0x01, 0x1D, 0x03, 0x04, 0x04,
+    0x01, 0x03, 0x03, 0x02, 0x04, 0x1C, 0x01, 0x03, 0x1B, 0x04,
+    0x06, 0x12, 0x01, 0x00, 0x0D, 0x03, 0x07, 0x07, 0x09, 0x0A,
+    0x00, 0x31, 0x02, 0x04, 0xCF, 0x05, 0x76, 0x61, 0x72, 0x66,
+    0x6E, 0xDA, 0x84, 0xDC, 0xDA, 0x84, 0xD8, 0xD8, 0x05, 0x74,
+    0x72, 0x61, 0x63, 0x65, 0xCF, 0x05, 0x74, 0x72, 0x61, 0x63,
+    0x65, 0xDA, 0x83, 0x26, 0xDA, 0x83, 0x16, 0xDA, 0x84, 0xD2,
+    0xDA, 0x84, 0xD0, 0xDA, 0x83, 0x29, 0xDA, 0x82, 0x75, 0xDA,
+    0x84, 0xDB, 0xDA, 0x85, 0x53, 0xDA, 0x81, 0x18, 0xDA, 0x81,
+    0x79, 0xDA, 0x83, 0x6E, 0xDA, 0x83, 0xFB, 0xDA, 0x85, 0x02,
+    0xDA, 0x85, 0x00, 0xDA, 0x84, 0xF7, 0xDA, 0x84, 0xF6, 0xDA,
+    0x28, 0xDA, 0x26, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x05,
+    0x01, 0x00, 0x01, 0x02, 0x08, 0xCE, 0x03, 0x64, 0x6F, 0x63,
+    0xDA, 0x12, 0xDA, 0x81, 0xEF, 0xDA, 0x85, 0x74, 0x28, 0x01,
+    0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2C, 0x03, 0x00, 0x00,
+    0x3F, 0x02, 0x00, 0x00, 0x26, 0x04, 0x01, 0x00, 0x2C, 0x04,
+    0x02, 0x00, 0x3F, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,
+    0x07, 0x01, 0xD0, 0x15, 0x02, 0x07, 0x06, 0x04, 0xCF, 0x03,
+    0x64, 0x6F, 0x63, 0xDA, 0x82, 0x6F, 0xDA, 0x82, 0x6C, 0xDA,
+    0x84, 0x35, 0xDA, 0x85, 0x4E, 0xDA, 0x80, 0xAE, 0xDA, 0x80,
+    0xAC, 0xDA, 0x84, 0xF4, 0xDA, 0x84, 0xF3, 0xDA, 0x81, 0x96,
+    0xDA, 0x81, 0x92, 0xDA, 0x83, 0x06, 0xDA, 0x85, 0x06, 0xDA,
+    0x83, 0x34, 0xDA, 0x83, 0xB7, 0xDA, 0x83, 0x73, 0xDA, 0x85,
+    0x4F, 0xDA, 0x80, 0xFF, 0xDA, 0x80, 0xF2, 0xD8, 0x09, 0x67,
+    0x63, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0xCF, 0x09,
+    0x67, 0x63, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0xD7,
+    0xCD, 0x02, 0x98, 0x00, 0x00, 0x05, 0x02, 0x02, 0x02, 0x02,
+    0x07, 0xCE, 0x06, 0x73, 0x6F, 0x72, 0x74, 0x65, 0x64, 0xDA,
+    0x12, 0xDA, 0x80, 0x9F, 0xDA, 0x85, 0x32, 0x28, 0x02, 0x00,
+    0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F,
+    0x03, 0x04, 0x00, 0x2C, 0x03, 0x01, 0x00, 0x26, 0x04, 0x01,
+    0x00, 0x30, 0x04, 0x00, 0x00, 0x0A, 0x01, 0x8C, 0x0A, 0x02,
+    0x03, 0x06, 0x10, 0x03, 0x00, 0x0B, 0xCF, 0x06, 0x73, 0x6F,
+    0x72, 0x74, 0x65, 0x64, 0xD7, 0xCD, 0x02, 0x99, 0x00, 0x00,
+    0x08, 0x03, 0x03, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x03, 0x09,
+    0xCE, 0x03, 0x66, 0x6F, 0x72, 0xDA, 0x12, 0xDA, 0x81, 0x2D,
+    0xDA, 0x21, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x11, 0x07,
+    0x07, 0x07, 0x06, 0x21, 0xCE, 0x0C, 0x66, 0x6F, 0x72, 0x2D,
+    0x74, 0x65, 0x6D, 0x70, 0x6C, 0x61, 0x74, 0x65, 0xDA, 0x12,
+    0xDA, 0x55, 0xDA, 0x81, 0xEE, 0xDA, 0x56, 0xDA, 0x22, 0xDA,
+    0x81, 0xF3, 0xDA, 0x59, 0x28, 0x07, 0x00, 0x00, 0x26, 0x09,
+    0x00, 0x00, 0x2F, 0x08, 0x09, 0x00, 0x17, 0x09, 0x08, 0x00,
+    0x26, 0x0A, 0x00, 0x00, 0x2F, 0x08, 0x0A, 0x00, 0x17, 0x0A,
+    0x08, 0x00, 0x26, 0x0B, 0x01, 0x00, 0x2D, 0x0B, 0x09, 0x01,
+    0x3F, 0x08, 0x00, 0x00, 0x26, 0x0C, 0x02, 0x00, 0x2D, 0x0C,
+    0x0A, 0x02, 0x3F, 0x0B, 0x00, 0x00, 0x2D, 0x04, 0x09, 0x0A,
+    0x3F, 0x0C, 0x00, 0x00, 0x26, 0x0E, 0x02, 0x00, 0x2D, 0x0E,
+    0x00, 0x09, 0x3F, 0x0D, 0x00, 0x00, 0x2D, 0x05, 0x09, 0x03,
+    0x3F, 0x0E, 0x00, 0x00, 0x26, 0x10, 0x03, 0x00, 0x2D, 0x10,
+    0x09, 0x0E, 0x3F, 0x0F, 0x00, 0x00, 0x26, 0x10, 0x04, 0x00,
+    0x2D, 0x10, 0x0C, 0x0D, 0x2E, 0x06, 0x00, 0x00, 0x2B, 0x0F,
+    0x00, 0x00, 0x3F, 0x0E, 0x00, 0x00, 0x26, 0x0D, 0x05, 0x00,
+    0x2D, 0x0D, 0x08, 0x0B, 0x2B, 0x0E, 0x00, 0x00, 0x3F, 0x0C,
+    0x00, 0x00, 0x03, 0x0C, 0x00, 0x00, 0x0A, 0x01, 0xD0, 0x04,
+    0x02, 0x06, 0x04, 0x04, 0x1A, 0x02, 0x04, 0x28, 0x04, 0x00,
+    0x00, 0x2D, 0x00, 0x01, 0x02, 0x25, 0x05, 0x01, 0x00, 0x26,
+    0x06, 0x00, 0x00, 0x26, 0x07, 0x01, 0x00, 0x2D, 0x05, 0x06,
+    0x07, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x05, 0x02, 0x00, 0x30,
+    0x05, 0x00, 0x00, 0x07, 0x01, 0xD0, 0x06, 0x02, 0x08, 0x06,
+    0x04, 0xCF, 0x03, 0x66, 0x6F, 0x72, 0xD8, 0x05, 0x73, 0x6C,
+    0x69, 0x63, 0x65, 0xCF, 0x05, 0x73, 0x6C, 0x69, 0x63, 0x65,
+    0xD7, 0xCD, 0x02, 0xBB, 0x00, 0x00, 0x11, 0x00, 0x00, 0xCD,
+    0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0x36, 0x04, 0xCE, 0x04, 0x63,
+    0x6F, 0x6D, 0x70, 0xDA, 0x12, 0xD5, 0x05, 0x04, 0x04, 0x03,
+    0x03, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0xDA, 0x80, 0xA1,
+    0x28, 0x01, 0x00, 0x00, 0x39, 0x02, 0x00, 0x00, 0x17, 0x03,
+    0x02, 0x00, 0x47, 0x03, 0x00, 0x00, 0x18, 0x16, 0x00, 0x00,
+    0x18, 0x16, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x1D,
+    0x00, 0x00, 0x18, 0x24, 0x00, 0x00, 0x37, 0x02, 0x00, 0x00,
+    0x17, 0x04, 0x02, 0x00, 0x37, 0x02, 0x00, 0x01, 0x17, 0x05,
+    0x02, 0x00, 0x37, 0x02, 0x00, 0x02, 0x17, 0x06, 0x02, 0x00,
+    0x37, 0x02, 0x00, 0x03, 0x17, 0x07, 0x02, 0x00, 0x2A, 0x02,
+    0x00, 0x00, 0x25, 0x08, 0x04, 0x00, 0x25, 0x09, 0xFF, 0xFF,
+    0x2D, 0x00, 0x08, 0x09, 0x26, 0x09, 0x01, 0x00, 0x2F, 0x08,
+    0x09, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x2E, 0x08, 0x00, 0x00,
+    0x30, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x25, 0x08,
+    0x00, 0x00, 0x34, 0x02, 0x00, 0x08, 0x03, 0x02, 0x00, 0x00,
+    0x37, 0x02, 0x00, 0x00, 0x17, 0x08, 0x02, 0x00, 0x37, 0x02,
+    0x00, 0x01, 0x17, 0x09, 0x02, 0x00, 0x2A, 0x02, 0x01, 0x00,
+    0x03, 0x02, 0x00, 0x00, 0x37, 0x02, 0x00, 0x00, 0x17, 0x0A,
+    0x02, 0x00, 0x37, 0x02, 0x00, 0x01, 0x17, 0x0B, 0x02, 0x00,
+    0x37, 0x02, 0x00, 0x02, 0x17, 0x0C, 0x02, 0x00, 0x2A, 0x02,
+    0x02, 0x00, 0x03, 0x02, 0x00, 0x00, 0x37, 0x02, 0x00, 0x00,
+    0x17, 0x0D, 0x02, 0x00, 0x37, 0x02, 0x00, 0x01, 0x17, 0x0E,
+    0x02, 0x00, 0x37, 0x02, 0x00, 0x02, 0x17, 0x0F, 0x02, 0x00,
+    0x37, 0x02, 0x00, 0x03, 0x17, 0x10, 0x02, 0x00, 0x2A, 0x02,
+    0x03, 0x00, 0x03, 0x02, 0x00, 0x00, 0xCD, 0x02, 0xD0, 0x00,
+    0x00, 0x04, 0x01, 0x01, 0x01, 0x00, 0x0C, 0x01, 0xDA, 0x12,
+    0x2B, 0x00, 0x00, 0x00, 0x27, 0x02, 0x00, 0x07, 0x2F, 0x01,
+    0x02, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x27, 0x03, 0x00, 0x06,
+    0x2F, 0x02, 0x03, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x27, 0x03,
+    0x00, 0x05, 0x2F, 0x01, 0x03, 0x00, 0x2B, 0x01, 0x00, 0x00,
+    0x27, 0x02, 0x00, 0x04, 0x30, 0x02, 0x00, 0x00, 0xBF, 0xFF,
+    0x0D, 0x03, 0xE0, 0x08, 0x3C, 0x03, 0x00, 0x05, 0x03, 0x00,
+    0x05, 0x03, 0x00, 0x05, 0xCD, 0x02, 0xD1, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x01,
+    0xDA, 0x12, 0x2E, 0x00, 0x00, 0x00, 0x27, 0x02, 0x00, 0x09,
+    0x2F, 0x01, 0x02, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x27, 0x02,
+    0x00, 0x08, 0x30, 0x02, 0x00, 0x00, 0xBF, 0xFF, 0x07, 0x03,
+    0xD8, 0x08, 0x62, 0x03, 0x00, 0x05, 0xCD, 0x02, 0xD1, 0x00,
+    0x00, 0x04, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
+    0x09, 0x01, 0xDA, 0x12, 0x2E, 0x00, 0x00, 0x00, 0x27, 0x02,
+    0x00, 0x0C, 0x2F, 0x01, 0x02, 0x00, 0x2B, 0x01, 0x00, 0x00,
+    0x27, 0x03, 0x00, 0x0B, 0x2F, 0x02, 0x03, 0x00, 0x2B, 0x02,
+    0x00, 0x00, 0x27, 0x01, 0x00, 0x0A, 0x30, 0x01, 0x00, 0x00,
+    0xBF, 0xFF, 0x0A, 0x03, 0xDA, 0x08, 0x68, 0x03, 0x00, 0x05,
+    0x03, 0x00, 0x05, 0xCD, 0x02, 0xD1, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x0C, 0x01, 0xDA,
+    0x12, 0x2E, 0x00, 0x00, 0x00, 0x27, 0x02, 0x00, 0x10, 0x2F,
+    0x01, 0x02, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x27, 0x03, 0x00,
+    0x0F, 0x2F, 0x02, 0x03, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x27,
+    0x03, 0x00, 0x0E, 0x2F, 0x01, 0x03, 0x00, 0x2B, 0x01, 0x00,
+    0x00, 0x27, 0x02, 0x00, 0x0D, 0x30, 0x02, 0x00, 0x00, 0xBF,
+    0xFF, 0x0D, 0x03, 0xDC, 0x08, 0x6E, 0x03, 0x00, 0x05, 0x03,
+    0x00, 0x05, 0x03, 0x00, 0x05, 0x2E, 0x01, 0xCA, 0x08, 0x02,
+    0x01, 0x08, 0x10, 0x07, 0x00, 0x0B, 0x08, 0x0C, 0x04, 0x01,
+    0x02, 0x10, 0x05, 0x02, 0x00, 0x03, 0x01, 0x0B, 0x01, 0x0D,
+    0x07, 0x03, 0x04, 0x08, 0x04, 0x02, 0x00, 0x02, 0x00, 0x3A,
+    0x06, 0x02, 0x39, 0x02, 0x00, 0x3A, 0x08, 0x02, 0x39, 0x02,
+    0x00, 0x3A, 0xCF, 0x04, 0x63, 0x6F, 0x6D, 0x70, 0xDA, 0x83,
+    0x9D, 0xDA, 0x83, 0x9B, 0xDA, 0x84, 0xEF, 0xDA, 0x84, 0xEE,
+    0xDA, 0x82, 0xC4, 0xDA, 0x85, 0x07, 0xDA, 0x81, 0xF1, 0xDA,
+    0x85, 0x98, 0xDA, 0x81, 0x2F, 0xCF, 0x07, 0x65, 0x78, 0x74,
+    0x72, 0x65, 0x6D, 0x65, 0xDA, 0x83, 0x6D, 0xCF, 0x07, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x3F, 0xD7, 0xCD, 0x02, 0x98,
+    0x00, 0x00, 0x05, 0x01, 0x01, 0x01, 0x02, 0x07, 0xCE, 0x07,
+    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x3F, 0xDA, 0x12, 0xDA,
+    0x15, 0xDA, 0x4E, 0x28, 0x01, 0x00, 0x00, 0x2B, 0x00, 0x00,
+    0x00, 0x26, 0x03, 0x00, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x26,
+    0x04, 0x01, 0x00, 0x1F, 0x03, 0x02, 0x04, 0x03, 0x03, 0x00,
+    0x00, 0x0A, 0x01, 0xBA, 0x01, 0x02, 0x03, 0x00, 0x58, 0x03,
+    0x00, 0x05, 0xCF, 0x07, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+    0x3F, 0xDA, 0x83, 0x5B, 0xCF, 0x12, 0x6D, 0x6F, 0x64, 0x75,
+    0x6C, 0x65, 0x2F, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x2D,
+    0x70, 0x61, 0x74, 0x68, 0xDA, 0x82, 0x45, 0xCF, 0x03, 0x6D,
+    0x61, 0x78, 0xDA, 0x82, 0x79, 0xDA, 0x82, 0x71, 0xDA, 0x82,
+    0xFE, 0xDA, 0x82, 0xFB, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00,
+    0x07, 0x02, 0x02, 0x02, 0x01, 0x0B, 0xCE, 0x04, 0x66, 0x69,
+    0x6E, 0x64, 0xDA, 0x12, 0xDA, 0x81, 0xCF, 0x28, 0x02, 0x00,
+    0x00, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F,
+    0x03, 0x04, 0x00, 0x17, 0x04, 0x03, 0x00, 0x22, 0x06, 0x00,
+    0x00, 0x1F, 0x05, 0x04, 0x06, 0x1A, 0x05, 0x02, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x34, 0x06, 0x01, 0x04, 0x03, 0x06, 0x00,
+    0x00, 0x13, 0x01, 0xEA, 0x0B, 0x02, 0x03, 0x0A, 0x12, 0x01,
+    0x00, 0x0D, 0x02, 0x02, 0x08, 0x02, 0x00, 0x07, 0x02, 0x00,
+    0x24, 0xCF, 0x04, 0x66, 0x69, 0x6E, 0x64, 0xDA, 0x57, 0xDA,
+    0x83, 0x04, 0xDA, 0x84, 0xF9, 0xDA, 0x84, 0xF8, 0xDA, 0x5A,
+    0xDA, 0x41, 0xD8, 0x11, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2F, 0x63, 0x6F, 0x70, 0x79, 0x2D, 0x62, 0x79, 0x74, 0x65,
+    0x73, 0xCF, 0x11, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+    0x63, 0x6F, 0x70, 0x79, 0x2D, 0x62, 0x79, 0x74, 0x65, 0x73,
+    0xDA, 0x82, 0xF1, 0xDA, 0x82, 0xEE, 0xDA, 0x81, 0x8C, 0xDA,
+    0x81, 0x88, 0xD7, 0xCD, 0x00, 0x08, 0x00, 0x13, 0x01, 0x01,
+    0x01, 0x01, 0x00, 0x02, 0xCE, 0x04, 0x62, 0x6E, 0x6F, 0x74,
+    0x0F, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xCF, 0x04,
+    0x62, 0x6E, 0x6F, 0x74, 0xDA, 0x84, 0xC8, 0xDA, 0x84, 0xC7,
+    0xDA, 0x85, 0x40, 0xDA, 0x85, 0x3F, 0xDA, 0x80, 0xCE, 0xDA,
+    0x80, 0xC9, 0xDA, 0x85, 0x32, 0xDA, 0x85, 0x30, 0xDA, 0x84,
+    0xA5, 0xCF, 0x0F, 0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x69, 0x6D,
+    0x61, 0x67, 0x65, 0x2D, 0x64, 0x69, 0x63, 0x74, 0xDA, 0x84,
+    0xAE, 0xDA, 0x84, 0xAC, 0xD8, 0x0B, 0x6D, 0x61, 0x74, 0x68,
+    0x2F, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0xCF, 0x0B, 0x6D,
+    0x61, 0x74, 0x68, 0x2F, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D,
+    0xDA, 0x81, 0x9A, 0xDA, 0x81, 0x98, 0xDA, 0x82, 0x3C, 0xDA,
+    0x82, 0x3A, 0xDA, 0x82, 0x66, 0xDA, 0x82, 0x64, 0xDA, 0x85,
+    0x79, 0xDA, 0x85, 0x78, 0xDA, 0x84, 0xE5, 0xDA, 0x84, 0xE3,
+    0xDA, 0x82, 0x2B, 0xDA, 0x82, 0x26, 0xDA, 0x33, 0xDA, 0x2E,
+    0xDA, 0x80, 0xDA, 0xDA, 0x80, 0xD8, 0xDA, 0x84, 0x3B, 0xCF,
+    0x0B, 0x73, 0x63, 0x61, 0x6E, 0x2D, 0x6E, 0x75, 0x6D, 0x62,
+    0x65, 0x72, 0xDA, 0x81, 0x4B, 0xDA, 0x81, 0x48, 0xD8, 0x0D,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65, 0x70,
+    0x65, 0x61, 0x74, 0xCF, 0x0D, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x2F, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0xDA, 0x83,
+    0x25, 0xCF, 0x06, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0xD8,
+    0x0E, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6D, 0x61, 0x78,
+    0x73, 0x74, 0x61, 0x63, 0x6B, 0xCF, 0x0E, 0x66, 0x69, 0x62,
+    0x65, 0x72, 0x2F, 0x6D, 0x61, 0x78, 0x73, 0x74, 0x61, 0x63,
+    0x6B, 0xDA, 0x85, 0x94, 0xDA, 0x85, 0x93, 0xDA, 0x85, 0x92,
+    0xDA, 0x85, 0x8D, 0xDA, 0x81, 0x09, 0xDA, 0x81, 0x05, 0xDA,
+    0x82, 0x7D, 0xDA, 0x82, 0x7B, 0xDA, 0x81, 0xD1, 0xDA, 0x84,
+    0xCD, 0xDA, 0x84, 0xC6, 0xDA, 0x84, 0xC5, 0xDA, 0x00, 0xCF,
+    0x08, 0x72, 0x6F, 0x6F, 0x74, 0x2D, 0x65, 0x6E, 0x76, 0xDA,
+    0x85, 0x52, 0xDA, 0x85, 0x51, 0xDA, 0x85, 0xE0, 0xCF, 0x0C,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x73, 0x74, 0x61,
+    0x74, 0x65, 0xDA, 0x81, 0x74, 0xDA, 0x82, 0x50, 0xDA, 0x80,
+    0xE0, 0xDA, 0x80, 0xDC, 0xDA, 0x81, 0x90, 0xDA, 0x81, 0x8E,
+    0xDA, 0x82, 0x18, 0xDA, 0x82, 0x16, 0xDA, 0x82, 0x8E, 0xDA,
+    0x82, 0x8A, 0xD8, 0x0E, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F,
+    0x75, 0x6E, 0x66, 0x62, 0x72, 0x65, 0x61, 0x6B, 0xCF, 0x0E,
+    0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x75, 0x6E, 0x66, 0x62,
+    0x72, 0x65, 0x61, 0x6B, 0xDA, 0x84, 0xE8, 0xDA, 0x84, 0xE7,
+    0xDA, 0x80, 0xEC, 0xDA, 0x80, 0xE8, 0xDA, 0x83, 0x08, 0xDA,
+    0x83, 0x00, 0xDA, 0x81, 0xCD, 0xDA, 0x82, 0xDB, 0xDA, 0x83,
+    0x64, 0xCF, 0x06, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0xDA,
+    0x82, 0xBE, 0xCF, 0x0C, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F,
+    0x73, 0x65, 0x74, 0x65, 0x6E, 0x76, 0xDA, 0x85, 0x25, 0xDA,
+    0x85, 0x24, 0xC8, 0x69, 0x57, 0x14, 0x8B, 0x0A, 0xBF, 0x05,
+    0x40, 0xCF, 0x06, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x65, 0xDA,
+    0x1A, 0xDA, 0x0F, 0xDA, 0x84, 0x04, 0xDA, 0x84, 0x02, 0xDA,
+    0x82, 0x4E, 0xDA, 0x82, 0x4C, 0xDA, 0x85, 0x68, 0xCF, 0x08,
+    0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0xDA, 0x83,
+    0xF1, 0xDA, 0x83, 0xEF, 0xDA, 0x84, 0x9A, 0xDA, 0x84, 0xFF,
+    0xDA, 0x84, 0xA8, 0xDA, 0x84, 0x96, 0xDA, 0x81, 0xD2, 0xDA,
+    0x81, 0xC9, 0xDA, 0x82, 0xB6, 0xDA, 0x83, 0xBB, 0xD8, 0x07,
+    0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0xCF, 0x07, 0x6B,
+    0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0xDA, 0x85, 0x67, 0xCF,
+    0x0C, 0x61, 0x6C, 0x6C, 0x2D, 0x64, 0x79, 0x6E, 0x61, 0x6D,
+    0x69, 0x63, 0x73, 0xDA, 0x83, 0x79, 0xDA, 0x84, 0xA9, 0xDA,
+    0x62, 0xDA, 0x60, 0xDA, 0x81, 0xF9, 0xCF, 0x03, 0x6D, 0x61,
+    0x70, 0xDA, 0x83, 0xA9, 0xDA, 0x83, 0xA7, 0xDA, 0x84, 0xAB,
+    0xDA, 0x84, 0xAA, 0xDA, 0x80, 0xA2, 0xDA, 0x80, 0x9A, 0xDA,
+    0x85, 0x81, 0xDA, 0x85, 0x80, 0xDA, 0x85, 0x1F, 0xDA, 0x85,
+    0x1D, 0xDA, 0x81, 0xA6, 0xDA, 0x81, 0xA3, 0xDA, 0x81, 0x5A,
+    0xCF, 0x06, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0xDA, 0x85,
+    0x7E, 0xDA, 0x85, 0x7C, 0xDA, 0x80, 0xF0, 0xDA, 0x80, 0xEE,
+    0xDA, 0x80, 0xFA, 0xCF, 0x12, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0xDA, 0x32, 0xDA, 0x84, 0x59, 0xD8, 0x09,
+    0x67, 0x63, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0xCF,
+    0x09, 0x67, 0x63, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74,
+    0xDA, 0x84, 0xA3, 0xCF, 0x0D, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+    0x2F, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0xDA, 0x55,
+    0xCF, 0x06, 0x67, 0x65, 0x6E, 0x73, 0x79, 0x6D, 0xDA, 0x84,
+    0x24, 0xDA, 0x84, 0x20, 0xDA, 0x81, 0x56, 0xCF, 0x06, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0xDA, 0x80, 0xAA, 0xDA, 0x80,
+    0xA8, 0xDA, 0x81, 0x0D, 0xDA, 0x81, 0x0B, 0xDA, 0x84, 0xCA,
+    0xDA, 0x84, 0xC9, 0xDA, 0x84, 0xF2, 0xDA, 0x84, 0xF0, 0xDA,
+    0x81, 0xAA, 0xDA, 0x81, 0xA8, 0xDA, 0x4B, 0xDA, 0x83, 0xEC,
+    0xDA, 0x80, 0xC7, 0xDA, 0x80, 0xC5, 0xDA, 0x84, 0xCC, 0xDA,
+    0x84, 0xCB, 0xDA, 0x83, 0x67, 0xDA, 0x84, 0x10, 0xDA, 0x83,
+    0xA1, 0xDA, 0x83, 0x9F, 0xDA, 0x84, 0x7D, 0xDA, 0x84, 0x7B,
+    0xDA, 0x81, 0x26, 0xDA, 0x81, 0x24, 0xDA, 0x84, 0xA1, 0xCF,
+    0x0D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x6F,
+    0x72, 0x6D, 0x61, 0x74, 0xDA, 0x83, 0x81, 0xDA, 0x85, 0xD4,
+    0xDA, 0x81, 0x77, 0xCF, 0x08, 0x63, 0x6F, 0x6D, 0x70, 0x74,
+    0x69, 0x6D, 0x65, 0xDA, 0x82, 0xF5, 0xDA, 0x82, 0xF3, 0xDA,
+    0x85, 0x87, 0xDA, 0x85, 0x86, 0xD7, 0xCD, 0x02, 0x98, 0x00,
+    0x00, 0x08, 0x02, 0x02, 0x02, 0x03, 0x0E, 0xCE, 0x09, 0x76,
+    0x61, 0x72, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0xDA, 0x12,
+    0xDA, 0x83, 0x64, 0xDA, 0x83, 0x83, 0xDA, 0x83, 0x29, 0x28,
+    0x02, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x04, 0x00,
+    0x00, 0x2F, 0x03, 0x04, 0x00, 0x17, 0x04, 0x03, 0x00, 0x2B,
+    0x01, 0x00, 0x00, 0x3A, 0x05, 0x00, 0x00, 0x26, 0x06, 0x01,
+    0x00, 0x2C, 0x06, 0x05, 0x00, 0x3E, 0x05, 0x00, 0x00, 0x2C,
+    0x04, 0x05, 0x00, 0x26, 0x07, 0x02, 0x00, 0x2F, 0x06, 0x07,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x01, 0x88, 0x01, 0x02,
+    0x03, 0x06, 0x1A, 0x01, 0x00, 0x15, 0x08, 0x02, 0x00, 0x01,
+    0x07, 0x03, 0xCF, 0x09, 0x76, 0x61, 0x72, 0x67, 0x6C, 0x6F,
+    0x62, 0x61, 0x6C, 0xDA, 0x81, 0xDA, 0xDA, 0x81, 0xD8, 0xDA,
+    0x81, 0xB7, 0xDA, 0x81, 0xB5, 0xDA, 0x81, 0xE2, 0xDA, 0x81,
+    0xE0, 0xDA, 0x80, 0x81, 0xDA, 0x7F, 0xDA, 0x82, 0x38, 0xDA,
+    0x82, 0x36, 0xDA, 0x84, 0x57, 0xDA, 0x84, 0x55, 0xDA, 0x85,
+    0x21, 0xDA, 0x85, 0x20, 0xDA, 0x85, 0x2F, 0xDA, 0x85, 0x29,
+    0xDA, 0x83, 0xD3, 0xDA, 0x83, 0xCB, 0xDA, 0x85, 0x5A, 0xDA,
+    0x85, 0x59, 0xD8, 0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x6C,
+    0x6F, 0x67, 0x31, 0x30, 0xCF, 0x0A, 0x6D, 0x61, 0x74, 0x68,
+    0x2F, 0x6C, 0x6F, 0x67, 0x31, 0x30, 0xDA, 0x85, 0x65, 0xCF,
+    0x0C, 0x61, 0x6C, 0x6C, 0x2D, 0x62, 0x69, 0x6E, 0x64, 0x69,
+    0x6E, 0x67, 0x73, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x06,
+    0x02, 0x02, 0x02, 0x02, 0x08, 0xCE, 0x02, 0x2A, 0x3D, 0xDA,
+    0x12, 0xDA, 0x84, 0x65, 0xDA, 0x22, 0x28, 0x02, 0x00, 0x00,
+    0x26, 0x04, 0x00, 0x00, 0x2D, 0x04, 0x00, 0x01, 0x3F, 0x03,
+    0x00, 0x00, 0x26, 0x05, 0x01, 0x00, 0x2D, 0x05, 0x00, 0x03,
+    0x3F, 0x04, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x07, 0x01,
+    0x84, 0x02, 0x02, 0x07, 0x00, 0x68, 0xCF, 0x02, 0x2A, 0x3D,
+    0xDA, 0x73, 0xDA, 0x71, 0xDA, 0x82, 0xAA, 0xDA, 0x82, 0xCE,
+    0xDA, 0x84, 0x8C, 0xDA, 0x84, 0x89, 0xDA, 0x84, 0xFC, 0xDA,
+    0x84, 0xFA, 0xDA, 0x80, 0xD2, 0xDA, 0x80, 0xD0, 0xD7, 0xCD,
+    0x02, 0x99, 0x00, 0x00, 0x05, 0x02, 0x02, 0xCD, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x01, 0x04, 0xCE, 0x04, 0x65, 0x61, 0x63, 0x68,
+    0xDA, 0x12, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x10, 0x03,
+    0x03, 0x03, 0x0B, 0x42, 0xCE, 0x0D, 0x65, 0x61, 0x63, 0x68,
+    0x2D, 0x74, 0x65, 0x6D, 0x70, 0x6C, 0x61, 0x74, 0x65, 0xDA,
+    0x12, 0xDA, 0x83, 0x26, 0xDA, 0x55, 0xDA, 0x4C, 0xDA, 0x81,
+    0xEE, 0xDA, 0x56, 0xDA, 0x83, 0x25, 0xDA, 0x81, 0x2D, 0xDA,
+    0x64, 0xCF, 0x02, 0x2B, 0x2B, 0xDA, 0x81, 0xF3, 0xDA, 0x59,
+    0x28, 0x03, 0x00, 0x00, 0x2D, 0x00, 0x01, 0x02, 0x26, 0x05,
+    0x00, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x17, 0x05, 0x04, 0x00,
+    0x1A, 0x05, 0x02, 0x00, 0x03, 0x05, 0x00, 0x00, 0x26, 0x06,
+    0x01, 0x00, 0x2F, 0x04, 0x06, 0x00, 0x17, 0x06, 0x04, 0x00,
+    0x26, 0x07, 0x01, 0x00, 0x2F, 0x04, 0x07, 0x00, 0x17, 0x07,
+    0x04, 0x00, 0x2B, 0x01, 0x00, 0x00, 0x26, 0x09, 0x02, 0x00,
+    0x2F, 0x08, 0x09, 0x00, 0x1A, 0x08, 0x03, 0x00, 0x17, 0x04,
+    0x01, 0x00, 0x18, 0x04, 0x00, 0x00, 0x26, 0x0A, 0x01, 0x00,
+    0x2F, 0x09, 0x0A, 0x00, 0x17, 0x04, 0x09, 0x00, 0x17, 0x08,
+    0x04, 0x00, 0x26, 0x09, 0x03, 0x00, 0x25, 0x0A, 0x00, 0x00,
+    0x2D, 0x09, 0x06, 0x0A, 0x3F, 0x04, 0x00, 0x00, 0x1F, 0x0A,
+    0x08, 0x01, 0x1A, 0x0A, 0x03, 0x00, 0x22, 0x09, 0x00, 0x00,
+    0x18, 0x05, 0x00, 0x00, 0x26, 0x0C, 0x04, 0x00, 0x2D, 0x0C,
+    0x08, 0x01, 0x3F, 0x0B, 0x00, 0x00, 0x17, 0x09, 0x0B, 0x00,
+    0x26, 0x0B, 0x05, 0x00, 0x2C, 0x0B, 0x08, 0x00, 0x3F, 0x0A,
+    0x00, 0x00, 0x26, 0x0C, 0x04, 0x00, 0x2D, 0x0C, 0x07, 0x0A,
+    0x3F, 0x0B, 0x00, 0x00, 0x26, 0x0C, 0x06, 0x00, 0x2D, 0x0C,
+    0x06, 0x07, 0x3F, 0x0A, 0x00, 0x00, 0x26, 0x0D, 0x07, 0x00,
+    0x2D, 0x0D, 0x08, 0x06, 0x3F, 0x0C, 0x00, 0x00, 0x26, 0x0E,
+    0x04, 0x00, 0x2D, 0x0E, 0x00, 0x0C, 0x3F, 0x0D, 0x00, 0x00,
+    0x26, 0x0E, 0x08, 0x00, 0x2C, 0x0E, 0x06, 0x00, 0x3F, 0x0C,
+    0x00, 0x00, 0x26, 0x0F, 0x09, 0x00, 0x2D, 0x0F, 0x0A, 0x0D,
+    0x2E, 0x02, 0x00, 0x00, 0x2B, 0x0C, 0x00, 0x00, 0x3F, 0x0E,
+    0x00, 0x00, 0x26, 0x0C, 0x0A, 0x00, 0x2D, 0x0C, 0x04, 0x09,
+    0x2C, 0x0B, 0x0E, 0x00, 0x3F, 0x0A, 0x00, 0x00, 0x17, 0x04,
+    0x0A, 0x00, 0x1A, 0x04, 0x02, 0x00, 0x03, 0x04, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x2E, 0x01, 0xA4, 0x05, 0x02, 0x03,
+    0x06, 0x08, 0x03, 0x01, 0x03, 0x06, 0x04, 0x04, 0x03, 0x02,
+    0x1C, 0x03, 0x00, 0x07, 0x02, 0x00, 0x30, 0x01, 0x00, 0x2F,
+    0x01, 0x00, 0x0F, 0x04, 0x02, 0x00, 0x01, 0x04, 0x18, 0x03,
+    0x03, 0x17, 0x03, 0x04, 0x2C, 0x1C, 0x03, 0x2B, 0x04, 0x07,
+    0x07, 0x28, 0x03, 0x00, 0x00, 0x2D, 0x00, 0x01, 0x02, 0x26,
+    0x04, 0x00, 0x00, 0x30, 0x04, 0x00, 0x00, 0x07, 0x01, 0xDA,
+    0x06, 0x02, 0x03, 0x08, 0x04, 0xCF, 0x04, 0x65, 0x61, 0x63,
+    0x68, 0xD8, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x65, 0x78,
+    0x70, 0xCF, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x65, 0x78,
+    0x70, 0xDA, 0x82, 0xD9, 0xDA, 0x82, 0xD5, 0xD7, 0xCD, 0x02,
+    0x99, 0x00, 0x00, 0x07, 0x01, 0x01, 0xCD, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x06, 0x14, 0xCE, 0x08, 0x67, 0x65, 0x6E, 0x65, 0x72,
+    0x61, 0x74, 0x65, 0xDA, 0x12, 0xDA, 0x59, 0xDA, 0x81, 0xB0,
+    0xDA, 0x83, 0xDE, 0xDA, 0x80, 0x87, 0xDA, 0x86, 0x59, 0xDA,
+    0x80, 0xB6, 0x28, 0x02, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00,
+    0x26, 0x05, 0x00, 0x00, 0x2B, 0x05, 0x00, 0x00, 0x2E, 0x01,
+    0x00, 0x00, 0x3F, 0x04, 0x00, 0x00, 0x26, 0x06, 0x01, 0x00,
+    0x2C, 0x06, 0x04, 0x00, 0x3F, 0x05, 0x00, 0x00, 0x26, 0x06,
+    0x02, 0x00, 0x2D, 0x06, 0x00, 0x05, 0x3F, 0x04, 0x00, 0x00,
+    0x26, 0x06, 0x03, 0x00, 0x2D, 0x06, 0x03, 0x04, 0x3F, 0x05,
+    0x00, 0x00, 0x26, 0x04, 0x04, 0x00, 0x26, 0x06, 0x05, 0x00,
+    0x2D, 0x04, 0x05, 0x06, 0x3F, 0x03, 0x00, 0x00, 0x03, 0x03,
+    0x00, 0x00, 0x07, 0x01, 0xC6, 0x07, 0x02, 0x13, 0x08, 0x04,
+    0xCF, 0x08, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65,
+    0xDA, 0x82, 0xF9, 0xDA, 0x82, 0xF7, 0xD7, 0xCD, 0x02, 0x98,
+    0x00, 0x00, 0x04, 0x01, 0x01, 0x01, 0x00, 0x04, 0xCE, 0x04,
+    0x6F, 0x6E, 0x65, 0x3F, 0xDA, 0x12, 0x28, 0x01, 0x00, 0x00,
+    0x25, 0x03, 0x01, 0x00, 0x45, 0x02, 0x00, 0x03, 0x03, 0x02,
+    0x00, 0x00, 0x07, 0x01, 0xA4, 0x01, 0x02, 0x03, 0x00, 0x56,
+    0xCF, 0x04, 0x6F, 0x6E, 0x65, 0x3F, 0xDA, 0x81, 0x66, 0xDA,
+    0x81, 0x62, 0xDA, 0x0D, 0xDA, 0x0B, 0xDA, 0x81, 0x03, 0xDA,
+    0x81, 0x01, 0xDA, 0x83, 0x5A, 0xDA, 0x84, 0xAF, 0xD7, 0xCD,
+    0x02, 0x99, 0x00, 0x00, 0x13, 0x00, 0x00, 0xCD, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x04, 0x27, 0xCE, 0x0A, 0x69, 0x6E, 0x74, 0x65,
+    0x72, 0x6C, 0x65, 0x61, 0x76, 0x65, 0xDA, 0x12, 0xDA, 0x83,
+    0x25, 0xDA, 0x81, 0xF9, 0xDA, 0x81, 0x30, 0xDA, 0x81, 0x1B,
+    0x28, 0x01, 0x00, 0x00, 0x3A, 0x02, 0x00, 0x00, 0x17, 0x03,
+    0x02, 0x00, 0x39, 0x04, 0x00, 0x00, 0x17, 0x05, 0x04, 0x00,
+    0x25, 0x07, 0x00, 0x00, 0x43, 0x06, 0x05, 0x07, 0x1A, 0x06,
+    0x1F, 0x00, 0x26, 0x07, 0x00, 0x00, 0x2C, 0x07, 0x00, 0x00,
+    0x26, 0x08, 0x01, 0x00, 0x2F, 0x07, 0x08, 0x00, 0x2E, 0x07,
+    0x00, 0x00, 0x26, 0x09, 0x02, 0x00, 0x2F, 0x08, 0x09, 0x00,
+    0x17, 0x07, 0x08, 0x00, 0x25, 0x08, 0x00, 0x00, 0x17, 0x09,
+    0x07, 0x00, 0x41, 0x0A, 0x08, 0x09, 0x1A, 0x0A, 0x12, 0x00,
+    0x17, 0x0B, 0x08, 0x00, 0x25, 0x0C, 0x00, 0x00, 0x17, 0x0D,
+    0x05, 0x00, 0x41, 0x0E, 0x0C, 0x0D, 0x1A, 0x0E, 0x0A, 0x00,
+    0x17, 0x0F, 0x0C, 0x00, 0x34, 0x10, 0x00, 0x0F, 0x34, 0x11,
+    0x10, 0x0B, 0x2C, 0x03, 0x11, 0x00, 0x26, 0x12, 0x03, 0x00,
+    0x2F, 0x10, 0x12, 0x00, 0x25, 0x10, 0x01, 0x00, 0x06, 0x0C,
+    0x0C, 0x10, 0x18, 0xF6, 0xFF, 0xFF, 0x25, 0x0C, 0x01, 0x00,
+    0x06, 0x08, 0x08, 0x0C, 0x18, 0xEE, 0xFF, 0xFF, 0x18, 0x01,
+    0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x31, 0x01, 0xE0, 0x10,
+    0x02, 0x02, 0x08, 0x04, 0x01, 0x02, 0x14, 0x01, 0x00, 0x13,
+    0x02, 0x02, 0x0C, 0x01, 0x00, 0x0B, 0x04, 0x02, 0x20, 0x03,
+    0x00, 0x09, 0x01, 0x00, 0x11, 0x0A, 0x02, 0x00, 0x01, 0x04,
+    0x2C, 0x01, 0x00, 0x07, 0x03, 0x00, 0x1F, 0x06, 0x03, 0x03,
+    0x01, 0x03, 0x03, 0x01, 0x0B, 0x03, 0xCF, 0x0A, 0x69, 0x6E,
+    0x74, 0x65, 0x72, 0x6C, 0x65, 0x61, 0x76, 0x65, 0xDA, 0x85,
+    0xF3, 0xDA, 0x85, 0x9E, 0xDA, 0x83, 0x2D, 0xDA, 0x83, 0x2B,
+    0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x63, 0x62, 0x72,
+    0x74, 0xCF, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x63, 0x62,
+    0x72, 0x74, 0xDA, 0x86, 0x5F, 0xCF, 0x06, 0x70, 0x75, 0x74,
+    0x2D, 0x69, 0x6E, 0xDA, 0x83, 0xC8, 0xCF, 0x09, 0x6D, 0x61,
+    0x74, 0x68, 0x2F, 0x63, 0x65, 0x69, 0x6C, 0xDA, 0x85, 0x4A,
+    0xDA, 0x85, 0x4B, 0xDA, 0x85, 0x63, 0xCF, 0x0E, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x2F, 0x67, 0x65, 0x74, 0x70, 0x72, 0x6F,
+    0x74, 0x6F, 0xD7, 0xCD, 0x02, 0xB9, 0x00, 0x00, 0x07, 0x01,
+    0x01, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x04, 0x0E, 0x01, 0xCE,
+    0x06, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0xDA, 0x12, 0xDA,
+    0x81, 0xF9, 0xDA, 0x81, 0x5A, 0xDA, 0x85, 0xFC, 0xDA, 0x57,
+    0x28, 0x02, 0x00, 0x00, 0x2A, 0x03, 0x00, 0x00, 0x2C, 0x03,
+    0x01, 0x00, 0x26, 0x05, 0x00, 0x00, 0x2F, 0x04, 0x05, 0x00,
+    0x17, 0x03, 0x04, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x06,
+    0x01, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x26, 0x06, 0x02, 0x00,
+    0x2C, 0x06, 0x05, 0x00, 0x2E, 0x03, 0x00, 0x00, 0x26, 0x06,
+    0x03, 0x00, 0x30, 0x06, 0x00, 0x00, 0xCD, 0x02, 0x90, 0x00,
+    0x00, 0x03, 0x01, 0x01, 0x01, 0x02, 0x08, 0xDA, 0x12, 0xDA,
+    0x80, 0xE0, 0xDA, 0x81, 0x5A, 0x2B, 0x00, 0x00, 0x00, 0x26,
+    0x02, 0x00, 0x00, 0x2F, 0x01, 0x02, 0x00, 0x1A, 0x01, 0x02,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26,
+    0x02, 0x01, 0x00, 0x30, 0x02, 0x00, 0x00, 0x0A, 0x03, 0xCC,
+    0x20, 0x30, 0x02, 0x00, 0x07, 0x03, 0x04, 0x04, 0x13, 0x01,
+    0xB8, 0x20, 0x02, 0x01, 0x12, 0x22, 0x03, 0x00, 0x09, 0x01,
+    0x00, 0x13, 0x03, 0x0A, 0x1E, 0x05, 0x00, 0x1D, 0xDA, 0x85,
+    0xD6, 0xDA, 0x81, 0xD6, 0xDA, 0x81, 0xD4, 0xDA, 0x83, 0x0C,
+    0xDA, 0x83, 0x0A, 0xDA, 0x81, 0xCF, 0xDA, 0x84, 0x14, 0xDA,
+    0x81, 0xBB, 0xDA, 0x81, 0xB9, 0xDA, 0x83, 0x14, 0xDA, 0x83,
+    0x12, 0xDA, 0x85, 0x9A, 0xDA, 0x85, 0x99, 0xDA, 0x83, 0x72,
+    0xDA, 0x84, 0x48, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x05,
+    0x01, 0x01, 0x01, 0x02, 0x07, 0xCE, 0x06, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x3F, 0xDA, 0x12, 0xDA, 0x15, 0xDA, 0x4D, 0x28,
+    0x01, 0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00,
+    0x00, 0x2F, 0x02, 0x03, 0x00, 0x26, 0x04, 0x01, 0x00, 0x1F,
+    0x03, 0x02, 0x04, 0x03, 0x03, 0x00, 0x00, 0x0A, 0x01, 0xBC,
+    0x01, 0x02, 0x03, 0x00, 0x5C, 0x03, 0x00, 0x05, 0xCF, 0x06,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x3F, 0xDA, 0x82, 0x61, 0xCF,
+    0x06, 0x70, 0x72, 0x69, 0x6E, 0x74, 0x66, 0xDA, 0x83, 0x10,
+    0xDA, 0x83, 0x0E, 0xD7, 0xCD, 0x00, 0x08, 0x00, 0x07, 0x03,
+    0x03, 0x03, 0x03, 0x00, 0x02, 0xCE, 0x03, 0x70, 0x75, 0x74,
+    0x36, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0xCF, 0x03,
+    0x70, 0x75, 0x74, 0xDA, 0x82, 0xB4, 0xDA, 0x84, 0xF5, 0xD8,
+    0x0B, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61,
+    0x63, 0x6B, 0xCF, 0x0B, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F,
+    0x73, 0x74, 0x61, 0x63, 0x6B, 0xDA, 0x84, 0xC0, 0xDA, 0x84,
+    0xBA, 0xDA, 0x82, 0xB7, 0xDA, 0x84, 0xD7, 0xDA, 0x82, 0x1C,
+    0xDA, 0x82, 0x1A, 0xDA, 0x80, 0xA1, 0xDA, 0x82, 0x7F, 0xDA,
+    0x82, 0x6A, 0xDA, 0x82, 0x68, 0xDA, 0x81, 0x22, 0xDA, 0x81,
+    0x20, 0xD8, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x63, 0x6F,
+    0x73, 0x68, 0xCF, 0x09, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x63,
+    0x6F, 0x73, 0x68, 0xDA, 0x85, 0x77, 0xDA, 0x85, 0x75, 0xDA,
+    0x81, 0xE6, 0xDA, 0x81, 0xE4, 0xDA, 0x84, 0xE2, 0xDA, 0x84,
+    0xE1, 0xDA, 0x84, 0xB6, 0xDA, 0x84, 0xB5, 0xDA, 0x81, 0xFA,
+    0xDA, 0x85, 0x08, 0xDA, 0x85, 0x56, 0xDA, 0x85, 0x54, 0xD7,
+    0xCD, 0x02, 0x98, 0x00, 0x00, 0x0C, 0x02, 0x02, 0x02, 0x01,
+    0x13, 0xCE, 0x06, 0x6D, 0x61, 0x70, 0x63, 0x61, 0x74, 0xDA,
+    0x12, 0xDA, 0x80, 0xA0, 0x28, 0x02, 0x00, 0x00, 0x3A, 0x03,
+    0x00, 0x00, 0x17, 0x04, 0x03, 0x00, 0x25, 0x05, 0x00, 0x00,
+    0x39, 0x06, 0x01, 0x00, 0x17, 0x07, 0x06, 0x00, 0x41, 0x06,
+    0x05, 0x07, 0x1A, 0x06, 0x0B, 0x00, 0x34, 0x08, 0x01, 0x05,
+    0x17, 0x09, 0x08, 0x00, 0x2B, 0x09, 0x00, 0x00, 0x2F, 0x08,
+    0x00, 0x00, 0x2C, 0x04, 0x08, 0x00, 0x26, 0x0B, 0x00, 0x00,
+    0x2F, 0x0A, 0x0B, 0x00, 0x25, 0x08, 0x01, 0x00, 0x06, 0x05,
+    0x05, 0x08, 0x18, 0xF5, 0xFF, 0xFF, 0x03, 0x04, 0x00, 0x00,
+    0x16, 0x01, 0xD4, 0x0A, 0x02, 0x02, 0x08, 0x04, 0x07, 0x02,
+    0x00, 0x02, 0x02, 0x28, 0x03, 0x00, 0x23, 0x03, 0x01, 0x03,
+    0x01, 0x09, 0x03, 0xCF, 0x06, 0x6D, 0x61, 0x70, 0x63, 0x61,
+    0x74, 0xD8, 0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x63,
+    0x6F, 0x73, 0x68, 0xCF, 0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+    0x61, 0x63, 0x6F, 0x73, 0x68, 0xDA, 0x83, 0xA5, 0xDA, 0x83,
+    0xA3, 0xDA, 0x86, 0x00, 0xCF, 0x0F, 0x74, 0x75, 0x70, 0x6C,
+    0x65, 0x2F, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x6D, 0x61,
+    0x70, 0xD8, 0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x73,
+    0x69, 0x6E, 0x68, 0xCF, 0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+    0x61, 0x73, 0x69, 0x6E, 0x68, 0xD8, 0x07, 0x67, 0x63, 0x73,
+    0x74, 0x61, 0x74, 0x73, 0xCF, 0x07, 0x67, 0x63, 0x73, 0x74,
+    0x61, 0x74, 0x73, 0xD7, 0xCD, 0x02, 0x99, 0x00, 0x00, 0x0F,
+    0x01, 0x01, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x08, 0x29, 0xCE,
+    0x03, 0x6C, 0x65, 0x74, 0xDA, 0x12, 0xDA, 0x33, 0xCE, 0x27,
+    0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x65,
+    0x76, 0x65, 0x6E, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x20, 0x6F, 0x66, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6C, 0x65, 0x74, 0xDA,
+    0x59, 0xDA, 0x56, 0xDA, 0x57, 0xDA, 0x81, 0x1B, 0xDA, 0x80,
+    0xA0, 0xDA, 0x80, 0xA1, 0x28, 0x02, 0x00, 0x00, 0x39, 0x03,
+    0x00, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x26, 0x05, 0x00, 0x00,
+    0x2F, 0x04, 0x05, 0x00, 0x1A, 0x04, 0x04, 0x00, 0x26, 0x03,
+    0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00,
+    0x39, 0x03, 0x00, 0x00, 0x17, 0x04, 0x03, 0x00, 0x25, 0x05,
+    0x00, 0x00, 0x26, 0x06, 0x02, 0x00, 0x2B, 0x06, 0x00, 0x00,
+    0x3A, 0x06, 0x00, 0x00, 0x17, 0x07, 0x06, 0x00, 0x41, 0x08,
+    0x05, 0x04, 0x1A, 0x08, 0x11, 0x00, 0x25, 0x0B, 0x01, 0x00,
+    0x06, 0x0A, 0x05, 0x0B, 0x34, 0x09, 0x00, 0x0A, 0x17, 0x0B,
+    0x09, 0x00, 0x34, 0x09, 0x00, 0x05, 0x17, 0x0C, 0x09, 0x00,
+    0x26, 0x09, 0x03, 0x00, 0x2D, 0x09, 0x0C, 0x0B, 0x26, 0x0D,
+    0x04, 0x00, 0x2F, 0x09, 0x0D, 0x00, 0x2C, 0x07, 0x09, 0x00,
+    0x26, 0x0E, 0x05, 0x00, 0x2F, 0x0D, 0x0E, 0x00, 0x25, 0x09,
+    0x02, 0x00, 0x06, 0x05, 0x05, 0x09, 0x18, 0xEF, 0xFF, 0xFF,
+    0x2C, 0x07, 0x01, 0x00, 0x26, 0x09, 0x06, 0x00, 0x2F, 0x08,
+    0x09, 0x00, 0x25, 0x09, 0x00, 0x00, 0x2C, 0x07, 0x09, 0x00,
+    0x26, 0x09, 0x07, 0x00, 0x30, 0x09, 0x00, 0x00, 0x3D, 0x01,
+    0x84, 0x03, 0x02, 0x01, 0x0A, 0x18, 0x03, 0x00, 0x0B, 0x01,
+    0x00, 0x07, 0x02, 0x00, 0x3A, 0x01, 0x00, 0x39, 0x01, 0x02,
+    0x12, 0x01, 0x00, 0x11, 0x01, 0x02, 0x00, 0x04, 0x02, 0x00,
+    0x01, 0x02, 0x0E, 0x01, 0x00, 0x0D, 0x02, 0x02, 0x18, 0x04,
+    0x00, 0x13, 0x04, 0x02, 0x24, 0x03, 0x00, 0x23, 0x02, 0x02,
+    0x00, 0x01, 0x05, 0x03, 0x03, 0x08, 0x00, 0x04, 0x02, 0x00,
+    0xDA, 0x81, 0xA0, 0xDA, 0x84, 0x0E, 0xDA, 0x84, 0x0C, 0xD8,
+    0x11, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x6E, 0x65,
+    0x77, 0x2D, 0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0xCF, 0x11,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77,
+    0x2D, 0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0xD8, 0x0A, 0x64,
+    0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x65, 0x70, 0xCF,
+    0x0A, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x65,
+    0x70, 0xDA, 0x82, 0xAD, 0xCF, 0x0C, 0x70, 0x61, 0x72, 0x73,
+    0x65, 0x72, 0x2F, 0x65, 0x72, 0x72, 0x6F, 0x72, 0xDA, 0x82,
+    0xEB, 0xCF, 0x0A, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0xDA, 0x83, 0xAD, 0xDA, 0x83, 0xAB, 0xDA,
+    0x84, 0x60, 0xDA, 0x84, 0x5C, 0xD7, 0xCD, 0x02, 0x98, 0x00,
+    0x00, 0x06, 0x02, 0x02, 0x02, 0x02, 0x08, 0xCE, 0x02, 0x25,
+    0x3D, 0xDA, 0x12, 0xDA, 0x32, 0xDA, 0x22, 0x28, 0x02, 0x00,
+    0x00, 0x26, 0x04, 0x00, 0x00, 0x2D, 0x04, 0x00, 0x01, 0x3F,
+    0x03, 0x00, 0x00, 0x26, 0x05, 0x01, 0x00, 0x2D, 0x05, 0x00,
+    0x03, 0x3F, 0x04, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x07,
+    0x01, 0x88, 0x02, 0x02, 0x07, 0x00, 0x68, 0xCF, 0x02, 0x25,
+    0x3D, 0xD8, 0x0C, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F,
+    0x73, 0x6C, 0x69, 0x63, 0x65, 0xCF, 0x0C, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x2F, 0x73, 0x6C, 0x69, 0x63, 0x65, 0xDA,
+    0x81, 0x6A, 0xDA, 0x81, 0x68, 0xDA, 0x82, 0x92, 0xDA, 0x82,
+    0x90, 0xDA, 0x77, 0xDA, 0x75, 0xDA, 0x81, 0x16, 0xCF, 0x04,
+    0x6E, 0x65, 0x78, 0x74, 0xDA, 0x81, 0x1E, 0xDA, 0x81, 0x0F,
+    0xDA, 0x84, 0xE0, 0xDA, 0x84, 0xDF, 0xDA, 0x82, 0xE4, 0xDA,
+    0x82, 0xE2, 0xDA, 0x84, 0xFE, 0xDA, 0x84, 0xFD, 0xDA, 0x85,
+    0xF2, 0xCF, 0x04, 0x72, 0x65, 0x70, 0x6C, 0xD7, 0xCD, 0x02,
+    0xBB, 0x00, 0x00, 0x03, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x00, 0x03, 0x01, 0xCE, 0x05, 0x6A, 0x75, 0x78, 0x74,
+    0x2A, 0xDA, 0x12, 0x28, 0x01, 0x00, 0x00, 0x2A, 0x02, 0x00,
+    0x00, 0x03, 0x02, 0x00, 0x00, 0xCD, 0x02, 0xD1, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0x17,
+    0x01, 0xDA, 0x12, 0xDA, 0x81, 0x1B, 0xDA, 0x80, 0xA1, 0x3A,
+    0x01, 0x00, 0x00, 0x17, 0x02, 0x01, 0x00, 0x25, 0x03, 0x00,
+    0x00, 0x27, 0x05, 0x00, 0x00, 0x39, 0x04, 0x05, 0x00, 0x17,
+    0x05, 0x04, 0x00, 0x41, 0x04, 0x03, 0x05, 0x1A, 0x04, 0x0C,
+    0x00, 0x27, 0x07, 0x00, 0x00, 0x34, 0x06, 0x07, 0x03, 0x17,
+    0x07, 0x06, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x2F, 0x06, 0x07,
+    0x00, 0x2C, 0x02, 0x06, 0x00, 0x26, 0x09, 0x00, 0x00, 0x2F,
+    0x08, 0x09, 0x00, 0x25, 0x06, 0x01, 0x00, 0x06, 0x03, 0x03,
+    0x06, 0x18, 0xF4, 0xFF, 0xFF, 0x25, 0x03, 0x00, 0x00, 0x2C,
+    0x02, 0x03, 0x00, 0x26, 0x03, 0x01, 0x00, 0x30, 0x03, 0x00,
+    0x00, 0xBF, 0xFF, 0x13, 0x02, 0xE8, 0x0C, 0x0A, 0x09, 0x02,
+    0x00, 0x02, 0x02, 0x24, 0x03, 0x00, 0x1F, 0x03, 0x01, 0x03,
+    0x04, 0x04, 0x00, 0x07, 0x01, 0xDE, 0x0C, 0x02, 0x02, 0x08,
+    0x04, 0xCF, 0x05, 0x6A, 0x75, 0x78, 0x74, 0x2A, 0xD8, 0x0A,
+    0x6D, 0x61, 0x74, 0x68, 0x2F, 0x68, 0x79, 0x70, 0x6F, 0x74,
+    0xCF, 0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x68, 0x79, 0x70,
+    0x6F, 0x74, 0xDA, 0x83, 0x99, 0xDA, 0x83, 0x97, 0xDA, 0x84,
+    0x1E, 0xDA, 0x84, 0x1A, 0xDA, 0x83, 0xD7, 0xDA, 0x83, 0xD5,
+    0xDA, 0x85, 0x27, 0xDA, 0x85, 0x26, 0xDA, 0x81, 0x2D, 0xDA,
+    0x84, 0x8E, 0xD7, 0xCD, 0x02, 0xB9, 0x00, 0x00, 0x05, 0x00,
+    0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0x0A, 0x01, 0xCE,
+    0x03, 0x75, 0x73, 0x65, 0xDA, 0x12, 0xDA, 0x81, 0xF9, 0xDA,
+    0x59, 0x28, 0x01, 0x00, 0x00, 0x2A, 0x02, 0x00, 0x00, 0x2C,
+    0x02, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x03, 0x04,
+    0x00, 0x26, 0x04, 0x01, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2E,
+    0x03, 0x00, 0x00, 0x3F, 0x02, 0x00, 0x00, 0x03, 0x02, 0x00,
+    0x00, 0xCD, 0x02, 0x90, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01,
+    0x04, 0x0A, 0xDA, 0x12, 0xDA, 0x81, 0x5A, 0xDA, 0x85, 0xFC,
+    0xDA, 0x85, 0xD8, 0xDA, 0x80, 0xF8, 0x2B, 0x00, 0x00, 0x00,
+    0x26, 0x02, 0x00, 0x00, 0x2F, 0x01, 0x02, 0x00, 0x26, 0x03,
+    0x01, 0x00, 0x26, 0x04, 0x02, 0x00, 0x2D, 0x03, 0x01, 0x04,
+    0x26, 0x03, 0x03, 0x00, 0x2B, 0x03, 0x00, 0x00, 0x3F, 0x02,
+    0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x04, 0x0A, 0xE0, 0x20,
+    0x2E, 0x0D, 0x01, 0xD8, 0x20, 0x02, 0x01, 0x08, 0x1C, 0x03,
+    0x00, 0x0B, 0x05, 0x00, 0x0B, 0xDA, 0x85, 0xD7, 0xD8, 0x0A,
+    0x6D, 0x61, 0x74, 0x68, 0x2F, 0x74, 0x72, 0x75, 0x6E, 0x63,
+    0xCF, 0x0A, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x74, 0x72, 0x75,
+    0x6E, 0x63, 0xDA, 0x84, 0xCF, 0xDA, 0x84, 0xCE, 0xDA, 0x81,
+    0x6E, 0xDA, 0x81, 0x6C, 0xDA, 0x81, 0xAE, 0xDA, 0x81, 0xAC,
+    0xDA, 0x82, 0x31, 0xDA, 0x82, 0x2D, 0xDA, 0x82, 0xC8, 0xDA,
+    0x82, 0x94, 0xDA, 0x85, 0x58, 0xDA, 0x85, 0x57, 0xDA, 0x83,
+    0x7C, 0xDA, 0x85, 0x95, 0xDA, 0x85, 0x5D, 0xDA, 0x85, 0x5B,
+    0xD8, 0x05, 0x70, 0x61, 0x69, 0x72, 0x73, 0xCF, 0x05, 0x70,
+    0x61, 0x69, 0x72, 0x73, 0xDA, 0x80, 0xE6, 0xDA, 0x80, 0xE2,
+    0xDA, 0x84, 0xDE, 0xDA, 0x84, 0xDD, 0xDA, 0x82, 0xB2, 0xCF,
+    0x09, 0x62, 0x61, 0x64, 0x2D, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0xD7, 0xCD, 0x02, 0xBB, 0x00, 0x00, 0x08, 0x02, 0x02, 0xCD,
+    0x7F, 0xFF, 0xFF, 0xFF, 0x03, 0x08, 0x02, 0xCE, 0x04, 0x61,
+    0x73, 0x2D, 0x3E, 0xDA, 0x12, 0xDA, 0x55, 0xDA, 0x85, 0x90,
+    0xDA, 0x81, 0xA0, 0x28, 0x03, 0x00, 0x00, 0x17, 0x04, 0x00,
+    0x00, 0x25, 0x05, 0x00, 0x00, 0x39, 0x06, 0x02, 0x00, 0x17,
+    0x07, 0x06, 0x00, 0x2A, 0x06, 0x01, 0x00, 0x2F, 0x06, 0x06,
+    0x00, 0x03, 0x04, 0x00, 0x00, 0xCD, 0x02, 0xD0, 0x00, 0x00,
+    0x03, 0x01, 0x01, 0x01, 0x00, 0x06, 0x01, 0xDA, 0x12, 0x27,
+    0x02, 0x00, 0x01, 0x1F, 0x01, 0x00, 0x02, 0x1A, 0x01, 0x03,
+    0x00, 0x27, 0x02, 0x00, 0x0A, 0x03, 0x02, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0x07, 0x02, 0xD6, 0x0E, 0x54,
+    0x04, 0x00, 0x07, 0xCD, 0x02, 0xFA, 0x00, 0x00, 0x08, 0x00,
+    0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x03, 0x1E, 0x01, 0x01,
+    0xDA, 0x85, 0x91, 0xDA, 0x12, 0xDA, 0x55, 0xDA, 0x85, 0x90,
+    0xDA, 0x81, 0xA0, 0x27, 0x01, 0x00, 0x05, 0x27, 0x02, 0x00,
+    0x07, 0x41, 0x00, 0x01, 0x02, 0x19, 0x00, 0x02, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x27, 0x02, 0x00, 0x02, 0x27, 0x03, 0x00,
+    0x05, 0x34, 0x01, 0x02, 0x03, 0x17, 0x02, 0x01, 0x00, 0x26,
+    0x03, 0x00, 0x00, 0x2F, 0x01, 0x03, 0x00, 0x17, 0x03, 0x01,
+    0x00, 0x2A, 0x01, 0x00, 0x00, 0x2C, 0x01, 0x02, 0x00, 0x26,
+    0x05, 0x01, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x17, 0x01, 0x04,
+    0x00, 0x27, 0x05, 0x00, 0x04, 0x2C, 0x03, 0x05, 0x00, 0x40,
+    0x04, 0x00, 0x00, 0x26, 0x06, 0x02, 0x00, 0x2D, 0x06, 0x04,
+    0x01, 0x3F, 0x05, 0x00, 0x00, 0x29, 0x05, 0x00, 0x04, 0x27,
+    0x06, 0x00, 0x05, 0x25, 0x07, 0x01, 0x00, 0x06, 0x04, 0x06,
+    0x07, 0x29, 0x04, 0x00, 0x05, 0x28, 0x06, 0x00, 0x00, 0x30,
+    0x06, 0x00, 0x00, 0xBF, 0xFF, 0xCD, 0x02, 0xD0, 0x00, 0x00,
+    0x03, 0x01, 0x01, 0x01, 0x00, 0x06, 0x02, 0xDA, 0x12, 0x27,
+    0x02, 0x00, 0x01, 0x1F, 0x01, 0x00, 0x02, 0x1A, 0x01, 0x03,
+    0x00, 0x27, 0x02, 0x01, 0x03, 0x03, 0x02, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x07, 0x02, 0xD6, 0x0E,
+    0x54, 0x04, 0x00, 0x07, 0x19, 0x09, 0xD2, 0x0E, 0x06, 0x02,
+    0x02, 0x16, 0x01, 0x00, 0x11, 0x01, 0x02, 0x32, 0x03, 0x00,
+    0x13, 0x01, 0x00, 0x1D, 0x07, 0x02, 0x14, 0x06, 0x05, 0x17,
+    0x0D, 0x01, 0xC6, 0x0E, 0x02, 0x01, 0x0A, 0x04, 0x05, 0x02,
+    0x00, 0x01, 0x0B, 0x03, 0xCF, 0x04, 0x61, 0x73, 0x2D, 0x3E,
+    0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x05, 0x01, 0x01, 0x01,
+    0x02, 0x07, 0xCE, 0x06, 0x66, 0x69, 0x62, 0x65, 0x72, 0x3F,
+    0xDA, 0x12, 0xDA, 0x15, 0xDA, 0x82, 0xC2, 0x28, 0x01, 0x00,
+    0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0x2F,
+    0x02, 0x03, 0x00, 0x26, 0x04, 0x01, 0x00, 0x1F, 0x03, 0x02,
+    0x04, 0x03, 0x03, 0x00, 0x00, 0x0A, 0x01, 0xA8, 0x01, 0x02,
+    0x03, 0x00, 0x5A, 0x03, 0x00, 0x05, 0xCF, 0x06, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x3F, 0xDA, 0x85, 0xFC, 0xDA, 0x85, 0xD5,
+    0xD8, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x62, 0x73,
+    0xCF, 0x08, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x62, 0x73,
+    0xD8, 0x07, 0x7A, 0x69, 0x70, 0x63, 0x6F, 0x6C, 0x6C, 0xCF,
+    0x07, 0x7A, 0x69, 0x70, 0x63, 0x6F, 0x6C, 0x6C, 0xDA, 0x81,
+    0x60, 0xDA, 0x81, 0x5E, 0xDA, 0x82, 0xB8, 0xDA, 0x84, 0x06,
+    0xD8, 0x0A, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62,
+    0x69, 0x74, 0xCF, 0x0A, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x2F, 0x62, 0x69, 0x74, 0xDA, 0x84, 0xB1, 0xDA, 0x84, 0xB0,
+    0xDA, 0x82, 0x88, 0xDA, 0x82, 0x86, 0xD8, 0x0B, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x6F, 0x70, 0x6E, 0xCF,
+    0x0B, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x6F,
+    0x70, 0x6E, 0xD8, 0x10, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x2F, 0x62, 0x69, 0x74, 0x2D, 0x63, 0x6C, 0x65, 0x61, 0x72,
+    0xCF, 0x10, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x62,
+    0x69, 0x74, 0x2D, 0x63, 0x6C, 0x65, 0x61, 0x72, 0xDA, 0x82,
+    0x4A, 0xDA, 0x82, 0x48, 0xDA, 0x84, 0xED, 0xDA, 0x84, 0xEC,
+    0xDA, 0x84, 0x2C, 0xDA, 0x84, 0x2A, 0xDA, 0x84, 0x53, 0xDA,
+    0x84, 0x51, 0xDA, 0x83, 0x7F, 0xCF, 0x07, 0x6F, 0x73, 0x2F,
+    0x65, 0x78, 0x69, 0x74, 0xD7, 0xCD, 0x02, 0x99, 0x00, 0x00,
+    0x04, 0x01, 0x01, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x01, 0x05,
+    0xCE, 0x04, 0x6C, 0x6F, 0x6F, 0x70, 0xDA, 0x12, 0xD7, 0xCD,
+    0x02, 0x98, 0x00, 0x00, 0x12, 0x03, 0x03, 0x03, 0x1E, 0x80,
+    0xEB, 0xCE, 0x05, 0x6C, 0x6F, 0x6F, 0x70, 0x31, 0xDA, 0x12,
+    0xDA, 0x59, 0xDA, 0x80, 0xE0, 0xD5, 0x07, 0xD0, 0x05, 0x75,
+    0x6E, 0x74, 0x69, 0x6C, 0x00, 0xD0, 0x06, 0x72, 0x65, 0x70,
+    0x65, 0x61, 0x74, 0x05, 0xD0, 0x04, 0x77, 0x68, 0x65, 0x6E,
+    0x06, 0xD0, 0x05, 0x61, 0x66, 0x74, 0x65, 0x72, 0x03, 0xD0,
+    0x06, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x04, 0xD0, 0x03,
+    0x6C, 0x65, 0x74, 0x02, 0xD0, 0x05, 0x77, 0x68, 0x69, 0x6C,
+    0x65, 0x01, 0xCE, 0x19, 0x75, 0x6E, 0x65, 0x78, 0x70, 0x65,
+    0x63, 0x74, 0x65, 0x64, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20,
+    0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72, 0x20, 0xDA,
+    0x81, 0x5A, 0xCF, 0x05, 0x62, 0x72, 0x65, 0x61, 0x6B, 0xDA,
+    0x58, 0xDA, 0x81, 0xA0, 0xDA, 0x55, 0xDA, 0x81, 0xEE, 0xDA,
+    0x84, 0x93, 0xDA, 0x69, 0xDA, 0x81, 0xF3, 0xDA, 0x81, 0x05,
+    0xD5, 0x07, 0xD0, 0x08, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61,
+    0x74, 0x65, 0x06, 0xD0, 0x04, 0x6B, 0x65, 0x79, 0x73, 0x01,
+    0xD0, 0x05, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x00, 0xD0, 0x07,
+    0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x65, 0x05, 0xD0, 0x05,
+    0x70, 0x61, 0x69, 0x72, 0x73, 0x02, 0xD0, 0x02, 0x69, 0x6E,
+    0x04, 0xD0, 0x04, 0x64, 0x6F, 0x77, 0x6E, 0x03, 0xCE, 0x15,
+    0x75, 0x6E, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64,
+    0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x76, 0x65, 0x72, 0x62,
+    0x20, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x05, 0x01, 0x01,
+    0x01, 0x03, 0x0C, 0xCE, 0x0D, 0x63, 0x68, 0x65, 0x63, 0x6B,
+    0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0xDA, 0x12,
+    0xDA, 0x84, 0xBE, 0xCE, 0x1E, 0x65, 0x78, 0x70, 0x65, 0x63,
+    0x74, 0x65, 0x64, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20,
+    0x66, 0x6F, 0x72, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x2C,
+    0x20, 0x67, 0x6F, 0x74, 0x20, 0xDA, 0x81, 0x5A, 0x28, 0x01,
+    0x00, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00,
+    0x2F, 0x02, 0x03, 0x00, 0x1A, 0x02, 0x02, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2C, 0x03, 0x00, 0x00,
+    0x26, 0x04, 0x02, 0x00, 0x2F, 0x03, 0x04, 0x00, 0x01, 0x03,
+    0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x01, 0xEC, 0x05,
+    0x02, 0x03, 0x02, 0x0C, 0x02, 0x00, 0x07, 0x04, 0x04, 0x12,
+    0x02, 0x00, 0x0D, 0xDA, 0x81, 0x2D, 0xDA, 0x21, 0xDA, 0x86,
+    0x6E, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x0D, 0x04, 0x04,
+    0x04, 0x0A, 0x3A, 0xCE, 0x0D, 0x6B, 0x65, 0x79, 0x73, 0x2D,
+    0x74, 0x65, 0x6D, 0x70, 0x6C, 0x61, 0x74, 0x65, 0xDA, 0x12,
+    0xDA, 0x55, 0xDA, 0x4C, 0xDA, 0x56, 0xDA, 0x81, 0x16, 0xDA,
+    0x81, 0xEE, 0xDA, 0x64, 0xDA, 0x83, 0x04, 0xDA, 0x22, 0xDA,
+    0x81, 0xF3, 0xDA, 0x59, 0x28, 0x04, 0x00, 0x00, 0x26, 0x06,
+    0x00, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x17, 0x06, 0x05, 0x00,
+    0x2B, 0x01, 0x00, 0x00, 0x26, 0x08, 0x01, 0x00, 0x2F, 0x07,
+    0x08, 0x00, 0x1A, 0x07, 0x03, 0x00, 0x17, 0x05, 0x01, 0x00,
+    0x18, 0x04, 0x00, 0x00, 0x26, 0x09, 0x00, 0x00, 0x2F, 0x08,
+    0x09, 0x00, 0x17, 0x05, 0x08, 0x00, 0x17, 0x07, 0x05, 0x00,
+    0x1F, 0x08, 0x07, 0x01, 0x1A, 0x08, 0x03, 0x00, 0x22, 0x05,
+    0x00, 0x00, 0x18, 0x05, 0x00, 0x00, 0x26, 0x0A, 0x02, 0x00,
+    0x2D, 0x0A, 0x07, 0x01, 0x3F, 0x09, 0x00, 0x00, 0x17, 0x05,
+    0x09, 0x00, 0x26, 0x09, 0x03, 0x00, 0x22, 0x0A, 0x00, 0x00,
+    0x2D, 0x09, 0x07, 0x0A, 0x3F, 0x08, 0x00, 0x00, 0x26, 0x0A,
+    0x04, 0x00, 0x2D, 0x0A, 0x06, 0x08, 0x3F, 0x09, 0x00, 0x00,
+    0x1A, 0x02, 0x09, 0x00, 0x26, 0x0B, 0x05, 0x00, 0x2D, 0x0B,
+    0x07, 0x06, 0x3F, 0x0A, 0x00, 0x00, 0x26, 0x0C, 0x06, 0x00,
+    0x2D, 0x0C, 0x06, 0x0A, 0x3F, 0x0B, 0x00, 0x00, 0x17, 0x08,
+    0x0B, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x08, 0x06, 0x00,
+    0x26, 0x0B, 0x02, 0x00, 0x2D, 0x0B, 0x00, 0x08, 0x3F, 0x0A,
+    0x00, 0x00, 0x26, 0x0B, 0x03, 0x00, 0x2D, 0x0B, 0x07, 0x06,
+    0x3F, 0x08, 0x00, 0x00, 0x26, 0x0C, 0x07, 0x00, 0x2D, 0x0C,
+    0x06, 0x08, 0x3F, 0x0B, 0x00, 0x00, 0x26, 0x0C, 0x08, 0x00,
+    0x2D, 0x0C, 0x06, 0x0A, 0x2E, 0x03, 0x00, 0x00, 0x2B, 0x0B,
+    0x00, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x26, 0x0B, 0x09, 0x00,
+    0x2D, 0x0B, 0x05, 0x09, 0x2B, 0x08, 0x00, 0x00, 0x3F, 0x0A,
+    0x00, 0x00, 0x03, 0x0A, 0x00, 0x00, 0x28, 0x01, 0xC2, 0x05,
+    0x02, 0x03, 0x04, 0x04, 0x03, 0x02, 0x1C, 0x03, 0x00, 0x07,
+    0x02, 0x00, 0x30, 0x01, 0x00, 0x2F, 0x01, 0x00, 0x0F, 0x01,
+    0x04, 0x18, 0x03, 0x01, 0x17, 0x03, 0x02, 0x2C, 0x09, 0x01,
+    0x2B, 0x06, 0x08, 0x3C, 0x16, 0x07, 0x3B, 0xDA, 0x82, 0x44,
+    0xDA, 0x6E, 0xDA, 0x86, 0xB1, 0xD7, 0xCD, 0x02, 0x98, 0x00,
+    0x00, 0x0A, 0x03, 0x03, 0x03, 0x06, 0x16, 0xCE, 0x10, 0x69,
+    0x74, 0x65, 0x72, 0x61, 0x74, 0x65, 0x2D, 0x74, 0x65, 0x6D,
+    0x70, 0x6C, 0x61, 0x74, 0x65, 0xDA, 0x12, 0xDA, 0x55, 0xDA,
+    0x81, 0xEE, 0xDA, 0x22, 0xDA, 0x56, 0xDA, 0x81, 0xF3, 0xDA,
+    0x59, 0x28, 0x03, 0x00, 0x00, 0x26, 0x05, 0x00, 0x00, 0x2F,
+    0x04, 0x05, 0x00, 0x17, 0x05, 0x04, 0x00, 0x26, 0x06, 0x01,
+    0x00, 0x22, 0x07, 0x00, 0x00, 0x2D, 0x06, 0x05, 0x07, 0x3F,
+    0x04, 0x00, 0x00, 0x26, 0x07, 0x02, 0x00, 0x2D, 0x07, 0x05,
+    0x01, 0x3F, 0x06, 0x00, 0x00, 0x26, 0x08, 0x03, 0x00, 0x2D,
+    0x08, 0x00, 0x05, 0x3F, 0x07, 0x00, 0x00, 0x26, 0x09, 0x04,
+    0x00, 0x2D, 0x09, 0x06, 0x07, 0x2B, 0x02, 0x00, 0x00, 0x3F,
+    0x08, 0x00, 0x00, 0x26, 0x07, 0x05, 0x00, 0x2D, 0x07, 0x04,
+    0x08, 0x3F, 0x06, 0x00, 0x00, 0x03, 0x06, 0x00, 0x00, 0x0A,
+    0x01, 0xDA, 0x05, 0x02, 0x03, 0x04, 0x04, 0x12, 0x02, 0x04,
+    0xDA, 0x82, 0x78, 0xDA, 0x56, 0xDA, 0x81, 0xDE, 0xDA, 0x81,
+    0x36, 0xDA, 0x82, 0xBF, 0x28, 0x03, 0x00, 0x00, 0x39, 0x04,
+    0x01, 0x00, 0x42, 0x05, 0x04, 0x02, 0x1A, 0x05, 0x07, 0x00,
+    0x26, 0x06, 0x00, 0x00, 0x2B, 0x06, 0x00, 0x00, 0x2E, 0x00,
+    0x00, 0x00, 0x3F, 0x04, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00,
+    0x18, 0x01, 0x00, 0x00, 0x25, 0x06, 0x01, 0x00, 0x06, 0x05,
+    0x02, 0x06, 0x34, 0x04, 0x01, 0x05, 0x17, 0x06, 0x04, 0x00,
+    0x34, 0x04, 0x01, 0x02, 0x17, 0x07, 0x04, 0x00, 0x2B, 0x07,
+    0x00, 0x00, 0x26, 0x08, 0x01, 0x00, 0x2F, 0x04, 0x08, 0x00,
+    0x1A, 0x04, 0x59, 0x00, 0x25, 0x09, 0x02, 0x00, 0x06, 0x08,
+    0x02, 0x09, 0x2D, 0x00, 0x01, 0x08, 0x2F, 0x09, 0x03, 0x00,
+    0x17, 0x08, 0x09, 0x00, 0x47, 0x07, 0x02, 0x00, 0x18, 0x0D,
+    0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x23, 0x00, 0x00,
+    0x18, 0x29, 0x00, 0x00, 0x18, 0x2E, 0x00, 0x00, 0x18, 0x33,
+    0x00, 0x00, 0x18, 0x47, 0x00, 0x00, 0x26, 0x09, 0x03, 0x00,
+    0x2C, 0x09, 0x07, 0x00, 0x26, 0x0A, 0x04, 0x00, 0x2F, 0x09,
+    0x0A, 0x00, 0x01, 0x09, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x26, 0x0A, 0x05, 0x00, 0x2B, 0x0A, 0x00, 0x00, 0x3F, 0x09,
+    0x00, 0x00, 0x26, 0x0B, 0x06, 0x00, 0x2D, 0x0B, 0x06, 0x09,
+    0x22, 0x0B, 0x00, 0x00, 0x2B, 0x0B, 0x00, 0x00, 0x3F, 0x0A,
+    0x00, 0x00, 0x26, 0x0B, 0x00, 0x00, 0x2D, 0x0B, 0x0A, 0x08,
+    0x3F, 0x09, 0x00, 0x00, 0x03, 0x09, 0x00, 0x00, 0x26, 0x0A,
+    0x05, 0x00, 0x2B, 0x0A, 0x00, 0x00, 0x3F, 0x09, 0x00, 0x00,
+    0x26, 0x0B, 0x06, 0x00, 0x22, 0x0C, 0x00, 0x00, 0x2D, 0x0B,
+    0x06, 0x0C, 0x2B, 0x09, 0x00, 0x00, 0x3F, 0x0A, 0x00, 0x00,
+    0x26, 0x0B, 0x00, 0x00, 0x2D, 0x0B, 0x0A, 0x08, 0x3F, 0x09,
+    0x00, 0x00, 0x03, 0x09, 0x00, 0x00, 0x26, 0x0A, 0x00, 0x00,
+    0x2C, 0x0A, 0x08, 0x00, 0x3F, 0x09, 0x00, 0x00, 0x26, 0x0B,
+    0x07, 0x00, 0x2D, 0x0B, 0x06, 0x09, 0x3F, 0x0A, 0x00, 0x00,
+    0x03, 0x0A, 0x00, 0x00, 0x26, 0x0A, 0x00, 0x00, 0x2D, 0x0A,
+    0x08, 0x06, 0x22, 0x0A, 0x00, 0x00, 0x2B, 0x0A, 0x00, 0x00,
+    0x3F, 0x09, 0x00, 0x00, 0x03, 0x09, 0x00, 0x00, 0x26, 0x0A,
+    0x00, 0x00, 0x2D, 0x0A, 0x06, 0x08, 0x22, 0x0A, 0x00, 0x00,
+    0x2B, 0x0A, 0x00, 0x00, 0x3F, 0x09, 0x00, 0x00, 0x03, 0x09,
+    0x00, 0x00, 0x26, 0x0A, 0x08, 0x00, 0x2F, 0x09, 0x0A, 0x00,
+    0x17, 0x0A, 0x09, 0x00, 0x26, 0x0B, 0x09, 0x00, 0x2D, 0x0B,
+    0x0A, 0x06, 0x3F, 0x09, 0x00, 0x00, 0x26, 0x0C, 0x0A, 0x00,
+    0x25, 0x0D, 0x00, 0x00, 0x2D, 0x0C, 0x0A, 0x0D, 0x3F, 0x0B,
+    0x00, 0x00, 0x26, 0x0D, 0x0B, 0x00, 0x2C, 0x0D, 0x0A, 0x00,
+    0x3F, 0x0C, 0x00, 0x00, 0x26, 0x0E, 0x0C, 0x00, 0x2D, 0x0E,
+    0x0B, 0x08, 0x2B, 0x0C, 0x00, 0x00, 0x3F, 0x0D, 0x00, 0x00,
+    0x26, 0x0C, 0x00, 0x00, 0x2D, 0x0C, 0x09, 0x0D, 0x3F, 0x0B,
+    0x00, 0x00, 0x03, 0x0B, 0x00, 0x00, 0x26, 0x0A, 0x0D, 0x00,
+    0x2D, 0x0A, 0x06, 0x08, 0x3F, 0x09, 0x00, 0x00, 0x03, 0x09,
+    0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x25, 0x09, 0x02, 0x00,
+    0x06, 0x08, 0x02, 0x09, 0x34, 0x04, 0x01, 0x08, 0x17, 0x09,
+    0x04, 0x00, 0x25, 0x0A, 0x03, 0x00, 0x06, 0x04, 0x02, 0x0A,
+    0x2D, 0x00, 0x01, 0x04, 0x2F, 0x0A, 0x03, 0x00, 0x17, 0x04,
+    0x0A, 0x00, 0x47, 0x06, 0x0E, 0x00, 0x18, 0x0D, 0x00, 0x00,
+    0x18, 0x23, 0x00, 0x00, 0x18, 0x29, 0x00, 0x00, 0x18, 0x2F,
+    0x00, 0x00, 0x18, 0x45, 0x00, 0x00, 0x18, 0x49, 0x00, 0x00,
+    0x18, 0x4B, 0x00, 0x00, 0x26, 0x0A, 0x0F, 0x00, 0x2C, 0x0A,
+    0x06, 0x00, 0x26, 0x0B, 0x04, 0x00, 0x2F, 0x0A, 0x0B, 0x00,
+    0x01, 0x0A, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2B, 0x09,
+    0x00, 0x00, 0x26, 0x0B, 0x10, 0x00, 0x2F, 0x0A, 0x0B, 0x00,
+    0x37, 0x0B, 0x0A, 0x00, 0x17, 0x0C, 0x0B, 0x00, 0x37, 0x0B,
+    0x0A, 0x01, 0x17, 0x0D, 0x0B, 0x00, 0x37, 0x0B, 0x0A, 0x02,
+    0x17, 0x0E, 0x0B, 0x00, 0x1A, 0x0E, 0x03, 0x00, 0x17, 0x0A,
+    0x0E, 0x00, 0x18, 0x03, 0x00, 0x00, 0x25, 0x0B, 0x01, 0x00,
+    0x17, 0x0A, 0x0B, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x3F, 0x0B,
+    0x00, 0x00, 0x2D, 0x07, 0x0C, 0x0D, 0x26, 0x0F, 0x11, 0x00,
+    0x26, 0x10, 0x12, 0x00, 0x2D, 0x0A, 0x0F, 0x10, 0x2B, 0x0B,
+    0x00, 0x00, 0x26, 0x0F, 0x13, 0x00, 0x30, 0x0F, 0x00, 0x00,
+    0x2B, 0x04, 0x00, 0x00, 0x3F, 0x0A, 0x00, 0x00, 0x24, 0x0B,
+    0x00, 0x00, 0x2D, 0x07, 0x09, 0x0B, 0x2B, 0x0A, 0x00, 0x00,
+    0x26, 0x0B, 0x14, 0x00, 0x30, 0x0B, 0x00, 0x00, 0x2B, 0x04,
+    0x00, 0x00, 0x3F, 0x0A, 0x00, 0x00, 0x23, 0x0B, 0x00, 0x00,
+    0x2D, 0x07, 0x09, 0x0B, 0x2B, 0x0A, 0x00, 0x00, 0x26, 0x0B,
+    0x14, 0x00, 0x30, 0x0B, 0x00, 0x00, 0x2B, 0x09, 0x00, 0x00,
+    0x26, 0x0B, 0x10, 0x00, 0x2F, 0x0A, 0x0B, 0x00, 0x37, 0x0B,
+    0x0A, 0x00, 0x17, 0x0C, 0x0B, 0x00, 0x37, 0x0B, 0x0A, 0x01,
+    0x17, 0x0D, 0x0B, 0x00, 0x37, 0x0B, 0x0A, 0x02, 0x17, 0x0E,
+    0x0B, 0x00, 0x1A, 0x0E, 0x03, 0x00, 0x17, 0x0A, 0x0E, 0x00,
+    0x18, 0x03, 0x00, 0x00, 0x25, 0x0B, 0x01, 0x00, 0x17, 0x0A,
+    0x0B, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x3F, 0x0B, 0x00, 0x00,
+    0x2D, 0x07, 0x0C, 0x0D, 0x26, 0x0F, 0x15, 0x00, 0x26, 0x10,
+    0x16, 0x00, 0x2D, 0x0A, 0x0F, 0x10, 0x2B, 0x0B, 0x00, 0x00,
+    0x26, 0x0F, 0x13, 0x00, 0x30, 0x0F, 0x00, 0x00, 0x2B, 0x04,
+    0x00, 0x00, 0x3F, 0x0A, 0x00, 0x00, 0x2D, 0x07, 0x09, 0x0A,
+    0x26, 0x0B, 0x17, 0x00, 0x30, 0x0B, 0x00, 0x00, 0x2D, 0x07,
+    0x09, 0x04, 0x26, 0x0A, 0x18, 0x00, 0x30, 0x0A, 0x00, 0x00,
+    0x26, 0x0B, 0x08, 0x00, 0x2F, 0x0A, 0x0B, 0x00, 0x17, 0x0B,
+    0x0A, 0x00, 0x26, 0x0C, 0x08, 0x00, 0x2F, 0x0A, 0x0C, 0x00,
+    0x17, 0x0C, 0x0A, 0x00, 0x2C, 0x0B, 0x09, 0x00, 0x40, 0x0A,
+    0x00, 0x00, 0x26, 0x0E, 0x19, 0x00, 0x2C, 0x0E, 0x0B, 0x00,
+    0x3F, 0x0D, 0x00, 0x00, 0x26, 0x0F, 0x1A, 0x00, 0x2D, 0x0F,
+    0x07, 0x0D, 0x3F, 0x0E, 0x00, 0x00, 0x26, 0x0F, 0x1B, 0x00,
+    0x2C, 0x0F, 0x0B, 0x00, 0x3F, 0x0D, 0x00, 0x00, 0x26, 0x10,
+    0x1C, 0x00, 0x26, 0x11, 0x1D, 0x00, 0x2D, 0x10, 0x11, 0x0D,
+    0x3F, 0x0F, 0x00, 0x00, 0x26, 0x10, 0x05, 0x00, 0x2B, 0x10,
+    0x00, 0x00, 0x3F, 0x0D, 0x00, 0x00, 0x26, 0x11, 0x06, 0x00,
+    0x2D, 0x11, 0x0F, 0x0D, 0x3F, 0x10, 0x00, 0x00, 0x26, 0x0F,
+    0x0C, 0x00, 0x23, 0x11, 0x00, 0x00, 0x2D, 0x0F, 0x11, 0x0E,
+    0x2C, 0x10, 0x04, 0x00, 0x3F, 0x0D, 0x00, 0x00, 0x26, 0x0F,
+    0x07, 0x00, 0x2D, 0x0F, 0x0A, 0x0D, 0x3F, 0x0E, 0x00, 0x00,
+    0x03, 0x0E, 0x00, 0x00, 0x80, 0x9D, 0x01, 0xF6, 0x05, 0x02,
+    0x01, 0x08, 0x18, 0x01, 0x00, 0x07, 0x01, 0x00, 0x0B, 0x05,
+    0x02, 0x12, 0x01, 0x01, 0x11, 0x02, 0x08, 0x0C, 0x04, 0x01,
+    0x0B, 0x03, 0x08, 0x0C, 0x01, 0x00, 0x0B, 0x02, 0x04, 0x40,
+    0x02, 0x00, 0x21, 0x01, 0x00, 0x15, 0x08, 0x02, 0x04, 0x04,
+    0x12, 0x12, 0x02, 0x00, 0x0D, 0x0C, 0x0F, 0x0E, 0x0C, 0x02,
+    0x00, 0x07, 0x02, 0x03, 0x06, 0x02, 0x04, 0x06, 0x02, 0x02,
+    0x03, 0x02, 0x00, 0x12, 0x02, 0x04, 0x04, 0x02, 0x07, 0x01,
+    0x15, 0x1B, 0x02, 0x1E, 0x0C, 0x02, 0x00, 0x0B, 0x02, 0x02,
+    0x38, 0x02, 0x00, 0x21, 0x01, 0x00, 0x15, 0x08, 0x02, 0x04,
+    0x04, 0x1E, 0x12, 0x02, 0x00, 0x0D, 0x03, 0x1B, 0x3E, 0x06,
+    0x00, 0x2F, 0x05, 0x02, 0x46, 0x02, 0x00, 0x20, 0x07, 0x00,
+    0x61, 0x02, 0x02, 0x42, 0x05, 0x00, 0x47, 0x02, 0x02, 0x48,
+    0x05, 0x00, 0x45, 0x03, 0x02, 0x2E, 0x06, 0x00, 0x2F, 0x05,
+    0x02, 0x46, 0x02, 0x00, 0x20, 0x07, 0x00, 0x61, 0x02, 0x02,
+    0x34, 0x03, 0x00, 0x3B, 0x03, 0x02, 0x0A, 0x06, 0x02, 0x02,
+    0x1E, 0x02, 0x04, 0x28, 0x02, 0x00, 0x00, 0x25, 0x03, 0x00,
+    0x00, 0x2D, 0x01, 0x00, 0x03, 0x26, 0x03, 0x00, 0x00, 0x30,
+    0x03, 0x00, 0x00, 0x07, 0x01, 0xE6, 0x06, 0x02, 0x04, 0x40,
+    0x04, 0xDA, 0x83, 0xDE, 0xDA, 0x83, 0x84, 0xDA, 0x84, 0x4B,
+    0xDA, 0x82, 0xE0, 0xDA, 0x82, 0xDE, 0xDA, 0x81, 0x5C, 0xDA,
+    0x81, 0x51, 0xD8, 0x06, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+    0xCF, 0x06, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0xDA, 0x80,
+    0xFE, 0xDA, 0x83, 0xE9, 0xDA, 0x83, 0xF5, 0xDA, 0x83, 0xF3,
+    0xDA, 0x80, 0x98, 0xDA, 0x80, 0x96, 0xDA, 0x82, 0x44, 0xDA,
+    0x84, 0x93, 0xD7, 0xCD, 0x02, 0x98, 0x00, 0x00, 0x0E, 0x02,
+    0x02, 0x02, 0x0E, 0x56, 0xCE, 0x03, 0x74, 0x72, 0x79, 0xDA,
+    0x12, 0xDA, 0x55, 0xDA, 0x80, 0x87, 0xDA, 0x80, 0xB5, 0xDA,
+    0x85, 0x8A, 0xDA, 0x82, 0x78, 0xDA, 0x81, 0xDE, 0xDA, 0x81,
+    0x36, 0xDA, 0x81, 0x76, 0xDA, 0x56, 0xDA, 0x80, 0xA1, 0xDA,
+    0x59, 0xDA, 0x58, 0xDA, 0x81, 0xA0, 0xDA, 0x80, 0x89, 0x28,
+    0x02, 0x00, 0x00, 0x37, 0x03, 0x01, 0x00, 0x37, 0x04, 0x03,
+    0x00, 0x17, 0x05, 0x04, 0x00, 0x37, 0x04, 0x03, 0x01, 0x17,
+    0x06, 0x04, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F, 0x03, 0x04,
+    0x00, 0x17, 0x04, 0x03, 0x00, 0x26, 0x07, 0x00, 0x00, 0x2F,
+    0x03, 0x07, 0x00, 0x17, 0x07, 0x03, 0x00, 0x1A, 0x06, 0x2C,
+    0x00, 0x40, 0x03, 0x00, 0x00, 0x26, 0x09, 0x01, 0x00, 0x2D,
+    0x09, 0x03, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x26, 0x09, 0x02,
+    0x00, 0x26, 0x0A, 0x03, 0x00, 0x2D, 0x09, 0x08, 0x0A, 0x3F,
+    0x03, 0x00, 0x00, 0x26, 0x09, 0x04, 0x00, 0x2C, 0x09, 0x04,
+    0x00, 0x3F, 0x08, 0x00, 0x00, 0x2D, 0x04, 0x03, 0x07, 0x2B,
+    0x08, 0x00, 0x00, 0x40, 0x09, 0x00, 0x00, 0x26, 0x08, 0x05,
+    0x00, 0x2C, 0x08, 0x04, 0x00, 0x3F, 0x03, 0x00, 0x00, 0x26,
+    0x0A, 0x06, 0x00, 0x26, 0x0B, 0x07, 0x00, 0x2D, 0x0A, 0x03,
+    0x0B, 0x3F, 0x08, 0x00, 0x00, 0x26, 0x0A, 0x08, 0x00, 0x2D,
+    0x0A, 0x05, 0x07, 0x3F, 0x03, 0x00, 0x00, 0x26, 0x0B, 0x08,
+    0x00, 0x2D, 0x0B, 0x06, 0x04, 0x3F, 0x0A, 0x00, 0x00, 0x25,
+    0x0B, 0x01, 0x00, 0x2C, 0x01, 0x0B, 0x00, 0x26, 0x0C, 0x09,
+    0x00, 0x2F, 0x0B, 0x0C, 0x00, 0x26, 0x0D, 0x0A, 0x00, 0x2D,
+    0x0D, 0x03, 0x0A, 0x2E, 0x0B, 0x00, 0x00, 0x3F, 0x0C, 0x00,
+    0x00, 0x26, 0x0A, 0x0B, 0x00, 0x2D, 0x0A, 0x08, 0x0C, 0x2B,
+    0x07, 0x00, 0x00, 0x3F, 0x03, 0x00, 0x00, 0x26, 0x0A, 0x0C,
+    0x00, 0x2D, 0x0A, 0x09, 0x03, 0x3F, 0x08, 0x00, 0x00, 0x03,
+    0x08, 0x00, 0x00, 0x2C, 0x04, 0x07, 0x00, 0x40, 0x03, 0x00,
+    0x00, 0x40, 0x08, 0x00, 0x00, 0x26, 0x0A, 0x01, 0x00, 0x2D,
+    0x0A, 0x08, 0x00, 0x3F, 0x09, 0x00, 0x00, 0x26, 0x0A, 0x0D,
+    0x00, 0x2C, 0x0A, 0x09, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x2C,
+    0x03, 0x08, 0x00, 0x40, 0x09, 0x00, 0x00, 0x26, 0x08, 0x08,
+    0x00, 0x2D, 0x08, 0x05, 0x07, 0x3F, 0x03, 0x00, 0x00, 0x25,
+    0x08, 0x01, 0x00, 0x2C, 0x01, 0x08, 0x00, 0x26, 0x0A, 0x09,
+    0x00, 0x2F, 0x08, 0x0A, 0x00, 0x26, 0x0B, 0x0A, 0x00, 0x2C,
+    0x0B, 0x03, 0x00, 0x2E, 0x08, 0x00, 0x00, 0x3F, 0x0A, 0x00,
+    0x00, 0x26, 0x08, 0x0B, 0x00, 0x2D, 0x08, 0x04, 0x07, 0x2B,
+    0x0A, 0x00, 0x00, 0x3F, 0x03, 0x00, 0x00, 0x26, 0x0A, 0x0C,
+    0x00, 0x2D, 0x0A, 0x09, 0x03, 0x3F, 0x08, 0x00, 0x00, 0x03,
+    0x08, 0x00, 0x00, 0x28, 0x01, 0xA4, 0x03, 0x02, 0x05, 0x12,
+    0x04, 0x02, 0x02, 0x10, 0x01, 0x01, 0x0F, 0x02, 0x04, 0x10,
+    0x01, 0x03, 0x0F, 0x01, 0x06, 0x04, 0x1B, 0x02, 0x04, 0x04,
+    0x06, 0x4C, 0x0C, 0x05, 0x4B, 0x0E, 0x0A, 0x00, 0x04, 0x02,
+    0x40, 0x0C, 0x01, 0x3F, 0xCF, 0x03, 0x74, 0x72, 0x79, 0xDA,
+    0x2C, 0xDA, 0x2A, 0xDA, 0x09, 0xDA, 0x07, 0xDA, 0x85, 0xA0,
+    0xCF, 0x0F, 0x6D, 0x61, 0x6B, 0x65, 0x2D, 0x69, 0x6D, 0x61,
+    0x67, 0x65, 0x2D, 0x64, 0x69, 0x63, 0x74, 0xDA, 0x83, 0x7D,
+    0xCF, 0x09, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x72, 0x65, 0x61,
+    0x64, 0xDA, 0x81, 0x58, 0xDA, 0x84, 0x74, 0xDA, 0x83, 0x85,
+    0xCF, 0x0A, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x2D, 0x69, 0x6E,
+    0x74, 0x6F, 0xDA, 0x85, 0x69, 0xCF, 0x0B, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x2F, 0x6A, 0x6F, 0x69, 0x6E, 0xDA, 0x81,
+    0x1D, 0xCF, 0x04, 0x77, 0x61, 0x6C, 0x6B, 0xD8, 0x0D, 0x70,
+    0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x69, 0x6E, 0x73, 0x65,
+    0x72, 0x74, 0xCF, 0x0D, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x2F, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0xDA, 0x84, 0xA7,
+    0xDA, 0x84, 0xA6, 0xDA, 0x82, 0x24, 0xDA, 0x82, 0x22, 0xDA,
+    0x83, 0xE7, 0xDA, 0x83, 0xE1, 0xDA, 0x85, 0x16, 0xDA, 0x85,
+    0x14, 0xDA, 0x83, 0x95, 0xDA, 0x83, 0x90, 0xDA, 0x84, 0x87,
+    0xDA, 0x84, 0x83, 0xDA, 0x81, 0x7E, 0xDA, 0x81, 0x7C, 0xDA,
+    0x85, 0x2C, 0xCF, 0x05, 0x65, 0x76, 0x65, 0x6E, 0x3F, 0xDA,
+    0x84, 0x33, 0xDA, 0x84, 0xE6, 0xDA, 0x82, 0xCC, 0xDA, 0x82,
+    0xCA, 0xDA, 0x67, 0xDA, 0x64, 0xDA, 0x82, 0x55, 0xDA, 0x82,
+    0x53, 0xDA, 0x84, 0x28, 0xDA, 0x84, 0x26, 0xDA, 0x84, 0xD6,
+    0xDA, 0x84, 0xD5, 0xDA, 0x81, 0x46, 0xDA, 0x81, 0x43, 0xDA,
+    0x81, 0x30, 0xDA, 0x81, 0x28, 0xDA, 0x81, 0x4F, 0xDA, 0x81,
+    0x4D, 0xD8, 0x0F, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F,
+    0x66, 0x69, 0x6E, 0x64, 0x2D, 0x61, 0x6C, 0x6C, 0xCF, 0x0F,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x69, 0x6E,
+    0x64, 0x2D, 0x61, 0x6C, 0x6C, 0xD7, 0xCD, 0x02, 0x98, 0x00,
+    0x00, 0x05, 0x01, 0x01, 0x01, 0x02, 0x09, 0xCE, 0x02, 0x2B,
+    0x2B, 0xDA, 0x12, 0xDA, 0x21, 0xDA, 0x22, 0x28, 0x01, 0x00,
+    0x00, 0x26, 0x03, 0x00, 0x00, 0x25, 0x04, 0x01, 0x00, 0x2D,
+    0x03, 0x00, 0x04, 0x3F, 0x02, 0x00, 0x00, 0x26, 0x04, 0x01,
+    0x00, 0x2D, 0x04, 0x00, 0x02, 0x3F, 0x03, 0x00, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x07, 0x01, 0xFC, 0x01, 0x02, 0x08, 0x00,
+    0x5C, 0xDA, 0x86, 0xB0, 0xD7, 0xCD, 0x00, 0x09, 0x00, 0x0D,
+    0x06, 0x00, 0x00, 0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x13,
+    0xCE, 0x04, 0x62, 0x61, 0x6E, 0x64, 0x39, 0x01, 0x00, 0x00,
+    0x20, 0x02, 0x01, 0x00, 0x1A, 0x02, 0x03, 0x00, 0x25, 0x03,
+    0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00, 0x20, 0x02, 0x01, 0x01,
+    0x1A, 0x02, 0x05, 0x00, 0x25, 0x03, 0xFF, 0xFF, 0x37, 0x04,
+    0x00, 0x00, 0x0C, 0x03, 0x03, 0x04, 0x03, 0x03, 0x00, 0x00,
+    0x37, 0x03, 0x00, 0x00, 0x25, 0x05, 0x01, 0x00, 0x34, 0x04,
+    0x00, 0x05, 0x0C, 0x03, 0x03, 0x04, 0x05, 0x05, 0x05, 0x01,
+    0x1F, 0x02, 0x05, 0x01, 0x1A, 0x02, 0xFC, 0xFF, 0x03, 0x03,
+    0x00, 0x00, 0xCF, 0x04, 0x62, 0x61, 0x6E, 0x64, 0xDA, 0x81,
+    0xC3, 0xDA, 0x81, 0xBD, 0xDA, 0x39, 0xDA, 0x35, 0xDA, 0x81,
+    0xA1, 0xDA, 0x81, 0x9C, 0xDA, 0x84, 0xB9, 0xDA, 0x84, 0xB7,
+    0xD3, 0x00, 0xCF, 0x0E, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+    0x2F, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0xDA, 0x84,
+    0xBF, 0xCF, 0x0C, 0x66, 0x6C, 0x61, 0x74, 0x74, 0x65, 0x6E,
+    0x2D, 0x69, 0x6E, 0x74, 0x6F, 0xDA, 0x81, 0xED, 0xDA, 0x85,
+    0x82, 0xDA, 0x82, 0x59, 0xDA, 0x82, 0x57, 0xDA, 0x85, 0x0E,
+    0xDA, 0x85, 0x0D, 0xDA, 0x83, 0x65, 0xCF, 0x09, 0x64, 0x65,
+    0x66, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0xDA, 0x83, 0xB1,
+    0xDA, 0x83, 0xAF, 0xDA, 0x81, 0xC7, 0xDA, 0x81, 0xC5, 0xDA,
+    0x84, 0x79, 0xDA, 0x84, 0x77, 0xDA, 0x82, 0x46, 0xDA, 0x82,
+    0x3E, 0xDA, 0x80, 0x8A, 0xDA, 0x80, 0x83, 0xDA, 0x83, 0xD2,
+    0xDA, 0x83, 0xFF, 0xDA, 0x83, 0x61, 0xCF, 0x07, 0x6F, 0x73,
+    0x2F, 0x73, 0x74, 0x61, 0x74, 0xDA, 0x80, 0xBD, 0xDA, 0x80,
+    0xB9, 0xD8, 0x08, 0x6F, 0x73, 0x2F, 0x74, 0x6F, 0x75, 0x63,
+    0x68, 0xCF, 0x08, 0x6F, 0x73, 0x2F, 0x74, 0x6F, 0x75, 0x63,
+    0x68, 0xDA, 0x84, 0xBE, 0xDA, 0x85, 0x48, 0xDA, 0x81, 0xC2,
+    0xDA, 0x81, 0x36, 0xD8, 0x07, 0x69, 0x6E, 0x74, 0x2F, 0x75,
+    0x36, 0x34, 0xCF, 0x07, 0x69, 0x6E, 0x74, 0x2F, 0x75, 0x36,
+    0x34, 0xD7, 0xCD, 0x02, 0xBB, 0x00, 0x00, 0x05, 0x00, 0x00,
+    0xCD, 0x7F, 0xFF, 0xFF, 0xFF, 0x00, 0x06, 0x01, 0xCE, 0x04,
+    0x63, 0x6F, 0x6E, 0x64, 0xDA, 0x12, 0x28, 0x01, 0x00, 0x00,
+    0x2A, 0x02, 0x00, 0x00, 0x17, 0x03, 0x02, 0x00, 0x25, 0x04,
+    0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00,
+    0xCD, 0x02, 0xD8, 0x00, 0x00, 0x0A, 0x01, 0x01, 0x01, 0x02,
+    0x1E, 0x01, 0xDA, 0x49, 0xDA, 0x12, 0xDA, 0x58, 0xDA, 0x57,
+    0x28, 0x01, 0x00, 0x00, 0x27, 0x03, 0x00, 0x00, 0x39, 0x02,
+    0x03, 0x00, 0x07, 0x03, 0x02, 0x00, 0x17, 0x02, 0x03, 0x00,
+    0x25, 0x05, 0x00, 0x00, 0x1F, 0x04, 0x02, 0x05, 0x1A, 0x04,
+    0x02, 0x00, 0x04, 0x00, 0x00, 0x00, 0x25, 0x06, 0x01, 0x00,
+    0x1F, 0x05, 0x02, 0x06, 0x1A, 0x05, 0x04, 0x00, 0x27, 0x07,
+    0x00, 0x00, 0x34, 0x06, 0x07, 0x00, 0x03, 0x06, 0x00, 0x00,
+    0x27, 0x07, 0x00, 0x00, 0x34, 0x06, 0x07, 0x00, 0x25, 0x08,
+    0x01, 0x00, 0x06, 0x07, 0x00, 0x08, 0x27, 0x09, 0x00, 0x00,
+    0x34, 0x08, 0x09, 0x07, 0x25, 0x09, 0x02, 0x00, 0x06, 0x07,
+    0x00, 0x09, 0x2B, 0x07, 0x00, 0x00, 0x2F, 0x09, 0x01, 0x00,
+    0x26, 0x07, 0x00, 0x00, 0x2D, 0x07, 0x06, 0x08, 0x2B, 0x09,
+    0x00, 0x00, 0x26, 0x07, 0x01, 0x00, 0x30, 0x07, 0x00, 0x00,
+    0xBF, 0xFF, 0x2E, 0x01, 0xCA, 0x02, 0x06, 0x02, 0x02, 0x24,
+    0x01, 0x00, 0x05, 0x01, 0x00, 0x19, 0x02, 0x02, 0x08, 0x02,
+    0x00, 0x07, 0x02, 0x02, 0x0C, 0x01, 0x00, 0x07, 0x03, 0x00,
+    0x24, 0x02, 0x02, 0x09, 0x02, 0x02, 0x0C, 0x02, 0x00, 0x13,
+    0x02, 0x02, 0x0A, 0x02, 0x00, 0x09, 0x05, 0x03, 0x0D, 0x0A,
+    0x01, 0xBE, 0x02, 0x02, 0x02, 0x0C, 0x04, 0x03, 0x0E, 0x00,
+    0xCF, 0x04, 0x63, 0x6F, 0x6E, 0x64, 0xDA, 0x80, 0x89, 0xDA,
+    0x82, 0x33, 0xDA, 0x82, 0xEC, 0xDA, 0x82, 0xE6, 0xDA, 0x81,
+    0x82, 0xDA, 0x81, 0x80, 0xDA, 0x83, 0x39, 0xDA, 0x84, 0x4E,
+    0xDA, 0x85, 0xBD, 0xCF, 0x03, 0x73, 0x75, 0x6D, 0xDA, 0x81,
+    0x3E, 0xDA, 0x84, 0x71, 0xDA, 0x80, 0xA0, 0xCF, 0x0C, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2F, 0x63, 0x6F, 0x6E, 0x63, 0x61,
+    0x74, 0xDA, 0x85, 0x1C, 0xDA, 0x85, 0x1B, 0xD7, 0xCD, 0x02,
+    0x99, 0x00, 0x00, 0x07, 0x01, 0x01, 0xCD, 0x7F, 0xFF, 0xFF,
+    0xFF, 0x02, 0x0B, 0xCE, 0x06, 0x75, 0x6E, 0x6C, 0x65, 0x73,
+    0x73, 0xDA, 0x12, 0xDA, 0x59, 0xDA, 0x58, 0x28, 0x02, 0x00,
+    0x00, 0x26, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2E,
+    0x01, 0x00, 0x00, 0x3F, 0x03, 0x00, 0x00, 0x26, 0x05, 0x01,
+    0x00, 0x22, 0x06, 0x00, 0x00, 0x2D, 0x05, 0x00, 0x06, 0x2B,
+    0x03, 0x00, 0x00, 0x3F, 0x04, 0x00, 0x00, 0x03, 0x04, 0x00,
+    0x00, 0x07, 0x01, 0xB4, 0x02, 0x02, 0x0A, 0x06, 0x04, 0xCF,
+    0x06, 0x75, 0x6E, 0x6C, 0x65, 0x73, 0x73, 0xDA, 0x84, 0xC2,
+    0xDA, 0x84, 0xC1, 0xDA, 0x83, 0xF9, 0xDA, 0x83, 0xF7, 0xDA,
+    0x3F, 0xDA, 0x3B, 0xDA, 0x83, 0x57, 0xDA, 0x85, 0x28, 0xDA,
+    0x85, 0x97, 0xDA, 0x85, 0x96, 0xD8, 0x04, 0x68, 0x61, 0x73,
+    0x68, 0xCF, 0x04, 0x68, 0x61, 0x73, 0x68, 0xDA, 0x81, 0x1B,
+    0xDA, 0x83, 0xDD, 0xDA, 0x80, 0x90, 0xDA, 0x80, 0x8C, 0xDA,
+    0x83, 0x70, 0xDA, 0x85, 0x7F, 0xDA, 0x82, 0x20, 0xDA, 0x82,
+    0x1E, 0xD8, 0x05, 0x6F, 0x73, 0x2F, 0x72, 0x6D, 0xCF, 0x05,
+    0x6F, 0x73, 0x2F, 0x72, 0x6D, 0xDA, 0x84, 0xC4, 0xDA, 0x84,
+    0xC3, 0xDA, 0x83, 0x20, 0xDA, 0x83, 0x1C, 0xDA, 0x84, 0x46,
+    0xDA, 0x84, 0x42, 0xDA, 0x81, 0xC7, 0x28, 0x01, 0x00, 0x00,
+    0x26, 0x02, 0x00, 0x00, 0x2B, 0x02, 0x00, 0x00, 0x26, 0x03,
+    0x01, 0x00, 0x2F, 0x02, 0x03, 0x00, 0x17, 0x03, 0x02, 0x00,
+    0x25, 0x04, 0x01, 0x00, 0x2C, 0x03, 0x04, 0x00, 0x26, 0x05,
+    0x02, 0x00, 0x2F, 0x04, 0x05, 0x00, 0x26, 0x05, 0x03, 0x00,
+    0x26, 0x06, 0x04, 0x00, 0x2D, 0x03, 0x05, 0x06, 0x26, 0x06,
+    0x05, 0x00, 0x2F, 0x05, 0x06, 0x00, 0x26, 0x06, 0x06, 0x00,
+    0x2D, 0x00, 0x06, 0x03, 0x26, 0x06, 0x07, 0x00, 0x30, 0x06,
+    0x00, 0x00, 0x13, 0x01, 0xB6, 0x1C, 0x02, 0x04, 0x0A, 0x1C,
+    0x01, 0x00, 0x17, 0x04, 0x02, 0x00, 0x05, 0x02, 0x00, 0x04,
+    0x02, 0x00, 0xDA, 0x87, 0x4E, 0xDA, 0x87, 0x4D, 0xDA, 0x86,
+    0x50, 0xDA, 0x84, 0x9F, 0xDA, 0x87, 0x3B, 0xDA, 0x87, 0x3A,
+    0xDA, 0x86, 0x54, 0xDA, 0x86, 0x53, 0xDA, 0x86, 0xD3, 0xDA,
+    0x86, 0xD2, 0xDA, 0x86, 0x77, 0xDA, 0x81, 0x2F, 0xDA, 0x86,
+    0xA9, 0xDA, 0x86, 0xA8, 0xDA, 0x86, 0x5B, 0xDA, 0x86, 0x5A,
+    0xDA, 0x86, 0xA4, 0xDA, 0x81, 0x77, 0xDA, 0x86, 0xE9, 0xDA,
+    0x81, 0x16, 0xDA, 0x85, 0xC3, 0xDA, 0x85, 0xC2, 0xDA, 0x86,
+    0x8C, 0xDA, 0x83, 0x25, 0xDA, 0x86, 0xBB, 0xDA, 0x86, 0xBA,
+    0xDA, 0x87, 0x4C, 0xDA, 0x87, 0x4B, 0xDA, 0x86, 0xD0, 0xDA,
+    0x86, 0xCF, 0xDA, 0x86, 0xE2, 0xDA, 0x82, 0xAD, 0xDA, 0x85,
+    0xB8, 0xDA, 0x85, 0xB7, 0xDA, 0x86, 0x72, 0xDA, 0x86, 0x71,
+    0xDA, 0x86, 0xE1, 0xDA, 0x86, 0xE0, 0xDA, 0x87, 0x2D, 0xDA,
+    0x83, 0x85, 0xDA, 0x86, 0xCC, 0xDA, 0x86, 0xCB, 0xDA, 0x86,
+    0xE8, 0xDA, 0x86, 0xE7, 0xDA, 0x86, 0x4A, 0xDA, 0x86, 0x49,
+    0xDA, 0x87, 0x42, 0xDA, 0x87, 0x41, 0xDA, 0x86, 0x90, 0xDA,
+    0x85, 0xE0, 0xDA, 0x85, 0xA5, 0xDA, 0x85, 0xA4, 0xDA, 0x86,
+    0xC8, 0xDA, 0x86, 0xC7, 0xDA, 0x86, 0x61, 0xDA, 0x86, 0x60,
+    0xDA, 0x85, 0xAF, 0xDA, 0x85, 0xAE, 0xDA, 0x86, 0x92, 0xDA,
+    0x86, 0x91, 0xDA, 0x86, 0x99, 0xDA, 0x86, 0x98, 0xDA, 0x85,
+    0xC0, 0xDA, 0x83, 0x1D, 0xDA, 0x86, 0xA0, 0xDA, 0x84, 0xA3,
+    0xDA, 0x86, 0x42, 0xDA, 0x86, 0x41, 0xDA, 0x85, 0xB5, 0xDA,
+    0x85, 0xB4, 0xDA, 0x86, 0x4D, 0xDA, 0x86, 0x4C, 0xDA, 0x86,
+    0xBE, 0xDA, 0x86, 0xBD, 0xDA, 0x87, 0x31, 0xDA, 0x87, 0x30,
+    0xDA, 0x86, 0x82, 0xDA, 0x86, 0x81, 0xDA, 0x85, 0xA3, 0xDA,
+    0x85, 0x90, 0xDA, 0x86, 0x93, 0xDA, 0x83, 0x64, 0xDA, 0x86,
+    0xC2, 0xDA, 0x83, 0xC8, 0xDA, 0x86, 0x66, 0xDA, 0x86, 0x65,
+    0xDA, 0x86, 0x0D, 0xDA, 0x83, 0x69, 0xDA, 0x87, 0x06, 0xDA,
+    0x87, 0x05, 0xDA, 0x86, 0x51, 0xDA, 0x82, 0xAB, 0xDA, 0x86,
+    0x96, 0xDA, 0x86, 0x95, 0xDA, 0x86, 0x44, 0xDA, 0x86, 0x43,
+    0xDA, 0x87, 0x2B, 0xDA, 0x85, 0xA0, 0xDA, 0x86, 0x58, 0xDA,
+    0x86, 0x57, 0xDA, 0x87, 0x47, 0xDA, 0x80, 0xA0, 0xDA, 0x86,
+    0x07, 0xDA, 0x86, 0x06, 0xDA, 0x86, 0xEF, 0xDA, 0x86, 0xEE,
+    0xDA, 0x87, 0x3E, 0xDA, 0x83, 0x61, 0xDA, 0x87, 0x34, 0xDA,
+    0x87, 0x33, 0xDA, 0x85, 0xD3, 0xDA, 0x86, 0x0F, 0xDA, 0x85,
+    0xAC, 0xDA, 0x82, 0x78, 0xDA, 0x86, 0x6B, 0xDA, 0x86, 0x6A,
+    0xDA, 0x86, 0xE3, 0xDA, 0x82, 0xEB, 0xDA, 0x85, 0x4B, 0xDA,
+    0x85, 0x4A, 0xDA, 0x86, 0xAA, 0xDA, 0x85, 0x65, 0xDA, 0x86,
+    0x9A, 0xDA, 0x85, 0x67, 0xDA, 0x86, 0xF5, 0xDA, 0x86, 0xF4,
+    0xDA, 0x86, 0x97, 0xDA, 0x85, 0x68, 0xDA, 0x86, 0x37, 0xDA,
+    0x86, 0x12, 0xDA, 0x86, 0x7B, 0xDA, 0x86, 0x7A, 0xDA, 0x85,
+    0xA8, 0xDA, 0x85, 0xA7, 0xDA, 0x86, 0x4F, 0xDA, 0x82, 0xBA,
+    0xDA, 0x86, 0xD6, 0xDA, 0x86, 0x00, 0xDA, 0x86, 0x40, 0xDA,
+    0x86, 0x3F, 0xDA, 0x86, 0xC3, 0xDA, 0x85, 0x63, 0xDA, 0x86,
+    0x9D, 0xDA, 0x80, 0xFA, 0xDA, 0x86, 0x7C, 0xDA, 0x83, 0x5B,
+    0xDA, 0x85, 0xBA, 0xDA, 0x85, 0xB9, 0xDA, 0x85, 0xD4, 0xDA,
+    0x83, 0x81, 0xDA, 0x87, 0x40, 0xDA, 0x87, 0x3F, 0xDA, 0x86,
+    0xEA, 0xDA, 0x85, 0xF2, 0xDA, 0x86, 0xDA, 0xDA, 0x86, 0xD9,
+    0xDA, 0x85, 0xAB, 0xDA, 0x85, 0xAA, 0xDA, 0x85, 0x48, 0xDA,
+    0x84, 0xBE, 0xDA, 0x86, 0xE6, 0xDA, 0x86, 0xE5, 0xDA, 0x86,
+    0x39, 0xDA, 0x86, 0x38, 0xDA, 0x86, 0xD8, 0xDA, 0x86, 0xD7,
+    0xDA, 0x86, 0xF6, 0xDA, 0x82, 0xB2, 0xDA, 0x86, 0x85, 0xDA,
+    0x86, 0x84, 0xDA, 0x86, 0xA1, 0xDA, 0x55, 0xDA, 0x85, 0xA2,
+    0xDA, 0x85, 0xA1, 0xDA, 0x85, 0xC1, 0xDA, 0x81, 0x1A, 0xDA,
+    0x86, 0xA2, 0xDA, 0x81, 0x56, 0xDA, 0x86, 0xA7, 0xDA, 0x86,
+    0xA6, 0xDA, 0x83, 0xDE, 0xDA, 0x87, 0x25, 0xDA, 0x85, 0xA9,
+    0xDA, 0x46, 0xDA, 0x86, 0x59, 0xDA, 0x80, 0xB5, 0xDA, 0x85,
+    0xBF, 0xDA, 0x85, 0xBE, 0xDA, 0x86, 0x80, 0xDA, 0x86, 0x7F,
+    0xDA, 0x86, 0xC0, 0xDA, 0x86, 0xBF, 0xDA, 0x86, 0xD5, 0xDA,
+    0x86, 0xD4, 0xDA, 0x86, 0x4B, 0xDA, 0x83, 0x74, 0xDA, 0x86,
+    0xCE, 0xDA, 0x86, 0xCD, 0xDA, 0x86, 0xED, 0xDA, 0x86, 0xEC,
+    0xDA, 0x87, 0x2E, 0xDA, 0x85, 0x69, 0xDA, 0x85, 0xB2, 0xDA,
+    0x85, 0xB1, 0xDA, 0x86, 0x8F, 0xDA, 0x00, 0xDA, 0x85, 0xD6,
+    0xDA, 0x86, 0xC5, 0xDA, 0x86, 0xC1, 0xDA, 0x86, 0x5F, 0xDA,
+    0x86, 0x9B, 0xDA, 0x81, 0xF9, 0xDA, 0x87, 0x2A, 0xDA, 0x87,
+    0x29, 0xDA, 0x86, 0xF9, 0xDA, 0x86, 0xF8, 0xDA, 0x86, 0xF3,
+    0xDA, 0x86, 0xF2, 0xDA, 0x86, 0x7D, 0xDA, 0x82, 0x45, 0xDA,
+    0x86, 0x8B, 0xDA, 0x86, 0x8A, 0xDA, 0x87, 0x02, 0xDA, 0x87,
+    0x01, 0xDA, 0x86, 0xFC, 0xDA, 0x86, 0xFB, 0xDA, 0x86, 0x70,
+    0xDA, 0x86, 0x6F, 0xDA, 0x86, 0x0C, 0xDA, 0x86, 0x0B, 0xDA,
+    0x86, 0x63, 0xDA, 0x86, 0x62, 0xDA, 0x86, 0x09, 0xDA, 0x86,
+    0x08, 0xDA, 0x86, 0xB3, 0xDA, 0x86, 0xB2, 0xDA, 0x87, 0x2F,
+    0xDA, 0x81, 0x1D, 0xDA, 0x86, 0x8E, 0xDA, 0x86, 0x8D, 0xDA,
+    0x86, 0x68, 0xDA, 0x86, 0x67, 0xDA, 0x87, 0x46, 0xDA, 0x85,
+    0xBD, 0xDA, 0x87, 0x3C, 0xDA, 0x84, 0xBF, 0xDA, 0x87, 0x4A,
+    0xDA, 0x87, 0x49, 0xDA, 0x86, 0x89, 0xDA, 0x84, 0x3B, 0xDA,
+    0x86, 0x86, 0xDA, 0x84, 0xA5, 0xDA, 0x85, 0xD5, 0xDA, 0x85,
+    0xFC, 0xDA, 0x86, 0xB5, 0xDA, 0x86, 0xB4, 0xDA, 0x87, 0x2C,
+    0xDA, 0x83, 0x7D, 0xDA, 0x83, 0xDD, 0xDA, 0x81, 0x1B, 0xDA,
+    0x86, 0x76, 0xDA, 0x86, 0x75, 0xDA, 0x86, 0x9F, 0xDA, 0x86,
+    0x9E, 0xDA, 0x86, 0xC9, 0xDA, 0x82, 0x61, 0xDA, 0x86, 0x78,
+    0xDA, 0x83, 0x6D, 0xDA, 0x86, 0x11, 0xDA, 0x86, 0x10, 0xDA,
+    0x85, 0xAD, 0xDA, 0x4C, 0xDA, 0x86, 0x88, 0xDA, 0x86, 0x87,
+    0xDA, 0x87, 0x3D, 0xDA, 0x83, 0x65, 0xDA, 0x87, 0x45, 0xDA,
+    0x87, 0x44, 0xDA, 0x81, 0xA0, 0xDA, 0x86, 0xDD, 0xDA, 0x86,
+    0x48, 0xDA, 0x83, 0x1B, 0xDA, 0x87, 0x07, 0xDA, 0x83, 0x7F,
+    0xDA, 0x87, 0x32, 0xDA, 0x85, 0x2C, 0xDA, 0x86, 0x47, 0xDA,
+    0x86, 0x46, 0xDA, 0x86, 0xFE, 0xDA, 0x86, 0xFD, 0xDA, 0x86,
+    0xDF, 0xDA, 0x86, 0xDE, 0xDA, 0x86, 0xA3, 0xDA, 0x84, 0xA1,
+    0xDA, 0x85, 0xD7, 0xDA, 0x86, 0xF1, 0xDA, 0x87, 0x39, 0xDA,
+    0x87, 0x38, 0xDA, 0x86, 0x4E, 0xDA, 0x84, 0x9D, 0xDA, 0x87,
+    0x00, 0xDA, 0x86, 0xFF, 0xDA, 0x87, 0x04, 0xDA, 0x87, 0x03,
+    0xDA, 0x86, 0xAD, 0xDA, 0x86, 0xAC, 0xDA, 0x86, 0xB8, 0xDA,
+    0x86, 0xB7, 0xDA, 0x86, 0x94, 0xDA, 0x82, 0xBE, 0xDA, 0x83,
+    0x1C, 0xDA, 0x83, 0x20, 0xDA, 0x86, 0x56, 0xDA, 0x86, 0x55,
+    0xDA, 0x87, 0x27, 0xDA, 0x87, 0x26, 0xDA, 0x86, 0x3B, 0xDA,
+    0x86, 0x3A, 0xDA, 0x86, 0x3D, 0xDA, 0x86, 0x3C, 0xDA, 0x86,
+    0xB0, 0xDA, 0x87, 0x36, 0xDA, 0x86, 0x9C, 0xDA, 0x81, 0x5A,
+    0xDA, 0x80, 0x98, 0x28, 0x01, 0x00, 0x00, 0x26, 0x02, 0x00,
+    0x00, 0x2C, 0x02, 0x00, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2F,
+    0x02, 0x03, 0x00, 0x1A, 0x02, 0x36, 0x00, 0x26, 0x04, 0x00,
+    0x00, 0x39, 0x03, 0x04, 0x00, 0x17, 0x04, 0x03, 0x00, 0x35,
+    0x03, 0x00, 0x04, 0x17, 0x05, 0x03, 0x00, 0x25, 0x06, 0x01,
+    0x00, 0x1F, 0x03, 0x05, 0x06, 0x1A, 0x03, 0x02, 0x00, 0x18,
+    0x06, 0x00, 0x00, 0x26, 0x06, 0x02, 0x00, 0x2C, 0x06, 0x05,
+    0x00, 0x26, 0x07, 0x03, 0x00, 0x2F, 0x06, 0x07, 0x00, 0x01,
+    0x06, 0x00, 0x00, 0x26, 0x03, 0x04, 0x00, 0x2D, 0x03, 0x00,
+    0x04, 0x26, 0x06, 0x05, 0x00, 0x2F, 0x03, 0x06, 0x00, 0x17,
+    0x06, 0x03, 0x00, 0x1A, 0x06, 0x03, 0x00, 0x17, 0x03, 0x06,
+    0x00, 0x18, 0x09, 0x00, 0x00, 0x26, 0x07, 0x06, 0x00, 0x01,
+    0x07, 0x00, 0x00, 0x22, 0x07, 0x00, 0x00, 0x1A, 0x07, 0x03,
+    0x00, 0x17, 0x08, 0x07, 0x00, 0x18, 0x02, 0x00, 0x00, 0x22,
+    0x08, 0x00, 0x00, 0x17, 0x03, 0x08, 0x00, 0x17, 0x06, 0x03,
+    0x00, 0x25, 0x07, 0x01, 0x00, 0x06, 0x03, 0x07, 0x04, 0x2D,
+    0x00, 0x03, 0x06, 0x26, 0x08, 0x07, 0x00, 0x2F, 0x07, 0x08,
+    0x00, 0x17, 0x03, 0x07, 0x00, 0x26, 0x08, 0x08, 0x00, 0x1F,
+    0x07, 0x03, 0x08, 0x1A, 0x07, 0x02, 0x00, 0x18, 0x07, 0x00,
+    0x00, 0x26, 0x08, 0x09, 0x00, 0x26, 0x09, 0x08, 0x00, 0x2D,
+    0x08, 0x03, 0x09, 0x26, 0x09, 0x03, 0x00, 0x2F, 0x08, 0x09,
+    0x00, 0x01, 0x08, 0x00, 0x00, 0x25, 0x08, 0x01, 0x00, 0x06,
+    0x07, 0x08, 0x06, 0x26, 0x08, 0x0A, 0x00, 0x2D, 0x00, 0x08,
+    0x07, 0x26, 0x08, 0x0B, 0x00, 0x30, 0x08, 0x00, 0x00, 0x26,
+    0x03, 0x0A, 0x00, 0x2C, 0x00, 0x03, 0x00, 0x26, 0x03, 0x0B,
+    0x00, 0x30, 0x03, 0x00, 0x00, 0x4F, 0x01, 0xCA, 0x1C, 0x02,
+    0x04, 0x0A, 0x0C, 0x01, 0x00, 0x07, 0x02, 0x04, 0x1E, 0x01,
+    0x00, 0x15, 0x01, 0x02, 0x18, 0x01, 0x00, 0x17, 0x02, 0x02,
+    0x10, 0x02, 0x00, 0x0F, 0x04, 0x02, 0x12, 0x01, 0x00, 0x0D,
+    0x04, 0x02, 0x16, 0x04, 0x00, 0x07, 0x02, 0x02, 0x08, 0x06,
+    0x01, 0x07, 0x01, 0x00, 0x11, 0x02, 0x04, 0x42, 0x03, 0x00,
+    0x27, 0x01, 0x00, 0x19, 0x02, 0x02, 0x10, 0x02, 0x00, 0x0F,
+    0x05, 0x02, 0x12, 0x01, 0x00, 0x0D, 0x02, 0x04, 0x3E, 0x04,
+    0x00, 0x41, 0x04, 0x02, 0x03, 0x2B, 0x00, 0x00, 0x00, 0x26,
+    0x02, 0x00, 0x00, 0x2F, 0x01, 0x02, 0x00, 0x2B, 0x01, 0x00,
+    0x00, 0x26, 0x02, 0x01, 0x00, 0x30, 0x02, 0x00, 0x00, 0x07,
+    0x03, 0x98, 0x1F, 0x4A, 0x03, 0x00, 0x17, 0xDA, 0x83, 0x41,
+    0xD7, 0xCD, 0x02, 0x90, 0x00, 0x00, 0x03, 0x01, 0x01, 0xCD,
+    0x7F, 0xFF, 0xFF, 0xFF, 0x02, 0x05, 0xDA, 0x12, 0xDA, 0x83,
+    0x73, 0xDA, 0x82, 0x20, 0x26, 0x02, 0x00, 0x00, 0x2F, 0x01,
+    0x02, 0x00, 0x2C, 0x00, 0x01, 0x00, 0x26, 0x02, 0x01, 0x00,
+    0x30, 0x02, 0x00, 0x00, 0x07, 0x02, 0x8C, 0x1F, 0x4E, 0x03,
+    0x00, 0x19, 0xDA, 0x82, 0x9B, 0xD7, 0xCD, 0x02, 0x90, 0x00,
+    0x00, 0x06, 0x02, 0x02, 0x02, 0x02, 0x0C, 0xDA, 0x12, 0xDA,
+    0x87, 0x3A, 0xDA, 0x83, 0x81, 0x26, 0x02, 0x00, 0x00, 0x23,
+    0x03, 0x00, 0x00, 0x36, 0x02, 0x00, 0x03, 0x2B, 0x00, 0x00,
+    0x00, 0x2E, 0x01, 0x00, 0x00, 0x26, 0x03, 0x01, 0x00, 0x2F,
+    0x02, 0x03, 0x00, 0x17, 0x03, 0x02, 0x00, 0x26, 0x04, 0x00,
+    0x00, 0x22, 0x05, 0x00, 0x00, 0x36, 0x04, 0x00, 0x05, 0x03,
+    0x03, 0x00, 0x00, 0x10, 0x03, 0x90, 0x1F, 0x1E, 0x04, 0x02,
+    0x18, 0x01, 0x00, 0x17, 0x03, 0x02, 0x00, 0x01, 0x05, 0x03,
+    0xCE, 0x0C, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x74,
+    0x79, 0x70, 0x65, 0x20, 0xCE, 0x08, 0x20, 0x75, 0x6E, 0x6B,
+    0x6E, 0x6F, 0x77, 0x6E, 0xDA, 0x81, 0x5A, 0x28, 0x02, 0x00,
+    0x00, 0x2B, 0x00, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x2F,
+    0x03, 0x04, 0x00, 0x37, 0x04, 0x03, 0x00, 0x17, 0x05, 0x04,
+    0x00, 0x37, 0x04, 0x03, 0x01, 0x17, 0x06, 0x04, 0x00, 0x1A,
+    0x05, 0x02, 0x00, 0x18, 0x02, 0x00, 0x00, 0x01, 0x06, 0x00,
+    0x00, 0x26, 0x07, 0x01, 0x00, 0x34, 0x04, 0x07, 0x05, 0x17,
+    0x07, 0x04, 0x00, 0x1A, 0x07, 0x02, 0x00, 0x03, 0x07, 0x00,
+    0x00, 0x2B, 0x06, 0x00, 0x00, 0x26, 0x08, 0x02, 0x00, 0x2F,
+    0x04, 0x08, 0x00, 0x17, 0x08, 0x04, 0x00, 0x1A, 0x08, 0x02,
+    0x00, 0x18, 0x07, 0x00, 0x00, 0x26, 0x04, 0x03, 0x00, 0x26,
+    0x09, 0x04, 0x00, 0x2D, 0x04, 0x06, 0x09, 0x26, 0x09, 0x05,
+    0x00, 0x2F, 0x04, 0x09, 0x00, 0x01, 0x04, 0x00, 0x00, 0x2C,
+    0x05, 0x01, 0x00, 0x2F, 0x04, 0x08, 0x00, 0x17, 0x09, 0x04,
+    0x00, 0x26, 0x04, 0x01, 0x00, 0x36, 0x04, 0x05, 0x09, 0x03,
+    0x09, 0x00, 0x00, 0x31, 0x01, 0x9C, 0x1F, 0x02, 0x03, 0x0A,
+    0x36, 0x04, 0x00, 0x31, 0x02, 0x02, 0x00, 0x01, 0x00, 0x22,
+    0x02, 0x02, 0x03, 0x03, 0x00, 0x1D, 0x03, 0x06, 0x20, 0x01,
+    0x00, 0x17, 0x02, 0x02, 0x00, 0x05, 0x00, 0x2C, 0x01, 0x00,
+    0x0D, 0x02, 0x02, 0x0B, 0x01, 0x00, 0x11, 0x02, 0x02, 0x00,
+    0x01, 0x07, 0x03, 0xDA, 0x05, 0xCE, 0x80, 0xD8, 0x28, 0x72,
+    0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x20, 0x70, 0x61, 0x74,
+    0x68, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x20, 0x61,
+    0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x69, 0x76,
+    0x65, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x2E, 0x20, 0x57,
+    0x69, 0x6C, 0x6C, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68,
+    0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x20, 0x69, 0x6E,
+    0x20, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x70,
+    0x61, 0x74, 0x68, 0x73, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x6E,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20,
+    0x61, 0x73, 0x20, 0x61, 0x20, 0x72, 0x61, 0x77, 0x20, 0x66,
+    0x69, 0x6C, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x65, 0x6E, 0x76, 0x69,
+    0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x69,
+    0x6E, 0x67, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x75, 0x6E,
+    0x6E, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x6C, 0x65, 0x2E, 0xDA, 0x84, 0xA9, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x83, 0x79, 0xDA, 0x05, 0xCE, 0x82, 0x5E, 0x28,
+    0x66, 0x69, 0x6C, 0x65, 0x2F, 0x6F, 0x70, 0x65, 0x6E, 0x20,
+    0x70, 0x61, 0x74, 0x68, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20,
+    0x6D, 0x6F, 0x64, 0x65, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20,
+    0x62, 0x75, 0x66, 0x73, 0x69, 0x7A, 0x29, 0x0A, 0x0A, 0x4F,
+    0x70, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65,
+    0x2E, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x69, 0x73, 0x20,
+    0x61, 0x6E, 0x20, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74,
+    0x65, 0x20, 0x6F, 0x72, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74,
+    0x69, 0x76, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2C, 0x20,
+    0x6D, 0x6F, 0x64, 0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20,
+    0x73, 0x65, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x6C, 0x61,
+    0x67, 0x73, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x61, 0x74,
+    0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F,
+    0x64, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x6F, 0x70, 0x65, 0x6E,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+    0x69, 0x6E, 0x2E, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x69, 0x73,
+    0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64,
+    0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x65, 0x61, 0x63,
+    0x68, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65,
+    0x72, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E,
+    0x74, 0x73, 0x20, 0x61, 0x20, 0x66, 0x6C, 0x61, 0x67, 0x2E,
+    0x62, 0x75, 0x66, 0x73, 0x69, 0x7A, 0x20, 0x69, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x62,
+    0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x63, 0x61,
+    0x63, 0x68, 0x69, 0x6E, 0x67, 0x2E, 0x69, 0x66, 0x20, 0x62,
+    0x75, 0x66, 0x73, 0x69, 0x7A, 0x20, 0x69, 0x73, 0x20, 0x65,
+    0x71, 0x75, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x7A, 0x65,
+    0x72, 0x6F, 0x2C, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x69, 0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x64, 0x69, 0x73,
+    0x61, 0x62, 0x6C, 0x65, 0x64, 0x2E, 0x49, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x61,
+    0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x6F, 0x70,
+    0x65, 0x6E, 0x65, 0x64, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2C, 0x20, 0x6F,
+    0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x68,
+    0x61, 0x6E, 0x64, 0x6C, 0x65, 0x2E, 0x20, 0x4D, 0x6F, 0x64,
+    0x65, 0x20, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x3A, 0x0A, 0x0A,
+    0x09, 0x72, 0x20, 0x2D, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77,
+    0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x66,
+    0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x0A, 0x09, 0x77, 0x20, 0x2D, 0x20, 0x61, 0x6C,
+    0x6C, 0x6F, 0x77, 0x20, 0x77, 0x72, 0x69, 0x74, 0x69, 0x6E,
+    0x67, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x6C, 0x65, 0x0A, 0x09, 0x61, 0x20, 0x2D, 0x20, 0x61,
+    0x70, 0x70, 0x65, 0x6E, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x0A, 0x09, 0x62,
+    0x20, 0x2D, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20,
+    0x62, 0x69, 0x6E, 0x61, 0x72, 0x79, 0x20, 0x6D, 0x6F, 0x64,
+    0x65, 0x20, 0x28, 0x72, 0x61, 0x74, 0x68, 0x65, 0x72, 0x20,
+    0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x65, 0x78, 0x74, 0x20,
+    0x6D, 0x6F, 0x64, 0x65, 0x29, 0x0A, 0x09, 0x2B, 0x20, 0x2D,
+    0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x20, 0x74, 0x6F,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+    0x69, 0x6E, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66,
+    0x20, 0x6F, 0x76, 0x65, 0x72, 0x77, 0x72, 0x69, 0x74, 0x69,
+    0x6E, 0x67, 0x20, 0x69, 0x74, 0xDA, 0x84, 0xAA, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x84, 0xAB, 0xDA, 0x05, 0xCE, 0x80, 0xA7,
+    0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65,
+    0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x70, 0x61, 0x74, 0x74,
+    0x20, 0x73, 0x75, 0x62, 0x73, 0x74, 0x20, 0x73, 0x74, 0x72,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+    0x20, 0x6F, 0x63, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x63,
+    0x65, 0x20, 0x6F, 0x66, 0x20, 0x70, 0x61, 0x74, 0x74, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x75, 0x62, 0x73, 0x74,
+    0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x72, 0x2E, 0x20,
+    0x57, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x66, 0x20,
+    0x70, 0x61, 0x74, 0x74, 0x20, 0x69, 0x73, 0x20, 0x66, 0x6F,
+    0x75, 0x6E, 0x64, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72,
+    0x77, 0x69, 0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x73, 0x74, 0x72, 0x2E, 0xDA, 0x84, 0xAC,
+    0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x82,
+    0x20, 0x01, 0xDA, 0x03, 0xDA, 0x84, 0xAE, 0xDA, 0x24, 0xCB,
+    0xDA, 0x05, 0xCE, 0x41, 0x28, 0x77, 0x68, 0x65, 0x6E, 0x2D,
+    0x6C, 0x65, 0x74, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x73, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29,
+    0x0A, 0x0A, 0x53, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x73, 0x20,
+    0x28, 0x69, 0x66, 0x2D, 0x6C, 0x65, 0x74, 0x20, 0x62, 0x69,
+    0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x28, 0x64, 0x6F,
+    0x20, 0x3B, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x29, 0x2E, 0xDA,
+    0x84, 0xAF, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x59, 0x01, 0xDA, 0x03, 0xDA, 0x83, 0x5A, 0xDA, 0x05,
+    0xCE, 0x3A, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65,
+    0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73,
+    0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x63,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x2E,
+    0xDA, 0x84, 0xB0, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x84, 0xB1,
+    0xDA, 0x05, 0xCE, 0x4E, 0x28, 0x6F, 0x73, 0x2F, 0x72, 0x65,
+    0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6F, 0x6C, 0x64, 0x6E, 0x61,
+    0x6D, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x6E, 0x61, 0x6D, 0x65,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x6E, 0x61, 0x6D, 0x65, 0x20,
+    0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6F, 0x6E, 0x20,
+    0x64, 0x69, 0x73, 0x6B, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20,
+    0x6E, 0x65, 0x77, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69,
+    0x6C, 0x2E, 0xDA, 0x84, 0xB2, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x84, 0xB4, 0xDA, 0x05, 0xCE, 0x4E, 0x28, 0x65, 0x72, 0x72,
+    0x6F, 0x72, 0x20, 0x65, 0x29, 0x0A, 0x0A, 0x54, 0x68, 0x72,
+    0x6F, 0x77, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72,
+    0x6F, 0x72, 0x20, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x63, 0x61, 0x75,
+    0x67, 0x68, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x68, 0x61,
+    0x6E, 0x64, 0x6C, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61,
+    0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x2E, 0xDA, 0x84, 0xB5, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x84, 0xB6, 0xDA, 0x05, 0xCE, 0x81, 0x2E, 0x28,
+    0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x6C, 0x69, 0x6E, 0x65,
+    0x61, 0x67, 0x65, 0x20, 0x66, 0x69, 0x62, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x6E,
+    0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20,
+    0x61, 0x6C, 0x6C, 0x20, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x20,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x73, 0x20, 0x66, 0x72, 0x6F,
+    0x6D, 0x20, 0x61, 0x20, 0x72, 0x6F, 0x6F, 0x74, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73,
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x66, 0x75, 0x6C, 0x20,
+    0x77, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62,
+    0x65, 0x72, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73,
+    0x20, 0x6F, 0x72, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73,
+    0x20, 0x74, 0x6F, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x6E, 0x63,
+    0x65, 0x73, 0x74, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x62, 0x65,
+    0x72, 0x2E, 0x20, 0x55, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x74,
+    0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x69,
+    0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x72, 0x72,
+    0x6F, 0x72, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x73, 0x65, 0x65,
+    0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x66, 0x69, 0x62,
+    0x65, 0x72, 0x20, 0x72, 0x61, 0x69, 0x73, 0x65, 0x64, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C,
+    0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 0x6E,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x68, 0x6F, 0x75,
+    0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64,
+    0x20, 0x6D, 0x6F, 0x73, 0x74, 0x6C, 0x79, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x67, 0x69, 0x6E,
+    0x67, 0x20, 0x70, 0x75, 0x72, 0x70, 0x6F, 0x73, 0x65, 0x73,
+    0x2E, 0xDA, 0x84, 0xB7, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03,
+    0x00, 0xDA, 0x12, 0x80, 0x90, 0x01, 0xDA, 0x03, 0xDA, 0x84,
+    0xB9, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x50, 0x28, 0x69,
+    0x66, 0x2D, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x64,
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x6E,
+    0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x65, 0x6C, 0x73, 0x65,
+    0x29, 0x0A, 0x0A, 0x53, 0x68, 0x6F, 0x72, 0x74, 0x68, 0x61,
+    0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x69, 0x66,
+    0x20, 0x28, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x64,
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x20, 0x65, 0x6C, 0x73,
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x29, 0x2E, 0xDA, 0x84,
+    0xBA, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x84, 0x47, 0x01, 0xDA, 0x03, 0xDA, 0x84, 0xC0, 0xDA, 0x05,
+    0xCE, 0x75, 0x28, 0x66, 0x6C, 0x61, 0x74, 0x74, 0x65, 0x6E,
+    0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x54, 0x61, 0x6B, 0x65,
+    0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x73, 0x74, 0x65, 0x64,
+    0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x28, 0x74, 0x72,
+    0x65, 0x65, 0x29, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x66, 0x69, 0x72,
+    0x73, 0x74, 0x20, 0x74, 0x72, 0x61, 0x76, 0x65, 0x72, 0x73,
+    0x61, 0x6C, 0x20, 0x6F, 0x66, 0x20, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E,
+    0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0xDA,
+    0x84, 0xC1, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x84, 0xC2, 0xDA,
+    0x05, 0xCE, 0x4C, 0x28, 0x6F, 0x73, 0x2F, 0x72, 0x6D, 0x64,
+    0x69, 0x72, 0x20, 0x70, 0x61, 0x74, 0x68, 0x29, 0x0A, 0x0A,
+    0x44, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x61, 0x20, 0x64,
+    0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x20,
+    0x54, 0x68, 0x65, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
+    0x6F, 0x72, 0x79, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62,
+    0x65, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x74, 0x6F,
+    0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x65, 0x64, 0x2E, 0xDA,
+    0x84, 0xC3, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x84, 0xC4, 0xDA,
+    0x05, 0xCE, 0x80, 0xC0, 0x28, 0x65, 0x6E, 0x76, 0x2D, 0x6C,
+    0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x65, 0x6E, 0x76, 0x29,
+    0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20,
+    0x61, 0x20, 0x66, 0x6F, 0x72, 0x77, 0x61, 0x72, 0x64, 0x20,
+    0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x75, 0x6E, 0x6D,
+    0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x6E, 0x20, 0x65,
+    0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74,
+    0x2E, 0x20, 0x54, 0x6F, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74,
+    0x65, 0x20, 0x61, 0x20, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73,
+    0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x75, 0x70, 0x20, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x2C, 0x20, 0x75, 0x73, 0x65, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x76, 0x65, 0x72, 0x74,
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x74, 0x6F, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x6B, 0x65,
+    0x79, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x65, 0x64, 0x20,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0xDA, 0x84, 0xC5, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x84, 0xC6, 0xDA, 0x05, 0xCE, 0x81,
+    0x33, 0x28, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x73,
+    0x6C, 0x69, 0x63, 0x65, 0x20, 0x74, 0x61, 0x72, 0x72, 0x20,
+    0x26, 0x6F, 0x70, 0x74, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74,
+    0x20, 0x65, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x54, 0x61, 0x6B,
+    0x65, 0x73, 0x20, 0x61, 0x20, 0x73, 0x6C, 0x69, 0x63, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x74, 0x79, 0x70, 0x65,
+    0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x74,
+    0x6F, 0x20, 0x65, 0x6E, 0x64, 0x2E, 0x20, 0x54, 0x68, 0x65,
+    0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x69, 0x73, 0x20,
+    0x68, 0x61, 0x6C, 0x66, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x2C,
+    0x20, 0x5B, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2C, 0x20, 0x65,
+    0x6E, 0x64, 0x29, 0x2E, 0x20, 0x49, 0x6E, 0x64, 0x65, 0x78,
+    0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x61, 0x6C, 0x73,
+    0x6F, 0x20, 0x62, 0x65, 0x20, 0x6E, 0x65, 0x67, 0x61, 0x74,
+    0x69, 0x76, 0x65, 0x2C, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63,
+    0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x64, 0x65,
+    0x78, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65,
+    0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x42,
+    0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2C,
+    0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x69, 0x73, 0x20,
+    0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x6E, 0x64, 0x20,
+    0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x7A,
+    0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74,
+    0x79, 0x70, 0x65, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x6A, 0x61, 0x6E, 0x65,
+    0x74, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0xDA, 0x84,
+    0xC7, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x84, 0xC8, 0xDA, 0x05,
+    0xCE, 0x56, 0x28, 0x66, 0x72, 0x65, 0x71, 0x75, 0x65, 0x6E,
+    0x63, 0x69, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A,
+    0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E,
+    0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x6F,
+    0x63, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x73,
+    0x20, 0x6F, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20,
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x73, 0x74,
+    0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0xDA, 0x84,
+    0xC9, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x84, 0xCA, 0xDA, 0x05,
+    0xCE, 0x26, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x63, 0x6F,
+    0x73, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F,
+    0x73, 0x69, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E,
+    0xDA, 0x84, 0xCB, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x84, 0xCC,
+    0xDA, 0x05, 0xCE, 0x81, 0x29, 0x28, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x2F, 0x77, 0x65, 0x61, 0x6B, 0x20, 0x63, 0x61, 0x70,
+    0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x0A, 0x0A, 0x43, 0x72,
+    0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x77,
+    0x65, 0x61, 0x6B, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65,
+    0x6E, 0x63, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6B, 0x65,
+    0x79, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x73, 0x2E, 0x20, 0x45, 0x6E, 0x74, 0x72, 0x69,
+    0x65, 0x73, 0x20, 0x77, 0x68, 0x6F, 0x73, 0x65, 0x20, 0x6B,
+    0x65, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x72, 0x65, 0x66,
+    0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x79, 0x70,
+    0x65, 0x20, 0x28, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x2C, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2C, 0x20, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2C, 0x20, 0x66, 0x75, 0x6E,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x66, 0x69, 0x62,
+    0x65, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x61, 0x62, 0x73, 0x74,
+    0x72, 0x61, 0x63, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x29, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x6D, 0x6F,
+    0x76, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x6F, 0x72,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20,
+    0x6E, 0x6F, 0x20, 0x6C, 0x6F, 0x6E, 0x67, 0x65, 0x72, 0x20,
+    0x72, 0x65, 0x61, 0x63, 0x68, 0x61, 0x62, 0x6C, 0x65, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x6E, 0x79, 0x77, 0x68,
+    0x65, 0x72, 0x65, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x2E, 0xDA, 0x84, 0xCD, 0xD3, 0x03, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x6D, 0x01, 0xDA, 0x03, 0xDA, 0x81,
+    0xD1, 0xDA, 0x05, 0xCE, 0x1C, 0x28, 0x6E, 0x69, 0x6C, 0x3F,
+    0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B,
+    0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x6E,
+    0x69, 0x6C, 0x2E, 0xDA, 0x84, 0xCE, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x84, 0xCF, 0xDA, 0x05, 0xCE, 0x73, 0x28, 0x74, 0x75,
+    0x70, 0x6C, 0x65, 0x2F, 0x73, 0x65, 0x74, 0x6D, 0x61, 0x70,
+    0x20, 0x74, 0x75, 0x70, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20,
+    0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x29, 0x0A, 0x0A, 0x53,
+    0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6F, 0x75,
+    0x72, 0x63, 0x65, 0x6D, 0x61, 0x70, 0x20, 0x6D, 0x65, 0x74,
+    0x61, 0x64, 0x61, 0x74, 0x61, 0x20, 0x6F, 0x6E, 0x20, 0x61,
+    0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2E, 0x20, 0x6C, 0x69,
+    0x6E, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x6F, 0x6C,
+    0x75, 0x6D, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63, 0x61,
+    0x74, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20,
+    0x62, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72,
+    0x73, 0x2E, 0xDA, 0x84, 0xD0, 0xD3, 0x03, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x86, 0xDE, 0x01, 0xDA, 0x03, 0xDA,
+    0x84, 0xD2, 0xDA, 0x05, 0xCE, 0x80, 0xF2, 0x28, 0x71, 0x75,
+    0x69, 0x74, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x29, 0x0A, 0x0A, 0x54, 0x72, 0x69, 0x65,
+    0x73, 0x20, 0x74, 0x6F, 0x20, 0x65, 0x78, 0x69, 0x74, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+    0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x72, 0x65, 0x70,
+    0x6C, 0x20, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65,
+    0x78, 0x74, 0x2E, 0x20, 0x44, 0x6F, 0x65, 0x73, 0x20, 0x6E,
+    0x6F, 0x74, 0x20, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x20,
+    0x65, 0x78, 0x69, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x2E, 0x20, 0x20, 0x57, 0x6F, 0x72, 0x6B, 0x73, 0x20, 0x62,
+    0x79, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x3A, 0x65, 0x78, 0x69, 0x74, 0x20,
+    0x64, 0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x20, 0x62, 0x69,
+    0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x74,
+    0x72, 0x75, 0x65, 0x2E, 0x20, 0x50, 0x61, 0x73, 0x73, 0x69,
+    0x6E, 0x67, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x6E,
+    0x69, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x68,
+    0x65, 0x72, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x63,
+    0x61, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F,
+    0x75, 0x74, 0x65, 0x72, 0x20, 0x20, 0x72, 0x75, 0x6E, 0x2D,
+    0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x20, 0x74, 0x6F,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0xDA,
+    0x84, 0xD3, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x84, 0xD4, 0xDA,
+    0x05, 0xCE, 0x38, 0x28, 0x6F, 0x73, 0x2F, 0x73, 0x65, 0x74,
+    0x65, 0x6E, 0x76, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62,
+    0x6C, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x0A,
+    0x0A, 0x53, 0x65, 0x74, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x6E,
+    0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+    0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0xDA,
+    0x84, 0xD5, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x84, 0xD6, 0xDA,
+    0x05, 0xCE, 0x80, 0xAD, 0x28, 0x74, 0x68, 0x72, 0x65, 0x61,
+    0x64, 0x2F, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x20,
+    0x26, 0x6F, 0x70, 0x74, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x6F,
+    0x75, 0x74, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x61,
+    0x20, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x73,
+    0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x69,
+    0x73, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x2E, 0x20,
+    0x49, 0x66, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74,
+    0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64,
+    0x65, 0x64, 0x2C, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72,
+    0x6F, 0x72, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65,
+    0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x6E, 0x20, 0x61, 0x66,
+    0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x69,
+    0x6D, 0x65, 0x6F, 0x75, 0x74, 0x20, 0x68, 0x61, 0x73, 0x20,
+    0x65, 0x6C, 0x61, 0x70, 0x73, 0x65, 0x64, 0x20, 0x62, 0x75,
+    0x74, 0x20, 0x6E, 0x6F, 0x20, 0x6D, 0x65, 0x73, 0x73, 0x61,
+    0x67, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65,
+    0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x2E, 0xDA, 0x84, 0xD7,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x82, 0xB7, 0xDA, 0x05, 0xCE,
+    0x80, 0xA0, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F,
+    0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x65, 0x20, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x44, 0x65, 0x71,
+    0x75, 0x65, 0x75, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E,
+    0x65, 0x78, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x2E, 0x20,
+    0x57, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66, 0x20, 0x6E,
+    0x6F, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x64, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+    0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x71, 0x75, 0x65,
+    0x75, 0x65, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77,
+    0x69, 0x73, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x64,
+    0x65, 0x71, 0x75, 0x65, 0x75, 0x65, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x2E, 0xDA, 0x84, 0xD8, 0xD3, 0x03, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x82, 0x4E, 0x01, 0xDA, 0x03, 0xDA,
+    0x84, 0xDC, 0xDA, 0x05, 0xCE, 0x65, 0x28, 0x6D, 0x61, 0x78,
+    0x2D, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x26, 0x20, 0x61,
+    0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61,
+    0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x20, 0x61, 0x63, 0x63, 0x6F, 0x72, 0x64, 0x69,
+    0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x74, 0x6F,
+    0x74, 0x61, 0x6C, 0x20, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72,
+    0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0xDA, 0x84, 0xDD,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x84, 0xDE, 0xDA, 0x05, 0xCE,
+    0x80, 0x90, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F,
+    0x66, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x29, 0x0A, 0x0A, 0x46, 0x69, 0x6C, 0x6C, 0x20, 0x75,
+    0x70, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x62, 0x79, 0x74, 0x65,
+    0x73, 0x2C, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74,
+    0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x30, 0x73, 0x2E,
+    0x20, 0x44, 0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+    0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x27, 0x73, 0x20,
+    0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xDA, 0x84, 0xDF, 0xD3,
+    0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x87, 0x25,
+    0x01, 0xDA, 0x03, 0xDA, 0x87, 0x50, 0xDA, 0x05, 0xCE, 0x80,
+    0xC9, 0x28, 0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x69, 0x6D, 0x61,
+    0x67, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x29, 0x0A,
+    0x0A, 0x54, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x76, 0x65, 0x72,
+    0x73, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69,
+    0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x6D, 0x61, 0x6B, 0x65,
+    0x2D, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x65,
+    0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74,
+    0x2E, 0x20, 0x52, 0x61, 0x69, 0x73, 0x65, 0x73, 0x20, 0x61,
+    0x6E, 0x20, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x69,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6D, 0x61, 0x67,
+    0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x6D, 0x61, 0x64, 0x65,
+    0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x64, 0x69, 0x66, 0x66,
+    0x65, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73,
+    0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x6A, 0x61, 0x6E,
+    0x65, 0x74, 0x2C, 0x20, 0x61, 0x73, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x63, 0x6F, 0x64, 0x65, 0x20, 0x20, 0x69, 0x73, 0x20,
+    0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x74,
+    0x69, 0x62, 0x6C, 0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65,
+    0x65, 0x6E, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E,
+    0x73, 0x2E, 0xDA, 0x84, 0xE1, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x84, 0xE2, 0xDA, 0x05, 0xCE, 0x80, 0x83, 0x28, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x63,
+    0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x0A, 0x0A,
+    0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20,
+    0x6E, 0x65, 0x77, 0x2C, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79,
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x65, 0x6E, 0x6F, 0x75, 0x67, 0x68, 0x20,
+    0x62, 0x61, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x65,
+    0x6D, 0x6F, 0x72, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63,
+    0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x20, 0x62, 0x79,
+    0x74, 0x65, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x6C,
+    0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x30, 0x2E, 0xDA, 0x84,
+    0xE3, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x80, 0xEE, 0x01, 0xDA, 0x03, 0xDA, 0x84, 0xE5, 0xDA, 0x24,
+    0xCB, 0xDA, 0x05, 0xCE, 0x70, 0x28, 0x61, 0x6E, 0x64, 0x20,
+    0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29, 0x0A, 0x0A,
+    0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73,
+    0x74, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x20, 0x69, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x70, 0x72,
+    0x65, 0x63, 0x65, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x65, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65,
+    0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x20, 0x6F, 0x74, 0x68,
+    0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x20, 0x65, 0x76,
+    0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F,
+    0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x2E, 0xDA, 0x85, 0xC6,
+    0xDA, 0x85, 0x13, 0xDA, 0x84, 0xE6, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x84, 0x33, 0xDA, 0x05, 0xCE, 0x7E, 0x28, 0x64, 0x65,
+    0x65, 0x70, 0x2D, 0x6E, 0x6F, 0x74, 0x3D, 0x20, 0x78, 0x20,
+    0x79, 0x29, 0x0A, 0x0A, 0x4C, 0x69, 0x6B, 0x65, 0x20, 0x6E,
+    0x6F, 0x74, 0x3D, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x6D,
+    0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x79, 0x70,
+    0x65, 0x73, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73,
+    0x2C, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x2C, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x29, 0x20, 0x61,
+    0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65,
+    0x72, 0x65, 0x64, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C, 0x20,
+    0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x68, 0x61,
+    0x76, 0x65, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x63,
+    0x61, 0x6C, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75,
+    0x72, 0x65, 0x2E, 0xDA, 0x84, 0xE7, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x84, 0xE8, 0xDA, 0x05, 0xCE, 0x6C, 0x28, 0x6D, 0x61,
+    0x74, 0x68, 0x2F, 0x73, 0x65, 0x65, 0x64, 0x72, 0x61, 0x6E,
+    0x64, 0x6F, 0x6D, 0x20, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A,
+    0x0A, 0x53, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+    0x65, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x20, 0x6E,
+    0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x67, 0x65, 0x6E, 0x65,
+    0x72, 0x61, 0x74, 0x6F, 0x72, 0x2E, 0x20, 0x73, 0x65, 0x65,
+    0x64, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62,
+    0x65, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67,
+    0x65, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2E, 0xDA, 0x84, 0xE9, 0xD3, 0x03,
+    0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x83, 0x06, 0x01,
+    0xDA, 0x03, 0xDA, 0x84, 0xEB, 0xDA, 0x05, 0xCE, 0x42, 0x28,
+    0x74, 0x61, 0x6B, 0x65, 0x2D, 0x75, 0x6E, 0x74, 0x69, 0x6C,
+    0x20, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x29,
+    0x0A, 0x0A, 0x53, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x73, 0x20,
+    0x28, 0x74, 0x61, 0x6B, 0x65, 0x2D, 0x77, 0x68, 0x69, 0x6C,
+    0x65, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x20, 0x70, 0x72, 0x65, 0x64, 0x29, 0x20,
+    0x69, 0x6E, 0x64, 0x29, 0x2E, 0xDA, 0x84, 0xEC, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x84, 0xED, 0xDA, 0x05, 0xCE, 0x4F, 0x28,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x26, 0x20, 0x69, 0x74,
+    0x65, 0x6D, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61,
+    0x74, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x69,
+    0x74, 0x65, 0x6D, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0xDA, 0x84,
+    0xEE, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x84, 0xEF, 0xDA, 0x05,
+    0xCE, 0x80, 0x80, 0x28, 0x6F, 0x73, 0x2F, 0x74, 0x69, 0x6D,
+    0x65, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20,
+    0x74, 0x69, 0x6D, 0x65, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65,
+    0x73, 0x73, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F,
+    0x66, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x20,
+    0x73, 0x69, 0x6E, 0x63, 0x65, 0x20, 0x4A, 0x61, 0x6E, 0x75,
+    0x61, 0x72, 0x79, 0x20, 0x31, 0x2C, 0x20, 0x31, 0x39, 0x37,
+    0x30, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x55, 0x6E, 0x69,
+    0x78, 0x20, 0x65, 0x70, 0x6F, 0x63, 0x68, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x72,
+    0x65, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x2E, 0xDA, 0x84, 0xF0, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03,
+    0x00, 0xDA, 0x12, 0x29, 0x01, 0xDA, 0x03, 0xDA, 0x84, 0xF2,
+    0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x27, 0x28, 0x64, 0x65,
+    0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x6E, 0x61, 0x6D,
+    0x65, 0x20, 0x26, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x29, 0x0A,
+    0x0A, 0x44, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x61, 0x20,
+    0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E, 0xDA, 0x84, 0xF3, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x84, 0xF4, 0xDA, 0x05, 0xCE, 0x40,
+    0x28, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x6C, 0x65,
+    0x6E, 0x67, 0x74, 0x68, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x7C, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x79, 0x70,
+    0x65, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F,
+    0x72, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x73,
+    0x69, 0x7A, 0x65, 0x2E, 0xDA, 0x84, 0xF5, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x82, 0xB4, 0xDA, 0x05, 0xCE, 0x80, 0x90, 0x28,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77,
+    0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x70,
+    0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x6F, 0x62, 0x6A, 0x65,
+    0x63, 0x74, 0x2E, 0x20, 0x50, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74,
+    0x65, 0x20, 0x6D, 0x61, 0x63, 0x68, 0x69, 0x6E, 0x65, 0x73,
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x20,
+    0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x20, 0x62, 0x79,
+    0x74, 0x65, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x67,
+    0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20,
+    0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x20, 0x6F, 0x66, 0x20,
+    0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x2E, 0xDA, 0x84, 0xF6, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x84, 0xF7, 0xDA, 0x05, 0xCE, 0x45, 0x28, 0x75, 0x6E,
+    0x74, 0x72, 0x61, 0x63, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x29, 0x0A, 0x0A, 0x44, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65,
+    0x73, 0x20, 0x74, 0x72, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x20,
+    0x6F, 0x6E, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6E,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0xDA, 0x84, 0xF8, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x84, 0xF9, 0xDA, 0x05, 0xCE, 0x18,
+    0x54, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x61,
+    0x72, 0x64, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x66,
+    0x69, 0x6C, 0x65, 0x2E, 0xDA, 0x84, 0xFA, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x84, 0xFC, 0xDA, 0x05, 0xCE, 0x51, 0x28, 0x3C,
+    0x3D, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43,
+    0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x73,
+    0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x6E, 0x75, 0x6D,
+    0x65, 0x72, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x6E,
+    0x6F, 0x6E, 0x2D, 0x64, 0x65, 0x73, 0x63, 0x65, 0x6E, 0x64,
+    0x69, 0x6E, 0x67, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xDA,
+    0x84, 0xFD, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x84, 0xFE, 0xDA,
+    0x05, 0xCE, 0x80, 0xE3, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x72, 0x2F, 0x66, 0x6C, 0x75, 0x73, 0x68, 0x20, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x43, 0x6C, 0x65,
+    0x61, 0x72, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x2E, 0x20, 0x43, 0x61,
+    0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20,
+    0x74, 0x6F, 0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20,
+    0x69, 0x66, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F,
+    0x72, 0x20, 0x77, 0x61, 0x73, 0x20, 0x65, 0x6E, 0x63, 0x6F,
+    0x75, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x2E, 0x20, 0x44,
+    0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x72, 0x65,
+    0x73, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x69,
+    0x6E, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x6F, 0x6C,
+    0x75, 0x6D, 0x6E, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65,
+    0x72, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x6F, 0x20, 0x62,
+    0x65, 0x67, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x73, 0x69,
+    0x6E, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x2C,
+    0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20,
+    0x6E, 0x65, 0x77, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x2E, 0xDA, 0x84, 0xFF, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03,
+    0x00, 0xDA, 0x12, 0x87, 0xC2, 0x01, 0xDA, 0x03, 0xDA, 0x84,
+    0x9A, 0xDA, 0x05, 0xCE, 0x80, 0x88, 0x41, 0x20, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x6C, 0x6F, 0x61,
+    0x64, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x65, 0x74, 0x68, 0x6F,
+    0x64, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x20, 0x74, 0x6F,
+    0x20, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x66,
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x20,
+    0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x20, 0x6C, 0x65, 0x74, 0x73, 0x20, 0x72, 0x65, 0x71,
+    0x75, 0x69, 0x72, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69,
+    0x6D, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x6C, 0x6F, 0x61, 0x64,
+    0x20, 0x6D, 0x61, 0x6E, 0x79, 0x20, 0x64, 0x69, 0x66, 0x66,
+    0x65, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x6B, 0x69, 0x6E, 0x64,
+    0x73, 0x20, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x69, 0x6C, 0x65,
+    0x73, 0x20, 0x61, 0x73, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C,
+    0x65, 0x2E, 0xDA, 0x85, 0x00, 0xD3, 0x03, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x81, 0xFA, 0x01, 0xDA, 0x03, 0xDA,
+    0x85, 0x02, 0xDA, 0x05, 0xCE, 0x43, 0x28, 0x70, 0x72, 0x6F,
+    0x64, 0x75, 0x63, 0x74, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74, 0x20,
+    0x6F, 0x66, 0x20, 0x78, 0x73, 0x2E, 0x20, 0x49, 0x66, 0x20,
+    0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6D, 0x70, 0x74,
+    0x79, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x31, 0x2E, 0xDA, 0x85, 0x03, 0xD3, 0x03, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x82, 0xFD, 0x01, 0xDA, 0x03,
+    0xDA, 0x85, 0x05, 0xDA, 0x05, 0xCE, 0x55, 0x28, 0x74, 0x61,
+    0x6B, 0x65, 0x20, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A,
+    0x0A, 0x54, 0x61, 0x6B, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0x20, 0x6E, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x74, 0x79, 0x70,
+    0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78,
+    0x65, 0x64, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63,
+    0x65, 0x2E, 0xDA, 0x85, 0x06, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x83, 0x06, 0xDA, 0x05, 0xCE, 0x81, 0x5C, 0x28, 0x61, 0x70,
+    0x70, 0x6C, 0x79, 0x20, 0x66, 0x20, 0x26, 0x20, 0x61, 0x72,
+    0x67, 0x73, 0x29, 0x0A, 0x0A, 0x41, 0x70, 0x70, 0x6C, 0x69,
+    0x65, 0x73, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x76,
+    0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6E, 0x75,
+    0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x72,
+    0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x20, 0x45,
+    0x61, 0x63, 0x68, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x72, 0x67, 0x73, 0x20,
+    0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x61, 0x73,
+    0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x66, 0x2C, 0x20, 0x65,
+    0x78, 0x63, 0x65, 0x70, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6C, 0x61, 0x73, 0x74, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x72, 0x67, 0x73,
+    0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73,
+    0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20,
+    0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2D, 0x6C, 0x69, 0x6B, 0x65, 0x2E,
+    0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x69,
+    0x73, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x61, 0x72, 0x67,
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x6E, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x70,
+    0x75, 0x73, 0x68, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61,
+    0x6E, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74,
+    0x20, 0x74, 0x6F, 0x20, 0x66, 0x2E, 0x20, 0x46, 0x6F, 0x72,
+    0x20, 0x65, 0x78, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x3A, 0x0A,
+    0x0A, 0x09, 0x28, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x20, 0x2B,
+    0x20, 0x31, 0x30, 0x30, 0x30, 0x20, 0x28, 0x72, 0x61, 0x6E,
+    0x67, 0x65, 0x20, 0x31, 0x30, 0x29, 0x29, 0x0A, 0x0A, 0x73,
+    0x75, 0x6D, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x72, 0x73, 0x74, 0x20, 0x31, 0x30, 0x20, 0x69, 0x6E, 0x74,
+    0x65, 0x67, 0x65, 0x72, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x31, 0x30, 0x30, 0x30, 0x2E, 0xDA, 0x85, 0x07, 0xD3, 0x03,
+    0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x86, 0x84, 0x01,
+    0xDA, 0x03, 0xDA, 0x82, 0xC4, 0xDA, 0x05, 0xCE, 0x83, 0xB1,
+    0x28, 0x72, 0x75, 0x6E, 0x2D, 0x63, 0x6F, 0x6E, 0x74, 0x65,
+    0x78, 0x74, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x29, 0x0A, 0x0A,
+    0x52, 0x75, 0x6E, 0x20, 0x61, 0x20, 0x63, 0x6F, 0x6E, 0x74,
+    0x65, 0x78, 0x74, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20,
+    0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20,
+    0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E,
+    0x73, 0x20, 0x6F, 0x66, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+    0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x6E, 0x76,
+    0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6E,
+    0x63, 0x61, 0x70, 0x73, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x69,
+    0x6E, 0x67, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C,
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x69, 0x6F,
+    0x6E, 0x2E, 0x20, 0x20, 0x6F, 0x70, 0x74, 0x73, 0x20, 0x69,
+    0x73, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+    0x6F, 0x72, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20,
+    0x6F, 0x66, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73,
+    0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6F, 0x70, 0x74, 0x69,
+    0x6F, 0x6E, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x73,
+    0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x73, 0x3A, 0x0A,
+    0x0A, 0x09, 0x20, 0x20, 0x3A, 0x63, 0x68, 0x75, 0x6E, 0x6B,
+    0x73, 0x20, 0x2D, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61,
+    0x63, 0x6B, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x61, 0x64,
+    0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x20, 0x2D, 0x20, 0x64, 0x65, 0x66,
+    0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73, 0x20, 0x67, 0x65,
+    0x74, 0x6C, 0x69, 0x6E, 0x65, 0x0A, 0x09, 0x20, 0x20, 0x3A,
+    0x6F, 0x6E, 0x2D, 0x70, 0x61, 0x72, 0x73, 0x65, 0x2D, 0x65,
+    0x72, 0x72, 0x6F, 0x72, 0x20, 0x2D, 0x20, 0x63, 0x61, 0x6C,
+    0x6C, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x77, 0x68, 0x65, 0x6E,
+    0x20, 0x70, 0x61, 0x72, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x66,
+    0x61, 0x69, 0x6C, 0x73, 0x20, 0x2D, 0x20, 0x64, 0x65, 0x66,
+    0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73, 0x20, 0x62, 0x61,
+    0x64, 0x2D, 0x70, 0x61, 0x72, 0x73, 0x65, 0x0A, 0x09, 0x20,
+    0x20, 0x3A, 0x65, 0x6E, 0x76, 0x20, 0x2D, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D,
+    0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F, 0x6D,
+    0x70, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E,
+    0x73, 0x74, 0x20, 0x2D, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75,
+    0x6C, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E,
+    0x76, 0x0A, 0x09, 0x20, 0x20, 0x3A, 0x73, 0x6F, 0x75, 0x72,
+    0x63, 0x65, 0x20, 0x2D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6F, 0x66, 0x20,
+    0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x62, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x65, 0x72,
+    0x72, 0x6F, 0x72, 0x73, 0x20, 0x2D, 0x20, 0x64, 0x65, 0x66,
+    0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73, 0x20, 0x22, 0x3C,
+    0x61, 0x6E, 0x6F, 0x6E, 0x79, 0x6D, 0x6F, 0x75, 0x73, 0x3E,
+    0x22, 0x0A, 0x09, 0x20, 0x20, 0x3A, 0x6F, 0x6E, 0x2D, 0x63,
+    0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x2D, 0x65, 0x72, 0x72,
+    0x6F, 0x72, 0x20, 0x2D, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x62,
+    0x61, 0x63, 0x6B, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x63,
+    0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x66, 0x61, 0x69, 0x6C, 0x73, 0x20, 0x2D, 0x20, 0x64,
+    0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73, 0x20,
+    0x62, 0x61, 0x64, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C,
+    0x65, 0x0A, 0x09, 0x20, 0x20, 0x3A, 0x65, 0x76, 0x61, 0x6C,
+    0x75, 0x61, 0x74, 0x6F, 0x72, 0x20, 0x2D, 0x20, 0x63, 0x61,
+    0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x73,
+    0x20, 0x74, 0x68, 0x75, 0x6E, 0x6B, 0x73, 0x2E, 0x20, 0x53,
+    0x69, 0x67, 0x6E, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x69,
+    0x73, 0x20, 0x28, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74,
+    0x6F, 0x72, 0x20, 0x74, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x73,
+    0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x20,
+    0x77, 0x68, 0x65, 0x72, 0x65, 0x29, 0x0A, 0x09, 0x20, 0x20,
+    0x3A, 0x6F, 0x6E, 0x2D, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0x20, 0x2D, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63,
+    0x6B, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x65, 0x76,
+    0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x64, 0x20, 0x2D, 0x20,
+    0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73,
+    0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61,
+    0x63, 0x6B, 0x74, 0x72, 0x61, 0x63, 0x65, 0x0A, 0x09, 0x20,
+    0x20, 0x3A, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2D, 0x66, 0x6C,
+    0x61, 0x67, 0x73, 0x20, 0x2D, 0x20, 0x77, 0x68, 0x61, 0x74,
+    0x20, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x74, 0x6F, 0x20,
+    0x77, 0x72, 0x61, 0x70, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+    0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x2E, 0x20, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74,
+    0x20, 0x69, 0x73, 0x20, 0x3A, 0x69, 0x61, 0x2E, 0x0A, 0x09,
+    0x20, 0x20, 0x3A, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x65,
+    0x72, 0x20, 0x2D, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x70, 0x74,
+    0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x69, 0x73, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20,
+    0x6F, 0x6E, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x74, 0x6F,
+    0x70, 0x20, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x20, 0x66, 0x6F,
+    0x72, 0x6D, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20,
+    0x62, 0x65, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x6F, 0x6D, 0x70,
+    0x69, 0x6C, 0x65, 0x64, 0x2E, 0xDA, 0x85, 0x08, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x81, 0xFA, 0xDA, 0x05, 0xCE, 0x50, 0x28,
+    0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x62, 0x72, 0x61, 0x63,
+    0x6B, 0x65, 0x74, 0x73, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29,
+    0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x62, 0x72, 0x61, 0x63,
+    0x6B, 0x65, 0x74, 0x65, 0x64, 0x20, 0x74, 0x75, 0x70, 0x6C,
+    0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x69,
+    0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x78, 0x73, 0x2E, 0xDA,
+    0x85, 0x09, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x5B, 0x01, 0xDA, 0x03, 0xDA, 0x85, 0x0C, 0xDA, 0x05,
+    0xCE, 0x27, 0x28, 0x63, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68,
+    0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x61,
+    0x20, 0x63, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x2E, 0xDA, 0x85, 0x14, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03,
+    0x00, 0xDA, 0x12, 0x80, 0x8C, 0x01, 0xDA, 0x03, 0xDA, 0x85,
+    0x16, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x2D, 0x28, 0x63,
+    0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x26, 0x29, 0x0A,
+    0x0A, 0x49, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x65,
+    0x6E, 0x74, 0x2E, 0xDA, 0x85, 0x17, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x85, 0x19, 0xDA, 0x05, 0xCE, 0x6C, 0x28, 0x6F, 0x72,
+    0x64, 0x65, 0x72, 0x3C, 0x3D, 0x20, 0x26, 0x20, 0x78, 0x73,
+    0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69,
+    0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F,
+    0x74, 0x20, 0x64, 0x65, 0x63, 0x72, 0x65, 0x61, 0x73, 0x69,
+    0x6E, 0x67, 0x20, 0x61, 0x63, 0x63, 0x6F, 0x72, 0x64, 0x69,
+    0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x74, 0x6F,
+    0x74, 0x61, 0x6C, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20,
+    0x6F, 0x76, 0x65, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x62, 0x6F, 0x6F,
+    0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xDA, 0x85, 0x1A, 0xD3, 0x02,
+    0xDA, 0x03, 0x01, 0xDA, 0x05, 0xCE, 0x7E, 0x54, 0x68, 0x65,
+    0x20, 0x66, 0x6C, 0x61, 0x67, 0x20, 0x73, 0x65, 0x74, 0x20,
+    0x6F, 0x66, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x20,
+    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x63, 0x6F,
+    0x6E, 0x66, 0x2E, 0x68, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68,
+    0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74,
+    0x6F, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+    0x20, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x6D, 0x6F,
+    0x64, 0x75, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+    0x63, 0x6F, 0x6D, 0x70, 0x61, 0x74, 0x69, 0x62, 0x6C, 0x65,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x68, 0x6F, 0x73, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72,
+    0x61, 0x6D, 0x2E, 0xDA, 0x85, 0x1B, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x85, 0x1C, 0xDA, 0x05, 0xCE, 0x4A, 0x28, 0x69, 0x6E,
+    0x74, 0x2F, 0x73, 0x36, 0x34, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x20, 0x61, 0x20, 0x62, 0x6F, 0x78, 0x65, 0x64, 0x20, 0x73,
+    0x69, 0x67, 0x6E, 0x65, 0x64, 0x20, 0x36, 0x34, 0x20, 0x62,
+    0x69, 0x74, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x2E, 0xDA, 0x85, 0x1D, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x85,
+    0x1F, 0xDA, 0x05, 0xCE, 0x59, 0x28, 0x3D, 0x3D, 0x20, 0x26,
+    0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63,
+    0x6B, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x78,
+    0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x65,
+    0x72, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x65, 0x71,
+    0x75, 0x61, 0x6C, 0x20, 0x28, 0x34, 0x2E, 0x30, 0x20, 0x3D,
+    0x3D, 0x20, 0x34, 0x29, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x62, 0x6F, 0x6F, 0x6C,
+    0x65, 0x61, 0x6E, 0x2E, 0xDA, 0x85, 0x20, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x85, 0x21, 0xDA, 0x05, 0xCE, 0x81, 0x69, 0x28,
+    0x67, 0x63, 0x73, 0x65, 0x74, 0x74, 0x68, 0x72, 0x65, 0x61,
+    0x64, 0x73, 0x20, 0x6E, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20,
+    0x6D, 0x69, 0x6E, 0x2D, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73,
+    0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x2C, 0x20,
+    0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x69, 0x6E, 0x67, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+    0x74, 0x20, 0x6F, 0x6E, 0x65, 0x2C, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x6D, 0x61, 0x72, 0x6B, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x68, 0x65, 0x61, 0x70, 0x20, 0x64, 0x75, 0x72, 0x69,
+    0x6E, 0x67, 0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67, 0x65,
+    0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x2E, 0x20, 0x45, 0x78, 0x74, 0x72, 0x61, 0x20, 0x74,
+    0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x61, 0x72, 0x65,
+    0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x75, 0x73, 0x65, 0x64,
+    0x20, 0x66, 0x6F, 0x72, 0x20, 0x68, 0x65, 0x61, 0x70, 0x73,
+    0x20, 0x6F, 0x66, 0x20, 0x61, 0x74, 0x20, 0x6C, 0x65, 0x61,
+    0x73, 0x74, 0x20, 0x6D, 0x69, 0x6E, 0x2D, 0x62, 0x6C, 0x6F,
+    0x63, 0x6B, 0x73, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74,
+    0x73, 0x2C, 0x20, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x20,
+    0x62, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74,
+    0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6F, 0x6E, 0x6C, 0x79,
+    0x20, 0x6F, 0x6E, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F,
+    0x72, 0x6D, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x70,
+    0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x2E, 0x20, 0x41,
+    0x6E, 0x79, 0x20, 0x61, 0x62, 0x73, 0x74, 0x72, 0x61, 0x63,
+    0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x67, 0x63, 0x6D, 0x61, 0x72, 0x6B, 0x20,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20,
+    0x6D, 0x75, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20,
+    0x62, 0x65, 0x20, 0x73, 0x61, 0x66, 0x65, 0x20, 0x74, 0x6F,
+    0x20, 0x6D, 0x61, 0x72, 0x6B, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+    0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x72,
+    0x65, 0x61, 0x64, 0x73, 0x2E, 0x20, 0x44, 0x65, 0x66, 0x61,
+    0x75, 0x6C, 0x74, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x31, 0x2E,
+    0xDA, 0x85, 0x22, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x85, 0x23,
+    0xDA, 0x05, 0xCE, 0x80, 0xC7, 0x28, 0x66, 0x72, 0x65, 0x65,
+    0x7A, 0x65, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x46, 0x72, 0x65,
+    0x65, 0x7A, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x62, 0x6A,
+    0x65, 0x63, 0x74, 0x20, 0x28, 0x6D, 0x61, 0x6B, 0x65, 0x20,
+    0x69, 0x74, 0x20, 0x69, 0x6D, 0x6D, 0x75, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0x29, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x64, 0x6F,
+    0x20, 0x61, 0x20, 0x64, 0x65, 0x65, 0x70, 0x20, 0x63, 0x6F,
+    0x70, 0x79, 0x2C, 0x20, 0x6D, 0x61, 0x6B, 0x69, 0x6E, 0x67,
+    0x20, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x73, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x69,
+    0x6D, 0x6D, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20,
+    0x43, 0x6C, 0x6F, 0x73, 0x75, 0x72, 0x65, 0x73, 0x2C, 0x20,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x73, 0x2C, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x61, 0x62, 0x73, 0x74, 0x72, 0x61, 0x63, 0x74,
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6C,
+    0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x72,
+    0x65, 0x63, 0x75, 0x72, 0x73, 0x69, 0x76, 0x65, 0x6C, 0x79,
+    0x20, 0x66, 0x72, 0x6F, 0x7A, 0x65, 0x6E, 0x2C, 0x20, 0x62,
+    0x75, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6F, 0x74, 0x68,
+    0x65, 0x72, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x77,
+    0x69, 0x6C, 0x6C, 0x2E, 0xDA, 0x85, 0x24, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x85, 0x25, 0xDA, 0x05, 0xCE, 0x80, 0xD3, 0x28,
+    0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x66, 0x62, 0x72, 0x65,
+    0x61, 0x6B, 0x20, 0x66, 0x75, 0x6E, 0x20, 0x26, 0x6F, 0x70,
+    0x74, 0x20, 0x70, 0x63, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74,
+    0x20, 0x61, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x70, 0x6F,
+    0x69, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x67,
+    0x69, 0x76, 0x65, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x70, 0x63, 0x20, 0x69, 0x73,
+    0x20, 0x61, 0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
+    0x61, 0x6C, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2C,
+    0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20,
+    0x69, 0x6E, 0x20, 0x62, 0x79, 0x74, 0x65, 0x63, 0x6F, 0x64,
+    0x65, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x20, 0x66, 0x75, 0x6E, 0x20,
+    0x69, 0x73, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E,
+    0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x72, 0x6F,
+    0x77, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+    0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x66,
+    0x66, 0x73, 0x65, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x6F,
+    0x6F, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20, 0x6F, 0x72,
+    0x20, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2E,
+    0xDA, 0x85, 0x26, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x85, 0x27,
+    0xDA, 0x05, 0xCE, 0x81, 0xEA, 0x28, 0x6F, 0x73, 0x2F, 0x65,
+    0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x20, 0x61, 0x72, 0x67,
+    0x73, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x73, 0x20, 0x66, 0x6C,
+    0x61, 0x67, 0x73, 0x20, 0x65, 0x6E, 0x76, 0x29, 0x0A, 0x0A,
+    0x45, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65, 0x20, 0x61, 0x20,
+    0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x20, 0x6F, 0x6E,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65,
+    0x6D, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x61, 0x73, 0x73,
+    0x20, 0x69, 0x74, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73,
+    0x2E, 0x20, 0x46, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x69, 0x73,
+    0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64,
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6D, 0x6F, 0x64, 0x69,
+    0x66, 0x69, 0x65, 0x73, 0x20, 0x68, 0x6F, 0x77, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D,
+    0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x65, 0x78, 0x65, 0x63,
+    0x75, 0x74, 0x65, 0x2E, 0x0A, 0x0A, 0x09, 0x3A, 0x65, 0x20,
+    0x2D, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x20,
+    0x70, 0x61, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6E,
+    0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x2E, 0x20, 0x57,
+    0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x3A, 0x65, 0x2C,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+    0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E,
+    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6E,
+    0x68, 0x65, 0x72, 0x69, 0x74, 0x65, 0x64, 0x2E, 0x0A, 0x09,
+    0x3A, 0x70, 0x20, 0x2D, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77,
+    0x73, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x69, 0x6E,
+    0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72,
+    0x65, 0x6E, 0x74, 0x20, 0x50, 0x41, 0x54, 0x48, 0x20, 0x66,
+    0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x6E,
+    0x61, 0x72, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x65, 0x78, 0x65,
+    0x63, 0x75, 0x74, 0x65, 0x2E, 0x20, 0x57, 0x69, 0x74, 0x68,
+    0x6F, 0x75, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66,
+    0x6C, 0x61, 0x67, 0x2C, 0x20, 0x62, 0x69, 0x6E, 0x61, 0x72,
+    0x69, 0x65, 0x73, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x75,
+    0x73, 0x65, 0x20, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74,
+    0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x73, 0x2E, 0x0A, 0x0A,
+    0x65, 0x6E, 0x76, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x73, 0x74,
+    0x72, 0x75, 0x63, 0x74, 0x20, 0x6D, 0x61, 0x70, 0x70, 0x69,
+    0x6E, 0x67, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E,
+    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61,
+    0x62, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78,
+    0x69, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20,
+    0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F,
+    0x67, 0x72, 0x61, 0x6D, 0x2E, 0xDA, 0x85, 0x28, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x83, 0x57, 0xDA, 0x05, 0xCE, 0x3E, 0x28,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x68, 0x61, 0x73,
+    0x2D, 0x73, 0x75, 0x66, 0x66, 0x69, 0x78, 0x3F, 0x20, 0x73,
+    0x66, 0x78, 0x20, 0x73, 0x74, 0x72, 0x29, 0x0A, 0x0A, 0x54,
+    0x65, 0x73, 0x74, 0x73, 0x20, 0x77, 0x68, 0x65, 0x74, 0x68,
+    0x65, 0x72, 0x20, 0x73, 0x74, 0x72, 0x20, 0x65, 0x6E, 0x64,
+    0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73, 0x66, 0x78,
+    0x2E, 0xDA, 0x85, 0x29, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03,
+    0x00, 0xDA, 0x12, 0x83, 0xC7, 0x01, 0xDA, 0x03, 0xDA, 0x85,
+    0x2F, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x80, 0x8B, 0x28,
+    0x77, 0x69, 0x74, 0x68, 0x2D, 0x76, 0x61, 0x72, 0x73, 0x20,
+    0x76, 0x61, 0x72, 0x73, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64,
+    0x79, 0x29, 0x0A, 0x0A, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61,
+    0x74, 0x65, 0x73, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x76,
+    0x61, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x76, 0x61, 0x72, 0x73,
+    0x20, 0x74, 0x65, 0x6D, 0x70, 0x6F, 0x72, 0x61, 0x72, 0x69,
+    0x6C, 0x79, 0x20, 0x62, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0x20,
+    0x53, 0x69, 0x6D, 0x69, 0x6C, 0x61, 0x72, 0x20, 0x73, 0x69,
+    0x67, 0x6E, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x74, 0x6F,
+    0x20, 0x20, 0x6C, 0x65, 0x74, 0x2C, 0x20, 0x62, 0x75, 0x74,
+    0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x62, 0x69, 0x6E, 0x64,
+    0x69, 0x6E, 0x67, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62,
+    0x65, 0x20, 0x61, 0x20, 0x76, 0x61, 0x72, 0x2E, 0xDA, 0x85,
+    0x30, 0xD3, 0x03, 0xDA, 0x11, 0xDA, 0x85, 0x38, 0xDA, 0x03,
+    0xDA, 0x85, 0x32, 0xDA, 0x05, 0xDA, 0x85, 0x39, 0xDA, 0x85,
+    0x3A, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x85, 0x3B, 0xDA, 0x05,
+    0xCE, 0x5C, 0x28, 0x69, 0x6E, 0x74, 0x3F, 0x20, 0x78, 0x29,
+    0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66,
+    0x20, 0x78, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20,
+    0x65, 0x78, 0x61, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x72, 0x65,
+    0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x65, 0x64, 0x20,
+    0x61, 0x73, 0x20, 0x61, 0x20, 0x33, 0x32, 0x20, 0x62, 0x69,
+    0x74, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x20, 0x74,
+    0x77, 0x6F, 0x27, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x74, 0x65,
+    0x67, 0x65, 0x72, 0x2E, 0xDA, 0x85, 0x3C, 0xD3, 0x03, 0xDA,
+    0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x83, 0x10, 0x01, 0xDA,
+    0x03, 0xDA, 0x85, 0x3E, 0xDA, 0x05, 0xCE, 0x80, 0x9F, 0x28,
+    0x74, 0x61, 0x6B, 0x65, 0x2D, 0x77, 0x68, 0x69, 0x6C, 0x65,
+    0x20, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x29,
+    0x0A, 0x0A, 0x47, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x61, 0x20,
+    0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x2C,
+    0x20, 0x74, 0x61, 0x6B, 0x65, 0x20, 0x6F, 0x6E, 0x6C, 0x79,
+    0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65,
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x61, 0x74, 0x69,
+    0x73, 0x66, 0x79, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+    0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x2C, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x20,
+    0x6F, 0x6E, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66,
+    0x61, 0x69, 0x6C, 0x75, 0x72, 0x65, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0xDA, 0x85,
+    0x3F, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x85, 0x40, 0xDA, 0x05,
+    0xCE, 0x53, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x72, 0x6E,
+    0x67, 0x2D, 0x73, 0x65, 0x65, 0x64, 0x20, 0x72, 0x6E, 0x67,
+    0x20, 0x73, 0x65, 0x65, 0x64, 0x29, 0x0A, 0x0A, 0x45, 0x78,
+    0x74, 0x72, 0x61, 0x63, 0x74, 0x20, 0x61, 0x20, 0x72, 0x61,
+    0x6E, 0x64, 0x6F, 0x6D, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+    0x72, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
+    0x61, 0x6E, 0x67, 0x65, 0x20, 0x5B, 0x30, 0x2C, 0x20, 0x31,
+    0x29, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x52, 0x4E, 0x47, 0x2E, 0xDA, 0x85, 0x41, 0xD3, 0x04,
+    0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x84, 0xDD, 0x01,
+    0xDA, 0x03, 0xDA, 0x85, 0x4D, 0xDA, 0x24, 0xCB, 0xDA, 0x05,
+    0xCE, 0x82, 0x83, 0x28, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20,
+    0x78, 0x20, 0x26, 0x20, 0x63, 0x61, 0x73, 0x65, 0x73, 0x29,
+    0x0A, 0x0A, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20,
+    0x6D, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x2E, 0x20,
+    0x4D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x61, 0x6E, 0x20, 0x65,
+    0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20,
+    0x78, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x73, 0x74, 0x20,
+    0x20, 0x61, 0x6E, 0x79, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+    0x72, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x61, 0x73, 0x65, 0x73,
+    0x2E, 0x20, 0x45, 0x61, 0x73, 0x79, 0x20, 0x63, 0x61, 0x73,
+    0x65, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x70, 0x61, 0x74,
+    0x74, 0x65, 0x72, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x6D, 0x61,
+    0x74, 0x63, 0x68, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x73,
+    0x74, 0x2C, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x65,
+    0x64, 0x20, 0x20, 0x62, 0x79, 0x20, 0x61, 0x6E, 0x20, 0x65,
+    0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20,
+    0x74, 0x6F, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74,
+    0x65, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x69, 0x73,
+    0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64, 0x2E, 0x20,
+    0x41, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x20, 0x61,
+    0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x77, 0x69,
+    0x6C, 0x6C, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x61,
+    0x6E, 0x79, 0x74, 0x68, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x62,
+    0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x78, 0x27, 0x73,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x74, 0x6F, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F,
+    0x6C, 0x2E, 0x20, 0x41, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x20, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6D, 0x61,
+    0x74, 0x63, 0x68, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x69,
+    0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6F, 0x66, 0x20, 0x69,
+    0x74, 0x27, 0x73, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x65, 0x73, 0x70,
+    0x6F, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x65, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x20,
+    0x78, 0x2E, 0x20, 0x41, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x20, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+    0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6D, 0x61, 0x74, 0x63,
+    0x68, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x6D, 0x61, 0x74, 0x63,
+    0x68, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x63, 0x6F, 0x72, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E,
+    0x64, 0x69, 0x6E, 0x67, 0x20, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x78, 0x2E, 0x20, 0x41,
+    0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x70, 0x61, 0x74,
+    0x74, 0x65, 0x72, 0x6E, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+    0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x69, 0x66, 0x20, 0x69,
+    0x74, 0x27, 0x73, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x6D, 0x61,
+    0x74, 0x63, 0x68, 0x65, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F,
+    0x77, 0x69, 0x6E, 0x67, 0x20, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74,
+    0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20,
+    0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74,
+    0x72, 0x75, 0x65, 0x2E, 0x20, 0x41, 0x6E, 0x79, 0x20, 0x6F,
+    0x74, 0x68, 0x65, 0x72, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x77,
+    0x69, 0x6C, 0x6C, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x20,
+    0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x69, 0x66, 0x20, 0x69,
+    0x74, 0x20, 0x69, 0x73, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6C,
+    0x20, 0x74, 0x6F, 0x20, 0x78, 0x2E, 0xDA, 0x85, 0x4E, 0xD3,
+    0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x85, 0xE5,
+    0x01, 0xDA, 0x03, 0xDA, 0x84, 0x35, 0xDA, 0x05, 0xCE, 0x81,
+    0x56, 0x28, 0x6D, 0x61, 0x63, 0x65, 0x78, 0x20, 0x78, 0x20,
+    0x26, 0x6F, 0x70, 0x74, 0x20, 0x6F, 0x6E, 0x2D, 0x62, 0x69,
+    0x6E, 0x64, 0x69, 0x6E, 0x67, 0x29, 0x0A, 0x0A, 0x45, 0x78,
+    0x70, 0x61, 0x6E, 0x64, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F,
+    0x73, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65,
+    0x6C, 0x79, 0x2E, 0x20, 0x20, 0x6F, 0x6E, 0x2D, 0x62, 0x69,
+    0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x61,
+    0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C,
+    0x20, 0x63, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x20,
+    0x77, 0x68, 0x65, 0x6E, 0x65, 0x76, 0x65, 0x72, 0x20, 0x61,
+    0x20, 0x6E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x20, 0x73, 0x79,
+    0x6D, 0x62, 0x6F, 0x6C, 0x69, 0x63, 0x20, 0x62, 0x69, 0x6E,
+    0x64, 0x69, 0x6E, 0x67, 0x20, 0x20, 0x69, 0x73, 0x20, 0x65,
+    0x6E, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65, 0x72, 0x2E, 0x20,
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77,
+    0x73, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x73, 0x20, 0x74,
+    0x6F, 0x20, 0x65, 0x61, 0x73, 0x69, 0x6C, 0x79, 0x20, 0x73,
+    0x65, 0x65, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x62, 0x69, 0x6E,
+    0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x75, 0x73, 0x65, 0x20,
+    0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x20,
+    0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20,
+    0x62, 0x79, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x69, 0x6E, 0x67,
+    0x20, 0x6D, 0x61, 0x63, 0x65, 0x78, 0x20, 0x6F, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74,
+    0x65, 0x6E, 0x74, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20,
+    0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x74,
+    0x73, 0x65, 0x6C, 0x66, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6C,
+    0x73, 0x6F, 0x20, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63,
+    0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x6F, 0x6E,
+    0x2D, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x20, 0x6D, 0x61, 0x63,
+    0x72, 0x6F, 0x2E, 0xDA, 0x85, 0x4F, 0xD3, 0x03, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x86, 0x5D, 0x01, 0xDA, 0x03,
+    0xDA, 0x83, 0x73, 0xDA, 0x05, 0xCE, 0x80, 0xBA, 0x28, 0x6D,
+    0x61, 0x6B, 0x65, 0x2D, 0x65, 0x6E, 0x76, 0x20, 0x26, 0x6F,
+    0x70, 0x74, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x29,
+    0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72,
+    0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D,
+    0x65, 0x6E, 0x74, 0x20, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+    0x69, 0x6E, 0x68, 0x65, 0x72, 0x69, 0x74, 0x20, 0x62, 0x69,
+    0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x66, 0x72, 0x6F,
+    0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x65,
+    0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E,
+    0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20,
+    0x6E, 0x65, 0x77, 0x20, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+    0x6E, 0x67, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E,
+    0x6F, 0x74, 0x20, 0x70, 0x6F, 0x6C, 0x6C, 0x75, 0x74, 0x65,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6E,
+    0x74, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D,
+    0x65, 0x6E, 0x74, 0x2E, 0xDA, 0x85, 0x50, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x83, 0xE6, 0xDA, 0x05, 0xCE, 0x70, 0x28, 0x6F,
+    0x72, 0x64, 0x65, 0x72, 0x3C, 0x20, 0x26, 0x20, 0x78, 0x73,
+    0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69,
+    0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74,
+    0x72, 0x69, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x69, 0x6E, 0x63,
+    0x72, 0x65, 0x61, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x63,
+    0x63, 0x6F, 0x72, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F,
+    0x20, 0x61, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x6F,
+    0x72, 0x64, 0x65, 0x72, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20,
+    0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x61, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E,
+    0xDA, 0x85, 0x51, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x85, 0x52,
+    0xDA, 0x05, 0xCE, 0x80, 0x8D, 0x28, 0x6D, 0x61, 0x74, 0x68,
+    0x2F, 0x72, 0x6E, 0x67, 0x2D, 0x69, 0x6E, 0x74, 0x20, 0x72,
+    0x6E, 0x67, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x6D, 0x61,
+    0x78, 0x29, 0x0A, 0x0A, 0x45, 0x78, 0x74, 0x72, 0x61, 0x63,
+    0x74, 0x20, 0x61, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D,
+    0x20, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x20, 0x69, 0x6E,
+    0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x5B,
+    0x30, 0x2C, 0x20, 0x6D, 0x61, 0x78, 0x5D, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52, 0x4E, 0x47,
+    0x2E, 0x20, 0x49, 0x66, 0x20, 0x6E, 0x6F, 0x20, 0x6D, 0x61,
+    0x78, 0x20, 0x69, 0x73, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E,
+    0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61,
+    0x75, 0x6C, 0x74, 0x20, 0x69, 0x73, 0x20, 0x32, 0x5E, 0x33,
+    0x31, 0x20, 0x2D, 0x20, 0x31, 0x2E, 0xDA, 0x85, 0x53, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x84, 0xDB, 0xDA, 0x05, 0xCE, 0x70,
+    0x28, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3E, 0x20, 0x26, 0x20,
+    0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B,
+    0x20, 0x69, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73, 0x20,
+    0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x64,
+    0x65, 0x73, 0x63, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20,
+    0x61, 0x63, 0x63, 0x6F, 0x72, 0x64, 0x69, 0x6E, 0x67, 0x20,
+    0x74, 0x6F, 0x20, 0x61, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C,
+    0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x6F, 0x76, 0x65,
+    0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x61, 0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61,
+    0x6E, 0x2E, 0xDA, 0x85, 0x54, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x85, 0x56, 0xDA, 0x05, 0xCE, 0x50, 0x28, 0x3E, 0x3D, 0x20,
+    0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65,
+    0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69,
+    0x73, 0x20, 0x69, 0x6E, 0x20, 0x6E, 0x75, 0x6D, 0x65, 0x72,
+    0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x6E, 0x6F, 0x6E,
+    0x2D, 0x61, 0x73, 0x63, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+    0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x62, 0x6F,
+    0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xDA, 0x85, 0x57, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x85, 0x58, 0xDA, 0x05, 0xCE, 0x46,
+    0x28, 0x6F, 0x73, 0x2F, 0x67, 0x65, 0x74, 0x65, 0x6E, 0x76,
+    0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x29,
+    0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E, 0x20, 0x65,
+    0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74,
+    0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x2E,
+    0xDA, 0x85, 0x59, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x85, 0x5A,
+    0xDA, 0x05, 0xCE, 0x2A, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+    0x61, 0x63, 0x6F, 0x73, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x61, 0x72, 0x63, 0x63, 0x6F, 0x73, 0x69, 0x6E, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xDA, 0x85, 0x5B, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x85, 0x5D, 0xDA, 0x05, 0xCE, 0x81,
+    0x30, 0x28, 0x67, 0x65, 0x74, 0x20, 0x64, 0x73, 0x20, 0x6B,
+    0x65, 0x79, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x64, 0x66,
+    0x6C, 0x74, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6D,
+    0x61, 0x70, 0x70, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x6B,
+    0x65, 0x79, 0x20, 0x69, 0x6E, 0x20, 0x64, 0x61, 0x74, 0x61,
+    0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+    0x20, 0x64, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x66, 0x6C, 0x74,
+    0x20, 0x6F, 0x72, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66,
+    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64,
+    0x2E, 0x20, 0x53, 0x69, 0x6D, 0x69, 0x6C, 0x61, 0x72, 0x20,
+    0x74, 0x6F, 0x20, 0x69, 0x6E, 0x2C, 0x20, 0x62, 0x75, 0x74,
+    0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+    0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x61, 0x6E, 0x20, 0x65,
+    0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x69, 0x73, 0x20, 0x69,
+    0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
+    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20,
+    0x75, 0x6E, 0x6C, 0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75,
+    0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x61,
+    0x6E, 0x20, 0x61, 0x62, 0x73, 0x74, 0x72, 0x61, 0x63, 0x74,
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x2E, 0x20, 0x49, 0x6E, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x61, 0x73, 0x65, 0x2C,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x62, 0x73, 0x74, 0x72,
+    0x61, 0x63, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x67,
+    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x6D, 0x61, 0x79, 0x20,
+    0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x61, 0x6E, 0x20, 0x65,
+    0x72, 0x72, 0x6F, 0x72, 0x2E, 0xDA, 0x85, 0x5E, 0xD3, 0x03,
+    0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x85, 0x46, 0x01,
+    0xDA, 0x03, 0xDA, 0x85, 0x74, 0xDA, 0x05, 0xCE, 0x4B, 0x28,
+    0x64, 0x6F, 0x63, 0x2A, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20,
+    0x73, 0x79, 0x6D, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65,
+    0x6E, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x61, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C,
+    0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65,
+    0x6E, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D,
+    0x65, 0x6E, 0x74, 0x2E, 0xDA, 0x85, 0x75, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x85, 0x77, 0xDA, 0x05, 0xCE, 0x59, 0x28, 0x62,
+    0x6F, 0x72, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x62, 0x69, 0x74, 0x2D, 0x77, 0x69, 0x73, 0x65,
+    0x20, 0x6F, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6C, 0x6C,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E,
+    0x20, 0x78, 0x73, 0x2E, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20,
+    0x78, 0x20, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x20, 0x6D, 0x75,
+    0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x69,
+    0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2E, 0xDA, 0x85, 0x78,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x85, 0x79, 0xDA, 0x05, 0xCE,
+    0x80, 0xB8, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x72, 0x6E,
+    0x67, 0x2D, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x72,
+    0x6E, 0x67, 0x20, 0x6E, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20,
+    0x62, 0x75, 0x66, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20,
+    0x6E, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x20, 0x62,
+    0x79, 0x74, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70,
+    0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x20, 0x69, 0x6E,
+    0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E,
+    0x20, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x20, 0x69, 0x66, 0x20, 0x6E, 0x6F, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72,
+    0x6F, 0x76, 0x69, 0x64, 0x65, 0x64, 0x2C, 0x20, 0x6F, 0x74,
+    0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x61, 0x70,
+    0x70, 0x65, 0x6E, 0x64, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xDA, 0x85, 0x7A, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x82, 0x08, 0xDA, 0x05, 0xCE, 0x80,
+    0xD1, 0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x26, 0x20,
+    0x6B, 0x76, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61,
+    0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+    0x20, 0x61, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x64, 0x69,
+    0x63, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F,
+    0x66, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0x20, 0x6B,
+    0x76, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65,
+    0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6B, 0x31, 0x2C,
+    0x20, 0x76, 0x31, 0x2C, 0x20, 0x6B, 0x32, 0x2C, 0x20, 0x76,
+    0x32, 0x2C, 0x20, 0x6B, 0x33, 0x2C, 0x20, 0x76, 0x33, 0x2C,
+    0x20, 0x2E, 0x2E, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x6B, 0x76,
+    0x73, 0x20, 0x68, 0x61, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x6F,
+    0x64, 0x64, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20,
+    0x6F, 0x66, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+    0x73, 0x2C, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F,
+    0x72, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20,
+    0x74, 0x68, 0x72, 0x6F, 0x77, 0x6E, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6E, 0x65, 0x77, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E,
+    0xDA, 0x85, 0x7B, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00,
+    0xDA, 0x12, 0x53, 0x01, 0xDA, 0x03, 0xDA, 0x83, 0x23, 0xDA,
+    0x05, 0xCE, 0x24, 0x28, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63,
+    0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x2E, 0xDA,
+    0x85, 0x7C, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x83, 0x4F, 0x01, 0xDA, 0x03, 0xDA, 0x85, 0x7E, 0xDA,
+    0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x80, 0xDC, 0x28, 0x2D, 0x3E,
+    0x3E, 0x20, 0x78, 0x20, 0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D,
+    0x73, 0x29, 0x0A, 0x0A, 0x54, 0x68, 0x72, 0x65, 0x61, 0x64,
+    0x69, 0x6E, 0x67, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E,
+    0x20, 0x49, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x73, 0x20, 0x78,
+    0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61,
+    0x73, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69,
+    0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x20, 0x69, 0x6E,
+    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x2C, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69,
+    0x65, 0x64, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66,
+    0x6F, 0x72, 0x6D, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x20,
+    0x66, 0x6F, 0x72, 0x6D, 0x20, 0x20, 0x69, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x6D, 0x61,
+    0x6E, 0x6E, 0x65, 0x72, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x73, 0x6F, 0x20, 0x6F, 0x6E, 0x2E, 0x20, 0x55, 0x73, 0x65,
+    0x66, 0x75, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x78,
+    0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x70,
+    0x69, 0x70, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x6F,
+    0x66, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0xDA, 0x85, 0x7F,
+    0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x87,
+    0x8F, 0x01, 0xDA, 0x03, 0xDA, 0x83, 0x70, 0xDA, 0x05, 0xCE,
+    0x3E, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6D, 0x61, 0x70,
+    0x70, 0x69, 0x6E, 0x67, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x65,
+    0x64, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x20, 0x69,
+    0x64, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x73,
+    0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20,
+    0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x2E, 0xDA, 0x85, 0x80, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x85, 0x81, 0xDA, 0x05, 0xCE, 0x80, 0xD1, 0x28, 0x70,
+    0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x63, 0x6C, 0x6F, 0x6E,
+    0x65, 0x20, 0x70, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61,
+    0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x64, 0x65, 0x65, 0x70,
+    0x20, 0x63, 0x6C, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20,
+    0x61, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x69, 0x64, 0x65,
+    0x6E, 0x74, 0x69, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2E, 0x20, 0x54, 0x68,
+    0x69, 0x73, 0x20, 0x63, 0x6C, 0x6F, 0x6E, 0x65, 0x64, 0x20,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x63, 0x61, 0x6E,
+    0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74,
+    0x6F, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x65,
+    0x20, 0x70, 0x61, 0x72, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x66,
+    0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x67, 0x6F, 0x6F, 0x64,
+    0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x70, 0x6F, 0x69, 0x6E,
+    0x74, 0x20, 0x69, 0x66, 0x20, 0x70, 0x61, 0x72, 0x73, 0x69,
+    0x6E, 0x67, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x72, 0x20, 0x66,
+    0x61, 0x69, 0x6C, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2E, 0xDA, 0x85, 0x82,
+    0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x56,
+    0x01, 0xDA, 0x03, 0xDA, 0x81, 0xED, 0xDA, 0x05, 0xCE, 0x24,
+    0x28, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x3F, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69,
+    0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73,
+    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0xDA, 0x85, 0x83, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x85, 0x85, 0xDA, 0x05, 0xCE, 0x6C,
+    0x28, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3E, 0x3D, 0x20, 0x26,
+    0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63,
+    0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73,
+    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x69, 0x6E, 0x63, 0x72, 0x65,
+    0x61, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x63, 0x63, 0x6F,
+    0x72, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x61,
+    0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x6F, 0x72, 0x64,
+    0x65, 0x72, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x61, 0x6C,
+    0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xDA, 0x85,
+    0x86, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x85, 0x87, 0xDA, 0x05,
+    0xCE, 0x6E, 0x28, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2F, 0x77,
+    0x65, 0x61, 0x6B, 0x2D, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+    0x20, 0x63, 0x61, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x29,
+    0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x65, 0x6D, 0x70, 0x74,
+    0x79, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x77, 0x65, 0x61, 0x6B, 0x20, 0x72, 0x65,
+    0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x73, 0x20, 0x74,
+    0x6F, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x2E, 0xDA, 0x85, 0x88, 0xD3, 0x04, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x81, 0x19, 0x01, 0xDA, 0x03, 0xDA,
+    0x85, 0x8C, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x81, 0x38,
+    0x28, 0x77, 0x69, 0x74, 0x68, 0x20, 0x5B, 0x62, 0x69, 0x6E,
+    0x64, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x74, 0x6F, 0x72, 0x20,
+    0x64, 0x74, 0x6F, 0x72, 0x5D, 0x20, 0x26, 0x20, 0x62, 0x6F,
+    0x64, 0x79, 0x29, 0x0A, 0x0A, 0x45, 0x76, 0x61, 0x6C, 0x75,
+    0x61, 0x74, 0x65, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x73, 0x6F, 0x6D, 0x65, 0x20, 0x72,
+    0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2C, 0x20, 0x77,
+    0x68, 0x69, 0x63, 0x68, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+    0x62, 0x65, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x6D, 0x61, 0x74,
+    0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x63, 0x6C, 0x65,
+    0x61, 0x6E, 0x65, 0x64, 0x20, 0x75, 0x70, 0x20, 0x20, 0x69,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x73,
+    0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20,
+    0x69, 0x6E, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x2E, 0x20, 0x62,
+    0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x73, 0x20,
+    0x62, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73,
+    0x69, 0x6F, 0x6E, 0x20, 0x63, 0x74, 0x6F, 0x72, 0x2C, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x20, 0x64, 0x74, 0x6F, 0x72, 0x20,
+    0x69, 0x73, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x72, 0x20, 0x63, 0x61, 0x6C,
+    0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x69, 0x73, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+    0x6E, 0x67, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x6E, 0x6F, 0x20,
+    0x64, 0x65, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72,
+    0x20, 0x20, 0x28, 0x64, 0x74, 0x6F, 0x72, 0x29, 0x20, 0x69,
+    0x73, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x2C, 0x20, 0x77,
+    0x69, 0x6C, 0x6C, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x3A,
+    0x63, 0x6C, 0x6F, 0x73, 0x65, 0x20, 0x6F, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63,
+    0x65, 0x2E, 0xDA, 0x85, 0x8D, 0xD3, 0x04, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x83, 0xAF, 0x01, 0xDA, 0x03, 0xDA,
+    0x85, 0x92, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x80, 0xDE,
+    0x28, 0x61, 0x73, 0x3F, 0x2D, 0x3E, 0x20, 0x78, 0x20, 0x61,
+    0x73, 0x20, 0x26, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29,
+    0x0A, 0x0A, 0x54, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66,
+    0x6F, 0x72, 0x6D, 0x73, 0x20, 0x74, 0x6F, 0x67, 0x65, 0x74,
+    0x68, 0x65, 0x72, 0x2C, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61,
+    0x63, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x73, 0x20, 0x69, 0x6E,
+    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x20, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x70, 0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x20, 0x66,
+    0x6F, 0x72, 0x6D, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x69,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x20, 0x78, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x61, 0x6E,
+    0x79, 0x20, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6D, 0x65,
+    0x64, 0x69, 0x61, 0x74, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66, 0x61, 0x6C,
+    0x73, 0x65, 0x79, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x3B, 0x20, 0x6F, 0x74, 0x68,
+    0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2C, 0x20, 0x72, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x2E, 0xDA, 0x85, 0x93, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x85, 0x94, 0xDA, 0x05, 0xCE, 0x80, 0xE2, 0x28, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x2F, 0x72, 0x61, 0x77, 0x67, 0x65, 0x74,
+    0x20, 0x74, 0x61, 0x62, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x0A,
+    0x0A, 0x47, 0x65, 0x74, 0x73, 0x20, 0x61, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61,
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x6F, 0x75, 0x74, 0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x69,
+    0x6E, 0x67, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x20,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20, 0x49, 0x66, 0x20,
+    0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x61,
+    0x62, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74,
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x74,
+    0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6C, 0x79, 0x2C,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x63, 0x68,
+    0x65, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0x2E, 0xDA, 0x85, 0x95, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x83, 0x7C, 0xDA, 0x05, 0xCE, 0x81, 0x11, 0x28, 0x66,
+    0x69, 0x6C, 0x65, 0x2F, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x20,
+    0x66, 0x29, 0x0A, 0x0A, 0x43, 0x6C, 0x6F, 0x73, 0x65, 0x20,
+    0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x72, 0x65, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x61,
+    0x6C, 0x6C, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x65, 0x64,
+    0x20, 0x72, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x73,
+    0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20, 0x79, 0x6F, 0x75,
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x20,
+    0x72, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20,
+    0x66, 0x69, 0x6C, 0x65, 0x2C, 0x20, 0x63, 0x6C, 0x6F, 0x73,
+    0x65, 0x20, 0x69, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72,
+    0x65, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x20, 0x72, 0x65,
+    0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x6C, 0x65, 0x61,
+    0x6B, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6C, 0x65, 0x74, 0x20,
+    0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6F, 0x63,
+    0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+    0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x6F, 0x66, 0x20,
+    0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2F, 0x70, 0x6F, 0x70,
+    0x65, 0x6E, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x2C, 0x20, 0x63,
+    0x6C, 0x6F, 0x73, 0x65, 0x20, 0x77, 0x61, 0x69, 0x74, 0x73,
+    0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x65,
+    0x78, 0x69, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73,
+    0x2E, 0xDA, 0x85, 0x96, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x85,
+    0x97, 0xDA, 0x05, 0xCE, 0x80, 0x8F, 0x28, 0x6F, 0x73, 0x2F,
+    0x6D, 0x6B, 0x64, 0x69, 0x72, 0x20, 0x70, 0x61, 0x74, 0x68,
+    0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x64, 0x69, 0x72, 0x65,
+    0x63, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x20, 0x54, 0x68, 0x65,
+    0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+    0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69,
+    0x76, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x64, 0x69,
+    0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x69, 0x66,
+    0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2C,
+    0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65,
+    0x20, 0x69, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62,
+    0x65, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x62, 0x73, 0x6F, 0x6C,
+    0x75, 0x74, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2E, 0xDA,
+    0x85, 0x98, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x82, 0x33, 0x01, 0xDA, 0x03, 0xDA, 0x81, 0xF1, 0xDA,
+    0x05, 0xCE, 0x39, 0x28, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69,
+    0x74, 0x79, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x41, 0x20, 0x66,
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x69, 0x74, 0x73, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74,
+    0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E,
+    0xDA, 0x85, 0x99, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x85, 0x9A,
+    0xDA, 0x05, 0xCE, 0x2F, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+    0x73, 0x69, 0x6E, 0x68, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x68, 0x79, 0x70, 0x65, 0x72, 0x62, 0x6F, 0x6C, 0x69, 0x63,
+    0x20, 0x73, 0x69, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78,
+    0x2E, 0xDA, 0x85, 0x9B, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03,
+    0x00, 0xDA, 0x12, 0x83, 0x5C, 0x01, 0xDA, 0x03, 0xDA, 0x85,
+    0x9D, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x81, 0x2A, 0x28,
+    0x2D, 0x3F, 0x3E, 0x20, 0x78, 0x20, 0x26, 0x20, 0x66, 0x6F,
+    0x72, 0x6D, 0x73, 0x29, 0x0A, 0x0A, 0x53, 0x68, 0x6F, 0x72,
+    0x74, 0x20, 0x63, 0x69, 0x72, 0x63, 0x75, 0x69, 0x74, 0x20,
+    0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20,
+    0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E, 0x20, 0x49, 0x6E, 0x73,
+    0x65, 0x72, 0x74, 0x73, 0x20, 0x78, 0x20, 0x61, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F,
+    0x72, 0x6D, 0x20, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6F, 0x72,
+    0x6D, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x6E,
+    0x73, 0x65, 0x72, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x66,
+    0x69, 0x72, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20,
+    0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+    0x65, 0x63, 0x6F, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x6D,
+    0x20, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+    0x61, 0x6D, 0x65, 0x20, 0x6D, 0x61, 0x6E, 0x6E, 0x65, 0x72,
+    0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x6F, 0x20, 0x6F,
+    0x6E, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x70, 0x69, 0x70,
+    0x65, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69,
+    0x6C, 0x20, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6E, 0x20, 0x69,
+    0x6E, 0x74, 0x65, 0x72, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x74,
+    0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x73,
+    0x20, 0x6E, 0x69, 0x6C, 0x2E, 0x20, 0x20, 0x55, 0x73, 0x65,
+    0x66, 0x75, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x78,
+    0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x70,
+    0x69, 0x70, 0x65, 0x6C, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x6F,
+    0x66, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0xDA, 0x85, 0x9E,
+    0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x87,
+    0x1B, 0x01, 0xDA, 0x03, 0xDA, 0x87, 0x4F, 0xDA, 0x05, 0xCE,
+    0x80, 0xD1, 0x28, 0x6D, 0x61, 0x6B, 0x65, 0x2D, 0x69, 0x6D,
+    0x61, 0x67, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x29, 0x0A, 0x0A,
+    0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6E, 0x20,
+    0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+    0x20, 0x61, 0x6E, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F,
+    0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x72, 0x65,
+    0x71, 0x75, 0x69, 0x72, 0x65, 0x2E, 0x20, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x73, 0x6F, 0x75, 0x72,
+    0x63, 0x65, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x49, 0x6D, 0x61, 0x67,
+    0x65, 0x73, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x68, 0x65, 0x61, 0x64,
+    0x65, 0x72, 0x20, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x72, 0x64,
+    0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6D,
+    0x61, 0x67, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76,
+    0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20,
+    0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x6D, 0x61, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x6D,
+    0x2E, 0xDA, 0x87, 0x4E, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x87,
+    0x4D, 0xDA, 0x05, 0xCE, 0x29, 0x28, 0x6F, 0x73, 0x2F, 0x72,
+    0x6D, 0x20, 0x70, 0x61, 0x74, 0x68, 0x29, 0x0A, 0x0A, 0x44,
+    0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x61, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0xDA, 0x86, 0x50, 0xD3,
+    0x03, 0xDA, 0x80, 0xCD, 0xCB, 0xDA, 0x11, 0xD2, 0x03, 0x00,
+    0xDA, 0x12, 0x87, 0x18, 0x01, 0xDA, 0x03, 0xDA, 0x84, 0x9F,
+    0xDA, 0x87, 0x3B, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00,
+    0xDA, 0x12, 0x87, 0x93, 0x01, 0xDA, 0x03, 0xDA, 0x87, 0x3A,
+    0xDA, 0x05, 0xCE, 0x58, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x20,
+    0x6D, 0x61, 0x70, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x75,
+    0x72, 0x72, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x20, 0x6C, 0x6F,
+    0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x6F, 0x64, 0x75,
+    0x6C, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x72, 0x75,
+    0x65, 0x2E, 0x20, 0x55, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F,
+    0x20, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x20,
+    0x63, 0x69, 0x72, 0x63, 0x75, 0x6C, 0x61, 0x72, 0x20, 0x64,
+    0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x69, 0x65,
+    0x73, 0x2E, 0xDA, 0x86, 0x54, 0xD3, 0x04, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x81, 0x0E, 0x01, 0xDA, 0x03, 0xDA,
+    0x86, 0x53, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x65, 0x28,
+    0x77, 0x69, 0x74, 0x68, 0x2D, 0x73, 0x79, 0x6D, 0x73, 0x20,
+    0x73, 0x79, 0x6D, 0x73, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64,
+    0x79, 0x29, 0x0A, 0x0A, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61,
+    0x74, 0x65, 0x73, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x73,
+    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x69, 0x6E, 0x20, 0x73,
+    0x79, 0x6D, 0x73, 0x20, 0x62, 0x6F, 0x75, 0x6E, 0x64, 0x20,
+    0x74, 0x6F, 0x20, 0x61, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72,
+    0x61, 0x74, 0x65, 0x64, 0x2C, 0x20, 0x75, 0x6E, 0x69, 0x71,
+    0x75, 0x65, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E,
+    0xDA, 0x86, 0xD3, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00,
+    0xDA, 0x12, 0x82, 0xAA, 0x01, 0xDA, 0x03, 0xDA, 0x86, 0xD2,
+    0xDA, 0x05, 0xCE, 0x71, 0x28, 0x6D, 0x61, 0x70, 0x63, 0x61,
+    0x74, 0x20, 0x66, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A,
+    0x4D, 0x61, 0x70, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20,
+    0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E, 0x20,
+    0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x74,
+    0x75, 0x70, 0x6C, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x20,
+    0x75, 0x73, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+    0x74, 0x6F, 0x20, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x65,
+    0x6E, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
+    0x65, 0x73, 0x75, 0x6C, 0x74, 0x73, 0x2E, 0xDA, 0x86, 0x77,
+    0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x82,
+    0x3D, 0x01, 0xDA, 0x03, 0xDA, 0x81, 0x2F, 0xDA, 0x05, 0xCE,
+    0x80, 0xBF, 0x28, 0x65, 0x78, 0x74, 0x72, 0x65, 0x6D, 0x65,
+    0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x61, 0x72, 0x67,
+    0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x73, 0x74,
+    0x20, 0x65, 0x78, 0x74, 0x72, 0x65, 0x6D, 0x65, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x72,
+    0x67, 0x73, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x6F,
+    0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72,
+    0x2E, 0x20, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x73,
+    0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x74, 0x61, 0x6B, 0x65,
+    0x20, 0x74, 0x77, 0x6F, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x6F, 0x72,
+    0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x28, 0x61, 0x20,
+    0x63, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x69, 0x73, 0x6F, 0x6E,
+    0x29, 0x2E, 0x20, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66, 0x20, 0x61,
+    0x72, 0x67, 0x73, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6D, 0x70,
+    0x74, 0x79, 0x2E, 0xDA, 0x86, 0xA9, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x86, 0xA8, 0xDA, 0x05, 0xCE, 0x29, 0x28, 0x6D, 0x61,
+    0x74, 0x68, 0x2F, 0x6C, 0x6F, 0x67, 0x31, 0x30, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x6C, 0x6F, 0x67, 0x20, 0x62, 0x61, 0x73, 0x65, 0x20,
+    0x31, 0x30, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xDA, 0x86,
+    0x5B, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x86, 0x5A, 0xDA, 0x05,
+    0xCE, 0x4D, 0x28, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x7C, 0x73, 0x69, 0x7A, 0x65, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x79, 0x70,
+    0x65, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x63,
+    0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xDA,
+    0x86, 0xA4, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x87, 0x13, 0x01, 0xDA, 0x03, 0xDA, 0x81, 0x77, 0xDA,
+    0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x5F, 0x28, 0x63, 0x6F, 0x6D,
+    0x70, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x78, 0x29, 0x0A, 0x0A,
+    0x20, 0x20, 0x45, 0x76, 0x61, 0x6C, 0x73, 0x20, 0x78, 0x20,
+    0x61, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65,
+    0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x2E, 0x20,
+    0x53, 0x69, 0x6D, 0x69, 0x6C, 0x61, 0x72, 0x20, 0x74, 0x6F,
+    0x20, 0x61, 0x20, 0x74, 0x6F, 0x70, 0x20, 0x6C, 0x65, 0x76,
+    0x65, 0x6C, 0x20, 0x75, 0x6E, 0x71, 0x75, 0x6F, 0x74, 0x65,
+    0x2E, 0xDA, 0x86, 0xE9, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81,
+    0x16, 0xDA, 0x05, 0xCE, 0x81, 0x6D, 0x28, 0x6E, 0x65, 0x78,
+    0x74, 0x20, 0x64, 0x69, 0x63, 0x74, 0x20, 0x26, 0x6F, 0x70,
+    0x74, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x0A, 0x0A, 0x47, 0x65,
+    0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x78,
+    0x74, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x69, 0x6E, 0x20, 0x61,
+    0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6F, 0x72,
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20, 0x43, 0x61,
+    0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20,
+    0x74, 0x6F, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x65,
+    0x20, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x6F, 0x66,
+    0x20, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74,
+    0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x69, 0x6E,
+    0x20, 0x61, 0x6E, 0x20, 0x75, 0x6E, 0x73, 0x70, 0x65, 0x63,
+    0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x6F, 0x72, 0x64, 0x65,
+    0x72, 0x2E, 0x20, 0x4B, 0x65, 0x79, 0x73, 0x20, 0x61, 0x72,
+    0x65, 0x20, 0x67, 0x75, 0x61, 0x72, 0x61, 0x6E, 0x74, 0x65,
+    0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x73,
+    0x65, 0x65, 0x6E, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x6F,
+    0x6E, 0x63, 0x65, 0x20, 0x70, 0x65, 0x72, 0x20, 0x69, 0x74,
+    0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x64, 0x61, 0x74, 0x61,
+    0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+    0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6D, 0x75,
+    0x74, 0x61, 0x74, 0x65, 0x64, 0x20, 0x64, 0x75, 0x72, 0x69,
+    0x6E, 0x67, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69,
+    0x6F, 0x6E, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x6B, 0x65, 0x79,
+    0x20, 0x69, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2C, 0x20, 0x6E,
+    0x65, 0x78, 0x74, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73,
+    0x74, 0x20, 0x6B, 0x65, 0x79, 0x2E, 0x20, 0x49, 0x66, 0x20,
+    0x6E, 0x65, 0x78, 0x74, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2C, 0x20, 0x74, 0x68,
+    0x65, 0x72, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F,
+    0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x73,
+    0x20, 0x74, 0x6F, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74,
+    0x65, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x2E,
+    0x20, 0xDA, 0x85, 0xC3, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x85,
+    0xC2, 0xDA, 0x05, 0xCE, 0x80, 0xB8, 0x28, 0x61, 0x73, 0x6D,
+    0x20, 0x61, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D,
+    0x70, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x72, 0x65, 0x73, 0x75,
+    0x6C, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x61, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79, 0x2E, 0x0A,
+    0x54, 0x68, 0x65, 0x20, 0x73, 0x79, 0x6E, 0x74, 0x61, 0x78,
+    0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79, 0x20, 0x63, 0x61,
+    0x6E, 0x20, 0x62, 0x65, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64,
+    0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6A, 0x61,
+    0x6E, 0x65, 0x74, 0x20, 0x77, 0x69, 0x6B, 0x69, 0x2E, 0x20,
+    0x57, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77,
+    0x20, 0x61, 0x6E, 0x0A, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20,
+    0x6F, 0x6E, 0x20, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64,
+    0x20, 0x61, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79, 0x2E,
+    0xDA, 0x86, 0x8C, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x83, 0x25,
+    0xDA, 0x05, 0xCE, 0x80, 0xB1, 0x28, 0x6C, 0x65, 0x6E, 0x67,
+    0x74, 0x68, 0x20, 0x64, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x6F, 0x72, 0x20,
+    0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x61,
+    0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75,
+    0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x63,
+    0x6F, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x74, 0x20, 0x74, 0x69,
+    0x6D, 0x65, 0x20, 0x61, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x69,
+    0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2E, 0x20, 0x46, 0x6F,
+    0x72, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x73, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x73,
+    0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x20, 0x6F, 0x66, 0x20, 0x6B, 0x65, 0x79, 0x2D, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x20, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20,
+    0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74,
+    0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72,
+    0x65, 0x2E, 0xDA, 0x86, 0xBB, 0xD3, 0x03, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x52, 0x01, 0xDA, 0x03, 0xDA, 0x86,
+    0xBA, 0xDA, 0x05, 0xCE, 0x23, 0x28, 0x6F, 0x6E, 0x65, 0x3F,
+    0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B,
+    0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x65,
+    0x71, 0x75, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x31, 0x2E,
+    0xDA, 0x87, 0x4C, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x87, 0x4B,
+    0xDA, 0x05, 0xCE, 0x80, 0xD2, 0x28, 0x68, 0x61, 0x73, 0x68,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x0A, 0x0A, 0x47,
+    0x65, 0x74, 0x73, 0x20, 0x61, 0x20, 0x68, 0x61, 0x73, 0x68,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x61, 0x6E, 0x79, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x20, 0x54, 0x68,
+    0x65, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x69, 0x73, 0x20,
+    0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72,
+    0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73,
+    0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x63, 0x68,
+    0x65, 0x61, 0x70, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x66,
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6A, 0x61, 0x6E, 0x65,
+    0x74, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x73, 0x2E,
+    0x20, 0x49, 0x66, 0x20, 0x74, 0x77, 0x6F, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73,
+    0x74, 0x72, 0x69, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x65, 0x71,
+    0x75, 0x61, 0x6C, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x79, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+    0x68, 0x61, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+    0x61, 0x6D, 0x65, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x2E, 0xDA, 0x86, 0xD0, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x86, 0xCF, 0xDA, 0x05, 0xCE, 0x31, 0x28,
+    0x6D, 0x61, 0x74, 0x68, 0x2F, 0x63, 0x6F, 0x73, 0x68, 0x20,
+    0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x79, 0x70, 0x65, 0x72,
+    0x62, 0x6F, 0x6C, 0x69, 0x63, 0x20, 0x63, 0x6F, 0x73, 0x69,
+    0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xDA, 0x86,
+    0xE2, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x82, 0xAD, 0xDA, 0x05,
+    0xCE, 0x80, 0xFD, 0x28, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72,
+    0x2F, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x49, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20,
+    0x69, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74,
+    0x65, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x65, 0x73, 0x73, 0x61,
+    0x67, 0x65, 0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61,
+    0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E,
+    0x20, 0x4F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65,
+    0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x6E, 0x69, 0x6C, 0x2E, 0x20, 0x41, 0x6C, 0x73, 0x6F, 0x20,
+    0x66, 0x6C, 0x75, 0x73, 0x68, 0x65, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x73,
+    0x74, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70,
+    0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x71, 0x75, 0x65, 0x75,
+    0x65, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x73,
+    0x75, 0x72, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x68, 0x61, 0x6E,
+    0x64, 0x6C, 0x65, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x74,
+    0x68, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x20, 0x62, 0x65,
+    0x66, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x69,
+    0x6E, 0x67, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F,
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E, 0xDA, 0x85, 0xB8, 0xD3,
+    0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x83, 0xE0,
+    0x01, 0xDA, 0x03, 0xDA, 0x85, 0xB7, 0xDA, 0x05, 0xCE, 0x59,
+    0x28, 0x65, 0x76, 0x65, 0x72, 0x79, 0x3F, 0x20, 0x69, 0x6E,
+    0x64, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x66, 0x20,
+    0x65, 0x61, 0x63, 0x68, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x20, 0x69, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x74, 0x72, 0x75,
+    0x74, 0x68, 0x79, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72,
+    0x77, 0x69, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x72, 0x73, 0x74, 0x20, 0x20, 0x66, 0x61, 0x6C, 0x73,
+    0x65, 0x79, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0xDA,
+    0x86, 0x72, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x86, 0x71, 0xDA,
+    0x05, 0xCE, 0x5B, 0x28, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x20,
+    0x78, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x73, 0x74, 0x61,
+    0x72, 0x74, 0x20, 0x65, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x45,
+    0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20, 0x61, 0x20, 0x73,
+    0x75, 0x62, 0x2D, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78,
+    0x65, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74,
+    0x72, 0x75, 0x74, 0x72, 0x75, 0x65, 0x20, 0x6F, 0x72, 0x20,
+    0x62, 0x79, 0x74, 0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65,
+    0x6E, 0x63, 0x65, 0x2E, 0xDA, 0x86, 0xE1, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x86, 0xE0, 0xDA, 0x05, 0xCE, 0x80, 0xF9, 0x28,
+    0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x65, 0x70,
+    0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x26, 0x6F, 0x70,
+    0x74, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x75, 0x6E, 0x20,
+    0x61, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x76, 0x69, 0x72, 0x74,
+    0x75, 0x61, 0x6C, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x72, 0x75,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x4A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x6D,
+    0x61, 0x63, 0x68, 0x69, 0x6E, 0x65, 0x2E, 0x20, 0x43, 0x61,
+    0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C,
+    0x6C, 0x79, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x69, 0x6E,
+    0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62,
+    0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20, 0x61,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75,
+    0x6D, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2C, 0x20, 0x77, 0x68,
+    0x69, 0x63, 0x68, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x75,
+    0x73, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x62, 0x65, 0x20,
+    0x6E, 0x69, 0x6C, 0x2C, 0x20, 0x61, 0x73, 0x20, 0x62, 0x72,
+    0x65, 0x61, 0x6B, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x73, 0x20,
+    0x72, 0x61, 0x69, 0x73, 0x65, 0x20, 0x6E, 0x69, 0x6C, 0x20,
+    0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73, 0x2E, 0xDA, 0x87,
+    0x2D, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x83, 0x85, 0xDA, 0x05,
+    0xCE, 0x80, 0xBD, 0x28, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x2D,
+    0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x61, 0x62, 0x20, 0x26,
+    0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x73, 0x29, 0x0A, 0x0A, 0x4D,
+    0x65, 0x72, 0x67, 0x65, 0x73, 0x20, 0x6D, 0x75, 0x6C, 0x74,
+    0x69, 0x70, 0x6C, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x73, 0x2F, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x73, 0x20,
+    0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 0x6B,
+    0x65, 0x79, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x73,
+    0x20, 0x69, 0x6E, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74,
+    0x68, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x63, 0x6F,
+    0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20,
+    0x74, 0x68, 0x65, 0x6E, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x72,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x72, 0x65,
+    0x70, 0x6C, 0x61, 0x63, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20,
+    0x70, 0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x20, 0x6F,
+    0x6E, 0x65, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x72, 0x69,
+    0x67, 0x69, 0x6E, 0x61, 0x6C, 0x20, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x2E, 0xDA, 0x86, 0xCC, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x86, 0xCB, 0xDA, 0x05, 0xCE, 0x82, 0x57, 0x28, 0x70, 0x75,
+    0x74, 0x20, 0x64, 0x73, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x29, 0x0A, 0x0A, 0x41, 0x73, 0x73,
+    0x6F, 0x63, 0x69, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6B,
+    0x65, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61,
+    0x6E, 0x79, 0x20, 0x6D, 0x75, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x69,
+    0x76, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74,
+    0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x20, 0x49,
+    0x6E, 0x64, 0x65, 0x78, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74,
+    0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72,
+    0x65, 0x73, 0x20, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x73, 0x29, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61,
+    0x63, 0x63, 0x65, 0x70, 0x74, 0x20, 0x6E, 0x6F, 0x6E, 0x2D,
+    0x6E, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x69,
+    0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x6B, 0x65, 0x79,
+    0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x77, 0x69, 0x6C,
+    0x6C, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x20, 0x69,
+    0x66, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x75, 0x74, 0x20, 0x6F,
+    0x66, 0x20, 0x62, 0x6F, 0x75, 0x6E, 0x64, 0x73, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72,
+    0x6F, 0x76, 0x69, 0x64, 0x65, 0x64, 0x2E, 0x20, 0x49, 0x6E,
+    0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2C,
+    0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x73, 0x70, 0x61,
+    0x63, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65,
+    0x20, 0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x6E, 0x69, 0x6C, 0x73, 0x2C, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2C, 0x20, 0x65, 0x78, 0x74, 0x72,
+    0x61, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x77, 0x69,
+    0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x6C,
+    0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x30, 0x20,
+    0x62, 0x79, 0x74, 0x65, 0x73, 0x2E, 0x20, 0x49, 0x6E, 0x20,
+    0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2C, 0x20, 0x70,
+    0x75, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x6B,
+    0x65, 0x79, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73,
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x65, 0x64,
+    0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74,
+    0x79, 0x70, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x68,
+    0x69, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x73,
+    0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x62, 0x79,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F,
+    0x74, 0x79, 0x70, 0x65, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20,
+    0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6D,
+    0x75, 0x74, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x20,
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20, 0x50, 0x75, 0x74,
+    0x74, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x6E, 0x74,
+    0x6F, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+    0x77, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x76,
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61,
+    0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75,
+    0x72, 0x65, 0x20, 0x64, 0x73, 0x2E, 0xDA, 0x86, 0xE8, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x86, 0xE7, 0xDA, 0x05, 0xCE, 0x81,
+    0x28, 0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x73,
+    0x6C, 0x69, 0x63, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+    0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x73, 0x74, 0x61, 0x72,
+    0x74, 0x20, 0x65, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x54, 0x61,
+    0x6B, 0x65, 0x73, 0x20, 0x61, 0x20, 0x73, 0x6C, 0x69, 0x63,
+    0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73, 0x74, 0x61, 0x72,
+    0x74, 0x20, 0x74, 0x6F, 0x20, 0x65, 0x6E, 0x64, 0x2E, 0x20,
+    0x54, 0x68, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20,
+    0x69, 0x73, 0x20, 0x68, 0x61, 0x6C, 0x66, 0x20, 0x6F, 0x70,
+    0x65, 0x6E, 0x2C, 0x20, 0x5B, 0x73, 0x74, 0x61, 0x72, 0x74,
+    0x2C, 0x20, 0x65, 0x6E, 0x64, 0x29, 0x2E, 0x20, 0x49, 0x6E,
+    0x64, 0x65, 0x78, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20,
+    0x61, 0x6C, 0x73, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x6E, 0x65,
+    0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2C, 0x20, 0x69, 0x6E,
+    0x64, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E,
+    0x64, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x42, 0x79, 0x20, 0x64,
+    0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2C, 0x20, 0x73, 0x74,
+    0x61, 0x72, 0x74, 0x20, 0x69, 0x73, 0x20, 0x30, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x69, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xDA, 0x86, 0x4A,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x86, 0x49, 0xDA, 0x05, 0xCE,
+    0x81, 0x10, 0x28, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F, 0x62,
+    0x72, 0x65, 0x61, 0x6B, 0x20, 0x73, 0x6F, 0x75, 0x72, 0x63,
+    0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x2D, 0x6F, 0x66, 0x66,
+    0x73, 0x65, 0x74, 0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74, 0x73,
+    0x20, 0x61, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x70, 0x6F,
+    0x69, 0x6E, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73,
+    0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x61, 0x20, 0x6B, 0x65,
+    0x79, 0x20, 0x61, 0x74, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76,
+    0x65, 0x6E, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x2E, 0x20,
+    0x57, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77,
+    0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20,
+    0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x72, 0x65,
+    0x61, 0x6B, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x6C, 0x6F,
+    0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6E,
+    0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x66, 0x6F, 0x75,
+    0x6E, 0x64, 0x2E, 0x20, 0x46, 0x6F, 0x72, 0x20, 0x65, 0x78,
+    0x61, 0x6D, 0x70, 0x6C, 0x65, 0x0A, 0x0A, 0x09, 0x28, 0x64,
+    0x65, 0x62, 0x75, 0x67, 0x2F, 0x62, 0x72, 0x65, 0x61, 0x6B,
+    0x20, 0x22, 0x63, 0x6F, 0x72, 0x65, 0x2E, 0x6A, 0x61, 0x6E,
+    0x65, 0x74, 0x22, 0x20, 0x31, 0x30, 0x30, 0x30, 0x29, 0x0A,
+    0x0A, 0x77, 0x69, 0x6C, 0x20, 0x73, 0x65, 0x74, 0x20, 0x61,
+    0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x70, 0x6F, 0x69, 0x6E,
+    0x74, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x31,
+    0x30, 0x30, 0x30, 0x74, 0x68, 0x20, 0x62, 0x79, 0x74, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x20, 0x63, 0x6F, 0x72, 0x65, 0x2E, 0x6A, 0x61,
+    0x6E, 0x65, 0x74, 0x2E, 0xDA, 0x87, 0x42, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x87, 0x41, 0xDA, 0x05, 0xCE, 0x4C, 0x28, 0x69,
+    0x6E, 0x74, 0x2F, 0x75, 0x36, 0x34, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74,
+    0x65, 0x20, 0x61, 0x20, 0x62, 0x6F, 0x78, 0x65, 0x64, 0x20,
+    0x75, 0x6E, 0x73, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x20, 0x36,
+    0x34, 0x20, 0x62, 0x69, 0x74, 0x20, 0x69, 0x6E, 0x74, 0x65,
+    0x67, 0x65, 0x72, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61,
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x2E, 0xDA, 0x86, 0x90, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x85, 0xE0, 0xDA, 0x05, 0xCE, 0x82, 0x97, 0x28,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2F, 0x73, 0x74, 0x61,
+    0x74, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20,
+    0x26, 0x6F, 0x70, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74,
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6E, 0x61,
+    0x6C, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x72, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 0x6B, 0x65,
+    0x79, 0x20, 0x69, 0x73, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65,
+    0x64, 0x2C, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x62, 0x6F, 0x75, 0x74,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65,
+    0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x65, 0x64, 0x2E, 0x20, 0x41, 0x6C, 0x6C, 0x6F, 0x77, 0x65,
+    0x64, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x61, 0x72, 0x65,
+    0x3A, 0x0A, 0x0A, 0x09, 0x3A, 0x64, 0x65, 0x6C, 0x69, 0x6D,
+    0x69, 0x74, 0x65, 0x72, 0x73, 0x20, 0x2D, 0x20, 0x45, 0x61,
+    0x63, 0x68, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x69, 0x6E,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E,
+    0x74, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x73, 0x74, 0x65,
+    0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x20, 0x46, 0x6F,
+    0x72, 0x20, 0x65, 0x78, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x2C,
+    0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65,
+    0x20, 0x69, 0x73, 0x20, 0x27, 0x28, 0x5B, 0x22, 0x27, 0x2C,
+    0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20,
+    0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x69, 0x64,
+    0x64, 0x6C, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x70, 0x61, 0x72,
+    0x73, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x73, 0x69, 0x64, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65,
+    0x20, 0x62, 0x72, 0x61, 0x63, 0x6B, 0x65, 0x74, 0x73, 0x20,
+    0x69, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x20, 0x70, 0x61, 0x72,
+    0x65, 0x6E, 0x74, 0x68, 0x65, 0x73, 0x65, 0x73, 0x2E, 0x20,
+    0x43, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65,
+    0x64, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x75, 0x67, 0x6D, 0x65,
+    0x6E, 0x74, 0x20, 0x61, 0x20, 0x52, 0x45, 0x50, 0x4C, 0x20,
+    0x70, 0x72, 0x6F, 0x6D, 0x70, 0x74, 0x2E, 0x09, 0x3A, 0x66,
+    0x72, 0x61, 0x6D, 0x65, 0x73, 0x20, 0x2D, 0x20, 0x45, 0x61,
+    0x63, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69,
+    0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E,
+    0x74, 0x73, 0x20, 0x61, 0x20, 0x27, 0x66, 0x72, 0x61, 0x6D,
+    0x65, 0x27, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x73, 0x74, 0x61,
+    0x74, 0x65, 0x2E, 0x20, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x73,
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x69,
+    0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73,
+    0x73, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x65, 0x69, 0x6E, 0x67,
+    0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x64, 0x20, 0x61, 0x73,
+    0x20, 0x77, 0x65, 0x6C, 0x6C, 0x20, 0x61, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x65, 0x78, 0x70, 0x72,
+    0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x73, 0x6F, 0x6D, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65,
+    0x2D, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20,
+    0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F,
+    0x6E, 0x2E, 0xDA, 0x85, 0xA5, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x85, 0xA4, 0xDA, 0x05, 0xCE, 0x80, 0xCA, 0x28, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x2F, 0x63, 0x68, 0x65, 0x63, 0x6B,
+    0x2D, 0x73, 0x65, 0x74, 0x20, 0x73, 0x65, 0x74, 0x20, 0x73,
+    0x74, 0x72, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B,
+    0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74,
+    0x72, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x63, 0x6F, 0x6E,
+    0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x62, 0x79, 0x74, 0x65,
+    0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x70, 0x70,
+    0x65, 0x61, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x65,
+    0x74, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x66, 0x20, 0x61,
+    0x6C, 0x6C, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x69,
+    0x6E, 0x20, 0x73, 0x74, 0x72, 0x20, 0x61, 0x70, 0x70, 0x65,
+    0x61, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x2C,
+    0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20,
+    0x73, 0x6F, 0x6D, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+    0x20, 0x69, 0x6E, 0x20, 0x73, 0x74, 0x72, 0x20, 0x64, 0x6F,
+    0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x70, 0x70, 0x65, 0x61,
+    0x72, 0x20, 0x69, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x2E, 0xDA,
+    0x86, 0xC8, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x5E, 0x01, 0xDA, 0x03, 0xDA, 0x86, 0xC7, 0xDA, 0x05,
+    0xCE, 0x23, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3F, 0x20,
+    0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20,
+    0x69, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6E,
+    0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0xDA, 0x86, 0x61,
+    0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x85,
+    0xF6, 0x01, 0xDA, 0x03, 0xDA, 0x86, 0x60, 0xDA, 0x24, 0xCB,
+    0xDA, 0x05, 0xCE, 0x81, 0x00, 0x28, 0x76, 0x61, 0x72, 0x66,
+    0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x26, 0x20, 0x62,
+    0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61,
+    0x74, 0x65, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63,
+    0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x62, 0x6F,
+    0x75, 0x6E, 0x64, 0x2E, 0x20, 0x76, 0x61, 0x72, 0x66, 0x6E,
+    0x20, 0x68, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+    0x61, 0x6D, 0x65, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x74,
+    0x75, 0x72, 0x65, 0x20, 0x20, 0x61, 0x73, 0x20, 0x64, 0x65,
+    0x66, 0x6E, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x64, 0x65,
+    0x66, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E,
+    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x73, 0x20, 0x76, 0x61,
+    0x72, 0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 0x76,
+    0x61, 0x72, 0x20, 0x27, 0x6E, 0x61, 0x6D, 0x65, 0x27, 0x20,
+    0x20, 0x61, 0x6C, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x65,
+    0x78, 0x69, 0x73, 0x74, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E,
+    0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x69, 0x74, 0x20, 0x69,
+    0x73, 0x20, 0x72, 0x65, 0x62, 0x6F, 0x75, 0x6E, 0x64, 0x20,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77,
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x20,
+    0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x2E, 0xDA, 0x85, 0xAF, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x85,
+    0xAE, 0xDA, 0x05, 0xCE, 0x81, 0x00, 0x28, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2F, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x20,
+    0x61, 0x72, 0x72, 0x20, 0x61, 0x74, 0x20, 0x26, 0x20, 0x78,
+    0x73, 0x29, 0x0A, 0x0A, 0x49, 0x6E, 0x73, 0x65, 0x72, 0x74,
+    0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x73,
+    0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x20, 0x61, 0x72, 0x72, 0x20, 0x61, 0x74, 0x20, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0x20, 0x61, 0x74, 0x2E, 0x20, 0x61,
+    0x74, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62,
+    0x65, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67,
+    0x65, 0x72, 0x20, 0x30, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20,
+    0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2E, 0x20, 0x41, 0x20, 0x6E, 0x65, 0x67, 0x61,
+    0x74, 0x69, 0x76, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x74, 0x20, 0x77, 0x69,
+    0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20, 0x66,
+    0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E,
+    0x64, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2C, 0x20, 0x73, 0x75, 0x63, 0x68,
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x6E, 0x73, 0x65,
+    0x72, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x74, 0x20, 0x2D,
+    0x31, 0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x73, 0x20,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x2E, 0xDA, 0x86, 0x92, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x86, 0x91, 0xDA, 0x05, 0xCE, 0x47, 0x28, 0x64, 0x65, 0x62,
+    0x75, 0x67, 0x2F, 0x75, 0x6E, 0x66, 0x62, 0x72, 0x65, 0x61,
+    0x6B, 0x20, 0x66, 0x75, 0x6E, 0x20, 0x26, 0x6F, 0x70, 0x74,
+    0x20, 0x70, 0x63, 0x29, 0x0A, 0x0A, 0x55, 0x6E, 0x73, 0x65,
+    0x74, 0x20, 0x61, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x70,
+    0x6F, 0x69, 0x6E, 0x74, 0x20, 0x73, 0x65, 0x74, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x64, 0x65, 0x62, 0x75, 0x67, 0x2F,
+    0x66, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x2E, 0xDA, 0x86, 0x99,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x86, 0x98, 0xDA, 0x05, 0xCE,
+    0x80, 0xA7, 0x28, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64,
+    0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72,
+    0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6B, 0x65,
+    0x79, 0x77, 0x6F, 0x72, 0x64, 0x20, 0x62, 0x79, 0x20, 0x63,
+    0x6F, 0x6E, 0x63, 0x61, 0x74, 0x65, 0x6E, 0x61, 0x74, 0x69,
+    0x6E, 0x67, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+    0x74, 0x6F, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x2E, 0x20,
+    0x56, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65,
+    0x20, 0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64,
+    0x20, 0x74, 0x6F, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20,
+    0x76, 0x69, 0x61, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69,
+    0x62, 0x65, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x79,
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62,
+    0x79, 0x74, 0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E,
+    0x63, 0x65, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77,
+    0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x2E, 0xDA,
+    0x85, 0xC0, 0xD3, 0x03, 0xDA, 0x80, 0xCD, 0xCB, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x81, 0x33, 0x01, 0xDA, 0x83,
+    0x83, 0xDA, 0x83, 0x1D, 0xDA, 0x86, 0xA0, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x84, 0xA3, 0xDA, 0x05, 0xCE, 0x30, 0x54, 0x68,
+    0x65, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20,
+    0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E,
+    0x67, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x70, 0x72,
+    0x6F, 0x67, 0x72, 0x61, 0x6D, 0x2E, 0xDA, 0x86, 0x42, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x86, 0x41, 0xDA, 0x05, 0xCE, 0x50,
+    0x28, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x6E, 0x65,
+    0x77, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x73, 0x69, 0x7A,
+    0x65, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x73, 0x74, 0x72,
+    0x69, 0x64, 0x65, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74,
+    0x20, 0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x7C, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x79,
+    0x70, 0x65, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E,
+    0xDA, 0x85, 0xB5, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00,
+    0xDA, 0x12, 0x6E, 0x01, 0xDA, 0x03, 0xDA, 0x85, 0xB4, 0xDA,
+    0x05, 0xCE, 0x22, 0x28, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x3F,
+    0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63,
+    0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69, 0x73,
+    0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2E, 0xDA, 0x86, 0x4D,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x86, 0x4C, 0xDA, 0x05, 0xCE,
+    0x82, 0x6D, 0x28, 0x6F, 0x73, 0x2F, 0x64, 0x61, 0x74, 0x65,
+    0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x74, 0x69, 0x6D, 0x65,
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x74, 0x69, 0x6D,
+    0x65, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x64, 0x61, 0x74,
+    0x65, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2C, 0x20,
+    0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72,
+    0x72, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20,
+    0x69, 0x66, 0x20, 0x6E, 0x6F, 0x20, 0x74, 0x69, 0x6D, 0x65,
+    0x20, 0x69, 0x73, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69,
+    0x6E, 0x67, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x73, 0x2E, 0x20, 0x4E, 0x6F, 0x74, 0x65, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x6E,
+    0x75, 0x6D, 0x62, 0x65, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65,
+    0x20, 0x30, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64,
+    0x2E, 0x20, 0x44, 0x61, 0x74, 0x65, 0x20, 0x69, 0x73, 0x20,
+    0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x6E, 0x20, 0x55,
+    0x54, 0x43, 0x20, 0x75, 0x6E, 0x6C, 0x65, 0x73, 0x73, 0x20,
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x69, 0x73, 0x20, 0x74,
+    0x72, 0x75, 0x74, 0x68, 0x79, 0x2C, 0x20, 0x69, 0x6E, 0x20,
+    0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x63, 0x61, 0x73, 0x65,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x65, 0x20,
+    0x69, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x65,
+    0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x74, 0x69, 0x6D, 0x65,
+    0x7A, 0x6F, 0x6E, 0x65, 0x2E, 0x0A, 0x0A, 0x09, 0x3A, 0x73,
+    0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x20, 0x2D, 0x20, 0x6E,
+    0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x73,
+    0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x20, 0x5B, 0x30, 0x2D,
+    0x36, 0x31, 0x5D, 0x0A, 0x09, 0x3A, 0x6D, 0x69, 0x6E, 0x75,
+    0x74, 0x65, 0x73, 0x20, 0x2D, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+    0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x6D, 0x69, 0x6E, 0x75,
+    0x74, 0x65, 0x73, 0x20, 0x5B, 0x30, 0x2D, 0x35, 0x39, 0x5D,
+    0x0A, 0x09, 0x3A, 0x68, 0x6F, 0x75, 0x72, 0x73, 0x20, 0x2D,
+    0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66,
+    0x20, 0x68, 0x6F, 0x75, 0x72, 0x73, 0x20, 0x5B, 0x30, 0x2D,
+    0x32, 0x33, 0x5D, 0x0A, 0x09, 0x3A, 0x6D, 0x6F, 0x6E, 0x74,
+    0x68, 0x2D, 0x64, 0x61, 0x79, 0x20, 0x2D, 0x20, 0x64, 0x61,
+    0x79, 0x20, 0x6F, 0x66, 0x20, 0x6D, 0x6F, 0x6E, 0x74, 0x68,
+    0x20, 0x5B, 0x30, 0x2D, 0x33, 0x30, 0x5D, 0x0A, 0x09, 0x3A,
+    0x6D, 0x6F, 0x6E, 0x74, 0x68, 0x20, 0x2D, 0x20, 0x6D, 0x6F,
+    0x6E, 0x74, 0x68, 0x20, 0x6F, 0x66, 0x20, 0x79, 0x65, 0x61,
+    0x72, 0x20, 0x5B, 0x30, 0x2C, 0x20, 0x31, 0x31, 0x5D, 0x0A,
+    0x09, 0x3A, 0x79, 0x65, 0x61, 0x72, 0x20, 0x2D, 0x20, 0x79,
+    0x65, 0x61, 0x72, 0x73, 0x20, 0x73, 0x69, 0x6E, 0x63, 0x65,
+    0x20, 0x79, 0x65, 0x61, 0x72, 0x20, 0x30, 0x20, 0x28, 0x65,
+    0x2E, 0x67, 0x2E, 0x20, 0x32, 0x30, 0x31, 0x39, 0x29, 0x0A,
+    0x09, 0x3A, 0x77, 0x65, 0x65, 0x6B, 0x2D, 0x64, 0x61, 0x79,
+    0x20, 0x2D, 0x20, 0x64, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x77, 0x65, 0x65, 0x6B, 0x20, 0x5B,
+    0x30, 0x2D, 0x36, 0x5D, 0x0A, 0x09, 0x3A, 0x79, 0x65, 0x61,
+    0x72, 0x2D, 0x64, 0x61, 0x79, 0x20, 0x2D, 0x20, 0x64, 0x61,
+    0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x79,
+    0x65, 0x61, 0x72, 0x20, 0x5B, 0x30, 0x2D, 0x33, 0x36, 0x35,
+    0x5D, 0x0A, 0x09, 0x3A, 0x64, 0x73, 0x74, 0x20, 0x2D, 0x20,
+    0x49, 0x66, 0x20, 0x44, 0x61, 0x79, 0x20, 0x4C, 0x69, 0x67,
+    0x68, 0x74, 0x20, 0x53, 0x61, 0x76, 0x69, 0x6E, 0x67, 0x73,
+    0x20, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x65, 0x66, 0x66,
+    0x65, 0x63, 0x74, 0xDA, 0x86, 0xBE, 0xD3, 0x03, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x84, 0x30, 0x01, 0xDA, 0x03,
+    0xDA, 0x86, 0xBD, 0xDA, 0x05, 0xCE, 0x5F, 0x28, 0x69, 0x6E,
+    0x74, 0x65, 0x72, 0x6C, 0x65, 0x61, 0x76, 0x65, 0x20, 0x26,
+    0x20, 0x63, 0x6F, 0x6C, 0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x65, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x6F, 0x66, 0x20,
+    0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x6F, 0x6C, 0x2C, 0x20,
+    0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x2C, 0x20, 0x65, 0x74,
+    0x63, 0x2E, 0xDA, 0x87, 0x31, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x87, 0x30, 0xDA, 0x05, 0xCE, 0x80, 0xF2, 0x28, 0x70, 0x61,
+    0x72, 0x73, 0x65, 0x72, 0x2F, 0x69, 0x6E, 0x73, 0x65, 0x72,
+    0x74, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x29, 0x0A, 0x0A, 0x49, 0x6E, 0x73,
+    0x65, 0x72, 0x74, 0x20, 0x61, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2E, 0x20, 0x54,
+    0x68, 0x69, 0x73, 0x20, 0x6D, 0x65, 0x61, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+    0x61, 0x72, 0x73, 0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74,
+    0x65, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x6D,
+    0x61, 0x6E, 0x69, 0x70, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x64,
+    0x20, 0x69, 0x6E, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65,
+    0x6E, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x73, 0x20, 0x6F,
+    0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x2E, 0x20, 0x54,
+    0x68, 0x69, 0x73, 0x20, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x20,
+    0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x20, 0x61, 0x20, 0x75, 0x73,
+    0x65, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x64, 0x64, 0x20,
+    0x65, 0x78, 0x74, 0x72, 0x61, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74,
+    0x75, 0x70, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x65, 0x78, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2E, 0xDA,
+    0x86, 0x82, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x86, 0x81, 0xDA,
+    0x05, 0xCE, 0x80, 0xA8, 0x28, 0x74, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x2F, 0x63, 0x6F, 0x70, 0x79, 0x2D, 0x62, 0x79, 0x74,
+    0x65, 0x73, 0x20, 0x73, 0x72, 0x63, 0x20, 0x73, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x20, 0x64, 0x73, 0x74, 0x20, 0x64, 0x69,
+    0x6E, 0x64, 0x65, 0x78, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20,
+    0x63, 0x6F, 0x75, 0x6E, 0x74, 0x29, 0x0A, 0x0A, 0x43, 0x6F,
+    0x70, 0x79, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x65,
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x28, 0x64,
+    0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x31, 0x29, 0x20,
+    0x6F, 0x66, 0x20, 0x73, 0x72, 0x63, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x20, 0x73, 0x69, 0x6E, 0x64, 0x65, 0x78,
+    0x20, 0x74, 0x6F, 0x20, 0x64, 0x73, 0x74, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x20, 0x61, 0x74, 0x20, 0x70, 0x6F, 0x73,
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x69, 0x6E, 0x64,
+    0x65, 0x78, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20,
+    0x63, 0x61, 0x6E, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61,
+    0x70, 0x2E, 0xDA, 0x85, 0xA3, 0xD3, 0x03, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x83, 0x98, 0x01, 0xDA, 0x03, 0xDA,
+    0x85, 0x90, 0xDA, 0x05, 0xCE, 0x65, 0x28, 0x70, 0x6F, 0x73,
+    0x74, 0x77, 0x61, 0x6C, 0x6B, 0x20, 0x66, 0x20, 0x66, 0x6F,
+    0x72, 0x6D, 0x29, 0x0A, 0x0A, 0x44, 0x6F, 0x20, 0x61, 0x20,
+    0x70, 0x6F, 0x73, 0x74, 0x2D, 0x6F, 0x72, 0x64, 0x65, 0x72,
+    0x20, 0x74, 0x72, 0x61, 0x76, 0x65, 0x72, 0x73, 0x61, 0x6C,
+    0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61,
+    0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20,
+    0x28, 0x66, 0x20, 0x78, 0x29, 0x20, 0x20, 0x6F, 0x6E, 0x20,
+    0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x76, 0x69, 0x73, 0x69,
+    0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0xDA, 0x86, 0x93,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x83, 0x64, 0xDA, 0x05, 0xCE,
+    0x80, 0xA4, 0x28, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20,
+    0x26, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65,
+    0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x73, 0x79, 0x6D,
+    0x62, 0x6F, 0x6C, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6F, 0x6E,
+    0x63, 0x61, 0x74, 0x65, 0x6E, 0x61, 0x74, 0x69, 0x6E, 0x67,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x6F,
+    0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x2E, 0x20, 0x56, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63,
+    0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x74,
+    0x6F, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x76, 0x69,
+    0x61, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65,
+    0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61,
+    0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65,
+    0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73,
+    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0xDA, 0x86, 0xC2, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x83, 0xC8, 0xDA, 0x05, 0xCE, 0x51,
+    0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x63, 0x65, 0x69, 0x6C,
+    0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6D, 0x61,
+    0x6C, 0x6C, 0x65, 0x73, 0x74, 0x20, 0x69, 0x6E, 0x74, 0x65,
+    0x67, 0x65, 0x72, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6C,
+    0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x78,
+    0x2E, 0xDA, 0x86, 0x66, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03,
+    0x00, 0xDA, 0x12, 0x85, 0x68, 0x01, 0xDA, 0x03, 0xDA, 0x86,
+    0x65, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x39, 0x28, 0x64,
+    0x6F, 0x63, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x73, 0x79,
+    0x6D, 0x29, 0x0A, 0x0A, 0x53, 0x68, 0x6F, 0x77, 0x73, 0x20,
+    0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x73, 0x79,
+    0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0xDA, 0x86, 0x0D, 0xD3, 0x03,
+    0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x84, 0x55, 0x01,
+    0xDA, 0x03, 0xDA, 0x83, 0x69, 0xDA, 0x05, 0xCE, 0x66, 0x28,
+    0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x6F, 0x73, 0x65, 0x20,
+    0x73, 0x65, 0x70, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x69, 0x6E,
+    0x64, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65,
+    0x64, 0x20, 0x62, 0x79, 0x20, 0x20, 0x73, 0x65, 0x70, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2E, 0xDA, 0x87, 0x06, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x87,
+    0x05, 0xDA, 0x05, 0xCE, 0x5B, 0x28, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x2F, 0x62, 0x69, 0x74, 0x2D, 0x63, 0x6C, 0x65,
+    0x61, 0x72, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20,
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x6C,
+    0x65, 0x61, 0x72, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62,
+    0x69, 0x74, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x62, 0x69, 0x74, 0x2D,
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0xDA, 0x86, 0x51, 0xD3,
+    0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x86, 0x77,
+    0x01, 0xDA, 0x03, 0xDA, 0x82, 0xAB, 0xDA, 0x05, 0xCE, 0x44,
+    0x28, 0x62, 0x61, 0x64, 0x2D, 0x63, 0x6F, 0x6D, 0x70, 0x69,
+    0x6C, 0x65, 0x20, 0x6D, 0x73, 0x67, 0x20, 0x6D, 0x61, 0x63,
+    0x72, 0x6F, 0x66, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x29,
+    0x0A, 0x0A, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20,
+    0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x61, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C,
+    0x65, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E, 0xDA, 0x86,
+    0x96, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x86, 0x95, 0xDA, 0x05,
+    0xCE, 0x1C, 0x54, 0x68, 0x65, 0x20, 0x62, 0x61, 0x73, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x61,
+    0x74, 0x75, 0x72, 0x61, 0x6C, 0x20, 0x6C, 0x6F, 0x67, 0x2E,
+    0xDA, 0x86, 0x44, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x86, 0x43,
+    0xDA, 0x05, 0xCE, 0x80, 0x9C, 0x28, 0x64, 0x65, 0x62, 0x75,
+    0x67, 0x2F, 0x75, 0x6E, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x20,
+    0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x6C, 0x69, 0x6E,
+    0x65, 0x20, 0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x20, 0x61, 0x20,
+    0x62, 0x72, 0x65, 0x61, 0x6B, 0x70, 0x6F, 0x69, 0x6E, 0x74,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x73, 0x6F,
+    0x75, 0x72, 0x63, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x61,
+    0x74, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20,
+    0x6C, 0x69, 0x6E, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63,
+    0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x2E, 0x20, 0x57, 0x69, 0x6C,
+    0x6C, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x61, 0x6E,
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x70,
+    0x6F, 0x69, 0x6E, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F,
+    0x74, 0x20, 0x62, 0x65, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64,
+    0x2E, 0xDA, 0x87, 0x2B, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03,
+    0x00, 0xDA, 0x12, 0x87, 0x09, 0x01, 0xDA, 0x03, 0xDA, 0x85,
+    0xA0, 0xDA, 0x05, 0xCE, 0x7F, 0x41, 0x20, 0x74, 0x61, 0x62,
+    0x6C, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6E,
+    0x20, 0x63, 0x6F, 0x6D, 0x62, 0x69, 0x6E, 0x61, 0x74, 0x69,
+    0x6F, 0x6E, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6D, 0x61,
+    0x72, 0x73, 0x68, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x6D,
+    0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x64,
+    0x65, 0x20, 0x28, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x73, 0x29,
+    0x2E, 0x20, 0x20, 0x6D, 0x61, 0x6B, 0x65, 0x2D, 0x69, 0x6D,
+    0x61, 0x67, 0x65, 0x20, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61,
+    0x6C, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x74,
+    0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x77, 0x72, 0x69,
+    0x74, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69,
+    0x6D, 0x61, 0x67, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65,
+    0x72, 0x2E, 0xDA, 0x86, 0x58, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x86, 0x57, 0xDA, 0x05, 0xCE, 0x80, 0xC7, 0x28, 0x6F, 0x73,
+    0x2F, 0x77, 0x68, 0x69, 0x63, 0x68, 0x29, 0x0A, 0x0A, 0x43,
+    0x68, 0x65, 0x63, 0x6B, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+    0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x70, 0x65,
+    0x72, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x79, 0x73,
+    0x74, 0x65, 0x6D, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x3A,
+    0x0A, 0x0A, 0x09, 0x3A, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77,
+    0x73, 0x0A, 0x09, 0x3A, 0x6D, 0x61, 0x63, 0x6F, 0x73, 0x0A,
+    0x09, 0x3A, 0x77, 0x65, 0x62, 0x20, 0x2D, 0x20, 0x57, 0x65,
+    0x62, 0x20, 0x61, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x79,
+    0x20, 0x28, 0x65, 0x6D, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+    0x65, 0x6E, 0x29, 0x0A, 0x09, 0x3A, 0x6C, 0x69, 0x6E, 0x75,
+    0x78, 0x0A, 0x09, 0x3A, 0x66, 0x72, 0x65, 0x65, 0x62, 0x73,
+    0x64, 0x0A, 0x09, 0x3A, 0x6F, 0x70, 0x65, 0x6E, 0x62, 0x73,
+    0x64, 0x0A, 0x09, 0x3A, 0x6E, 0x65, 0x74, 0x62, 0x73, 0x64,
+    0x0A, 0x09, 0x3A, 0x70, 0x6F, 0x73, 0x69, 0x78, 0x20, 0x2D,
+    0x20, 0x41, 0x20, 0x50, 0x4F, 0x53, 0x49, 0x58, 0x20, 0x63,
+    0x6F, 0x6D, 0x70, 0x61, 0x74, 0x69, 0x62, 0x6C, 0x65, 0x20,
+    0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x28, 0x64, 0x65,
+    0x66, 0x61, 0x75, 0x6C, 0x74, 0x29, 0xDA, 0x87, 0x47, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x80, 0xA0, 0xDA, 0x05, 0xCE, 0x81,
+    0x37, 0x28, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x63, 0x6F,
+    0x6E, 0x63, 0x61, 0x74, 0x20, 0x61, 0x72, 0x72, 0x20, 0x26,
+    0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x29, 0x0A, 0x0A, 0x43,
+    0x6F, 0x6E, 0x63, 0x61, 0x74, 0x65, 0x6E, 0x61, 0x74, 0x65,
+    0x73, 0x20, 0x61, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x64,
+    0x69, 0x63, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20,
+    0x6F, 0x66, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x20,
+    0x28, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65,
+    0x73, 0x29, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x61, 0x72,
+    0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x77, 0x68, 0x69,
+    0x63, 0x68, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x61, 0x6E,
+    0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x49, 0x66,
+    0x20, 0x61, 0x6E, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20, 0x61, 0x72,
+    0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x20, 0x6F,
+    0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x73, 0x2C, 0x20,
+    0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x65, 0x6C, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+    0x62, 0x65, 0x20, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x65,
+    0x64, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x20, 0x4F, 0x74,
+    0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x2C, 0x20, 0x65,
+    0x61, 0x63, 0x68, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x69,
+    0x6E, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20, 0x77, 0x69,
+    0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x61, 0x70, 0x70, 0x65,
+    0x6E, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x72,
+    0x72, 0x20, 0x69, 0x6E, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65,
+    0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x61, 0x72,
+    0x72, 0x2E, 0xDA, 0x86, 0x07, 0xD3, 0x03, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x88, 0x6B, 0x01, 0xDA, 0x03, 0xDA,
+    0x86, 0x06, 0xDA, 0x05, 0xCE, 0x80, 0xA3, 0x28, 0x63, 0x6C,
+    0x69, 0x2D, 0x6D, 0x61, 0x69, 0x6E, 0x20, 0x61, 0x72, 0x67,
+    0x73, 0x29, 0x0A, 0x0A, 0x45, 0x6E, 0x74, 0x72, 0x61, 0x6E,
+    0x63, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x4A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x43, 0x4C, 0x49,
+    0x20, 0x74, 0x6F, 0x6F, 0x6C, 0x2E, 0x20, 0x43, 0x61, 0x6C,
+    0x6C, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 0x6E,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D,
+    0x61, 0x6E, 0x64, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x20,
+    0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20,
+    0x61, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x73, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x6E, 0x76, 0x6F, 0x6B,
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x43, 0x4C, 0x49, 0x20,
+    0x69, 0x6E, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x2E,
+    0xDA, 0x86, 0xEF, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x86, 0xEE,
+    0xDA, 0x05, 0xCE, 0x41, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+    0x68, 0x79, 0x70, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x62, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x71, 0x75, 0x61, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x63, 0x5E, 0x32, 0x20, 0x3D, 0x20,
+    0x61, 0x5E, 0x32, 0x20, 0x2B, 0x20, 0x62, 0x5E, 0x32, 0xDA,
+    0x87, 0x3E, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x83, 0x61, 0xDA,
+    0x05, 0xDA, 0x83, 0x62, 0xDA, 0x87, 0x34, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x87, 0x33, 0xDA, 0x05, 0xCE, 0x81, 0x4E, 0x28,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x69, 0x6E,
+    0x64, 0x20, 0x70, 0x61, 0x74, 0x74, 0x20, 0x73, 0x74, 0x72,
+    0x29, 0x0A, 0x0A, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x65,
+    0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x20,
+    0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x73, 0x20,
+    0x6F, 0x66, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E,
+    0x20, 0x70, 0x61, 0x74, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x74, 0x72, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66,
+    0x20, 0x61, 0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63,
+    0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x6F, 0x75, 0x6E,
+    0x64, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x73,
+    0x2E, 0x20, 0x4F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x70, 0x70,
+    0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E,
+    0x63, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x20, 0x61,
+    0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x75,
+    0x6E, 0x74, 0x65, 0x64, 0x2C, 0x20, 0x6D, 0x65, 0x61, 0x6E,
+    0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x62, 0x79, 0x74, 0x65,
+    0x20, 0x69, 0x6E, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6F, 0x6E, 0x6C, 0x79,
+    0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+    0x65, 0x20, 0x74, 0x6F, 0x20, 0x66, 0x69, 0x6E, 0x64, 0x69,
+    0x6E, 0x67, 0x20, 0x61, 0x74, 0x20, 0x6D, 0x6F, 0x73, 0x74,
+    0x20, 0x6F, 0x6E, 0x20, 0x6F, 0x63, 0x63, 0x75, 0x72, 0x72,
+    0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x70, 0x61,
+    0x74, 0x74, 0x65, 0x72, 0x6E, 0x2E, 0x20, 0x49, 0x66, 0x20,
+    0x6E, 0x6F, 0x20, 0x6F, 0x63, 0x63, 0x75, 0x72, 0x72, 0x65,
+    0x6E, 0x63, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66,
+    0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+    0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x6E,
+    0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2E, 0xDA, 0x85, 0xD3, 0xD3, 0x04, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x2E, 0x01, 0xDA, 0x03, 0xDA,
+    0x86, 0x0F, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x4A, 0x28,
+    0x64, 0x65, 0x66, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2D, 0x20,
+    0x6E, 0x61, 0x6D, 0x65, 0x20, 0x26, 0x20, 0x6D, 0x6F, 0x72,
+    0x65, 0x29, 0x0A, 0x0A, 0x44, 0x65, 0x66, 0x69, 0x6E, 0x65,
+    0x20, 0x61, 0x20, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65,
+    0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74,
+    0x20, 0x62, 0x65, 0x20, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74,
+    0x65, 0x64, 0x2E, 0xDA, 0x85, 0xAC, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x82, 0x78, 0xDA, 0x05, 0xCE, 0x81, 0x62, 0x28, 0x72,
+    0x65, 0x73, 0x75, 0x6D, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65,
+    0x72, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x20, 0x61, 0x20,
+    0x6E, 0x65, 0x77, 0x20, 0x6F, 0x72, 0x20, 0x73, 0x75, 0x73,
+    0x70, 0x65, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x66, 0x69, 0x62,
+    0x65, 0x72, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6F, 0x70, 0x74,
+    0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x70, 0x61,
+    0x73, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x65, 0x64, 0x20, 0x74,
+    0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74,
+    0x20, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x20, 0x69, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x61, 0x20, 0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2C, 0x20, 0x6F,
+    0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75,
+    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68,
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x61, 0x73,
+    0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77,
+    0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x65, 0x69, 0x74, 0x68,
+    0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x27, 0x73, 0x20, 0x64, 0x69, 0x73, 0x70,
+    0x61, 0x74, 0x63, 0x68, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x78,
+    0x74, 0x20, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x20, 0x63, 0x61,
+    0x6C, 0x6C, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x69, 0x62, 0x65,
+    0x72, 0x2E, 0xDA, 0x86, 0x6B, 0xD3, 0x03, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x82, 0x86, 0x01, 0xDA, 0x03, 0xDA,
+    0x86, 0x6A, 0xDA, 0x05, 0xCE, 0x4A, 0x28, 0x73, 0x6F, 0x72,
+    0x74, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x20, 0x62, 0x79,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73, 0x6F, 0x72,
+    0x74, 0x65, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x6D, 0x6F,
+    0x64, 0x69, 0x66, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6F, 0x6C, 0x64, 0x20, 0x6F, 0x6E, 0x65, 0x2E,
+    0xDA, 0x86, 0xE3, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00,
+    0xDA, 0x12, 0x82, 0x38, 0x01, 0xDA, 0x03, 0xDA, 0x82, 0xEB,
+    0xDA, 0x05, 0xCE, 0x4A, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xDA, 0x85,
+    0x4B, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x64, 0x01, 0xDA, 0x03, 0xDA, 0x85, 0x4A, 0xDA, 0x05, 0xCE,
+    0x2E, 0x28, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61,
+    0x72, 0x79, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43, 0x68,
+    0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20, 0x61,
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x72, 0x20,
+    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2E, 0xDA, 0x86, 0xAA,
+    0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x85,
+    0x09, 0x01, 0xDA, 0x03, 0xDA, 0x85, 0x65, 0xDA, 0x05, 0xCE,
+    0x72, 0x28, 0x61, 0x6C, 0x6C, 0x2D, 0x62, 0x69, 0x6E, 0x64,
+    0x69, 0x6E, 0x67, 0x73, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20,
+    0x65, 0x6E, 0x76, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20,
+    0x61, 0x6C, 0x6C, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C,
+    0x73, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C,
+    0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x6E,
+    0x76, 0x69, 0x72, 0x6F, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20,
+    0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x73, 0x20, 0x74,
+    0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72,
+    0x65, 0x6E, 0x74, 0x20, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+    0x27, 0x73, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E,
+    0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xDA, 0x86, 0x9A, 0xD3, 0x03,
+    0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x85, 0x0F, 0x01,
+    0xDA, 0x03, 0xDA, 0x85, 0x67, 0xDA, 0x05, 0xCE, 0x72, 0x28,
+    0x61, 0x6C, 0x6C, 0x2D, 0x64, 0x79, 0x6E, 0x61, 0x6D, 0x69,
+    0x63, 0x73, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x65, 0x6E,
+    0x76, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x61, 0x6C,
+    0x6C, 0x20, 0x64, 0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x20,
+    0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x69,
+    0x6E, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72,
+    0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20, 0x44, 0x65,
+    0x66, 0x61, 0x75, 0x6C, 0x74, 0x73, 0x20, 0x74, 0x6F, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+    0x74, 0x20, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x27, 0x73,
+    0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65,
+    0x6E, 0x74, 0x2E, 0xDA, 0x86, 0xF5, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x86, 0xF4, 0xDA, 0x05, 0xCE, 0x44, 0x28, 0x70, 0x61,
+    0x69, 0x72, 0x73, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x47, 0x65,
+    0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x2D,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x70, 0x61, 0x69, 0x72,
+    0x73, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x73,
+    0x73, 0x6F, 0x63, 0x69, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+    0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
+    0x74, 0x75, 0x72, 0x65, 0x2E, 0xDA, 0x86, 0x97, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x85, 0x68, 0xDA, 0x05, 0xCE, 0x51, 0x28,
+    0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20,
+    0x68, 0x75, 0x6D, 0x61, 0x6E, 0x20, 0x72, 0x65, 0x61, 0x64,
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x64, 0x65, 0x73, 0x63, 0x72,
+    0x69, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20,
+    0x61, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x78, 0x2E,
+    0xDA, 0x86, 0x37, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00,
+    0xDA, 0x12, 0x86, 0x3E, 0x01, 0xDA, 0x03, 0xDA, 0x86, 0x12,
+    0xDA, 0x05, 0xCE, 0x80, 0x8B, 0x54, 0x68, 0x65, 0x20, 0x64,
+    0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x67, 0x72, 0x61,
+    0x6D, 0x6D, 0x61, 0x72, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20,
+    0x66, 0x6F, 0x72, 0x20, 0x70, 0x65, 0x67, 0x73, 0x2E, 0x20,
+    0x54, 0x68, 0x69, 0x73, 0x20, 0x67, 0x72, 0x61, 0x6D, 0x6D,
+    0x61, 0x72, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x73,
+    0x20, 0x73, 0x65, 0x76, 0x65, 0x72, 0x61, 0x6C, 0x20, 0x63,
+    0x6F, 0x6D, 0x6D, 0x6F, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x74,
+    0x65, 0x72, 0x6E, 0x73, 0x20, 0x20, 0x74, 0x68, 0x61, 0x74,
+    0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6D, 0x61,
+    0x6B, 0x65, 0x20, 0x69, 0x74, 0x20, 0x65, 0x61, 0x73, 0x69,
+    0x65, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x77, 0x72, 0x69, 0x74,
+    0x65, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6D,
+    0x70, 0x6C, 0x65, 0x78, 0x20, 0x70, 0x61, 0x74, 0x74, 0x65,
+    0x72, 0x6E, 0x73, 0x2E, 0xDA, 0x86, 0x7B, 0xD3, 0x03, 0xDA,
+    0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x5D, 0x01, 0xDA, 0x03,
+    0xDA, 0x86, 0x7A, 0xDA, 0x05, 0xCE, 0x21, 0x28, 0x73, 0x74,
+    0x72, 0x75, 0x63, 0x74, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A,
+    0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78,
+    0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2E,
+    0xDA, 0x85, 0xA8, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00,
+    0xDA, 0x12, 0x82, 0xC7, 0x01, 0xDA, 0x03, 0xDA, 0x85, 0xA7,
+    0xDA, 0x05, 0xCE, 0x80, 0xA3, 0x28, 0x6B, 0x65, 0x65, 0x70,
+    0x20, 0x70, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x29,
+    0x0A, 0x0A, 0x47, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x61, 0x20,
+    0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x2C,
+    0x20, 0x74, 0x61, 0x6B, 0x65, 0x20, 0x6F, 0x6E, 0x6C, 0x79,
+    0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x75, 0x70,
+    0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x20, 0x77, 0x68,
+    0x69, 0x63, 0x68, 0x20, 0x28, 0x70, 0x72, 0x65, 0x64, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x29, 0x20, 0x69,
+    0x73, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68, 0x79, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20,
+    0x6E, 0x65, 0x77, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+    0x6F, 0x66, 0x20, 0x74, 0x72, 0x75, 0x74, 0x68, 0x79, 0x20,
+    0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20,
+    0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73, 0x2E, 0xDA, 0x86,
+    0x4F, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x82, 0xBA, 0xDA, 0x05,
+    0xCE, 0x80, 0xD7, 0x28, 0x67, 0x65, 0x74, 0x6C, 0x69, 0x6E,
+    0x65, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x70, 0x72, 0x6F,
+    0x6D, 0x70, 0x74, 0x20, 0x62, 0x75, 0x66, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x61, 0x64, 0x73, 0x20, 0x61, 0x20, 0x6C, 0x69,
+    0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x69, 0x6E, 0x70, 0x75,
+    0x74, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2C, 0x20, 0x69, 0x6E, 0x63,
+    0x6C, 0x75, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6E, 0x65, 0x77, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x63,
+    0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x2C, 0x20,
+    0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x70, 0x72,
+    0x6F, 0x6D, 0x70, 0x74, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F,
+    0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x2E, 0x20, 0x55, 0x73, 0x65, 0x20, 0x74,
+    0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x6D, 0x70, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x20, 0x73, 0x69,
+    0x6D, 0x70, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x72,
+    0x66, 0x61, 0x63, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61,
+    0x20, 0x74, 0x65, 0x72, 0x6D, 0x69, 0x6E, 0x61, 0x6C, 0x20,
+    0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x2E, 0xDA, 0x86,
+    0xD6, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x86, 0x00, 0xDA, 0x05,
+    0xCE, 0x72, 0x28, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2F, 0x73,
+    0x6F, 0x75, 0x72, 0x63, 0x65, 0x6D, 0x61, 0x70, 0x20, 0x74,
+    0x75, 0x70, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6F, 0x75,
+    0x72, 0x63, 0x65, 0x6D, 0x61, 0x70, 0x20, 0x6D, 0x65, 0x74,
+    0x61, 0x64, 0x61, 0x74, 0x61, 0x20, 0x61, 0x74, 0x74, 0x61,
+    0x63, 0x68, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20,
+    0x74, 0x75, 0x70, 0x6C, 0x65, 0x2C, 0x20, 0x20, 0x77, 0x68,
+    0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6E, 0x6F,
+    0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65,
+    0x20, 0x28, 0x6C, 0x69, 0x6E, 0x65, 0x2C, 0x20, 0x63, 0x6F,
+    0x6C, 0x75, 0x6D, 0x6E, 0x29, 0x2E, 0xDA, 0x86, 0x40, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x86, 0x3F, 0xDA, 0x05, 0xCE, 0x63,
+    0x28, 0x6E, 0x6F, 0x74, 0x3D, 0x3D, 0x20, 0x26, 0x20, 0x78,
+    0x73, 0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20,
+    0x69, 0x66, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x20,
+    0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6E, 0x75,
+    0x6D, 0x65, 0x72, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x20,
+    0x65, 0x71, 0x75, 0x61, 0x6C, 0x20, 0x28, 0x33, 0x2E, 0x30,
+    0x20, 0x6E, 0x6F, 0x74, 0x3D, 0x3D, 0x20, 0x34, 0x29, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x2E, 0xDA,
+    0x86, 0xC3, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x85, 0x63, 0xDA,
+    0x05, 0xCE, 0x80, 0x83, 0x28, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x2F, 0x67, 0x65, 0x74, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x20,
+    0x74, 0x61, 0x62, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74,
+    0x79, 0x70, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+    0x6F, 0x66, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66, 0x20, 0x61, 0x20, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6E,
+    0x6F, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70,
+    0x65, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69,
+    0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F,
+    0x74, 0x79, 0x70, 0x65, 0x2E, 0xDA, 0x86, 0x9D, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x80, 0xFA, 0xDA, 0x05, 0xCE, 0x80, 0xD6,
+    0x28, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x75,
+    0x73, 0x68, 0x2D, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+    0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x73, 0x74, 0x72,
+    0x29, 0x0A, 0x0A, 0x50, 0x75, 0x73, 0x68, 0x20, 0x61, 0x20,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x6F, 0x6E, 0x74,
+    0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20,
+    0x6F, 0x66, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2E, 0x20, 0x4E, 0x6F, 0x6E, 0x20, 0x73, 0x74, 0x72,
+    0x69, 0x6E, 0x67, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73,
+    0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x63,
+    0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x74,
+    0x6F, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 0x20,
+    0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x62, 0x65, 0x69,
+    0x6E, 0x67, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65,
+    0x64, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E, 0x20,
+    0x57, 0x69, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x77,
+    0x20, 0x61, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20,
+    0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C,
+    0x6F, 0x77, 0x73, 0x2E, 0xDA, 0x86, 0x7C, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x83, 0x5B, 0xDA, 0x05, 0xCE, 0x82, 0x40, 0x28,
+    0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x65, 0x78, 0x70,
+    0x61, 0x6E, 0x64, 0x2D, 0x70, 0x61, 0x74, 0x68, 0x20, 0x70,
+    0x61, 0x74, 0x68, 0x20, 0x74, 0x65, 0x6D, 0x70, 0x6C, 0x61,
+    0x74, 0x65, 0x29, 0x0A, 0x0A, 0x45, 0x78, 0x70, 0x61, 0x6E,
+    0x64, 0x73, 0x20, 0x61, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20,
+    0x74, 0x65, 0x6D, 0x70, 0x6C, 0x61, 0x74, 0x65, 0x20, 0x61,
+    0x73, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x69, 0x6E,
+    0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2F, 0x70, 0x61,
+    0x74, 0x68, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D, 0x6F,
+    0x64, 0x75, 0x6C, 0x65, 0x2F, 0x66, 0x69, 0x6E, 0x64, 0x2E,
+    0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x74, 0x61, 0x6B, 0x65,
+    0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x70, 0x61, 0x74,
+    0x68, 0x20, 0x28, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67,
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x72,
+    0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x29, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x61, 0x20, 0x74, 0x65, 0x6D, 0x70, 0x6C, 0x61,
+    0x74, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2C,
+    0x20, 0x74, 0x65, 0x6D, 0x70, 0x6C, 0x61, 0x74, 0x65, 0x2C,
+    0x20, 0x74, 0x6F, 0x20, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20,
+    0x74, 0x6F, 0x20, 0x61, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20,
+    0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62,
+    0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x69, 0x6E, 0x67,
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2E, 0x20, 0x54, 0x68,
+    0x65, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x6D,
+    0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61,
+    0x73, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x73, 0x3A,
+    0x0A, 0x0A, 0x09, 0x3A, 0x61, 0x6C, 0x6C, 0x3A, 0x09, 0x74,
+    0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F,
+    0x66, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x76, 0x65, 0x72,
+    0x62, 0x61, 0x74, 0x69, 0x6D, 0x0A, 0x09, 0x3A, 0x63, 0x75,
+    0x72, 0x3A, 0x09, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72,
+    0x72, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2C,
+    0x20, 0x6F, 0x72, 0x20, 0x28, 0x64, 0x79, 0x6E, 0x20, 0x3A,
+    0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x2D, 0x66, 0x69,
+    0x6C, 0x65, 0x29, 0x0A, 0x09, 0x3A, 0x64, 0x69, 0x72, 0x3A,
+    0x09, 0x74, 0x68, 0x65, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63,
+    0x74, 0x6F, 0x72, 0x79, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61,
+    0x69, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x0A, 0x09, 0x3A, 0x6E, 0x61, 0x6D, 0x65, 0x3A,
+    0x09, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x6E,
+    0x61, 0x6D, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x6E,
+    0x65, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x70, 0x61, 0x74,
+    0x68, 0x2C, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x65, 0x78,
+    0x74, 0x65, 0x6E, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x66, 0x20,
+    0x67, 0x69, 0x76, 0x65, 0x6E, 0x0A, 0x09, 0x3A, 0x6E, 0x61,
+    0x74, 0x69, 0x76, 0x65, 0x3A, 0x09, 0x74, 0x68, 0x65, 0x20,
+    0x65, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x20,
+    0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x6C, 0x6F,
+    0x61, 0x64, 0x20, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x73,
+    0x2C, 0x20, 0x2E, 0x73, 0x6F, 0x20, 0x6F, 0x72, 0x20, 0x2E,
+    0x64, 0x6C, 0x6C, 0x0A, 0x09, 0x3A, 0x73, 0x79, 0x73, 0x3A,
+    0x09, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65,
+    0x6D, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2C, 0x20, 0x6F, 0x72,
+    0x20, 0x28, 0x73, 0x79, 0x6E, 0x20, 0x3A, 0x73, 0x79, 0x73,
+    0x70, 0x61, 0x74, 0x68, 0x29, 0xDA, 0x85, 0xBA, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x85, 0xB9, 0xDA, 0x05, 0xCE, 0x30, 0x28,
+    0x6F, 0x73, 0x2F, 0x63, 0x77, 0x64, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x77,
+    0x6F, 0x72, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x64, 0x69, 0x72,
+    0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0xDA, 0x85, 0xD4,
+    0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x87,
+    0x98, 0x01, 0xDA, 0x03, 0xDA, 0x83, 0x81, 0xDA, 0x05, 0xCE,
+    0x4B, 0x28, 0x64, 0x6F, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x70,
+    0x61, 0x74, 0x68, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73,
+    0x29, 0x0A, 0x0A, 0x45, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74,
+    0x65, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74,
+    0x69, 0x6E, 0x67, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F,
+    0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xDA, 0x87, 0x40, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x87, 0x3F, 0xDA, 0x05, 0xCE, 0x80,
+    0x8A, 0x28, 0x6F, 0x73, 0x2F, 0x74, 0x6F, 0x75, 0x63, 0x68,
+    0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x26, 0x6F, 0x70, 0x74,
+    0x20, 0x61, 0x63, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x6D, 0x6F,
+    0x64, 0x74, 0x69, 0x6D, 0x65, 0x29, 0x0A, 0x0A, 0x55, 0x70,
+    0x64, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x74, 0x69, 0x6D, 0x65,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66,
+    0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x69,
+    0x6D, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20,
+    0x66, 0x69, 0x6C, 0x65, 0x2E, 0x20, 0x42, 0x79, 0x20, 0x64,
+    0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2C, 0x20, 0x73, 0x65,
+    0x74, 0x73, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x20, 0x74,
+    0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72,
+    0x65, 0x6E, 0x74, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x2E, 0xDA,
+    0x86, 0xEA, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x88, 0x38, 0x01, 0xDA, 0x03, 0xDA, 0x85, 0xF2, 0xDA,
+    0x05, 0xCE, 0x81, 0x37, 0x28, 0x72, 0x65, 0x70, 0x6C, 0x20,
+    0x26, 0x6F, 0x70, 0x74, 0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B,
+    0x73, 0x20, 0x6F, 0x6E, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C,
+    0x20, 0x65, 0x6E, 0x76, 0x29, 0x0A, 0x0A, 0x52, 0x75, 0x6E,
+    0x20, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x2E, 0x20, 0x54,
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x70,
+    0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 0x72, 0x20, 0x69,
+    0x73, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F,
+    0x6E, 0x61, 0x6C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x61, 0x6C, 0x6C,
+    0x20, 0x74, 0x6F, 0x20, 0x20, 0x67, 0x65, 0x74, 0x20, 0x61,
+    0x20, 0x63, 0x68, 0x75, 0x6E, 0x6B, 0x20, 0x6F, 0x66, 0x20,
+    0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x63, 0x6F, 0x64,
+    0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x68, 0x6F,
+    0x75, 0x6C, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x20, 0x6E, 0x69, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65,
+    0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x69, 0x6C, 0x65,
+    0x2E, 0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63,
+    0x6F, 0x6E, 0x64, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x65,
+    0x74, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x66,
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x63, 0x61, 0x6C, 0x6C,
+    0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x20,
+    0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x20, 0x69, 0x73, 0x20,
+    0x20, 0x63, 0x61, 0x75, 0x67, 0x68, 0x74, 0x2E, 0x20, 0x4F,
+    0x6E, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x70, 0x72, 0x6F,
+    0x76, 0x69, 0x64, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x70,
+    0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x65, 0x6E, 0x76,
+    0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x75,
+    0x6E, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70,
+    0x6C, 0x20, 0x69, 0x6E, 0x2E, 0xDA, 0x86, 0xDA, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x86, 0xD9, 0xDA, 0x05, 0xCE, 0x82, 0x1B,
+    0x28, 0x67, 0x63, 0x73, 0x74, 0x61, 0x74, 0x73, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61,
+    0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x6F, 0x66,
+    0x20, 0x67, 0x61, 0x72, 0x62, 0x61, 0x67, 0x65, 0x20, 0x63,
+    0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x73,
+    0x74, 0x61, 0x74, 0x69, 0x73, 0x74, 0x69, 0x63, 0x73, 0x2E,
+    0x20, 0x3A, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x69,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62,
+    0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x6F, 0x62, 0x6A, 0x65,
+    0x63, 0x74, 0x73, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x68, 0x65, 0x61, 0x70, 0x2C, 0x20, 0x3A, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E,
+    0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x3A, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2D, 0x62, 0x79, 0x74,
+    0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x65, 0x6D,
+    0x6F, 0x72, 0x79, 0x20, 0x68, 0x65, 0x6C, 0x64, 0x20, 0x62,
+    0x79, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x73, 0x74,
+    0x61, 0x63, 0x6B, 0x73, 0x2E, 0x20, 0x3A, 0x61, 0x6C, 0x6C,
+    0x6F, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x69, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x20, 0x6F, 0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20,
+    0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20,
+    0x73, 0x69, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6C, 0x61, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x3A, 0x69, 0x6E,
+    0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0x20, 0x69, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x61,
+    0x73, 0x20, 0x28, 0x67, 0x63, 0x69, 0x6E, 0x74, 0x65, 0x72,
+    0x76, 0x61, 0x6C, 0x29, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x3A, 0x72, 0x6F, 0x6F, 0x74, 0x73, 0x20, 0x69, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x20, 0x6F, 0x66, 0x20, 0x67, 0x63, 0x20, 0x72, 0x6F, 0x6F,
+    0x74, 0x73, 0x2E, 0x20, 0x3A, 0x72, 0x6F, 0x6F, 0x74, 0x2D,
+    0x73, 0x6C, 0x6F, 0x74, 0x73, 0x20, 0x69, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20,
+    0x6F, 0x66, 0x20, 0x73, 0x6C, 0x6F, 0x74, 0x73, 0x20, 0x61,
+    0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x66,
+    0x6F, 0x72, 0x20, 0x72, 0x6F, 0x6F, 0x74, 0x73, 0x20, 0x61,
+    0x64, 0x64, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x6A, 0x61, 0x6E, 0x65, 0x74, 0x5F, 0x67, 0x63, 0x72, 0x6F,
+    0x6F, 0x74, 0x5F, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x2E,
+    0x20, 0x3A, 0x6C, 0x69, 0x76, 0x65, 0x2D, 0x62, 0x79, 0x74,
+    0x65, 0x73, 0x20, 0x65, 0x73, 0x74, 0x69, 0x6D, 0x61, 0x74,
+    0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x75, 0x73, 0x65, 0x20,
+    0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6C, 0x61, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x3A, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x20, 0x69, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x70, 0x20,
+    0x6C, 0x69, 0x6D, 0x69, 0x74, 0x2C, 0x20, 0x6F, 0x72, 0x20,
+    0x30, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65,
+    0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x6E, 0x65, 0x2E, 0xDA,
+    0x85, 0xAB, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x85, 0xAA, 0xDA,
+    0x05, 0xCE, 0x80, 0xAA, 0x28, 0x6F, 0x73, 0x2F, 0x6C, 0x69,
+    0x6E, 0x6B, 0x20, 0x6F, 0x6C, 0x64, 0x70, 0x61, 0x74, 0x68,
+    0x20, 0x6E, 0x65, 0x77, 0x70, 0x61, 0x74, 0x68, 0x20, 0x26,
+    0x6F, 0x70, 0x74, 0x20, 0x73, 0x79, 0x6D, 0x6C, 0x69, 0x6E,
+    0x6B, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x20, 0x61, 0x20, 0x73, 0x79, 0x6D, 0x6C, 0x69, 0x6E, 0x6B,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x6F, 0x6C, 0x64, 0x70,
+    0x61, 0x74, 0x68, 0x20, 0x74, 0x6F, 0x20, 0x6E, 0x65, 0x77,
+    0x70, 0x61, 0x74, 0x68, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20,
+    0x33, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C,
+    0x20, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x61, 0x74, 0x65, 0x72,
+    0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x20, 0x61,
+    0x20, 0x68, 0x61, 0x72, 0x64, 0x20, 0x6C, 0x69, 0x6E, 0x6B,
+    0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x61, 0x20, 0x73, 0x6F,
+    0x66, 0x74, 0x20, 0x6C, 0x69, 0x6E, 0x6B, 0x2E, 0x20, 0x44,
+    0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x77, 0x6F,
+    0x72, 0x6B, 0x20, 0x6F, 0x6E, 0x20, 0x57, 0x69, 0x6E, 0x64,
+    0x6F, 0x77, 0x73, 0x2E, 0xDA, 0x85, 0x48, 0xD3, 0x03, 0xDA,
+    0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x67, 0x01, 0xDA, 0x03,
+    0xDA, 0x84, 0xBE, 0xDA, 0x05, 0xCE, 0x2E, 0x28, 0x69, 0x6E,
+    0x64, 0x65, 0x78, 0x65, 0x64, 0x3F, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+    0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x75, 0x70,
+    0x6C, 0x65, 0x2E, 0xDA, 0x86, 0xE6, 0xD3, 0x04, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x80, 0x84, 0x01, 0xDA, 0x03,
+    0xDA, 0x86, 0xE5, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x28,
+    0x28, 0x25, 0x3D, 0x20, 0x78, 0x20, 0x6E, 0x29, 0x0A, 0x0A,
+    0x53, 0x68, 0x6F, 0x72, 0x74, 0x68, 0x61, 0x6E, 0x64, 0x20,
+    0x66, 0x6F, 0x72, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x78,
+    0x20, 0x28, 0x25, 0x20, 0x78, 0x20, 0x6E, 0x29, 0x29, 0x2E,
+    0xDA, 0x86, 0x39, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x86, 0x38,
+    0xDA, 0x05, 0xCE, 0x31, 0x28, 0x74, 0x68, 0x72, 0x65, 0x61,
+    0x64, 0x2F, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x29,
+    0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x72, 0x75,
+    0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x72, 0x65,
+    0x61, 0x64, 0x2E, 0xDA, 0x86, 0xD8, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x86, 0xD7, 0xDA, 0x05, 0xCE, 0x33, 0x28, 0x6D, 0x61,
+    0x74, 0x68, 0x2F, 0x61, 0x73, 0x69, 0x6E, 0x68, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x68, 0x79, 0x70, 0x65, 0x72, 0x62,
+    0x6F, 0x6C, 0x69, 0x63, 0x20, 0x61, 0x72, 0x63, 0x73, 0x69,
+    0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xDA, 0x86,
+    0xF6, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x86, 0x66, 0x01, 0xDA, 0x03, 0xDA, 0x82, 0xB2, 0xDA, 0x05,
+    0xCE, 0x37, 0x28, 0x62, 0x61, 0x64, 0x2D, 0x70, 0x61, 0x72,
+    0x73, 0x65, 0x20, 0x70, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65,
+    0x29, 0x0A, 0x0A, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74,
+    0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x20, 0x66,
+    0x6F, 0x72, 0x20, 0x61, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65,
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E, 0xDA, 0x86, 0x85,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x86, 0x84, 0xDA, 0x05, 0xCE,
+    0x34, 0x28, 0x62, 0x6E, 0x6F, 0x74, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x2D, 0x77, 0x69, 0x73,
+    0x65, 0x20, 0x69, 0x6E, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20,
+    0x6F, 0x66, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72,
+    0x20, 0x78, 0x2E, 0xDA, 0x86, 0xA1, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x55, 0xDA, 0x05, 0xCE, 0x80, 0xD1, 0x28, 0x67, 0x65,
+    0x6E, 0x73, 0x79, 0x6D, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77,
+    0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x20, 0x74, 0x68,
+    0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x75, 0x6E, 0x69, 0x71,
+    0x75, 0x65, 0x20, 0x61, 0x63, 0x72, 0x6F, 0x73, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x74, 0x69, 0x6D,
+    0x65, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6D, 0x65,
+    0x61, 0x6E, 0x73, 0x20, 0x69, 0x74, 0x20, 0x77, 0x69, 0x6C,
+    0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6C, 0x6C,
+    0x69, 0x64, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61,
+    0x6E, 0x79, 0x20, 0x61, 0x6C, 0x72, 0x65, 0x61, 0x64, 0x79,
+    0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x73,
+    0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x20, 0x64, 0x75, 0x72,
+    0x69, 0x6E, 0x67, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C,
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x73, 0x6F, 0x20,
+    0x69, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20,
+    0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x6D, 0x61,
+    0x63, 0x72, 0x6F, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x67, 0x65,
+    0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x61, 0x75, 0x74,
+    0x6F, 0x6D, 0x61, 0x74, 0x69, 0x63, 0x20, 0x62, 0x69, 0x6E,
+    0x64, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0xDA, 0x85, 0xA2, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x85, 0xA1, 0xDA, 0x05, 0xCE, 0x29,
+    0x54, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74,
+    0x69, 0x6E, 0x67, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69,
+    0x76, 0x65, 0x20, 0x69, 0x6E, 0x66, 0x69, 0x6E, 0x69, 0x74,
+    0x79, 0xDA, 0x85, 0xC1, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81,
+    0x1A, 0xDA, 0x05, 0xCE, 0x80, 0xA6, 0x28, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x63, 0x61, 0x70,
+    0x61, 0x63, 0x69, 0x74, 0x79, 0x29, 0x0A, 0x0A, 0x43, 0x72,
+    0x65, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61,
+    0x20, 0x70, 0x72, 0x65, 0x2D, 0x61, 0x6C, 0x6C, 0x6F, 0x63,
+    0x61, 0x74, 0x65, 0x64, 0x20, 0x63, 0x61, 0x70, 0x61, 0x63,
+    0x69, 0x74, 0x79, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73,
+    0x61, 0x6D, 0x65, 0x20, 0x61, 0x73, 0x20, 0x28, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x29, 0x20, 0x62, 0x75, 0x74, 0x20, 0x63,
+    0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x6D, 0x6F, 0x72, 0x65,
+    0x20, 0x65, 0x66, 0x66, 0x69, 0x63, 0x69, 0x65, 0x6E, 0x74,
+    0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61,
+    0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x73, 0x69, 0x7A, 0x65,
+    0x20, 0x6F, 0x66, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72,
+    0x61, 0x79, 0x20, 0x69, 0x73, 0x20, 0x6B, 0x6E, 0x6F, 0x77,
+    0x6E, 0x2E, 0xDA, 0x86, 0xA2, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x81, 0x56, 0xDA, 0x05, 0xCE, 0x80, 0xA8, 0x28, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29,
+    0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x20, 0x62, 0x79, 0x20, 0x63, 0x6F, 0x6E, 0x63,
+    0x61, 0x74, 0x65, 0x6E, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x67,
+    0x65, 0x74, 0x68, 0x65, 0x72, 0x2E, 0x20, 0x56, 0x61, 0x6C,
+    0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F,
+    0x6E, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6F,
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x76, 0x69, 0x61,
+    0x20, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x62, 0x65, 0x20,
+    0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72,
+    0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65,
+    0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x73,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2E, 0xDA, 0x86, 0xA7, 0xD3, 0x03,
+    0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x44, 0x01, 0xDA,
+    0x03, 0xDA, 0x86, 0xA6, 0xDA, 0x05, 0xCE, 0x37, 0x28, 0x76,
+    0x61, 0x72, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x20, 0x6E,
+    0x61, 0x6D, 0x65, 0x20, 0x69, 0x6E, 0x69, 0x74, 0x29, 0x0A,
+    0x0A, 0x44, 0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x61, 0x6C,
+    0x6C, 0x79, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20,
+    0x61, 0x20, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x20, 0x76,
+    0x61, 0x72, 0x2E, 0xDA, 0x83, 0xDE, 0xD3, 0x04, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x81, 0xB3, 0x01, 0xDA, 0x03,
+    0xDA, 0x87, 0x25, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x87,
+    0xA5, 0x28, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x68, 0x65, 0x61,
+    0x64, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A,
+    0x0A, 0x41, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+    0x20, 0x70, 0x75, 0x72, 0x70, 0x6F, 0x73, 0x65, 0x20, 0x6C,
+    0x6F, 0x6F, 0x70, 0x20, 0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E,
+    0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6D, 0x61, 0x63, 0x72,
+    0x6F, 0x20, 0x69, 0x73, 0x20, 0x73, 0x69, 0x6D, 0x69, 0x6C,
+    0x61, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x43, 0x6F, 0x6D, 0x6D, 0x6F, 0x6E, 0x20, 0x4C, 0x69, 0x73,
+    0x70, 0x20, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x6D, 0x61,
+    0x63, 0x72, 0x6F, 0x2C, 0x20, 0x61, 0x6C, 0x74, 0x68, 0x6F,
+    0x75, 0x67, 0x68, 0x20, 0x69, 0x6E, 0x74, 0x65, 0x6E, 0x74,
+    0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x6D, 0x75,
+    0x63, 0x68, 0x20, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x65, 0x72,
+    0x20, 0x69, 0x6E, 0x20, 0x73, 0x63, 0x6F, 0x70, 0x65, 0x2E,
+    0x20, 0x20, 0x54, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64,
+    0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F,
+    0x6F, 0x70, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20,
+    0x62, 0x65, 0x20, 0x61, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65,
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74,
+    0x61, 0x69, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65, 0x71,
+    0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x20,
+    0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x62, 0x69, 0x6E,
+    0x64, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x63,
+    0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C,
+    0x73, 0x2E, 0x20, 0x41, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+    0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65,
+    0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x72, 0x65, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x20, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64,
+    0x65, 0x66, 0x69, 0x6E, 0x65, 0x20, 0x73, 0x6F, 0x6D, 0x65,
+    0x74, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20, 0x6C,
+    0x6F, 0x6F, 0x70, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x2E, 0x20,
+    0x54, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x66,
+    0x6F, 0x72, 0x6D, 0x61, 0x74, 0x74, 0x65, 0x64, 0x20, 0x6C,
+    0x69, 0x6B, 0x65, 0x3A, 0x0A, 0x0A, 0x20, 0x20, 0x09, 0x62,
+    0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x3A, 0x76, 0x65,
+    0x72, 0x62, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2F,
+    0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E,
+    0x0A, 0x0A, 0x20, 0x20, 0x57, 0x68, 0x65, 0x72, 0x65, 0x20,
+    0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x73,
+    0x20, 0x61, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+    0x20, 0x61, 0x73, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64,
+    0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x66, 0x2C, 0x20, 0x3A,
+    0x76, 0x65, 0x72, 0x62, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x6E,
+    0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x73, 0x65, 0x74,
+    0x20, 0x6F, 0x66, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72,
+    0x64, 0x73, 0x2C, 0x20, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6F,
+    0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61,
+    0x6E, 0x79, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x65,
+    0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x2E,
+    0x20, 0x54, 0x68, 0x65, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C,
+    0x61, 0x62, 0x6C, 0x65, 0x20, 0x76, 0x65, 0x72, 0x62, 0x73,
+    0x20, 0x61, 0x72, 0x65, 0x3A, 0x0A, 0x0A, 0x20, 0x20, 0x09,
+    0x3A, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x2D,
+    0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x65, 0x64, 0x6C,
+    0x79, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65,
+    0x20, 0x61, 0x6E, 0x64, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x20,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x70,
+    0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x68,
+    0x69, 0x6C, 0x65, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20,
+    0x74, 0x72, 0x75, 0x74, 0x68, 0x79, 0x2E, 0x0A, 0x20, 0x20,
+    0x09, 0x3A, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x2D, 0x20,
+    0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20,
+    0x61, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x2E, 0x20, 0x54,
+    0x68, 0x65, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20,
+    0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20,
+    0x74, 0x77, 0x6F, 0x20, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
+    0x74, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x61, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74,
+    0x20, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x6E, 0x64, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x61, 0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
+    0x61, 0x6C, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x76,
+    0x65, 0x20, 0x73, 0x74, 0x65, 0x70, 0x2E, 0x20, 0x54, 0x68,
+    0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x69, 0x73,
+    0x20, 0x68, 0x61, 0x6C, 0x66, 0x20, 0x6F, 0x70, 0x65, 0x6E,
+    0x2C, 0x20, 0x5B, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2C, 0x20,
+    0x65, 0x6E, 0x64, 0x29, 0x2E, 0x0A, 0x20, 0x20, 0x09, 0x3A,
+    0x64, 0x6F, 0x77, 0x6E, 0x20, 0x2D, 0x20, 0x53, 0x61, 0x6D,
+    0x65, 0x20, 0x61, 0x73, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65,
+    0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x6C, 0x6F, 0x6F, 0x70,
+    0x73, 0x20, 0x69, 0x6E, 0x20, 0x72, 0x65, 0x76, 0x65, 0x72,
+    0x73, 0x65, 0x2E, 0x0A, 0x20, 0x20, 0x09, 0x3A, 0x6B, 0x65,
+    0x79, 0x73, 0x20, 0x2D, 0x20, 0x49, 0x74, 0x65, 0x72, 0x61,
+    0x74, 0x65, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x69, 0x6E, 0x20,
+    0x61, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x0A, 0x20, 0x20,
+    0x09, 0x3A, 0x70, 0x61, 0x69, 0x72, 0x73, 0x20, 0x2D, 0x20,
+    0x49, 0x74, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x76,
+    0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x79,
+    0x73, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x70, 0x61,
+    0x69, 0x72, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x64,
+    0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+    0x75, 0x72, 0x65, 0x2E, 0x0A, 0x20, 0x20, 0x09, 0x3A, 0x69,
+    0x6E, 0x20, 0x2D, 0x20, 0x49, 0x74, 0x65, 0x72, 0x61, 0x74,
+    0x65, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69, 0x6E,
+    0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65,
+    0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x6F, 0x72, 0x20,
+    0x62, 0x79, 0x74, 0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65,
+    0x6E, 0x63, 0x65, 0x2E, 0x0A, 0x20, 0x20, 0x09, 0x3A, 0x67,
+    0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x2D, 0x20,
+    0x49, 0x74, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x76,
+    0x65, 0x72, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+    0x79, 0x69, 0x65, 0x6C, 0x64, 0x65, 0x64, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+    0x2E, 0x20, 0x43, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x70,
+    0x61, 0x69, 0x72, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72,
+    0x61, 0x74, 0x6F, 0x72, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x65,
+    0x72, 0x2F, 0x63, 0x6F, 0x6E, 0x73, 0x75, 0x6D, 0x65, 0x72,
+    0x20, 0x70, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6E, 0x2E, 0x0A,
+    0x0A, 0x20, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x61, 0x6C,
+    0x73, 0x6F, 0x20, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x73,
+    0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E,
+    0x61, 0x6C, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x66,
+    0x69, 0x6E, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F,
+    0x6F, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x75, 0x72, 0x74,
+    0x68, 0x65, 0x72, 0x2E, 0x20, 0x43, 0x6F, 0x6E, 0x64, 0x69,
+    0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x73, 0x20, 0x61, 0x72,
+    0x65, 0x20, 0x6F, 0x66, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x0A, 0x0A, 0x20, 0x20, 0x09,
+    0x3A, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72, 0x20,
+    0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x0A, 0x0A,
+    0x20, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x3A, 0x6D,
+    0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72, 0x20, 0x69, 0x73,
+    0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20,
+    0x73, 0x65, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x6B, 0x65, 0x79,
+    0x77, 0x6F, 0x72, 0x64, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+    0x69, 0x73, 0x20, 0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64,
+    0x20, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x74,
+    0x2E, 0x20, 0x20, 0x3A, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69,
+    0x65, 0x72, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20,
+    0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x3A, 0x0A, 0x0A, 0x20,
+    0x20, 0x09, 0x3A, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x65,
+    0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20,
+    0x2D, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x73, 0x20, 0x66,
+    0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F,
+    0x6F, 0x70, 0x20, 0x69, 0x66, 0x20, 0x65, 0x78, 0x70, 0x72,
+    0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20,
+    0x66, 0x61, 0x6C, 0x73, 0x65, 0x79, 0x2E, 0x0A, 0x20, 0x20,
+    0x09, 0x3A, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x65, 0x78,
+    0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x2D,
+    0x20, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x73, 0x20, 0x66, 0x72,
+    0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F,
+    0x70, 0x20, 0x69, 0x66, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65,
+    0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x74,
+    0x72, 0x75, 0x74, 0x68, 0x79, 0x2E, 0x0A, 0x20, 0x20, 0x09,
+    0x3A, 0x6C, 0x65, 0x74, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+    0x6E, 0x67, 0x73, 0x20, 0x2D, 0x20, 0x64, 0x65, 0x66, 0x69,
+    0x6E, 0x65, 0x73, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x73, 0x20, 0x69, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x61,
+    0x73, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x64, 0x20, 0x74,
+    0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x65, 0x74, 0x20,
+    0x6D, 0x61, 0x63, 0x72, 0x6F, 0x2E, 0x0A, 0x20, 0x20, 0x09,
+    0x3A, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x66, 0x6F,
+    0x72, 0x6D, 0x20, 0x2D, 0x20, 0x65, 0x76, 0x61, 0x6C, 0x75,
+    0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x20, 0x66, 0x6F, 0x72,
+    0x6D, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x73, 0x69,
+    0x64, 0x65, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x20,
+    0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x69,
+    0x6E, 0x6E, 0x65, 0x72, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x2E,
+    0x0A, 0x20, 0x20, 0x09, 0x3A, 0x61, 0x66, 0x74, 0x65, 0x72,
+    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x2D, 0x20, 0x73, 0x61,
+    0x6D, 0x65, 0x20, 0x61, 0x73, 0x20, 0x3A, 0x62, 0x65, 0x66,
+    0x6F, 0x72, 0x65, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x73, 0x69, 0x64, 0x65, 0x20, 0x65, 0x66,
+    0x66, 0x65, 0x63, 0x74, 0x20, 0x68, 0x61, 0x70, 0x70, 0x65,
+    0x6E, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x69, 0x6E,
+    0x6E, 0x65, 0x72, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x2E, 0x0A,
+    0x20, 0x20, 0x09, 0x3A, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74,
+    0x20, 0x6E, 0x20, 0x2D, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61,
+    0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x78,
+    0x74, 0x20, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x20, 0x6C, 0x6F,
+    0x6F, 0x70, 0x20, 0x6E, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x73,
+    0x2E, 0x0A, 0x20, 0x20, 0x09, 0x3A, 0x77, 0x68, 0x65, 0x6E,
+    0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x2D, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x65, 0x76,
+    0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x62, 0x6F, 0x64,
+    0x79, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x63, 0x6F, 0x6E,
+    0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20,
+    0x74, 0x72, 0x75, 0x65, 0x2E, 0x0A, 0x0A, 0x20, 0x20, 0x54,
+    0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x6D, 0x61,
+    0x63, 0x72, 0x6F, 0x20, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73,
+    0x20, 0x65, 0x76, 0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73,
+    0x20, 0x74, 0x6F, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0xDA, 0x85,
+    0xA9, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x4F, 0x01, 0xDA, 0x03, 0xDA, 0x46, 0xDA, 0x05, 0xCE, 0x1E,
+    0x28, 0x7A, 0x65, 0x72, 0x6F, 0x3F, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+    0x78, 0x20, 0x69, 0x73, 0x20, 0x7A, 0x65, 0x72, 0x6F, 0x2E,
+    0xDA, 0x86, 0x59, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x80, 0xB5,
+    0xDA, 0x05, 0xCE, 0x83, 0x35, 0x28, 0x66, 0x69, 0x62, 0x65,
+    0x72, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x73, 0x69, 0x67, 0x6D,
+    0x61, 0x73, 0x6B, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61,
+    0x74, 0x65, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62,
+    0x6F, 0x64, 0x79, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x2E, 0x20,
+    0x43, 0x61, 0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
+    0x61, 0x6C, 0x6C, 0x79, 0x20, 0x74, 0x61, 0x6B, 0x65, 0x20,
+    0x61, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x73,
+    0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73, 0x20, 0x74, 0x6F, 0x20,
+    0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+    0x6E, 0x74, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x20,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x77, 0x68, 0x65, 0x6E,
+    0x20, 0x63, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x2E, 0x20, 0x54,
+    0x68, 0x65, 0x20, 0x6D, 0x61, 0x73, 0x6B, 0x20, 0x69, 0x73,
+    0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64,
+    0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x77,
+    0x6F, 0x72, 0x64, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20,
+    0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61,
+    0x63, 0x74, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73,
+    0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x69, 0x6E, 0x64, 0x69,
+    0x63, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x73, 0x69, 0x67,
+    0x6E, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x6C, 0x6F,
+    0x63, 0x6B, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x64, 0x65,
+    0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x73, 0x69, 0x67, 0x6D,
+    0x61, 0x73, 0x6B, 0x20, 0x69, 0x73, 0x20, 0x3A, 0x79, 0x2E,
+    0x20, 0x46, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x61, 0x6D, 0x70,
+    0x6C, 0x65, 0x2C, 0x20, 0x0A, 0x0A, 0x09, 0x28, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0x20, 0x6D, 0x79,
+    0x66, 0x75, 0x6E, 0x20, 0x3A, 0x65, 0x31, 0x32, 0x33, 0x29,
+    0x0A, 0x0A, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x65,
+    0x72, 0x72, 0x6F, 0x72, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61,
+    0x6C, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x75, 0x73, 0x65,
+    0x72, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73, 0x20,
+    0x31, 0x2C, 0x20, 0x32, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x33,
+    0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x69, 0x67, 0x6E,
+    0x61, 0x6C, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x73,
+    0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x73, 0x3A, 0x20,
+    0x0A, 0x0A, 0x09, 0x61, 0x20, 0x2D, 0x20, 0x62, 0x6C, 0x6F,
+    0x63, 0x6B, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x73, 0x69, 0x67,
+    0x6E, 0x61, 0x6C, 0x73, 0x0A, 0x09, 0x64, 0x20, 0x2D, 0x20,
+    0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x64, 0x65, 0x62, 0x75,
+    0x67, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73, 0x0A,
+    0x09, 0x65, 0x20, 0x2D, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B,
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x73, 0x69, 0x67,
+    0x6E, 0x61, 0x6C, 0x73, 0x0A, 0x09, 0x75, 0x20, 0x2D, 0x20,
+    0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x75, 0x73, 0x65, 0x72,
+    0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x73, 0x0A, 0x09,
+    0x79, 0x20, 0x2D, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20,
+    0x79, 0x69, 0x65, 0x6C, 0x64, 0x20, 0x73, 0x69, 0x67, 0x6E,
+    0x61, 0x6C, 0x73, 0x0A, 0x09, 0x30, 0x2D, 0x39, 0x20, 0x2D,
+    0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x61, 0x20, 0x73,
+    0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x63, 0x20, 0x75, 0x73,
+    0x65, 0x72, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x6C, 0x0A,
+    0x0A, 0x54, 0x68, 0x65, 0x20, 0x73, 0x69, 0x67, 0x6D, 0x61,
+    0x73, 0x6B, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E,
+    0x74, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x63, 0x61, 0x6E,
+    0x20, 0x74, 0x61, 0x6B, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x69,
+    0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x6C,
+    0x61, 0x67, 0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x61, 0x6E,
+    0x79, 0x20, 0x6D, 0x75, 0x74, 0x75, 0x61, 0x6C, 0x6C, 0x79,
+    0x20, 0x65, 0x78, 0x63, 0x6C, 0x75, 0x73, 0x69, 0x76, 0x65,
+    0x20, 0x66, 0x6C, 0x61, 0x67, 0x73, 0x20, 0x61, 0x72, 0x65,
+    0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x2C, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x66,
+    0x6C, 0x61, 0x67, 0x20, 0x74, 0x61, 0x6B, 0x65, 0x73, 0x20,
+    0x70, 0x72, 0x65, 0x63, 0x65, 0x64, 0x65, 0x6E, 0x63, 0x65,
+    0x2E, 0x0A, 0x0A, 0x09, 0x69, 0x20, 0x2D, 0x20, 0x69, 0x6E,
+    0x68, 0x65, 0x72, 0x69, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E,
+    0x74, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x0A, 0x09, 0x70, 0x20, 0x2D, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F,
+    0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x27, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74,
+    0x79, 0x70, 0x65, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x65,
+    0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74,
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0xDA, 0x85, 0xBF, 0xD3,
+    0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x81, 0xF5,
+    0x01, 0xDA, 0x03, 0xDA, 0x85, 0xBE, 0xDA, 0x05, 0xCE, 0x39,
+    0x28, 0x6D, 0x65, 0x61, 0x6E, 0x20, 0x78, 0x73, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6D, 0x65, 0x61, 0x6E, 0x20, 0x6F, 0x66,
+    0x20, 0x78, 0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x65, 0x6D,
+    0x70, 0x74, 0x79, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x4E, 0x61, 0x4E, 0x2E, 0xDA, 0x86, 0x80,
+    0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x82,
+    0xF5, 0x01, 0xDA, 0x03, 0xDA, 0x86, 0x7F, 0xDA, 0x05, 0xCE,
+    0x80, 0xF8, 0x28, 0x66, 0x69, 0x6E, 0x64, 0x20, 0x70, 0x72,
+    0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x29, 0x0A, 0x0A, 0x46,
+    0x69, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x72, 0x73, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x69, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65,
+    0x78, 0x65, 0x64, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+    0x73, 0x61, 0x74, 0x69, 0x73, 0x66, 0x69, 0x65, 0x73, 0x20,
+    0x61, 0x20, 0x70, 0x72, 0x65, 0x64, 0x69, 0x63, 0x61, 0x74,
+    0x65, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x69, 0x66, 0x20, 0x6E,
+    0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0x20,
+    0x4E, 0x6F, 0x74, 0x65, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65,
+    0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x20, 0x77, 0x61, 0x79,
+    0x20, 0x74, 0x6F, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72,
+    0x65, 0x6E, 0x74, 0x69, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20,
+    0x6E, 0x69, 0x6C, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64,
+    0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x20, 0x6E,
+    0x6F, 0x74, 0x20, 0x66, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0x20,
+    0x43, 0x6F, 0x6E, 0x73, 0x69, 0x64, 0x65, 0x72, 0x20, 0x66,
+    0x69, 0x6E, 0x64, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x20,
+    0x69, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73,
+    0x20, 0x61, 0x6E, 0x20, 0x69, 0x73, 0x73, 0x75, 0x65, 0x2E,
+    0xDA, 0x86, 0xC0, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x86, 0xBF,
+    0xDA, 0x05, 0xCE, 0x2A, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F,
+    0x63, 0x62, 0x72, 0x74, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x63, 0x75, 0x62, 0x65, 0x20, 0x72, 0x6F, 0x6F, 0x74,
+    0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xDA, 0x86, 0xD5, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x86, 0xD4, 0xDA, 0x05, 0xCE, 0x35,
+    0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x61, 0x63, 0x6F, 0x73,
+    0x68, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x79, 0x70,
+    0x65, 0x72, 0x62, 0x6F, 0x6C, 0x69, 0x63, 0x20, 0x61, 0x72,
+    0x63, 0x63, 0x6F, 0x73, 0x69, 0x6E, 0x65, 0x20, 0x6F, 0x66,
+    0x20, 0x78, 0x2E, 0xDA, 0x86, 0x4B, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x83, 0x74, 0xDA, 0x05, 0xCE, 0x74, 0x28, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x2F, 0x63, 0x6C, 0x6F, 0x6E, 0x65, 0x20,
+    0x74, 0x61, 0x62, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61,
+    0x74, 0x65, 0x20, 0x61, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x20,
+    0x6F, 0x66, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x2E, 0x20, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x73, 0x20,
+    0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77,
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x6C,
+    0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x68, 0x61, 0x6E,
+    0x67, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x6C, 0x64,
+    0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x2C, 0x20, 0x61, 0x6E,
+    0x64, 0x20, 0x76, 0x69, 0x63, 0x65, 0x20, 0x76, 0x65, 0x72,
+    0x73, 0x61, 0x2E, 0xDA, 0x86, 0xCE, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x86, 0xCD, 0xDA, 0x05, 0xCE, 0x83, 0x2D, 0x28, 0x64,
+    0x65, 0x62, 0x75, 0x67, 0x2F, 0x73, 0x74, 0x61, 0x63, 0x6B,
+    0x20, 0x66, 0x69, 0x62, 0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74,
+    0x73, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20,
+    0x61, 0x73, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x73, 0x2E, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x63, 0x6F, 0x6E,
+    0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x69, 0x6E, 0x66, 0x6F,
+    0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x62,
+    0x6F, 0x75, 0x74, 0x20, 0x61, 0x20, 0x73, 0x74, 0x61, 0x63,
+    0x6B, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x2E, 0x20, 0x54,
+    0x68, 0x65, 0x20, 0x74, 0x6F, 0x70, 0x20, 0x6D, 0x6F, 0x73,
+    0x74, 0x2C, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74,
+    0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x66, 0x72, 0x61,
+    0x6D, 0x65, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D,
+    0x20, 0x6D, 0x6F, 0x73, 0x74, 0x20, 0x73, 0x74, 0x61, 0x63,
+    0x6B, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x69, 0x73,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x20, 0x45, 0x61, 0x63,
+    0x68, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x66, 0x72,
+    0x61, 0x6D, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69,
+    0x6E, 0x73, 0x20, 0x73, 0x6F, 0x6D, 0x65, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F,
+    0x77, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69,
+    0x62, 0x75, 0x74, 0x65, 0x73, 0x3A, 0x0A, 0x0A, 0x09, 0x3A,
+    0x63, 0x20, 0x2D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x69,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x63,
+    0x6B, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x69, 0x73,
+    0x20, 0x61, 0x20, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x69, 0x6E, 0x76, 0x6F, 0x63, 0x61,
+    0x74, 0x69, 0x6F, 0x6E, 0x0A, 0x09, 0x3A, 0x63, 0x6F, 0x6C,
+    0x75, 0x6D, 0x6E, 0x20, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x73, 0x6F,
+    0x75, 0x72, 0x63, 0x65, 0x20, 0x63, 0x6F, 0x6C, 0x75, 0x6D,
+    0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+    0x74, 0x61, 0x63, 0x6B, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65,
+    0x0A, 0x09, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x2D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75,
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x63,
+    0x6B, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x72, 0x65,
+    0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x73, 0x0A, 0x09,
+    0x3A, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x2D, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20,
+    0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x20, 0x6C, 0x69, 0x6E,
+    0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+    0x74, 0x61, 0x63, 0x6B, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65,
+    0x0A, 0x09, 0x3A, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x2D, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x68, 0x75, 0x6D, 0x61, 0x6E, 0x20,
+    0x66, 0x72, 0x69, 0x65, 0x6E, 0x64, 0x6C, 0x79, 0x20, 0x6E,
+    0x61, 0x6D, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x0A,
+    0x09, 0x3A, 0x70, 0x63, 0x20, 0x2D, 0x20, 0x69, 0x6E, 0x74,
+    0x65, 0x67, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x63,
+    0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x67,
+    0x72, 0x61, 0x6D, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65,
+    0x72, 0x0A, 0x09, 0x3A, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65,
+    0x20, 0x2D, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66,
+    0x69, 0x6C, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x6F,
+    0x72, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x69, 0x64,
+    0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x20, 0x66,
+    0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x6F, 0x75,
+    0x72, 0x63, 0x65, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x0A, 0x09,
+    0x3A, 0x73, 0x6C, 0x6F, 0x74, 0x73, 0x20, 0x2D, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6C,
+    0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x69,
+    0x6E, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x73, 0x6C, 0x6F,
+    0x74, 0x0A, 0x09, 0x3A, 0x74, 0x61, 0x69, 0x6C, 0x20, 0x2D,
+    0x20, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x20, 0x69,
+    0x6E, 0x64, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20,
+    0x61, 0x20, 0x74, 0x61, 0x69, 0x6C, 0x20, 0x63, 0x61, 0x6C,
+    0x6C, 0xDA, 0x86, 0xED, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03,
+    0x00, 0xDA, 0x12, 0x83, 0x2F, 0x01, 0xDA, 0x03, 0xDA, 0x86,
+    0xEC, 0xDA, 0x05, 0xCE, 0x7C, 0x28, 0x6A, 0x75, 0x78, 0x74,
+    0x2A, 0x20, 0x26, 0x20, 0x66, 0x75, 0x6E, 0x73, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6A, 0x75, 0x78, 0x74, 0x61, 0x70, 0x6F,
+    0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x66, 0x20,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E,
+    0x20, 0x49, 0x6E, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20,
+    0x77, 0x6F, 0x72, 0x64, 0x73, 0x2C, 0x20, 0x20, 0x28, 0x28,
+    0x6A, 0x75, 0x78, 0x74, 0x2A, 0x20, 0x61, 0x20, 0x62, 0x20,
+    0x63, 0x29, 0x20, 0x78, 0x29, 0x20, 0x65, 0x76, 0x61, 0x6C,
+    0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x5B,
+    0x28, 0x61, 0x20, 0x78, 0x29, 0x20, 0x28, 0x62, 0x20, 0x78,
+    0x29, 0x20, 0x28, 0x63, 0x20, 0x78, 0x29, 0x5D, 0x2E, 0xDA,
+    0x87, 0x2E, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x85, 0x69, 0xDA,
+    0x05, 0xCE, 0x78, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x2F, 0x6A, 0x6F, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x74,
+    0x73, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x73, 0x65, 0x70,
+    0x29, 0x0A, 0x0A, 0x4A, 0x6F, 0x69, 0x6E, 0x73, 0x20, 0x61,
+    0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66,
+    0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x69,
+    0x6E, 0x74, 0x6F, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x73, 0x74,
+    0x72, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x6F, 0x70, 0x74, 0x69,
+    0x6F, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x73, 0x65, 0x70,
+    0x61, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20,
+    0x61, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x6F,
+    0x72, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x73,
+    0x65, 0x70, 0x2E, 0xDA, 0x85, 0xB2, 0xD3, 0x03, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x58, 0x01, 0xDA, 0x03, 0xDA,
+    0x85, 0xB1, 0xDA, 0x05, 0xCE, 0x24, 0x28, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43,
+    0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20,
+    0x69, 0x73, 0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2E, 0xDA, 0x86, 0x8F, 0xD3, 0x03, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x88, 0xEA, 0x01, 0xDA, 0x03, 0xDA,
+    0x00, 0xDA, 0x05, 0xCE, 0x3F, 0x54, 0x68, 0x65, 0x20, 0x72,
+    0x6F, 0x6F, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F,
+    0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x75, 0x73, 0x65, 0x64,
+    0x20, 0x74, 0x6F, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x20, 0x65, 0x6E, 0x76, 0x69, 0x6F, 0x6E, 0x6D, 0x65, 0x6E,
+    0x74, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x28, 0x6D,
+    0x61, 0x6B, 0x65, 0x2D, 0x65, 0x6E, 0x76, 0x29, 0xDA, 0x85,
+    0xD6, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x88, 0x1C, 0x01, 0xDA, 0x03, 0xDA, 0x86, 0xC5, 0xDA, 0x24,
+    0xCB, 0xDA, 0x05, 0xCE, 0x81, 0xDC, 0x28, 0x69, 0x6D, 0x70,
+    0x6F, 0x72, 0x74, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x26,
+    0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A, 0x49, 0x6D,
+    0x70, 0x6F, 0x72, 0x74, 0x20, 0x61, 0x20, 0x6D, 0x6F, 0x64,
+    0x75, 0x6C, 0x65, 0x2E, 0x20, 0x46, 0x69, 0x72, 0x73, 0x74,
+    0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+    0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E,
+    0x20, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x73, 0x20, 0x69, 0x74,
+    0x73, 0x20, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73,
+    0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E,
+    0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2C,
+    0x20, 0x70, 0x72, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20,
+    0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x20, 0x61, 0x73, 0x20,
+    0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x2E, 0x20, 0x20, 0x28,
+    0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x3A, 0x61,
+    0x73, 0x20, 0x6F, 0x72, 0x20, 0x3A, 0x70, 0x72, 0x65, 0x66,
+    0x69, 0x78, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x74, 0x6F, 0x20, 0x73, 0x65, 0x74, 0x20, 0x61, 0x20, 0x70,
+    0x72, 0x65, 0x66, 0x69, 0x78, 0x29, 0x2E, 0x20, 0x49, 0x66,
+    0x20, 0x6E, 0x6F, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78,
+    0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64,
+    0x65, 0x64, 0x2C, 0x20, 0x20, 0x75, 0x73, 0x65, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C,
+    0x65, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 0x70, 0x72, 0x65,
+    0x66, 0x69, 0x78, 0x2E, 0x20, 0x4F, 0x6E, 0x65, 0x20, 0x63,
+    0x61, 0x6E, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x75, 0x73,
+    0x65, 0x20, 0x3A, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20,
+    0x74, 0x72, 0x75, 0x65, 0x20, 0x20, 0x74, 0x6F, 0x20, 0x72,
+    0x65, 0x2D, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x65,
+    0x64, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73, 0x2E,
+    0x20, 0x49, 0x66, 0x20, 0x3A, 0x65, 0x78, 0x69, 0x74, 0x20,
+    0x74, 0x72, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x67, 0x69,
+    0x76, 0x65, 0x6E, 0x20, 0x61, 0x73, 0x20, 0x61, 0x6E, 0x20,
+    0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20,
+    0x20, 0x61, 0x6E, 0x79, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72,
+    0x73, 0x20, 0x65, 0x6E, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65,
+    0x72, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x74, 0x6F, 0x70, 0x20, 0x6C, 0x65, 0x76, 0x65, 0x6C,
+    0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F,
+    0x64, 0x75, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+    0x63, 0x61, 0x75, 0x73, 0x65, 0x20, 0x28, 0x6F, 0x73, 0x2F,
+    0x65, 0x78, 0x69, 0x74, 0x20, 0x31, 0x29, 0x20, 0x20, 0x74,
+    0x6F, 0x20, 0x62, 0x65, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x65,
+    0x64, 0x2E, 0xDA, 0x86, 0xC1, 0xD3, 0x03, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x84, 0x12, 0x01, 0xDA, 0x03, 0xDA,
+    0x86, 0x5F, 0xDA, 0x05, 0xCE, 0x80, 0xD9, 0x28, 0x70, 0x75,
+    0x74, 0x2D, 0x69, 0x6E, 0x20, 0x64, 0x73, 0x20, 0x6B, 0x73,
+    0x20, 0x76, 0x29, 0x0A, 0x0A, 0x50, 0x75, 0x74, 0x20, 0x61,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E, 0x74,
+    0x6F, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x73, 0x74, 0x65, 0x64,
+    0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75,
+    0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0x20, 0x20, 0x4C, 0x6F,
+    0x6F, 0x6B, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74,
+    0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x76, 0x69,
+    0x61, 0x20, 0x20, 0x61, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65,
+    0x6E, 0x63, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x6B, 0x65, 0x79,
+    0x73, 0x2E, 0x20, 0x4D, 0x69, 0x73, 0x73, 0x69, 0x6E, 0x67,
+    0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75,
+    0x63, 0x74, 0x75, 0x72, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6C,
+    0x6C, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61,
+    0x63, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x73, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x2C, 0x20,
+    0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C, 0x20, 0x64,
+    0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+    0x75, 0x72, 0x65, 0x2E, 0xDA, 0x86, 0x9B, 0xD3, 0x03, 0xDA,
+    0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x82, 0x93, 0x01, 0xDA,
+    0x03, 0xDA, 0x81, 0xF9, 0xDA, 0x05, 0xCE, 0x73, 0x28, 0x6D,
+    0x61, 0x70, 0x20, 0x66, 0x20, 0x26, 0x20, 0x69, 0x6E, 0x64,
+    0x73, 0x29, 0x0A, 0x0A, 0x4D, 0x61, 0x70, 0x20, 0x61, 0x20,
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F,
+    0x76, 0x65, 0x72, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20,
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E,
+    0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65,
+    0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72,
+    0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61,
+    0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C,
+    0x74, 0x73, 0x2E, 0xDA, 0x87, 0x2A, 0xD3, 0x04, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x80, 0xD2, 0x01, 0xDA, 0x03,
+    0xDA, 0x87, 0x29, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x81,
+    0xB5, 0x28, 0x74, 0x72, 0x79, 0x20, 0x62, 0x6F, 0x64, 0x79,
+    0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x29, 0x0A, 0x0A, 0x54,
+    0x72, 0x79, 0x20, 0x73, 0x6F, 0x6D, 0x65, 0x74, 0x68, 0x69,
+    0x6E, 0x67, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x61, 0x74,
+    0x63, 0x68, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x73, 0x2E,
+    0x20, 0x42, 0x6F, 0x64, 0x79, 0x20, 0x69, 0x73, 0x20, 0x61,
+    0x6E, 0x79, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73,
+    0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x73, 0x68, 0x6F, 0x75,
+    0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x61, 0x20, 0x66, 0x6F,
+    0x72, 0x6D, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x65, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x20, 0x74, 0x75,
+    0x70, 0x6C, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20,
+    0x74, 0x75, 0x70, 0x6C, 0x65, 0x20, 0x20, 0x73, 0x68, 0x6F,
+    0x75, 0x6C, 0x64, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69,
+    0x6E, 0x20, 0x61, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x72, 0x72, 0x6F,
+    0x72, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x6E, 0x20,
+    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x62,
+    0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65,
+    0x72, 0x20, 0x77, 0x72, 0x61, 0x70, 0x70, 0x69, 0x6E, 0x67,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x2E,
+    0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20,
+    0x6F, 0x66, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x69, 0x66,
+    0x20, 0x6E, 0x6F, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2C,
+    0x20, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
+    0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x63,
+    0x61, 0x74, 0x63, 0x68, 0x20, 0x69, 0x66, 0x20, 0x61, 0x6E,
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2E, 0x20, 0x54, 0x68,
+    0x65, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x6F, 0x6E, 0x6C,
+    0x79, 0x20, 0x72, 0x75, 0x6E, 0x73, 0x20, 0x69, 0x6E, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x66, 0x69, 0x62, 0x65,
+    0x72, 0x20, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x69, 0x73,
+    0x20, 0x62, 0x6F, 0x75, 0x6E, 0x64, 0x2C, 0x20, 0x6F, 0x74,
+    0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x69, 0x74,
+    0x20, 0x72, 0x75, 0x6E, 0x73, 0x20, 0x61, 0x73, 0x20, 0x61,
+    0x20, 0x70, 0x72, 0x6F, 0x74, 0x65, 0x63, 0x74, 0x65, 0x64,
+    0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x6F, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E,
+    0x74, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0xDA, 0x86,
+    0xF9, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x83, 0xA3, 0x01, 0xDA, 0x03, 0xDA, 0x86, 0xF8, 0xDA, 0x24,
+    0xCB, 0xDA, 0x05, 0xCE, 0x80, 0x9E, 0x28, 0x61, 0x73, 0x2D,
+    0x3E, 0x20, 0x78, 0x20, 0x61, 0x73, 0x20, 0x26, 0x20, 0x66,
+    0x6F, 0x72, 0x6D, 0x73, 0x29, 0x0A, 0x0A, 0x54, 0x68, 0x72,
+    0x65, 0x61, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20,
+    0x74, 0x6F, 0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x2C, 0x20,
+    0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x20,
+    0x61, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x6D,
+    0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x65, 0x76, 0x69,
+    0x6F, 0x75, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x2E, 0x20,
+    0x54, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20,
+    0x66, 0x6F, 0x72, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x78, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x2E, 0xDA, 0x86, 0xF3, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x86, 0xF2, 0xDA, 0x05, 0xCE, 0x41, 0x28, 0x6D,
+    0x61, 0x74, 0x68, 0x2F, 0x74, 0x72, 0x75, 0x6E, 0x63, 0x20,
+    0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x65,
+    0x67, 0x65, 0x72, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65,
+    0x6E, 0x20, 0x78, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x30, 0x20,
+    0x6E, 0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x20, 0x74, 0x6F,
+    0x20, 0x78, 0x2E, 0xDA, 0x86, 0x7D, 0xD3, 0x03, 0xDA, 0x11,
+    0xD2, 0x03, 0x00, 0xDA, 0x12, 0x82, 0x46, 0x01, 0xDA, 0x03,
+    0xDA, 0x82, 0x45, 0xDA, 0x05, 0xCE, 0x3B, 0x28, 0x6D, 0x61,
+    0x78, 0x20, 0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x65, 0x72, 0x69, 0x63,
+    0x20, 0x6D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x6F,
+    0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x67, 0x75,
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0xDA, 0x86, 0x8B, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x86, 0x8A, 0xDA, 0x05, 0xCE, 0x51,
+    0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x72, 0x65,
+    0x70, 0x65, 0x61, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+    0x20, 0x6E, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20,
+    0x6E, 0x20, 0x63, 0x6F, 0x70, 0x69, 0x65, 0x73, 0x20, 0x6F,
+    0x66, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x63, 0x6F,
+    0x6E, 0x63, 0x61, 0x74, 0x65, 0x6E, 0x61, 0x74, 0x65, 0x64,
+    0x2E, 0xDA, 0x87, 0x02, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x87,
+    0x01, 0xDA, 0x05, 0xCE, 0x6D, 0x28, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x2F, 0x62, 0x69, 0x74, 0x20, 0x62, 0x75, 0x66,
+    0x66, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x29,
+    0x0A, 0x0A, 0x47, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x62, 0x69, 0x74, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E, 0x20, 0x62, 0x69,
+    0x74, 0x2D, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x72, 0x75,
+    0x65, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62,
+    0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x2C,
+    0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20,
+    0x6E, 0x6F, 0x74, 0x2E, 0xDA, 0x86, 0xFC, 0xD3, 0x03, 0xDA,
+    0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x54, 0x01, 0xDA, 0x03,
+    0xDA, 0x86, 0xFB, 0xDA, 0x05, 0xCE, 0x22, 0x28, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x3F, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x43,
+    0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20, 0x78, 0x20,
+    0x69, 0x73, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72,
+    0x2E, 0xDA, 0x86, 0x70, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03,
+    0x00, 0xDA, 0x12, 0x81, 0xA8, 0x01, 0xDA, 0x03, 0xDA, 0x86,
+    0x6F, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x4F, 0x28, 0x66,
+    0x6F, 0x72, 0x20, 0x69, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74,
+    0x20, 0x73, 0x74, 0x6F, 0x70, 0x20, 0x26, 0x20, 0x62, 0x6F,
+    0x64, 0x79, 0x29, 0x0A, 0x0A, 0x44, 0x6F, 0x20, 0x61, 0x20,
+    0x63, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x20, 0x66, 0x6F,
+    0x72, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x66, 0x6F, 0x72,
+    0x20, 0x73, 0x69, 0x64, 0x65, 0x20, 0x65, 0x66, 0x66, 0x65,
+    0x63, 0x74, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0xDA, 0x86, 0x0C,
+    0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x82,
+    0x58, 0x01, 0xDA, 0x03, 0xDA, 0x86, 0x0B, 0xDA, 0x05, 0xCE,
+    0x41, 0x28, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x78, 0x73,
+    0x29, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x65, 0x6C, 0x65,
+    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+    0x61, 0x6E, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x65, 0x64,
+    0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x73, 0x74, 0x72, 0x75,
+    0x63, 0x74, 0x75, 0x72, 0x65, 0x2E, 0xDA, 0x86, 0x63, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x86, 0x62, 0xDA, 0x05, 0xCE, 0x41,
+    0x28, 0x74, 0x72, 0x61, 0x63, 0x65, 0x20, 0x66, 0x75, 0x6E,
+    0x63, 0x29, 0x0A, 0x0A, 0x45, 0x6E, 0x61, 0x62, 0x6C, 0x65,
+    0x20, 0x74, 0x72, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x20, 0x6F,
+    0x6E, 0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
+    0x6F, 0x6E, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x2E, 0xDA, 0x86, 0x09, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x86, 0x08, 0xDA, 0x05, 0xCE, 0x45, 0x28,
+    0x74, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x72, 0x6F,
+    0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x20, 0x74, 0x79, 0x70, 0x65, 0x64, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65,
+    0x72, 0x74, 0x69, 0x65, 0x73, 0x20, 0x61, 0x73, 0x20, 0x61,
+    0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x2E, 0xDA, 0x86,
+    0xB3, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x81, 0xAD, 0x01, 0xDA, 0x03, 0xDA, 0x86, 0xB2, 0xDA, 0x24,
+    0xCB, 0xDA, 0x05, 0xCE, 0x80, 0x98, 0x28, 0x65, 0x61, 0x63,
+    0x68, 0x20, 0x78, 0x20, 0x69, 0x6E, 0x64, 0x20, 0x26, 0x20,
+    0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A, 0x4C, 0x6F, 0x6F,
+    0x70, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x65, 0x61, 0x63,
+    0x68, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x6E,
+    0x20, 0x69, 0x6E, 0x64, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0x20, 0x49,
+    0x66, 0x20, 0x69, 0x6E, 0x64, 0x20, 0x69, 0x73, 0x20, 0x61,
+    0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x72,
+    0x61, 0x6E, 0x67, 0x65, 0x2C, 0x20, 0x6C, 0x6F, 0x6F, 0x70,
+    0x73, 0x20, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x73, 0x20,
+    0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x69,
+    0x6E, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66, 0x20,
+    0x62, 0x75, 0x69, 0x6C, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x61,
+    0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0xDA, 0x87,
+    0x2F, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x83, 0x88, 0x01, 0xDA, 0x03, 0xDA, 0x81, 0x1D, 0xDA, 0x05,
+    0xCE, 0x80, 0xAC, 0x28, 0x77, 0x61, 0x6C, 0x6B, 0x20, 0x66,
+    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x29, 0x0A, 0x0A, 0x49, 0x74,
+    0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x76, 0x65, 0x72,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x73, 0x74, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x20, 0x66,
+    0x20, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x2E,
+    0x20, 0x43, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73,
+    0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x64, 0x61, 0x74, 0x61,
+    0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+    0x2E, 0x20, 0x49, 0x66, 0x20, 0x61, 0x73, 0x74, 0x20, 0x69,
+    0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x20, 0x20, 0x74,
+    0x61, 0x62, 0x6C, 0x65, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x75,
+    0x63, 0x74, 0x2C, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2C,
+    0x20, 0x6F, 0x72, 0x20, 0x74, 0x75, 0x70, 0x6C, 0x65, 0x2C,
+    0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x66, 0x6F, 0x72, 0x6D, 0x2E, 0xDA, 0x86, 0x8E, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x86, 0x8D, 0xDA, 0x05, 0xCE, 0x81, 0x08,
+    0x28, 0x66, 0x69, 0x62, 0x65, 0x72, 0x2F, 0x6D, 0x61, 0x78,
+    0x73, 0x74, 0x61, 0x63, 0x6B, 0x20, 0x66, 0x69, 0x62, 0x29,
+    0x0A, 0x0A, 0x47, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x73,
+    0x74, 0x61, 0x63, 0x6B, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20,
+    0x69, 0x6E, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x6F,
+    0x77, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20,
+    0x66, 0x69, 0x62, 0x65, 0x72, 0x2E, 0x20, 0x57, 0x68, 0x69,
+    0x6C, 0x65, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20,
+    0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x62, 0x65, 0x72, 0x27, 0x73, 0x20, 0x73, 0x74, 0x61, 0x63,
+    0x6B, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61,
+    0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x75,
+    0x70, 0x20, 0x66, 0x72, 0x6F, 0x6E, 0x74, 0x2C, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20, 0x77,
+    0x69, 0x6C, 0x6C, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6C,
+    0x6C, 0x6F, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x6D, 0x6F,
+    0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x68,
+    0x69, 0x73, 0x20, 0x61, 0x6D, 0x6F, 0x75, 0x6E, 0x74, 0x20,
+    0x61, 0x6E, 0x64, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x74,
+    0x68, 0x72, 0x6F, 0x77, 0x20, 0x61, 0x20, 0x73, 0x74, 0x61,
+    0x63, 0x6B, 0x2D, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F,
+    0x77, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x69, 0x66,
+    0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x6D, 0x65, 0x6D, 0x6F,
+    0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x65, 0x65, 0x64,
+    0x65, 0x64, 0x2E, 0x20, 0xDA, 0x86, 0x68, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x86, 0x67, 0xDA, 0x05, 0xCE, 0x58, 0x28, 0x67,
+    0x63, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20,
+    0x6F, 0x66, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73,
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6D, 0x61, 0x72, 0x6B,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x65, 0x61, 0x70, 0x20,
+    0x64, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x67, 0x61, 0x72,
+    0x62, 0x61, 0x67, 0x65, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0xDA, 0x87, 0x46, 0xD3,
+    0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x81, 0xEE,
+    0x01, 0xDA, 0x03, 0xDA, 0x85, 0xBD, 0xDA, 0x05, 0xCE, 0x3B,
+    0x28, 0x73, 0x75, 0x6D, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x78,
+    0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x78, 0x73, 0x20, 0x69,
+    0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2C, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x30, 0x2E, 0xDA,
+    0x87, 0x3C, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x84, 0x3D, 0x01, 0xDA, 0x03, 0xDA, 0x84, 0xBF, 0xDA,
+    0x05, 0xCE, 0x80, 0x91, 0x28, 0x66, 0x6C, 0x61, 0x74, 0x74,
+    0x65, 0x6E, 0x2D, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x69, 0x6E,
+    0x74, 0x6F, 0x20, 0x78, 0x73, 0x29, 0x0A, 0x0A, 0x54, 0x61,
+    0x6B, 0x65, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x73, 0x74,
+    0x65, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x28,
+    0x74, 0x72, 0x65, 0x65, 0x29, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x66,
+    0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x72, 0x61, 0x76, 0x65,
+    0x72, 0x73, 0x61, 0x6C, 0x20, 0x6F, 0x66, 0x20, 0x20, 0x74,
+    0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20,
+    0x74, 0x6F, 0x20, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61,
+    0x79, 0x20, 0x27, 0x69, 0x6E, 0x74, 0x6F, 0x27, 0x2E, 0x20,
+    0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x2E, 0xDA,
+    0x87, 0x4A, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x80, 0x9A, 0x01, 0xDA, 0x03, 0xDA, 0x87, 0x49, 0xDA,
+    0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x47, 0x28, 0x75, 0x6E, 0x6C,
+    0x65, 0x73, 0x73, 0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74,
+    0x69, 0x6F, 0x6E, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79,
+    0x29, 0x0A, 0x0A, 0x53, 0x68, 0x6F, 0x72, 0x74, 0x68, 0x61,
+    0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x77, 0x68,
+    0x65, 0x6E, 0x20, 0x28, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F,
+    0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x20, 0x3B,
+    0x62, 0x6F, 0x64, 0x79, 0x29, 0x2E, 0x20, 0xDA, 0x86, 0x89,
+    0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x84, 0x3B, 0xDA, 0x05, 0xCE,
+    0x80, 0xD8, 0x28, 0x73, 0x63, 0x61, 0x6E, 0x2D, 0x6E, 0x75,
+    0x6D, 0x62, 0x65, 0x72, 0x20, 0x73, 0x74, 0x72, 0x29, 0x0A,
+    0x0A, 0x50, 0x61, 0x72, 0x73, 0x65, 0x20, 0x61, 0x20, 0x6E,
+    0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+    0x20, 0x61, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x73, 0x65,
+    0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x61, 0x6E, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x2C, 0x20,
+    0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x20, 0x6F,
+    0x72, 0x20, 0x61, 0x20, 0x72, 0x65, 0x61, 0x6C, 0x2E, 0x20,
+    0x54, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+    0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x69,
+    0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65,
+    0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x61, 0x73,
+    0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x73, 0x20, 0x69,
+    0x6E, 0x20, 0x6A, 0x61, 0x6E, 0x65, 0x74, 0x20, 0x73, 0x6F,
+    0x75, 0x72, 0x63, 0x65, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x2E,
+    0x20, 0x57, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x20, 0x6F, 0x6E, 0x20,
+    0x61, 0x6E, 0x20, 0x69, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64,
+    0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x2E, 0xDA, 0x86,
+    0x86, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x87, 0x0E, 0x01, 0xDA, 0x03, 0xDA, 0x84, 0xA5, 0xDA, 0x05,
+    0xCE, 0x80, 0x9D, 0x41, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x63,
+    0x6F, 0x6D, 0x62, 0x69, 0x6E, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x75, 0x6E, 0x6D, 0x61,
+    0x72, 0x73, 0x68, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x75,
+    0x6E, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x20, 0x62,
+    0x79, 0x74, 0x65, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E,
+    0x63, 0x65, 0x73, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x64, 0x20, 0x20, 0x62, 0x79, 0x20, 0x6D, 0x61, 0x6B, 0x65,
+    0x2D, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x2E, 0x20, 0x6C, 0x6F,
+    0x61, 0x64, 0x2D, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x75,
+    0x6E, 0x6D, 0x61, 0x72, 0x73, 0x68, 0x61, 0x6C, 0x73, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x74, 0x20, 0x61, 0x66,
+    0x74, 0x65, 0x72, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x69,
+    0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6D, 0x61,
+    0x67, 0x65, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x2E,
+    0xDA, 0x85, 0xD5, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00,
+    0xDA, 0x12, 0x87, 0xDE, 0x01, 0xDA, 0x03, 0xDA, 0x85, 0xFC,
+    0xDA, 0x05, 0xCE, 0x80, 0x85, 0x28, 0x69, 0x6D, 0x70, 0x6F,
+    0x72, 0x74, 0x2A, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x26,
+    0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A, 0x46, 0x75,
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72,
+    0x6D, 0x20, 0x6F, 0x66, 0x20, 0x69, 0x6D, 0x70, 0x6F, 0x72,
+    0x74, 0x2E, 0x20, 0x53, 0x61, 0x6D, 0x65, 0x20, 0x70, 0x61,
+    0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 0x72, 0x73, 0x2C, 0x20,
+    0x62, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61,
+    0x74, 0x68, 0x20, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6F, 0x74,
+    0x68, 0x65, 0x72, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C,
+    0x20, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 0x72,
+    0x73, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62,
+    0x65, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x73, 0x20,
+    0x69, 0x6E, 0x73, 0x74, 0x65, 0x61, 0x64, 0x2E, 0xDA, 0x86,
+    0xB5, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x86, 0xB4, 0xDA, 0x05,
+    0xCE, 0x2A, 0x28, 0x6D, 0x61, 0x74, 0x68, 0x2F, 0x65, 0x78,
+    0x70, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x6F,
+    0x66, 0x20, 0x78, 0x2E, 0xDA, 0x87, 0x2C, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x83, 0x7D, 0xDA, 0x05, 0xCE, 0x81, 0x9F, 0x28,
+    0x66, 0x69, 0x6C, 0x65, 0x2F, 0x72, 0x65, 0x61, 0x64, 0x20,
+    0x66, 0x20, 0x77, 0x68, 0x61, 0x74, 0x20, 0x26, 0x6F, 0x70,
+    0x74, 0x20, 0x62, 0x75, 0x66, 0x73, 0x69, 0x7A, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x61, 0x64, 0x20, 0x61, 0x20, 0x6E, 0x75,
+    0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x62, 0x79,
+    0x74, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61,
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x74, 0x6F,
+    0x20, 0x61, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2E,
+    0x20, 0x41, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20,
+    0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x70, 0x72, 0x6F,
+    0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61,
+    0x6E, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C,
+    0x20, 0x66, 0x6F, 0x75, 0x72, 0x74, 0x68, 0x20, 0x61, 0x72,
+    0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x6F, 0x74,
+    0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x61, 0x20,
+    0x6E, 0x65, 0x77, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72,
+    0x20, 0x69, 0x73, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x64, 0x2E, 0x20, 0x27, 0x77, 0x68, 0x61, 0x74, 0x27, 0x20,
+    0x63, 0x61, 0x6E, 0x20, 0x65, 0x69, 0x74, 0x68, 0x65, 0x72,
+    0x20, 0x62, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74,
+    0x65, 0x67, 0x65, 0x72, 0x20, 0x6F, 0x72, 0x20, 0x61, 0x20,
+    0x6B, 0x65, 0x79, 0x77, 0x6F, 0x72, 0x64, 0x2E, 0x20, 0x52,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x6F,
+    0x6E, 0x74, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x20, 0x56, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x27,
+    0x77, 0x68, 0x61, 0x74, 0x27, 0x3A, 0x0A, 0x0A, 0x09, 0x3A,
+    0x61, 0x6C, 0x6C, 0x20, 0x2D, 0x20, 0x72, 0x65, 0x61, 0x64,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x68, 0x6F, 0x6C, 0x65,
+    0x20, 0x66, 0x69, 0x6C, 0x65, 0x0A, 0x09, 0x3A, 0x6C, 0x69,
+    0x6E, 0x65, 0x20, 0x2D, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20,
+    0x75, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x6E, 0x64, 0x20,
+    0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64, 0x69, 0x6E, 0x67, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x6E,
+    0x65, 0x77, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x63, 0x68, 0x61,
+    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x0A, 0x09, 0x6E, 0x20,
+    0x28, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x29, 0x20,
+    0x2D, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x75, 0x70, 0x20,
+    0x74, 0x6F, 0x20, 0x6E, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x66, 0x69, 0x6C, 0x65, 0xDA, 0x83, 0xDD, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x81, 0x1B, 0xDA, 0x05, 0xCE, 0x66, 0x28, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x2F, 0x70, 0x75, 0x73, 0x68, 0x20,
+    0x61, 0x72, 0x72, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x49, 0x6E,
+    0x73, 0x65, 0x72, 0x74, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20,
+    0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x20,
+    0x4D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72,
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x69, 0x74, 0x2E,
+    0xDA, 0x86, 0x76, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00,
+    0xDA, 0x12, 0x82, 0x25, 0x01, 0xDA, 0x03, 0xDA, 0x86, 0x75,
+    0xDA, 0x05, 0xCE, 0x70, 0x28, 0x63, 0x6F, 0x6D, 0x70, 0x20,
+    0x26, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x73, 0x29, 0x0A, 0x0A, 0x54, 0x61, 0x6B, 0x65, 0x73, 0x20,
+    0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x66,
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x61, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F,
+    0x6E, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6F, 0x73,
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x20, 0x6F, 0x66, 0x20,
+    0x74, 0x68, 0x6F, 0x73, 0x65, 0x20, 0x66, 0x75, 0x6E, 0x63,
+    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0xDA, 0x86, 0x9F, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x86, 0x9E, 0xDA, 0x05, 0xCE, 0x50,
+    0x28, 0x67, 0x63, 0x63, 0x6F, 0x6C, 0x6C, 0x65, 0x63, 0x74,
+    0x29, 0x0A, 0x0A, 0x52, 0x75, 0x6E, 0x20, 0x67, 0x61, 0x72,
+    0x62, 0x61, 0x67, 0x65, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x59, 0x6F, 0x75,
+    0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x70, 0x72,
+    0x6F, 0x62, 0x61, 0x62, 0x6C, 0x79, 0x20, 0x6E, 0x6F, 0x74,
+    0x20, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x69, 0x73,
+    0x20, 0x6D, 0x61, 0x6E, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x2E,
+    0xDA, 0x86, 0xC9, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x82, 0x61,
+    0xDA, 0x05, 0xCE, 0x7B, 0x28, 0x70, 0x72, 0x69, 0x6E, 0x74,
+    0x66, 0x20, 0x66, 0x6D, 0x74, 0x20, 0x26, 0x20, 0x78, 0x73,
+    0x29, 0x0A, 0x0A, 0x50, 0x72, 0x69, 0x6E, 0x74, 0x73, 0x20,
+    0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x20, 0x66, 0x6F, 0x72,
+    0x6D, 0x61, 0x74, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20,
+    0x69, 0x66, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x28, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x6F, 0x72, 0x6D,
+    0x61, 0x74, 0x20, 0x66, 0x6D, 0x74, 0x20, 0x3B, 0x78, 0x73,
+    0x29, 0x20, 0x74, 0x6F, 0x20, 0x28, 0x64, 0x79, 0x6E, 0x20,
+    0x3A, 0x6F, 0x75, 0x74, 0x20, 0x73, 0x74, 0x64, 0x6F, 0x75,
+    0x74, 0x29, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20,
+    0x74, 0x72, 0x61, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x6E,
+    0x65, 0x77, 0x6C, 0x69, 0x6E, 0x65, 0x2E, 0xDA, 0x86, 0x78,
+    0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x55,
+    0x01, 0xDA, 0x03, 0xDA, 0x83, 0x6D, 0xDA, 0x05, 0xCE, 0x24,
+    0x28, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x3F, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69,
+    0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0xDA, 0x86, 0x11, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x86, 0x10, 0xDA, 0x05, 0xCE, 0x80,
+    0xBA, 0x28, 0x69, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x20, 0x64,
+    0x73, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+    0x6F, 0x66, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x73, 0x20, 0x6F, 0x66,
+    0x20, 0x61, 0x6E, 0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69,
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61,
+    0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65,
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76,
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
+    0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B,
+    0x65, 0x79, 0x73, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x6D, 0x75,
+    0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x6B, 0x65, 0x79,
+    0x73, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x2C, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6B, 0x65, 0x79,
+    0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x69,
+    0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x2E, 0xDA, 0x85, 0xAD,
+    0xD3, 0x03, 0xDA, 0x11, 0xDA, 0x53, 0xDA, 0x03, 0xDA, 0x4C,
+    0xDA, 0x05, 0xDA, 0x54, 0xDA, 0x86, 0x88, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x86, 0x87, 0xDA, 0x05, 0xCE, 0x4D, 0x28, 0x6D,
+    0x61, 0x74, 0x68, 0x2F, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D,
+    0x29, 0x0A, 0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x61, 0x20, 0x75, 0x6E, 0x69, 0x66, 0x6F, 0x72, 0x6D,
+    0x6C, 0x79, 0x20, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62,
+    0x75, 0x74, 0x65, 0x64, 0x20, 0x72, 0x61, 0x6E, 0x64, 0x6F,
+    0x6D, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x62,
+    0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x30, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x31, 0x2E, 0xDA, 0x87, 0x3D, 0xD3, 0x03,
+    0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x3D, 0x01, 0xDA,
+    0x03, 0xDA, 0x83, 0x65, 0xDA, 0x05, 0xCE, 0x38, 0x28, 0x64,
+    0x65, 0x66, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x20, 0x6E,
+    0x61, 0x6D, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29,
+    0x0A, 0x0A, 0x44, 0x79, 0x6E, 0x61, 0x6D, 0x69, 0x63, 0x61,
+    0x6C, 0x6C, 0x79, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x20, 0x61, 0x20, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x20,
+    0x64, 0x65, 0x66, 0x2E, 0xDA, 0x87, 0x45, 0xD3, 0x04, 0xDA,
+    0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x80, 0x9F, 0x01, 0xDA,
+    0x03, 0xDA, 0x87, 0x44, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE,
+    0x81, 0x0A, 0x28, 0x63, 0x6F, 0x6E, 0x64, 0x20, 0x26, 0x20,
+    0x70, 0x61, 0x69, 0x72, 0x73, 0x29, 0x0A, 0x0A, 0x45, 0x76,
+    0x61, 0x6C, 0x75, 0x61, 0x74, 0x65, 0x73, 0x20, 0x63, 0x6F,
+    0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x73,
+    0x65, 0x71, 0x75, 0x65, 0x6E, 0x74, 0x69, 0x61, 0x6C, 0x6C,
+    0x79, 0x20, 0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x72,
+    0x75, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69,
+    0x6F, 0x6E, 0x20, 0x20, 0x69, 0x73, 0x20, 0x66, 0x6F, 0x75,
+    0x6E, 0x64, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68,
+    0x65, 0x6E, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x72, 0x72,
+    0x65, 0x73, 0x70, 0x6F, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x20,
+    0x62, 0x6F, 0x64, 0x79, 0x2E, 0x20, 0x49, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x72, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61,
+    0x6E, 0x20, 0x20, 0x6F, 0x64, 0x64, 0x20, 0x6E, 0x75, 0x6D,
+    0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x6F, 0x72,
+    0x6D, 0x73, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x61,
+    0x73, 0x74, 0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73,
+    0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x65, 0x78, 0x65,
+    0x63, 0x75, 0x74, 0x65, 0x64, 0x20, 0x69, 0x66, 0x20, 0x6E,
+    0x6F, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x20, 0x61,
+    0x72, 0x65, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x64,
+    0x2E, 0x20, 0x49, 0x66, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65,
+    0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x20, 0x6D, 0x61,
+    0x74, 0x63, 0x68, 0x65, 0x73, 0x2C, 0x20, 0x72, 0x65, 0x74,
+    0x75, 0x72, 0x6E, 0x20, 0x6E, 0x69, 0x6C, 0x2E, 0xDA, 0x81,
+    0xA0, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x80, 0xC2, 0x01, 0xDA, 0x03, 0xDA, 0x86, 0xDD, 0xDA, 0x24,
+    0xCB, 0xDA, 0x05, 0xCE, 0x80, 0xAA, 0x28, 0x6C, 0x65, 0x74,
+    0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x73, 0x20,
+    0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A, 0x0A, 0x43,
+    0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x73, 0x63,
+    0x6F, 0x70, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x62, 0x69,
+    0x6E, 0x64, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+    0x74, 0x6F, 0x20, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x73,
+    0x2E, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x70, 0x61, 0x69,
+    0x72, 0x20, 0x69, 0x6E, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69,
+    0x6E, 0x67, 0x73, 0x20, 0x69, 0x73, 0x20, 0x20, 0x61, 0x73,
+    0x73, 0x69, 0x67, 0x6E, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20,
+    0x69, 0x66, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x64, 0x65,
+    0x66, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x6C, 0x65, 0x74, 0x20, 0x66, 0x6F, 0x72,
+    0x6D, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0xDA, 0x86, 0x48, 0xD3,
+    0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x5F, 0x01,
+    0xDA, 0x03, 0xDA, 0x83, 0x1B, 0xDA, 0x05, 0xCE, 0x22, 0x28,
+    0x74, 0x75, 0x70, 0x6C, 0x65, 0x3F, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+    0x78, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x74, 0x75, 0x70,
+    0x6C, 0x65, 0x2E, 0xDA, 0x87, 0x07, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x83, 0x7F, 0xDA, 0x05, 0xCE, 0x80, 0x81, 0x28, 0x6F,
+    0x73, 0x2F, 0x65, 0x78, 0x69, 0x74, 0x20, 0x26, 0x6F, 0x70,
+    0x74, 0x20, 0x78, 0x29, 0x0A, 0x0A, 0x45, 0x78, 0x69, 0x74,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x6A, 0x61, 0x6E, 0x65,
+    0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x6E, 0x20,
+    0x65, 0x78, 0x69, 0x74, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x20,
+    0x65, 0x71, 0x75, 0x61, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x78,
+    0x2E, 0x20, 0x49, 0x66, 0x20, 0x78, 0x20, 0x69, 0x73, 0x20,
+    0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6E, 0x74,
+    0x65, 0x67, 0x65, 0x72, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x65, 0x78, 0x69, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
+    0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x65, 0x71, 0x75,
+    0x61, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x68, 0x61, 0x73,
+    0x68, 0x20, 0x6F, 0x66, 0x20, 0x78, 0x2E, 0xDA, 0x87, 0x32,
+    0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x4D,
+    0x01, 0xDA, 0x03, 0xDA, 0x85, 0x2C, 0xDA, 0x05, 0xCE, 0x1E,
+    0x28, 0x65, 0x76, 0x65, 0x6E, 0x3F, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x69, 0x66, 0x20,
+    0x78, 0x20, 0x69, 0x73, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x2E,
+    0xDA, 0x86, 0x47, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00,
+    0xDA, 0x12, 0x83, 0xDA, 0x01, 0xDA, 0x03, 0xDA, 0x86, 0x46,
+    0xDA, 0x05, 0xCE, 0x31, 0x28, 0x70, 0x61, 0x72, 0x74, 0x69,
+    0x61, 0x6C, 0x20, 0x66, 0x20, 0x26, 0x20, 0x6D, 0x6F, 0x72,
+    0x65, 0x29, 0x0A, 0x0A, 0x50, 0x61, 0x72, 0x74, 0x69, 0x61,
+    0x6C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+    0x20, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69,
+    0x6F, 0x6E, 0x2E, 0xDA, 0x86, 0xFE, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x86, 0xFD, 0xDA, 0x05, 0xCE, 0x2D, 0x28, 0x6D, 0x61,
+    0x74, 0x68, 0x2F, 0x61, 0x62, 0x73, 0x20, 0x78, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65,
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F, 0x66, 0x20,
+    0x78, 0x2E, 0xDA, 0x86, 0xDF, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x86, 0xDE, 0xDA, 0x05, 0xCE, 0x80, 0x8A, 0x28, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2F, 0x6E, 0x65, 0x77, 0x2D, 0x66,
+    0x69, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x63, 0x6F, 0x75, 0x6E,
+    0x74, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x6C, 0x65,
+    0x6E, 0x67, 0x74, 0x68, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74,
+    0x20, 0x66, 0x69, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x62, 0x79, 0x74, 0x65, 0x2E, 0x20, 0x42,
+    0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2C,
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x69, 0x73, 0x20, 0x30,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x62, 0x75,
+    0x66, 0x66, 0x65, 0x72, 0x2E, 0xDA, 0x86, 0xA3, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x84, 0xA1, 0xDA, 0x05, 0xCE, 0x75, 0x28,
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2F, 0x66, 0x6F, 0x72,
+    0x6D, 0x61, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
+    0x20, 0x26, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x29,
+    0x0A, 0x0A, 0x53, 0x69, 0x6D, 0x69, 0x6C, 0x61, 0x72, 0x20,
+    0x74, 0x6F, 0x20, 0x73, 0x6E, 0x70, 0x72, 0x69, 0x6E, 0x74,
+    0x66, 0x2C, 0x20, 0x62, 0x75, 0x74, 0x20, 0x73, 0x70, 0x65,
+    0x63, 0x69, 0x61, 0x6C, 0x69, 0x7A, 0x65, 0x64, 0x20, 0x66,
+    0x6F, 0x72, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69,
+    0x6E, 0x67, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6A, 0x61,
+    0x6E, 0x65, 0x74, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x73,
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0xDA, 0x85, 0xD7, 0xD3,
+    0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12, 0x88, 0x2C,
+    0x01, 0xDA, 0x03, 0xDA, 0x86, 0xF1, 0xDA, 0x24, 0xCB, 0xDA,
+    0x05, 0xCE, 0x80, 0x96, 0x28, 0x75, 0x73, 0x65, 0x20, 0x26,
+    0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x29, 0x0A,
+    0x0A, 0x53, 0x69, 0x6D, 0x69, 0x6C, 0x61, 0x72, 0x20, 0x74,
+    0x6F, 0x20, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x2C, 0x20,
+    0x62, 0x75, 0x74, 0x20, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74,
+    0x65, 0x64, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E, 0x67,
+    0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20,
+    0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x65, 0x64, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x6E, 0x61, 0x6D, 0x65,
+    0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x20, 0x69, 0x64, 0x65,
+    0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x2E, 0x20, 0x43,
+    0x61, 0x6E, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x69, 0x6D,
+    0x70, 0x6F, 0x72, 0x74, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69,
+    0x70, 0x6C, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65,
+    0x73, 0x20, 0x69, 0x6E, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x73,
+    0x68, 0x6F, 0x74, 0x2E, 0xDA, 0x87, 0x39, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x87, 0x38, 0xDA, 0x05, 0xCE, 0x5B, 0x28, 0x62,
+    0x61, 0x6E, 0x64, 0x20, 0x26, 0x20, 0x78, 0x73, 0x29, 0x0A,
+    0x0A, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x62, 0x69, 0x74, 0x2D, 0x77, 0x69, 0x73,
+    0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x61,
+    0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+    0x69, 0x6E, 0x20, 0x78, 0x73, 0x2E, 0x20, 0x45, 0x61, 0x63,
+    0x68, 0x20, 0x78, 0x20, 0x69, 0x6E, 0x20, 0x78, 0x73, 0x20,
+    0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x61, 0x6E,
+    0x20, 0x69, 0x6E, 0x74, 0x65, 0x67, 0x65, 0x72, 0x2E, 0xDA,
+    0x86, 0x4E, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x84, 0x77, 0x01, 0xDA, 0x03, 0xDA, 0x84, 0x9D, 0xDA,
+    0x05, 0xCE, 0x50, 0x28, 0x73, 0x6C, 0x75, 0x72, 0x70, 0x20,
+    0x70, 0x61, 0x74, 0x68, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x61,
+    0x64, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x64, 0x61, 0x74, 0x61,
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x61, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6E, 0x61,
+    0x6D, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x20, 0x61,
+    0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x63, 0x6C,
+    0x6F, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69,
+    0x6C, 0x65, 0x2E, 0xDA, 0x87, 0x00, 0xD3, 0x02, 0xDA, 0x03,
+    0xDA, 0x86, 0xFF, 0xDA, 0x05, 0xCE, 0x4D, 0x28, 0x7A, 0x69,
+    0x70, 0x63, 0x6F, 0x6C, 0x6C, 0x20, 0x6B, 0x73, 0x20, 0x76,
+    0x73, 0x29, 0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65,
+    0x73, 0x20, 0x61, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+    0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x77, 0x6F, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x73, 0x2F, 0x74, 0x75, 0x70, 0x6C,
+    0x65, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x2E, 0xDA, 0x87, 0x04, 0xD3, 0x02, 0xDA,
+    0x03, 0xDA, 0x87, 0x03, 0xDA, 0x05, 0xCE, 0x5E, 0x28, 0x62,
+    0x75, 0x66, 0x66, 0x65, 0x72, 0x2F, 0x70, 0x6F, 0x70, 0x6E,
+    0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x6E, 0x29,
+    0x0A, 0x0A, 0x52, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x6E,
+    0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6F,
+    0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69,
+    0x66, 0x69, 0x65, 0x64, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65,
+    0x72, 0x2E, 0xDA, 0x86, 0xAD, 0xD3, 0x04, 0xDA, 0x11, 0xD2,
+    0x03, 0x00, 0xDA, 0x12, 0x80, 0x82, 0x01, 0xDA, 0x03, 0xDA,
+    0x86, 0xAC, 0xDA, 0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x28, 0x28,
+    0x2A, 0x3D, 0x20, 0x78, 0x20, 0x6E, 0x29, 0x0A, 0x0A, 0x53,
+    0x68, 0x6F, 0x72, 0x74, 0x68, 0x61, 0x6E, 0x64, 0x20, 0x66,
+    0x6F, 0x72, 0x20, 0x28, 0x73, 0x65, 0x74, 0x20, 0x78, 0x20,
+    0x28, 0x2A, 0x20, 0x78, 0x20, 0x6E, 0x29, 0x29, 0x2E, 0xDA,
+    0x86, 0xB8, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x81, 0xE3, 0x01, 0xDA, 0x03, 0xDA, 0x86, 0xB7, 0xDA,
+    0x24, 0xCB, 0xDA, 0x05, 0xCE, 0x80, 0xA4, 0x28, 0x67, 0x65,
+    0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x68, 0x65, 0x61,
+    0x64, 0x20, 0x26, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x0A,
+    0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20,
+    0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x6F, 0x72, 0x20,
+    0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E,
+    0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x73, 0x79, 0x6E, 0x74,
+    0x61, 0x78, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E,
+    0x73, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62, 0x65, 0x72, 0x20,
+    0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x79, 0x69, 0x65, 0x6C,
+    0x64, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x76, 0x61, 0x6C,
+    0x75, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x73, 0x69, 0x64, 0x65,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20,
+    0x69, 0x6E, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2E, 0x20,
+    0x53, 0x65, 0x65, 0x20, 0x6C, 0x6F, 0x6F, 0x70, 0x20, 0x66,
+    0x6F, 0x72, 0x20, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6C, 0x73,
+    0x2E, 0xDA, 0x86, 0x94, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x82,
+    0xBE, 0xDA, 0x05, 0xCE, 0x71, 0x28, 0x66, 0x69, 0x62, 0x65,
+    0x72, 0x2F, 0x73, 0x65, 0x74, 0x65, 0x6E, 0x76, 0x20, 0x66,
+    0x69, 0x62, 0x65, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65,
+    0x29, 0x0A, 0x0A, 0x53, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x65, 0x6E, 0x76, 0x69, 0x72, 0x6F, 0x6E, 0x6D,
+    0x65, 0x6E, 0x74, 0x20, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20,
+    0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x66, 0x69, 0x62, 0x65,
+    0x72, 0x2E, 0x20, 0x53, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20,
+    0x6E, 0x69, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x6D,
+    0x6F, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75,
+    0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x65, 0x6E, 0x76, 0x69,
+    0x72, 0x6F, 0x6E, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0xDA, 0x83,
+    0x1C, 0xD3, 0x03, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA, 0x12,
+    0x82, 0xD1, 0x01, 0xDA, 0x03, 0xDA, 0x83, 0x20, 0xDA, 0x05,
+    0xCE, 0x80, 0xDE, 0x28, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20,
+    0x26, 0x20, 0x61, 0x72, 0x67, 0x73, 0x29, 0x0A, 0x0A, 0x43,
+    0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6E, 0x20, 0x61,
+    0x72, 0x72, 0x61, 0x79, 0x20, 0x6F, 0x66, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x5B, 0x73, 0x74, 0x61, 0x72,
+    0x74, 0x2C, 0x20, 0x65, 0x6E, 0x64, 0x29, 0x20, 0x77, 0x69,
+    0x74, 0x68, 0x20, 0x61, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6E,
+    0x20, 0x73, 0x74, 0x65, 0x70, 0x2E, 0x20, 0x20, 0x57, 0x69,
+    0x74, 0x68, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x61, 0x72, 0x67,
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x72, 0x65, 0x74, 0x75,
+    0x72, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x72, 0x61, 0x6E, 0x67,
+    0x65, 0x20, 0x5B, 0x30, 0x2C, 0x20, 0x65, 0x6E, 0x64, 0x29,
+    0x2E, 0x20, 0x57, 0x69, 0x74, 0x68, 0x20, 0x74, 0x77, 0x6F,
+    0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73,
+    0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x20, 0x61, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x5B,
+    0x73, 0x74, 0x61, 0x72, 0x74, 0x2C, 0x20, 0x65, 0x6E, 0x64,
+    0x29, 0x2E, 0x20, 0x57, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68,
+    0x72, 0x65, 0x65, 0x2C, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+    0x6E, 0x73, 0x20, 0x61, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65,
+    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6F, 0x70, 0x74, 0x69,
+    0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x73, 0x74, 0x65, 0x70, 0x20,
+    0x73, 0x69, 0x7A, 0x65, 0x2E, 0xDA, 0x86, 0x56, 0xD3, 0x02,
+    0xDA, 0x03, 0xDA, 0x86, 0x55, 0xDA, 0x05, 0xCE, 0x7F, 0x28,
+    0x6F, 0x73, 0x2F, 0x61, 0x72, 0x63, 0x68, 0x29, 0x0A, 0x0A,
+    0x43, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x49, 0x53, 0x41, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6A,
+    0x61, 0x6E, 0x65, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x63,
+    0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x66, 0x6F,
+    0x72, 0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73,
+    0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6F, 0x66, 0x3A, 0x0A, 0x0A,
+    0x09, 0x3A, 0x78, 0x38, 0x36, 0x0A, 0x09, 0x3A, 0x78, 0x38,
+    0x36, 0x2D, 0x36, 0x34, 0x0A, 0x09, 0x3A, 0x61, 0x72, 0x6D,
+    0x0A, 0x09, 0x3A, 0x61, 0x61, 0x72, 0x63, 0x68, 0x36, 0x34,
+    0x0A, 0x09, 0x3A, 0x73, 0x70, 0x61, 0x72, 0x63, 0x0A, 0x09,
+    0x3A, 0x77, 0x61, 0x73, 0x6D, 0x0A, 0x09, 0x3A, 0x75, 0x6E,
+    0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x0A, 0xDA, 0x87, 0x27, 0xD3,
+    0x02, 0xDA, 0x03, 0xDA, 0x87, 0x26, 0xDA, 0x05, 0xCE, 0x3C,
+    0x28, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x78, 0x29,
+    0x0A, 0x0A, 0x47, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20,
+    0x61, 0x6E, 0x20, 0x61, 0x73, 0x73, 0x6F, 0x63, 0x69, 0x61,
+    0x74, 0x69, 0x76, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20,
+    0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x2E,
+    0xDA, 0x86, 0x3B, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x86, 0x3A,
+    0xDA, 0x05, 0xCE, 0x80, 0xA7, 0x28, 0x6D, 0x65, 0x72, 0x67,
+    0x65, 0x20, 0x26, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x73, 0x29,
+    0x0A, 0x0A, 0x4D, 0x65, 0x72, 0x67, 0x65, 0x73, 0x20, 0x6D,
+    0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x74, 0x61,
+    0x62, 0x6C, 0x65, 0x73, 0x2F, 0x73, 0x74, 0x72, 0x75, 0x63,
+    0x74, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x6F, 0x6E, 0x65, 0x2E,
+    0x20, 0x49, 0x66, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x79, 0x20,
+    0x61, 0x70, 0x70, 0x65, 0x61, 0x72, 0x73, 0x20, 0x69, 0x6E,
+    0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6E,
+    0x20, 0x6F, 0x6E, 0x65, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65,
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x74, 0x68, 0x65,
+    0x6E, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x72, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x73, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61,
+    0x63, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x70, 0x72, 0x65,
+    0x76, 0x69, 0x6F, 0x75, 0x73, 0x20, 0x6F, 0x6E, 0x65, 0x73,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x74, 0x61, 0x62, 0x6C,
+    0x65, 0x2E, 0xDA, 0x86, 0x3D, 0xD3, 0x02, 0xDA, 0x03, 0xDA,
+    0x86, 0x3C, 0xDA, 0x05, 0xCE, 0x80, 0xA2, 0x28, 0x61, 0x72,
+    0x72, 0x61, 0x79, 0x2F, 0x66, 0x69, 0x6C, 0x6C, 0x20, 0x61,
+    0x72, 0x72, 0x20, 0x26, 0x6F, 0x70, 0x74, 0x20, 0x76, 0x61,
+    0x6C, 0x75, 0x65, 0x29, 0x0A, 0x0A, 0x52, 0x65, 0x70, 0x6C,
+    0x61, 0x63, 0x65, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x65, 0x6C,
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x6F, 0x66, 0x20,
+    0x61, 0x6E, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x20, 0x77,
+    0x69, 0x74, 0x68, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20,
+    0x28, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x69, 0x6E,
+    0x67, 0x20, 0x74, 0x6F, 0x20, 0x6E, 0x69, 0x6C, 0x29, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x63, 0x68,
+    0x61, 0x6E, 0x67, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x6F, 0x66,
+    0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79,
+    0x2E, 0x20, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x6D, 0x6F, 0x64, 0x69, 0x66, 0x69,
+    0x65, 0x64, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x2E, 0xDA,
+    0x86, 0xB0, 0xD3, 0x04, 0xDA, 0x11, 0xD2, 0x03, 0x00, 0xDA,
+    0x12, 0x7E, 0x01, 0xDA, 0x03, 0xDA, 0x87, 0x36, 0xDA, 0x24,
+    0xCB, 0xDA, 0x05, 0xCE, 0x22, 0x28, 0x2B, 0x2B, 0x20, 0x78,
+    0x29, 0x0A, 0x0A, 0x49, 0x6E, 0x63, 0x72, 0x65, 0x6D, 0x65,
+    0x6E, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61,
+    0x72, 0x20, 0x78, 0x20, 0x62, 0x79, 0x20, 0x31, 0x2E, 0xDA,
+    0x86, 0x9C, 0xD3, 0x02, 0xDA, 0x03, 0xDA, 0x81, 0x5A, 0xDA,
+    0x05, 0xCE, 0x80, 0xA7, 0x28, 0x73, 0x74, 0x72, 0x69, 0x6E,
+    0x67, 0x20, 0x26, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x29,
+    0x0A, 0x0A, 0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x73, 0x20,
+    0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x62,
+    0x79, 0x20, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x65, 0x6E,
+    0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x76, 0x61, 0x6C, 0x75,
+    0x65, 0x73, 0x20, 0x74, 0x6F, 0x67, 0x65, 0x74, 0x68, 0x65,
+    0x72, 0x2E, 0x20, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20,
+    0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72,
+    0x74, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x79, 0x74,
+    0x65, 0x73, 0x20, 0x76, 0x69, 0x61, 0x20, 0x64, 0x65, 0x73,
+    0x63, 0x72, 0x69, 0x62, 0x65, 0x20, 0x69, 0x66, 0x20, 0x74,
+    0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F,
+    0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x73, 0x65, 0x71,
+    0x75, 0x65, 0x6E, 0x63, 0x65, 0x73, 0x2E, 0x20, 0x52, 0x65,
+    0x74, 0x75, 0x72, 0x6E, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6E, 0x65, 0x77, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67,
+    0x2E,
+    0
+};
+
+const unsigned char *janet_core_image = janet_core_image_bytes;
+size_t janet_core_image_size = sizeof(janet_core_image_bytes);
@@ -59,4 +59,10 @@
 /* #define JANET_OS_NAME my-custom-os */
 /* #define JANET_ARCH_NAME pdp-8 */
 
+/* Custom allocator */
+/* #define janet_malloc(X) malloc((X)) */
+/* #define janet_realloc(X, Y) realloc((X), (Y)) */
+/* #define janet_calloc(X, Y) calloc((X), (Y)) */
+/* #define janet_free(X) free((X)) */
+
 #endif /* end of include guard: JANETCONF_H */
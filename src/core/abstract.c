@@ -42,3 +42,12 @@ void *janet_abstract_end(void *x) {
 void *janet_abstract(const JanetAbstractType *atype, size_t size) {
     return janet_abstract_end(janet_abstract_begin(atype, size));
 }
+
+/* Create new userdata whose gc callback does not run during the collection
+ * pause. Use for finalizers that are slow, such as ones that flush and close
+ * files. The callback must not touch other garbage collected memory. */
+void *janet_abstract_deferred(const JanetAbstractType *atype, size_t size) {
+    void *x = janet_abstract_begin(atype, size);
+    janet_abstract_head(x)->gc.flags |= JANET_ABSTRACT_FLAG_DEFERRED;
+    return janet_abstract_end(x);
+}
@@ -27,12 +27,16 @@
 #include "state.h"
 #endif
 
-/* Initialize a buffer */
-JanetBuffer *janet_buffer_init(JanetBuffer *buffer, int32_t capacity) {
+/* Only buffers on the garbage collected heap count towards the heap limit.
+ * Buffers made with janet_buffer_init live outside of it, often on the C
+ * stack, and raising an error while growing them would leak their data. */
+#define janet_buffer_onheap(b) (((b)->gc.flags & JANET_MEM_TYPEBITS) == JANET_MEMORY_BUFFER)
+
+static JanetBuffer *janet_buffer_initdata(JanetBuffer *buffer, int32_t capacity) {
     uint8_t *data = NULL;
     if (capacity > 0) {
         janet_vm_next_collection += capacity;
-        data = malloc(sizeof(uint8_t) * capacity);
+        data = janet_malloc(sizeof(uint8_t) * capacity);
         if (NULL == data) {
             JANET_OUT_OF_MEMORY;
         }
@@ -43,15 +47,24 @@ JanetBuffer *janet_buffer_init(JanetBuffer *buffer, int32_t capacity) {
     return buffer;
 }
 
+/* Initialize a buffer */
+JanetBuffer *janet_buffer_init(JanetBuffer *buffer, int32_t capacity) {
+    buffer->gc.flags = 0;
+    buffer->gc.next = NULL;
+    return janet_buffer_initdata(buffer, capacity);
+}
+
 /* Deinitialize a buffer (free data memory) */
 void janet_buffer_deinit(JanetBuffer *buffer) {
-    free(buffer->data);
+    janet_free(buffer->data);
 }
 
 /* Initialize a buffer */
 JanetBuffer *janet_buffer(int32_t capacity) {
+    /* Check the data too, so a new buffer is never left uninitialized */
+    janet_gccheck(sizeof(JanetBuffer) + (capacity > 0 ? capacity : 0));
     JanetBuffer *buffer = janet_gcalloc(JANET_MEMORY_BUFFER, sizeof(JanetBuffer));
-    return janet_buffer_init(buffer, capacity);
+    return janet_buffer_initdata(buffer, capacity);
 }
 
 /* Ensure that the buffer has enough internal capacity */
@@ -61,8 +74,10 @@ void janet_buffer_ensure(JanetBuffer *buffer, int32_t capacity, int32_t growth)
     if (capacity <= buffer->capacity) return;
     int64_t big_capacity = ((int64_t) capacity) * growth;
     capacity = big_capacity > INT32_MAX ? INT32_MAX : (int32_t) big_capacity;
+    if (janet_buffer_onheap(buffer))
+        janet_gccheck(capacity - buffer->capacity);
     janet_vm_next_collection += capacity - buffer->capacity;
-    new_data = realloc(old, capacity * sizeof(uint8_t));
+    new_data = janet_realloc(old, capacity * sizeof(uint8_t));
     if (NULL == new_data) {
         JANET_OUT_OF_MEMORY;
     }
@@ -92,7 +107,9 @@ void janet_buffer_extra(JanetBuffer *buffer, int32_t n) {
     int32_t new_size = buffer->count + n;
     if (new_size > buffer->capacity) {
         int32_t new_capacity = new_size * 2;
-        uint8_t *new_data = realloc(buffer->data, new_capacity * sizeof(uint8_t));
+        if (janet_buffer_onheap(buffer))
+            janet_gccheck(new_capacity - buffer->capacity);
+        uint8_t *new_data = janet_realloc(buffer->data, new_capacity * sizeof(uint8_t));
         janet_vm_next_collection += new_capacity - buffer->capacity;
         if (NULL == new_data) {
             JANET_OUT_OF_MEMORY;
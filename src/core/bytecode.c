@@ -97,9 +97,31 @@ enum JanetInstructionType janet_instructions[JOP_INSTRUCTION_COUNT] = {
     JINT_SSS, /* JOP_NUMERIC_LESS_THAN_EQUAL */
     JINT_SSS, /* JOP_NUMERIC_GREATER_THAN */
     JINT_SSS, /* JOP_NUMERIC_GREATER_THAN_EQUAL */
-    JINT_SSS /* JOP_NUMERIC_EQUAL */
+    JINT_SSS, /* JOP_NUMERIC_EQUAL */
+    JINT_SS, /* JOP_PROTECTED_CALL */
+    JINT_SC /* JOP_JUMP_TABLE */
 };
 
+/* Check that the constant of a jump table is a struct mapping keys to
+ * branch indices, and that the branches and fallback are in bounds. */
+static int verify_jump_table(JanetFuncDef *def, int32_t i) {
+    int32_t cindex = (int32_t)(def->bytecode[i] >> 16);
+    if (cindex >= def->constants_length) return 1;
+    Janet table = def->constants[cindex];
+    if (!janet_checktype(table, JANET_STRUCT)) return 1;
+    const JanetKV *st = janet_unwrap_struct(table);
+    int32_t n = janet_struct_length(st);
+    if (i + 1 + n >= def->bytecode_length) return 1;
+    for (int32_t j = 0; j < janet_struct_capacity(st); j++) {
+        if (janet_checktype(st[j].key, JANET_NIL)) continue;
+        Janet v = st[j].value;
+        if (!janet_checkint(v)) return 1;
+        int32_t index = janet_unwrap_integer(v);
+        if (index < 0 || index >= n) return 1;
+    }
+    return 0;
+}
+
 /* Verify some bytecode */
 int32_t janet_verify(JanetFuncDef *def) {
     int vargs = !!(def->flags & JANET_FUNCDEF_FLAG_VARARG);
@@ -119,6 +141,9 @@ int32_t janet_verify(JanetFuncDef *def) {
             return 3;
         }
         enum JanetInstructionType type = janet_instructions[instr & 0x7F];
+        if ((instr & 0x7F) == JOP_JUMP_TABLE && verify_jump_table(def, i)) {
+            return 5;
+        }
         switch (type) {
             case JINT_0:
                 continue;
@@ -216,6 +241,8 @@ JanetFuncDef *janet_funcdef_alloc(void) {
     def->max_arity = INT32_MAX;
     def->source = NULL;
     def->sourcemap = NULL;
+    def->sourcemap_packed = NULL;
+    def->sourcemap_length = 0;
     def->name = NULL;
     def->defs = NULL;
     def->defs_length = 0;
@@ -225,6 +252,163 @@ JanetFuncDef *janet_funcdef_alloc(void) {
     return def;
 }
 
+/* Sourcemaps are packed as runs of instructions that share a mapping. Each
+ * run is stored as its length followed by the change in line and column from
+ * the previous run, as variable length integers. Deltas are zigzag encoded
+ * so small negative changes stay small. Funcdefs built from C may still set
+ * the unpacked sourcemap field instead, which the functions below fall back
+ * to. */
+
+static int32_t sourcemap_intsize(uint32_t x) {
+    int32_t size = 1;
+    while (x >= 0x80) {
+        x >>= 7;
+        size++;
+    }
+    return size;
+}
+
+static uint8_t *sourcemap_pushint(uint8_t *p, uint32_t x) {
+    while (x >= 0x80) {
+        *p++ = (uint8_t)(x | 0x80);
+        x >>= 7;
+    }
+    *p++ = (uint8_t) x;
+    return p;
+}
+
+static int sourcemap_readint(const uint8_t **p, const uint8_t *end, uint32_t *x) {
+    uint32_t ret = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        if (*p >= end) return 0;
+        uint8_t byte = *(*p)++;
+        ret |= (uint32_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            *x = ret;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static uint32_t sourcemap_zigzag(uint32_t delta) {
+    return (delta << 1) ^ (uint32_t)((int32_t) delta >> 31);
+}
+
+static uint32_t sourcemap_unzigzag(uint32_t x) {
+    return (x >> 1) ^ (0 - (x & 1));
+}
+
+/* Read the next run of a packed sourcemap. Returns 0 at the end of the map
+ * or on malformed data. */
+static int sourcemap_next(const uint8_t **p, const uint8_t *end,
+                          uint32_t *count, JanetSourceMapping *mapping) {
+    uint32_t dline, dcolumn;
+    if (!sourcemap_readint(p, end, count) ||
+            !sourcemap_readint(p, end, &dline) ||
+            !sourcemap_readint(p, end, &dcolumn)) {
+        return 0;
+    }
+    mapping->line = (int32_t)((uint32_t) mapping->line + sourcemap_unzigzag(dline));
+    mapping->column = (int32_t)((uint32_t) mapping->column + sourcemap_unzigzag(dcolumn));
+    return 1;
+}
+
+/* Set the sourcemap of a funcdef from one mapping per instruction. Replaces
+ * any unpacked sourcemap, which may itself be passed as mappings. */
+void janet_sourcemap_pack(JanetFuncDef *def, const JanetSourceMapping *mappings) {
+    int32_t n = def->bytecode_length;
+    int32_t size = 0;
+    janet_free(def->sourcemap_packed);
+    def->sourcemap_packed = NULL;
+    def->sourcemap_length = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        uint8_t *p = def->sourcemap_packed;
+        JanetSourceMapping last = {0, 0};
+        int32_t i = 0;
+        while (i < n) {
+            JanetSourceMapping m = mappings[i];
+            int32_t j = i + 1;
+            while (j < n && mappings[j].line == m.line && mappings[j].column == m.column) j++;
+            uint32_t count = (uint32_t)(j - i);
+            uint32_t dline = sourcemap_zigzag((uint32_t) m.line - (uint32_t) last.line);
+            uint32_t dcolumn = sourcemap_zigzag((uint32_t) m.column - (uint32_t) last.column);
+            if (pass) {
+                p = sourcemap_pushint(p, count);
+                p = sourcemap_pushint(p, dline);
+                p = sourcemap_pushint(p, dcolumn);
+            } else {
+                size += sourcemap_intsize(count) + sourcemap_intsize(dline) + sourcemap_intsize(dcolumn);
+            }
+            last = m;
+            i = j;
+        }
+        if (!pass) {
+            if (!size) break;
+            def->sourcemap_packed = janet_malloc(size);
+            if (NULL == def->sourcemap_packed) {
+                JANET_OUT_OF_MEMORY;
+            }
+            def->sourcemap_length = size;
+        }
+    }
+    janet_free(def->sourcemap);
+    def->sourcemap = NULL;
+}
+
+/* Look up the source mapping of one instruction. Returns 0 if the funcdef
+ * has no sourcemap or pc is not covered by it. */
+int janet_sourcemap_get(JanetFuncDef *def, int32_t pc, JanetSourceMapping *out) {
+    if (pc < 0) return 0;
+    if (NULL == def->sourcemap_packed) {
+        if (NULL == def->sourcemap || pc >= def->bytecode_length) return 0;
+        *out = def->sourcemap[pc];
+        return 1;
+    }
+    const uint8_t *p = def->sourcemap_packed;
+    const uint8_t *end = p + def->sourcemap_length;
+    JanetSourceMapping mapping = {0, 0};
+    uint32_t start = 0, count;
+    while (sourcemap_next(&p, end, &count, &mapping)) {
+        if ((uint32_t) pc - start < count) {
+            *out = mapping;
+            return 1;
+        }
+        start += count;
+    }
+    return 0;
+}
+
+/* Decode the whole sourcemap of a funcdef into one mapping per instruction.
+ * The result must be freed by the caller. Returns NULL if the funcdef has no
+ * sourcemap or it does not cover all of the bytecode. */
+JanetSourceMapping *janet_sourcemap_unpack(JanetFuncDef *def) {
+    int32_t n = def->bytecode_length;
+    if (NULL == def->sourcemap_packed && NULL == def->sourcemap) return NULL;
+    if (n <= 0) return NULL;
+    JanetSourceMapping *mappings = janet_malloc(sizeof(JanetSourceMapping) * n);
+    if (NULL == mappings) {
+        JANET_OUT_OF_MEMORY;
+    }
+    if (NULL == def->sourcemap_packed) {
+        memcpy(mappings, def->sourcemap, sizeof(JanetSourceMapping) * n);
+        return mappings;
+    }
+    const uint8_t *p = def->sourcemap_packed;
+    const uint8_t *end = p + def->sourcemap_length;
+    JanetSourceMapping mapping = {0, 0};
+    int32_t i = 0;
+    uint32_t count;
+    while (i < n && sourcemap_next(&p, end, &count, &mapping)) {
+        while (count-- && i < n) mappings[i++] = mapping;
+    }
+    if (i < n) {
+        janet_free(mappings);
+        return NULL;
+    }
+    return mappings;
+}
+
 /* Create a simple closure from a funcdef */
 JanetFunction *janet_thunk(JanetFuncDef *def) {
     JanetFunction *func = janet_gcalloc(JANET_MEMORY_FUNCTION, sizeof(JanetFunction));
@@ -24,6 +24,7 @@
 #include <janet.h>
 #include "state.h"
 #include "fiber.h"
+#include "util.h"
 #endif
 
 void janet_panicv(Janet message) {
@@ -50,8 +51,7 @@ void janet_panicf(const char *format, ...) {
     va_start(args, format);
     janet_formatb(&buffer, format, args);
     va_end(args);
-    ret = janet_string(buffer.data, buffer.count);
-    janet_buffer_deinit(&buffer);
+    ret = janet_string_frombuffer(&buffer);
     janet_panics(ret);
 }
 
@@ -300,10 +300,76 @@ JanetRange janet_getslice(int32_t argc, const Janet *argv) {
     return range;
 }
 
+/* Dynamic binding cache. Lookups of dynamic bindings go through the
+ * whole prototype chain of the fiber's environment, so cache the results
+ * keyed by environment table and keyword. Every table consulted for a
+ * cached lookup is flagged, and mutating a flagged table (or collecting
+ * garbage) moves the cache to a new epoch, invalidating all entries. */
+
+#define JANET_DYN_CACHE_SIZE 64
+
+typedef struct {
+    JanetTable *env;
+    const uint8_t *key;
+    const char *name;
+    Janet value;
+    uint32_t epoch;
+} JanetDynCacheEntry;
+
+static JANET_THREAD_LOCAL JanetDynCacheEntry janet_dyn_cache[JANET_DYN_CACHE_SIZE];
+static JANET_THREAD_LOCAL uint32_t janet_vm_dyn_epoch = 1;
+
+void janet_dyn_invalidate(void) {
+    if (++janet_vm_dyn_epoch == 0) {
+        memset(janet_dyn_cache, 0, sizeof(janet_dyn_cache));
+        janet_vm_dyn_epoch = 1;
+    }
+}
+
+#define janet_dyn_slot(env, h) \
+    (janet_dyn_cache + (((uint32_t)(h) ^ (uint32_t)((uintptr_t)(env) >> 4)) & (JANET_DYN_CACHE_SIZE - 1)))
+
+/* Look up a keyword in the environment and fill a cache entry */
+static Janet janet_dyn_fill(JanetDynCacheEntry *entry, JanetTable *env, const uint8_t *kw, const char *name) {
+    Janet value = janet_table_get(env, janet_wrap_keyword(kw));
+    JanetTable *t = env;
+    for (int i = JANET_MAX_PROTO_DEPTH + 1; t && i; t = t->proto, --i) {
+        t->gc.flags |= JANET_TABLE_FLAG_DYNAMIC;
+    }
+    entry->env = env;
+    entry->key = kw;
+    entry->name = name;
+    entry->value = value;
+    entry->epoch = janet_vm_dyn_epoch;
+    return value;
+}
+
+/* Get a dynamic binding from an environment table */
+Janet janet_dyn_lookup(JanetTable *env, Janet key) {
+    if (!janet_checktype(key, JANET_KEYWORD)) {
+        return janet_table_get(env, key);
+    }
+    const uint8_t *kw = janet_unwrap_keyword(key);
+    JanetDynCacheEntry *entry = janet_dyn_slot(env, janet_string_hash(kw));
+    if (entry->epoch == janet_vm_dyn_epoch && entry->env == env && entry->key == kw) {
+        return entry->value;
+    }
+    return janet_dyn_fill(entry, env, kw, NULL);
+}
+
 Janet janet_dyn(const char *name) {
     if (!janet_vm_fiber) return janet_wrap_nil();
-    if (janet_vm_fiber->env) {
-        return janet_table_get(janet_vm_fiber->env, janet_ckeywordv(name));
+    JanetTable *env = janet_vm_fiber->env;
+    if (env) {
+        /* Check by name first to avoid interning the keyword */
+        JanetDynCacheEntry *entry = janet_dyn_slot(env, (uintptr_t) name >> 3);
+        if (entry->epoch == janet_vm_dyn_epoch &&
+                entry->env == env &&
+                entry->name == name &&
+                !janet_cstrcmp(entry->key, name)) {
+            return entry->value;
+        }
+        return janet_dyn_fill(entry, env, janet_ckeyword(name), name);
     } else {
         return janet_wrap_nil();
     }
@@ -217,7 +217,7 @@ static JanetSlot compreduce(
         janetc_emit_sss(c, op, t, args[i - 1], args[i], 1);
         if (i != (len - 1)) {
             int32_t label = janetc_emit_si(c, JOP_JUMP_IF_NOT, t, 0, 1);
-            janet_v_push(labels, label);
+            janet_v_apush(&c->arena, labels, label);
         }
     }
     int32_t end = janet_v_count(c->buffer);
@@ -231,7 +231,7 @@ static JanetSlot compreduce(
         int32_t label = labels[i];
         c->buffer[label] |= ((end - label) << 16);
     }
-    janet_v_free(labels);
+    janet_v_afree(&c->arena, labels);
     return t;
 }
 
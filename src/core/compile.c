@@ -66,7 +66,7 @@ void janetc_nameslot(JanetCompiler *c, const uint8_t *sym, JanetSlot s) {
     sp.slot = s;
     sp.keep = 0;
     sp.slot.flags |= JANET_SLOT_NAMED;
-    janet_v_push(c->scope->syms, sp);
+    janet_v_apush(&c->arena, c->scope->syms, sp);
 }
 
 /* Create a slot with a constant */
@@ -105,7 +105,7 @@ void janetc_scope(JanetScope *s, JanetCompiler *c, int flags, const char *name)
     if ((!(flags & JANET_SCOPE_FUNCTION)) && c->scope) {
         janetc_regalloc_clone(&scope.ra, &(c->scope->ra));
     } else {
-        janetc_regalloc_init(&scope.ra);
+        janetc_regalloc_init(&scope.ra, &c->arena);
     }
     /* Link parent and child and update pointer */
     if (c->scope)
@@ -136,18 +136,18 @@ void janetc_popscope(JanetCompiler *c) {
             if (pair.keep) {
                 /* The variable should not be lexically accessible */
                 pair.sym = NULL;
-                janet_v_push(newscope->syms, pair);
+                janet_v_apush(&c->arena, newscope->syms, pair);
                 janetc_regalloc_touch(&newscope->ra, pair.slot.index);
             }
         }
 
     }
     /* Free the old scope */
-    janet_v_free(oldscope->consts);
-    janet_v_free(oldscope->syms);
-    janet_v_free(oldscope->envs);
-    janet_v_free(oldscope->defs);
     janetc_regalloc_deinit(&oldscope->ra);
+    janet_v_afree(&c->arena, oldscope->defs);
+    janet_v_afree(&c->arena, oldscope->envs);
+    janet_v_afree(&c->arena, oldscope->syms);
+    janet_v_afree(&c->arena, oldscope->consts);
     /* Update pointer */
     if (newscope)
         newscope->child = NULL;
@@ -255,7 +255,7 @@ found:
             /* Add the environment if it is not already referenced */
             if (!scopefound) {
                 len = janet_v_count(scope->envs);
-                janet_v_push(scope->envs, envindex);
+                janet_v_apush(&c->arena, scope->envs, envindex);
                 envindex = len;
             }
         }
@@ -300,7 +300,7 @@ JanetSlot *janetc_toslots(JanetCompiler *c, const Janet *vals, int32_t len) {
     JanetSlot *ret = NULL;
     JanetFopts subopts = janetc_fopts_default(c);
     for (i = 0; i < len; i++) {
-        janet_v_push(ret, janetc_value(subopts, vals[i]));
+        janet_v_apush(&c->arena, ret, janetc_value(subopts, vals[i]));
     }
     return ret;
 }
@@ -314,8 +314,8 @@ JanetSlot *janetc_toslotskv(JanetCompiler *c, Janet ds) {
     janet_dictionary_view(ds, &kvs, &len, &cap);
     for (int32_t i = 0; i < cap; i++) {
         if (janet_checktype(kvs[i].key, JANET_NIL)) continue;
-        janet_v_push(ret, janetc_value(subopts, kvs[i].key));
-        janet_v_push(ret, janetc_value(subopts, kvs[i].value));
+        janet_v_apush(&c->arena, ret, janetc_value(subopts, kvs[i].key));
+        janet_v_apush(&c->arena, ret, janetc_value(subopts, kvs[i].value));
     }
     return ret;
 }
@@ -378,7 +378,7 @@ void janetc_freeslots(JanetCompiler *c, JanetSlot *slots) {
     for (i = 0; i < janet_v_count(slots); i++) {
         janetc_freeslot(c, slots[i]);
     }
-    janet_v_free(slots);
+    janet_v_afree(&c->arena, slots);
 }
 
 /* Compile some code that will be thrown away. Used to ensure
@@ -705,25 +705,21 @@ JanetFuncDef *janetc_pop_funcdef(JanetCompiler *c) {
     def->bytecode_length = janet_v_count(c->buffer) - scope->bytecode_start;
     if (def->bytecode_length) {
         size_t s = sizeof(int32_t) * def->bytecode_length;
-        def->bytecode = malloc(s);
+        def->bytecode = janet_malloc(s);
         if (NULL == def->bytecode) {
             JANET_OUT_OF_MEMORY;
         }
         memcpy(def->bytecode, c->buffer + scope->bytecode_start, s);
         janet_v__cnt(c->buffer) = scope->bytecode_start;
         if (NULL != c->mapbuffer && c->source) {
-            size_t s = sizeof(JanetSourceMapping) * def->bytecode_length;
-            def->sourcemap = malloc(s);
-            if (NULL == def->sourcemap) {
-                JANET_OUT_OF_MEMORY;
-            }
-            memcpy(def->sourcemap, c->mapbuffer + scope->bytecode_start, s);
+            janet_sourcemap_pack(def, c->mapbuffer + scope->bytecode_start);
             janet_v__cnt(c->mapbuffer) = scope->bytecode_start;
         }
     }
 
     /* Get source from parser */
     def->source = c->source;
+    janet_srcindex_add(def);
 
     def->arity = 0;
     def->min_arity = 0;
@@ -743,6 +739,7 @@ static void janetc_init(JanetCompiler *c, JanetTable *env, const uint8_t *where)
     c->scope = NULL;
     c->buffer = NULL;
     c->mapbuffer = NULL;
+    janet_arena_init(&c->arena, c->arena_block, sizeof(c->arena_block));
     c->recursion_guard = JANET_RECURSION_GUARD;
     c->env = env;
     c->source = where;
@@ -759,8 +756,9 @@ static void janetc_init(JanetCompiler *c, JanetTable *env, const uint8_t *where)
 
 /* Deinitialize a compiler struct */
 static void janetc_deinit(JanetCompiler *c) {
-    janet_v_free(c->buffer);
-    janet_v_free(c->mapbuffer);
+    janet_arena_deinit(&c->arena);
+    c->buffer = NULL;
+    c->mapbuffer = NULL;
     c->env = NULL;
 }
 
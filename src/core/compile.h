@@ -138,6 +138,9 @@ struct JanetScope {
     int flags;
 };
 
+/* Bytes of arena memory held directly in the compiler state */
+#define JANET_COMPILER_ARENA 2048
+
 /* Compilation state */
 struct JanetCompiler {
 
@@ -147,6 +150,11 @@ struct JanetCompiler {
     uint32_t *buffer;
     JanetSourceMapping *mapbuffer;
 
+    /* Temporary memory for this compilation, freed by janetc_deinit. Most
+     * forms fit in the first block, which lives in the compiler itself. */
+    JanetArena arena;
+    uint64_t arena_block[JANET_COMPILER_ARENA / sizeof(uint64_t)];
+
     /* Hold the environment */
     JanetTable *env;
 
@@ -23,9 +23,12 @@
 #ifndef JANET_AMALG
 #include <janet.h>
 #include <math.h>
+#include <string.h>
 #include "compile.h"
+#include "gc.h"
 #include "state.h"
 #include "util.h"
+#include "vector.h"
 #endif
 
 /* Generated bytes */
@@ -250,7 +253,7 @@ static Janet janet_core_dyn(int32_t argc, Janet *argv) {
     janet_arity(argc, 1, 2);
     Janet value;
     if (janet_vm_fiber->env) {
-        value = janet_table_get(janet_vm_fiber->env, argv[0]);
+        value = janet_dyn_lookup(janet_vm_fiber->env, argv[0]);
     } else {
         value = janet_wrap_nil();
     }
@@ -405,6 +408,7 @@ static Janet janet_core_gcsetinterval(int32_t argc, Janet *argv) {
     if (val < 0)
         janet_panic("expected non-negative integer");
     janet_vm_gc_interval = val;
+    janet_gc_settrigger();
     return janet_wrap_nil();
 }
 
@@ -414,6 +418,64 @@ static Janet janet_core_gcinterval(int32_t argc, Janet *argv) {
     return janet_wrap_number(janet_vm_gc_interval);
 }
 
+static Janet janet_core_gcsetlimit(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    janet_gcsetlimit(janet_checktype(argv[0], JANET_NIL) ? 0 : janet_getsize(argv, 0));
+    return janet_wrap_nil();
+}
+
+static Janet janet_core_gclimit(int32_t argc, Janet *argv) {
+    (void) argv;
+    janet_fixarity(argc, 0);
+    if (!janet_vm_heap_limit) return janet_wrap_nil();
+    return janet_wrap_number((double) janet_vm_heap_limit);
+}
+
+static Janet janet_core_gcsetthreads(int32_t argc, Janet *argv) {
+    janet_arity(argc, 1, 2);
+    int32_t val = janet_getinteger(argv, 0);
+    if (val < 1 || val > 256)
+        janet_panic("expected integer in range [1, 256]");
+    janet_vm_gc_threads = val;
+    if (argc > 1) {
+        int32_t min = janet_getinteger(argv, 1);
+        if (min < 0) janet_panic("expected non-negative block count");
+        janet_vm_gc_parallel_min = (uint32_t) min;
+    }
+    return janet_wrap_nil();
+}
+
+static Janet janet_core_gcthreads(int32_t argc, Janet *argv) {
+    (void) argv;
+    janet_fixarity(argc, 0);
+    return janet_wrap_number(janet_vm_gc_threads);
+}
+
+static Janet janet_core_gcstats(int32_t argc, Janet *argv) {
+    (void) argv;
+    janet_fixarity(argc, 0);
+    int32_t blocks = 0, fibers = 0;
+    double fiber_bytes = 0;
+    for (JanetGCObject *mem = janet_vm_blocks; NULL != mem; mem = mem->next) {
+        blocks++;
+        if ((mem->flags & JANET_MEM_TYPEBITS) == JANET_MEMORY_FIBER) {
+            fibers++;
+            fiber_bytes += (double) sizeof(Janet) * ((JanetFiber *) mem)->capacity;
+        }
+    }
+    JanetKV *st = janet_struct_begin(9);
+    janet_struct_put(st, janet_ckeywordv("blocks"), janet_wrap_integer(blocks));
+    janet_struct_put(st, janet_ckeywordv("fibers"), janet_wrap_integer(fibers));
+    janet_struct_put(st, janet_ckeywordv("fiber-bytes"), janet_wrap_number(fiber_bytes));
+    janet_struct_put(st, janet_ckeywordv("roots"), janet_wrap_number(janet_vm_root_count + janet_vm_root_handle_count));
+    janet_struct_put(st, janet_ckeywordv("root-slots"), janet_wrap_integer(janet_vm_root_handle_capacity));
+    janet_struct_put(st, janet_ckeywordv("allocated"), janet_wrap_number(janet_vm_next_collection));
+    janet_struct_put(st, janet_ckeywordv("interval"), janet_wrap_number(janet_vm_gc_interval));
+    janet_struct_put(st, janet_ckeywordv("live-bytes"), janet_wrap_number((double) janet_vm_heap_live));
+    janet_struct_put(st, janet_ckeywordv("limit"), janet_wrap_number((double) janet_vm_heap_limit));
+    return janet_wrap_struct(janet_struct_end(st));
+}
+
 static Janet janet_core_type(int32_t argc, Janet *argv) {
     janet_fixarity(argc, 1);
     JanetType t = janet_type(argv[0]);
@@ -424,25 +486,518 @@ static Janet janet_core_type(int32_t argc, Janet *argv) {
     }
 }
 
+/* Remember where next last found a key in a few dictionaries, so that
+ * iterating with next is a linear scan instead of a hash lookup per step.
+ * A cursor is only trusted if the key is still in the remembered bucket. */
+#define JANET_NEXT_CURSORS 4
+typedef struct {
+    const JanetKV *kvs;
+    int32_t index;
+} JanetNextCursor;
+static JANET_THREAD_LOCAL JanetNextCursor janet_next_cursors[JANET_NEXT_CURSORS];
+
 static Janet janet_core_next(int32_t argc, Janet *argv) {
     janet_fixarity(argc, 2);
     JanetDictView view = janet_getdictionary(argv, 0);
     const JanetKV *end = view.kvs + view.cap;
-    const JanetKV *kv = janet_checktype(argv[1], JANET_NIL)
-                        ? view.kvs
-                        : janet_dict_find(view.kvs, view.cap, argv[1]) + 1;
+    JanetNextCursor *cursor = janet_next_cursors +
+                              (((uintptr_t) view.kvs >> 4) & (JANET_NEXT_CURSORS - 1));
+    const JanetKV *kv;
+    if (janet_checktype(argv[1], JANET_NIL)) {
+        kv = view.kvs;
+    } else if (cursor->kvs == view.kvs && cursor->index < view.cap &&
+               janet_equals(view.kvs[cursor->index].key, argv[1])) {
+        kv = view.kvs + cursor->index + 1;
+    } else {
+        kv = janet_dict_find(view.kvs, view.cap, argv[1]) + 1;
+    }
     while (kv < end) {
-        if (!janet_checktype(kv->key, JANET_NIL)) return kv->key;
+        if (!janet_checktype(kv->key, JANET_NIL)) {
+            cursor->kvs = view.kvs;
+            cursor->index = (int32_t)(kv - view.kvs);
+            return kv->key;
+        }
         kv++;
     }
     return janet_wrap_nil();
 }
 
+/* Create a table that can hold count entries without rehashing */
+static JanetTable *janet_core_table_sized(int32_t count) {
+    return janet_table(count ? 2 * count + 2 : 0);
+}
+
+/* Get a view of an indexed data structure or a byte sequence. Bytes
+ * are viewed as numbers. */
+typedef struct {
+    const Janet *items;
+    const uint8_t *bytes;
+    int32_t len;
+} JanetSeqView;
+
+static JanetSeqView janet_core_getseq(const Janet *argv, int32_t n) {
+    JanetSeqView view;
+    view.items = NULL;
+    view.bytes = NULL;
+    if (!janet_indexed_view(argv[n], &view.items, &view.len) &&
+            !janet_bytes_view(argv[n], &view.bytes, &view.len)) {
+        janet_panic_type(argv[n], n, JANET_TFLAG_INDEXED | JANET_TFLAG_BYTES);
+    }
+    return view;
+}
+
+#define janet_seq_at(view, i) ((view).items \
+    ? (view).items[(i)] \
+    : janet_wrap_integer((view).bytes[(i)]))
+
+static Janet janet_core_keys(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    JanetDictView view = janet_getdictionary(argv, 0);
+    JanetArray *array = janet_array(view.len);
+    for (int32_t i = 0; i < view.cap; i++) {
+        const JanetKV *kv = view.kvs + i;
+        if (!janet_checktype(kv->key, JANET_NIL))
+            array->data[array->count++] = kv->key;
+    }
+    return janet_wrap_array(array);
+}
+
+static Janet janet_core_values(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    JanetDictView view = janet_getdictionary(argv, 0);
+    JanetArray *array = janet_array(view.len);
+    for (int32_t i = 0; i < view.cap; i++) {
+        const JanetKV *kv = view.kvs + i;
+        if (!janet_checktype(kv->key, JANET_NIL))
+            array->data[array->count++] = kv->value;
+    }
+    return janet_wrap_array(array);
+}
+
+static Janet janet_core_pairs(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    JanetDictView view = janet_getdictionary(argv, 0);
+    JanetArray *array = janet_array(view.len);
+    for (int32_t i = 0; i < view.cap; i++) {
+        const JanetKV *kv = view.kvs + i;
+        if (!janet_checktype(kv->key, JANET_NIL)) {
+            Janet *t = janet_tuple_begin(2);
+            t[0] = kv->key;
+            t[1] = kv->value;
+            array->data[array->count++] = janet_wrap_tuple(janet_tuple_end(t));
+        }
+    }
+    return janet_wrap_array(array);
+}
+
+static Janet janet_core_invert(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    JanetDictView view = janet_getdictionary(argv, 0);
+    JanetTable *table = janet_core_table_sized(view.len);
+    for (int32_t i = 0; i < view.cap; i++) {
+        const JanetKV *kv = view.kvs + i;
+        if (!janet_checktype(kv->key, JANET_NIL))
+            janet_table_put(table, kv->value, kv->key);
+    }
+    return janet_wrap_table(table);
+}
+
+static Janet janet_core_zipcoll(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 2);
+    JanetView ks = janet_getindexed(argv, 0);
+    JanetView vs = janet_getindexed(argv, 1);
+    int32_t len = ks.len < vs.len ? ks.len : vs.len;
+    JanetTable *table = janet_core_table_sized(len);
+    for (int32_t i = 0; i < len; i++) {
+        janet_table_put(table, ks.items[i], vs.items[i]);
+    }
+    return janet_wrap_table(table);
+}
+
+static Janet janet_core_frequencies(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    JanetSeqView view = janet_core_getseq(argv, 0);
+    JanetTable *freqs = janet_table(0);
+    for (int32_t i = 0; i < view.len; i++) {
+        Janet x = janet_seq_at(view, i);
+        JanetKV *bucket = janet_table_find(freqs, x);
+        if (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL)) {
+            bucket->value = janet_wrap_number(janet_unwrap_number(bucket->value) + 1);
+        } else {
+            janet_table_put(freqs, x, janet_wrap_integer(1));
+        }
+    }
+    return janet_wrap_table(freqs);
+}
+
+static Janet janet_core_distinct(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    JanetSeqView view = janet_core_getseq(argv, 0);
+    JanetArray *array = janet_array(0);
+    JanetTable *seen = janet_table(0);
+    for (int32_t i = 0; i < view.len; i++) {
+        Janet x = janet_seq_at(view, i);
+        JanetKV *bucket = janet_table_find(seen, x);
+        if (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL)) continue;
+        janet_table_put(seen, x, janet_wrap_true());
+        janet_array_push(array, x);
+    }
+    return janet_wrap_array(array);
+}
+
+/* Merge dictionaries argv[start..argc) into table */
+static void janet_core_mergeinto(JanetTable *table, int32_t argc, Janet *argv, int32_t start) {
+    for (int32_t i = start; i < argc; i++) {
+        JanetDictView view = janet_getdictionary(argv, i);
+        for (int32_t j = 0; j < view.cap; j++) {
+            const JanetKV *kv = view.kvs + j;
+            if (!janet_checktype(kv->key, JANET_NIL))
+                janet_table_put(table, kv->key, kv->value);
+        }
+    }
+}
+
+static Janet janet_core_merge_into(int32_t argc, Janet *argv) {
+    janet_arity(argc, 1, -1);
+    JanetTable *table = janet_gettable(argv, 0);
+    janet_core_mergeinto(table, argc, argv, 1);
+    return argv[0];
+}
+
+static Janet janet_core_merge(int32_t argc, Janet *argv) {
+    int32_t total = 0;
+    for (int32_t i = 0; i < argc; i++) {
+        total += janet_getdictionary(argv, i).len;
+    }
+    JanetTable *table = janet_core_table_sized(total);
+    janet_core_mergeinto(table, argc, argv, 0);
+    return janet_wrap_table(table);
+}
+
 static Janet janet_core_hash(int32_t argc, Janet *argv) {
     janet_fixarity(argc, 1);
     return janet_wrap_number(janet_hash(argv[0]));
 }
 
+/* Deep comparison, hashing and freezing of nested data structures. These
+ * walk data with an explicit stack of frames rather than recursing, so
+ * deeply nested data does not overflow the C stack. */
+
+typedef struct {
+    Janet x;
+    Janet y;
+    int32_t index;
+    uint32_t hash;
+    uint32_t keyhash;
+    int32_t base;
+} JanetDeepFrame;
+
+static int janet_deep_iscontainer(Janet x) {
+    switch (janet_type(x)) {
+        default:
+            return 0;
+        case JANET_ARRAY:
+        case JANET_TUPLE:
+        case JANET_TABLE:
+        case JANET_STRUCT:
+            return 1;
+    }
+}
+
+/* Check if a mutable container is already being visited. Only mutable
+ * containers can close a cycle, so immutable ones are never checked. */
+static int janet_deep_onpath(JanetDeepFrame *stack, Janet x) {
+    if (!janet_checktype(x, JANET_ARRAY) && !janet_checktype(x, JANET_TABLE))
+        return 0;
+    void *p = janet_unwrap_pointer(x);
+    for (int32_t i = 0; i < janet_v_count(stack); i++) {
+        if (janet_unwrap_pointer(stack[i].x) == p) return 1;
+    }
+    return 0;
+}
+
+/* Check if the pair x, y is already being compared. Equality of a pair
+ * that is still open is assumed, which makes cyclic data compare equal
+ * when every unfolding of it matches, whichever side is passed first. */
+static int janet_deep_pair_onpath(JanetDeepFrame *stack, Janet x, Janet y) {
+    if (!janet_checktype(x, JANET_ARRAY) && !janet_checktype(x, JANET_TABLE))
+        return 0;
+    void *px = janet_unwrap_pointer(x);
+    void *py = janet_unwrap_pointer(y);
+    for (int32_t i = 0; i < janet_v_count(stack); i++) {
+        if (janet_unwrap_pointer(stack[i].x) == px &&
+                janet_unwrap_pointer(stack[i].y) == py) return 1;
+    }
+    return 0;
+}
+
+static JanetDeepFrame *janet_deep_push(JanetDeepFrame *stack, Janet x, Janet y, int32_t base) {
+    JanetDeepFrame frame;
+    frame.x = x;
+    frame.y = y;
+    frame.index = 0;
+    frame.hash = 5381 + janet_type(x);
+    frame.keyhash = 0;
+    frame.base = base;
+    janet_v_push(stack, frame);
+    return stack;
+}
+
+/* Get the next child of a container being walked. Dictionaries yield their
+ * values, and their keys through key. Returns 0 when there are no children left. */
+static int janet_deep_next(JanetDeepFrame *frame, Janet *child, Janet *key) {
+    switch (janet_type(frame->x)) {
+        default:
+            return 0;
+        case JANET_ARRAY:
+        case JANET_TUPLE: {
+            const Janet *data;
+            int32_t len;
+            janet_indexed_view(frame->x, &data, &len);
+            if (frame->index >= len) return 0;
+            *child = data[frame->index++];
+            return 1;
+        }
+        case JANET_TABLE:
+        case JANET_STRUCT: {
+            const JanetKV *kvs;
+            int32_t len, cap;
+            janet_dictionary_view(frame->x, &kvs, &len, &cap);
+            while (frame->index < cap) {
+                const JanetKV *kv = kvs + frame->index++;
+                if (janet_checktype(kv->key, JANET_NIL)) continue;
+                *key = kv->key;
+                *child = kv->value;
+                return 1;
+            }
+            return 0;
+        }
+    }
+}
+
+/* Compare two values without descending into them. Returns 0 if they
+ * differ, 1 if they are equal, and 2 if their children must be compared. */
+static int janet_deep_check(Janet x, Janet y) {
+    if (janet_type(x) != janet_type(y)) return 0;
+    switch (janet_type(x)) {
+        default:
+            return janet_equals(x, y);
+        case JANET_BUFFER: {
+            JanetBuffer *bx = janet_unwrap_buffer(x);
+            JanetBuffer *by = janet_unwrap_buffer(y);
+            return bx->count == by->count &&
+                   (bx->count == 0 || !memcmp(bx->data, by->data, bx->count));
+        }
+        case JANET_ARRAY:
+        case JANET_TUPLE:
+        case JANET_TABLE:
+        case JANET_STRUCT: {
+            if (janet_unwrap_pointer(x) == janet_unwrap_pointer(y)) return 1;
+            int32_t xlen = janet_length(x);
+            if (xlen != janet_length(y)) return 0;
+            return xlen ? 2 : 1;
+        }
+    }
+}
+
+static int janet_deep_equals(Janet x, Janet y) {
+    int result = janet_deep_check(x, y);
+    if (result != 2) return result;
+    JanetDeepFrame *stack = janet_deep_push(NULL, x, y, 0);
+    result = 1;
+    while (janet_v_count(stack)) {
+        JanetDeepFrame *frame = &janet_v_last(stack);
+        Janet cx, cy, key = janet_wrap_nil();
+        if (!janet_deep_next(frame, &cx, &key)) {
+            janet_v_pop(stack);
+            continue;
+        }
+        if (janet_checktype(key, JANET_NIL)) {
+            const Janet *ydata;
+            int32_t ylen;
+            janet_indexed_view(frame->y, &ydata, &ylen);
+            cy = ydata[frame->index - 1];
+        } else if (janet_checktype(frame->y, JANET_TABLE)) {
+            cy = janet_table_rawget(janet_unwrap_table(frame->y), key);
+        } else {
+            cy = janet_struct_get(janet_unwrap_struct(frame->y), key);
+        }
+        int check = janet_deep_check(cx, cy);
+        if (check == 0) {
+            result = 0;
+            break;
+        }
+        if (check == 2 && !janet_deep_pair_onpath(stack, cx, cy)) {
+            stack = janet_deep_push(stack, cx, cy, 0);
+        }
+    }
+    janet_v_free(stack);
+    return result;
+}
+
+static uint32_t janet_deep_hash_leaf(Janet x) {
+    if (janet_checktype(x, JANET_BUFFER)) {
+        JanetBuffer *b = janet_unwrap_buffer(x);
+        return (uint32_t) janet_string_calchash(b->data, b->count) + JANET_BUFFER;
+    }
+    return (uint32_t) janet_hash(x);
+}
+
+/* Hash values so that values that are deep= have the same hash. Dictionary
+ * entries are summed, as equal dictionaries can have different layouts. */
+static int32_t janet_deep_hash(Janet x) {
+    if (!janet_deep_iscontainer(x)) return (int32_t) janet_deep_hash_leaf(x);
+    JanetDeepFrame *stack = janet_deep_push(NULL, x, janet_wrap_nil(), 0);
+    uint32_t hash = 0;
+    for (;;) {
+        JanetDeepFrame *frame = &janet_v_last(stack);
+        Janet child, key = janet_wrap_nil();
+        if (janet_deep_next(frame, &child, &key)) {
+            if (!janet_checktype(key, JANET_NIL)) {
+                frame->keyhash = (uint32_t) janet_hash(key);
+            }
+            if (janet_deep_iscontainer(child)) {
+                if (janet_deep_onpath(stack, child)) {
+                    janet_v_free(stack);
+                    janet_panic("cannot hash cyclic data structure");
+                }
+                stack = janet_deep_push(stack, child, janet_wrap_nil(), 0);
+                continue;
+            }
+            hash = janet_deep_hash_leaf(child);
+        } else {
+            hash = frame->hash;
+            janet_v_pop(stack);
+            if (!janet_v_count(stack)) break;
+            frame = &janet_v_last(stack);
+        }
+        /* Combine the hash of a finished child into its parent */
+        if (janet_checktype(frame->x, JANET_ARRAY) || janet_checktype(frame->x, JANET_TUPLE)) {
+            frame->hash = (frame->hash << 5) + frame->hash + hash;
+        } else {
+            uint32_t kvhash = (frame->keyhash << 5) + frame->keyhash + hash;
+            frame->hash += kvhash ^ (kvhash >> 16);
+        }
+    }
+    janet_v_free(stack);
+    return (int32_t) hash;
+}
+
+/* Build the immutable version of a container from its frozen children. */
+static Janet janet_freeze_finish(Janet x, const Janet *items, int32_t n) {
+    if (janet_checktype(x, JANET_ARRAY) || janet_checktype(x, JANET_TUPLE)) {
+        return janet_wrap_tuple(janet_tuple_n(items, n));
+    }
+    JanetKV *st = janet_struct_begin(n / 2);
+    for (int32_t i = 0; i < n; i += 2) {
+        janet_struct_put(st, items[i], items[i + 1]);
+    }
+    return janet_wrap_struct(janet_struct_end(st));
+}
+
+static Janet janet_freeze_leaf(Janet x) {
+    if (janet_checktype(x, JANET_BUFFER)) {
+        JanetBuffer *b = janet_unwrap_buffer(x);
+        return janet_stringv(b->data, b->count);
+    }
+    return x;
+}
+
+/* Tables with a prototype are frozen with the entries of the prototype
+ * merged in. The original value is kept in y for cycle detection. */
+static JanetDeepFrame *janet_freeze_push(JanetDeepFrame *stack, Janet x, int32_t base) {
+    Janet orig = x;
+    if (janet_checktype(x, JANET_TABLE) && NULL != janet_unwrap_table(x)->proto) {
+        JanetTable *t = janet_unwrap_table(x);
+        JanetTable *merged = janet_table(t->proto->count + t->count);
+        janet_table_merge_table(merged, t->proto);
+        janet_table_merge_table(merged, t);
+        x = janet_wrap_table(merged);
+    }
+    stack = janet_deep_push(stack, x, orig, base);
+    return stack;
+}
+
+/* Get the next child of a container being frozen. Dictionaries yield each
+ * key and then its value, so keys are frozen on the same stack. */
+static int janet_freeze_next(JanetDeepFrame *frame, Janet *child) {
+    if (janet_checktype(frame->x, JANET_ARRAY) || janet_checktype(frame->x, JANET_TUPLE)) {
+        Janet key;
+        return janet_deep_next(frame, child, &key);
+    }
+    const JanetKV *kvs;
+    int32_t len, cap;
+    janet_dictionary_view(frame->x, &kvs, &len, &cap);
+    while (frame->index < 2 * cap) {
+        const JanetKV *kv = kvs + frame->index / 2;
+        if (janet_checktype(kv->key, JANET_NIL)) {
+            frame->index += 2;
+            continue;
+        }
+        *child = (frame->index & 1) ? kv->value : kv->key;
+        frame->index++;
+        return 1;
+    }
+    return 0;
+}
+
+/* The stack and frozen values are scratch memory, so a panic part way
+ * through does not leak them. */
+static Janet janet_freeze(Janet x) {
+    if (!janet_deep_iscontainer(x)) return janet_freeze_leaf(x);
+    Janet *values = NULL;
+    JanetDeepFrame *stack = janet_freeze_push(NULL, x, 0);
+    Janet result;
+    for (;;) {
+        JanetDeepFrame *frame = &janet_v_last(stack);
+        Janet child;
+        if (janet_freeze_next(frame, &child)) {
+            if (janet_deep_iscontainer(child)) {
+                for (int32_t i = 0; i < janet_v_count(stack); i++) {
+                    if (janet_unwrap_pointer(stack[i].y) == janet_unwrap_pointer(child)) {
+                        janet_v_free(values);
+                        janet_v_free(stack);
+                        janet_panic("cannot freeze cyclic data structure");
+                    }
+                }
+                stack = janet_freeze_push(stack, child, janet_v_count(values));
+                continue;
+            }
+            janet_v_push(values, janet_freeze_leaf(child));
+            continue;
+        }
+        result = janet_freeze_finish(frame->x, values + frame->base,
+                                     janet_v_count(values) - frame->base);
+        while (janet_v_count(values) > frame->base) janet_v_pop(values);
+        janet_v_pop(stack);
+        if (!janet_v_count(stack)) break;
+        janet_v_push(values, result);
+    }
+    janet_v_free(values);
+    janet_v_free(stack);
+    return result;
+}
+
+static Janet janet_core_deep_equals(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 2);
+    return janet_wrap_boolean(janet_deep_equals(argv[0], argv[1]));
+}
+
+static Janet janet_core_deep_not_equals(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 2);
+    return janet_wrap_boolean(!janet_deep_equals(argv[0], argv[1]));
+}
+
+static Janet janet_core_deep_hash(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    return janet_wrap_number(janet_deep_hash(argv[0]));
+}
+
+static Janet janet_core_freeze(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    return janet_freeze(argv[0]);
+}
+
 static Janet janet_core_getline(int32_t argc, Janet *argv) {
     FILE *in = janet_dynfile("in", stdin);
     FILE *out = janet_dynfile("out", stdout);
@@ -607,6 +1162,45 @@ static const JanetReg corelib_cfuns[] = {
         "Returns the integer number of bytes to allocate before running an iteration "
         "of garbage collection.")
     },
+    {
+        "gcsetlimit", janet_core_gcsetlimit,
+        JDOC("(gcsetlimit bytes)\n\n"
+        "Limit the heap to about the given number of bytes, or remove the limit if bytes "
+        "is nil or 0. The garbage collector runs more often as the heap nears the limit, "
+        "and an allocation that would go over it raises an error in the current fiber "
+        "instead. The heap size is estimated from the last collection plus what has been "
+        "allocated since.")
+    },
+    {
+        "gclimit", janet_core_gclimit,
+        JDOC("(gclimit)\n\n"
+        "Returns the heap limit in bytes set with gcsetlimit, or nil if there is none.")
+    },
+    {
+        "gcsetthreads", janet_core_gcsetthreads,
+        JDOC("(gcsetthreads n &opt min-blocks)\n\n"
+        "Set the number of threads, including the current one, that mark the heap "
+        "during garbage collection. Extra threads are only used for heaps of at least "
+        "min-blocks objects, 100000 by default, and only on platforms with pthreads. "
+        "Any abstract types with gcmark functions must then be safe to mark from "
+        "other threads. Defaults to 1.")
+    },
+    {
+        "gcthreads", janet_core_gcthreads,
+        JDOC("(gcthreads)\n\n"
+        "Returns the number of threads that mark the heap during garbage collection.")
+    },
+    {
+        "gcstats", janet_core_gcstats,
+        JDOC("(gcstats)\n\n"
+             "Returns a struct of garbage collector statistics. :blocks is the number of "
+             "objects on the heap, :fibers the number of fibers and :fiber-bytes the memory "
+             "held by fiber stacks. :allocated is the number of bytes allocated since the "
+             "last collection, :interval is the same as (gcinterval), and :roots is the "
+             "number of gc roots. :root-slots is the number of slots allocated for roots "
+             "added with janet_gcroot_handle. :live-bytes estimates the bytes in use after the last "
+             "collection, and :limit is the heap limit, or 0 if there is none.")
+    },
     {
         "type", janet_core_type,
         JDOC("(type x)\n\n"
@@ -636,6 +1230,58 @@ static const JanetReg corelib_cfuns[] = {
         "during iteration. If key is nil, next returns the first key. If next "
         "returns nil, there are no more keys to iterate through. ")
     },
+    {
+        "keys", janet_core_keys,
+        JDOC("(keys x)\n\n"
+        "Get the keys of an associative data structure.")
+    },
+    {
+        "values", janet_core_values,
+        JDOC("(values x)\n\n"
+        "Get the values of an associative data structure.")
+    },
+    {
+        "pairs", janet_core_pairs,
+        JDOC("(pairs x)\n\n"
+        "Get the key-value pairs of an associative data structure.")
+    },
+    {
+        "invert", janet_core_invert,
+        JDOC("(invert ds)\n\n"
+        "Returns a table of where the keys of an associative data structure "
+        "are the values, and the values of the keys. If multiple keys have the same "
+        "value, one key will be ignored.")
+    },
+    {
+        "zipcoll", janet_core_zipcoll,
+        JDOC("(zipcoll ks vs)\n\n"
+        "Creates a table from two arrays/tuples. "
+        "Returns a new table.")
+    },
+    {
+        "frequencies", janet_core_frequencies,
+        JDOC("(frequencies ind)\n\n"
+        "Get the number of occurrences of each value in a indexed structure.")
+    },
+    {
+        "distinct", janet_core_distinct,
+        JDOC("(distinct xs)\n\n"
+        "Returns an array of the deduplicated values in xs.")
+    },
+    {
+        "merge-into", janet_core_merge_into,
+        JDOC("(merge-into tab & colls)\n\n"
+        "Merges multiple tables/structs into a table. If a key appears in more than one "
+        "collection, then later values replace any previous ones. "
+        "Returns the original table.")
+    },
+    {
+        "merge", janet_core_merge,
+        JDOC("(merge & colls)\n\n"
+        "Merges multiple tables/structs to one. If a key appears in more than one "
+        "collection, then later values replace any previous ones. "
+        "Returns a new table.")
+    },
     {
         "hash", janet_core_hash,
         JDOC("(hash value)\n\n"
@@ -643,6 +1289,33 @@ static const JanetReg corelib_cfuns[] = {
         "as a cheap hash function for all janet objects. If two values are strictly equal, "
         "then they will have the same hash value.")
     },
+    {
+        "deep=", janet_core_deep_equals,
+        JDOC("(deep= x y)\n\n"
+             "Like =, but mutable types (arrays, tables, buffers) are considered "
+             "equal if they have identical structure. Dictionary keys are compared with =, "
+             "and table prototypes are ignored.")
+    },
+    {
+        "deep-not=", janet_core_deep_not_equals,
+        JDOC("(deep-not= x y)\n\n"
+             "Like not=, but mutable types (arrays, tables, buffers) are considered "
+             "equal if they have identical structure.")
+    },
+    {
+        "deep-hash", janet_core_deep_hash,
+        JDOC("(deep-hash x)\n\n"
+             "Gets a hash value for x such that values that are deep= have the same hash. "
+             "Unlike hash, mutable data structures are hashed by their contents, so "
+             "the hash changes if they are mutated. Raises an error on cyclic data.")
+    },
+    {
+        "freeze", janet_core_freeze,
+        JDOC("(freeze x)\n\n"
+             "Freeze an object (make it immutable) and do a deep copy, making "
+             "child values also immutable. Closures, fibers, and abstract types "
+             "will not be recursively frozen, but all other types will.")
+    },
     {
         "getline", janet_core_getline,
         JDOC("(getline &opt prompt buf)\n\n"
@@ -721,7 +1394,7 @@ static void janet_quick_asm(
     def->max_arity = max_arity;
     def->flags = flags;
     def->slotcount = slots;
-    def->bytecode = malloc(bytecode_size);
+    def->bytecode = janet_malloc(bytecode_size);
     def->bytecode_length = (int32_t)(bytecode_size / sizeof(uint32_t));
     def->name = janet_cstring(name);
     if (!def->bytecode) {
@@ -913,6 +1586,16 @@ static const uint32_t resume_asm[] = {
     JOP_RESUME | (1 << 24),
     JOP_RETURN
 };
+static const uint32_t pcall_asm[] = {
+    JOP_PROTECTED_CALL | (1 << 8),
+    JOP_JUMP | (3 << 8),
+    JOP_LOAD_FALSE | (2 << 8),
+    JOP_JUMP | (2 << 8),
+    JOP_LOAD_TRUE | (2 << 8),
+    JOP_PUSH_2 | (2 << 8) | (1 << 16),
+    JOP_MAKE_BRACKET_TUPLE | (3 << 8),
+    JOP_RETURN | (3 << 8)
+};
 static const uint32_t in_asm[] = {
     JOP_IN | (1 << 24),
     JOP_LOAD_NIL | (3 << 8),
@@ -1016,6 +1699,13 @@ JanetTable *janet_core_env(JanetTable *replacements) {
                          "will be returned to the last yield in the case of a pending fiber, or the argument to "
                          "the dispatch function in the case of a new fiber. Returns either the return result of "
                          "the fiber's dispatch function, or the value from the next yield call in fiber."));
+    janet_quick_asm(env, 0,
+                    "pcall", 1, 1, 1, 4, pcall_asm, sizeof(pcall_asm),
+                    JDOC("(pcall f)\n\n"
+                         "Call a function of no arguments and catch any error it raises. Returns "
+                         "[true result] if f returns, or [false err] if f raises an error. Unlike "
+                         "resuming a new fiber, f runs on the current fiber, so other signals such as "
+                         "yields pass through to the parent as if f were called directly."));
     janet_quick_asm(env, JANET_FUN_IN,
                     "in", 3, 2, 3, 4, in_asm, sizeof(in_asm),
                     JDOC("(in ds key &opt dflt)\n\n"
@@ -46,6 +46,197 @@ void janet_debug_unbreak(JanetFuncDef *def, int32_t pc) {
     def->bytecode[pc] &= ~((uint32_t)0x80);
 }
 
+/*
+ * Source index. Maps source names to the funcdefs that were compiled
+ * from them so that breakpoints and other location queries do not need
+ * to scan the whole heap. The index holds weak references - funcdefs
+ * that are about to be collected are pruned before each sweep.
+ */
+
+typedef struct {
+    JanetFuncDef *def;
+    int32_t *order; /* Bytecode offsets sorted by source mapping. Built lazily. */
+    JanetSourceMapping *map; /* Unpacked sourcemap. Built lazily. */
+} JanetSourceDef;
+
+typedef struct {
+    const uint8_t *source;
+    JanetSourceDef *defs;
+    int32_t count;
+    int32_t capacity;
+} JanetSourceFile;
+
+static JANET_THREAD_LOCAL JanetSourceFile *janet_vm_srcindex = NULL;
+static JANET_THREAD_LOCAL int32_t janet_vm_srcindex_capacity = 0;
+static JANET_THREAD_LOCAL int32_t janet_vm_srcindex_count = 0;
+
+/* Find the slot for a source name. Returns an empty slot if not found. */
+static JanetSourceFile *srcindex_slot(
+    JanetSourceFile *files,
+    int32_t cap,
+    const uint8_t *source) {
+    uint32_t index = janet_maphash(cap, janet_string_hash(source));
+    for (int32_t i = 0; i < cap; i++) {
+        JanetSourceFile *file = files + ((index + i) & (cap - 1));
+        if (NULL == file->source || janet_string_equal(file->source, source))
+            return file;
+    }
+    return NULL;
+}
+
+/* Rehash all live files into a table of a new capacity */
+static void srcindex_rehash(int32_t newcap) {
+    JanetSourceFile *oldfiles = janet_vm_srcindex;
+    int32_t oldcap = janet_vm_srcindex_capacity;
+    JanetSourceFile *newfiles = janet_calloc(newcap, sizeof(JanetSourceFile));
+    if (NULL == newfiles) {
+        JANET_OUT_OF_MEMORY;
+    }
+    janet_vm_srcindex_count = 0;
+    for (int32_t i = 0; i < oldcap; i++) {
+        JanetSourceFile *file = oldfiles + i;
+        if (NULL == file->source) continue;
+        if (file->count) {
+            *srcindex_slot(newfiles, newcap, file->source) = *file;
+            janet_vm_srcindex_count++;
+        } else {
+            janet_free(file->defs);
+        }
+    }
+    janet_free(oldfiles);
+    janet_vm_srcindex = newfiles;
+    janet_vm_srcindex_capacity = newcap;
+}
+
+/* Add a funcdef to the source index. Only funcdefs with both a source
+ * and a sourcemap are tracked. */
+void janet_srcindex_add(JanetFuncDef *def) {
+    if (NULL == def->source) return;
+    if (NULL == def->sourcemap_packed && NULL == def->sourcemap) return;
+    if (2 * (janet_vm_srcindex_count + 1) > janet_vm_srcindex_capacity) {
+        srcindex_rehash(janet_tablen(4 * janet_vm_srcindex_count + 4));
+    }
+    JanetSourceFile *file = srcindex_slot(janet_vm_srcindex, janet_vm_srcindex_capacity, def->source);
+    if (NULL == file->source) {
+        file->source = def->source;
+        janet_vm_srcindex_count++;
+    }
+    if (file->count == file->capacity) {
+        int32_t newcap = 2 * file->capacity + 4;
+        JanetSourceDef *newdefs = janet_realloc(file->defs, newcap * sizeof(JanetSourceDef));
+        if (NULL == newdefs) {
+            JANET_OUT_OF_MEMORY;
+        }
+        file->defs = newdefs;
+        file->capacity = newcap;
+    }
+    file->defs[file->count].def = def;
+    file->defs[file->count].order = NULL;
+    file->defs[file->count].map = NULL;
+    file->count++;
+}
+
+/* Remove all funcdefs that were not marked by the garbage collector. Must
+ * be called after marking and before sweeping. */
+void janet_srcindex_prune(void) {
+    int any_empty = 0;
+    for (int32_t i = 0; i < janet_vm_srcindex_capacity; i++) {
+        JanetSourceFile *file = janet_vm_srcindex + i;
+        if (NULL == file->source) continue;
+        int32_t j = 0;
+        for (int32_t k = 0; k < file->count; k++) {
+            JanetSourceDef sd = file->defs[k];
+            if (janet_gc_header(sd.def)->flags & (JANET_MEM_REACHABLE | JANET_MEM_DISABLED)) {
+                file->defs[j++] = sd;
+            } else {
+                janet_free(sd.order);
+                janet_free(sd.map);
+            }
+        }
+        file->count = j;
+        if (j) {
+            /* The name the file was indexed under may be collected */
+            file->source = file->defs[0].def->source;
+        } else {
+            any_empty = 1;
+        }
+    }
+    if (any_empty) {
+        srcindex_rehash(janet_vm_srcindex_capacity);
+    }
+}
+
+/* Free the source index */
+void janet_srcindex_deinit(void) {
+    for (int32_t i = 0; i < janet_vm_srcindex_capacity; i++) {
+        JanetSourceFile *file = janet_vm_srcindex + i;
+        for (int32_t k = 0; k < file->count; k++) {
+            janet_free(file->defs[k].order);
+            janet_free(file->defs[k].map);
+        }
+        janet_free(file->defs);
+    }
+    janet_free(janet_vm_srcindex);
+    janet_vm_srcindex = NULL;
+    janet_vm_srcindex_capacity = 0;
+    janet_vm_srcindex_count = 0;
+}
+
+/* Compare source mappings by line, then column, then bytecode offset. */
+static JANET_THREAD_LOCAL const JanetSourceMapping *srcindex_sort_map;
+static int srcindex_cmp(const void *a, const void *b) {
+    int32_t pa = *(const int32_t *)a;
+    int32_t pb = *(const int32_t *)b;
+    JanetSourceMapping ma = srcindex_sort_map[pa];
+    JanetSourceMapping mb = srcindex_sort_map[pb];
+    if (ma.line != mb.line) return ma.line < mb.line ? -1 : 1;
+    if (ma.column != mb.column) return ma.column < mb.column ? -1 : 1;
+    return pa < pb ? -1 : (pa > pb);
+}
+
+/* Find the bytecode offset in a funcdef whose mapping is the closest to the given
+ * line and column, but not after. Returns -1 if there is no such offset. */
+static int32_t srcindex_lookup(JanetSourceDef *sd, int32_t line, int32_t column) {
+    JanetFuncDef *def = sd->def;
+    int32_t n = def->bytecode_length;
+    if (n <= 0) return -1;
+    if (NULL == sd->map) {
+        sd->map = janet_sourcemap_unpack(def);
+        if (NULL == sd->map) return -1;
+    }
+    const JanetSourceMapping *map = sd->map;
+    if (NULL == sd->order) {
+        sd->order = janet_malloc(sizeof(int32_t) * n);
+        if (NULL == sd->order) {
+            JANET_OUT_OF_MEMORY;
+        }
+        for (int32_t i = 0; i < n; i++) sd->order[i] = i;
+        srcindex_sort_map = map;
+        qsort(sd->order, n, sizeof(int32_t), srcindex_cmp);
+    }
+    /* Binary search for the first mapping after (line, column) */
+    int32_t lo = 0, hi = n;
+    while (lo < hi) {
+        int32_t mid = lo + (hi - lo) / 2;
+        JanetSourceMapping m = map[sd->order[mid]];
+        if (m.line < line || (m.line == line && m.column <= column)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    /* Walk back to the closest mapping not after column */
+    int32_t i = lo - 1;
+    while (i >= 0 && map[sd->order[i]].column > column) i--;
+    if (i < 0) return -1;
+    /* Prefer the earliest instruction among identical mappings */
+    JanetSourceMapping best = map[sd->order[i]];
+    while (i > 0 &&
+            map[sd->order[i - 1]].line == best.line &&
+            map[sd->order[i - 1]].column == best.column) i--;
+    return sd->order[i];
+}
+
 /*
  * Find a location for a breakpoint given a source file an
  * location.
@@ -53,39 +244,27 @@ void janet_debug_unbreak(JanetFuncDef *def, int32_t pc) {
 void janet_debug_find(
     JanetFuncDef **def_out, int32_t *pc_out,
     const uint8_t *source, int32_t sourceLine, int32_t sourceColumn) {
-    /* Scan the heap for right func def */
-    JanetGCObject *current = janet_vm_blocks;
     /* Keep track of the best source mapping we have seen so far */
     int32_t besti = -1;
     int32_t best_line = -1;
     int32_t best_column = -1;
     JanetFuncDef *best_def = NULL;
-    while (NULL != current) {
-        if ((current->flags & JANET_MEM_TYPEBITS) == JANET_MEMORY_FUNCDEF) {
-            JanetFuncDef *def = (JanetFuncDef *)(current);
-            if (def->sourcemap &&
-                    def->source &&
-                    !janet_string_compare(source, def->source)) {
-                /* Correct source file, check mappings. The chosen
-                 * pc index is the instruction closest to the given line column, but
-                 * not after. */
-                int32_t i;
-                for (i = 0; i < def->bytecode_length; i++) {
-                    int32_t line = def->sourcemap[i].line;
-                    int32_t column = def->sourcemap[i].column;
-                    if (line <= sourceLine && line >= best_line) {
-                        if (column <= sourceColumn &&
-                                (line > best_line || column > best_column)) {
-                            best_line = line;
-                            best_column = column;
-                            besti = i;
-                            best_def = def;
-                        }
-                    }
-                }
+    if (janet_vm_srcindex_capacity) {
+        JanetSourceFile *file = srcindex_slot(janet_vm_srcindex, janet_vm_srcindex_capacity, source);
+        /* Newer funcdefs take precedence */
+        for (int32_t k = file ? file->count - 1 : -1; k >= 0; k--) {
+            JanetSourceDef *sd = file->defs + k;
+            int32_t i = srcindex_lookup(sd, sourceLine, sourceColumn);
+            if (i < 0) continue;
+            int32_t line = sd->map[i].line;
+            int32_t column = sd->map[i].column;
+            if (line > best_line || (line == best_line && column > best_column)) {
+                best_line = line;
+                best_column = column;
+                besti = i;
+                best_def = sd->def;
             }
         }
-        current = current->next;
     }
     if (best_def) {
         *def_out = best_def;
@@ -152,8 +331,8 @@ void janet_stacktrace(JanetFiber *fiber, Janet err) {
                 janet_eprintf(" (tailcall)");
             if (frame->func && frame->pc) {
                 int32_t off = (int32_t)(frame->pc - def->bytecode);
-                if (def->sourcemap) {
-                    JanetSourceMapping mapping = def->sourcemap[off];
+                JanetSourceMapping mapping;
+                if (janet_sourcemap_get(def, off, &mapping)) {
                     janet_eprintf(" on line %d, column %d", mapping.line, mapping.column);
                 } else {
                     janet_eprintf(" pc=%d", off);
@@ -264,8 +443,8 @@ static Janet doframe(JanetStackFrame *frame) {
         JanetArray *slots;
         off = (int32_t)(frame->pc - def->bytecode);
         janet_table_put(t, janet_ckeywordv("pc"), janet_wrap_integer(off));
-        if (def->sourcemap) {
-            JanetSourceMapping mapping = def->sourcemap[off];
+        JanetSourceMapping mapping;
+        if (janet_sourcemap_get(def, off, &mapping)) {
             janet_table_put(t, janet_ckeywordv("source-line"), janet_wrap_integer(mapping.line));
             janet_table_put(t, janet_ckeywordv("source-column"), janet_wrap_integer(mapping.column));
         }
@@ -43,8 +43,8 @@ int32_t janetc_allocnear(JanetCompiler *c, JanetcRegisterTemp tag) {
 
 /* Emit a raw instruction with source mapping. */
 void janetc_emit(JanetCompiler *c, uint32_t instr) {
-    janet_v_push(c->buffer, instr);
-    janet_v_push(c->mapbuffer, c->current_mapping);
+    janet_v_apush(&c->arena, c->buffer, instr);
+    janet_v_apush(&c->arena, c->mapbuffer, c->current_mapping);
 }
 
 /* Add a constant to the current scope. Return the index of the constant. */
@@ -68,7 +68,7 @@ static int32_t janetc_const(JanetCompiler *c, Janet x) {
         janetc_cerror(c, "too many constants");
         return 0;
     }
-    janet_v_push(scope->consts, x);
+    janet_v_apush(&c->arena, scope->consts, x);
     return len;
 }
 
@@ -289,6 +289,10 @@ int32_t janetc_emit_su(JanetCompiler *c, uint8_t op, JanetSlot s, uint16_t immed
     return emit1s(c, op, s, (int32_t) immediate, wr);
 }
 
+int32_t janetc_emit_sc(JanetCompiler *c, uint8_t op, JanetSlot s, Janet constant) {
+    return emit1s(c, op, s, janetc_const(c, constant), 0);
+}
+
 static int32_t emit2s(JanetCompiler *c, uint8_t op, JanetSlot s1, JanetSlot s2, int32_t rest, int wr) {
     int32_t reg1 = janetc_regnear(c, s1, JANETC_REGTEMP_0);
     int32_t reg2 = janetc_regnear(c, s2, JANETC_REGTEMP_1);
@@ -41,12 +41,14 @@ static void fiber_reset(JanetFiber *fiber) {
 
 static JanetFiber *fiber_alloc(int32_t capacity) {
     Janet *data;
-    JanetFiber *fiber = janet_gcalloc(JANET_MEMORY_FIBER, sizeof(JanetFiber));
     if (capacity < 32) {
         capacity = 32;
     }
+    /* Check the stack too, so a new fiber is never left uninitialized */
+    janet_gccheck(sizeof(JanetFiber) + sizeof(Janet) * capacity);
+    JanetFiber *fiber = janet_gcalloc(JANET_MEMORY_FIBER, sizeof(JanetFiber));
     fiber->capacity = capacity;
-    data = malloc(sizeof(Janet) * capacity);
+    data = janet_malloc(sizeof(Janet) * capacity);
     if (NULL == data) {
         JANET_OUT_OF_MEMORY;
     }
@@ -79,7 +81,9 @@ JanetFiber *janet_fiber(JanetFunction *callee, int32_t capacity, int32_t argc, c
 
 /* Ensure that the fiber has enough extra capacity */
 void janet_fiber_setcapacity(JanetFiber *fiber, int32_t n) {
-    Janet *newData = realloc(fiber->data, sizeof(Janet) * n);
+    if (n > fiber->capacity)
+        janet_gccheck(sizeof(Janet) * (n - fiber->capacity));
+    Janet *newData = janet_realloc(fiber->data, sizeof(Janet) * n);
     if (NULL == newData) {
         JANET_OUT_OF_MEMORY;
     }
@@ -87,6 +91,17 @@ void janet_fiber_setcapacity(JanetFiber *fiber, int32_t n) {
     fiber->capacity = n;
 }
 
+/* Release unused stack space from a fiber that is not running. Only
+ * shrinks if at least half the stack would be freed, so fibers that recurse
+ * deeply on every resume do not reallocate their stack each time. */
+void janet_fiber_shrink(JanetFiber *fiber) {
+    int32_t cap = 2 * fiber->stacktop;
+    if (cap < 64) cap = 64;
+    if (fiber->capacity >= 2 * cap) {
+        janet_fiber_setcapacity(fiber, cap);
+    }
+}
+
 /* Grow fiber if needed */
 static void janet_fiber_grow(JanetFiber *fiber, int32_t needed) {
     int32_t cap = needed > (INT32_MAX / 2) ? INT32_MAX : 2 * needed;
@@ -211,7 +226,8 @@ static void janet_env_detach(JanetFuncEnv *env) {
     /* Check for closure environment */
     if (env) {
         size_t s = sizeof(Janet) * env->length;
-        Janet *vmem = malloc(s);
+        janet_gccheck(s);
+        Janet *vmem = janet_malloc(s);
         janet_vm_next_collection += (uint32_t) s;
         if (NULL == vmem) {
             JANET_OUT_OF_MEMORY;
@@ -26,18 +26,35 @@
 #include "symcache.h"
 #include "gc.h"
 #include "util.h"
+#include "fiber.h"
+#endif
+
+#if defined(JANET_THREADS) && !defined(JANET_WINDOWS) && !defined(__EMSCRIPTEN__)
+#define JANET_GC_PARALLEL
+#include <pthread.h>
 #endif
 
 /* GC State */
 JANET_THREAD_LOCAL void *janet_vm_blocks;
 JANET_THREAD_LOCAL uint32_t janet_vm_gc_interval;
+JANET_THREAD_LOCAL uint32_t janet_vm_gc_trigger;
 JANET_THREAD_LOCAL uint32_t janet_vm_next_collection;
 JANET_THREAD_LOCAL int janet_vm_gc_suspend = 0;
+JANET_THREAD_LOCAL void *janet_vm_finalizers;
+JANET_THREAD_LOCAL uint32_t janet_vm_gc_threads;
+JANET_THREAD_LOCAL uint32_t janet_vm_gc_parallel_min;
+JANET_THREAD_LOCAL size_t janet_vm_heap_limit;
+JANET_THREAD_LOCAL size_t janet_vm_heap_live;
+JANET_THREAD_LOCAL int janet_vm_heap_exceeded;
 
 /* Roots */
 JANET_THREAD_LOCAL Janet *janet_vm_roots;
 JANET_THREAD_LOCAL uint32_t janet_vm_root_count;
 JANET_THREAD_LOCAL uint32_t janet_vm_root_capacity;
+JANET_THREAD_LOCAL Janet *janet_vm_root_handles;
+JANET_THREAD_LOCAL int32_t janet_vm_root_handle_count;
+JANET_THREAD_LOCAL int32_t janet_vm_root_handle_capacity;
+JANET_THREAD_LOCAL int32_t janet_vm_root_handle_free;
 
 /* Scratch Memory */
 #ifdef JANET_64
@@ -51,80 +68,127 @@ JANET_THREAD_LOCAL void **janet_scratch_mem;
 JANET_THREAD_LOCAL size_t janet_scratch_cap;
 JANET_THREAD_LOCAL size_t janet_scratch_len;
 
-/* Helpers for marking the various gc types */
-static void janet_mark_funcenv(JanetFuncEnv *env);
-static void janet_mark_funcdef(JanetFuncDef *def);
-static void janet_mark_function(JanetFunction *func);
-static void janet_mark_array(JanetArray *array);
-static void janet_mark_table(JanetTable *table);
-static void janet_mark_struct(const JanetKV *st);
-static void janet_mark_tuple(const Janet *tuple);
-static void janet_mark_buffer(JanetBuffer *buffer);
-static void janet_mark_string(const uint8_t *str);
-static void janet_mark_fiber(JanetFiber *fiber);
-static void janet_mark_abstract(void *adata);
-
-/* Local state that is only temporary */
-static JANET_THREAD_LOCAL uint32_t depth = JANET_RECURSION_GUARD;
-static JANET_THREAD_LOCAL uint32_t orig_rootcount;
+/* Marking is driven by an explicit stack of objects whose children have
+ * yet to be marked, instead of by recursion, so deeply nested data cannot
+ * overflow the C stack. janet_mark marks a value and pushes it onto the
+ * mark stack of the current thread, and janet_gc_drain scans objects until
+ * that stack is empty. When marking in parallel, every marking thread
+ * drains its own stack and hands surplus work to idle threads through a
+ * shared pool. */
+typedef struct JanetMarkShared JanetMarkShared;
 
-/* Mark a value */
-void janet_mark(Janet x) {
-    if (depth) {
-        depth--;
-        switch (janet_type(x)) {
-            default:
-                break;
-            case JANET_STRING:
-            case JANET_KEYWORD:
-            case JANET_SYMBOL:
-                janet_mark_string(janet_unwrap_string(x));
-                break;
-            case JANET_FUNCTION:
-                janet_mark_function(janet_unwrap_function(x));
-                break;
-            case JANET_ARRAY:
-                janet_mark_array(janet_unwrap_array(x));
-                break;
-            case JANET_TABLE:
-                janet_mark_table(janet_unwrap_table(x));
-                break;
-            case JANET_STRUCT:
-                janet_mark_struct(janet_unwrap_struct(x));
-                break;
-            case JANET_TUPLE:
-                janet_mark_tuple(janet_unwrap_tuple(x));
-                break;
-            case JANET_BUFFER:
-                janet_mark_buffer(janet_unwrap_buffer(x));
-                break;
-            case JANET_FIBER:
-                janet_mark_fiber(janet_unwrap_fiber(x));
-                break;
-            case JANET_ABSTRACT:
-                janet_mark_abstract(janet_unwrap_abstract(x));
-                break;
-        }
-        depth++;
-    } else {
-        janet_gcroot(x);
+typedef struct {
+    JanetGCObject **items;
+    size_t count;
+    size_t capacity;
+    JanetMarkShared *shared;
+} JanetMarkStack;
+
+/* Weak tables reached during the current collection */
+typedef struct {
+    JanetTable **tables;
+    size_t count;
+    size_t capacity;
+} JanetWeakList;
+
+static JANET_THREAD_LOCAL JanetMarkStack main_mark_stack;
+static JANET_THREAD_LOCAL JanetMarkStack *mark_stack;
+static JANET_THREAD_LOCAL JanetWeakList weak_list;
+
+/* Number of live blocks after the last sweep */
+static JANET_THREAD_LOCAL size_t live_blocks;
+
+#ifdef JANET_GC_PARALLEL
+
+/* Set on threads that are marking in parallel with others */
+static JANET_THREAD_LOCAL int mark_atomic;
+
+struct JanetMarkShared {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    JanetGCObject **pool;
+    size_t pool_count;
+    size_t pool_capacity;
+    JanetWeakList *weak;
+    int workers;
+    int idle;
+    int done;
+};
+
+#define janet_gc_loadflags(m) __atomic_load_n(&janet_gc_header(m)->flags, __ATOMIC_RELAXED)
+
+#else
+
+#define janet_gc_loadflags(m) (janet_gc_header(m)->flags)
+
+#endif
+
+/* Set the mark bit of a block. Returns 0 if it was already set. */
+static int janet_gc_trymark(void *mem) {
+    JanetGCObject *gco = janet_gc_header(mem);
+#ifdef JANET_GC_PARALLEL
+    if (mark_atomic) {
+        if (janet_gc_loadflags(gco) & JANET_MEM_REACHABLE)
+            return 0;
+        return !(__atomic_fetch_or(&gco->flags, JANET_MEM_REACHABLE, __ATOMIC_RELAXED)
+                 & JANET_MEM_REACHABLE);
     }
+#endif
+    if (gco->flags & JANET_MEM_REACHABLE)
+        return 0;
+    gco->flags |= JANET_MEM_REACHABLE;
+    return 1;
 }
 
-static void janet_mark_string(const uint8_t *str) {
-    janet_gc_mark(janet_string_head(str));
+static void janet_mark_stack_push(JanetMarkStack *s, JanetGCObject *mem) {
+    if (s->count == s->capacity) {
+        size_t newcap = 2 * s->capacity + 256;
+        JanetGCObject **newitems = janet_realloc(s->items, newcap * sizeof(JanetGCObject *));
+        if (NULL == newitems) {
+            JANET_OUT_OF_MEMORY;
+        }
+        s->items = newitems;
+        s->capacity = newcap;
+    }
+    s->items[s->count++] = mem;
 }
 
-static void janet_mark_buffer(JanetBuffer *buffer) {
-    janet_gc_mark(buffer);
+/* Mark a block and queue it to have its children marked */
+static void janet_mark_object(void *mem) {
+    if (janet_gc_trymark(mem)) {
+        if (NULL == mark_stack) mark_stack = &main_mark_stack;
+        janet_mark_stack_push(mark_stack, janet_gc_header(mem));
+    }
 }
 
-static void janet_mark_abstract(void *adata) {
-    if (janet_gc_reachable(janet_abstract_head(adata)))
-        return;
-    janet_gc_mark(janet_abstract_head(adata));
-    if (janet_abstract_head(adata)->type->gcmark) {
-        janet_abstract_head(adata)->type->gcmark(adata, janet_abstract_size(adata));
+/* Mark a value */
+void janet_mark(Janet x) {
+    switch (janet_type(x)) {
+        default:
+            break;
+        case JANET_STRING:
+        case JANET_KEYWORD:
+        case JANET_SYMBOL:
+            janet_gc_trymark(janet_string_head(janet_unwrap_string(x)));
+            break;
+        case JANET_BUFFER:
+            janet_gc_trymark(janet_unwrap_buffer(x));
+            break;
+        case JANET_FUNCTION:
+        case JANET_ARRAY:
+        case JANET_TABLE:
+        case JANET_FIBER:
+            janet_mark_object(janet_unwrap_pointer(x));
+            break;
+        case JANET_STRUCT:
+            janet_mark_object(janet_struct_head(janet_unwrap_struct(x)));
+            break;
+        case JANET_TUPLE:
+            janet_mark_object(janet_tuple_head(janet_unwrap_tuple(x)));
+            break;
+        case JANET_ABSTRACT:
+            janet_mark_object(janet_abstract_head(janet_unwrap_abstract(x)));
+            break;
     }
 }
 
@@ -147,118 +211,313 @@ static void janet_mark_kvs(const JanetKV *kvs, int32_t n) {
     }
 }
 
-static void janet_mark_array(JanetArray *array) {
-    if (janet_gc_reachable(array))
-        return;
-    janet_gc_mark(array);
-    janet_mark_many(array->data, array->count);
-}
-
-static void janet_mark_table(JanetTable *table) {
-recur: /* Manual tail recursion */
-    if (janet_gc_reachable(table))
-        return;
-    janet_gc_mark(table);
-    janet_mark_kvs(table->data, table->capacity);
-    if (table->proto) {
-        table = table->proto;
-        goto recur;
+/* Check if a value will survive the current collection */
+static int janet_gc_value_reachable(Janet x) {
+    switch (janet_type(x)) {
+        default:
+            return 1;
+        case JANET_STRING:
+        case JANET_KEYWORD:
+        case JANET_SYMBOL:
+            return janet_gc_reachable(janet_string_head(janet_unwrap_string(x)));
+        case JANET_TUPLE:
+            return janet_gc_reachable(janet_tuple_head(janet_unwrap_tuple(x)));
+        case JANET_STRUCT:
+            return janet_gc_reachable(janet_struct_head(janet_unwrap_struct(x)));
+        case JANET_ABSTRACT:
+            return janet_gc_reachable(janet_abstract_head(janet_unwrap_abstract(x)));
+        case JANET_FUNCTION:
+        case JANET_ARRAY:
+        case JANET_TABLE:
+        case JANET_BUFFER:
+        case JANET_FIBER:
+            return janet_gc_reachable(janet_unwrap_pointer(x));
     }
 }
 
-static void janet_mark_struct(const JanetKV *st) {
-    if (janet_gc_reachable(janet_struct_head(st)))
-        return;
-    janet_gc_mark(janet_struct_head(st));
-    janet_mark_kvs(st, janet_struct_capacity(st));
+/* Only values compared by identity can be held weakly. Strings, symbols,
+ * keywords, tuples and structs compare by contents and are always kept. */
+static int janet_gc_weakref(Janet x) {
+    switch (janet_type(x)) {
+        default:
+            return 0;
+        case JANET_FUNCTION:
+        case JANET_ARRAY:
+        case JANET_TABLE:
+        case JANET_BUFFER:
+        case JANET_FIBER:
+        case JANET_ABSTRACT:
+            return 1;
+    }
 }
 
-static void janet_mark_tuple(const Janet *tuple) {
-    if (janet_gc_reachable(janet_tuple_head(tuple)))
-        return;
-    janet_gc_mark(janet_tuple_head(tuple));
-    janet_mark_many(tuple, janet_tuple_length(tuple));
+static void janet_weak_list_push(JanetWeakList *list, JanetTable *table) {
+    if (list->count == list->capacity) {
+        size_t newcap = 2 * list->capacity + 8;
+        JanetTable **newtables = janet_realloc(list->tables, newcap * sizeof(JanetTable *));
+        if (NULL == newtables) {
+            JANET_OUT_OF_MEMORY;
+        }
+        list->tables = newtables;
+        list->capacity = newcap;
+    }
+    list->tables[list->count++] = table;
 }
 
-/* Helper to mark function environments */
-static void janet_mark_funcenv(JanetFuncEnv *env) {
-    if (janet_gc_reachable(env))
-        return;
-    janet_gc_mark(env);
-    if (env->offset) {
-        /* On stack */
-        janet_mark_fiber(env->as.fiber);
-    } else {
-        /* Not on stack */
-        janet_mark_many(env->as.values, env->length);
+/* Mark the strongly held parts of a weak table, and remember the table so
+ * dead entries can be removed before sweeping. Values under weak keys are
+ * marked later by janet_mark_ephemerons, once it is known which keys live. */
+static void janet_scan_weak_table(JanetTable *table, int32_t flags) {
+    int weakk = flags & JANET_TABLE_FLAG_WEAKK;
+    int weakv = flags & JANET_TABLE_FLAG_WEAKV;
+#ifdef JANET_GC_PARALLEL
+    if (mark_atomic) {
+        JanetMarkShared *sh = mark_stack->shared;
+        pthread_mutex_lock(&sh->lock);
+        janet_weak_list_push(sh->weak, table);
+        pthread_mutex_unlock(&sh->lock);
+    } else
+#endif
+        janet_weak_list_push(&weak_list, table);
+    for (int32_t i = 0; i < table->capacity; i++) {
+        JanetKV *kv = table->data + i;
+        if (janet_checktype(kv->key, JANET_NIL)) continue;
+        if (weakk && janet_gc_weakref(kv->key)) continue;
+        janet_mark(kv->key);
+        if (!(weakv && janet_gc_weakref(kv->value)))
+            janet_mark(kv->value);
     }
 }
 
-/* GC helper to mark a FuncDef */
-static void janet_mark_funcdef(JanetFuncDef *def) {
-    int32_t i;
-    if (janet_gc_reachable(def))
-        return;
-    janet_gc_mark(def);
-    janet_mark_many(def->constants, def->constants_length);
-    for (i = 0; i < def->defs_length; ++i) {
-        janet_mark_funcdef(def->defs[i]);
+/* Mark the children of a block that has been marked */
+static void janet_gc_scan(JanetGCObject *mem) {
+    int32_t flags = janet_gc_loadflags(mem);
+    switch (flags & JANET_MEM_TYPEBITS) {
+        default:
+            break;
+        case JANET_MEMORY_ARRAY: {
+            JanetArray *array = (JanetArray *) mem;
+            janet_mark_many(array->data, array->count);
+            break;
+        }
+        case JANET_MEMORY_TABLE: {
+            JanetTable *table = (JanetTable *) mem;
+            if (flags & JANET_TABLE_FLAG_WEAK) {
+                janet_scan_weak_table(table, flags);
+            } else {
+                janet_mark_kvs(table->data, table->capacity);
+            }
+            if (table->proto)
+                janet_mark_object(table->proto);
+            break;
+        }
+        case JANET_MEMORY_STRUCT: {
+            JanetStructHead *head = (JanetStructHead *) mem;
+            janet_mark_kvs(head->data, head->capacity);
+            break;
+        }
+        case JANET_MEMORY_TUPLE: {
+            JanetTupleHead *head = (JanetTupleHead *) mem;
+            janet_mark_many(head->data, head->length);
+            break;
+        }
+        case JANET_MEMORY_FUNCTION: {
+            JanetFunction *func = (JanetFunction *) mem;
+            int32_t numenvs = func->def->environments_length;
+            for (int32_t i = 0; i < numenvs; ++i)
+                janet_mark_object(func->envs[i]);
+            janet_mark_object(func->def);
+            break;
+        }
+        case JANET_MEMORY_FUNCENV: {
+            JanetFuncEnv *env = (JanetFuncEnv *) mem;
+            if (env->offset) {
+                /* On stack */
+                janet_mark_object(env->as.fiber);
+            } else {
+                /* Not on stack */
+                janet_mark_many(env->as.values, env->length);
+            }
+            break;
+        }
+        case JANET_MEMORY_FUNCDEF: {
+            JanetFuncDef *def = (JanetFuncDef *) mem;
+            janet_mark_many(def->constants, def->constants_length);
+            for (int32_t i = 0; i < def->defs_length; ++i)
+                janet_mark_object(def->defs[i]);
+            if (def->source)
+                janet_gc_trymark(janet_string_head(def->source));
+            if (def->name)
+                janet_gc_trymark(janet_string_head(def->name));
+            break;
+        }
+        case JANET_MEMORY_FIBER: {
+            JanetFiber *fiber = (JanetFiber *) mem;
+            int32_t i, j;
+
+            /* Fibers that are not running hold no pointers into their stack, so
+             * unused stack space left over from deep recursion can be released. */
+            if (janet_fiber_status(fiber) != JANET_STATUS_ALIVE)
+                janet_fiber_shrink(fiber);
+
+            /* Mark values on the argument stack */
+            janet_mark_many(fiber->data + fiber->stackstart,
+                            fiber->stacktop - fiber->stackstart);
+
+            i = fiber->frame;
+            j = fiber->stackstart - JANET_FRAME_SIZE;
+            while (i > 0) {
+                JanetStackFrame *frame = (JanetStackFrame *)(fiber->data + i - JANET_FRAME_SIZE);
+                if (NULL != frame->func)
+                    janet_mark_object(frame->func);
+                if (NULL != frame->env)
+                    janet_mark_object(frame->env);
+                /* Mark all values in the stack frame */
+                janet_mark_many(fiber->data + i, j - i);
+                j = i - JANET_FRAME_SIZE;
+                i = frame->prevframe;
+            }
+
+            if (fiber->env)
+                janet_mark_object(fiber->env);
+            if (fiber->child)
+                janet_mark_object(fiber->child);
+            break;
+        }
+        case JANET_MEMORY_ABSTRACT: {
+            JanetAbstractHead *head = (JanetAbstractHead *) mem;
+            if (head->type->gcmark)
+                head->type->gcmark(head->data, head->size);
+            break;
+        }
     }
-    if (def->source)
-        janet_mark_string(def->source);
-    if (def->name)
-        janet_mark_string(def->name);
 }
 
-static void janet_mark_function(JanetFunction *func) {
-    int32_t i;
-    int32_t numenvs;
-    if (janet_gc_reachable(func))
-        return;
-    janet_gc_mark(func);
-    numenvs = func->def->environments_length;
-    for (i = 0; i < numenvs; ++i) {
-        janet_mark_funcenv(func->envs[i]);
+/* Scan objects on the mark stack of this thread until it is empty */
+static void janet_gc_drain(void) {
+    JanetMarkStack *s = mark_stack;
+    while (s->count) {
+        janet_gc_scan(s->items[--s->count]);
     }
-    janet_mark_funcdef(func->def);
 }
 
-static void janet_mark_fiber(JanetFiber *fiber) {
-    int32_t i, j;
-    JanetStackFrame *frame;
-recur:
-    if (janet_gc_reachable(fiber))
-        return;
-    janet_gc_mark(fiber);
+#ifdef JANET_GC_PARALLEL
 
-    /* Mark values on the argument stack */
-    janet_mark_many(fiber->data + fiber->stackstart,
-                    fiber->stacktop - fiber->stackstart);
+/* Move the older half of a thread's mark stack to the shared pool */
+static void janet_mark_share(JanetMarkStack *s) {
+    JanetMarkShared *sh = s->shared;
+    size_t n = s->count / 2;
+    pthread_mutex_lock(&sh->lock);
+    if (sh->pool_count + n > sh->pool_capacity) {
+        size_t newcap = 2 * (sh->pool_count + n);
+        JanetGCObject **newpool = janet_realloc(sh->pool, newcap * sizeof(JanetGCObject *));
+        if (NULL == newpool) {
+            JANET_OUT_OF_MEMORY;
+        }
+        sh->pool = newpool;
+        sh->pool_capacity = newcap;
+    }
+    memcpy(sh->pool + sh->pool_count, s->items, n * sizeof(JanetGCObject *));
+    sh->pool_count += n;
+    pthread_cond_broadcast(&sh->cond);
+    pthread_mutex_unlock(&sh->lock);
+    memmove(s->items, s->items + n, (s->count - n) * sizeof(JanetGCObject *));
+    s->count -= n;
+}
 
-    i = fiber->frame;
-    j = fiber->stackstart - JANET_FRAME_SIZE;
-    while (i > 0) {
-        frame = (JanetStackFrame *)(fiber->data + i - JANET_FRAME_SIZE);
-        if (NULL != frame->func)
-            janet_mark_function(frame->func);
-        if (NULL != frame->env)
-            janet_mark_funcenv(frame->env);
-        /* Mark all values in the stack frame */
-        janet_mark_many(fiber->data + i, j - i);
-        j = i - JANET_FRAME_SIZE;
-        i = frame->prevframe;
+/* Mark until every marking thread runs out of work */
+static void janet_mark_work(JanetMarkStack *s) {
+    JanetMarkShared *sh = s->shared;
+    for (;;) {
+        while (s->count) {
+            janet_gc_scan(s->items[--s->count]);
+            if (s->count >= JANET_GC_SHARE_MIN && __atomic_load_n(&sh->idle, __ATOMIC_RELAXED))
+                janet_mark_share(s);
+        }
+        pthread_mutex_lock(&sh->lock);
+        __atomic_add_fetch(&sh->idle, 1, __ATOMIC_RELAXED);
+        while (!sh->pool_count && !sh->done) {
+            if (sh->idle == sh->workers) {
+                sh->done = 1;
+                pthread_cond_broadcast(&sh->cond);
+                break;
+            }
+            pthread_cond_wait(&sh->cond, &sh->lock);
+        }
+        if (sh->done) {
+            pthread_mutex_unlock(&sh->lock);
+            return;
+        }
+        __atomic_sub_fetch(&sh->idle, 1, __ATOMIC_RELAXED);
+        size_t n = (sh->pool_count + 1) / 2;
+        sh->pool_count -= n;
+        for (size_t i = 0; i < n; i++)
+            janet_mark_stack_push(s, sh->pool[sh->pool_count + i]);
+        pthread_mutex_unlock(&sh->lock);
     }
+}
 
-    if (fiber->env)
-        janet_mark_table(fiber->env);
+static void *janet_mark_thread(void *arg) {
+    JanetMarkStack *s = (JanetMarkStack *) arg;
+    mark_stack = s;
+    mark_atomic = 1;
+    janet_mark_work(s);
+    return NULL;
+}
 
-    /* Explicit tail recursion */
-    if (fiber->child) {
-        fiber = fiber->child;
-        goto recur;
+/* Mark everything reachable from the main thread's mark stack using
+ * nthreads threads, including this one */
+static void janet_mark_parallel(uint32_t nthreads) {
+    JanetMarkShared sh;
+    uint32_t nhelpers = nthreads - 1;
+    JanetMarkStack *stacks = janet_calloc(nhelpers, sizeof(JanetMarkStack));
+    pthread_t *threads = janet_malloc(nhelpers * sizeof(pthread_t));
+    if (NULL == stacks || NULL == threads) {
+        JANET_OUT_OF_MEMORY;
     }
+    pthread_mutex_init(&sh.lock, NULL);
+    pthread_cond_init(&sh.cond, NULL);
+    sh.pool = NULL;
+    sh.pool_count = 0;
+    sh.pool_capacity = 0;
+    sh.weak = &weak_list;
+    sh.workers = 1;
+    sh.idle = 0;
+    sh.done = 0;
+    main_mark_stack.shared = &sh;
+    mark_atomic = 1;
+    uint32_t started = 0;
+    for (uint32_t i = 0; i < nhelpers; i++) {
+        stacks[started].shared = &sh;
+        pthread_mutex_lock(&sh.lock);
+        sh.workers++;
+        pthread_mutex_unlock(&sh.lock);
+        if (pthread_create(threads + started, NULL, janet_mark_thread, stacks + started)) {
+            /* Carry on with fewer threads */
+            pthread_mutex_lock(&sh.lock);
+            sh.workers--;
+            pthread_cond_broadcast(&sh.cond);
+            pthread_mutex_unlock(&sh.lock);
+            break;
+        }
+        started++;
+    }
+    janet_mark_work(&main_mark_stack);
+    for (uint32_t i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+        janet_free(stacks[i].items);
+    }
+    mark_atomic = 0;
+    main_mark_stack.shared = NULL;
+    pthread_cond_destroy(&sh.cond);
+    pthread_mutex_destroy(&sh.lock);
+    janet_free(sh.pool);
+    janet_free(stacks);
+    janet_free(threads);
 }
 
+#endif
+
 /* Deinitialize a block of memory */
 static void janet_deinit_block(JanetGCObject *mem) {
     switch (mem->flags & JANET_MEM_TYPEBITS) {
@@ -269,13 +528,14 @@ static void janet_deinit_block(JanetGCObject *mem) {
             janet_symbol_deinit(((JanetStringHead *) mem)->data);
             break;
         case JANET_MEMORY_ARRAY:
-            free(((JanetArray *) mem)->data);
+            janet_free(((JanetArray *) mem)->data);
             break;
         case JANET_MEMORY_TABLE:
-            free(((JanetTable *) mem)->data);
+            if (!(mem->flags & JANET_TABLE_FLAG_INLINE))
+                janet_free(((JanetTable *) mem)->data);
             break;
         case JANET_MEMORY_FIBER:
-            free(((JanetFiber *)mem)->data);
+            janet_free(((JanetFiber *)mem)->data);
             break;
         case JANET_MEMORY_BUFFER:
             janet_buffer_deinit((JanetBuffer *) mem);
@@ -290,44 +550,118 @@ static void janet_deinit_block(JanetGCObject *mem) {
         case JANET_MEMORY_FUNCENV: {
             JanetFuncEnv *env = (JanetFuncEnv *)mem;
             if (0 == env->offset)
-                free(env->as.values);
+                janet_free(env->as.values);
         }
         break;
         case JANET_MEMORY_FUNCDEF: {
             JanetFuncDef *def = (JanetFuncDef *)mem;
             /* TODO - get this all with one alloc and one free */
-            free(def->defs);
-            free(def->environments);
-            free(def->constants);
-            free(def->bytecode);
-            free(def->sourcemap);
+            janet_free(def->defs);
+            janet_free(def->environments);
+            janet_free(def->constants);
+            janet_free(def->bytecode);
+            janet_free(def->sourcemap);
+            janet_free(def->sourcemap_packed);
         }
         break;
     }
 }
 
+/* Estimate the bytes used by a block, including memory it owns */
+static size_t janet_gc_blocksize(JanetGCObject *mem) {
+    switch (mem->flags & JANET_MEM_TYPEBITS) {
+        default:
+            return sizeof(JanetGCObject);
+        case JANET_MEMORY_STRING:
+        case JANET_MEMORY_SYMBOL:
+            return sizeof(JanetStringHead) + ((JanetStringHead *) mem)->length + 1;
+        case JANET_MEMORY_ARRAY:
+            return sizeof(JanetArray) + sizeof(Janet) * ((JanetArray *) mem)->capacity;
+        case JANET_MEMORY_TUPLE:
+            return sizeof(JanetTupleHead) + sizeof(Janet) * ((JanetTupleHead *) mem)->length;
+        case JANET_MEMORY_TABLE: {
+            /* Inline buckets are counted here too, even once outgrown */
+            JanetTable *table = (JanetTable *) mem;
+            int32_t buckets = table->capacity;
+            if (!(table->gc.flags & JANET_TABLE_FLAG_INLINE))
+                buckets += janet_table_inline_cap(table);
+            return sizeof(JanetTable) + sizeof(JanetKV) * buckets;
+        }
+        case JANET_MEMORY_STRUCT:
+            return sizeof(JanetStructHead) + sizeof(JanetKV) * ((JanetStructHead *) mem)->capacity;
+        case JANET_MEMORY_FIBER:
+            return sizeof(JanetFiber) + sizeof(Janet) * ((JanetFiber *) mem)->capacity;
+        case JANET_MEMORY_BUFFER:
+            return sizeof(JanetBuffer) + ((JanetBuffer *) mem)->capacity;
+        case JANET_MEMORY_FUNCTION:
+            return sizeof(JanetFunction) +
+                   sizeof(JanetFuncEnv *) * ((JanetFunction *) mem)->def->environments_length;
+        case JANET_MEMORY_ABSTRACT:
+            return sizeof(JanetAbstractHead) + ((JanetAbstractHead *) mem)->size;
+        case JANET_MEMORY_FUNCENV: {
+            JanetFuncEnv *env = (JanetFuncEnv *)mem;
+            return sizeof(JanetFuncEnv) + (0 == env->offset ? sizeof(Janet) * env->length : 0);
+        }
+        case JANET_MEMORY_FUNCDEF: {
+            JanetFuncDef *def = (JanetFuncDef *)mem;
+            return sizeof(JanetFuncDef) +
+                   sizeof(int32_t) * def->environments_length +
+                   sizeof(Janet) * def->constants_length +
+                   sizeof(JanetFuncDef *) * def->defs_length +
+                   sizeof(uint32_t) * def->bytecode_length +
+                   (def->sourcemap ? sizeof(JanetSourceMapping) * def->bytecode_length : 0) +
+                   def->sourcemap_length;
+        }
+    }
+}
+
 /* Iterate over all allocated memory, and free memory that is not
  * marked as reachable. Flip the gc color flag for next sweep. */
 void janet_sweep() {
     JanetGCObject *previous = NULL;
     JanetGCObject *current = janet_vm_blocks;
     JanetGCObject *next;
+    size_t live = 0;
+    size_t live_bytes = 0;
+    janet_srcindex_prune();
     while (NULL != current) {
         next = current->next;
         if (current->flags & (JANET_MEM_REACHABLE | JANET_MEM_DISABLED)) {
             previous = current;
             current->flags &= ~JANET_MEM_REACHABLE;
+            live++;
+            live_bytes += janet_gc_blocksize(current);
         } else {
-            janet_deinit_block(current);
             if (NULL != previous) {
                 previous->next = next;
             } else {
                 janet_vm_blocks = next;
             }
-            free(current);
+            if ((current->flags & JANET_ABSTRACT_FLAG_DEFERRED) &&
+                    (current->flags & JANET_MEM_TYPEBITS) == JANET_MEMORY_ABSTRACT) {
+                /* Finalize later, outside of the collection pause */
+                current->next = janet_vm_finalizers;
+                janet_vm_finalizers = current;
+            } else {
+                janet_deinit_block(current);
+                janet_free(current);
+            }
         }
         current = next;
     }
+    live_blocks = live;
+    janet_vm_heap_live = live_bytes;
+}
+
+/* Run up to n queued finalizers of deferred abstract values. The interpreter
+ * calls this at safe points while the queue is not empty. */
+void janet_gcfinalize(uint32_t n) {
+    while (NULL != janet_vm_finalizers && n--) {
+        JanetGCObject *mem = janet_vm_finalizers;
+        janet_vm_finalizers = mem->next;
+        janet_deinit_block(mem);
+        janet_free(mem);
+    }
 }
 
 /* Allocate some memory that is tracked for garbage collection */
@@ -336,7 +670,12 @@ void *janet_gcalloc(enum JanetMemoryType type, size_t size) {
 
     /* Make sure everything is inited */
     janet_assert(NULL != janet_vm_cache, "please initialize janet before use");
-    mem = malloc(size);
+    /* Abstract headers, allocated untyped by janet_abstract_begin, often wrap
+     * a resource acquired just before, such as a FILE, which would leak if
+     * this raised. Their size still counts towards the limit from the next
+     * collection. */
+    if (janet_vm_heap_limit && type != JANET_MEMORY_NONE) janet_gccheck(size);
+    mem = janet_malloc(size);
 
     /* Check for bad malloc */
     if (NULL == mem) {
@@ -354,11 +693,72 @@ void *janet_gcalloc(enum JanetMemoryType type, size_t size) {
     return (void *)mem;
 }
 
+/* Report memory allocated outside of the garbage collector, such as a
+ * buffer malloc'd by an abstract type, so that it counts towards the next
+ * collection. Freed memory does not need to be reported, as the collector
+ * only counts bytes allocated since the last collection. */
+void janet_gcpressure(size_t s) {
+    if (s > UINT32_MAX - janet_vm_next_collection) {
+        janet_vm_next_collection = UINT32_MAX;
+    } else {
+        janet_vm_next_collection += (uint32_t) s;
+    }
+}
+
+/* Limit the estimated heap size of this thread's VM to limit bytes, or
+ * remove the limit if limit is 0. Allocations that would go over the limit
+ * raise an error in the running fiber instead of allocating. */
+void janet_gcsetlimit(size_t limit) {
+    janet_vm_heap_limit = limit;
+    janet_gc_settrigger();
+}
+
+int janet_gcexceeds(size_t n) {
+    size_t limit = janet_vm_heap_limit;
+    size_t used = janet_vm_heap_live + janet_vm_next_collection;
+    /* Outside of a fiber there is nothing to raise the error in */
+    if (!limit || NULL == janet_vm_return_reg) return 0;
+    if (janet_vm_heap_exceeded) limit += JANET_HEAP_LIMIT_SLACK;
+    return n > limit || used > limit - n;
+}
+
+void janet_gccheck(size_t n) {
+    if (!janet_gcexceeds(n)) return;
+    size_t limit;
+    /* The garbage left by the failed work can only be freed at a safe
+     * point, so let the unwinding and handlers allocate a little until the
+     * next one. The error message must not trip the limit itself. */
+    janet_vm_heap_exceeded = 1;
+    janet_vm_gc_trigger = 0;
+    limit = janet_vm_heap_limit;
+    janet_vm_heap_limit = 0;
+    Janet message = janet_cstringv("heap limit exceeded");
+    janet_vm_heap_limit = limit;
+    janet_panicv(message);
+}
+
+/* Collect at safe points once the interval has been allocated or, with a heap
+ * limit, half of the space left under the limit. Most garbage is then freed
+ * before an allocation reaches the limit, as the collector cannot run from
+ * inside an allocation. */
+void janet_gc_settrigger(void) {
+    uint32_t trigger = janet_vm_gc_interval;
+    janet_vm_heap_exceeded = 0;
+    if (janet_vm_heap_limit) {
+        size_t headroom = janet_vm_heap_limit > janet_vm_heap_live
+                          ? (janet_vm_heap_limit - janet_vm_heap_live) / 2
+                          : 0;
+        if (headroom < 1) headroom = 1;
+        if (headroom < trigger) trigger = (uint32_t) headroom;
+    }
+    janet_vm_gc_trigger = trigger;
+}
+
 static void free_one_scratch(void *mem) {
     ScratchFinalizer finalize = *(ScratchFinalizer *)mem;
     if (finalize)
         finalize((char *)mem + SCRATCH_HDR_SIZE);
-    free(mem);
+    janet_free(mem);
 }
 
 /* Free all allocated scratch memory */
@@ -369,20 +769,76 @@ static void janet_free_all_scratch(void) {
     janet_scratch_len = 0;
 }
 
+/* Mark the values of weak-keyed tables whose keys turned out to be
+ * reachable. Marking a value can make more keys reachable, so repeat
+ * until nothing changes. */
+static void janet_mark_ephemerons(void) {
+    int progress;
+    do {
+        progress = 0;
+        for (size_t i = 0; i < weak_list.count; i++) {
+            JanetTable *table = weak_list.tables[i];
+            if (!(table->gc.flags & JANET_TABLE_FLAG_WEAKK)) continue;
+            int weakv = table->gc.flags & JANET_TABLE_FLAG_WEAKV;
+            for (int32_t j = 0; j < table->capacity; j++) {
+                JanetKV *kv = table->data + j;
+                if (!janet_gc_weakref(kv->key)) continue;
+                if (!janet_gc_value_reachable(kv->key)) continue;
+                if (weakv && janet_gc_weakref(kv->value)) continue;
+                if (janet_gc_value_reachable(kv->value)) continue;
+                janet_mark(kv->value);
+                janet_gc_drain();
+                progress = 1;
+            }
+        }
+    } while (progress);
+}
+
+/* Remove entries of weak tables whose weakly held key or value is about
+ * to be collected */
+static void janet_clear_weak(void) {
+    for (size_t i = 0; i < weak_list.count; i++) {
+        JanetTable *table = weak_list.tables[i];
+        int weakk = table->gc.flags & JANET_TABLE_FLAG_WEAKK;
+        int weakv = table->gc.flags & JANET_TABLE_FLAG_WEAKV;
+        for (int32_t j = 0; j < table->capacity; j++) {
+            JanetKV *kv = table->data + j;
+            if (janet_checktype(kv->key, JANET_NIL)) continue;
+            if ((weakk && janet_gc_weakref(kv->key) && !janet_gc_value_reachable(kv->key)) ||
+                    (weakv && janet_gc_weakref(kv->value) && !janet_gc_value_reachable(kv->value))) {
+                kv->key = janet_wrap_nil();
+                kv->value = janet_wrap_false();
+                table->count--;
+                table->deleted++;
+            }
+        }
+    }
+    weak_list.count = 0;
+}
+
 /* Run garbage collection */
 void janet_collect(void) {
     uint32_t i;
     if (janet_vm_gc_suspend) return;
-    depth = JANET_RECURSION_GUARD;
-    orig_rootcount = janet_vm_root_count;
-    for (i = 0; i < orig_rootcount; i++)
+    mark_stack = &main_mark_stack;
+    for (i = 0; i < janet_vm_root_count; i++)
         janet_mark(janet_vm_roots[i]);
-    while (orig_rootcount < janet_vm_root_count) {
-        Janet x = janet_vm_roots[--janet_vm_root_count];
-        janet_mark(x);
-    }
+    /* Free handle slots hold numbers, which marking ignores */
+    for (int32_t j = 0; j < janet_vm_root_handle_capacity; j++)
+        janet_mark(janet_vm_root_handles[j]);
+#ifdef JANET_GC_PARALLEL
+    /* Starting threads only pays off for large heaps */
+    if (janet_vm_gc_threads > 1 && live_blocks >= janet_vm_gc_parallel_min) {
+        janet_mark_parallel(janet_vm_gc_threads);
+    } else
+#endif
+        janet_gc_drain();
+    janet_mark_ephemerons();
+    janet_clear_weak();
     janet_sweep();
+    janet_dyn_invalidate();
     janet_vm_next_collection = 0;
+    janet_gc_settrigger();
     janet_free_all_scratch();
 }
 
@@ -393,7 +849,7 @@ void janet_gcroot(Janet root) {
     uint32_t newcount = janet_vm_root_count + 1;
     if (newcount > janet_vm_root_capacity) {
         uint32_t newcap = 2 * newcount;
-        janet_vm_roots = realloc(janet_vm_roots, sizeof(Janet) * newcap);
+        janet_vm_roots = janet_realloc(janet_vm_roots, sizeof(Janet) * newcap);
         if (NULL == janet_vm_roots) {
             JANET_OUT_OF_MEMORY;
         }
@@ -447,18 +903,67 @@ int janet_gcunrootall(Janet root) {
     return ret;
 }
 
+/* Add a root value to the GC and return a handle for removing it again.
+ * Unlike janet_gcroot and janet_gcunroot, both operations take constant
+ * time no matter how many values are rooted. */
+JanetRootHandle janet_gcroot_handle(Janet root) {
+    if (janet_vm_root_handle_free < 0) {
+        int32_t oldcap = janet_vm_root_handle_capacity;
+        if (oldcap > INT32_MAX / 2 - 8) {
+            JANET_OUT_OF_MEMORY;
+        }
+        int32_t newcap = 2 * oldcap + 16;
+        Janet *newhandles = janet_realloc(janet_vm_root_handles, sizeof(Janet) * newcap);
+        if (NULL == newhandles) {
+            JANET_OUT_OF_MEMORY;
+        }
+        /* Thread the new slots onto the free list */
+        for (int32_t i = oldcap; i < newcap - 1; i++)
+            newhandles[i] = janet_wrap_integer(i + 1);
+        newhandles[newcap - 1] = janet_wrap_integer(-1);
+        janet_vm_root_handles = newhandles;
+        janet_vm_root_handle_capacity = newcap;
+        janet_vm_root_handle_free = oldcap;
+    }
+    JanetRootHandle handle = janet_vm_root_handle_free;
+    janet_vm_root_handle_free = janet_unwrap_integer(janet_vm_root_handles[handle]);
+    janet_vm_root_handles[handle] = root;
+    janet_vm_root_handle_count++;
+    return handle;
+}
+
+/* Remove a root added with janet_gcroot_handle. Each handle must be
+ * released exactly once. */
+void janet_gcunroot_handle(JanetRootHandle handle) {
+    janet_vm_root_handles[handle] = janet_wrap_integer(janet_vm_root_handle_free);
+    janet_vm_root_handle_free = handle;
+    janet_vm_root_handle_count--;
+}
+
 /* Free all allocated memory */
 void janet_clear_memory(void) {
     JanetGCObject *current = janet_vm_blocks;
+    janet_srcindex_deinit();
+    janet_gcfinalize(UINT32_MAX);
     while (NULL != current) {
         janet_deinit_block(current);
         JanetGCObject *next = current->next;
-        free(current);
+        janet_free(current);
         current = next;
     }
     janet_vm_blocks = NULL;
+    janet_free(weak_list.tables);
+    weak_list.tables = NULL;
+    weak_list.count = 0;
+    weak_list.capacity = 0;
+    janet_free(main_mark_stack.items);
+    main_mark_stack.items = NULL;
+    main_mark_stack.count = 0;
+    main_mark_stack.capacity = 0;
+    live_blocks = 0;
+    janet_dyn_invalidate();
     janet_free_all_scratch();
-    free(janet_scratch_mem);
+    janet_free(janet_scratch_mem);
 }
 
 /* Primitives for suspending GC. */
@@ -472,14 +977,14 @@ void janet_gcunlock(int handle) {
 /* Scratch memory API */
 
 void *janet_smalloc(size_t size) {
-    void *mem = malloc(SCRATCH_HDR_SIZE + size);
+    void *mem = janet_malloc(SCRATCH_HDR_SIZE + size);
     if (NULL == mem) {
         JANET_OUT_OF_MEMORY;
     }
     *(ScratchFinalizer *)mem = NULL;
     if (janet_scratch_len == janet_scratch_cap) {
         size_t newcap = 2 * janet_scratch_cap + 2;
-        void **newmem = (void **) realloc(janet_scratch_mem, newcap * sizeof(void *));
+        void **newmem = (void **) janet_realloc(janet_scratch_mem, newcap * sizeof(void *));
         if (NULL == newmem) {
             JANET_OUT_OF_MEMORY;
         }
@@ -496,7 +1001,7 @@ void *janet_srealloc(void *mem, size_t size) {
     if (janet_scratch_len) {
         for (size_t i = janet_scratch_len - 1; ; i--) {
             if (janet_scratch_mem[i] == mem) {
-                void *newmem = realloc(mem, size + SCRATCH_HDR_SIZE);
+                void *newmem = janet_realloc(mem, size + SCRATCH_HDR_SIZE);
                 if (NULL == newmem) {
                     JANET_OUT_OF_MEMORY;
                 }
@@ -34,6 +34,18 @@
 #define JANET_MEM_REACHABLE 0x100
 #define JANET_MEM_DISABLED 0x200
 
+/* Abstract values whose gc callback is run after the collection that
+ * freed them, in batches at safe points, instead of during the sweep. */
+#define JANET_ABSTRACT_FLAG_DEFERRED 0x10000
+#define JANET_FINALIZE_BATCH 16
+
+/* Parallel marking. Threads are only started for heaps of at least
+ * janet_vm_gc_parallel_min blocks, JANET_GC_PARALLEL_MIN by default, and a
+ * marking thread hands work to idle threads once it has JANET_GC_SHARE_MIN
+ * objects left to scan. */
+#define JANET_GC_PARALLEL_MIN 100000
+#define JANET_GC_SHARE_MIN 64
+
 #define janet_gc_settype(m, t) ((janet_gc_header(m)->flags |= (0xFF & (t))))
 #define janet_gc_type(m) (janet_gc_header(m)->flags & 0xFF)
 
@@ -61,4 +73,21 @@ enum JanetMemoryType {
  * and then call when janet_enablegc when it is initailize and reachable by the gc (on the JANET stack) */
 void *janet_gcalloc(enum JanetMemoryType type, size_t size);
 
+/* Run up to n queued finalizers of deferred abstract values */
+void janet_gcfinalize(uint32_t n);
+
+/* After the heap limit is hit, error handling may allocate this many bytes
+ * past the limit until the next collection frees the failed work. */
+#define JANET_HEAP_LIMIT_SLACK 0x10000
+
+/* Raise an error if allocating n more bytes would go over the heap limit.
+ * janet_gcexceeds only tests it, so that memory outside of the heap can be
+ * freed before the error is raised. */
+int janet_gcexceeds(size_t n);
+void janet_gccheck(size_t n);
+
+/* Recompute when the interpreter next collects after the interval or
+ * heap limit changes */
+void janet_gc_settrigger(void);
+
 #endif
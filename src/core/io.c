@@ -93,7 +93,7 @@ static int checkflags(const uint8_t *str) {
 }
 
 static Janet makef(FILE *f, int flags, char *buffer) {
-    IOFile *iof = (IOFile *) janet_abstract(&cfun_io_filetype, sizeof(IOFile));
+    IOFile *iof = (IOFile *) janet_abstract_deferred(&cfun_io_filetype, sizeof(IOFile));
     iof->file = f;
     iof->flags = flags;
     iof->buf = buffer;
@@ -107,11 +107,12 @@ static Janet makef_setbuf(FILE *f, int flags, int bufsiz) {
 		if (bufsiz <= 0 && setvbuf(f, NULL, _IONBF, 0))
 			return janet_wrap_nil();
 
-		buffer = malloc(bufsiz);
+		buffer = janet_malloc(bufsiz);
 
 		if (NULL == buffer) {
 			JANET_OUT_OF_MEMORY;
 		}
+		janet_gcpressure(bufsiz);
 
 		if (setvbuf(f, buffer, _IOFBF, bufsiz))
 			return janet_wrap_nil();
@@ -299,7 +300,7 @@ static int cfun_io_gc(void *p, size_t len) {
 
     if (!(iof->flags & (JANET_FILE_NOT_CLOSEABLE | JANET_FILE_CLOSED))) {
         if (NULL != iof->buf) {
-            free(iof->buf);
+            janet_free(iof->buf);
         }
         return fclose(iof->file);
     }
@@ -324,14 +325,14 @@ static Janet cfun_io_fclose(int32_t argc, Janet *argv) {
         iof->flags |= JANET_FILE_CLOSED;
         if (status == -1) janet_panic("could not close file");
         if (NULL != iof->buf) {
-            free(iof->buf);
+            janet_free(iof->buf);
         }
         return janet_wrap_integer(WEXITSTATUS(status));
     } else {
         if (fclose(iof->file)) janet_panic("could not close file");
         iof->flags |= JANET_FILE_CLOSED;
         if (NULL != iof->buf) {
-            free(iof->buf);
+            janet_free(iof->buf);
         }
         return janet_wrap_nil();
     }
@@ -420,23 +421,41 @@ static Janet cfun_io_print_impl(int32_t argc, Janet *argv,
             break;
         }
     }
+    JanetBuffer scratch;
+    janet_buffer_init(&scratch, 0);
     for (int32_t i = 0; i < argc; ++i) {
         int32_t len;
         const uint8_t *vstr;
-        if (janet_checktype(argv[i], JANET_BUFFER)) {
-            JanetBuffer *b = janet_unwrap_buffer(argv[i]);
-            vstr = b->data;
-            len = b->count;
-        } else {
-            vstr = janet_to_string(argv[i]);
-            len = janet_string_length(vstr);
+        switch (janet_type(argv[i])) {
+            case JANET_BUFFER: {
+                JanetBuffer *b = janet_unwrap_buffer(argv[i]);
+                vstr = b->data;
+                len = b->count;
+                break;
+            }
+            case JANET_STRING:
+            case JANET_SYMBOL:
+            case JANET_KEYWORD:
+                vstr = janet_unwrap_string(argv[i]);
+                len = janet_string_length(vstr);
+                break;
+            default:
+                /* Describe other values into a reused buffer rather than
+                 * interning a new string for each one. */
+                scratch.count = 0;
+                janet_to_string_b(&scratch, argv[i]);
+                vstr = scratch.data;
+                len = scratch.count;
+                break;
         }
         if (len) {
             if (1 != fwrite(vstr, len, 1, f)) {
+                janet_buffer_deinit(&scratch);
                 janet_panicf("could not print %d bytes to (dyn :%s)", len, name);
             }
         }
     }
+    janet_buffer_deinit(&scratch);
     if (newline)
         putc('\n', f);
     return janet_wrap_nil();
@@ -487,8 +506,10 @@ static Janet cfun_io_printf_impl(int32_t argc, Janet *argv, int newline,
             break;
         }
     }
+    /* Large output (such as pretty printed data structures) is written out
+     * to the file in chunks while formatting. */
     JanetBuffer *buf = janet_buffer(10);
-    janet_buffer_format(buf, fmt, 0, argc, argv);
+    janet_buffer_format_stream(buf, f, fmt, 0, argc, argv);
     if (newline) janet_buffer_push_u8(buf, '\n');
     if (buf->count) {
         if (1 != fwrite(buf->data, buf->count, 1, f)) {
@@ -498,7 +519,7 @@ static Janet cfun_io_printf_impl(int32_t argc, Janet *argv, int newline,
     /* Clear buffer to make things easier for GC */
     buf->count = 0;
     buf->capacity = 0;
-    free(buf->data);
+    janet_free(buf->data);
     buf->data = NULL;
     return janet_wrap_nil();
 }
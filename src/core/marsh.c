@@ -201,7 +201,8 @@ static void janet_func_addflags(JanetFuncDef *def) {
     if (def->source) def->flags |= JANET_FUNCDEF_FLAG_HASSOURCE;
     if (def->defs) def->flags |= JANET_FUNCDEF_FLAG_HASDEFS;
     if (def->environments) def->flags |= JANET_FUNCDEF_FLAG_HASENVS;
-    if (def->sourcemap) def->flags |= JANET_FUNCDEF_FLAG_HASSOURCEMAP;
+    if (def->sourcemap_packed) def->flags |= JANET_FUNCDEF_FLAG_HASSOURCEMAP | JANET_FUNCDEF_FLAG_PACKEDSOURCEMAP;
+    else if (def->sourcemap) def->flags |= JANET_FUNCDEF_FLAG_HASSOURCEMAP;
 }
 
 /* Marshal a function def */
@@ -254,7 +255,11 @@ static void marshal_one_def(MarshalState *st, JanetFuncDef *def, int flags) {
         marshal_one_def(st, def->defs[i], flags);
 
     /* marshal source maps if needed */
-    if (def->flags & JANET_FUNCDEF_FLAG_HASSOURCEMAP) {
+    if (def->flags & JANET_FUNCDEF_FLAG_PACKEDSOURCEMAP) {
+        pushint(st, def->sourcemap_length);
+        pushbytes(st, def->sourcemap_packed, def->sourcemap_length);
+    } else if (def->flags & JANET_FUNCDEF_FLAG_HASSOURCEMAP) {
+        /* An unpacked sourcemap set from C uses the older format */
         int32_t current = 0;
         for (int32_t i = 0; i < def->bytecode_length; i++) {
             JanetSourceMapping map = def->sourcemap[i];
@@ -692,7 +697,7 @@ static const uint8_t *unmarshal_one_env(
                 janet_panic("invalid funcenv length");
         } else {
             /* Off stack variant */
-            env->as.values = malloc(sizeof(Janet) * length);
+            env->as.values = janet_malloc(sizeof(Janet) * length);
             if (!env->as.values) {
                 JANET_OUT_OF_MEMORY;
             }
@@ -729,6 +734,9 @@ static const uint8_t *unmarshal_one_def(
         def->bytecode_length = 0;
         def->name = NULL;
         def->source = NULL;
+        def->sourcemap = NULL;
+        def->sourcemap_packed = NULL;
+        def->sourcemap_length = 0;
         janet_v_push(st->lookup_defs, def);
 
         /* Set default lengths to zero */
@@ -768,7 +776,7 @@ static const uint8_t *unmarshal_one_def(
 
         /* Unmarshal constants */
         if (constants_length) {
-            def->constants = malloc(sizeof(Janet) * constants_length);
+            def->constants = janet_malloc(sizeof(Janet) * constants_length);
             if (!def->constants) {
                 JANET_OUT_OF_MEMORY;
             }
@@ -780,7 +788,7 @@ static const uint8_t *unmarshal_one_def(
         def->constants_length = constants_length;
 
         /* Unmarshal bytecode */
-        def->bytecode = malloc(sizeof(uint32_t) * bytecode_length);
+        def->bytecode = janet_malloc(sizeof(uint32_t) * bytecode_length);
         if (!def->bytecode) {
             JANET_OUT_OF_MEMORY;
         }
@@ -797,7 +805,7 @@ static const uint8_t *unmarshal_one_def(
 
         /* Unmarshal environments */
         if (def->flags & JANET_FUNCDEF_FLAG_HASENVS) {
-            def->environments = calloc(1, sizeof(int32_t) * environments_length);
+            def->environments = janet_calloc(1, sizeof(int32_t) * environments_length);
             if (!def->environments) {
                 JANET_OUT_OF_MEMORY;
             }
@@ -811,7 +819,7 @@ static const uint8_t *unmarshal_one_def(
 
         /* Unmarshal sub funcdefs */
         if (def->flags & JANET_FUNCDEF_FLAG_HASDEFS) {
-            def->defs = calloc(1, sizeof(JanetFuncDef *) * defs_length);
+            def->defs = janet_calloc(1, sizeof(JanetFuncDef *) * defs_length);
             if (!def->defs) {
                 JANET_OUT_OF_MEMORY;
             }
@@ -824,24 +832,39 @@ static const uint8_t *unmarshal_one_def(
         def->defs_length = defs_length;
 
         /* Unmarshal source maps if needed */
-        if (def->flags & JANET_FUNCDEF_FLAG_HASSOURCEMAP) {
-            int32_t current = 0;
-            def->sourcemap = malloc(sizeof(JanetSourceMapping) * bytecode_length);
-            if (!def->sourcemap) {
-                JANET_OUT_OF_MEMORY;
+        if (def->flags & JANET_FUNCDEF_FLAG_PACKEDSOURCEMAP) {
+            int32_t len = readint(st, &data);
+            if (len < 0 || len > st->end - data) janet_panic("invalid sourcemap");
+            if (len) {
+                JanetSourceMapping last;
+                def->sourcemap_packed = janet_malloc(len);
+                if (!def->sourcemap_packed) {
+                    JANET_OUT_OF_MEMORY;
+                }
+                memcpy(def->sourcemap_packed, data, len);
+                def->sourcemap_length = len;
+                data += len;
+                if (!janet_sourcemap_get(def, bytecode_length - 1, &last))
+                    janet_panic("invalid sourcemap");
             }
+        } else if (def->flags & JANET_FUNCDEF_FLAG_HASSOURCEMAP) {
+            /* Sourcemaps from older versions store one mapping per instruction */
+            int32_t current = 0;
+            JanetSourceMapping *mappings = janet_smalloc(sizeof(JanetSourceMapping) * bytecode_length);
             for (int32_t i = 0; i < bytecode_length; i++) {
                 current += readint(st, &data);
-                def->sourcemap[i].line = current;
-                def->sourcemap[i].column = readint(st, &data);
+                mappings[i].line = current;
+                mappings[i].column = readint(st, &data);
             }
-        } else {
-            def->sourcemap = NULL;
+            janet_sourcemap_pack(def, mappings);
+            janet_sfree(mappings);
+            def->flags |= JANET_FUNCDEF_FLAG_PACKEDSOURCEMAP;
         }
 
         /* Validate */
         if (janet_verify(def))
             janet_panic("funcdef has invalid bytecode");
+        janet_srcindex_add(def);
 
         /* Set def */
         *out = def;
@@ -892,7 +915,7 @@ static const uint8_t *unmarshal_one_fiber(
 
     /* Allocate stack memory */
     fiber->capacity = fiber->stacktop + 10;
-    fiber->data = malloc(sizeof(Janet) * fiber->capacity);
+    fiber->data = janet_malloc(sizeof(Janet) * fiber->capacity);
     if (!fiber->data) {
         JANET_OUT_OF_MEMORY;
     }
@@ -1273,7 +1296,7 @@ static Janet cfun_env_lookup(int32_t argc, Janet *argv) {
 }
 
 static Janet cfun_marshal(int32_t argc, Janet *argv) {
-    janet_arity(argc, 1, 2);
+    janet_arity(argc, 1, 3);
     JanetBuffer *buffer;
     JanetTable *rreg = NULL;
     if (argc > 1) {
@@ -1289,13 +1312,19 @@ static Janet cfun_marshal(int32_t argc, Janet *argv) {
 }
 
 static Janet cfun_unmarshal(int32_t argc, Janet *argv) {
-    janet_arity(argc, 1, 2);
+    janet_arity(argc, 1, 3);
     JanetByteView view = janet_getbytes(argv, 0);
     JanetTable *reg = NULL;
-    if (argc > 1) {
+    int32_t start = 0;
+    if (argc > 1 && !janet_checktype(argv[1], JANET_NIL)) {
         reg = janet_gettable(argv, 1);
     }
-    return janet_unmarshal(view.bytes, (size_t) view.len, 0, reg, NULL);
+    if (argc > 2) {
+        start = janet_getinteger(argv, 2);
+        if (start < 0 || start > view.len)
+            janet_panicf("start index %d out of range [0, %d]", start, view.len);
+    }
+    return janet_unmarshal(view.bytes + start, (size_t)(view.len - start), 0, reg, NULL);
 }
 
 static const JanetReg marsh_cfuns[] = {
@@ -1311,9 +1340,10 @@ static const JanetReg marsh_cfuns[] = {
     },
     {
         "unmarshal", cfun_unmarshal,
-        JDOC("(unmarshal buffer &opt lookup)\n\n"
+        JDOC("(unmarshal buffer &opt lookup start)\n\n"
         "Unmarshal a janet value from a buffer. An optional lookup table "
-        "can be provided to allow for aliases to be resolved. Returns the value "
+        "can be provided to allow for aliases to be resolved. Reading begins at "
+        "byte index start, 0 by default. Returns the value "
         "unmarshalled from the buffer.")
     },
     {
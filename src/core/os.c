@@ -855,6 +855,20 @@ static Janet os_stat(int32_t argc, Janet *argv) {
     }
 }
 
+/* The directory handle is kept in scratch memory while os/dir allocates,
+ * so one left open by a panic is closed at the next collection. */
+#ifdef JANET_WINDOWS
+static void os_dir_close(void *mem) {
+    intptr_t res = *(intptr_t *)mem;
+    if (-1 != res) _findclose(res);
+}
+#else
+static void os_dir_close(void *mem) {
+    DIR *dfd = *(DIR **)mem;
+    if (NULL != dfd) closedir(dfd);
+}
+#endif
+
 static Janet os_dir(int32_t argc, Janet *argv) {
     janet_arity(argc, 1, 2);
     const char *dir = janet_getcstring(argv, 0);
@@ -868,24 +882,30 @@ static Janet os_dir(int32_t argc, Janet *argv) {
     sprintf(pattern, "%s/*", dir);
     intptr_t res = _findfirst(pattern, &afile);
     if (-1 == res) janet_panicv(janet_cstringv(strerror(errno)));
+    intptr_t *handle = janet_smalloc(sizeof(intptr_t));
+    *handle = res;
+    janet_sfinalizer(handle, os_dir_close);
     do {
         if (strcmp(".", afile.name) && strcmp("..", afile.name)) {
             janet_array_push(paths, janet_cstringv(afile.name));
         }
     } while (_findnext(res, &afile) != -1);
-    _findclose(res);
+    janet_sfree(handle);
 #else
     /* Read directory items with opendir / readdir / closedir */
     struct dirent *dp;
     DIR *dfd = opendir(dir);
     if (dfd == NULL) janet_panicf("cannot open directory %s", dir);
+    DIR **handle = janet_smalloc(sizeof(DIR *));
+    *handle = dfd;
+    janet_sfinalizer(handle, os_dir_close);
     while ((dp = readdir(dfd)) != NULL) {
         if (!strcmp(dp->d_name, ".") || !strcmp(dp->d_name, "..")) {
             continue;
         }
         janet_array_push(paths, janet_cstringv(dp->d_name));
     }
-    closedir(dfd);
+    janet_sfree(handle);
 #endif
     return janet_wrap_array(paths);
 }
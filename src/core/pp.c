@@ -27,6 +27,7 @@
 #include <janet.h>
 #include "util.h"
 #include "state.h"
+#include "vector.h"
 #include <math.h>
 #endif
 
@@ -306,14 +307,29 @@ const uint8_t *janet_to_string(Janet x) {
     }
 }
 
-/* Hold state for pretty printer. */
+/* When streaming, flush output to the file once this many bytes are buffered. */
+#define JANET_PRETTY_CHUNK 0x10000
+
+/* Write out buffered output to a stream and reset the buffer. */
+static void janet_stream_flush(JanetBuffer *buffer, FILE *stream) {
+    if (buffer->count) {
+        if (1 != fwrite(buffer->data, buffer->count, 1, stream)) {
+            janet_panicf("could not print %d bytes to file", buffer->count);
+        }
+        buffer->count = 0;
+    }
+}
+
+/* Hold state for pretty printer. Cycles are only detected along the
+ * current path, so path holds the data structures currently being printed. */
 struct pretty {
     JanetBuffer *buffer;
+    FILE *stream;
     int depth;
     int indent;
     int flags;
     int32_t bufstartlen;
-    JanetTable seen;
+    const void **path;
 };
 
 static void print_newline(struct pretty *S, int just_a_space) {
@@ -354,30 +370,35 @@ static const char *janet_pretty_colors[] = {
 
 /* Helper for pretty printing */
 static void janet_pretty_one(struct pretty *S, Janet x, int is_dict_value) {
-    /* Add to seen */
+    const void *ref = NULL;
+    if (S->stream && S->buffer->count >= JANET_PRETTY_CHUNK) {
+        janet_stream_flush(S->buffer, S->stream);
+    }
+
+    /* Check for cycles */
     switch (janet_type(x)) {
-        case JANET_NIL:
-        case JANET_NUMBER:
-        case JANET_SYMBOL:
-        case JANET_BOOLEAN:
+        default:
             break;
-        default: {
-            Janet seenid = janet_table_get(&S->seen, x);
-            if (janet_checktype(seenid, JANET_NUMBER)) {
+        case JANET_ARRAY:
+        case JANET_TUPLE:
+        case JANET_STRUCT:
+        case JANET_TABLE: {
+            ref = janet_unwrap_pointer(x);
+            for (int32_t i = 0; i < janet_v_count(S->path); i++) {
+                if (S->path[i] != ref) continue;
                 if (S->flags & JANET_PRETTY_COLOR) {
                     janet_buffer_push_cstring(S->buffer, janet_cycle_color);
                 }
                 janet_buffer_push_cstring(S->buffer, "<cycle ");
-                integer_to_string_b(S->buffer, janet_unwrap_integer(seenid));
+                integer_to_string_b(S->buffer, i);
                 janet_buffer_push_u8(S->buffer, '>');
                 if (S->flags & JANET_PRETTY_COLOR) {
                     janet_buffer_push_cstring(S->buffer, "\x1B[0m");
                 }
                 return;
-            } else {
-                janet_table_put(&S->seen, x, janet_wrap_integer(S->seen.count));
-                break;
             }
+            janet_v_push(S->path, ref);
+            break;
         }
     }
 
@@ -477,31 +498,31 @@ static void janet_pretty_one(struct pretty *S, Janet x, int is_dict_value) {
             break;
         }
     }
-    /* Remove from seen */
-    janet_table_remove(&S->seen, x);
+    if (NULL != ref) janet_v_pop(S->path);
     return;
 }
 
-static JanetBuffer *janet_pretty_(JanetBuffer *buffer, int depth, int flags, Janet x, int32_t startlen) {
+static JanetBuffer *janet_pretty_(JanetBuffer *buffer, FILE *stream, int depth, int flags, Janet x, int32_t startlen) {
     struct pretty S;
     if (NULL == buffer) {
         buffer = janet_buffer(0);
     }
     S.buffer = buffer;
+    S.stream = stream;
     S.depth = depth;
     S.indent = 0;
     S.flags = flags;
     S.bufstartlen = startlen;
-    janet_table_init(&S.seen, 10);
+    S.path = NULL;
     janet_pretty_one(&S, x, 0);
-    janet_table_deinit(&S.seen);
+    janet_v_free(S.path);
     return S.buffer;
 }
 
 /* Helper for printing a janet value in a pretty form. Not meant to be used
  * for serialization or anything like that. */
 JanetBuffer *janet_pretty(JanetBuffer *buffer, int depth, int flags, Janet x) {
-    return janet_pretty_(buffer, depth, flags, x, buffer ? buffer->count : 0);
+    return janet_pretty_(buffer, NULL, depth, flags, x, buffer ? buffer->count : 0);
 }
 
 static const char *typestr(Janet x) {
@@ -613,8 +634,7 @@ const uint8_t *janet_formatc(const char *format, ...) {
     /* Iterate length */
     va_end(args);
 
-    ret = janet_string(buffer.data, buffer.count);
-    janet_buffer_deinit(&buffer);
+    ret = janet_string_frombuffer(&buffer);
     return ret;
 }
 
@@ -658,10 +678,12 @@ static const char *scanformat(
     return p;
 }
 
-/* Shared implementation between string/format and
- * buffer/format */
-void janet_buffer_format(
+/* Shared implementation between string/format, buffer/format and printf. If
+ * stream is not NULL, b is a scratch buffer that is periodically written out
+ * to stream while formatting. */
+void janet_buffer_format_stream(
     JanetBuffer *b,
+    FILE *stream,
     const char *strfrmt,
     int32_t argstart,
     int32_t argc,
@@ -746,7 +768,7 @@ void janet_buffer_format(
                     int flags = 0;
                     flags |= has_color ? JANET_PRETTY_COLOR : 0;
                     flags |= has_oneline ? JANET_PRETTY_ONELINE : 0;
-                    janet_pretty_(b, depth, flags, argv[arg], startlen);
+                    janet_pretty_(b, stream, depth, flags, argv[arg], startlen);
                     break;
                 }
                 default: {
@@ -760,5 +782,17 @@ void janet_buffer_format(
             if (nb > 0)
                 janet_buffer_push_bytes(b, (uint8_t *) item, nb);
         }
+        if (stream && b->count >= JANET_PRETTY_CHUNK) {
+            janet_stream_flush(b, stream);
+        }
     }
 }
+
+void janet_buffer_format(
+    JanetBuffer *b,
+    const char *strfrmt,
+    int32_t argstart,
+    int32_t argc,
+    Janet *argv) {
+    janet_buffer_format_stream(b, NULL, strfrmt, argstart, argc, argv);
+}
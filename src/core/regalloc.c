@@ -26,7 +26,8 @@
 #include "util.h"
 #endif
 
-void janetc_regalloc_init(JanetcRegisterAllocator *ra) {
+void janetc_regalloc_init(JanetcRegisterAllocator *ra, JanetArena *arena) {
+    ra->arena = arena;
     ra->chunks = NULL;
     ra->count = 0;
     ra->capacity = 0;
@@ -35,7 +36,8 @@ void janetc_regalloc_init(JanetcRegisterAllocator *ra) {
 }
 
 void janetc_regalloc_deinit(JanetcRegisterAllocator *ra) {
-    free(ra->chunks);
+    if (ra->chunks)
+        janet_arena_release(ra->arena, ra->chunks, sizeof(uint32_t) * ra->capacity);
 }
 
 /* Fallbacks for when ctz not available */
@@ -63,16 +65,14 @@ static int32_t count_trailing_ones(uint32_t x) {
 /* Copy a register allocator */
 void janetc_regalloc_clone(JanetcRegisterAllocator *dest, JanetcRegisterAllocator *src) {
     size_t size;
+    dest->arena = src->arena;
     dest->count = src->count;
     dest->capacity = src->capacity;
     dest->max = src->max;
     size = sizeof(uint32_t) * dest->capacity;
     dest->regtemps = 0;
     if (size) {
-        dest->chunks = malloc(size);
-        if (!dest->chunks) {
-            JANET_OUT_OF_MEMORY;
-        }
+        dest->chunks = janet_arena_alloc(dest->arena, size);
         memcpy(dest->chunks, src->chunks, size);
     } else {
         dest->chunks = NULL;
@@ -86,10 +86,9 @@ static void pushchunk(JanetcRegisterAllocator *ra) {
     int32_t newcount = ra->count + 1;
     if (newcount > ra->capacity) {
         int32_t newcapacity = newcount * 2;
-        ra->chunks = realloc(ra->chunks, newcapacity * sizeof(uint32_t));
-        if (!ra->chunks) {
-            JANET_OUT_OF_MEMORY;
-        }
+        ra->chunks = janet_arena_realloc(ra->arena, ra->chunks,
+                                         ra->capacity * sizeof(uint32_t),
+                                         newcapacity * sizeof(uint32_t));
         ra->capacity = newcapacity;
     }
     ra->chunks[ra->count] = chunk;
@@ -27,6 +27,10 @@
 
 #include <stdint.h>
 
+#ifndef JANET_AMALG
+#include "vector.h"
+#endif
+
 /* Placeholder for allocating temporary registers */
 typedef enum {
     JANETC_REGTEMP_0,
@@ -40,6 +44,7 @@ typedef enum {
 } JanetcRegisterTemp;
 
 typedef struct {
+    JanetArena *arena; /* Holds chunks, shared with the rest of the compiler */
     uint32_t *chunks;
     int32_t count; /* number of chunks in chunks */
     int32_t capacity; /* amount allocated for chunks */
@@ -47,7 +52,7 @@ typedef struct {
     int32_t regtemps; /* Hold which temp. registers are allocated. */
 } JanetcRegisterAllocator;
 
-void janetc_regalloc_init(JanetcRegisterAllocator *ra);
+void janetc_regalloc_init(JanetcRegisterAllocator *ra, JanetArena *arena);
 void janetc_regalloc_deinit(JanetcRegisterAllocator *ra);
 
 int32_t janetc_regalloc_1(JanetcRegisterAllocator *ra);
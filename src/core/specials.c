@@ -26,6 +26,7 @@
 #include "util.h"
 #include "vector.h"
 #include "emit.h"
+#include "state.h"
 #endif
 
 static JanetSlot janetc_quote(JanetFopts opts, int32_t argn, const Janet *argv) {
@@ -81,7 +82,7 @@ static JanetSlot quasiquote(JanetFopts opts, Janet x, int depth, int level) {
                 }
             }
             for (i = 0; i < len; i++)
-                janet_v_push(slots, quasiquote(opts, tup[i], depth - 1, level));
+                janet_v_apush(&opts.compiler->arena, slots, quasiquote(opts, tup[i], depth - 1, level));
             return qq_slots(opts, slots, (janet_tuple_flag(tup) & JANET_TUPLE_FLAG_BRACKETCTOR)
                             ? JOP_MAKE_BRACKET_TUPLE
                             : JOP_MAKE_TUPLE);
@@ -90,7 +91,7 @@ static JanetSlot quasiquote(JanetFopts opts, Janet x, int depth, int level) {
             int32_t i;
             JanetArray *array = janet_unwrap_array(x);
             for (i = 0; i < array->count; i++)
-                janet_v_push(slots, quasiquote(opts, array->data[i], depth - 1, level));
+                janet_v_apush(&opts.compiler->arena, slots, quasiquote(opts, array->data[i], depth - 1, level));
             return qq_slots(opts, slots, JOP_MAKE_ARRAY);
         }
         case JANET_TABLE:
@@ -103,8 +104,8 @@ static JanetSlot quasiquote(JanetFopts opts, Janet x, int depth, int level) {
                 JanetSlot value =  quasiquote(opts, kv->value, depth - 1, level);
                 key.flags &= ~JANET_SLOT_SPLICED;
                 value.flags &= ~JANET_SLOT_SPLICED;
-                janet_v_push(slots, key);
-                janet_v_push(slots, value);
+                janet_v_apush(&opts.compiler->arena, slots, key);
+                janet_v_apush(&opts.compiler->arena, slots, value);
             }
             return qq_slots(opts, slots,
                             janet_checktype(x, JANET_TABLE) ? JOP_MAKE_TABLE : JOP_MAKE_STRUCT);
@@ -248,7 +249,7 @@ static JanetTable *handleattr(JanetCompiler *c, int32_t argn, const Janet *argv)
                 janet_table_put(tab, attr, janet_wrap_true());
                 break;
             case JANET_STRING:
-                janet_table_put(tab, janet_ckeywordv("doc"), attr);
+                janet_table_put(tab, janet_vm_kw_doc, attr);
                 break;
         }
     }
@@ -296,8 +297,8 @@ static int varleaf(
         JanetTable *entry = janet_table_clone(reftab);
         JanetArray *ref = janet_array(1);
         janet_array_push(ref, janet_wrap_nil());
-        janet_table_put(entry, janet_ckeywordv("ref"), janet_wrap_array(ref));
-        janet_table_put(entry, janet_ckeywordv("source-map"),
+        janet_table_put(entry, janet_vm_kw_ref, janet_wrap_array(ref));
+        janet_table_put(entry, janet_vm_kw_source_map,
                         janet_wrap_tuple(janetc_make_sourcemap(c)));
         janet_table_put(c->env, janet_wrap_symbol(sym), janet_wrap_table(entry));
         refslot = janetc_cslot(janet_wrap_array(ref));
@@ -325,9 +326,9 @@ static int defleaf(
     JanetTable *tab) {
     if (c->scope->flags & JANET_SCOPE_TOP) {
         JanetTable *entry = janet_table_clone(tab);
-        janet_table_put(entry, janet_ckeywordv("source-map"),
+        janet_table_put(entry, janet_vm_kw_source_map,
                         janet_wrap_tuple(janetc_make_sourcemap(c)));
-        JanetSlot valsym = janetc_cslot(janet_ckeywordv("value"));
+        JanetSlot valsym = janetc_cslot(janet_vm_kw_value);
         JanetSlot tabslot = janetc_cslot(janet_wrap_table(entry));
 
         /* Add env entry to env */
@@ -363,6 +364,153 @@ static JanetSlot janetc_def(JanetFopts opts, int32_t argn, const Janet *argv) {
  * ...
  * :done
  */
+/* Minimum number of keys in a chain of equality tests before it is
+ * compiled to a jump table. */
+#define JANET_JUMP_TABLE_MIN 4
+
+/* Get the key of a test of the form (= sym key) as emitted by case, where =
+ * is the core equality function and key is a literal. Keys that can never
+ * compare equal to anything are rejected. */
+static int janetc_table_test(Janet test, Janet sym, Janet *key) {
+    if (!janet_checktype(test, JANET_TUPLE)) return 0;
+    const Janet *tup = janet_unwrap_tuple(test);
+    if (janet_tuple_length(tup) != 3) return 0;
+    if (!janet_checktype(tup[0], JANET_FUNCTION)) return 0;
+    JanetFunction *f = janet_unwrap_function(tup[0]);
+    if ((f->def->flags & JANET_FUNCDEF_FLAG_TAG) != JANET_FUN_ORDER_EQ) return 0;
+    if (!janet_checktype(tup[1], JANET_SYMBOL)) return 0;
+    if (!janet_checktype(sym, JANET_NIL) && !janet_equals(sym, tup[1])) return 0;
+    Janet k = tup[2];
+    /* A bare symbol is a variable reference, not a literal key */
+    if (janet_checktype(k, JANET_SYMBOL)) return 0;
+    if (janet_checktype(k, JANET_TUPLE)) {
+        const Janet *q = janet_unwrap_tuple(k);
+        if (janet_tuple_length(q) != 2 ||
+                !janet_checktype(q[0], JANET_SYMBOL) ||
+                janet_cstrcmp(janet_unwrap_symbol(q[0]), "quote"))
+            return 0;
+        k = q[1];
+        if (!janet_checktype(k, JANET_SYMBOL) &&
+                !janet_checktype(k, JANET_KEYWORD) &&
+                !janet_checktype(k, JANET_STRING) &&
+                !janet_checktype(k, JANET_NUMBER))
+            return 0;
+    }
+    switch (janet_type(k)) {
+        default:
+            return 0;
+        case JANET_NUMBER: {
+            double d = janet_unwrap_number(k);
+            if (d != d) return 0;
+            /* -0 and 0 compare equal but hash differently */
+            if (d == 0.0) k = janet_wrap_number(0.0);
+            break;
+        }
+        case JANET_BOOLEAN:
+        case JANET_STRING:
+        case JANET_SYMBOL:
+        case JANET_KEYWORD:
+            break;
+    }
+    *key = k;
+    return 1;
+}
+
+/* Compile a chain of (if (= sym key) ...) forms, as emitted by case, to a
+ * single jump table. Returns 0 if the chain is too short or does not have
+ * that shape. */
+static int janetc_if_table(JanetFopts opts, int32_t argn, const Janet *argv, JanetSlot *ret) {
+    JanetCompiler *c = opts.compiler;
+    JanetScope tablescope, tempscope;
+    JanetSlot dispatch, body, target;
+    Janet sym = janet_wrap_nil();
+    Janet key;
+    Janet *keys = NULL;
+    Janet *bodies = NULL;
+    Janet fallback = janet_wrap_nil();
+    int32_t i, count = 0;
+    int32_t *donelabels = NULL;
+    const int tail = opts.flags & JANET_FOPTS_TAIL;
+    const int drop = opts.flags & JANET_FOPTS_DROP;
+
+    /* Walk the chain of tests */
+    while (argn >= 2 && argn <= 3 && janetc_table_test(argv[0], sym, &key)) {
+        sym = janet_unwrap_tuple(argv[0])[1];
+        janet_v_apush(&c->arena, keys, key);
+        janet_v_apush(&c->arena, bodies, argv[1]);
+        fallback = argn > 2 ? argv[2] : janet_wrap_nil();
+        count++;
+        if (!janet_checktype(fallback, JANET_TUPLE)) break;
+        const Janet *next = janet_unwrap_tuple(fallback);
+        if (janet_tuple_length(next) < 1 ||
+                !janet_checktype(next[0], JANET_SYMBOL) ||
+                janet_cstrcmp(janet_unwrap_symbol(next[0]), "if"))
+            break;
+        argn = janet_tuple_length(next) - 1;
+        argv = next + 1;
+    }
+    if (count < JANET_JUMP_TABLE_MIN) {
+        janet_v_afree(&c->arena, bodies);
+        janet_v_afree(&c->arena, keys);
+        return 0;
+    }
+
+    /* Map each key to the index of its branch. Later duplicates of a key
+     * can never be selected. */
+    JanetTable *indices = janet_table(count);
+    int32_t n = 0;
+    for (i = 0; i < count; i++) {
+        if (janet_checktype(janet_table_get(indices, keys[i]), JANET_NIL)) {
+            janet_table_put(indices, keys[i], janet_wrap_integer(n));
+            bodies[n++] = bodies[i];
+        } else {
+            janetc_throwaway(opts, bodies[i]);
+        }
+    }
+
+    target = (drop || tail)
+             ? janetc_cslot(janet_wrap_nil())
+             : janetc_gettarget(opts);
+
+    /* Emit the dispatch and a jump for each branch. The fallback follows the table. */
+    janetc_scope(&tablescope, c, 0, "if");
+    dispatch = janetc_value(janetc_fopts_default(c), sym);
+    janetc_emit_sc(c, JOP_JUMP_TABLE, dispatch, janet_wrap_struct(janet_table_to_struct(indices)));
+    int32_t tablestart = janet_v_count(c->buffer);
+    for (i = 0; i < n; i++) janetc_emit(c, JOP_JUMP);
+
+    /* Compile the fallback, then each branch */
+    for (i = -1; i < n; i++) {
+        if (i >= 0) {
+            int32_t label = tablestart + i;
+            c->buffer[label] |= (janet_v_count(c->buffer) - label) << 8;
+        }
+        janetc_scope(&tempscope, c, 0, i < 0 ? "if-false" : "if-true");
+        body = janetc_value(opts, i < 0 ? fallback : bodies[i]);
+        if (!drop && !tail) janetc_copy(c, target, body);
+        janetc_popscope(c);
+        if (!tail && i < n - 1) {
+            janet_v_apush(&c->arena, donelabels, janet_v_count(c->buffer));
+            janetc_emit(c, JOP_JUMP);
+        }
+    }
+    janetc_popscope(c);
+
+    /* Patch jumps to the end */
+    int32_t labeld = janet_v_count(c->buffer);
+    for (i = 0; i < janet_v_count(donelabels); i++) {
+        int32_t label = donelabels[i];
+        c->buffer[label] |= (labeld - label) << 8;
+    }
+
+    janet_v_afree(&c->arena, donelabels);
+    janet_v_afree(&c->arena, bodies);
+    janet_v_afree(&c->arena, keys);
+    if (tail) target.flags |= JANET_SLOT_RETURNED;
+    *ret = target;
+    return 1;
+}
+
 static JanetSlot janetc_if(JanetFopts opts, int32_t argn, const Janet *argv) {
     JanetCompiler *c = opts.compiler;
     int32_t labelr, labeljr, labeld, labeljd;
@@ -378,6 +526,9 @@ static JanetSlot janetc_if(JanetFopts opts, int32_t argn, const Janet *argv) {
         return janetc_cslot(janet_wrap_nil());
     }
 
+    /* Chains of equality tests against literals use a jump table */
+    if (janetc_if_table(opts, argn, argv, &target)) return target;
+
     /* Get the bodies of the if expression */
     truebody = argv[1];
     falsebody = argn > 2 ? argv[2] : janet_wrap_nil();
@@ -478,7 +629,7 @@ static int32_t janetc_addfuncdef(JanetCompiler *c, JanetFuncDef *def) {
         scope = scope->parent;
     }
     janet_assert(scope, "could not add funcdef");
-    janet_v_push(scope->defs, def);
+    janet_v_apush(&c->arena, scope->defs, def);
     return janet_v_count(scope->defs) - 1;
 }
 
@@ -743,7 +894,7 @@ static JanetSlot janetc_fn(JanetFopts opts, int32_t argn, const Janet *argv) {
                 janetc_nameslot(c, janet_unwrap_symbol(param), janetc_farslot(c));
             }
         } else {
-            janet_v_push(destructed_params, janetc_farslot(c));
+            janet_v_apush(&c->arena, destructed_params, janetc_farslot(c));
         }
     }
 
@@ -757,7 +908,7 @@ static JanetSlot janetc_fn(JanetFopts opts, int32_t argn, const Janet *argv) {
             janetc_freeslot(c, reg);
         }
     }
-    janet_v_free(destructed_params);
+    janet_v_afree(&c->arena, destructed_params);
 
     max_arity = (vararg || allow_extra) ? INT32_MAX : arity;
     if (!seenopt) min_arity = arity;
@@ -51,6 +51,13 @@ extern JANET_THREAD_LOCAL Janet *janet_vm_return_reg;
  * along with otherwise bare c function pointers. */
 extern JANET_THREAD_LOCAL JanetTable *janet_vm_registry;
 
+/* Keywords used in environment bindings, interned once per VM */
+extern JANET_THREAD_LOCAL Janet janet_vm_kw_value;
+extern JANET_THREAD_LOCAL Janet janet_vm_kw_ref;
+extern JANET_THREAD_LOCAL Janet janet_vm_kw_macro;
+extern JANET_THREAD_LOCAL Janet janet_vm_kw_doc;
+extern JANET_THREAD_LOCAL Janet janet_vm_kw_source_map;
+
 /* Immutable value cache */
 extern JANET_THREAD_LOCAL const uint8_t **janet_vm_cache;
 extern JANET_THREAD_LOCAL uint32_t janet_vm_cache_capacity;
@@ -60,14 +67,30 @@ extern JANET_THREAD_LOCAL uint32_t janet_vm_cache_deleted;
 /* Garbage collection */
 extern JANET_THREAD_LOCAL void *janet_vm_blocks;
 extern JANET_THREAD_LOCAL uint32_t janet_vm_gc_interval;
+extern JANET_THREAD_LOCAL uint32_t janet_vm_gc_trigger;
 extern JANET_THREAD_LOCAL uint32_t janet_vm_next_collection;
 extern JANET_THREAD_LOCAL int janet_vm_gc_suspend;
+extern JANET_THREAD_LOCAL void *janet_vm_finalizers;
+extern JANET_THREAD_LOCAL uint32_t janet_vm_gc_threads;
+extern JANET_THREAD_LOCAL uint32_t janet_vm_gc_parallel_min;
+
+/* Heap limit. janet_vm_heap_live estimates the bytes in use after the
+ * last collection; a limit of 0 means no limit. */
+extern JANET_THREAD_LOCAL size_t janet_vm_heap_limit;
+extern JANET_THREAD_LOCAL size_t janet_vm_heap_live;
 
 /* GC roots */
 extern JANET_THREAD_LOCAL Janet *janet_vm_roots;
 extern JANET_THREAD_LOCAL uint32_t janet_vm_root_count;
 extern JANET_THREAD_LOCAL uint32_t janet_vm_root_capacity;
 
+/* GC root handles. A slot table whose free slots form a linked list;
+ * a free slot holds the index of the next free slot as a number. */
+extern JANET_THREAD_LOCAL Janet *janet_vm_root_handles;
+extern JANET_THREAD_LOCAL int32_t janet_vm_root_handle_count;
+extern JANET_THREAD_LOCAL int32_t janet_vm_root_handle_capacity;
+extern JANET_THREAD_LOCAL int32_t janet_vm_root_handle_free;
+
 /* Scratch memory */
 extern JANET_THREAD_LOCAL void **janet_scratch_mem;
 extern JANET_THREAD_LOCAL size_t janet_scratch_cap;
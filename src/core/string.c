@@ -38,6 +38,20 @@ uint8_t *janet_string_begin(int32_t length) {
     return data;
 }
 
+/* Make a string from a buffer outside of the heap, such as one on the C
+ * stack, and free the buffer. The buffer is also freed if the string would
+ * go over the heap limit. */
+const uint8_t *janet_string_frombuffer(JanetBuffer *buffer) {
+    size_t size = sizeof(JanetStringHead) + buffer->count + 1;
+    if (janet_gcexceeds(size)) {
+        janet_buffer_deinit(buffer);
+        janet_gccheck(size);
+    }
+    const uint8_t *ret = janet_string(buffer->data, buffer->count);
+    janet_buffer_deinit(buffer);
+    return ret;
+}
+
 /* Finish building a string */
 const uint8_t *janet_string_end(uint8_t *str) {
     janet_string_hash(str) = janet_string_calchash(str, janet_string_length(str));
@@ -107,10 +121,10 @@ static void kmp_init(
     if (patlen == 0) {
         janet_panic("expected non-empty pattern");
     }
-    int32_t *lookup = calloc(patlen, sizeof(int32_t));
-    if (!lookup) {
-        JANET_OUT_OF_MEMORY;
-    }
+    /* Scratch memory, so the table is freed even if an error interrupts
+     * the search */
+    int32_t *lookup = janet_smalloc(patlen * sizeof(int32_t));
+    memset(lookup, 0, patlen * sizeof(int32_t));
     s->lookup = lookup;
     s->i = 0;
     s->j = 0;
@@ -130,7 +144,7 @@ static void kmp_init(
 }
 
 static void kmp_deinit(struct kmp_state *state) {
-    free(state->lookup);
+    janet_sfree(state->lookup);
 }
 
 static void kmp_seti(struct kmp_state *state, int32_t i) {
@@ -365,10 +379,8 @@ static Janet cfun_string_replaceall(int32_t argc, Janet *argv) {
         kmp_seti(&s.kmp, lastindex);
     }
     janet_buffer_push_bytes(&b, s.kmp.text + lastindex, s.kmp.textlen - lastindex);
-    const uint8_t *ret = janet_string(b.data, b.count);
-    janet_buffer_deinit(&b);
     kmp_deinit(&s.kmp);
-    return janet_wrap_string(ret);
+    return janet_wrap_string(janet_string_frombuffer(&b));
 }
 
 static Janet cfun_string_split(int32_t argc, Janet *argv) {
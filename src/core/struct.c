@@ -143,10 +143,23 @@ const JanetKV *janet_struct_end(JanetKV *st) {
         }
         st = newst;
     }
-    janet_struct_hash(st) = janet_kv_calchash(st, janet_struct_capacity(st));
+    /* The hash is computed later, on first use */
+    janet_struct_hash(st) = 0;
     return (const JanetKV *)st;
 }
 
+/* Get the hash of a struct, computing it if needed. A hash of 0 means
+ * not yet computed, so a computed hash of 0 is stored as 1. */
+int32_t janet_struct_gethash(const JanetKV *st) {
+    int32_t hash = janet_struct_hash(st);
+    if (hash == 0) {
+        hash = janet_kv_calchash(st, janet_struct_capacity(st));
+        if (hash == 0) hash = 1;
+        janet_struct_hash(st) = hash;
+    }
+    return hash;
+}
+
 /* Get an item from a struct */
 Janet janet_struct_get(const JanetKV *st, Janet key) {
     const JanetKV *kv = janet_struct_find(st, key);
@@ -175,7 +188,8 @@ int janet_struct_equal(const JanetKV *lhs, const JanetKV *rhs) {
     int32_t rhash = janet_struct_hash(rhs);
     if (llen != rlen)
         return 0;
-    if (lhash != rhash)
+    /* Only use hashes that are already known */
+    if (lhash && rhash && lhash != rhash)
         return 0;
     for (index = 0; index < llen; index++) {
         const JanetKV *l = lhs + index;
@@ -191,8 +205,8 @@ int janet_struct_equal(const JanetKV *lhs, const JanetKV *rhs) {
 /* Compare structs */
 int janet_struct_compare(const JanetKV *lhs, const JanetKV *rhs) {
     int32_t i;
-    int32_t lhash = janet_struct_hash(lhs);
-    int32_t rhash = janet_struct_hash(rhs);
+    int32_t lhash = janet_struct_gethash(lhs);
+    int32_t rhash = janet_struct_gethash(rhs);
     int32_t llen = janet_struct_capacity(lhs);
     int32_t rlen = janet_struct_capacity(rhs);
     if (llen < rlen)
@@ -24,6 +24,7 @@
 #include <janet.h>
 #include "gc.h"
 #include "util.h"
+#include "state.h"
 #include <math.h>
 #endif
 
@@ -76,24 +77,132 @@ void janet_table_deinit(JanetTable *table) {
     janet_sfree(table->data);
 }
 
-/* Create a new table */
+/* Create a new table. Small tables keep their buckets inline, directly
+ * after the table header, so creating them is a single allocation. */
 JanetTable *janet_table(int32_t capacity) {
-    JanetTable *table = janet_gcalloc(JANET_MEMORY_TABLE, sizeof(JanetTable));
+    JanetTable *table;
+    int32_t cap = janet_tablen(capacity);
+    if (cap <= JANET_TABLE_INLINE_CAP) {
+        table = janet_gcalloc(JANET_MEMORY_TABLE, sizeof(JanetTable) + cap * sizeof(JanetKV));
+        table->gc.flags |= JANET_TABLE_FLAG_INLINE | (cap << JANET_TABLE_INLINE_SHIFT);
+        table->data = (JanetKV *)(table + 1);
+        table->capacity = cap;
+        janet_memempty(table->data, cap);
+        table->count = 0;
+        table->deleted = 0;
+        table->proto = NULL;
+        return table;
+    }
+    /* Check the buckets too, so a new table is never left uninitialized */
+    janet_gccheck(sizeof(JanetTable) + janet_tablen(capacity) * sizeof(JanetKV));
+    table = janet_gcalloc(JANET_MEMORY_TABLE, sizeof(JanetTable));
     return janet_table_init_impl(table, capacity, 0);
 }
 
+/* Create a new table that holds its keys weakly. An entry stays alive
+ * while its key is reachable from elsewhere (ephemeron semantics). */
+JanetTable *janet_table_weakk(int32_t capacity) {
+    JanetTable *table = janet_table(capacity);
+    table->gc.flags |= JANET_TABLE_FLAG_WEAKK;
+    return table;
+}
+
+/* Create a new table that holds its values weakly */
+JanetTable *janet_table_weakv(int32_t capacity) {
+    JanetTable *table = janet_table(capacity);
+    table->gc.flags |= JANET_TABLE_FLAG_WEAKV;
+    return table;
+}
+
+/* Create a new table that holds both its keys and values weakly */
+JanetTable *janet_table_weakkv(int32_t capacity) {
+    JanetTable *table = janet_table(capacity);
+    table->gc.flags |= JANET_TABLE_FLAG_WEAK;
+    return table;
+}
+
 /* Find the bucket that contains the given key. Will also return
  * bucket where key should go if not in the table. */
 JanetKV *janet_table_find(JanetTable *t, Janet key) {
     return (JanetKV *) janet_dict_find(t->data, t->capacity, key);
 }
 
+/* Find the bucket that contains the given key, or NULL if the key is
+ * not in the table. Small tables are scanned linearly instead of hashing
+ * the key; keywords and symbols are interned and so compare by pointer. */
+static JanetKV *janet_table_lookup(JanetTable *t, Janet key) {
+    JanetKV *kv, *end;
+    if (t->capacity > JANET_TABLE_INLINE_CAP) {
+        kv = janet_table_find(t, key);
+        return (NULL != kv && !janet_checktype(kv->key, JANET_NIL)) ? kv : NULL;
+    }
+    kv = t->data;
+    end = kv + t->capacity;
+    if (janet_checktype(key, JANET_KEYWORD) || janet_checktype(key, JANET_SYMBOL)) {
+        JanetType type = janet_type(key);
+        const void *p = janet_unwrap_pointer(key);
+        for (; kv < end; kv++) {
+            if (janet_type(kv->key) == type && janet_unwrap_pointer(kv->key) == p)
+                return kv;
+        }
+    } else {
+        for (; kv < end; kv++) {
+            if (!janet_checktype(kv->key, JANET_NIL) && janet_equals(kv->key, key))
+                return kv;
+        }
+    }
+    return NULL;
+}
+
 /* Resize the dictionary table. */
 static void janet_table_rehash(JanetTable *t, int32_t size) {
     JanetKV *olddata = t->data;
     JanetKV *newdata;
     int islocal = t->gc.flags & JANET_TABLE_FLAG_STACK;
-    if (islocal) {
+    int32_t inlinecap = janet_table_inline_cap(t);
+    if (size <= inlinecap) {
+        /* Rebuild into the inline buckets, either to clear tombstones or
+         * to reclaim them after the table has shrunk again */
+        JanetKV old[JANET_TABLE_INLINE_CAP];
+        int32_t oldcapacity = t->capacity;
+        int wasinline = t->gc.flags & JANET_TABLE_FLAG_INLINE;
+        if (wasinline) {
+            memcpy(old, olddata, oldcapacity * sizeof(JanetKV));
+            olddata = old;
+        }
+        t->gc.flags |= JANET_TABLE_FLAG_INLINE;
+        t->data = (JanetKV *)(t + 1);
+        t->capacity = inlinecap;
+        t->deleted = 0;
+        janet_memempty(t->data, inlinecap);
+        for (int32_t i = 0; i < oldcapacity; i++) {
+            if (!janet_checktype(olddata[i].key, JANET_NIL))
+                *janet_table_find(t, olddata[i].key) = olddata[i];
+        }
+        if (!wasinline) janet_free(olddata);
+        return;
+    }
+    if (!islocal)
+        janet_gccheck(size * sizeof(JanetKV));
+    if (t->gc.flags & JANET_TABLE_FLAG_INLINE) {
+        /* Outgrew the inline buckets; move to a separate hashed array.
+         * The inline storage stays with the table for reuse. */
+        t->gc.flags &= ~JANET_TABLE_FLAG_INLINE;
+        newdata = (JanetKV *) janet_memalloc_empty(size);
+        if (NULL == newdata) {
+            JANET_OUT_OF_MEMORY;
+        }
+        for (int32_t i = 0; i < t->capacity; i++) {
+            JanetKV *kv = t->data + i;
+            if (!janet_checktype(kv->key, JANET_NIL)) {
+                *((JanetKV *) janet_dict_find(newdata, size, kv->key)) = *kv;
+            }
+        }
+        t->data = newdata;
+        t->capacity = size;
+        t->deleted = 0;
+        return;
+    } else if (islocal) {
         newdata = (JanetKV *) janet_memalloc_empty_local(size);
     } else {
         newdata = (JanetKV *) janet_memalloc_empty(size);
@@ -116,21 +225,21 @@ static void janet_table_rehash(JanetTable *t, int32_t size) {
     if (islocal) {
         janet_sfree(olddata);
     } else {
-        free(olddata);
+        janet_free(olddata);
     }
 }
 
 /* Get a value out of the table */
 Janet janet_table_get(JanetTable *t, Janet key) {
-    JanetKV *bucket = janet_table_find(t, key);
-    if (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL))
+    JanetKV *bucket = janet_table_lookup(t, key);
+    if (NULL != bucket)
         return bucket->value;
     /* Check prototypes */
     {
         int i;
         for (i = JANET_MAX_PROTO_DEPTH, t = t->proto; t && i; t = t->proto, --i) {
-            bucket = janet_table_find(t, key);
-            if (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL))
+            bucket = janet_table_lookup(t, key);
+            if (NULL != bucket)
                 return bucket->value;
         }
     }
@@ -139,8 +248,8 @@ Janet janet_table_get(JanetTable *t, Janet key) {
 
 /* Get a value out of the table, and record which prototype it was from. */
 Janet janet_table_get_ex(JanetTable *t, Janet key, JanetTable **which) {
-    JanetKV *bucket = janet_table_find(t, key);
-    if (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL)) {
+    JanetKV *bucket = janet_table_lookup(t, key);
+    if (NULL != bucket) {
         *which = t;
         return bucket->value;
     }
@@ -148,8 +257,8 @@ Janet janet_table_get_ex(JanetTable *t, Janet key, JanetTable **which) {
     {
         int i;
         for (i = JANET_MAX_PROTO_DEPTH, t = t->proto; t && i; t = t->proto, --i) {
-            bucket = janet_table_find(t, key);
-            if (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL)) {
+            bucket = janet_table_lookup(t, key);
+            if (NULL != bucket) {
                 *which = t;
                 return bucket->value;
             }
@@ -160,8 +269,8 @@ Janet janet_table_get_ex(JanetTable *t, Janet key, JanetTable **which) {
 
 /* Get a value out of the table. Don't check prototype tables. */
 Janet janet_table_rawget(JanetTable *t, Janet key) {
-    JanetKV *bucket = janet_table_find(t, key);
-    if (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL))
+    JanetKV *bucket = janet_table_lookup(t, key);
+    if (NULL != bucket)
         return bucket->value;
     else
         return janet_wrap_nil();
@@ -170,9 +279,10 @@ Janet janet_table_rawget(JanetTable *t, Janet key) {
 /* Remove an entry from the dictionary. Return the value that
  * was removed. */
 Janet janet_table_remove(JanetTable *t, Janet key) {
-    JanetKV *bucket = janet_table_find(t, key);
-    if (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL)) {
+    JanetKV *bucket = janet_table_lookup(t, key);
+    if (NULL != bucket) {
         Janet ret = bucket->key;
+        janet_table_touch(t);
         t->count--;
         t->deleted++;
         bucket->key = janet_wrap_nil();
@@ -190,11 +300,17 @@ void janet_table_put(JanetTable *t, Janet key, Janet value) {
     if (janet_checktype(value, JANET_NIL)) {
         janet_table_remove(t, key);
     } else {
-        JanetKV *bucket = janet_table_find(t, key);
-        if (NULL != bucket && !janet_checktype(bucket->key, JANET_NIL)) {
+        JanetKV *bucket = janet_table_lookup(t, key);
+        janet_table_touch(t);
+        if (NULL != bucket) {
             bucket->value = value;
         } else {
-            if (NULL == bucket || 2 * (t->count + t->deleted + 1) > t->capacity) {
+            /* Small tables are scanned, not probed, so they may fill up
+             * to all but one bucket before growing. */
+            int32_t used = t->count + t->deleted + 1;
+            if (t->capacity <= JANET_TABLE_INLINE_CAP
+                    ? used >= t->capacity
+                    : 2 * used > t->capacity) {
                 janet_table_rehash(t, janet_tablen(2 * t->count + 2));
             }
             bucket = janet_table_find(t, key);
@@ -211,6 +327,7 @@ void janet_table_put(JanetTable *t, Janet key, Janet value) {
 void janet_table_clear(JanetTable *t) {
     int32_t capacity = t->capacity;
     JanetKV *data = t->data;
+    janet_table_touch(t);
     janet_memempty(data, capacity);
     t->count = 0;
     t->deleted = 0;
@@ -231,15 +348,23 @@ const JanetKV *janet_table_to_struct(JanetTable *t) {
 
 /* Clone a table. */
 JanetTable *janet_table_clone(JanetTable *table) {
-    JanetTable *newTable = janet_gcalloc(JANET_MEMORY_TABLE, sizeof(JanetTable));
+    JanetTable *newTable;
+    if (table->gc.flags & JANET_TABLE_FLAG_INLINE) {
+        newTable = janet_table(table->capacity - 1);
+    } else {
+        janet_gccheck(sizeof(JanetTable) + table->capacity * sizeof(JanetKV));
+        newTable = janet_gcalloc(JANET_MEMORY_TABLE, sizeof(JanetTable));
+        janet_vm_next_collection += table->capacity * sizeof(JanetKV);
+        newTable->capacity = table->capacity;
+        newTable->data = janet_malloc(newTable->capacity * sizeof(JanetKV));
+        if (NULL == newTable->data) {
+            JANET_OUT_OF_MEMORY;
+        }
+    }
+    newTable->gc.flags |= table->gc.flags & JANET_TABLE_FLAG_WEAK;
     newTable->count = table->count;
-    newTable->capacity = table->capacity;
     newTable->deleted = table->deleted;
     newTable->proto = table->proto;
-    newTable->data = malloc(newTable->capacity * sizeof(JanetKV));
-    if (NULL == newTable->data) {
-        JANET_OUT_OF_MEMORY;
-    }
     memcpy(newTable->data, table->data, table->capacity * sizeof(JanetKV));
     return newTable;
 }
@@ -273,6 +398,24 @@ static Janet cfun_table_new(int32_t argc, Janet *argv) {
     return janet_wrap_table(janet_table(cap));
 }
 
+static Janet cfun_table_weak(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    int32_t cap = janet_getinteger(argv, 0);
+    return janet_wrap_table(janet_table_weakkv(cap));
+}
+
+static Janet cfun_table_weak_keys(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    int32_t cap = janet_getinteger(argv, 0);
+    return janet_wrap_table(janet_table_weakk(cap));
+}
+
+static Janet cfun_table_weak_values(int32_t argc, Janet *argv) {
+    janet_fixarity(argc, 1);
+    int32_t cap = janet_getinteger(argv, 0);
+    return janet_wrap_table(janet_table_weakv(cap));
+}
+
 static Janet cfun_table_getproto(int32_t argc, Janet *argv) {
     janet_fixarity(argc, 1);
     JanetTable *t = janet_gettable(argv, 0);
@@ -288,6 +431,7 @@ static Janet cfun_table_setproto(int32_t argc, Janet *argv) {
     if (!janet_checktype(argv[1], JANET_NIL)) {
         proto = janet_gettable(argv, 1);
     }
+    janet_table_touch(table);
     table->proto = proto;
     return argv[0];
 }
@@ -319,6 +463,27 @@ static const JanetReg table_cfuns[] = {
         "entries going to go in a table on creation, extra memory allocation "
         "can be avoided. Returns the new table.")
     },
+    {
+        "table/weak", cfun_table_weak,
+        JDOC("(table/weak capacity)\n\n"
+        "Creates a new empty table with weak references to keys and values. "
+        "Entries whose key or value is a reference type (a table, array, buffer, "
+        "function, fiber or abstract value) are removed once that key or value "
+        "is no longer reachable from anywhere else. Returns the new table.")
+    },
+    {
+        "table/weak-keys", cfun_table_weak_keys,
+        JDOC("(table/weak-keys capacity)\n\n"
+        "Creates a new empty table with weak references to keys. An entry "
+        "keeps its value alive only while the key is reachable from elsewhere. "
+        "Returns the new table.")
+    },
+    {
+        "table/weak-values", cfun_table_weak_values,
+        JDOC("(table/weak-values capacity)\n\n"
+        "Creates a new empty table with weak references to values. "
+        "Returns the new table.")
+    },
     {
         "table/to-struct", cfun_table_tostruct,
         JDOC("(table/to-struct tab)\n\n"
@@ -36,15 +36,27 @@ Janet *janet_tuple_begin(int32_t length) {
     head->sm_line = -1;
     head->sm_column = -1;
     head->length = length;
+    head->hash = 0;
     return (Janet *)(head->data);
 }
 
-/* Finish building a tuple */
+/* Finish building a tuple. The hash is computed later, on first use. */
 const Janet *janet_tuple_end(Janet *tuple) {
-    janet_tuple_hash(tuple) = janet_array_calchash(tuple, janet_tuple_length(tuple));
     return (const Janet *)tuple;
 }
 
+/* Get the hash of a tuple, computing it if needed. A hash of 0 means
+ * not yet computed, so a computed hash of 0 is stored as 1. */
+int32_t janet_tuple_gethash(const Janet *tuple) {
+    int32_t hash = janet_tuple_hash(tuple);
+    if (hash == 0) {
+        hash = janet_array_calchash(tuple, janet_tuple_length(tuple));
+        if (hash == 0) hash = 1;
+        janet_tuple_hash(tuple) = hash;
+    }
+    return hash;
+}
+
 /* Build a tuple with n values */
 const Janet *janet_tuple_n(const Janet *values, int32_t n) {
     Janet *t = janet_tuple_begin(n);
@@ -59,11 +71,8 @@ int janet_tuple_equal(const Janet *lhs, const Janet *rhs) {
     int32_t rlen = janet_tuple_length(rhs);
     int32_t lhash = janet_tuple_hash(lhs);
     int32_t rhash = janet_tuple_hash(rhs);
-    if (lhash == 0)
-        lhash = janet_tuple_hash(lhs) = janet_array_calchash(lhs, llen);
-    if (rhash == 0)
-        rhash = janet_tuple_hash(rhs) = janet_array_calchash(rhs, rlen);
-    if (lhash != rhash)
+    /* Only use hashes that are already known */
+    if (lhash && rhash && lhash != rhash)
         return 0;
     if (llen != rlen)
         return 0;
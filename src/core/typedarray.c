@@ -22,6 +22,7 @@
 
 #ifndef JANET_AMALG
 #include <janet.h>
+#include "gc.h"
 #include "util.h"
 #endif
 
@@ -71,10 +72,12 @@ static JanetTArrayType get_ta_type_by_name(const uint8_t *name) {
 static JanetTArrayBuffer *ta_buffer_init(JanetTArrayBuffer *buf, size_t size) {
     buf->data = NULL;
     if (size > 0) {
-        buf->data = (uint8_t *)calloc(size, sizeof(uint8_t));
+        janet_gccheck(size);
+        buf->data = (uint8_t *)janet_calloc(size, sizeof(uint8_t));
         if (buf->data == NULL) {
             JANET_OUT_OF_MEMORY;
         }
+        janet_gcpressure(size);
     }
     buf->size = size;
 #ifdef JANET_BIG_ENDIAN
@@ -88,7 +91,7 @@ static JanetTArrayBuffer *ta_buffer_init(JanetTArrayBuffer *buf, size_t size) {
 static int ta_buffer_gc(void *p, size_t s) {
     (void) s;
     JanetTArrayBuffer *buf = (JanetTArrayBuffer *)p;
-    free(buf->data);
+    janet_free(buf->data);
     return 0;
 }
 
@@ -243,9 +243,9 @@ void janet_register(const char *name, JanetCFunction cfun) {
 /* Add a def to an environment */
 void janet_def(JanetTable *env, const char *name, Janet val, const char *doc) {
     JanetTable *subt = janet_table(2);
-    janet_table_put(subt, janet_ckeywordv("value"), val);
+    janet_table_put(subt, janet_vm_kw_value, val);
     if (doc)
-        janet_table_put(subt, janet_ckeywordv("doc"), janet_cstringv(doc));
+        janet_table_put(subt, janet_vm_kw_doc, janet_cstringv(doc));
     janet_table_put(env, janet_csymbolv(name), janet_wrap_table(subt));
 }
 
@@ -254,9 +254,9 @@ void janet_var(JanetTable *env, const char *name, Janet val, const char *doc) {
     JanetArray *array = janet_array(1);
     JanetTable *subt = janet_table(2);
     janet_array_push(array, val);
-    janet_table_put(subt, janet_ckeywordv("ref"), janet_wrap_array(array));
+    janet_table_put(subt, janet_vm_kw_ref, janet_wrap_array(array));
     if (doc)
-        janet_table_put(subt, janet_ckeywordv("doc"), janet_cstringv(doc));
+        janet_table_put(subt, janet_vm_kw_doc, janet_cstringv(doc));
     janet_table_put(env, janet_csymbolv(name), janet_wrap_table(subt));
 }
 
@@ -271,12 +271,12 @@ void janet_cfuns(JanetTable *env, const char *regprefix, const JanetReg *cfuns)
             while (regprefix[reglen]) reglen++;
             while (cfuns->name[nmlen]) nmlen++;
             int32_t symlen = reglen + 1 + nmlen;
-            uint8_t *longname_buffer = malloc(symlen);
+            uint8_t *longname_buffer = janet_smalloc(symlen);
             memcpy(longname_buffer, regprefix, reglen);
             longname_buffer[reglen] = '/';
             memcpy(longname_buffer + reglen + 1, cfuns->name, nmlen);
             longname = janet_wrap_symbol(janet_symbol(longname_buffer, symlen));
-            free(longname_buffer);
+            janet_sfree(longname_buffer);
         }
         Janet fun = janet_wrap_cfunction(cfuns->cfun);
         janet_def(env, cfuns->name, fun, cfuns->documentation);
@@ -347,27 +347,36 @@ void janet_core_cfuns(JanetTable *env, const char *regprefix, const JanetReg *cf
 }
 #endif
 
-/* Resolve a symbol in the environment */
+/* Resolve a symbol in the environment. The kind of binding is cached
+ * in the flags of the binding's table, and cleared whenever the table
+ * is modified. */
 JanetBindingType janet_resolve(JanetTable *env, const uint8_t *sym, Janet *out) {
-    Janet ref;
     JanetTable *entry_table;
+    JanetBindingType type;
     Janet entry = janet_table_get(env, janet_wrap_symbol(sym));
     if (!janet_checktype(entry, JANET_TABLE))
         return JANET_BINDING_NONE;
     entry_table = janet_unwrap_table(entry);
-    if (!janet_checktype(
-                janet_table_get(entry_table, janet_ckeywordv("macro")),
-                JANET_NIL)) {
-        *out = janet_table_get(entry_table, janet_ckeywordv("value"));
-        return JANET_BINDING_MACRO;
-    }
-    ref = janet_table_get(entry_table, janet_ckeywordv("ref"));
-    if (janet_checktype(ref, JANET_ARRAY)) {
-        *out = ref;
-        return JANET_BINDING_VAR;
+    if (entry_table->gc.flags & JANET_TABLE_FLAG_BINDING) {
+        type = (JanetBindingType)((entry_table->gc.flags & JANET_TABLE_BINDING_MASK)
+                                  >> JANET_TABLE_BINDING_SHIFT);
+    } else {
+        if (!janet_checktype(janet_table_get(entry_table, janet_vm_kw_macro), JANET_NIL)) {
+            type = JANET_BINDING_MACRO;
+        } else if (janet_checktype(janet_table_get(entry_table, janet_vm_kw_ref), JANET_ARRAY)) {
+            type = JANET_BINDING_VAR;
+        } else {
+            type = JANET_BINDING_DEF;
+        }
+        /* Prototypes can change without touching the binding table */
+        if (NULL == entry_table->proto) {
+            entry_table->gc.flags |= JANET_TABLE_FLAG_BINDING |
+                                     (type << JANET_TABLE_BINDING_SHIFT);
+        }
     }
-    *out = janet_table_get(entry_table, janet_ckeywordv("value"));
-    return JANET_BINDING_DEF;
+    *out = janet_table_get(entry_table,
+                           type == JANET_BINDING_VAR ? janet_vm_kw_ref : janet_vm_kw_value);
+    return type;
 }
 
 /* Resolve a symbol in the core environment. */
@@ -65,8 +65,11 @@
 extern const char janet_base64[65];
 int32_t janet_array_calchash(const Janet *array, int32_t len);
 int32_t janet_kv_calchash(const JanetKV *kvs, int32_t len);
+int32_t janet_tuple_gethash(const Janet *tuple);
+int32_t janet_struct_gethash(const JanetKV *st);
 int32_t janet_string_calchash(const uint8_t *str, int32_t len);
 int32_t janet_tablen(int32_t n);
+const uint8_t *janet_string_frombuffer(JanetBuffer *buffer);
 void janet_buffer_push_types(JanetBuffer *buffer, int types);
 const JanetKV *janet_dict_find(const JanetKV *buckets, int32_t cap, Janet key);
 Janet janet_dict_get(const JanetKV *buckets, int32_t cap, Janet key);
@@ -84,6 +87,47 @@ void janet_buffer_format(
     int32_t argstart,
     int32_t argc,
     Janet *argv);
+void janet_buffer_format_stream(
+    JanetBuffer *b,
+    FILE *stream,
+    const char *strfrmt,
+    int32_t argstart,
+    int32_t argc,
+    Janet *argv);
+
+/* Caches derived from table contents. Tables consulted for dynamic bindings
+ * are flagged so that mutating them invalidates the dynamic binding cache,
+ * and binding tables remember their JanetBindingType until modified. */
+#define JANET_TABLE_FLAG_DYNAMIC 0x20000
+#define JANET_TABLE_FLAG_BINDING 0x40000
+#define JANET_TABLE_BINDING_SHIFT 19
+#define JANET_TABLE_BINDING_MASK (0x3 << JANET_TABLE_BINDING_SHIFT)
+/* Small heap tables keep their buckets in the same allocation as the
+ * JanetTable header; such storage must not be freed separately. The number
+ * of inline buckets is kept in the flags after the table outgrows them, so
+ * they can be used again if it shrinks. */
+#define JANET_TABLE_FLAG_INLINE 0x200000
+#define JANET_TABLE_INLINE_CAP 8
+#define JANET_TABLE_INLINE_SHIFT 24
+#define JANET_TABLE_INLINE_MASK (0xF << JANET_TABLE_INLINE_SHIFT)
+#define janet_table_inline_cap(t) \
+    (((t)->gc.flags & JANET_TABLE_INLINE_MASK) >> JANET_TABLE_INLINE_SHIFT)
+/* Weak tables do not keep their keys and/or values alive. Entries are
+ * removed by the collector once a weakly held reference dies. */
+#define JANET_TABLE_FLAG_WEAKK 0x400000
+#define JANET_TABLE_FLAG_WEAKV 0x800000
+#define JANET_TABLE_FLAG_WEAK (JANET_TABLE_FLAG_WEAKK | JANET_TABLE_FLAG_WEAKV)
+#define janet_table_touch(t) do { \
+    if ((t)->gc.flags & JANET_TABLE_FLAG_DYNAMIC) janet_dyn_invalidate(); \
+    (t)->gc.flags &= ~(JANET_TABLE_FLAG_BINDING | JANET_TABLE_BINDING_MASK); \
+} while (0)
+void janet_dyn_invalidate(void);
+Janet janet_dyn_lookup(JanetTable *env, Janet key);
+
+/* Source index for locating funcdefs by source file */
+void janet_srcindex_add(JanetFuncDef *def);
+void janet_srcindex_prune(void);
+void janet_srcindex_deinit(void);
 
 /* Inside the janet core, defining globals is different
  * at bootstrap time and normal runtime */
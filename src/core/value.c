@@ -22,6 +22,7 @@
 
 #ifndef JANET_AMALG
 #include <janet.h>
+#include "util.h"
 #endif
 
 /*
@@ -78,10 +79,10 @@ int32_t janet_hash(Janet x) {
             hash = janet_string_hash(janet_unwrap_string(x));
             break;
         case JANET_TUPLE:
-            hash = janet_tuple_hash(janet_unwrap_tuple(x));
+            hash = janet_tuple_gethash(janet_unwrap_tuple(x));
             break;
         case JANET_STRUCT:
-            hash = janet_struct_hash(janet_unwrap_struct(x));
+            hash = janet_struct_gethash(janet_unwrap_struct(x));
             break;
         default:
             /* TODO - test performance with different hash functions */
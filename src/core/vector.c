@@ -37,13 +37,26 @@ void *janet_v_grow(void *v, int32_t increment, int32_t itemsize) {
     return p + 2;
 }
 
+/* Grow a vector that lives in an arena */
+void *janet_v_agrow(JanetArena *arena, void *v, int32_t increment, int32_t itemsize) {
+    int32_t dbl_cur = (NULL != v) ? 2 * janet_v__cap(v) : 0;
+    int32_t min_needed = janet_v_count(v) + increment;
+    int32_t m = dbl_cur > min_needed ? dbl_cur : min_needed;
+    size_t oldsize = v ? ((size_t) itemsize) * janet_v__cap(v) + sizeof(int32_t) * 2 : 0;
+    size_t newsize = ((size_t) itemsize) * m + sizeof(int32_t) * 2;
+    int32_t *p = (int32_t *) janet_arena_realloc(arena, v ? janet_v__raw(v) : 0, oldsize, newsize);
+    if (!v) p[1] = 0;
+    p[0] = m;
+    return p + 2;
+}
+
 /* Convert a buffer to normal allocated memory (forget capacity) */
 void *janet_v_flattenmem(void *v, int32_t itemsize) {
     int32_t *p;
     int32_t sizen;
     if (NULL == v) return NULL;
     sizen = itemsize * janet_v__cnt(v);
-    p = malloc(sizen);
+    p = janet_malloc(sizen);
     if (NULL != p) {
         memcpy(p, v, sizen);
         return p;
@@ -55,3 +68,68 @@ void *janet_v_flattenmem(void *v, int32_t itemsize) {
     }
 }
 
+/* Arena allocation. Sizes are rounded up so every allocation is aligned
+ * like scratch memory. */
+#define JANET_ARENA_ALIGN 16
+#define JANET_ARENA_BLOCK 4096
+
+struct JanetArenaBlock {
+    JanetArenaBlock *prev;
+    size_t size;
+};
+
+#define ARENA_ROUND(n) (((n) + JANET_ARENA_ALIGN - 1) & ~((size_t) JANET_ARENA_ALIGN - 1))
+#define ARENA_HDR_SIZE ARENA_ROUND(sizeof(JanetArenaBlock))
+
+void janet_arena_init(JanetArena *arena, void *mem, size_t size) {
+    arena->next = mem;
+    arena->end = (char *) mem + size;
+    arena->blocks = NULL;
+}
+
+void janet_arena_deinit(JanetArena *arena) {
+    JanetArenaBlock *block = arena->blocks;
+    while (NULL != block) {
+        JanetArenaBlock *prev = block->prev;
+        janet_sfree(block);
+        block = prev;
+    }
+    arena->next = arena->end = NULL;
+    arena->blocks = NULL;
+}
+
+void *janet_arena_alloc(JanetArena *arena, size_t size) {
+    size = ARENA_ROUND(size);
+    if ((size_t)(arena->end - arena->next) < size) {
+        /* Double the block size so large compilations need few blocks */
+        size_t blocksize = arena->blocks ? 2 * arena->blocks->size : JANET_ARENA_BLOCK;
+        if (blocksize < size) blocksize = size;
+        JanetArenaBlock *block = janet_smalloc(ARENA_HDR_SIZE + blocksize);
+        block->prev = arena->blocks;
+        block->size = blocksize;
+        arena->blocks = block;
+        arena->next = (char *) block + ARENA_HDR_SIZE;
+        arena->end = arena->next + blocksize;
+    }
+    void *mem = arena->next;
+    arena->next += size;
+    return mem;
+}
+
+void *janet_arena_realloc(JanetArena *arena, void *mem, size_t oldsize, size_t newsize) {
+    if (NULL == mem) return janet_arena_alloc(arena, newsize);
+    /* The newest allocation can grow in place */
+    if ((char *) mem + ARENA_ROUND(oldsize) == arena->next &&
+            (size_t)(arena->end - (char *) mem) >= ARENA_ROUND(newsize)) {
+        arena->next = (char *) mem + ARENA_ROUND(newsize);
+        return mem;
+    }
+    void *newmem = janet_arena_alloc(arena, newsize);
+    memcpy(newmem, mem, oldsize < newsize ? oldsize : newsize);
+    return newmem;
+}
+
+void janet_arena_release(JanetArena *arena, void *mem, size_t size) {
+    if ((char *) mem + ARENA_ROUND(size) == arena->next)
+        arena->next = mem;
+}
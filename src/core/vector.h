@@ -52,8 +52,36 @@
 #define janet_v__maybegrow(v, n) (janet_v__needgrow((v), (n)) ? janet_v__grow((v), (n)) : 0)
 #define janet_v__grow(v, n)      ((v) = janet_v_grow((v), (n), sizeof(*(v))))
 
+/* A bump allocator for temporary memory that is all freed at once, such as
+ * the vectors of a single compilation. The first block can be supplied by the
+ * caller, for example from the C stack. Later blocks are scratch memory, so an
+ * arena abandoned by a panic is still freed by the next collection. */
+typedef struct JanetArenaBlock JanetArenaBlock;
+typedef struct {
+    char *next;
+    char *end;
+    JanetArenaBlock *blocks;
+} JanetArena;
+
+/* Vectors in an arena are grown with janet_v_apush and given back with
+ * janet_v_afree, which only reclaims the newest allocation. The rest of
+ * the arena is reclaimed by janet_arena_deinit. */
+#define janet_v_apush(a, v, x)   (janet_v__amaybegrow(a, v, 1), (v)[janet_v__cnt(v)++] = (x))
+#define janet_v_afree(a, v)      (((v) != NULL) ? (janet_arena_release((a), janet_v__raw(v), janet_v__size(v)), 0) : 0)
+
+#define janet_v__size(v)             (sizeof(int32_t) * 2 + sizeof(*(v)) * janet_v__cap(v))
+#define janet_v__amaybegrow(a, v, n) (janet_v__needgrow((v), (n)) ? janet_v__agrow(a, v, n) : 0)
+#define janet_v__agrow(a, v, n)      ((v) = janet_v_agrow((a), (v), (n), sizeof(*(v))))
+
 /* Actual functions defined in vector.c */
 void *janet_v_grow(void *v, int32_t increment, int32_t itemsize);
+void *janet_v_agrow(JanetArena *arena, void *v, int32_t increment, int32_t itemsize);
 void *janet_v_flattenmem(void *v, int32_t itemsize);
 
+void janet_arena_init(JanetArena *arena, void *mem, size_t size);
+void janet_arena_deinit(JanetArena *arena);
+void *janet_arena_alloc(JanetArena *arena, size_t size);
+void *janet_arena_realloc(JanetArena *arena, void *mem, size_t oldsize, size_t newsize);
+void janet_arena_release(JanetArena *arena, void *mem, size_t size);
+
 #endif
@@ -33,9 +33,28 @@
 JANET_THREAD_LOCAL JanetTable *janet_vm_core_env;
 JANET_THREAD_LOCAL JanetTable *janet_vm_registry;
 JANET_THREAD_LOCAL int janet_vm_stackn = 0;
+JANET_THREAD_LOCAL int janet_vm_continue_level = -1;
 JANET_THREAD_LOCAL JanetFiber *janet_vm_fiber = NULL;
 JANET_THREAD_LOCAL Janet *janet_vm_return_reg = NULL;
 JANET_THREAD_LOCAL jmp_buf *janet_vm_jmp_buf = NULL;
+JANET_THREAD_LOCAL Janet janet_vm_kw_value;
+JANET_THREAD_LOCAL Janet janet_vm_kw_ref;
+JANET_THREAD_LOCAL Janet janet_vm_kw_macro;
+JANET_THREAD_LOCAL Janet janet_vm_kw_doc;
+JANET_THREAD_LOCAL Janet janet_vm_kw_source_map;
+
+/* Internal signal returned by run_vm when the current fiber resumes its
+ * child. janet_continue then runs the child in the same C frame. */
+#define JANET_SIGNAL_SWITCH ((JanetSignal) (JANET_SIGNAL_USER9 + 1))
+
+/* Check if a fiber can be resumed by switching to it directly */
+static int janet_fiber_can_switch(JanetFiber *fiber) {
+    JanetFiberStatus status = janet_fiber_status(fiber);
+    return NULL == fiber->child &&
+           status != JANET_STATUS_ALIVE &&
+           status != JANET_STATUS_DEAD &&
+           status != JANET_STATUS_ERROR;
+}
 
 /* Virtual registers
  *
@@ -92,7 +111,8 @@ JANET_THREAD_LOCAL jmp_buf *janet_vm_jmp_buf = NULL;
 
 /* Next instruction variations */
 #define maybe_collect() do {\
-    if (janet_vm_next_collection >= janet_vm_gc_interval) janet_collect(); } while (0)
+    if (janet_vm_next_collection >= janet_vm_gc_trigger) janet_collect(); \
+    else if (NULL != janet_vm_finalizers) janet_gcfinalize(JANET_FINALIZE_BATCH); } while (0)
 #define vm_checkgc_next() maybe_collect(); vm_next()
 #define vm_pcnext() pc++; vm_next()
 #define vm_checkgc_pcnext() maybe_collect(); vm_pcnext()
@@ -217,6 +237,70 @@ static Janet resolve_method(Janet name, JanetFiber *fiber) {
     return callee;
 }
 
+/* Call a value that is not a janet function with the arguments pushed on
+ * the fiber, catching any error it raises, as a protected call does. C
+ * functions run as in a normal call, so their errors are caught here
+ * instead of by unwinding the fiber. Returns the signal. */
+static JanetSignal janet_pcall_nonfn(JanetFiber *fiber, Janet callee, Janet *out) {
+    jmp_buf buf;
+    jmp_buf *old_vm_jmp_buf = janet_vm_jmp_buf;
+    Janet *old_vm_return_reg = janet_vm_return_reg;
+    int32_t oldn = janet_vm_stackn;
+    int handle = janet_vm_gc_suspend;
+    int32_t frame = fiber->frame;
+    int32_t stackstart = fiber->stackstart;
+    JanetSignal signal = JANET_SIGNAL_OK;
+    janet_vm_jmp_buf = &buf;
+    janet_vm_return_reg = out;
+#if defined(JANET_BSD) || defined(JANET_APPLE)
+    if (_setjmp(buf)) {
+#else
+    if (setjmp(buf)) {
+#endif
+        /* Drop the frames and arguments of the failed call */
+        while (fiber->frame != frame) janet_fiber_popframe(fiber);
+        fiber->stacktop = fiber->stackstart = stackstart;
+        janet_vm_stackn = oldn;
+        janet_vm_gc_suspend = handle;
+        signal = JANET_SIGNAL_ERROR;
+    } else {
+        Janet fn = janet_checktype(callee, JANET_KEYWORD)
+                   ? resolve_method(callee, fiber)
+                   : callee;
+        int32_t argc = fiber->stacktop - fiber->stackstart;
+        if (janet_checktype(fn, JANET_FUNCTION)) {
+            /* A method; janet_call pushes its own copy of the arguments */
+            Janet *args = janet_smalloc(sizeof(Janet) * (argc ? argc : 1));
+            memcpy(args, fiber->data + fiber->stackstart, sizeof(Janet) * argc);
+            fiber->stacktop = fiber->stackstart;
+            *out = janet_call(janet_unwrap_function(fn), argc, args);
+            janet_sfree(args);
+        } else if (janet_checktype(fn, JANET_CFUNCTION)) {
+            janet_fiber_cframe(fiber, janet_unwrap_cfunction(fn));
+            *out = janet_unwrap_cfunction(fn)(argc, fiber->data + fiber->frame);
+            janet_fiber_popframe(fiber);
+        } else {
+            *out = call_nonfn(fiber, fn);
+        }
+    }
+    janet_vm_jmp_buf = old_vm_jmp_buf;
+    janet_vm_return_reg = old_vm_return_reg;
+    return signal;
+}
+
+/* Get how far a jump table instruction with the given table jumps when
+ * dispatching on x. Values missing from the table jump past all branches. */
+static int32_t janet_jump_table_offset(Janet table, Janet x) {
+    const JanetKV *st = janet_unwrap_struct(table);
+    /* -0 and 0 are equal but hash differently */
+    if (janet_checktype(x, JANET_NUMBER) && janet_unwrap_number(x) == 0.0)
+        x = janet_wrap_number(0.0);
+    Janet index = janet_struct_get(st, x);
+    return 1 + (janet_checktype(index, JANET_NIL)
+                ? janet_struct_length(st)
+                : janet_unwrap_integer(index));
+}
+
 /* Interpreter main loop */
 static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status) {
 
@@ -293,8 +377,8 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
         &&label_JOP_NUMERIC_GREATER_THAN,
         &&label_JOP_NUMERIC_GREATER_THAN_EQUAL,
         &&label_JOP_NUMERIC_EQUAL,
-        &&label_unknown_op,
-        &&label_unknown_op,
+        &&label_JOP_PROTECTED_CALL,
+        &&label_JOP_JUMP_TABLE,
         &&label_unknown_op,
         &&label_unknown_op,
         &&label_unknown_op,
@@ -624,6 +708,11 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
     pc += DS;
     vm_next();
 
+    VM_OP(JOP_JUMP_TABLE) {
+        pc += janet_jump_table_offset(func->def->constants[E], stack[A]);
+        vm_next();
+    }
+
     VM_OP(JOP_JUMP_IF)
     if (janet_truthy(stack[A])) {
         pc += ES;
@@ -825,6 +914,67 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
         }
     }
 
+    VM_OP(JOP_PROTECTED_CALL) {
+        Janet callee = stack[E];
+        int32_t argc = fiber->stacktop - fiber->stackstart;
+        /* Errors raised before the callee starts are caught as well, by
+         * continuing straight to the error path. */
+        if (fiber->stacktop > fiber->maxstack) {
+            fiber->stacktop = fiber->stackstart;
+            stack[A] = janet_cstringv("stack overflow");
+            pc += 2;
+            vm_next();
+        }
+        if (!janet_checktype(callee, JANET_FUNCTION)) {
+            Janet retreg;
+            vm_commit();
+            JanetSignal sig = janet_pcall_nonfn(fiber, callee, &retreg);
+            stack = fiber->data + fiber->frame;
+            stack[A] = retreg;
+            if (sig == JANET_SIGNAL_ERROR) pc++;
+            vm_checkgc_pcnext();
+        }
+        func = janet_unwrap_function(callee);
+        if (argc < func->def->min_arity || argc > func->def->max_arity) {
+            fiber->stacktop = fiber->stackstart;
+            stack[A] = janet_wrap_string(janet_formatc("%v called with %d argument%s, expected %d",
+                                         callee, argc, argc == 1 ? "" : "s", func->def->arity));
+            pc += 2;
+            vm_checkgc_next();
+        }
+        if (janet_vm_stackn == janet_vm_continue_level) {
+            /* Push a protected frame on the current fiber. On error, janet_continue
+             * unwinds to it and resumes at the second instruction after this one. */
+            if (func->gc.flags & JANET_FUNCFLAG_TRACE) vm_do_trace(func);
+            janet_stack_frame(stack)->pc = pc;
+            janet_fiber_funcframe(fiber, func);
+            janet_fiber_frame(fiber)->flags |= JANET_STACKFRAME_PROTECTED;
+            stack = fiber->data + fiber->frame;
+            pc = func->def->bytecode;
+            vm_checkgc_next();
+        } else {
+            /* Errors cannot unwind through C frames, so run the call in a
+             * child fiber that shares our dynamic bindings instead. */
+            Janet retreg;
+            vm_commit();
+            JanetFiber *child = janet_fiber(func, 64, argc, fiber->data + fiber->stackstart);
+            fiber->stacktop = fiber->stackstart;
+            if (NULL == child) vm_throw("could not create fiber");
+            if (NULL == fiber->env) fiber->env = janet_table(0);
+            child->env = fiber->env;
+            child->flags |= JANET_FIBER_MASK_ERROR;
+            fiber->child = child;
+            JanetSignal sig = janet_continue(child, janet_wrap_nil(), &retreg);
+            if (sig != JANET_SIGNAL_OK && sig != JANET_SIGNAL_ERROR)
+                vm_return(sig, retreg);
+            fiber->child = NULL;
+            stack = fiber->data + fiber->frame;
+            stack[A] = retreg;
+            if (sig == JANET_SIGNAL_ERROR) pc++;
+            vm_checkgc_pcnext();
+        }
+    }
+
     VM_OP(JOP_TAILCALL) {
         Janet callee = stack[D];
         if (fiber->stacktop > fiber->maxstack) {
@@ -871,6 +1021,11 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
         Janet retreg;
         vm_assert_type(stack[B], JANET_FIBER);
         JanetFiber *child = janet_unwrap_fiber(stack[B]);
+        if (janet_vm_stackn == janet_vm_continue_level && janet_fiber_can_switch(child)) {
+            /* Let janet_continue switch to the child without recursing */
+            fiber->child = child;
+            vm_return(JANET_SIGNAL_SWITCH, stack[C]);
+        }
         fiber->child = child;
         JanetSignal sig = janet_continue(child, stack[C], &retreg);
         if (sig != JANET_SIGNAL_OK && !(child->flags & (1 << sig)))
@@ -990,8 +1145,7 @@ static JanetSignal run_vm(JanetFiber *fiber, Janet in, JanetFiberStatus status)
         janet_buffer_init(&buffer, 10 * count);
         for (int32_t i = 0; i < count; i++)
             janet_to_string_b(&buffer, mem[i]);
-        stack[D] = janet_stringv(buffer.data, buffer.count);
-        janet_buffer_deinit(&buffer);
+        stack[D] = janet_wrap_string(janet_string_frombuffer(&buffer));
         fiber->stacktop = fiber->stackstart;
         vm_checkgc_pcnext();
     }
@@ -1052,6 +1206,14 @@ JanetSignal janet_step(JanetFiber *fiber, Janet in, Janet *out) {
             nexta = pc + 1;
             nextb = pc + ES;
             break;
+        case JOP_JUMP_TABLE: {
+            /* The dispatch value is already on the stack, so break only
+             * at the branch that will be taken. */
+            Janet *stack = fiber->data + fiber->frame;
+            JanetFunction *func = janet_stack_frame(stack)->func;
+            nexta = pc + janet_jump_table_offset(func->def->constants[E], stack[A]);
+            break;
+        }
     }
     if (nexta) {
         olda = *nexta;
@@ -1104,6 +1266,104 @@ Janet janet_call(JanetFunction *fun, int32_t argc, const Janet *argv) {
     return *janet_vm_return_reg;
 }
 
+/* Unwind a fiber to its innermost protected frame after an error. The
+ * error is stored in the destination slot of the protected call, and
+ * execution will continue two instructions past it. Returns 0 if no
+ * frame catches the error. */
+static int janet_unwind_protected(JanetFiber *fiber, Janet err) {
+    int32_t i = fiber->frame;
+    while (i > 0) {
+        JanetStackFrame *frame = janet_stack_frame(fiber->data + i);
+        if (frame->flags & JANET_STACKFRAME_PROTECTED) break;
+        i = frame->prevframe;
+    }
+    if (i <= 0) return 0;
+    while (fiber->frame != i) janet_fiber_popframe(fiber);
+    janet_fiber_popframe(fiber);
+    fiber->child = NULL;
+    /* Release the stack grown by the failed call, so it does not count
+     * towards a heap limit while the handler runs. */
+    janet_fiber_shrink(fiber);
+    Janet *stack = fiber->data + fiber->frame;
+    uint32_t *pc = janet_stack_frame(stack)->pc;
+    stack[A] = err;
+    janet_stack_frame(stack)->pc = pc + 2;
+    return 1;
+}
+
+/* The parents of the fiber janet_continue is running, innermost last. The
+ * root fiber is not included. Short chains fit in the local array. */
+typedef struct {
+    JanetFiber **data;
+    int32_t count;
+    int32_t capacity;
+    JanetFiber *local[16];
+} JanetFiberChain;
+
+static void janet_chain_push(JanetFiberChain *chain, JanetFiber *fiber) {
+    if (chain->count == chain->capacity) {
+        int32_t newcap = 2 * chain->capacity;
+        JanetFiber **newdata;
+        if (chain->data == chain->local) {
+            newdata = janet_malloc(sizeof(JanetFiber *) * newcap);
+            if (NULL != newdata)
+                memcpy(newdata, chain->local, sizeof(chain->local));
+        } else {
+            newdata = janet_realloc(chain->data, sizeof(JanetFiber *) * newcap);
+        }
+        if (NULL == newdata) {
+            JANET_OUT_OF_MEMORY;
+        }
+        chain->data = newdata;
+        chain->capacity = newcap;
+    }
+    chain->data[chain->count++] = fiber;
+}
+
+/* Decide which fiber janet_continue runs next after the current fiber
+ * stopped with a signal. Switches to a resumed child, back to the parent of
+ * a finished child, or into a protected call that caught an error. Returns 0
+ * when the root fiber itself stops with the final signal. */
+static int janet_fiber_next(JanetFiberChain *chain, JanetSignal *signal, Janet *in, JanetFiberStatus *status) {
+    JanetFiber *fiber = janet_vm_fiber;
+    JanetSignal sig = *signal;
+    if (sig == JANET_SIGNAL_SWITCH) {
+        JanetFiber *child = fiber->child;
+        janet_chain_push(chain, fiber);
+        *status = janet_fiber_status(child);
+        *in = *janet_vm_return_reg;
+        janet_fiber_set_status(child, JANET_STATUS_ALIVE);
+        janet_vm_fiber = child;
+        return 1;
+    }
+    for (;;) {
+        if (sig == JANET_SIGNAL_ERROR && janet_unwind_protected(fiber, *janet_vm_return_reg)) {
+            *status = JANET_STATUS_NEW;
+            *in = janet_wrap_nil();
+            janet_vm_fiber = fiber;
+            return 1;
+        }
+        janet_fiber_set_status(fiber, sig);
+        if (sig == JANET_SIGNAL_OK || sig == JANET_SIGNAL_ERROR)
+            janet_fiber_shrink(fiber);
+        if (chain->count == 0) {
+            *signal = sig;
+            return 0;
+        }
+        JanetFiber *parent = chain->data[--chain->count];
+        if (sig != JANET_SIGNAL_OK && !(fiber->flags & (1 << sig))) {
+            /* Not caught by the parent, which stops with the same signal */
+            fiber = parent;
+            continue;
+        }
+        parent->child = NULL;
+        *status = JANET_STATUS_ALIVE;
+        *in = *janet_vm_return_reg;
+        janet_vm_fiber = parent;
+        return 1;
+    }
+}
+
 /* Enter the main vm loop */
 JanetSignal janet_continue(JanetFiber *fiber, Janet in, Janet *out) {
     jmp_buf buf;
@@ -1139,38 +1399,59 @@ JanetSignal janet_continue(JanetFiber *fiber, Janet in, Janet *out) {
 
     /* Save global state */
     int32_t oldn = janet_vm_stackn++;
+    int old_continue_level = janet_vm_continue_level;
     int handle = janet_vm_gc_suspend;
     JanetFiber *old_vm_fiber = janet_vm_fiber;
     jmp_buf *old_vm_jmp_buf = janet_vm_jmp_buf;
     Janet *old_vm_return_reg = janet_vm_return_reg;
 
     /* Setup fiber */
+    JanetFiberChain chain;
+    chain.data = chain.local;
+    chain.count = 0;
+    chain.capacity = sizeof(chain.local) / sizeof(chain.local[0]);
     janet_vm_fiber = fiber;
-    janet_gcroot(janet_wrap_fiber(fiber));
+    JanetRootHandle root = janet_gcroot_handle(janet_wrap_fiber(fiber));
     janet_fiber_set_status(fiber, JANET_STATUS_ALIVE);
     janet_vm_return_reg = out;
     janet_vm_jmp_buf = &buf;
 
-    /* Run loop */
+    janet_vm_continue_level = janet_vm_stackn;
+
+    /* Run loop. Child fibers resumed at this level run from here as well, so
+     * switching fibers needs neither C recursion nor a new jmp_buf. After an
+     * error, drop any C state left by the error and pick the next fiber. A
+     * protected call continues with status NEW so run_vm does not consume
+     * the input. */
     JanetSignal signal;
+    JanetFiberStatus status = old_status;
+    for (;;) {
 #if defined(JANET_BSD) || defined(JANET_APPLE)
-    if (_setjmp(buf)) {
+        if (_setjmp(buf)) {
 #else
-    if (setjmp(buf)) {
+        if (setjmp(buf)) {
 #endif
-        signal = JANET_SIGNAL_ERROR;
-    } else {
-        signal = run_vm(fiber, in, old_status);
+            janet_vm_stackn = oldn + 1;
+            janet_vm_gc_suspend = handle;
+            signal = JANET_SIGNAL_ERROR;
+            if (!janet_fiber_next(&chain, &signal, &in, &status)) break;
+        } else {
+            signal = run_vm(janet_vm_fiber, in, status);
+            while (janet_fiber_next(&chain, &signal, &in, &status))
+                signal = run_vm(janet_vm_fiber, in, status);
+            break;
+        }
     }
 
     /* Tear down fiber */
-    janet_fiber_set_status(fiber, signal);
-    janet_gcunroot(janet_wrap_fiber(fiber));
+    if (chain.data != chain.local) janet_free(chain.data);
+    janet_gcunroot_handle(root);
 
     /* Restore global state */
     janet_vm_gc_suspend = handle;
     janet_vm_fiber = old_vm_fiber;
     janet_vm_stackn = oldn;
+    janet_vm_continue_level = old_continue_level;
     janet_vm_return_reg = old_vm_return_reg;
     janet_vm_jmp_buf = old_vm_jmp_buf;
 
@@ -1232,16 +1513,26 @@ int janet_init(void) {
     /* Garbage collection */
     janet_vm_blocks = NULL;
     janet_vm_next_collection = 0;
+    janet_vm_finalizers = NULL;
+    janet_vm_gc_threads = 1;
+    janet_vm_gc_parallel_min = JANET_GC_PARALLEL_MIN;
     /* Setting memoryInterval to zero forces
      * a collection pretty much every cycle, which is
      * incredibly horrible for performance, but can help ensure
      * there are no memory bugs during development */
     janet_vm_gc_interval = 0x10000;
+    janet_vm_heap_limit = 0;
+    janet_vm_heap_live = 0;
+    janet_gc_settrigger();
     janet_symcache_init();
     /* Initialize gc roots */
     janet_vm_roots = NULL;
     janet_vm_root_count = 0;
     janet_vm_root_capacity = 0;
+    janet_vm_root_handles = NULL;
+    janet_vm_root_handle_count = 0;
+    janet_vm_root_handle_capacity = 0;
+    janet_vm_root_handle_free = -1;
     /* Scratch memory */
     janet_scratch_mem = NULL;
     janet_scratch_len = 0;
@@ -1249,6 +1540,17 @@ int janet_init(void) {
     /* Initialize registry */
     janet_vm_registry = janet_table(0);
     janet_gcroot(janet_wrap_table(janet_vm_registry));
+    /* Binding keywords */
+    janet_vm_kw_value = janet_ckeywordv("value");
+    janet_vm_kw_ref = janet_ckeywordv("ref");
+    janet_vm_kw_macro = janet_ckeywordv("macro");
+    janet_vm_kw_doc = janet_ckeywordv("doc");
+    janet_vm_kw_source_map = janet_ckeywordv("source-map");
+    janet_gcroot(janet_vm_kw_value);
+    janet_gcroot(janet_vm_kw_ref);
+    janet_gcroot(janet_vm_kw_macro);
+    janet_gcroot(janet_vm_kw_doc);
+    janet_gcroot(janet_vm_kw_source_map);
     /* Core env */
     janet_vm_core_env = NULL;
     /* Seed RNG */
@@ -1264,10 +1566,15 @@ int janet_init(void) {
 void janet_deinit(void) {
     janet_clear_memory();
     janet_symcache_deinit();
-    free(janet_vm_roots);
+    janet_free(janet_vm_roots);
     janet_vm_roots = NULL;
     janet_vm_root_count = 0;
     janet_vm_root_capacity = 0;
+    janet_free(janet_vm_root_handles);
+    janet_vm_root_handles = NULL;
+    janet_vm_root_handle_count = 0;
+    janet_vm_root_handle_capacity = 0;
+    janet_vm_root_handle_free = -1;
     janet_vm_registry = NULL;
     janet_vm_core_env = NULL;
 #ifdef JANET_THREADS
@@ -256,6 +256,21 @@ typedef struct {
 #include <stddef.h>
 #include <stdio.h>
 
+/* Memory allocation used throughout the runtime. Define these in janetconf.h
+ * to use a custom allocator. */
+#ifndef janet_malloc
+#define janet_malloc(X) malloc((X))
+#endif
+#ifndef janet_realloc
+#define janet_realloc(X, Y) realloc((X), (Y))
+#endif
+#ifndef janet_calloc
+#define janet_calloc(X, Y) calloc((X), (Y))
+#endif
+#ifndef janet_free
+#define janet_free(X) free((X))
+#endif
+
 /* Names of all of the types */
 JANET_API extern const char *const janet_type_names[16];
 JANET_API extern const char *const janet_signal_names[14];
@@ -347,6 +362,9 @@ typedef const Janet *JanetTuple;
 typedef const JanetKV *JanetStruct;
 typedef void *JanetAbstract;
 
+/* Handle to a value rooted with janet_gcroot_handle */
+typedef int32_t JanetRootHandle;
+
 /* Basic types for all Janet Values */
 typedef enum JanetType {
     JANET_NUMBER,
@@ -736,6 +754,9 @@ struct JanetFiber {
 /* Mark if a stack frame is an entrance frame */
 #define JANET_STACKFRAME_ENTRANCE 2
 
+/* Mark if a stack frame was entered with a protected call and catches errors */
+#define JANET_STACKFRAME_PROTECTED 4
+
 /* A stack frame on the fiber. Is stored along with the stack values. */
 struct JanetStackFrame {
     JanetFunction *func;
@@ -824,6 +845,7 @@ struct JanetAbstractHead {
 #define JANET_FUNCDEF_FLAG_HASENVS 0x400000
 #define JANET_FUNCDEF_FLAG_HASSOURCEMAP 0x800000
 #define JANET_FUNCDEF_FLAG_STRUCTARG 0x1000000
+#define JANET_FUNCDEF_FLAG_PACKEDSOURCEMAP 0x2000000
 #define JANET_FUNCDEF_FLAG_TAG 0xFFFF
 
 /* Source mapping structure for a bytecode instruction */
@@ -841,7 +863,7 @@ struct JanetFuncDef {
     uint32_t *bytecode;
 
     /* Various debug information */
-    JanetSourceMapping *sourcemap;
+    JanetSourceMapping *sourcemap; /* Unpacked. NULL when the map is packed */
     JanetString source;
     JanetString name;
 
@@ -854,6 +876,10 @@ struct JanetFuncDef {
     int32_t bytecode_length;
     int32_t environments_length;
     int32_t defs_length;
+
+    /* Sourcemap packed as runs of deltas, read with janet_sourcemap_get */
+    uint8_t *sourcemap_packed;
+    int32_t sourcemap_length; /* Size of the packed sourcemap in bytes */
 };
 
 /* A function environment */
@@ -1080,6 +1106,8 @@ enum JanetOpCode {
     JOP_NUMERIC_GREATER_THAN,
     JOP_NUMERIC_GREATER_THAN_EQUAL,
     JOP_NUMERIC_EQUAL,
+    JOP_PROTECTED_CALL,
+    JOP_JUMP_TABLE,
     JOP_INSTRUCTION_COUNT
 };
 
@@ -1246,6 +1274,9 @@ JANET_API const JanetKV *janet_struct_find(JanetStruct st, Janet key);
 
 /* Table functions */
 JANET_API JanetTable *janet_table(int32_t capacity);
+JANET_API JanetTable *janet_table_weakk(int32_t capacity);
+JANET_API JanetTable *janet_table_weakv(int32_t capacity);
+JANET_API JanetTable *janet_table_weakkv(int32_t capacity);
 JANET_API JanetTable *janet_table_init(JanetTable *table, int32_t capacity);
 JANET_API void janet_table_deinit(JanetTable *table);
 JANET_API Janet janet_table_get(JanetTable *t, Janet key);
@@ -1279,6 +1310,7 @@ JANET_API const JanetKV *janet_dictionary_next(const JanetKV *kvs, int32_t cap,
 JANET_API void *janet_abstract_begin(const JanetAbstractType *type, size_t size);
 JANET_API JanetAbstract janet_abstract_end(void *abstractTemplate);
 JANET_API JanetAbstract janet_abstract(const JanetAbstractType *type, size_t size); /* begin and end in one call */
+JANET_API JanetAbstract janet_abstract_deferred(const JanetAbstractType *type, size_t size); /* gc callback runs after collection */
 
 /* Native */
 typedef void (*JanetModule)(JanetTable *);
@@ -1308,6 +1340,10 @@ JANET_API void janet_clear_memory(void);
 JANET_API void janet_gcroot(Janet root);
 JANET_API int janet_gcunroot(Janet root);
 JANET_API int janet_gcunrootall(Janet root);
+JANET_API JanetRootHandle janet_gcroot_handle(Janet root);
+JANET_API void janet_gcunroot_handle(JanetRootHandle handle);
+JANET_API void janet_gcpressure(size_t s);
+JANET_API void janet_gcsetlimit(size_t limit);
 JANET_API int janet_gclock(void);
 JANET_API void janet_gcunlock(int handle);
 
@@ -1315,6 +1351,9 @@ JANET_API void janet_gcunlock(int handle);
 JANET_API JanetFuncDef *janet_funcdef_alloc(void);
 JANET_API JanetFunction *janet_thunk(JanetFuncDef *def);
 JANET_API int janet_verify(JanetFuncDef *def);
+JANET_API void janet_sourcemap_pack(JanetFuncDef *def, const JanetSourceMapping *mappings);
+JANET_API int janet_sourcemap_get(JanetFuncDef *def, int32_t pc, JanetSourceMapping *out);
+JANET_API JanetSourceMapping *janet_sourcemap_unpack(JanetFuncDef *def);
 
 /* Pretty printing */
 #define JANET_PRETTY_COLOR 1